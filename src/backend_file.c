@@ -0,0 +1,679 @@
+#include <errno.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#define get_process_id() ((unsigned long)GetCurrentProcessId())
+#else
+#include <unistd.h>
+#define get_process_id() ((unsigned long)getpid())
+#endif
+
+#include "count_of.h"
+#include "display_list.h"
+#include "log.h"
+#include "print_backend.h"
+#include "raster.h"
+#include "thread.h"
+#include "trace.h"
+
+/* An in-process spooler with a few built-in virtual printers. Each
+ * document is written as a plain text journal of its pages and drawing
+ * commands to $PRINT_SPOOL_DIR (default: the working directory). The
+ * journal is only given its final name once the document ends, so anything
+ * watching the directory never sees a half-written job.
+ *
+ * To stand in for real printers, $PRINT_SPOOL_PAGE_MS makes each page take
+ * that long to print, and a printer is offline, failing every document,
+ * while a file named after it with ".offline" on the end is in the spool
+ * directory. $PRINT_PROBE_MS makes each capabilities query take that long,
+ * as it can on a network printer. */
+
+struct file_printer
+{
+    const char *name;
+    const char *driver;
+    int dpi;
+    int margin;
+    int colour;
+    const struct paper_info *papers;
+    int paper_count;
+};
+
+static const struct paper_info office_papers[] = {
+    {.size = 9, .width = 2100, .height = 2970, .name = "A4"},
+    {.size = 1, .width = 2159, .height = 2794, .name = "Letter"},
+    {.size = 11, .width = 1480, .height = 2100, .name = "A5"},
+};
+
+static const struct paper_info label_papers[] = {
+    {.size = 256, .width = 1016, .height = 1524, .name = "4x6in"},
+    {.size = 257, .width = 1000, .height = 1500, .name = "100x150mm"},
+    {.size = 258, .width = 620, .height = 290, .name = "62x29mm"},
+};
+
+static const struct file_printer file_printers[] = {
+    {
+        .name = "File Printer",
+        .driver = "File Spooler Office",
+        .dpi = 600,
+        .margin = 42,
+        .colour = 1,
+        .papers = office_papers,
+        .paper_count = COUNT_OF(office_papers),
+    },
+    {
+        .name = "File Label Printer",
+        .driver = "File Spooler Label",
+        .dpi = 203,
+        .margin = 0,
+        .colour = 0,
+        .papers = label_papers,
+        .paper_count = COUNT_OF(label_papers),
+    },
+    {
+        .name = "File Label Printer 300",
+        .driver = "File Spooler Label",
+        .dpi = 300,
+        .margin = 0,
+        .colour = 0,
+        .papers = label_papers,
+        .paper_count = COUNT_OF(label_papers),
+    },
+};
+
+static const char *const file_datatypes[] = {"RAW", "TEXT"};
+
+struct file_session
+{
+    /* Each page is recorded as a display list and written to the journal
+     * when it ends. */
+    struct display_session display;
+
+    const struct file_printer *printer;
+    char safe_name[PRINTER_NAME_LENGTH];
+    FILE *out;
+    char path[512];
+    char temp_path[520];
+
+    struct raster_renderer renderer;
+
+    /* For compressed bands: the last row written, which the next is sent
+     * against once seed_valid is set, and room for a row encoded. */
+    unsigned char *seed;
+    unsigned char *encoded;
+    size_t row_bytes;
+    int seed_valid;
+};
+
+static atomic_uint next_job_id;
+
+static const struct file_printer *find_printer(const char *printer_name)
+{
+    for (int i = 0; i < COUNT_OF(file_printers); i++)
+    {
+        if (strcmp(file_printers[i].name, printer_name) == 0)
+            return &file_printers[i];
+    }
+
+    log_error("No such printer \"%s\"", printer_name);
+
+    return NULL;
+}
+
+static int file_enum_printers(struct printer_info **printers, int *count)
+{
+    *count = 0;
+
+    *printers = (struct printer_info *)calloc(COUNT_OF(file_printers), sizeof(**printers));
+    if (*printers == NULL)
+    {
+        log_error("Failed to allocate memory");
+        return -ENOMEM;
+    }
+
+    for (int i = 0; i < COUNT_OF(file_printers); i++)
+    {
+        struct printer_info *printer = &(*printers)[i];
+
+        snprintf(printer->name, sizeof(printer->name), "%s", file_printers[i].name);
+        snprintf(printer->port, sizeof(printer->port), "FILE:");
+        snprintf(printer->driver, sizeof(printer->driver), "%s", file_printers[i].driver);
+        snprintf(printer->processor, sizeof(printer->processor), "filespool");
+    }
+
+    *count = COUNT_OF(file_printers);
+
+    return 0;
+}
+
+static int file_get_datatypes(
+    const struct printer_info *printer,
+    char (*names)[DATATYPE_NAME_LENGTH],
+    int max)
+{
+    (void)printer;
+
+    for (int i = 0; i < COUNT_OF(file_datatypes) && i < max; i++)
+        snprintf(names[i], DATATYPE_NAME_LENGTH, "%s", file_datatypes[i]);
+
+    return COUNT_OF(file_datatypes);
+}
+
+static int file_get_capabilities(const char *printer_name, struct printer_caps *caps)
+{
+    const struct file_printer *printer = NULL;
+    const char *probe_ms = getenv("PRINT_PROBE_MS");
+
+    memset(caps, 0, sizeof(*caps));
+
+    if (probe_ms != NULL && atoi(probe_ms) > 0)
+        thread_sleep_ms(atoi(probe_ms));
+
+    printer = find_printer(printer_name);
+    if (printer == NULL)
+        return -ENOENT;
+
+    caps->papers = (struct paper_info *)malloc(printer->paper_count * sizeof(*caps->papers));
+    if (caps->papers == NULL)
+    {
+        log_error("Failed to allocate memory");
+        return -ENOMEM;
+    }
+
+    memcpy(caps->papers, printer->papers, printer->paper_count * sizeof(*caps->papers));
+    caps->paper_count = printer->paper_count;
+    caps->colour = printer->colour;
+    caps->dpi_x = printer->dpi;
+    caps->dpi_y = printer->dpi;
+
+    return 0;
+}
+
+static int file_get_driver_version(const char *printer_name, char *version, size_t size)
+{
+    const struct file_printer *printer = find_printer(printer_name);
+
+    if (printer == NULL)
+        return -ENOENT;
+
+    snprintf(version, size, "%s 1", printer->driver);
+
+    return 0;
+}
+
+static void write_string(FILE *out, const char *text)
+{
+    fputc('"', out);
+
+    for (; *text != '\0'; text++)
+    {
+        if (*text == '"' || *text == '\\')
+            fputc('\\', out);
+
+        if (*text == '\n')
+            fputs("\\n", out);
+        else
+            fputc(*text, out);
+    }
+
+    fputc('"', out);
+}
+
+static int file_open_session(
+    const char *printer_name,
+    const struct session_options *options,
+    struct print_session **result)
+{
+    const struct file_printer *printer = NULL;
+    const struct paper_info *paper = NULL;
+    struct file_session *session = NULL;
+    struct print_session *base = NULL;
+
+    *result = NULL;
+
+    printer = find_printer(printer_name);
+    if (printer == NULL)
+        return -ENOENT;
+
+    paper = options->paper;
+
+    for (int i = 0; i < printer->paper_count && paper == NULL; i++)
+    {
+        if (strcmp(printer->papers[i].name, options->paper_name) == 0)
+            paper = &printer->papers[i];
+    }
+
+    if (paper == NULL)
+    {
+        log_error("Printer has no \"%s\" paper", options->paper_name);
+        return -ENOENT;
+    }
+
+    session = (struct file_session *)calloc(1, sizeof(*session));
+    if (session == NULL)
+    {
+        log_error("Failed to allocate memory");
+        return -ENOMEM;
+    }
+
+    base = &session->display.base;
+
+    session->printer = printer;
+    base->backend = &file_backend;
+    base->raster = options->raster;
+    base->compress = options->compress;
+    session->renderer.band_bytes = options->band_bytes;
+    session->renderer.threads = options->raster_threads;
+    base->paper = *paper;
+    base->dpi_x = printer->dpi;
+    base->dpi_y = printer->dpi;
+
+    base->space.device.width = mm_10_to_px(paper->width, printer->dpi);
+    base->space.device.height = mm_10_to_px(paper->height, printer->dpi);
+    base->space.device.offset_x = mm_10_to_px(printer->margin, printer->dpi);
+    base->space.device.offset_y = mm_10_to_px(printer->margin, printer->dpi);
+    base->printable_width =
+        base->space.device.width - 2 * base->space.device.offset_x;
+    base->printable_height =
+        base->space.device.height - 2 * base->space.device.offset_y;
+
+    coordinate_space_from_device(&base->space, paper);
+
+    /* Keep the file name portable. */
+    snprintf(session->safe_name, sizeof(session->safe_name), "%s", printer->name);
+    for (char *c = session->safe_name; *c != '\0'; c++)
+    {
+        if (!((*c >= 'a' && *c <= 'z') || (*c >= 'A' && *c <= 'Z') || (*c >= '0' && *c <= '9')))
+            *c = '_';
+    }
+
+    *result = base;
+
+    return 0;
+}
+
+static int is_offline(const struct file_session *session, const char *dir)
+{
+    char path[512];
+    FILE *marker = NULL;
+
+    snprintf(path, sizeof(path), "%s/%s.offline", dir != NULL ? dir : ".", session->safe_name);
+
+    marker = fopen(path, "r");
+    if (marker == NULL)
+        return 0;
+
+    fclose(marker);
+
+    return 1;
+}
+
+static int file_start_document(struct print_session *base, const char *document_name)
+{
+    struct file_session *session = (struct file_session *)base;
+    const char *dir = getenv("PRINT_SPOOL_DIR");
+
+    if (base->in_document)
+    {
+        log_error("Document already started");
+        return -EINVAL;
+    }
+
+    if (is_offline(session, dir))
+    {
+        log_error("Printer \"%s\" is offline", session->printer->name);
+        return -EIO;
+    }
+
+    snprintf(
+        session->path,
+        sizeof(session->path),
+        "%s/%s-%lu-%u.spl",
+        dir != NULL ? dir : ".",
+        session->safe_name,
+        get_process_id(),
+        atomic_fetch_add(&next_job_id, 1) + 1);
+
+    snprintf(session->temp_path, sizeof(session->temp_path), "%s.tmp", session->path);
+
+    session->out = fopen(session->temp_path, "w");
+    if (session->out == NULL)
+    {
+        log_error("Failed to create \"%s\"", session->temp_path);
+        return -EIO;
+    }
+
+    fprintf(session->out, "JOB ");
+    write_string(session->out, document_name != NULL ? document_name : "");
+    fprintf(session->out, "\nPRINTER ");
+    write_string(session->out, session->printer->name);
+    fprintf(
+        session->out,
+        "\nPAPER %d %d %d ",
+        base->paper.size,
+        base->paper.width,
+        base->paper.height);
+    write_string(session->out, base->paper.name);
+    fprintf(
+        session->out,
+        "\nDEVICE %d %d %d %d %d %d\n",
+        base->dpi_x,
+        base->dpi_y,
+        base->space.device.width,
+        base->space.device.height,
+        base->space.device.offset_x,
+        base->space.device.offset_y);
+
+    base->in_document = 1;
+    base->page_count = 0;
+
+    return 0;
+}
+
+static int file_end_document(struct print_session *base, int abort)
+{
+    int rc = 0;
+    struct file_session *session = (struct file_session *)base;
+
+    if (!base->in_document)
+    {
+        log_error("No document started");
+        return -EINVAL;
+    }
+
+    base->in_document = 0;
+    session->display.in_page = 0;
+
+    if (!abort)
+        fprintf(session->out, "ENDJOB %d\n", base->page_count);
+
+    if (fclose(session->out) != 0 || abort)
+    {
+        if (!abort)
+        {
+            log_error("Failed to write \"%s\"", session->temp_path);
+            rc = -EIO;
+        }
+
+        remove(session->temp_path);
+        goto exit;
+    }
+
+    /* rename() won't replace an existing file on Windows. */
+    remove(session->path);
+
+    if (rename(session->temp_path, session->path) != 0)
+    {
+        log_error("Failed to spool \"%s\"", session->path);
+        rc = -EIO;
+        goto exit;
+    }
+
+    base->document_count++;
+
+exit:
+    session->out = NULL;
+
+    return rc;
+}
+
+static int file_start_page(struct print_session *base)
+{
+    struct file_session *session = (struct file_session *)base;
+    int rc = display_session_start_page(&session->display);
+
+    if (rc < 0)
+        return rc;
+
+    fprintf(session->out, "PAGE %d\n", base->page_count + 1);
+
+    return 0;
+}
+
+/* One line of hex per row, without the padding. */
+static void write_rows(FILE *out, const struct bitmap *bitmap)
+{
+    size_t stride = ((size_t)bitmap->width + 7) / 8;
+
+    for (int y = 0; y < bitmap->height; y++)
+    {
+        const unsigned char *row = bitmap_row(bitmap, y);
+
+        for (size_t i = 0; i < stride; i++)
+            fprintf(out, "%02x", row[i]);
+
+        fputc('\n', out);
+    }
+}
+
+static void write_bitmap(FILE *out, const struct rect *r, const struct bitmap *bitmap)
+{
+    fprintf(
+        out,
+        "BITMAP %d %d %d %d %d %d\n",
+        r->left,
+        r->top,
+        r->right,
+        r->bottom,
+        bitmap->width,
+        bitmap->height);
+
+    write_rows(out, bitmap);
+}
+
+static void write_polygon(FILE *out, const struct point *points, int count)
+{
+    fprintf(out, "POLYGON %d", count);
+
+    for (int i = 0; i < count; i++)
+        fprintf(out, " %d %d", points[i].x, points[i].y);
+
+    fputc('\n', out);
+}
+
+static void write_page(FILE *out, const struct display_list *page)
+{
+    for (size_t i = 0; i < page->count; i++)
+    {
+        const struct display_command *command = &page->commands[i];
+        const struct rect *r = &command->rect;
+        struct bitmap bitmap;
+
+        switch (command->op)
+        {
+        case DISPLAY_RECT:
+            fprintf(out, "RECT %d %d %d %d\n", r->left, r->top, r->right, r->bottom);
+            break;
+
+        case DISPLAY_FILL:
+            fprintf(out, "FILL %d %d %d %d\n", r->left, r->top, r->right, r->bottom);
+            break;
+
+        case DISPLAY_LINE:
+            fprintf(
+                out,
+                "LINE %d %d %d %d\n",
+                command->line.x0,
+                command->line.y0,
+                command->line.x1,
+                command->line.y1);
+            break;
+
+        case DISPLAY_TEXT:
+            fprintf(out, "TEXT %d %d %d ", command->text.x, command->text.y, command->text.height);
+            write_string(out, display_command_text(page, command));
+            fputc('\n', out);
+            break;
+
+        case DISPLAY_BITMAP:
+            display_command_bitmap(page, command, &bitmap);
+            write_bitmap(out, &command->bitmap.rect, &bitmap);
+            break;
+
+        case DISPLAY_POLYGON:
+            write_polygon(out, display_command_points(page, command), command->polygon.count);
+            break;
+        }
+    }
+}
+
+/* Rastered pages are journalled as their bands, in device pixels. */
+static int write_band(const struct raster_band *band, void *context)
+{
+    struct file_session *session = (struct file_session *)context;
+    FILE *out = session->out;
+
+    fprintf(out, "BAND %d %d %d\n", band->y, band->bitmap->width, band->bitmap->height);
+    write_rows(out, band->bitmap);
+
+    return ferror(out) ? -EIO : 0;
+}
+
+/* Compressed bands have a line per row of the method's number and the
+ * encoded row in hex. Each row is sent against the one above it, across
+ * bands, and the first row of a page against white. */
+static int write_compressed_band(const struct raster_band *band, void *context)
+{
+    struct file_session *session = (struct file_session *)context;
+    struct print_session *base = &session->display.base;
+    const struct bitmap *bitmap = band->bitmap;
+    FILE *out = session->out;
+    size_t bytes = ((size_t)bitmap->width + 7) / 8;
+
+    if (bytes != session->row_bytes)
+    {
+        unsigned char *seed = (unsigned char *)realloc(session->seed, bytes);
+        unsigned char *encoded = NULL;
+
+        if (seed != NULL)
+            session->seed = seed;
+
+        encoded = (unsigned char *)realloc(session->encoded, SCANLINE_BOUND(bytes));
+        if (encoded != NULL)
+            session->encoded = encoded;
+
+        if (seed == NULL || encoded == NULL)
+        {
+            log_error("Failed to allocate memory");
+            return -ENOMEM;
+        }
+
+        session->row_bytes = bytes;
+        session->seed_valid = 0;
+    }
+
+    fprintf(out, "CBAND %d %d %d\n", band->y, bitmap->width, bitmap->height);
+
+    for (int y = 0; y < bitmap->height; y++)
+    {
+        const unsigned char *row = bitmap_row(bitmap, y);
+        enum scanline_method method;
+        size_t size = scanline_encode(
+            row,
+            session->seed_valid ? session->seed : NULL,
+            bytes,
+            session->encoded,
+            &method,
+            &base->raster_stats.compression);
+
+        fprintf(out, "%d ", (int)method);
+
+        for (size_t i = 0; i < size; i++)
+            fprintf(out, "%02x", session->encoded[i]);
+
+        fputc('\n', out);
+
+        memcpy(session->seed, row, bytes);
+        session->seed_valid = 1;
+    }
+
+    return ferror(out) ? -EIO : 0;
+}
+
+static int file_end_page(struct print_session *base)
+{
+    int rc = 0;
+    struct file_session *session = (struct file_session *)base;
+    const char *page_ms = getenv("PRINT_SPOOL_PAGE_MS");
+
+    if (!session->display.in_page)
+    {
+        log_error("No page started");
+        return -EINVAL;
+    }
+
+    if (base->raster)
+    {
+        session->seed_valid = 0;
+
+        rc = raster_render_page(
+            &session->renderer,
+            &session->display.page,
+            &base->space,
+            base->compress ? write_compressed_band : write_band,
+            session,
+            &base->raster_stats);
+        if (rc < 0)
+            return rc;
+    }
+    else
+    {
+        struct trace_span span = trace_begin("write page");
+
+        write_page(session->out, &session->display.page);
+        trace_end(&span);
+    }
+
+    session->display.in_page = 0;
+    base->page_count++;
+    fprintf(session->out, "ENDPAGE\n");
+
+    if (page_ms != NULL && atoi(page_ms) > 0)
+        thread_sleep_ms(atoi(page_ms));
+
+    return ferror(session->out) ? -EIO : 0;
+}
+
+static void file_close_session(struct print_session *base)
+{
+    struct file_session *session = (struct file_session *)base;
+
+    if (base->in_document)
+        file_end_document(base, 1);
+
+    display_session_release(&session->display);
+    raster_renderer_free(&session->renderer);
+    free(session->seed);
+    free(session->encoded);
+    free(session);
+}
+
+const struct print_backend file_backend = {
+    .name = "file",
+    .enum_printers = file_enum_printers,
+    .get_datatypes = file_get_datatypes,
+    .get_capabilities = file_get_capabilities,
+    .get_driver_version = file_get_driver_version,
+    .open_session = file_open_session,
+    .start_document = file_start_document,
+    .end_document = file_end_document,
+    .start_page = file_start_page,
+    .end_page = file_end_page,
+    .draw_rect = display_session_draw_rect,
+    .fill_rect = display_session_fill_rect,
+    .draw_line = display_session_draw_line,
+    .draw_text = display_session_draw_text,
+    .fill_polygon = display_session_fill_polygon,
+    .draw_bitmap = display_session_draw_bitmap,
+    .begin_template = display_session_begin_template,
+    .end_template = display_session_end_template,
+    .draw_template = display_session_draw_template,
+    .serialise_template = page_template_serialise,
+    .deserialise_template = page_template_deserialise,
+    .free_template = page_template_free,
+    .close_session = file_close_session,
+};
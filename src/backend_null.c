@@ -0,0 +1,305 @@
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "count_of.h"
+#include "display_list.h"
+#include "log.h"
+#include "print_backend.h"
+#include "raster.h"
+
+/* Label printers that take everything and print nothing. Pages are
+ * recorded as display lists, and rendered if the session rasters, exactly
+ * as the file backend does, then thrown away. What's left is the cost of
+ * composing and rendering pages, with no spooling or I/O in it, which is
+ * what benchmarks want to measure. */
+
+struct null_printer
+{
+    const char *name;
+    int dpi;
+};
+
+static const struct paper_info null_papers[] = {
+    {.size = 256, .width = 1016, .height = 1524, .name = "4x6in"},
+    {.size = 257, .width = 1000, .height = 1500, .name = "100x150mm"},
+    {.size = 258, .width = 620, .height = 290, .name = "62x29mm"},
+};
+
+static const struct null_printer null_printers[] = {
+    {.name = "Null Printer", .dpi = 203},
+    {.name = "Null Printer 300", .dpi = 300},
+    {.name = "Null Printer 600", .dpi = 600},
+};
+
+struct null_session
+{
+    struct display_session display;
+    struct raster_renderer renderer;
+};
+
+static const struct null_printer *find_printer(const char *printer_name)
+{
+    for (int i = 0; i < COUNT_OF(null_printers); i++)
+    {
+        if (strcmp(null_printers[i].name, printer_name) == 0)
+            return &null_printers[i];
+    }
+
+    log_error("No such printer \"%s\"", printer_name);
+
+    return NULL;
+}
+
+static int null_enum_printers(struct printer_info **printers, int *count)
+{
+    *count = 0;
+
+    *printers = (struct printer_info *)calloc(COUNT_OF(null_printers), sizeof(**printers));
+    if (*printers == NULL)
+    {
+        log_error("Failed to allocate memory");
+        return -ENOMEM;
+    }
+
+    for (int i = 0; i < COUNT_OF(null_printers); i++)
+    {
+        struct printer_info *printer = &(*printers)[i];
+
+        snprintf(printer->name, sizeof(printer->name), "%s", null_printers[i].name);
+        snprintf(printer->port, sizeof(printer->port), "NUL:");
+        snprintf(printer->driver, sizeof(printer->driver), "Null");
+        snprintf(printer->processor, sizeof(printer->processor), "null");
+    }
+
+    *count = COUNT_OF(null_printers);
+
+    return 0;
+}
+
+static int null_get_datatypes(
+    const struct printer_info *printer,
+    char (*names)[DATATYPE_NAME_LENGTH],
+    int max)
+{
+    (void)printer;
+
+    if (max > 0)
+        snprintf(names[0], DATATYPE_NAME_LENGTH, "RAW");
+
+    return 1;
+}
+
+static int null_get_capabilities(const char *printer_name, struct printer_caps *caps)
+{
+    const struct null_printer *printer = NULL;
+
+    memset(caps, 0, sizeof(*caps));
+
+    printer = find_printer(printer_name);
+    if (printer == NULL)
+        return -ENOENT;
+
+    caps->papers = (struct paper_info *)malloc(sizeof(null_papers));
+    if (caps->papers == NULL)
+    {
+        log_error("Failed to allocate memory");
+        return -ENOMEM;
+    }
+
+    memcpy(caps->papers, null_papers, sizeof(null_papers));
+    caps->paper_count = COUNT_OF(null_papers);
+    caps->dpi_x = printer->dpi;
+    caps->dpi_y = printer->dpi;
+
+    return 0;
+}
+
+static int null_get_driver_version(const char *printer_name, char *version, size_t size)
+{
+    if (find_printer(printer_name) == NULL)
+        return -ENOENT;
+
+    snprintf(version, size, "Null 1");
+
+    return 0;
+}
+
+static int null_open_session(
+    const char *printer_name,
+    const struct session_options *options,
+    struct print_session **result)
+{
+    const struct null_printer *printer = NULL;
+    const struct paper_info *paper = options->paper;
+    struct null_session *session = NULL;
+    struct print_session *base = NULL;
+
+    *result = NULL;
+
+    printer = find_printer(printer_name);
+    if (printer == NULL)
+        return -ENOENT;
+
+    for (int i = 0; i < COUNT_OF(null_papers) && paper == NULL; i++)
+    {
+        if (strcmp(null_papers[i].name, options->paper_name) == 0)
+            paper = &null_papers[i];
+    }
+
+    if (paper == NULL)
+    {
+        log_error("Printer has no \"%s\" paper", options->paper_name);
+        return -ENOENT;
+    }
+
+    session = (struct null_session *)calloc(1, sizeof(*session));
+    if (session == NULL)
+    {
+        log_error("Failed to allocate memory");
+        return -ENOMEM;
+    }
+
+    base = &session->display.base;
+
+    base->backend = &null_backend;
+    base->raster = options->raster;
+    base->compress = options->compress;
+    session->renderer.band_bytes = options->band_bytes;
+    session->renderer.threads = options->raster_threads;
+    base->paper = *paper;
+    base->dpi_x = printer->dpi;
+    base->dpi_y = printer->dpi;
+
+    /* No margins. */
+    base->space.device.width = mm_10_to_px(paper->width, printer->dpi);
+    base->space.device.height = mm_10_to_px(paper->height, printer->dpi);
+    base->printable_width = base->space.device.width;
+    base->printable_height = base->space.device.height;
+
+    coordinate_space_from_device(&base->space, paper);
+
+    *result = base;
+
+    return 0;
+}
+
+static int null_start_document(struct print_session *base, const char *document_name)
+{
+    (void)document_name;
+
+    if (base->in_document)
+    {
+        log_error("Document already started");
+        return -EINVAL;
+    }
+
+    base->in_document = 1;
+    base->page_count = 0;
+
+    return 0;
+}
+
+static int null_end_document(struct print_session *base, int abort)
+{
+    struct null_session *session = (struct null_session *)base;
+
+    if (!base->in_document)
+    {
+        log_error("No document started");
+        return -EINVAL;
+    }
+
+    base->in_document = 0;
+    session->display.in_page = 0;
+
+    if (!abort)
+        base->document_count++;
+
+    return 0;
+}
+
+static int null_start_page(struct print_session *base)
+{
+    struct null_session *session = (struct null_session *)base;
+
+    return display_session_start_page(&session->display);
+}
+
+/* The bands go nowhere. */
+static int discard_band(const struct raster_band *band, void *context)
+{
+    (void)band;
+    (void)context;
+
+    return 0;
+}
+
+static int null_end_page(struct print_session *base)
+{
+    int rc = 0;
+    struct null_session *session = (struct null_session *)base;
+
+    if (!session->display.in_page)
+    {
+        log_error("No page started");
+        return -EINVAL;
+    }
+
+    if (base->raster)
+    {
+        rc = raster_render_page(
+            &session->renderer,
+            &session->display.page,
+            &base->space,
+            discard_band,
+            session,
+            &base->raster_stats);
+        if (rc < 0)
+            return rc;
+    }
+
+    session->display.in_page = 0;
+    base->page_count++;
+
+    return 0;
+}
+
+static void null_close_session(struct print_session *base)
+{
+    struct null_session *session = (struct null_session *)base;
+
+    if (base->in_document)
+        null_end_document(base, 1);
+
+    display_session_release(&session->display);
+    raster_renderer_free(&session->renderer);
+    free(session);
+}
+
+const struct print_backend null_backend = {
+    .name = "null",
+    .enum_printers = null_enum_printers,
+    .get_datatypes = null_get_datatypes,
+    .get_capabilities = null_get_capabilities,
+    .get_driver_version = null_get_driver_version,
+    .open_session = null_open_session,
+    .start_document = null_start_document,
+    .end_document = null_end_document,
+    .start_page = null_start_page,
+    .end_page = null_end_page,
+    .draw_rect = display_session_draw_rect,
+    .fill_rect = display_session_fill_rect,
+    .draw_line = display_session_draw_line,
+    .draw_text = display_session_draw_text,
+    .fill_polygon = display_session_fill_polygon,
+    .draw_bitmap = display_session_draw_bitmap,
+    .begin_template = display_session_begin_template,
+    .end_template = display_session_end_template,
+    .draw_template = display_session_draw_template,
+    .serialise_template = page_template_serialise,
+    .deserialise_template = page_template_deserialise,
+    .free_template = page_template_free,
+    .close_session = null_close_session,
+};
@@ -0,0 +1,964 @@
+#include <windows.h>
+#include <winspool.h>
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "display_list.h"
+#include "log.h"
+#include "print_backend.h"
+#include "raster.h"
+#include "trace.h"
+
+struct win32_session
+{
+    /* Each page is recorded as a display list and played onto the printer
+     * with GDI when it ends. */
+    struct display_session display;
+
+    /* Negotiated once when the session opens and kept for every document
+     * printed through it. */
+    HDC printer;
+    DEVMODE *devmode;
+
+    struct raster_renderer renderer;
+};
+
+static void copy_string(char *dst, size_t size, const char *src)
+{
+    if (src == NULL)
+        src = "";
+
+    strncpy(dst, src, size - 1);
+    dst[size - 1] = '\0';
+}
+
+static int win32_enum_printers(struct printer_info **printers, int *count)
+{
+    int rc = 0;
+    DWORD needed = 0, returned = 0;
+    PRINTER_INFO_2 *pInfo = NULL;
+
+    *printers = NULL;
+    *count = 0;
+
+    EnumPrinters(PRINTER_ENUM_LOCAL | PRINTER_ENUM_CONNECTIONS, NULL, 2, NULL, 0, &needed, &returned);
+    if (needed <= 0)
+    {
+        log_error("Failed to get printer info");
+        rc = -EINVAL;
+        goto exit;
+    }
+
+    pInfo = (PRINTER_INFO_2 *)malloc(needed);
+    if (pInfo == NULL)
+    {
+        log_error("Failed to allocate memory");
+        rc = -ENOMEM;
+        goto exit;
+    }
+
+    if (!EnumPrinters(PRINTER_ENUM_LOCAL | PRINTER_ENUM_CONNECTIONS, NULL, 2, (LPBYTE)pInfo, needed, &needed, &returned))
+    {
+        log_error("Failed to get printer info");
+        rc = -EINVAL;
+        goto exit;
+    }
+
+    *printers = (struct printer_info *)calloc(returned > 0 ? returned : 1, sizeof(**printers));
+    if (*printers == NULL)
+    {
+        log_error("Failed to allocate memory");
+        rc = -ENOMEM;
+        goto exit;
+    }
+
+    for (DWORD i = 0; i < returned; i++)
+    {
+        PRINTER_INFO_2 *pPrinterInfo = &pInfo[i];
+        struct printer_info *printer = &(*printers)[i];
+
+        copy_string(printer->name, sizeof(printer->name), pPrinterInfo->pPrinterName);
+        copy_string(printer->port, sizeof(printer->port), pPrinterInfo->pPortName);
+        copy_string(printer->driver, sizeof(printer->driver), pPrinterInfo->pDriverName);
+        copy_string(printer->processor, sizeof(printer->processor), pPrinterInfo->pPrintProcessor);
+    }
+
+    *count = (int)returned;
+
+exit:
+    if (pInfo != NULL)
+        free(pInfo);
+
+    return rc;
+}
+
+static int win32_get_datatypes(
+    const struct printer_info *printer,
+    char (*names)[DATATYPE_NAME_LENGTH],
+    int max)
+{
+    int rc = 0;
+    DWORD needed = 0, returned = 0;
+    DATATYPES_INFO_1 *pInfo = NULL;
+
+    EnumPrintProcessorDatatypes(NULL, (LPSTR)printer->processor, 1, NULL, 0, &needed, &returned);
+    if (needed <= 0)
+    {
+        log_error("Failed to get print processor data types");
+        rc = -EINVAL;
+        goto exit;
+    }
+
+    pInfo = (DATATYPES_INFO_1 *)malloc(needed);
+    if (pInfo == NULL)
+    {
+        log_error("Failed to allocate memory");
+        rc = -ENOMEM;
+        goto exit;
+    }
+
+    if (!EnumPrintProcessorDatatypes(NULL, (LPSTR)printer->processor, 1, (LPBYTE)pInfo, needed, &needed, &returned))
+    {
+        log_error("Failed to get print processor data types");
+        rc = -EINVAL;
+        goto exit;
+    }
+
+    for (DWORD i = 0; i < returned && (int)i < max; i++)
+        copy_string(names[i], DATATYPE_NAME_LENGTH, pInfo[i].pName);
+
+    rc = (int)returned;
+
+exit:
+    if (pInfo != NULL)
+        free(pInfo);
+
+    return rc;
+}
+
+static int get_papers(const char *printer_name, struct printer_caps *caps)
+{
+    int rc = 0;
+    int count = 0;
+    short *sizes = NULL;
+    POINT *dimensions = NULL;
+    char *page_names = NULL;
+
+    count = DeviceCapabilities(printer_name, NULL, DC_PAPERS, NULL, NULL);
+    if (count <= 0)
+    {
+        log_error("Failed to get page sizes");
+        rc = -EINVAL;
+        goto exit;
+    }
+
+    sizes = (short *)malloc(count * sizeof(short));
+    if (sizes == NULL)
+    {
+        log_error("Failed to allocate memory");
+        rc = -ENOMEM;
+        goto exit;
+    }
+
+    if (DeviceCapabilities(printer_name, NULL, DC_PAPERS, (char *)sizes, NULL) <= 0)
+    {
+        log_error("Failed to get page sizes");
+        rc = -EINVAL;
+        goto exit;
+    }
+
+    dimensions = (POINT *)malloc(count * sizeof(POINT));
+    if (dimensions == NULL)
+    {
+        log_error("Failed to allocate memory");
+        rc = -ENOMEM;
+        goto exit;
+    }
+
+    if (DeviceCapabilities(printer_name, NULL, DC_PAPERSIZE, (char *)dimensions, NULL) <= 0)
+    {
+        log_error("Failed to get page dimensions");
+        rc = -EINVAL;
+        goto exit;
+    }
+
+    page_names = (char *)malloc(count * PAPER_NAME_LENGTH);
+    if (page_names == NULL)
+    {
+        log_error("Failed to allocate memory");
+        rc = -ENOMEM;
+        goto exit;
+    }
+
+    if (DeviceCapabilities(printer_name, NULL, DC_PAPERNAMES, page_names, NULL) <= 0)
+    {
+        log_error("Failed to get page names");
+        rc = -EINVAL;
+        goto exit;
+    }
+
+    caps->papers = (struct paper_info *)calloc(count, sizeof(*caps->papers));
+    if (caps->papers == NULL)
+    {
+        log_error("Failed to allocate memory");
+        rc = -ENOMEM;
+        goto exit;
+    }
+
+    for (int i = 0; i < count; i++)
+    {
+        struct paper_info *paper = &caps->papers[i];
+
+        paper->size = sizes[i];
+        paper->width = dimensions[i].x;
+        paper->height = dimensions[i].y;
+
+        /* Names are fixed 64 character fields and needn't be terminated. */
+        memcpy(paper->name, page_names + (i * PAPER_NAME_LENGTH), PAPER_NAME_LENGTH);
+        paper->name[PAPER_NAME_LENGTH - 1] = '\0';
+    }
+
+    caps->paper_count = count;
+
+exit:
+    if (sizes != NULL)
+        free(sizes);
+
+    if (dimensions != NULL)
+        free(dimensions);
+
+    if (page_names != NULL)
+        free(page_names);
+
+    return rc;
+}
+
+static int win32_get_capabilities(const char *printer_name, struct printer_caps *caps)
+{
+    int rc = 0;
+    HDC printer = NULL;
+
+    memset(caps, 0, sizeof(*caps));
+
+    rc = get_papers(printer_name, caps);
+    if (rc < 0)
+        goto exit;
+
+    caps->colour = DeviceCapabilities(printer_name, NULL, DC_COLORDEVICE, NULL, NULL) == 1;
+
+    printer = CreateDC("WINSPOOL", printer_name, NULL, NULL);
+    if (printer == NULL)
+    {
+        log_error("Failed to create printer");
+        rc = -EINVAL;
+        goto exit;
+    }
+
+    caps->dpi_x = GetDeviceCaps(printer, LOGPIXELSX);
+    caps->dpi_y = GetDeviceCaps(printer, LOGPIXELSY);
+
+exit:
+    if (printer != NULL)
+        DeleteDC(printer);
+
+    if (rc < 0)
+        printer_caps_free(caps);
+
+    return rc;
+}
+
+static int win32_get_driver_version(const char *printer_name, char *version, size_t size)
+{
+    int rc = 0;
+    HANDLE printer = NULL;
+    DWORD needed = 0;
+    DRIVER_INFO_6 *info = NULL;
+
+    if (OpenPrinter((char *)printer_name, &printer, NULL) == 0)
+    {
+        log_error("Failed to open printer");
+        rc = -EINVAL;
+        goto exit;
+    }
+
+    GetPrinterDriver(printer, NULL, 6, NULL, 0, &needed);
+    if (needed <= 0)
+    {
+        log_error("Failed to get printer driver");
+        rc = -EINVAL;
+        goto exit;
+    }
+
+    info = (DRIVER_INFO_6 *)malloc(needed);
+    if (info == NULL)
+    {
+        log_error("Failed to allocate memory");
+        rc = -ENOMEM;
+        goto exit;
+    }
+
+    if (!GetPrinterDriver(printer, NULL, 6, (LPBYTE)info, needed, &needed))
+    {
+        log_error("Failed to get printer driver");
+        rc = -EINVAL;
+        goto exit;
+    }
+
+    /* The version number alone isn't enough - plenty of drivers never bump
+     * it - so include the date and the driver itself. */
+    snprintf(
+        version,
+        size,
+        "%s %u.%u.%u.%u %08lx%08lx",
+        info->pName != NULL ? info->pName : "",
+        (unsigned)((info->dwlDriverVersion >> 48) & 0xFFFF),
+        (unsigned)((info->dwlDriverVersion >> 32) & 0xFFFF),
+        (unsigned)((info->dwlDriverVersion >> 16) & 0xFFFF),
+        (unsigned)(info->dwlDriverVersion & 0xFFFF),
+        (unsigned long)info->ftDriverDate.dwHighDateTime,
+        (unsigned long)info->ftDriverDate.dwLowDateTime);
+
+exit:
+    if (info != NULL)
+        free(info);
+
+    if (printer != NULL)
+        ClosePrinter(printer);
+
+    return rc;
+}
+
+static int get_page_details(
+    const char *printer_name,
+    const char *page_name,
+    struct paper_info *details)
+{
+    int rc = 0;
+    struct printer_caps caps = {0};
+    const struct paper_info *paper = NULL;
+
+    rc = get_papers(printer_name, &caps);
+    if (rc < 0)
+        goto exit;
+
+    paper = printer_caps_find_paper(&caps, page_name);
+    if (paper == NULL)
+    {
+        log_error("Printer has no \"%s\" paper", page_name);
+        rc = -ENOENT;
+        goto exit;
+    }
+
+    *details = *paper;
+
+exit:
+    printer_caps_free(&caps);
+
+    return rc;
+}
+
+static int set_page_size(
+    const char *printer_name,
+    const struct paper_info *details,
+    DEVMODE **devmode)
+{
+    int rc = 0;
+    HANDLE printer = NULL;
+    int devmode_size = 0;
+
+    *devmode = NULL;
+
+    log_info(
+        "Setting page size on \"%s\" to: \"%s\"",
+        printer_name,
+        details->name);
+
+    if (OpenPrinter((char *)printer_name, &printer, NULL) == 0)
+    {
+        log_error("Failed to open printer");
+        rc = -EINVAL;
+        goto exit;
+    }
+
+    devmode_size = DocumentProperties(
+        NULL, printer, (char *)printer_name, NULL, NULL, 0);
+
+    if (devmode_size <= 0)
+    {
+        log_error("Failed to get printer properties size");
+        rc = -EINVAL;
+        goto exit;
+    }
+
+    *devmode = (DEVMODE *)malloc(devmode_size);
+    if (*devmode == NULL)
+    {
+        log_error("Failed to allocate %u octets", devmode_size);
+        rc = -ENOMEM;
+        goto exit;
+    }
+
+    if (DocumentProperties(
+            NULL,
+            printer,
+            (char *)printer_name,
+            *devmode,
+            NULL,
+            DM_OUT_BUFFER) != IDOK)
+    {
+        log_error("Failed to get printer properties");
+        rc = -EINVAL;
+        goto exit;
+    }
+
+    (*devmode)->dmPaperSize = details->size;
+    (*devmode)->dmOrientation = DMORIENT_PORTRAIT;
+
+    if (DocumentProperties(
+            NULL,
+            printer,
+            (char *)printer_name,
+            *devmode,
+            *devmode,
+            DM_IN_BUFFER | DM_OUT_BUFFER) != IDOK)
+    {
+        log_error("Failed to set printer properties");
+        rc = -EINVAL;
+        goto exit;
+    }
+
+    if (ClosePrinter(printer) == 0)
+    {
+        log_error("Failed to close printer");
+        rc = -EINVAL;
+        printer = NULL;
+        goto exit;
+    }
+
+    return 0;
+
+exit:
+    if (printer != NULL)
+        ClosePrinter(printer);
+
+    if (*devmode != NULL)
+    {
+        free(*devmode);
+        *devmode = NULL;
+    }
+
+    return rc;
+}
+
+static int gdi_draw_rect(HDC dc, const struct rect *r)
+{
+    if (Rectangle(dc, r->left, r->top, r->right, r->bottom) == 0)
+        return -EINVAL;
+
+    return 0;
+}
+
+static int gdi_fill_rect(HDC dc, const struct rect *r)
+{
+    int rc = 0;
+    HGDIOBJ brush = SelectObject(dc, GetStockObject(BLACK_BRUSH));
+
+    if (Rectangle(dc, r->left, r->top, r->right, r->bottom) == 0)
+        rc = -EINVAL;
+
+    SelectObject(dc, brush);
+
+    return rc;
+}
+
+static int gdi_draw_line(HDC dc, int x0, int y0, int x1, int y1)
+{
+    if (MoveToEx(dc, x0, y0, NULL) == 0 || LineTo(dc, x1, y1) == 0)
+        return -EINVAL;
+
+    return 0;
+}
+
+static int gdi_fill_polygon(HDC dc, const struct point *points, int count)
+{
+    int rc = 0;
+    POINT *gdi_points = NULL;
+    HGDIOBJ brush = NULL;
+
+    gdi_points = (POINT *)malloc((size_t)count * sizeof(*gdi_points));
+    if (gdi_points == NULL)
+    {
+        log_error("Failed to allocate memory");
+        return -ENOMEM;
+    }
+
+    for (int i = 0; i < count; i++)
+    {
+        gdi_points[i].x = points[i].x;
+        gdi_points[i].y = points[i].y;
+    }
+
+    /* ALTERNATE, the default fill mode, is even-odd. */
+    brush = SelectObject(dc, GetStockObject(BLACK_BRUSH));
+
+    if (Polygon(dc, gdi_points, count) == 0)
+        rc = -EINVAL;
+
+    SelectObject(dc, brush);
+    free(gdi_points);
+
+    return rc;
+}
+
+static int gdi_draw_text(HDC dc, int x, int y, int height, const char *text)
+{
+    int rc = 0;
+    HFONT font = NULL;
+    HGDIOBJ previous = NULL;
+
+    /* A negative height asks for the character height rather than the
+     * cell height, which is what callers mean by text size. */
+    font = CreateFont(
+        -height, 0, 0, 0, FW_NORMAL, FALSE, FALSE, FALSE,
+        DEFAULT_CHARSET, OUT_DEFAULT_PRECIS, CLIP_DEFAULT_PRECIS,
+        DEFAULT_QUALITY, DEFAULT_PITCH | FF_DONTCARE, "Arial");
+    if (font == NULL)
+    {
+        log_error("Failed to create font");
+        return -EINVAL;
+    }
+
+    previous = SelectObject(dc, font);
+    SetBkMode(dc, TRANSPARENT);
+
+    if (TextOut(dc, x, y, text, (int)strlen(text)) == 0)
+        rc = -EINVAL;
+
+    SelectObject(dc, previous);
+    DeleteObject(font);
+
+    return rc;
+}
+
+static int gdi_draw_bitmap(HDC dc, const struct rect *r, const struct bitmap *bitmap)
+{
+    struct
+    {
+        BITMAPINFOHEADER header;
+        RGBQUAD colours[2];
+    } info = {0};
+
+    info.header.biSize = sizeof(info.header);
+    info.header.biWidth = bitmap->width;
+    /* Negative for a top-down bitmap. */
+    info.header.biHeight = -bitmap->height;
+    info.header.biPlanes = 1;
+    info.header.biBitCount = 1;
+    info.header.biCompression = BI_RGB;
+
+    /* A clear bit is white and a set bit black. */
+    info.colours[0].rgbRed = 0xff;
+    info.colours[0].rgbGreen = 0xff;
+    info.colours[0].rgbBlue = 0xff;
+
+    if (StretchDIBits(
+            dc,
+            r->left,
+            r->top,
+            r->right - r->left,
+            r->bottom - r->top,
+            0,
+            0,
+            bitmap->width,
+            bitmap->height,
+            bitmap->bits,
+            (const BITMAPINFO *)&info,
+            DIB_RGB_COLORS,
+            SRCCOPY) == 0)
+    {
+        log_error("Failed to draw bitmap");
+        return -EINVAL;
+    }
+
+    return 0;
+}
+
+static int gdi_draw_command(HDC dc, const struct display_list *page, const struct display_command *command)
+{
+    struct bitmap bitmap;
+
+    switch (command->op)
+    {
+    case DISPLAY_RECT:
+        return gdi_draw_rect(dc, &command->rect);
+
+    case DISPLAY_FILL:
+        return gdi_fill_rect(dc, &command->rect);
+
+    case DISPLAY_LINE:
+        return gdi_draw_line(dc, command->line.x0, command->line.y0, command->line.x1, command->line.y1);
+
+    case DISPLAY_TEXT:
+        return gdi_draw_text(
+            dc,
+            command->text.x,
+            command->text.y,
+            command->text.height,
+            display_command_text(page, command));
+
+    case DISPLAY_BITMAP:
+        display_command_bitmap(page, command, &bitmap);
+        return gdi_draw_bitmap(dc, &command->bitmap.rect, &bitmap);
+
+    case DISPLAY_POLYGON:
+        return gdi_fill_polygon(dc, display_command_points(page, command), command->polygon.count);
+    }
+
+    return -EINVAL;
+}
+
+/* Draws a recorded page in logical units, mapped onto the printer's device
+ * pixels. */
+static int play_page(HDC printer, const struct display_list *page, const struct coordinate_space *space)
+{
+    int rc = 0;
+
+    if (SaveDC(printer) == 0)
+    {
+        log_error("Failed to save DC");
+        return -EINVAL;
+    }
+
+    if (SetMapMode(printer, MM_ISOTROPIC) == 0)
+    {
+        log_error("Failed to set map mode");
+        rc = -EINVAL;
+        goto exit;
+    }
+
+    if (SetWindowExtEx(
+            printer, space->logical.width, space->logical.height, NULL) == 0)
+    {
+        log_error("Failed to set window extents");
+        rc = -EINVAL;
+        goto exit;
+    }
+
+    if (SetViewportExtEx(
+            printer, space->device.width, space->device.height, NULL) == 0)
+    {
+        log_error("Failed to set viewport extents");
+        rc = -EINVAL;
+        goto exit;
+    }
+
+    for (size_t i = 0; i < page->count; i++)
+    {
+        rc = gdi_draw_command(printer, page, &page->commands[i]);
+        if (rc < 0)
+        {
+            log_error("Failed to draw command %lu", (unsigned long)i);
+            goto exit;
+        }
+    }
+
+exit:
+    if (RestoreDC(printer, -1) == 0 && rc == 0)
+    {
+        log_error("Failed to restore DC");
+        rc = -EINVAL;
+    }
+
+    return rc;
+}
+
+/* Rastered bands go out in device pixels, with the DC's default mapping. */
+static int draw_band(const struct raster_band *band, void *context)
+{
+    HDC printer = (HDC)context;
+    struct rect r = {
+        .left = 0,
+        .top = band->y,
+        .right = band->bitmap->width,
+        .bottom = band->y + band->bitmap->height,
+    };
+
+    return gdi_draw_bitmap(printer, &r, band->bitmap);
+}
+
+static int win32_open_session(
+    const char *printer_name,
+    const struct session_options *options,
+    struct print_session **result)
+{
+    int rc = 0;
+    struct win32_session *session = NULL;
+    struct print_session *base = NULL;
+    struct trace_span span;
+
+    *result = NULL;
+
+    session = (struct win32_session *)calloc(1, sizeof(*session));
+    if (session == NULL)
+    {
+        log_error("Failed to allocate memory");
+        rc = -ENOMEM;
+        goto error;
+    }
+
+    base = &session->display.base;
+
+    base->backend = &win32_backend;
+    base->raster = options->raster;
+    session->renderer.band_bytes = options->band_bytes;
+    session->renderer.threads = options->raster_threads;
+
+    /* Configure the printer - for now all we're doing is setting the
+     * page size. We have to do this first, because we then ask the printer
+     * to tell us, based on this page size, how many pixels it has in X
+     * and Y. */
+    if (options->paper != NULL)
+    {
+        base->paper = *options->paper;
+    }
+    else
+    {
+        rc = get_page_details(printer_name, options->paper_name, &base->paper);
+        if (rc < 0)
+        {
+            log_error("Failed to get page details");
+            goto error;
+        }
+    }
+
+    span = trace_begin("DocumentProperties");
+    rc = set_page_size(printer_name, &base->paper, &session->devmode);
+    trace_end(&span);
+    if (rc < 0)
+    {
+        log_error("Failed to set page size");
+        goto error;
+    }
+
+    span = trace_begin("CreateDC");
+    session->printer = CreateDC("WINSPOOL", printer_name, NULL, session->devmode);
+    trace_end(&span);
+    if (session->printer == NULL)
+    {
+        log_error("Failed to create printer");
+        rc = -EINVAL;
+        goto error;
+    }
+
+    /* The printer coordinate space uses pixels, at some DPI. Our display
+     * list represents an entire page - but we also need to account for the
+     * actual printable area. We handle this by capturing the offsets. */
+    base->space.device.width = GetDeviceCaps(session->printer, PHYSICALWIDTH);
+    base->space.device.height = GetDeviceCaps(session->printer, PHYSICALHEIGHT);
+    base->space.device.offset_x = GetDeviceCaps(session->printer, PHYSICALOFFSETX);
+    base->space.device.offset_y = GetDeviceCaps(session->printer, PHYSICALOFFSETY);
+
+    base->dpi_x = GetDeviceCaps(session->printer, LOGPIXELSX);
+    base->dpi_y = GetDeviceCaps(session->printer, LOGPIXELSY);
+    base->printable_width = GetDeviceCaps(session->printer, HORZRES);
+    base->printable_height = GetDeviceCaps(session->printer, VERTRES);
+
+    coordinate_space_from_device(&base->space, &base->paper);
+
+    *result = base;
+
+    return 0;
+
+error:
+    if (session != NULL)
+    {
+        if (session->printer != NULL)
+            DeleteDC(session->printer);
+
+        if (session->devmode != NULL)
+            free(session->devmode);
+
+        free(session);
+    }
+
+    return rc;
+}
+
+static int win32_start_document(struct print_session *base, const char *document_name)
+{
+    struct win32_session *session = (struct win32_session *)base;
+    DOCINFOA doc_info = {0};
+    struct trace_span span;
+    int rc = 0;
+
+    if (base->in_document)
+    {
+        log_error("Document already started");
+        return -EINVAL;
+    }
+
+    doc_info.cbSize = sizeof(doc_info);
+    doc_info.lpszDocName = document_name;
+
+    span = trace_begin("StartDoc");
+    rc = StartDoc(session->printer, &doc_info);
+    trace_end(&span);
+
+    if (rc <= 0)
+    {
+        log_error("Failed to start document");
+        return -EINVAL;
+    }
+
+    base->in_document = 1;
+    base->page_count = 0;
+
+    return 0;
+}
+
+static int win32_end_document(struct print_session *base, int abort)
+{
+    struct win32_session *session = (struct win32_session *)base;
+    struct trace_span span;
+    int rc = 0;
+
+    if (!base->in_document)
+    {
+        log_error("No document started");
+        return -EINVAL;
+    }
+
+    base->in_document = 0;
+    session->display.in_page = 0;
+
+    if (abort)
+    {
+        AbortDoc(session->printer);
+        return 0;
+    }
+
+    span = trace_begin("EndDoc");
+    rc = EndDoc(session->printer);
+    trace_end(&span);
+
+    if (rc <= 0)
+    {
+        log_error("Failed to end document");
+        return -EINVAL;
+    }
+
+    base->document_count++;
+
+    return 0;
+}
+
+static int win32_start_page(struct print_session *base)
+{
+    struct win32_session *session = (struct win32_session *)base;
+    int rc = display_session_start_page(&session->display);
+
+    if (rc < 0)
+        return rc;
+
+    if (StartPage(session->printer) <= 0)
+    {
+        log_error("Failed to start page");
+        session->display.in_page = 0;
+        return -EINVAL;
+    }
+
+    return 0;
+}
+
+static int win32_end_page(struct print_session *base)
+{
+    int rc = 0;
+    struct win32_session *session = (struct win32_session *)base;
+    struct trace_span span;
+
+    if (!session->display.in_page)
+    {
+        log_error("No page started");
+        return -EINVAL;
+    }
+
+    session->display.in_page = 0;
+
+    if (base->raster)
+        rc = raster_render_page(
+            &session->renderer,
+            &session->display.page,
+            &base->space,
+            draw_band,
+            session->printer,
+            &base->raster_stats);
+    else
+    {
+        span = trace_begin("playback");
+        rc = play_page(session->printer, &session->display.page, &base->space);
+        trace_end(&span);
+    }
+
+    if (rc < 0)
+    {
+        log_error("Failed to draw page");
+        return rc;
+    }
+
+    span = trace_begin("EndPage");
+    rc = EndPage(session->printer);
+    trace_end(&span);
+
+    if (rc <= 0)
+    {
+        log_error("Failed to end page");
+        return -EINVAL;
+    }
+
+    base->page_count++;
+
+    return 0;
+}
+
+static void win32_close_session(struct print_session *base)
+{
+    struct win32_session *session = (struct win32_session *)base;
+
+    if (base->in_document)
+        win32_end_document(base, 1);
+
+    display_session_release(&session->display);
+    raster_renderer_free(&session->renderer);
+
+    DeleteDC(session->printer);
+    free(session->devmode);
+    free(session);
+}
+
+const struct print_backend win32_backend = {
+    .name = "win32",
+    .enum_printers = win32_enum_printers,
+    .get_datatypes = win32_get_datatypes,
+    .get_capabilities = win32_get_capabilities,
+    .get_driver_version = win32_get_driver_version,
+    .open_session = win32_open_session,
+    .start_document = win32_start_document,
+    .end_document = win32_end_document,
+    .start_page = win32_start_page,
+    .end_page = win32_end_page,
+    .draw_rect = display_session_draw_rect,
+    .fill_rect = display_session_fill_rect,
+    .draw_line = display_session_draw_line,
+    .draw_text = display_session_draw_text,
+    .fill_polygon = display_session_fill_polygon,
+    .draw_bitmap = display_session_draw_bitmap,
+    .begin_template = display_session_begin_template,
+    .end_template = display_session_end_template,
+    .draw_template = display_session_draw_template,
+    .serialise_template = page_template_serialise,
+    .deserialise_template = page_template_deserialise,
+    .free_template = page_template_free,
+    .close_session = win32_close_session,
+};
@@ -0,0 +1,1025 @@
+#ifdef _WIN32
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#include <windows.h>
+#include <winspool.h>
+#else
+#include <netdb.h>
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <unistd.h>
+#endif
+
+#include <errno.h>
+#include <limits.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "count_of.h"
+#include "display_list.h"
+#include "log.h"
+#include "print_backend.h"
+#include "raster.h"
+
+/* Drives label printers in their own language instead of through a
+ * driver. Each page is recorded as a display list like the other
+ * backends, then turned into ZPL when it ends: boxes and lines become
+ * ^GB/^GD, text a scalable font and symbols ^GF graphics in ZPL's
+ * compressed hex, which the printer expands itself. A page of labels is
+ * a few KB where a rastered page is hundreds.
+ *
+ * Each document is collected in memory and sent as one job when it ends.
+ * Printer names pick where it goes:
+ *
+ *     file:<path>             appended to a file, for testing
+ *     tcp:<host>[:<port>]     the printer's raw port, 9100 by default
+ *     anything else           a spooler queue, as the RAW datatype
+ *                             (Windows only)
+ *
+ * File and TCP printers have no driver to ask, so they take the label
+ * papers below at $PRINT_RAW_DPI (default 203). */
+
+#ifdef _WIN32
+typedef SOCKET raw_socket;
+#else
+typedef int raw_socket;
+#define INVALID_SOCKET (-1)
+#define closesocket close
+#endif
+
+#ifndef MSG_NOSIGNAL
+#define MSG_NOSIGNAL 0
+#endif
+
+#define DEFAULT_DPI 203
+#define DEFAULT_PORT "9100"
+
+enum raw_sink
+{
+    RAW_SINK_FILE,
+    RAW_SINK_SOCKET,
+    RAW_SINK_SPOOLER,
+};
+
+static const struct paper_info raw_papers[] = {
+    {.size = 256, .width = 1016, .height = 1524, .name = "4x6in"},
+    {.size = 257, .width = 1000, .height = 1500, .name = "100x150mm"},
+    {.size = 258, .width = 620, .height = 290, .name = "62x29mm"},
+};
+
+static const char *const raw_datatypes[] = {"RAW"};
+
+/* A growing buffer of printer commands. */
+struct raw_buffer
+{
+    char *data;
+    size_t size;
+    size_t capacity;
+};
+
+struct zpl_session
+{
+    struct display_session display;
+
+    enum raw_sink sink;
+    char target[PRINTER_NAME_LENGTH];
+    char document_name[PRINTER_NAME_LENGTH];
+    FILE *file;
+#ifdef _WIN32
+    HANDLE spooler;
+#endif
+
+    /* The document so far. */
+    struct raw_buffer job;
+
+    /* For drawing ZPL can't express, rastered on its own. */
+    struct display_list scratch;
+    struct bitmap region;
+
+    struct raster_renderer renderer;
+};
+
+static int buffer_reserve(struct raw_buffer *buffer, size_t extra)
+{
+    size_t capacity = buffer->capacity > 0 ? buffer->capacity : 4096;
+    char *data = NULL;
+
+    if (buffer->size + extra <= buffer->capacity)
+        return 0;
+
+    while (capacity < buffer->size + extra)
+        capacity *= 2;
+
+    data = (char *)realloc(buffer->data, capacity);
+    if (data == NULL)
+    {
+        log_error("Failed to allocate memory");
+        return -ENOMEM;
+    }
+
+    buffer->data = data;
+    buffer->capacity = capacity;
+
+    return 0;
+}
+
+static int buffer_append(struct raw_buffer *buffer, const char *data, size_t size)
+{
+    int rc = buffer_reserve(buffer, size);
+
+    if (rc < 0)
+        return rc;
+
+    memcpy(buffer->data + buffer->size, data, size);
+    buffer->size += size;
+
+    return 0;
+}
+
+static int buffer_printf(struct raw_buffer *buffer, const char *format, ...)
+{
+    char text[256];
+    va_list args;
+    int length;
+
+    va_start(args, format);
+    length = vsnprintf(text, sizeof(text), format, args);
+    va_end(args);
+
+    if (length < 0 || length >= (int)sizeof(text))
+        return -EINVAL;
+
+    return buffer_append(buffer, text, (size_t)length);
+}
+
+static int is_sink(const char *printer_name)
+{
+    return strncmp(printer_name, "file:", 5) == 0 || strncmp(printer_name, "tcp:", 4) == 0;
+}
+
+static int raw_dpi(void)
+{
+    const char *dpi = getenv("PRINT_RAW_DPI");
+
+    return dpi != NULL && atoi(dpi) > 0 ? atoi(dpi) : DEFAULT_DPI;
+}
+
+static int zpl_enum_printers(struct printer_info **printers, int *count)
+{
+#ifdef _WIN32
+    /* Any queue can take RAW jobs. */
+    return win32_backend.enum_printers(printers, count);
+#else
+    *count = 0;
+
+    /* File and TCP printers are named, not found. */
+    *printers = (struct printer_info *)calloc(1, sizeof(**printers));
+    if (*printers == NULL)
+    {
+        log_error("Failed to allocate memory");
+        return -ENOMEM;
+    }
+
+    return 0;
+#endif
+}
+
+static int zpl_get_datatypes(
+    const struct printer_info *printer,
+    char (*names)[DATATYPE_NAME_LENGTH],
+    int max)
+{
+    (void)printer;
+
+    for (int i = 0; i < COUNT_OF(raw_datatypes) && i < max; i++)
+        snprintf(names[i], DATATYPE_NAME_LENGTH, "%s", raw_datatypes[i]);
+
+    return COUNT_OF(raw_datatypes);
+}
+
+static int zpl_get_capabilities(const char *printer_name, struct printer_caps *caps)
+{
+    memset(caps, 0, sizeof(*caps));
+
+    if (!is_sink(printer_name))
+    {
+#ifdef _WIN32
+        return win32_backend.get_capabilities(printer_name, caps);
+#else
+        log_error("Raw printers are file:<path> or tcp:<host>[:<port>]");
+        return -ENOENT;
+#endif
+    }
+
+    caps->papers = (struct paper_info *)malloc(sizeof(raw_papers));
+    if (caps->papers == NULL)
+    {
+        log_error("Failed to allocate memory");
+        return -ENOMEM;
+    }
+
+    memcpy(caps->papers, raw_papers, sizeof(raw_papers));
+    caps->paper_count = COUNT_OF(raw_papers);
+    caps->dpi_x = raw_dpi();
+    caps->dpi_y = caps->dpi_x;
+
+    return 0;
+}
+
+static int zpl_get_driver_version(const char *printer_name, char *version, size_t size)
+{
+    if (!is_sink(printer_name))
+    {
+#ifdef _WIN32
+        return win32_backend.get_driver_version(printer_name, version, size);
+#else
+        log_error("Raw printers are file:<path> or tcp:<host>[:<port>]");
+        return -ENOENT;
+#endif
+    }
+
+    snprintf(version, size, "ZPL %d", raw_dpi());
+
+    return 0;
+}
+
+static int zpl_open_session(
+    const char *printer_name,
+    const struct session_options *options,
+    struct print_session **result)
+{
+    int rc = 0;
+    struct printer_caps caps = {0};
+    const struct paper_info *paper = NULL;
+    struct zpl_session *session = NULL;
+    struct print_session *base = NULL;
+
+    *result = NULL;
+
+    rc = zpl_get_capabilities(printer_name, &caps);
+    if (rc < 0)
+        return rc;
+
+    paper = options->paper != NULL ? options->paper : printer_caps_find_paper(&caps, options->paper_name);
+    if (paper == NULL)
+    {
+        log_error("Printer has no \"%s\" paper", options->paper_name);
+        rc = -ENOENT;
+        goto error;
+    }
+
+    session = (struct zpl_session *)calloc(1, sizeof(*session));
+    if (session == NULL)
+    {
+        log_error("Failed to allocate memory");
+        rc = -ENOMEM;
+        goto error;
+    }
+
+    base = &session->display.base;
+
+    base->backend = &zpl_backend;
+    base->raster = options->raster;
+    base->paper = *paper;
+    base->dpi_x = caps.dpi_x;
+    base->dpi_y = caps.dpi_y;
+    session->renderer.band_bytes = options->band_bytes;
+    session->renderer.threads = options->raster_threads;
+
+    /* The printer is told the label size, so the whole label is
+     * printable. */
+    base->space.device.width = mm_10_to_px(paper->width, caps.dpi_x);
+    base->space.device.height = mm_10_to_px(paper->height, caps.dpi_y);
+    base->printable_width = base->space.device.width;
+    base->printable_height = base->space.device.height;
+
+    coordinate_space_from_device(&base->space, paper);
+
+    if (strncmp(printer_name, "file:", 5) == 0)
+    {
+        session->sink = RAW_SINK_FILE;
+        snprintf(session->target, sizeof(session->target), "%s", printer_name + 5);
+
+        session->file = fopen(session->target, "ab");
+        if (session->file == NULL)
+        {
+            log_error("Failed to open \"%s\"", session->target);
+            rc = -EIO;
+            goto error;
+        }
+    }
+    else if (strncmp(printer_name, "tcp:", 4) == 0)
+    {
+        session->sink = RAW_SINK_SOCKET;
+        snprintf(session->target, sizeof(session->target), "%s", printer_name + 4);
+
+#ifdef _WIN32
+        WSADATA wsa;
+
+        if (WSAStartup(MAKEWORD(2, 2), &wsa) != 0)
+        {
+            log_error("Failed to start Winsock");
+            rc = -EIO;
+            goto error;
+        }
+#endif
+    }
+    else
+    {
+#ifdef _WIN32
+        session->sink = RAW_SINK_SPOOLER;
+        snprintf(session->target, sizeof(session->target), "%s", printer_name);
+
+        if (!OpenPrinter((LPSTR)session->target, &session->spooler, NULL))
+        {
+            log_error("Failed to open printer");
+            rc = -EINVAL;
+            goto error;
+        }
+#endif
+    }
+
+    printer_caps_free(&caps);
+
+    *result = base;
+
+    return 0;
+
+error:
+    if (session != NULL)
+    {
+        if (session->file != NULL)
+            fclose(session->file);
+
+        free(session);
+    }
+
+    printer_caps_free(&caps);
+
+    return rc;
+}
+
+static int zpl_start_document(struct print_session *base, const char *document_name)
+{
+    struct zpl_session *session = (struct zpl_session *)base;
+
+    if (base->in_document)
+    {
+        log_error("Document already started");
+        return -EINVAL;
+    }
+
+    snprintf(
+        session->document_name,
+        sizeof(session->document_name),
+        "%s",
+        document_name != NULL ? document_name : "");
+
+    session->job.size = 0;
+    base->in_document = 1;
+    base->page_count = 0;
+
+    return 0;
+}
+
+static int send_file(struct zpl_session *session)
+{
+    if (fwrite(session->job.data, 1, session->job.size, session->file) != session->job.size ||
+        fflush(session->file) != 0)
+    {
+        log_error("Failed to write \"%s\"", session->target);
+        return -EIO;
+    }
+
+    return 0;
+}
+
+static int send_socket(struct zpl_session *session)
+{
+    int rc = 0;
+    char host[PRINTER_NAME_LENGTH];
+    const char *port = DEFAULT_PORT;
+    char *colon = NULL;
+    struct addrinfo hints = {0};
+    struct addrinfo *addresses = NULL;
+    raw_socket s = INVALID_SOCKET;
+    size_t sent = 0;
+
+    snprintf(host, sizeof(host), "%s", session->target);
+
+    colon = strrchr(host, ':');
+    if (colon != NULL)
+    {
+        *colon = '\0';
+        port = colon + 1;
+    }
+
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+
+    if (getaddrinfo(host, port, &hints, &addresses) != 0)
+    {
+        log_error("Failed to look up \"%s\"", host);
+        return -ENOENT;
+    }
+
+    for (struct addrinfo *a = addresses; a != NULL && s == INVALID_SOCKET; a = a->ai_next)
+    {
+        s = socket(a->ai_family, a->ai_socktype, a->ai_protocol);
+        if (s == INVALID_SOCKET)
+            continue;
+
+        if (connect(s, a->ai_addr, (int)a->ai_addrlen) != 0)
+        {
+            closesocket(s);
+            s = INVALID_SOCKET;
+        }
+    }
+
+    freeaddrinfo(addresses);
+
+    if (s == INVALID_SOCKET)
+    {
+        log_error("Failed to connect to \"%s\"", session->target);
+        return -EIO;
+    }
+
+    while (sent < session->job.size)
+    {
+        size_t rest = session->job.size - sent;
+        int n = (int)send(s, session->job.data + sent, rest > INT_MAX ? INT_MAX : (int)rest, MSG_NOSIGNAL);
+
+        if (n <= 0)
+        {
+            log_error("Failed to send to \"%s\"", session->target);
+            rc = -EIO;
+            break;
+        }
+
+        sent += (size_t)n;
+    }
+
+    closesocket(s);
+
+    return rc;
+}
+
+#ifdef _WIN32
+static int send_spooler(struct zpl_session *session)
+{
+    int rc = 0;
+    DOC_INFO_1 doc_info = {0};
+    DWORD written = 0;
+
+    doc_info.pDocName = session->document_name;
+    doc_info.pOutputFile = NULL;
+    doc_info.pDatatype = (LPSTR)"RAW";
+
+    if (StartDocPrinter(session->spooler, 1, (LPBYTE)&doc_info) == 0)
+    {
+        log_error("Failed to start document");
+        return -EINVAL;
+    }
+
+    if (!StartPagePrinter(session->spooler))
+    {
+        log_error("Failed to start page");
+        rc = -EINVAL;
+        goto exit;
+    }
+
+    if (!WritePrinter(session->spooler, session->job.data, (DWORD)session->job.size, &written) ||
+        written != (DWORD)session->job.size)
+    {
+        log_error("Failed to write to printer");
+        rc = -EIO;
+    }
+
+    EndPagePrinter(session->spooler);
+
+exit:
+    if (!EndDocPrinter(session->spooler) && rc == 0)
+    {
+        log_error("Failed to end document");
+        rc = -EINVAL;
+    }
+
+    return rc;
+}
+#endif
+
+static int zpl_end_document(struct print_session *base, int abort)
+{
+    int rc = 0;
+    struct zpl_session *session = (struct zpl_session *)base;
+
+    if (!base->in_document)
+    {
+        log_error("No document started");
+        return -EINVAL;
+    }
+
+    base->in_document = 0;
+    session->display.in_page = 0;
+
+    if (abort || session->job.size == 0)
+        goto exit;
+
+    switch (session->sink)
+    {
+    case RAW_SINK_FILE:
+        rc = send_file(session);
+        break;
+
+    case RAW_SINK_SOCKET:
+        rc = send_socket(session);
+        break;
+
+    case RAW_SINK_SPOOLER:
+#ifdef _WIN32
+        rc = send_spooler(session);
+#else
+        rc = -EINVAL;
+#endif
+        break;
+    }
+
+    if (rc == 0)
+        base->document_count++;
+
+exit:
+    session->job.size = 0;
+
+    return rc;
+}
+
+static int zpl_start_page(struct print_session *base)
+{
+    struct zpl_session *session = (struct zpl_session *)base;
+
+    return display_session_start_page(&session->display);
+}
+
+/* ZPL's counts for a run of n of the same hex digit: G to Y for 1 to 19,
+ * g to z for 20 to 400 in twenties. */
+static int append_run(struct raw_buffer *buffer, char digit, int n)
+{
+    char text[8];
+    int length = 0;
+
+    for (; n > 400; n -= 400)
+    {
+        text[0] = 'z';
+        text[1] = digit;
+
+        if (buffer_append(buffer, text, 2) < 0)
+            return -ENOMEM;
+    }
+
+    if (n >= 20)
+        text[length++] = (char)('g' + n / 20 - 1);
+
+    if (n % 20 > 1 || (n % 20 == 1 && n > 20))
+        text[length++] = (char)('G' + n % 20 - 1);
+
+    text[length++] = digit;
+
+    return buffer_append(buffer, text, (size_t)length);
+}
+
+/* Hex digit i of a row, high nibble first. */
+static char row_digit(const unsigned char *row, int i, int bytes, unsigned char mask)
+{
+    static const char hex[] = "0123456789ABCDEF";
+    unsigned char byte = i / 2 == bytes - 1 ? row[i / 2] & mask : row[i / 2];
+
+    return hex[i % 2 == 0 ? byte >> 4 : byte & 0xf];
+}
+
+/* One row of a ^GF graphic in ZPL's compressed hex. mask keeps the bits of
+ * the last byte that are in the graphic. */
+static int append_graphic_row(
+    struct raw_buffer *buffer,
+    const unsigned char *row,
+    const unsigned char *previous,
+    int bytes,
+    unsigned char mask)
+{
+    int rc = 0;
+    int end = bytes * 2;
+    int same = previous != NULL;
+
+    for (int i = 0; i < bytes && same; i++)
+        same = (row[i] & (i == bytes - 1 ? mask : 0xff)) == (previous[i] & (i == bytes - 1 ? mask : 0xff));
+
+    /* A colon repeats the row above. */
+    if (same)
+        return buffer_append(buffer, ":", 1);
+
+    /* A comma fills the rest of the row with zeros. */
+    while (end > 0 && row_digit(row, end - 1, bytes, mask) == '0')
+        end--;
+
+    for (int i = 0; i < end && rc == 0;)
+    {
+        char digit = row_digit(row, i, bytes, mask);
+        int n = 1;
+
+        while (i + n < end && row_digit(row, i + n, bytes, mask) == digit)
+            n++;
+
+        rc = append_run(buffer, digit, n);
+        i += n;
+    }
+
+    if (rc == 0 && end < bytes * 2)
+        rc = buffer_append(buffer, ",", 1);
+
+    return rc;
+}
+
+/* A 1bpp graphic whose top-left pixel is at x, y. width is in pixels,
+ * starting from the most significant bit of each row. */
+static int append_graphic(
+    struct raw_buffer *buffer,
+    int x,
+    int y,
+    const unsigned char *bits,
+    size_t stride,
+    int width,
+    int height)
+{
+    int rc = 0;
+    int bytes = (width + 7) / 8;
+    unsigned char mask = (unsigned char)(0xff << ((8 - width % 8) % 8));
+    size_t total = (size_t)bytes * (size_t)height;
+
+    if (width <= 0 || height <= 0)
+        return 0;
+
+    rc = buffer_printf(
+        buffer,
+        "^FO%d,%d^GFA,%lu,%lu,%d,",
+        x,
+        y,
+        (unsigned long)total,
+        (unsigned long)total,
+        bytes);
+
+    for (int row = 0; row < height && rc == 0; row++)
+    {
+        const unsigned char *bits_row = bits + (size_t)row * stride;
+
+        rc = append_graphic_row(buffer, bits_row, row > 0 ? bits_row - stride : NULL, bytes, mask);
+    }
+
+    if (rc == 0)
+        rc = buffer_append(buffer, "^FS\n", 4);
+
+    return rc;
+}
+
+static void device_rect(
+    const struct coordinate_space *space,
+    const struct rect *r,
+    int *x0,
+    int *y0,
+    int *x1,
+    int *y1)
+{
+    int left = coordinate_space_device_x(space, r->left);
+    int right = coordinate_space_device_x(space, r->right);
+    int top = coordinate_space_device_y(space, r->top);
+    int bottom = coordinate_space_device_y(space, r->bottom);
+
+    *x0 = left < right ? left : right;
+    *x1 = left < right ? right : left;
+    *y0 = top < bottom ? top : bottom;
+    *y1 = top < bottom ? bottom : top;
+}
+
+/* Rasters the one command in the session's scratch list over device rows
+ * [y0, y1) and columns [x0, x1) and sends it as a graphic. */
+static int append_rastered(struct zpl_session *session, int x0, int y0, int x1, int y1)
+{
+    int rc = 0;
+    const struct coordinate_space *space = &session->display.base.space;
+    int first_byte = 0;
+
+    x0 = x0 < 0 ? 0 : x0;
+    y0 = y0 < 0 ? 0 : y0;
+    x1 = x1 > space->device.width ? space->device.width : x1;
+    y1 = y1 > space->device.height ? space->device.height : y1;
+
+    if (x1 <= x0 || y1 <= y0)
+        return 0;
+
+    rc = bitmap_resize(&session->region, space->device.width, y1 - y0);
+    if (rc < 0)
+        return rc;
+
+    rc = raster_render_list(&session->scratch, space, y0, &session->region);
+    if (rc < 0)
+        return rc;
+
+    /* Whole bytes of the region, so the rows can be used where they are. */
+    first_byte = x0 / 8;
+
+    return append_graphic(
+        &session->job,
+        first_byte * 8,
+        y0,
+        session->region.bits + first_byte,
+        session->region.stride,
+        x1 - first_byte * 8,
+        y1 - y0);
+}
+
+static int append_bitmap(struct zpl_session *session, const struct rect *r, const struct bitmap *bitmap)
+{
+    int rc = 0;
+    int x0, y0, x1, y1;
+
+    device_rect(&session->display.base.space, r, &x0, &y0, &x1, &y1);
+
+    /* Symbols are rendered at the device resolution and go as they are.
+     * Anything else has to be stretched first. */
+    if (abs(x1 - x0 - bitmap->width) <= 1 &&
+        abs(y1 - y0 - bitmap->height) <= 1 &&
+        x0 >= 0 &&
+        y0 >= 0)
+    {
+        return append_graphic(&session->job, x0, y0, bitmap->bits, bitmap->stride, bitmap->width, bitmap->height);
+    }
+
+    display_list_clear(&session->scratch);
+
+    rc = display_list_bitmap(&session->scratch, r, bitmap);
+    if (rc < 0)
+        return rc;
+
+    return append_rastered(session, x0, y0, x1, y1);
+}
+
+/* ZPL has no polygons, so they're rastered. */
+static int append_polygon(struct zpl_session *session, const struct point *points, int count)
+{
+    int rc = 0;
+    const struct coordinate_space *space = &session->display.base.space;
+    int x0 = 0, y0 = 0, x1 = 0, y1 = 0;
+
+    if (count < 3)
+        return 0;
+
+    for (int i = 0; i < count; i++)
+    {
+        int x = coordinate_space_device_x(space, points[i].x);
+        int y = coordinate_space_device_y(space, points[i].y);
+
+        x0 = i == 0 || x < x0 ? x : x0;
+        y0 = i == 0 || y < y0 ? y : y0;
+        x1 = i == 0 || x + 1 > x1 ? x + 1 : x1;
+        y1 = i == 0 || y + 1 > y1 ? y + 1 : y1;
+    }
+
+    display_list_clear(&session->scratch);
+
+    rc = display_list_polygon(&session->scratch, points, count);
+    if (rc < 0)
+        return rc;
+
+    return append_rastered(session, x0, y0, x1, y1);
+}
+
+/* Field data with ^, ~ and the escape character itself written as _xx
+ * under ^FH. */
+static int append_field_data(struct raw_buffer *buffer, const char *text)
+{
+    int rc = buffer_append(buffer, "^FH^FD", 6);
+
+    for (; *text != '\0' && rc == 0; text++)
+    {
+        unsigned char c = (unsigned char)*text;
+
+        if (c == '^' || c == '~' || c == '_' || c < 0x20)
+            rc = buffer_printf(buffer, "_%02X", c);
+        else
+            rc = buffer_append(buffer, text, 1);
+    }
+
+    if (rc == 0)
+        rc = buffer_append(buffer, "^FS\n", 4);
+
+    return rc;
+}
+
+static int append_line(struct zpl_session *session, int lx0, int ly0, int lx1, int ly1)
+{
+    const struct coordinate_space *space = &session->display.base.space;
+    struct raw_buffer *job = &session->job;
+    int x0 = coordinate_space_device_x(space, lx0);
+    int y0 = coordinate_space_device_y(space, ly0);
+    int x1 = coordinate_space_device_x(space, lx1);
+    int y1 = coordinate_space_device_y(space, ly1);
+    int w = abs(x1 - x0);
+    int h = abs(y1 - y0);
+    int left = x0 < x1 ? x0 : x1;
+    int top = y0 < y1 ? y0 : y1;
+
+    if (w == 0 && h == 0)
+        return 0;
+
+    if (h == 0)
+        return buffer_printf(job, "^FO%d,%d^GB%d,1,1^FS\n", left, top, w);
+
+    if (w == 0)
+        return buffer_printf(job, "^FO%d,%d^GB1,%d,1^FS\n", left, top, h);
+
+    /* R leans like /, L like \. */
+    return buffer_printf(
+        job,
+        "^FO%d,%d^GD%d,%d,1,B,%c^FS\n",
+        left,
+        top,
+        w,
+        h,
+        (x1 > x0) != (y1 > y0) ? 'R' : 'L');
+}
+
+static int append_command(
+    struct zpl_session *session,
+    const struct display_list *page,
+    const struct display_command *command)
+{
+    const struct coordinate_space *space = &session->display.base.space;
+    struct raw_buffer *job = &session->job;
+    struct bitmap bitmap;
+    int x0, y0, x1, y1;
+    int rc = 0;
+
+    switch (command->op)
+    {
+    case DISPLAY_RECT:
+        device_rect(space, &command->rect, &x0, &y0, &x1, &y1);
+        if (x1 > x0 && y1 > y0)
+            rc = buffer_printf(job, "^FO%d,%d^GB%d,%d,1^FS\n", x0, y0, x1 - x0, y1 - y0);
+        break;
+
+    case DISPLAY_FILL:
+        /* A border at least half as thick as the box fills it. */
+        device_rect(space, &command->rect, &x0, &y0, &x1, &y1);
+        if (x1 > x0 && y1 > y0)
+        {
+            rc = buffer_printf(
+                job,
+                "^FO%d,%d^GB%d,%d,%d^FS\n",
+                x0,
+                y0,
+                x1 - x0,
+                y1 - y0,
+                x1 - x0 < y1 - y0 ? x1 - x0 : y1 - y0);
+        }
+        break;
+
+    case DISPLAY_LINE:
+        rc = append_line(session, command->line.x0, command->line.y0, command->line.x1, command->line.y1);
+        break;
+
+    case DISPLAY_TEXT:
+        rc = buffer_printf(
+            job,
+            "^FO%d,%d^A0N,%d",
+            coordinate_space_device_x(space, command->text.x),
+            coordinate_space_device_y(space, command->text.y),
+            coordinate_space_device_y(space, command->text.height));
+        if (rc == 0)
+            rc = append_field_data(job, display_command_text(page, command));
+        break;
+
+    case DISPLAY_BITMAP:
+        display_command_bitmap(page, command, &bitmap);
+        rc = append_bitmap(session, &command->bitmap.rect, &bitmap);
+        break;
+
+    case DISPLAY_POLYGON:
+        rc = append_polygon(session, display_command_points(page, command), command->polygon.count);
+        break;
+    }
+
+    return rc;
+}
+
+static int append_band(const struct raster_band *band, void *context)
+{
+    struct zpl_session *session = (struct zpl_session *)context;
+
+    return append_graphic(
+        &session->job,
+        0,
+        band->y,
+        band->bitmap->bits,
+        band->bitmap->stride,
+        band->bitmap->width,
+        band->bitmap->height);
+}
+
+static int zpl_end_page(struct print_session *base)
+{
+    int rc = 0;
+    struct zpl_session *session = (struct zpl_session *)base;
+    const struct display_list *page = &session->display.page;
+
+    if (!session->display.in_page)
+    {
+        log_error("No page started");
+        return -EINVAL;
+    }
+
+    session->display.in_page = 0;
+
+    /* Label size, origin in the corner and UTF-8 text. */
+    rc = buffer_printf(
+        &session->job,
+        "^XA\n^PW%d\n^LL%d\n^LH0,0\n^CI28\n",
+        base->space.device.width,
+        base->space.device.height);
+    if (rc < 0)
+        return rc;
+
+    if (base->raster)
+    {
+        rc = raster_render_page(&session->renderer, page, &base->space, append_band, session, &base->raster_stats);
+    }
+    else
+    {
+        for (size_t i = 0; i < page->count && rc == 0; i++)
+            rc = append_command(session, page, &page->commands[i]);
+    }
+
+    if (rc == 0)
+        rc = buffer_append(&session->job, "^XZ\n", 4);
+
+    if (rc < 0)
+    {
+        log_error("Failed to write page");
+        return rc;
+    }
+
+    base->page_count++;
+
+    return 0;
+}
+
+static void zpl_close_session(struct print_session *base)
+{
+    struct zpl_session *session = (struct zpl_session *)base;
+
+    if (base->in_document)
+        zpl_end_document(base, 1);
+
+    if (session->file != NULL)
+        fclose(session->file);
+
+#ifdef _WIN32
+    if (session->sink == RAW_SINK_SOCKET)
+        WSACleanup();
+
+    if (session->spooler != NULL)
+        ClosePrinter(session->spooler);
+#endif
+
+    display_session_release(&session->display);
+    display_list_free(&session->scratch);
+    bitmap_free(&session->region);
+    raster_renderer_free(&session->renderer);
+    free(session->job.data);
+    free(session);
+}
+
+const struct print_backend zpl_backend = {
+    .name = "zpl",
+    .enum_printers = zpl_enum_printers,
+    .get_datatypes = zpl_get_datatypes,
+    .get_capabilities = zpl_get_capabilities,
+    .get_driver_version = zpl_get_driver_version,
+    .open_session = zpl_open_session,
+    .start_document = zpl_start_document,
+    .end_document = zpl_end_document,
+    .start_page = zpl_start_page,
+    .end_page = zpl_end_page,
+    .draw_rect = display_session_draw_rect,
+    .fill_rect = display_session_fill_rect,
+    .draw_line = display_session_draw_line,
+    .draw_text = display_session_draw_text,
+    .fill_polygon = display_session_fill_polygon,
+    .draw_bitmap = display_session_draw_bitmap,
+    .begin_template = display_session_begin_template,
+    .end_template = display_session_end_template,
+    .draw_template = display_session_draw_template,
+    .serialise_template = page_template_serialise,
+    .deserialise_template = page_template_deserialise,
+    .free_template = page_template_free,
+    .close_session = zpl_close_session,
+};
@@ -0,0 +1,339 @@
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "band_pool.h"
+#include "log.h"
+#include "thread.h"
+#include "timing.h"
+#include "trace.h"
+
+enum slot_state
+{
+    SLOT_FREE,
+    SLOT_RENDERING,
+    SLOT_DONE,
+};
+
+struct slot
+{
+    enum slot_state state;
+    int index;
+    int rc;
+    uint64_t render_ns;
+    struct bitmap bitmap;
+};
+
+struct worker
+{
+    struct band_pool *pool;
+    struct thread thread;
+    int running;
+};
+
+/* The page being rendered. */
+struct job
+{
+    const struct display_list *page;
+    const struct coordinate_space *space;
+    const struct raster_plan *plan;
+};
+
+struct band_pool
+{
+    struct mutex lock;
+    struct cond work;
+    struct cond done;
+    int shutdown;
+
+    /* Band numbers only ever increase within a page. emitted <= claimed
+     * <= band_count, and claimed - emitted never exceeds the window. */
+    struct job job;
+    int band_count;
+    int claimed;
+    int emitted;
+
+    /* Workers part way through a band. */
+    int busy;
+
+    struct slot *slots;
+    int window;
+
+    struct worker *workers;
+    int threads;
+};
+
+static int can_claim(const struct band_pool *pool)
+{
+    return pool->claimed < pool->band_count && pool->claimed - pool->emitted < pool->window;
+}
+
+static void render_slot(const struct job *job, struct slot *slot)
+{
+    const struct raster_plan *plan = job->plan;
+    int y = slot->index * plan->band_height;
+    int height = job->space->device.height - y;
+    struct trace_span span = trace_begin("render band");
+    uint64_t start = span.start_ns;
+
+    if (height > plan->band_height)
+        height = plan->band_height;
+
+    slot->rc = bitmap_resize(&slot->bitmap, job->space->device.width, height);
+    if (slot->rc < 0)
+        log_error("Failed to allocate band");
+    else
+        slot->rc = raster_render_band(job->page, job->space, plan, slot->index, &slot->bitmap);
+
+    trace_end(&span);
+    slot->render_ns = timing_now_ns() - start;
+}
+
+static void worker_main(void *arg)
+{
+    struct worker *worker = (struct worker *)arg;
+    struct band_pool *pool = worker->pool;
+
+    trace_thread_name("band worker");
+
+    for (;;)
+    {
+        struct slot *slot = NULL;
+        struct job job;
+
+        mutex_lock(&pool->lock);
+
+        while (!pool->shutdown && !can_claim(pool))
+            cond_wait(&pool->work, &pool->lock);
+
+        if (pool->shutdown)
+        {
+            mutex_unlock(&pool->lock);
+            break;
+        }
+
+        slot = &pool->slots[pool->claimed % pool->window];
+        slot->index = pool->claimed++;
+        slot->state = SLOT_RENDERING;
+        job = pool->job;
+        pool->busy++;
+
+        mutex_unlock(&pool->lock);
+
+        render_slot(&job, slot);
+
+        mutex_lock(&pool->lock);
+        slot->state = SLOT_DONE;
+        pool->busy--;
+        cond_broadcast(&pool->done);
+        mutex_unlock(&pool->lock);
+    }
+}
+
+struct band_pool *band_pool_create(int threads, int window)
+{
+    struct band_pool *pool = NULL;
+
+    if (threads <= 0)
+        threads = thread_cpu_count();
+
+    /* One band being emitted while every worker renders another. */
+    if (window <= 0)
+        window = threads * 2;
+
+    if (window < threads)
+        window = threads;
+
+    pool = (struct band_pool *)calloc(1, sizeof(*pool));
+    if (pool == NULL)
+    {
+        log_error("Failed to allocate memory");
+        return NULL;
+    }
+
+    mutex_init(&pool->lock);
+    cond_init(&pool->work);
+    cond_init(&pool->done);
+
+    pool->window = window;
+    pool->slots = (struct slot *)calloc((size_t)window, sizeof(*pool->slots));
+    pool->workers = (struct worker *)calloc((size_t)threads, sizeof(*pool->workers));
+    if (pool->slots == NULL || pool->workers == NULL)
+    {
+        log_error("Failed to allocate memory");
+        goto error;
+    }
+
+    for (int i = 0; i < threads; i++)
+    {
+        struct worker *worker = &pool->workers[i];
+
+        worker->pool = pool;
+        pool->threads++;
+
+        if (thread_create(&worker->thread, worker_main, worker) < 0)
+        {
+            log_error("Failed to start worker %d", i);
+            goto error;
+        }
+
+        worker->running = 1;
+    }
+
+    return pool;
+
+error:
+    band_pool_destroy(pool);
+
+    return NULL;
+}
+
+void band_pool_destroy(struct band_pool *pool)
+{
+    if (pool == NULL)
+        return;
+
+    mutex_lock(&pool->lock);
+    pool->shutdown = 1;
+    cond_broadcast(&pool->work);
+    mutex_unlock(&pool->lock);
+
+    for (int i = 0; i < pool->threads; i++)
+    {
+        if (pool->workers[i].running)
+            thread_join(&pool->workers[i].thread);
+    }
+
+    if (pool->slots != NULL)
+    {
+        for (int i = 0; i < pool->window; i++)
+            bitmap_free(&pool->slots[i].bitmap);
+
+        free(pool->slots);
+    }
+
+    free(pool->workers);
+
+    cond_destroy(&pool->done);
+    cond_destroy(&pool->work);
+    mutex_destroy(&pool->lock);
+
+    free(pool);
+}
+
+int band_pool_threads(const struct band_pool *pool)
+{
+    return pool->threads;
+}
+
+int band_pool_render(
+    struct band_pool *pool,
+    const struct display_list *page,
+    const struct coordinate_space *space,
+    const struct raster_plan *plan,
+    raster_band_fn emit,
+    void *context,
+    struct raster_stats *stats)
+{
+    int rc = 0;
+    uint64_t start_ns = timing_now_ns();
+
+    mutex_lock(&pool->lock);
+
+    pool->job.page = page;
+    pool->job.space = space;
+    pool->job.plan = plan;
+    pool->band_count = plan->band_count;
+    pool->claimed = 0;
+    pool->emitted = 0;
+
+    cond_broadcast(&pool->work);
+
+    while (pool->emitted < pool->band_count)
+    {
+        struct slot *slot = &pool->slots[pool->emitted % pool->window];
+        struct raster_band band;
+        uint64_t emit_ns = 0;
+
+        while (pool->claimed <= pool->emitted || slot->state != SLOT_DONE)
+            cond_wait(&pool->done, &pool->lock);
+
+        mutex_unlock(&pool->lock);
+
+        /* The slot isn't reused until emitted moves past it, so it can be
+         * read and emitted outside the lock. */
+        rc = slot->rc;
+        if (rc >= 0)
+        {
+            band.bitmap = &slot->bitmap;
+            band.index = slot->index;
+            band.y = slot->index * plan->band_height;
+            band.render_ns = slot->render_ns;
+
+            emit_ns = timing_now_ns();
+            rc = emit(&band, context);
+        }
+
+        if (rc >= 0 && stats != NULL)
+        {
+            uint64_t now = timing_now_ns();
+
+            if (band.index == 0)
+                stats->first_band_ns += now - start_ns;
+
+            stats->bands++;
+            stats->commands += (uint64_t)slot->rc;
+            stats->render_ns += band.render_ns;
+            stats->emit_ns += now - emit_ns;
+
+            if (band.render_ns > stats->slowest_band_ns)
+                stats->slowest_band_ns = band.render_ns;
+        }
+
+        mutex_lock(&pool->lock);
+
+        slot->state = SLOT_FREE;
+        pool->emitted++;
+
+        /* Stop handing out bands, and wait for the ones already out to
+         * finish before the page goes away. */
+        if (rc < 0)
+        {
+            pool->band_count = pool->claimed;
+
+            while (pool->busy > 0)
+                cond_wait(&pool->done, &pool->lock);
+
+            break;
+        }
+
+        cond_broadcast(&pool->work);
+    }
+
+    for (int i = 0; i < pool->window; i++)
+        pool->slots[i].state = SLOT_FREE;
+
+    pool->band_count = 0;
+    pool->claimed = 0;
+    pool->emitted = 0;
+    memset(&pool->job, 0, sizeof(pool->job));
+
+    mutex_unlock(&pool->lock);
+
+    return rc < 0 ? rc : 0;
+}
+
+size_t band_pool_bytes(struct band_pool *pool)
+{
+    size_t bytes = 0;
+
+    mutex_lock(&pool->lock);
+
+    for (int i = 0; i < pool->window; i++)
+        bytes += pool->slots[i].bitmap.capacity;
+
+    mutex_unlock(&pool->lock);
+
+    return bytes;
+}
@@ -0,0 +1,40 @@
+#ifndef BAND_POOL_H
+#define BAND_POOL_H
+
+#include <stddef.h>
+
+#include "raster.h"
+
+/* Worker threads that render the bands of a planned page in parallel.
+ * Each worker takes the next band down the page and renders it into one of
+ * a window of band buffers, walking only the commands the plan put in that
+ * band. Bands are still handed on strictly top to bottom, so the first
+ * band goes out as soon as it's done while the rest are rendered behind
+ * it. The workers are kept between pages. */
+struct band_pool;
+
+/* threads <= 0 means one worker per CPU. window is the number of band
+ * buffers, <= 0 picks two per worker. */
+struct band_pool *band_pool_create(int threads, int window);
+
+void band_pool_destroy(struct band_pool *pool);
+
+int band_pool_threads(const struct band_pool *pool);
+
+/* Renders every band of the plan and hands them to emit in order. Each
+ * band buffer holds band_height rows of device.width pixels, so the pool
+ * uses at most window times the band size. stats, if not NULL, is added
+ * to. */
+int band_pool_render(
+    struct band_pool *pool,
+    const struct display_list *page,
+    const struct coordinate_space *space,
+    const struct raster_plan *plan,
+    raster_band_fn emit,
+    void *context,
+    struct raster_stats *stats);
+
+/* The memory the band buffers hold. */
+size_t band_pool_bytes(struct band_pool *pool);
+
+#endif /* BAND_POOL_H */
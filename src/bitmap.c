@@ -0,0 +1,88 @@
+#include <errno.h>
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bitmap.h"
+
+int bitmap_resize(struct bitmap *bitmap, int width, int height)
+{
+    size_t stride = 0;
+    size_t needed = 0;
+
+    if (width <= 0 || height <= 0 || width > INT_MAX - 31)
+        return -EINVAL;
+
+    stride = (((size_t)width + 31) / 32) * 4;
+    needed = stride * (size_t)height;
+
+    if (needed > bitmap->capacity)
+    {
+        unsigned char *bits = (unsigned char *)realloc(bitmap->bits, needed);
+        if (bits == NULL)
+            return -ENOMEM;
+
+        bitmap->bits = bits;
+        bitmap->capacity = needed;
+    }
+
+    bitmap->width = width;
+    bitmap->height = height;
+    bitmap->stride = stride;
+
+    memset(bitmap->bits, 0, needed);
+
+    return 0;
+}
+
+void bitmap_free(struct bitmap *bitmap)
+{
+    if (bitmap->bits != NULL)
+        free(bitmap->bits);
+
+    memset(bitmap, 0, sizeof(*bitmap));
+}
+
+void bitmap_fill_span(unsigned char *row, int x0, int x1)
+{
+    int first = x0 / 8;
+    int last = (x1 - 1) / 8;
+    unsigned char head = (unsigned char)(0xff >> (x0 % 8));
+    unsigned char tail = (unsigned char)(0xff << (7 - (x1 - 1) % 8));
+
+    if (x1 <= x0)
+        return;
+
+    if (first == last)
+    {
+        row[first] |= head & tail;
+        return;
+    }
+
+    /* Partial bytes at either end and whole bytes in between, which
+     * memset fills a word at a time. */
+    row[first] |= head;
+    memset(row + first + 1, 0xff, (size_t)(last - first - 1));
+    row[last] |= tail;
+}
+
+void bitmap_clear_span(unsigned char *row, int x0, int x1)
+{
+    int first = x0 / 8;
+    int last = (x1 - 1) / 8;
+    unsigned char head = (unsigned char)(0xff >> (x0 % 8));
+    unsigned char tail = (unsigned char)(0xff << (7 - (x1 - 1) % 8));
+
+    if (x1 <= x0)
+        return;
+
+    if (first == last)
+    {
+        row[first] &= (unsigned char)~(head & tail);
+        return;
+    }
+
+    row[first] &= (unsigned char)~head;
+    memset(row + first + 1, 0x00, (size_t)(last - first - 1));
+    row[last] &= (unsigned char)~tail;
+}
@@ -0,0 +1,36 @@
+#ifndef BITMAP_H
+#define BITMAP_H
+
+#include <stddef.h>
+
+/* A packed 1 bit per pixel image, top row first, most significant bit
+ * leftmost and a set bit black. Rows are padded to 32 bits, so the bits
+ * can go straight to StretchDIBits with a two entry colour table, or into
+ * a printer's raster command. The buffer is kept between uses and only
+ * grows. */
+struct bitmap
+{
+    int width;
+    int height;
+    size_t stride;
+    unsigned char *bits;
+    size_t capacity;
+};
+
+/* Sets the size and clears the image to white. */
+int bitmap_resize(struct bitmap *bitmap, int width, int height);
+
+void bitmap_free(struct bitmap *bitmap);
+
+static inline unsigned char *bitmap_row(const struct bitmap *bitmap, int y)
+{
+    return bitmap->bits + (size_t)y * bitmap->stride;
+}
+
+/* Blackens pixels [x0, x1) of a row. */
+void bitmap_fill_span(unsigned char *row, int x0, int x1);
+
+/* Whitens pixels [x0, x1) of a row. */
+void bitmap_clear_span(unsigned char *row, int x0, int x1);
+
+#endif /* BITMAP_H */
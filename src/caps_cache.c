@@ -0,0 +1,647 @@
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _WIN32
+#include <direct.h>
+#define make_dir(path) _mkdir(path)
+#define PATH_SEPARATOR "\\"
+#else
+#include <sys/stat.h>
+#define make_dir(path) mkdir(path, 0700)
+#define PATH_SEPARATOR "/"
+#endif
+
+#include "caps_cache.h"
+#include "hash.h"
+#include "log.h"
+#include "text_record.h"
+
+#define CACHE_MAGIC "# printer capability cache v1"
+#define CACHE_DIR "WindowsPrinters"
+#define CACHE_FILE "printer_caps.cache"
+#define CACHE_PATH_LENGTH 512
+
+struct caps_cache
+{
+    /* Empty if there's nowhere to keep it, and it only lasts the run. */
+    char path[CACHE_PATH_LENGTH];
+
+    /* The per-user directory path is in, made on saving. Empty for a path
+     * the caller named. */
+    char dir[CACHE_PATH_LENGTH];
+    int dirty;
+
+    /* Open addressed, linear probing, never more than half full. */
+    struct cached_printer **printers;
+    int size;
+    int count;
+};
+
+static void free_printer(struct cached_printer *printer)
+{
+    printer_caps_free(&printer->caps);
+    free(printer->geometry);
+    free(printer->paper_index);
+    free(printer);
+}
+
+static int build_paper_index(struct cached_printer *printer)
+{
+    int size = 8;
+
+    while (size < printer->caps.paper_count * 2)
+        size *= 2;
+
+    free(printer->paper_index);
+
+    printer->paper_index = (int *)malloc(size * sizeof(int));
+    if (printer->paper_index == NULL)
+        return -ENOMEM;
+
+    printer->paper_index_size = size;
+
+    for (int i = 0; i < size; i++)
+        printer->paper_index[i] = -1;
+
+    for (int i = 0; i < printer->caps.paper_count; i++)
+    {
+        uint32_t slot = hash_string(printer->caps.papers[i].name) & (uint32_t)(size - 1);
+
+        /* Drivers do report duplicate names; the first one wins, the same
+         * as a linear search would. */
+        while (printer->paper_index[slot] >= 0 &&
+               strcmp(printer->caps.papers[printer->paper_index[slot]].name,
+                      printer->caps.papers[i].name) != 0)
+            slot = (slot + 1) & (uint32_t)(size - 1);
+
+        if (printer->paper_index[slot] < 0)
+            printer->paper_index[slot] = i;
+    }
+
+    return 0;
+}
+
+/* Finds the slot holding a printer, or the empty slot it would go in. */
+static int find_slot(const struct caps_cache *cache, const char *printer_name)
+{
+    uint32_t slot = hash_string(printer_name) & (uint32_t)(cache->size - 1);
+
+    while (cache->printers[slot] != NULL &&
+           strcmp(cache->printers[slot]->name, printer_name) != 0)
+        slot = (slot + 1) & (uint32_t)(cache->size - 1);
+
+    return (int)slot;
+}
+
+static int grow(struct caps_cache *cache)
+{
+    struct cached_printer **old = cache->printers;
+    int old_size = cache->size;
+    int size = old_size > 0 ? old_size * 2 : 16;
+
+    cache->printers = (struct cached_printer **)calloc(size, sizeof(*cache->printers));
+    if (cache->printers == NULL)
+    {
+        cache->printers = old;
+        return -ENOMEM;
+    }
+
+    cache->size = size;
+
+    for (int i = 0; i < old_size; i++)
+    {
+        if (old[i] != NULL)
+            cache->printers[find_slot(cache, old[i]->name)] = old[i];
+    }
+
+    free(old);
+
+    return 0;
+}
+
+static int insert(struct caps_cache *cache, struct cached_printer *printer)
+{
+    int slot;
+
+    if ((cache->count + 1) * 2 > cache->size && grow(cache) < 0)
+        return -ENOMEM;
+
+    slot = find_slot(cache, printer->name);
+    if (cache->printers[slot] != NULL)
+    {
+        free_printer(cache->printers[slot]);
+        cache->count--;
+    }
+
+    cache->printers[slot] = printer;
+    cache->count++;
+    cache->dirty = 1;
+
+    return 0;
+}
+
+static struct cached_printer *lookup(const struct caps_cache *cache, const char *printer_name)
+{
+    if (cache->size == 0)
+        return NULL;
+
+    return cache->printers[find_slot(cache, printer_name)];
+}
+
+static struct cached_printer *parse_printer(char *line)
+{
+    struct cached_printer *printer = NULL;
+    char *cursor = line + strlen("PRINTER");
+
+    printer = (struct cached_printer *)calloc(1, sizeof(*printer));
+    if (printer == NULL)
+        return NULL;
+
+    if (text_record_next_token(&cursor, printer->name, sizeof(printer->name)) < 0 ||
+        text_record_next_token(
+            &cursor, printer->driver_version, sizeof(printer->driver_version)) < 0 ||
+        text_record_next_int(&cursor, &printer->caps.dpi_x) < 0 ||
+        text_record_next_int(&cursor, &printer->caps.dpi_y) < 0 ||
+        text_record_next_int(&cursor, &printer->caps.colour) < 0 ||
+        text_record_next_int(&cursor, &printer->caps.paper_count) < 0 ||
+        printer->caps.paper_count < 0)
+        goto error;
+
+    if (printer->caps.paper_count == 0)
+        return printer;
+
+    printer->caps.papers = (struct paper_info *)calloc(
+        printer->caps.paper_count, sizeof(*printer->caps.papers));
+    printer->geometry = (struct paper_geometry *)calloc(
+        printer->caps.paper_count, sizeof(*printer->geometry));
+    if (printer->caps.papers == NULL || printer->geometry == NULL)
+        goto error;
+
+    return printer;
+
+error:
+    free_printer(printer);
+
+    return NULL;
+}
+
+static int parse_paper(char *line, struct paper_info *paper, struct paper_geometry *geometry)
+{
+    char *cursor = line + strlen("PAPER");
+    int size = 0;
+
+    if (text_record_next_int(&cursor, &size) < 0 ||
+        text_record_next_int(&cursor, &paper->width) < 0 ||
+        text_record_next_int(&cursor, &paper->height) < 0 ||
+        text_record_next_int(&cursor, &geometry->known) < 0 ||
+        text_record_next_int(&cursor, &geometry->device_width) < 0 ||
+        text_record_next_int(&cursor, &geometry->device_height) < 0 ||
+        text_record_next_int(&cursor, &geometry->offset_x) < 0 ||
+        text_record_next_int(&cursor, &geometry->offset_y) < 0 ||
+        text_record_next_int(&cursor, &geometry->printable_width) < 0 ||
+        text_record_next_int(&cursor, &geometry->printable_height) < 0 ||
+        text_record_next_token(&cursor, paper->name, sizeof(paper->name)) < 0)
+        return -EINVAL;
+
+    paper->size = (short)size;
+
+    return 0;
+}
+
+static int load(struct caps_cache *cache, FILE *in)
+{
+    char line[1024];
+    struct cached_printer *printer = NULL;
+    int papers = 0;
+
+    if (fgets(line, sizeof(line), in) == NULL || strncmp(line, CACHE_MAGIC, strlen(CACHE_MAGIC)) != 0)
+    {
+        log_warn("Ignoring capability cache with unknown format");
+        return -EINVAL;
+    }
+
+    while (fgets(line, sizeof(line), in) != NULL)
+    {
+        if (strncmp(line, "PRINTER ", 8) == 0)
+        {
+            if (printer != NULL)
+                goto error;
+
+            printer = parse_printer(line);
+            if (printer == NULL)
+                goto error;
+
+            papers = 0;
+        }
+        else if (strncmp(line, "PAPER ", 6) == 0)
+        {
+            if (printer == NULL || papers >= printer->caps.paper_count)
+                goto error;
+
+            if (parse_paper(line, &printer->caps.papers[papers], &printer->geometry[papers]) < 0)
+                goto error;
+
+            papers++;
+        }
+        else
+        {
+            goto error;
+        }
+
+        if (printer != NULL && papers == printer->caps.paper_count)
+        {
+            if (build_paper_index(printer) < 0 || insert(cache, printer) < 0)
+                goto error;
+
+            printer = NULL;
+        }
+    }
+
+    if (printer != NULL)
+        goto error;
+
+    cache->dirty = 0;
+
+    return 0;
+
+error:
+    log_warn("Ignoring corrupt capability cache");
+
+    if (printer != NULL)
+        free_printer(printer);
+
+    return -EINVAL;
+}
+
+/* The per-user cache directory: under %LOCALAPPDATA% on Windows, otherwise
+ * $XDG_CACHE_HOME or ~/.cache. Leaves both empty if there isn't one, or its
+ * path is too long. */
+static void default_path(struct caps_cache *cache)
+{
+    int length = -1;
+#ifdef _WIN32
+    const char *base = getenv("LOCALAPPDATA");
+
+    if (base != NULL && base[0] != '\0')
+        length = snprintf(cache->dir, sizeof(cache->dir), "%s" PATH_SEPARATOR CACHE_DIR, base);
+#else
+    const char *base = getenv("XDG_CACHE_HOME");
+    const char *home = getenv("HOME");
+
+    if (base != NULL && base[0] != '\0')
+        length = snprintf(cache->dir, sizeof(cache->dir), "%s/" CACHE_DIR, base);
+    else if (home != NULL && home[0] != '\0')
+        length = snprintf(cache->dir, sizeof(cache->dir), "%s/.cache/" CACHE_DIR, home);
+#endif
+
+    if (length >= 0 && (size_t)length + sizeof(PATH_SEPARATOR CACHE_FILE) <= sizeof(cache->path))
+    {
+        memcpy(cache->path, cache->dir, (size_t)length);
+        memcpy(cache->path + length, PATH_SEPARATOR CACHE_FILE, sizeof(PATH_SEPARATOR CACHE_FILE));
+        return;
+    }
+
+    cache->dir[0] = '\0';
+}
+
+/* Makes dir and any of its parents that are missing. Failures show up when
+ * the cache is written. */
+static void make_dirs(const char *dir)
+{
+    char partial[CACHE_PATH_LENGTH];
+    size_t length = strlen(dir);
+
+    for (size_t i = 1; i <= length; i++)
+    {
+        if (dir[i] != '/' && dir[i] != '\\' && dir[i] != '\0')
+            continue;
+
+        memcpy(partial, dir, i);
+        partial[i] = '\0';
+        make_dir(partial);
+    }
+}
+
+struct caps_cache *caps_cache_open(const char *path)
+{
+    struct caps_cache *cache = NULL;
+    FILE *in = NULL;
+
+    if (path == NULL)
+        path = getenv("PRINT_CAPS_CACHE");
+
+    cache = (struct caps_cache *)calloc(1, sizeof(*cache));
+    if (cache == NULL)
+    {
+        log_error("Failed to allocate memory");
+        return NULL;
+    }
+
+    if (path != NULL)
+        snprintf(cache->path, sizeof(cache->path), "%s", path);
+    else
+        default_path(cache);
+
+    if (cache->path[0] == '\0')
+        return cache;
+
+    in = fopen(cache->path, "r");
+    if (in != NULL)
+    {
+        if (load(cache, in) < 0)
+        {
+            /* Start again from empty rather than trust half of it. */
+            for (int i = 0; i < cache->size; i++)
+            {
+                if (cache->printers[i] != NULL)
+                    free_printer(cache->printers[i]);
+
+                cache->printers[i] = NULL;
+            }
+
+            cache->count = 0;
+            cache->dirty = 1;
+        }
+
+        fclose(in);
+    }
+
+    return cache;
+}
+
+int caps_cache_save(struct caps_cache *cache)
+{
+    int rc = 0;
+    FILE *out = NULL;
+    char temp_path[CACHE_PATH_LENGTH + 8];
+
+    if (!cache->dirty || cache->path[0] == '\0')
+        return 0;
+
+    if (cache->dir[0] != '\0')
+        make_dirs(cache->dir);
+
+    snprintf(temp_path, sizeof(temp_path), "%s.tmp", cache->path);
+
+    out = fopen(temp_path, "w");
+    if (out == NULL)
+    {
+        log_error("Failed to create \"%s\"", temp_path);
+        return -EIO;
+    }
+
+    fprintf(out, "%s\n", CACHE_MAGIC);
+
+    for (int i = 0; i < cache->size; i++)
+    {
+        const struct cached_printer *printer = cache->printers[i];
+
+        if (printer == NULL)
+            continue;
+
+        fprintf(out, "PRINTER ");
+        text_record_write_string(out, printer->name);
+        fputc(' ', out);
+        text_record_write_string(out, printer->driver_version);
+        fprintf(
+            out,
+            " %d %d %d %d\n",
+            printer->caps.dpi_x,
+            printer->caps.dpi_y,
+            printer->caps.colour,
+            printer->caps.paper_count);
+
+        for (int j = 0; j < printer->caps.paper_count; j++)
+        {
+            const struct paper_info *paper = &printer->caps.papers[j];
+            const struct paper_geometry *geometry = &printer->geometry[j];
+
+            fprintf(
+                out,
+                "PAPER %d %d %d %d %d %d %d %d %d %d ",
+                paper->size,
+                paper->width,
+                paper->height,
+                geometry->known,
+                geometry->device_width,
+                geometry->device_height,
+                geometry->offset_x,
+                geometry->offset_y,
+                geometry->printable_width,
+                geometry->printable_height);
+            text_record_write_string(out, paper->name);
+            fputc('\n', out);
+        }
+    }
+
+    if (fclose(out) != 0)
+    {
+        log_error("Failed to write \"%s\"", temp_path);
+        rc = -EIO;
+        goto exit;
+    }
+
+    /* rename() won't replace an existing file on Windows. */
+    remove(cache->path);
+
+    if (rename(temp_path, cache->path) != 0)
+    {
+        log_error("Failed to replace \"%s\"", cache->path);
+        rc = -EIO;
+        goto exit;
+    }
+
+    cache->dirty = 0;
+
+exit:
+    if (rc < 0)
+        remove(temp_path);
+
+    return rc;
+}
+
+void caps_cache_close(struct caps_cache *cache)
+{
+    if (cache == NULL)
+        return;
+
+    caps_cache_save(cache);
+
+    for (int i = 0; i < cache->size; i++)
+    {
+        if (cache->printers[i] != NULL)
+            free_printer(cache->printers[i]);
+    }
+
+    free(cache->printers);
+    free(cache);
+}
+
+int caps_cache_get(
+    struct caps_cache *cache,
+    const struct print_backend *backend,
+    const char *printer_name,
+    const struct cached_printer **result)
+{
+    int rc = 0;
+    char version[DRIVER_VERSION_LENGTH];
+    struct cached_printer *printer = NULL;
+
+    *result = NULL;
+
+    rc = backend->get_driver_version(printer_name, version, sizeof(version));
+    if (rc < 0)
+    {
+        log_error("Failed to get driver version");
+        return rc;
+    }
+
+    printer = lookup(cache, printer_name);
+    if (printer != NULL && strcmp(printer->driver_version, version) == 0)
+    {
+        *result = printer;
+        return 0;
+    }
+
+    /* Missing, or the driver changed underneath us. */
+    printer = (struct cached_printer *)calloc(1, sizeof(*printer));
+    if (printer == NULL)
+    {
+        log_error("Failed to allocate memory");
+        return -ENOMEM;
+    }
+
+    snprintf(printer->name, sizeof(printer->name), "%s", printer_name);
+    snprintf(printer->driver_version, sizeof(printer->driver_version), "%s", version);
+
+    rc = backend->get_capabilities(printer_name, &printer->caps);
+    if (rc < 0)
+    {
+        log_error("Failed to get capabilities");
+        goto error;
+    }
+
+    if (printer->caps.paper_count > 0)
+    {
+        printer->geometry = (struct paper_geometry *)calloc(
+            printer->caps.paper_count, sizeof(*printer->geometry));
+        if (printer->geometry == NULL)
+        {
+            log_error("Failed to allocate memory");
+            rc = -ENOMEM;
+            goto error;
+        }
+    }
+
+    rc = build_paper_index(printer);
+    if (rc < 0)
+    {
+        log_error("Failed to allocate memory");
+        goto error;
+    }
+
+    rc = insert(cache, printer);
+    if (rc < 0)
+    {
+        log_error("Failed to allocate memory");
+        goto error;
+    }
+
+    *result = printer;
+
+    return 0;
+
+error:
+    free_printer(printer);
+
+    return rc;
+}
+
+const struct cached_printer *caps_cache_peek(
+    const struct caps_cache *cache,
+    const char *printer_name,
+    const char *driver_version)
+{
+    const struct cached_printer *printer = lookup(cache, printer_name);
+
+    if (printer == NULL || strcmp(printer->driver_version, driver_version) != 0)
+        return NULL;
+
+    return printer;
+}
+
+void caps_cache_invalidate(struct caps_cache *cache, const char *printer_name)
+{
+    struct cached_printer *printer = lookup(cache, printer_name);
+
+    /* An empty version never matches, so the next lookup refreshes it. */
+    if (printer != NULL)
+    {
+        printer->driver_version[0] = '\0';
+        cache->dirty = 1;
+    }
+}
+
+static int find_paper_index(const struct cached_printer *printer, const char *paper_name)
+{
+    uint32_t mask = (uint32_t)(printer->paper_index_size - 1);
+    uint32_t slot = hash_string(paper_name) & mask;
+
+    while (printer->paper_index[slot] >= 0)
+    {
+        int i = printer->paper_index[slot];
+
+        if (strcmp(printer->caps.papers[i].name, paper_name) == 0)
+            return i;
+
+        slot = (slot + 1) & mask;
+    }
+
+    return -1;
+}
+
+const struct paper_info *cached_printer_find_paper(
+    const struct cached_printer *printer,
+    const char *paper_name,
+    const struct paper_geometry **geometry)
+{
+    int i = find_paper_index(printer, paper_name);
+
+    if (i < 0)
+        return NULL;
+
+    if (geometry != NULL)
+        *geometry = &printer->geometry[i];
+
+    return &printer->caps.papers[i];
+}
+
+void caps_cache_set_geometry(
+    struct caps_cache *cache,
+    const char *printer_name,
+    const struct print_session *session)
+{
+    struct cached_printer *printer = lookup(cache, printer_name);
+    struct paper_geometry geometry = {
+        .known = 1,
+        .device_width = session->space.device.width,
+        .device_height = session->space.device.height,
+        .offset_x = session->space.device.offset_x,
+        .offset_y = session->space.device.offset_y,
+        .printable_width = session->printable_width,
+        .printable_height = session->printable_height,
+    };
+    int i;
+
+    if (printer == NULL)
+        return;
+
+    i = find_paper_index(printer, session->paper.name);
+    if (i < 0 || memcmp(&printer->geometry[i], &geometry, sizeof(geometry)) == 0)
+        return;
+
+    printer->geometry[i] = geometry;
+    cache->dirty = 1;
+}
@@ -0,0 +1,80 @@
+#ifndef CAPS_CACHE_H
+#define CAPS_CACHE_H
+
+#include "print_backend.h"
+
+/* A persistent cache of printer capabilities. Querying DeviceCapabilities
+ * against a network printer costs a round trip per query, so the paper
+ * table, DPI and per-paper device geometry are kept on disk keyed by the
+ * printer name and validated against the driver version, which is a
+ * single cheap query. Printers and papers are found through hash indexes.
+ *
+ * Not thread safe. */
+
+struct paper_geometry
+{
+    int known;
+    int device_width;
+    int device_height;
+    int offset_x;
+    int offset_y;
+    int printable_width;
+    int printable_height;
+};
+
+struct cached_printer
+{
+    char name[PRINTER_NAME_LENGTH];
+    char driver_version[DRIVER_VERSION_LENGTH];
+    struct printer_caps caps;
+
+    /* One per paper, filled in once a session has been opened with it. */
+    struct paper_geometry *geometry;
+
+    /* Open addressed index into caps.papers by name. */
+    int *paper_index;
+    int paper_index_size;
+};
+
+struct caps_cache;
+
+/* Loads the cache from path if it exists. NULL uses $PRINT_CAPS_CACHE or
+ * printer_caps.cache in the per-user cache directory, or keeps it in memory
+ * if there's no such directory. */
+struct caps_cache *caps_cache_open(const char *path);
+
+/* Saves the cache if it has changed and frees it. */
+void caps_cache_close(struct caps_cache *cache);
+
+int caps_cache_save(struct caps_cache *cache);
+
+/* Returns the capabilities of a printer, querying the backend only if
+ * they aren't cached or the driver has changed since. */
+int caps_cache_get(
+    struct caps_cache *cache,
+    const struct print_backend *backend,
+    const char *printer_name,
+    const struct cached_printer **printer);
+
+/* Returns what's cached for a printer, if it was cached with this driver
+ * version, without asking the backend anything. */
+const struct cached_printer *caps_cache_peek(
+    const struct caps_cache *cache,
+    const char *printer_name,
+    const char *driver_version);
+
+/* Forgets a printer so the next lookup queries it again. */
+void caps_cache_invalidate(struct caps_cache *cache, const char *printer_name);
+
+const struct paper_info *cached_printer_find_paper(
+    const struct cached_printer *printer,
+    const char *paper_name,
+    const struct paper_geometry **geometry);
+
+/* Records the device geometry an open session reported for its paper. */
+void caps_cache_set_geometry(
+    struct caps_cache *cache,
+    const char *printer_name,
+    const struct print_session *session);
+
+#endif /* CAPS_CACHE_H */
@@ -0,0 +1,7 @@
+#ifndef COUNT_OF_H
+#define COUNT_OF_H
+
+/* The number of elements in an array, not a pointer to one. */
+#define COUNT_OF(a) ((int)(sizeof(a) / sizeof((a)[0])))
+
+#endif /* COUNT_OF_H */
@@ -0,0 +1,478 @@
+#include <errno.h>
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "datamatrix.h"
+#include "expand.h"
+#include "log.h"
+#include "print_backend.h"
+#include "symbol_cache.h"
+#include "symbol_layout.h"
+
+/* Wide enough for the largest symbol at 600 DPI without touching the
+ * heap. */
+#define RENDER_STACK_WIDTH 4096
+
+/* The fewest codewords a character can take in any scheme, in twelfths:
+ * ASCII packs a pair of digits into a codeword, C40, Text and X12 three
+ * values into two, EDIFACT four into three and Base 256 a byte into one. */
+#define COST_DIGIT_PAIR 12
+#define COST_TRIPLET 8
+#define COST_EDIFACT 9
+#define COST_BYTE 12
+
+/* How many of each kind of character a payload has. */
+struct payload_classes
+{
+    size_t digits;
+    size_t upper;
+    size_t lower;
+    size_t space;
+
+    /* Carriage return, and the '*' and '>' X12 adds to C40's set. */
+    size_t cr;
+    size_t x12_marks;
+
+    /* 32 to 94, which is what EDIFACT encodes. */
+    size_t edifact;
+    size_t extended;
+
+    /* Pairs of digits in a row, as ASCII packs them. */
+    size_t digit_pairs;
+};
+
+struct datamatrix_encoder *datamatrix_encoder_create(
+    const struct datamatrix_options *options)
+{
+    struct datamatrix_encoder *encoder = NULL;
+
+    encoder = (struct datamatrix_encoder *)calloc(1, sizeof(*encoder));
+    if (encoder == NULL)
+    {
+        log_error("Failed to allocate encoder");
+        goto error;
+    }
+
+    encoder->options = *options;
+
+    encoder->enc = dmtxEncodeCreate();
+    if (encoder->enc == NULL)
+    {
+        log_error("Failed to create encoder");
+        goto error;
+    }
+
+    /* libdmtx always renders its own image of the symbol. We render from
+     * the module grid ourselves, so keep its image as small as possible -
+     * one pixel per module and no margin. */
+    dmtxEncodeSetProp(encoder->enc, DmtxPropPixelPacking, DmtxPack24bppRGB);
+    dmtxEncodeSetProp(encoder->enc, DmtxPropImageFlip, DmtxFlipNone);
+    dmtxEncodeSetProp(encoder->enc, DmtxPropRowPadBytes, 0);
+    dmtxEncodeSetProp(encoder->enc, DmtxPropMarginSize, 0);
+    dmtxEncodeSetProp(encoder->enc, DmtxPropModuleSize, 1);
+
+    /* Set encoding options. The scheme is set for each payload. */
+    dmtxEncodeSetProp(encoder->enc, DmtxPropSizeRequest, options->size_request);
+
+    return encoder;
+
+error:
+    datamatrix_encoder_destroy(encoder);
+
+    return NULL;
+}
+
+void datamatrix_encoder_destroy(struct datamatrix_encoder *encoder)
+{
+    if (encoder == NULL)
+        return;
+
+    if (encoder->enc != NULL)
+        dmtxEncodeDestroy(&encoder->enc);
+
+    free(encoder);
+}
+
+/* Each run of n digits makes n / 2 pairs, paired from its start. */
+static size_t count_digit_pairs(const unsigned char *data, size_t length)
+{
+    size_t pairs = 0;
+
+    for (size_t i = 0; i + 1 < length;)
+    {
+        if ((unsigned char)(data[i] - '0') < 10 && (unsigned char)(data[i + 1] - '0') < 10)
+        {
+            pairs++;
+            i += 2;
+        }
+        else
+        {
+            i++;
+        }
+    }
+
+    return pairs;
+}
+
+/* The class counts are one pass with no branches, where nothing but the
+ * sums carries from one character to the next, so the compiler can
+ * vectorise it. Pairing digits depends on the pairs before, so it's a
+ * pass of its own, and only made when there are digits to pair. */
+static void classify(const unsigned char *data, size_t length, struct payload_classes *classes)
+{
+    size_t digits = 0;
+    size_t upper = 0;
+    size_t lower = 0;
+    size_t space = 0;
+    size_t cr = 0;
+    size_t x12_marks = 0;
+    size_t edifact = 0;
+    size_t extended = 0;
+
+    for (size_t i = 0; i < length; i++)
+    {
+        unsigned char c = data[i];
+
+        digits += (unsigned char)(c - '0') < 10;
+        upper += (unsigned char)(c - 'A') < 26;
+        lower += (unsigned char)(c - 'a') < 26;
+        space += c == ' ';
+        cr += c == '\r';
+        x12_marks += (c == '*') | (c == '>');
+        edifact += (unsigned char)(c - 32) < 63;
+        extended += c >= 128;
+    }
+
+    classes->digits = digits;
+    classes->upper = upper;
+    classes->lower = lower;
+    classes->space = space;
+    classes->cr = cr;
+    classes->x12_marks = x12_marks;
+    classes->edifact = edifact;
+    classes->extended = extended;
+    classes->digit_pairs = digits >= 2 ? count_digit_pairs(data, length) : 0;
+}
+
+/* The first symbol of the shape asked for that holds words codewords, the
+ * same way libdmtx picks one, or -1 if none does. */
+static int smallest_symbol(int size_request, size_t words)
+{
+    int first = size_request == DmtxSymbolRectAuto ? DmtxSymbolSquareCount : 0;
+    int count = size_request == DmtxSymbolRectAuto ? DmtxSymbolRectCount : DmtxSymbolSquareCount;
+
+    for (int i = first; i < first + count; i++)
+    {
+        if ((size_t)symbol_layouts[i].data_words >= words)
+            return i;
+    }
+
+    return -1;
+}
+
+/* Codewords for n characters in C40, Text or X12 at best: a latch, two
+ * for every three, and one for each left over. Ending can take an unlatch
+ * as well, which libdmtx leaves out when the symbol is full. */
+static size_t triplet_words(size_t n)
+{
+    return 1 + 2 * (n / 3) + n % 3;
+}
+
+/* Picks a single scheme for the payload when it's sure to need a symbol no
+ * bigger than the full search would find, or DmtxSchemeAutoBest.
+ *
+ * Any encoding is either all ASCII, which can't beat ASCII's exact count,
+ * or latches out of ASCII at least once and still can't take fewer
+ * codewords than the cheapest each character can be. The lesser of the
+ * two is a bound nothing goes under, so a scheme whose symbol is the one
+ * that bound needs is as good as any. *size is that symbol, or -1 for a
+ * fixed size, which any scheme that fits it does as well in. The scheme
+ * is only a guess until the symbol it makes is checked against *size. */
+static int pick_scheme(
+    const struct datamatrix_options *options,
+    const unsigned char *data,
+    size_t length,
+    int *size)
+{
+    struct payload_classes c;
+    size_t triplets = 0;
+    size_t edifact_rest = 0;
+    size_t bytes = 0;
+    size_t bound = 0;
+    size_t words = 0;
+    int scheme = DmtxSchemeAscii;
+
+    *size = -1;
+
+    if (options->size_request == DmtxSymbolShapeAuto)
+        return DmtxSchemeAutoBest;
+
+    classify(data, length, &c);
+
+    triplets = c.upper + c.lower + c.space + c.cr + c.x12_marks;
+    edifact_rest = c.edifact - c.digits - c.upper - c.space - c.x12_marks;
+    bytes = length - c.digits - triplets - edifact_rest;
+
+    /* ASCII is exact: pairs of digits, two for anything past 127 and one
+     * for everything else. */
+    words = length - c.digit_pairs + c.extended;
+
+    /* A digit left over from pairing does no better than C40. */
+    bound = (COST_DIGIT_PAIR * c.digit_pairs + COST_TRIPLET * (c.digits - 2 * c.digit_pairs) +
+             COST_TRIPLET * triplets + COST_EDIFACT * edifact_rest + COST_BYTE * bytes + 11) /
+                12 +
+            1;
+
+    if (words < bound)
+        bound = words;
+
+    if (triplet_words(length) < words)
+    {
+        if (c.digits + c.upper + c.space == length)
+            scheme = DmtxSchemeC40;
+        else if (c.digits + c.lower + c.space == length)
+            scheme = DmtxSchemeText;
+        else if (c.digits + c.upper + c.space + c.cr + c.x12_marks == length)
+            scheme = DmtxSchemeX12;
+
+        if (scheme != DmtxSchemeAscii)
+            words = triplet_words(length);
+    }
+
+    if (options->size_request >= 0)
+        return scheme;
+
+    *size = smallest_symbol(options->size_request, bound);
+    if (*size < 0 || smallest_symbol(options->size_request, words) != *size)
+        return DmtxSchemeAutoBest;
+
+    return scheme;
+}
+
+/* dmtxEncodeDataMatrix releases the message and image from the previous
+ * call, so the context can be reused as-is. */
+static int encode_in(DmtxEncode *enc, int scheme, const unsigned char *data, size_t length)
+{
+    dmtxEncodeSetProp(enc, DmtxPropScheme, scheme);
+
+    return dmtxEncodeDataMatrix(enc, (int)length, (unsigned char *)data) == DmtxFail ? -EINVAL : 0;
+}
+
+int datamatrix_encode(
+    struct datamatrix_encoder *encoder,
+    const unsigned char *data,
+    size_t length,
+    struct datamatrix_symbol *symbol)
+{
+    DmtxEncode *enc = encoder->enc;
+    const struct symbol_layout *layout = NULL;
+    size_t needed = 0;
+    int scheme = encoder->options.scheme;
+    int size = -1;
+    int rc = 0;
+
+    if (length == 0 || length > INT_MAX)
+        return -EINVAL;
+
+    if (encoder->cache != NULL && symbol_cache_get(encoder->cache, &encoder->options, data, length, symbol) == 1)
+        return 1;
+
+    if (scheme == DmtxSchemeAutoBest && encoder->options.fast_scheme)
+        scheme = pick_scheme(&encoder->options, data, length, &size);
+
+    if (scheme != encoder->options.scheme)
+    {
+        rc = encode_in(enc, scheme, data, length);
+        if (rc == 0 && (size < 0 || enc->region.sizeIdx == size))
+            encoder->direct++;
+        else
+            scheme = encoder->options.scheme;
+    }
+
+    if (scheme == encoder->options.scheme)
+    {
+        rc = encode_in(enc, scheme, data, length);
+        if (rc < 0)
+            return rc;
+
+        if (scheme == DmtxSchemeAutoBest)
+            encoder->searched++;
+    }
+
+    layout = &symbol_layouts[enc->region.sizeIdx];
+
+    needed = (size_t)layout->rows * (size_t)layout->cols;
+    if (needed > symbol->capacity)
+    {
+        unsigned char *modules = (unsigned char *)realloc(symbol->modules, needed);
+        if (modules == NULL)
+            return -ENOMEM;
+
+        symbol->modules = modules;
+        symbol->capacity = needed;
+    }
+
+    symbol->size_idx = enc->region.sizeIdx;
+    symbol->rows = layout->rows;
+    symbol->cols = layout->cols;
+
+    /* Straight from the codewords, not libdmtx's mapping matrix. */
+    symbol_layout_draw(layout, enc->message->code, symbol->modules);
+
+    /* Failing to cache it doesn't stop the symbol being used. */
+    if (encoder->cache != NULL)
+        symbol_cache_put(encoder->cache, &encoder->options, data, length, symbol);
+
+    return 0;
+}
+
+void datamatrix_symbol_free(struct datamatrix_symbol *symbol)
+{
+    if (symbol->modules != NULL)
+        free(symbol->modules);
+
+    memset(symbol, 0, sizeof(*symbol));
+}
+
+int datamatrix_render(
+    const struct datamatrix_symbol *symbol,
+    int module_width,
+    int module_height,
+    int margin_size,
+    struct bitmap *bitmap)
+{
+    int rc = 0;
+    const struct expand_kernel *kernel = expand_kernel_best();
+    unsigned char stack[RENDER_STACK_WIDTH];
+    unsigned char *pixels = stack;
+
+    if (module_width < 1 || module_height < 1 || margin_size < 0)
+        return -EINVAL;
+
+    rc = bitmap_resize(
+        bitmap,
+        symbol->cols * module_width + 2 * margin_size,
+        symbol->rows * module_height + 2 * margin_size);
+    if (rc < 0)
+        return rc;
+
+    if (bitmap->width > RENDER_STACK_WIDTH)
+    {
+        pixels = (unsigned char *)malloc((size_t)bitmap->width);
+        if (pixels == NULL)
+            return -ENOMEM;
+    }
+
+    /* Expand each module row into a scanline once, then copy it down for
+     * the rest of the module's height. */
+    for (int row = 0; row < symbol->rows; row++)
+    {
+        int y = margin_size + row * module_height;
+        unsigned char *line = bitmap_row(bitmap, y);
+
+        kernel->expand_8bpp(
+            symbol->modules + (size_t)row * symbol->cols,
+            symbol->cols,
+            module_width,
+            margin_size,
+            pixels);
+        kernel->pack_1bpp(pixels, bitmap->width, line);
+
+        for (int i = 1; i < module_height; i++)
+            memcpy(bitmap_row(bitmap, y + i), line, bitmap->stride);
+    }
+
+    if (pixels != stack)
+        free(pixels);
+
+    return 0;
+}
+
+int datamatrix_write_pbm(
+    FILE *out,
+    const struct datamatrix_symbol *symbol,
+    int module_size,
+    int margin_size)
+{
+    int rc = 0;
+    struct bitmap bitmap = {0};
+    size_t stride = 0;
+    int written = 0;
+
+    rc = datamatrix_render(symbol, module_size, module_size, margin_size, &bitmap);
+    if (rc < 0)
+        goto exit;
+
+    written = fprintf(out, "P4\n%d %d\n", bitmap.width, bitmap.height);
+    if (written < 0)
+    {
+        rc = -EIO;
+        goto exit;
+    }
+
+    /* PBM rows are only padded to a byte. */
+    stride = ((size_t)bitmap.width + 7) / 8;
+
+    for (int y = 0; y < bitmap.height; y++)
+    {
+        if (fwrite(bitmap_row(&bitmap, y), 1, stride, out) != stride)
+        {
+            rc = -EIO;
+            goto exit;
+        }
+    }
+
+    rc = written + (int)(stride * (size_t)bitmap.height);
+
+exit:
+    bitmap_free(&bitmap);
+
+    return rc;
+}
+
+int datamatrix_module_height(const struct print_session *session, int module_size)
+{
+    /* module_size is in pixels across; keep the modules square on a
+     * printer whose resolution differs in each direction. */
+    int module_height = (module_size * session->dpi_y + session->dpi_x / 2) / session->dpi_x;
+
+    return module_height > 0 ? module_height : 1;
+}
+
+int datamatrix_place(
+    struct print_session *session,
+    const struct rect *cell,
+    const struct bitmap *bitmap)
+{
+    const struct coordinate_space *space = &session->space;
+    struct rect r;
+
+    /* One bitmap pixel to each device pixel. */
+    int width = (int)((long long)bitmap->width * space->logical.width / space->device.width);
+    int height = (int)((long long)bitmap->height * space->logical.height / space->device.height);
+
+    r.left = cell->left + (cell->right - cell->left - width) / 2;
+    r.top = cell->top + (cell->bottom - cell->top - height) / 2;
+    r.right = r.left + width;
+    r.bottom = r.top + height;
+
+    return session->backend->draw_bitmap(session, &r, bitmap);
+}
+
+int datamatrix_draw(
+    struct print_session *session,
+    const struct datamatrix_symbol *symbol,
+    const struct rect *cell,
+    int module_size,
+    struct bitmap *bitmap)
+{
+    int rc = datamatrix_render(
+        symbol, module_size, datamatrix_module_height(session, module_size), 0, bitmap);
+
+    if (rc < 0)
+        return rc;
+
+    return datamatrix_place(session, cell, bitmap);
+}
@@ -0,0 +1,123 @@
+#ifndef DATAMATRIX_H
+#define DATAMATRIX_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include <dmtx.h>
+
+#include "bitmap.h"
+
+/* Encoding settings shared by every symbol an encoder produces. */
+struct datamatrix_options
+{
+    int scheme;
+    int size_request;
+    int module_size;
+    int margin_size;
+
+    /* With DmtxSchemeAutoBest, payloads that one scheme provably fits in
+     * the smallest symbol any scheme could are encoded in that scheme
+     * straight away, skipping libdmtx's search over all of them. */
+    int fast_scheme;
+};
+
+#define DATAMATRIX_OPTIONS_DEFAULT            \
+    {                                         \
+        .scheme = DmtxSchemeAutoBest,         \
+        .size_request = DmtxSymbolSquareAuto, \
+        .module_size = 5,                     \
+        .margin_size = 10,                    \
+        .fast_scheme = 1,                     \
+    }
+
+struct symbol_cache;
+
+/* An encoder owns one libdmtx context and is reused for every payload, so
+ * the properties are only set once. Not thread safe - use one per thread,
+ * though they can share a symbol cache. */
+struct datamatrix_encoder
+{
+    DmtxEncode *enc;
+    struct datamatrix_options options;
+
+    /* Optional. Checked before encoding and filled in after. */
+    struct symbol_cache *cache;
+
+    /* Payloads encoded straight in the scheme picked for them, and those
+     * that needed the full search. */
+    uint64_t direct;
+    uint64_t searched;
+};
+
+/* The module grid of an encoded symbol. Modules are stored one byte each,
+ * top row first, non-zero for a dark module. The buffer is kept between
+ * encodes and only grows. */
+struct datamatrix_symbol
+{
+    int size_idx;
+    int rows;
+    int cols;
+    unsigned char *modules;
+    size_t capacity;
+};
+
+struct datamatrix_encoder *datamatrix_encoder_create(
+    const struct datamatrix_options *options);
+
+void datamatrix_encoder_destroy(struct datamatrix_encoder *encoder);
+
+/* Returns 1 if the symbol came from the cache, 0 if it was encoded or a
+ * negative errno. */
+int datamatrix_encode(
+    struct datamatrix_encoder *encoder,
+    const unsigned char *data,
+    size_t length,
+    struct datamatrix_symbol *symbol);
+
+void datamatrix_symbol_free(struct datamatrix_symbol *symbol);
+
+/* Renders the symbol at module_width x module_height pixels per module
+ * with a blank margin all round. */
+int datamatrix_render(
+    const struct datamatrix_symbol *symbol,
+    int module_width,
+    int module_height,
+    int margin_size,
+    struct bitmap *bitmap);
+
+/* Writes the symbol as a binary PBM (P4) frame, scaled by the module size
+ * and surrounded by the margin. Frames can be concatenated into a stream.
+ * Returns the number of octets written or a negative errno. */
+int datamatrix_write_pbm(
+    FILE *out,
+    const struct datamatrix_symbol *symbol,
+    int module_size,
+    int margin_size);
+
+struct print_session;
+struct rect;
+
+/* The module height in device pixels that keeps modules module_size pixels
+ * across square on the session's printer. */
+int datamatrix_module_height(const struct print_session *session, int module_size);
+
+/* Draws a rendered symbol centred in a cell on the current page, one
+ * bitmap pixel to a device pixel. */
+int datamatrix_place(
+    struct print_session *session,
+    const struct rect *cell,
+    const struct bitmap *bitmap);
+
+/* Draws the symbol centred in a cell on the current page as a bitmap at the
+ * printer's resolution, with modules module_size device pixels across.
+ * bitmap is scratch space that can be reused between calls. */
+int datamatrix_draw(
+    struct print_session *session,
+    const struct datamatrix_symbol *symbol,
+    const struct rect *cell,
+    int module_size,
+    struct bitmap *bitmap);
+
+#endif /* DATAMATRIX_H */
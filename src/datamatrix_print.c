@@ -1,33 +1,33 @@
-#include <windows.h>
-#include <winspool.h>
+#include <errno.h>
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 
 #include <dmtx.h>
 
-/* Copied from dmtxwrite. */
+#include "caps_cache.h"
+#include "datamatrix.h"
+#include "document_builder.h"
+#include "label_batch.h"
+#include "log.h"
+#include "print_backend.h"
+#include "raster.h"
+#include "symbol_cache.h"
+
+#define DEFAULT_CACHE_MB 32
+
 static int
-dump_ascii(DmtxEncode *enc)
+dump_ascii(const struct datamatrix_symbol *symbol)
 {
-    int symbolRow, symbolCol;
+    const unsigned char *modules = symbol->modules;
 
     fputc('\n', stdout);
 
-    /* ASCII prints from top to bottom */
-    for (symbolRow = enc->region.symbolRows - 1; symbolRow >= 0; symbolRow--)
+    for (int row = 0; row < symbol->rows; row++)
     {
         fputs("    ", stdout);
-        for (symbolCol = 0; symbolCol < enc->region.symbolCols; symbolCol++)
-        {
-            fputs((dmtxSymbolModuleStatus(
-                       enc->message,
-                       enc->region.sizeIdx,
-                       symbolRow,
-                       symbolCol) &
-                   DmtxModuleOnRGB)
-                      ? "XX"
-                      : "  ",
-                  stdout);
-        }
+        for (int col = 0; col < symbol->cols; col++)
+            fputs(*modules++ ? "XX" : "  ", stdout);
         fputs("\n", stdout);
     }
 
@@ -39,62 +39,367 @@ dump_ascii(DmtxEncode *enc)
 int make_datamatrix(const char *data)
 {
     int rc;
-    DmtxEncode *enc;
+    const struct datamatrix_options options = DATAMATRIX_OPTIONS_DEFAULT;
+    struct datamatrix_encoder *encoder = NULL;
+    struct datamatrix_symbol symbol = {0};
 
-    enc = dmtxEncodeCreate();
-    if (enc == NULL)
+    encoder = datamatrix_encoder_create(&options);
+    if (encoder == NULL)
     {
-        printf("Failed to create encoder\n");
+        log_error("Failed to create encoder");
         rc = -EINVAL;
         goto exit;
     }
 
-    /* Set output image properties */
-    dmtxEncodeSetProp(enc, DmtxPropPixelPacking, DmtxPack24bppRGB);
-    dmtxEncodeSetProp(enc, DmtxPropImageFlip, DmtxFlipNone);
-    dmtxEncodeSetProp(enc, DmtxPropRowPadBytes, 0);
+    rc = datamatrix_encode(encoder, (const unsigned char *)data, strlen(data), &symbol);
+    if (rc < 0)
+    {
+        log_error("Failed to encode data");
+        goto exit;
+    }
+
+    dump_ascii(&symbol);
+
+exit:
+    datamatrix_symbol_free(&symbol);
+    datamatrix_encoder_destroy(encoder);
+
+    return rc;
+}
+
+/* Where a batch goes when it's printed rather than only encoded. */
+struct batch_printer
+{
+    const char *printer_name;
+    const char *backend_name;
+    const char *paper_name;
+    int raster;
+    size_t band_bytes;
+    int raster_threads;
+    int compress;
+    struct document_options document;
+};
+
+static int open_printer(
+    const struct batch_printer *target,
+    struct print_session **session,
+    struct document_builder **document)
+{
+    int rc = 0;
+    const struct print_backend *backend = NULL;
+    struct caps_cache *cache = NULL;
+    const struct cached_printer *printer = NULL;
+    struct session_options options = {
+        .paper_name = target->paper_name,
+        .raster = target->raster,
+        .band_bytes = target->band_bytes,
+        .raster_threads = target->raster_threads,
+        .compress = target->compress,
+    };
+
+    backend = print_backend_find(target->backend_name);
+    if (backend == NULL)
+        return -EINVAL;
+
+    cache = caps_cache_open(NULL);
+    if (cache == NULL)
+        return -ENOMEM;
+
+    rc = caps_cache_get(cache, backend, target->printer_name, &printer);
+    if (rc < 0)
+        goto exit;
+
+    /* Label printers usually only have the one paper, so default to it. */
+    if (options.paper_name == NULL)
+    {
+        if (printer->caps.paper_count == 0)
+        {
+            log_error("Printer has no papers");
+            rc = -ENOENT;
+            goto exit;
+        }
+
+        options.paper = &printer->caps.papers[0];
+        options.paper_name = options.paper->name;
+    }
+    else
+    {
+        options.paper = cached_printer_find_paper(printer, options.paper_name, NULL);
+    }
+
+    rc = backend->open_session(target->printer_name, &options, session);
+    if (rc < 0)
+    {
+        log_error("Failed to open print session");
+        goto exit;
+    }
+
+    caps_cache_set_geometry(cache, target->printer_name, *session);
 
-    /* Set encoding options */
-    dmtxEncodeSetProp(enc, DmtxPropMarginSize, 10);
-    dmtxEncodeSetProp(enc, DmtxPropModuleSize, 5);
-    dmtxEncodeSetProp(enc, DmtxPropScheme, DmtxSchemeAutoBest);
-    dmtxEncodeSetProp(enc, DmtxPropSizeRequest, DmtxSymbolSquareAuto);
+    printf(
+        "Printing to \"%s\" on %s, %dx%d labels per page\n",
+        target->printer_name,
+        (*session)->paper.name,
+        target->document.columns,
+        target->document.rows);
 
-    rc = dmtxEncodeDataMatrix(enc, strlen(data), (unsigned char *)data);
-    if (rc == DmtxFail)
+    *document = document_builder_create(*session, &target->document);
+    if (*document == NULL)
     {
-        printf("Failed to encode data\n");
+        print_session_close(*session);
+        *session = NULL;
         rc = -EINVAL;
         goto exit;
     }
 
-    dump_ascii(enc);
+exit:
+    caps_cache_close(cache);
+
+    return rc;
+}
+
+int make_datamatrix_batch(
+    const char *input_path,
+    enum payload_format format,
+    int threads,
+    const char *output_path,
+    const struct batch_printer *target,
+    size_t cache_budget)
+{
+    int rc;
+    const struct datamatrix_options options = DATAMATRIX_OPTIONS_DEFAULT;
+    struct payload_reader reader = {0};
+    struct batch_stats stats = {0};
+    FILE *out = NULL;
+    struct print_session *session = NULL;
+    struct document_builder *document = NULL;
+    struct symbol_cache *cache = NULL;
+
+    rc = payload_reader_open(&reader, input_path, format);
+    if (rc < 0)
+    {
+        log_error("Failed to open payloads");
+        goto exit;
+    }
+
+    if (output_path != NULL)
+    {
+        out = fopen(output_path, "wb");
+        if (out == NULL)
+        {
+            log_error("Failed to open \"%s\"", output_path);
+            rc = -EINVAL;
+            goto exit;
+        }
+    }
+
+    if (target != NULL)
+    {
+        rc = open_printer(target, &session, &document);
+        if (rc < 0)
+        {
+            log_error("Failed to open printer");
+            goto exit;
+        }
+    }
+
+    if (cache_budget > 0)
+    {
+        cache = symbol_cache_create(cache_budget);
+        if (cache == NULL)
+        {
+            rc = -ENOMEM;
+            goto exit;
+        }
+    }
+
+    rc = run_batch(&reader, &options, threads, out, document, cache, &stats);
+    if (rc < 0)
+    {
+        log_warn("Batch stopped early");
+    }
+
+    print_batch_stats(&stats);
+
+    if (document != NULL)
+    {
+        struct document_stats printed;
+
+        document_builder_get_stats(document, &printed);
+        printf(
+            "Printed: %llu labels on %llu pages in %llu documents\n",
+            (unsigned long long)printed.labels,
+            (unsigned long long)printed.pages,
+            (unsigned long long)printed.documents);
+
+        print_raster_stats(&session->raster_stats);
+    }
+
+    if (cache != NULL)
+    {
+        struct symbol_cache_stats cached;
+
+        symbol_cache_get_stats(cache, &cached);
+        print_symbol_cache_stats(&cached);
+    }
 
 exit:
-    if (enc != NULL)
-        dmtxEncodeDestroy(&enc);
+    symbol_cache_destroy(cache);
+    document_builder_destroy(document);
+
+    if (session != NULL)
+        print_session_close(session);
+
+    if (out != NULL)
+        fclose(out);
+
+    payload_reader_close(&reader);
+
+    return rc;
+}
+
+static void usage(const char *name)
+{
+    printf("Usage: %s <printer name> [options]\n", name);
+    printf("  --batch <file>       Encode every payload in file (\"-\" for stdin)\n");
+    printf("  --length-prefixed    Payloads are prefixed by a 32 bit big-endian\n");
+    printf("                       length instead of one per line\n");
+    printf("  --output <file>      Write the rendered symbols as a PBM stream\n");
+    printf("  --threads <n>        Encode on n threads (default: one per CPU)\n");
+    printf("  --cache-mb <n>       Keep up to n MB of repeated symbols (default: %d,\n", DEFAULT_CACHE_MB);
+    printf("                       0 to turn the cache off)\n");
+    printf("  --print              Print the batch on the printer\n");
+    printf("  --backend <name>     Print backend (default: the platform's)\n");
+    printf("  --paper <name>       Paper to print on (default: the printer's first)\n");
+    printf("  --grid <cols>x<rows> Labels per page (default: 1x1)\n");
+    printf("  --raster             Send the printer rastered 1bpp pages\n");
+    printf("  --band-kb <n>        Raster at most n KB of the page at a time\n");
+    printf("  --raster-threads <n> Raster bands on n threads (0 for one per CPU)\n");
+    printf("  --compress           Compress rastered rows where the backend sends them\n");
+    printf("  --flush-labels <n>   End each print job after n labels (default: 500)\n");
+    printf("  --flush-bytes <n>    ... or once it holds about n octets\n");
+    printf("  --flush-ms <n>       ... or once it's n ms old\n");
 }
 
 int main(int argc, char **argv)
 {
     int rc;
     const char *printer_name = NULL;
+    const char *batch_path = NULL;
+    const char *output_path = NULL;
+    enum payload_format format = PAYLOAD_FORMAT_LINES;
+    int threads = 0;
+    int print = 0;
+    size_t cache_mb = DEFAULT_CACHE_MB;
+    struct batch_printer target = {
+        .document = DOCUMENT_OPTIONS_DEFAULT,
+    };
 
     const char *sample_data = "0123456789abcde";
 
-    if (argc != 2)
+    if (argc < 2)
     {
-        printf("Usage: %s <printer name>\n", argv[0]);
+        usage(argv[0]);
         return -EINVAL;
     }
 
     printer_name = argv[1];
+    target.printer_name = printer_name;
 
-    printf("Generating datamatrix for: %s\n", sample_data);
-    rc = make_datamatrix(sample_data);
-    if (rc < 0)
+    for (int i = 2; i < argc; i++)
     {
-        printf("Failed to generate datamatrix\n");
+        if (strcmp(argv[i], "--batch") == 0 && i + 1 < argc)
+        {
+            batch_path = argv[++i];
+        }
+        else if (strcmp(argv[i], "--length-prefixed") == 0)
+        {
+            format = PAYLOAD_FORMAT_LENGTH_PREFIXED;
+        }
+        else if (strcmp(argv[i], "--output") == 0 && i + 1 < argc)
+        {
+            output_path = argv[++i];
+        }
+        else if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc)
+        {
+            threads = atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--cache-mb") == 0 && i + 1 < argc)
+        {
+            cache_mb = strtoul(argv[++i], NULL, 10);
+        }
+        else if (strcmp(argv[i], "--print") == 0)
+        {
+            print = 1;
+        }
+        else if (strcmp(argv[i], "--backend") == 0 && i + 1 < argc)
+        {
+            target.backend_name = argv[++i];
+        }
+        else if (strcmp(argv[i], "--paper") == 0 && i + 1 < argc)
+        {
+            target.paper_name = argv[++i];
+        }
+        else if (strcmp(argv[i], "--grid") == 0 && i + 1 < argc &&
+                 sscanf(argv[i + 1], "%dx%d", &target.document.columns, &target.document.rows) == 2)
+        {
+            i++;
+        }
+        else if (strcmp(argv[i], "--raster") == 0)
+        {
+            target.raster = 1;
+        }
+        else if (strcmp(argv[i], "--band-kb") == 0 && i + 1 < argc)
+        {
+            target.band_bytes = strtoul(argv[++i], NULL, 10) << 10;
+        }
+        else if (strcmp(argv[i], "--raster-threads") == 0 && i + 1 < argc)
+        {
+            target.raster_threads = atoi(argv[++i]);
+            if (target.raster_threads == 0)
+                target.raster_threads = -1;
+        }
+        else if (strcmp(argv[i], "--compress") == 0)
+        {
+            target.compress = 1;
+        }
+        else if (strcmp(argv[i], "--flush-labels") == 0 && i + 1 < argc)
+        {
+            target.document.flush.max_labels = atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--flush-bytes") == 0 && i + 1 < argc)
+        {
+            target.document.flush.max_bytes = strtoul(argv[++i], NULL, 10);
+        }
+        else if (strcmp(argv[i], "--flush-ms") == 0 && i + 1 < argc)
+        {
+            target.document.flush.max_age_ns = strtoull(argv[++i], NULL, 10) * 1000000ull;
+        }
+        else
+        {
+            usage(argv[0]);
+            return -EINVAL;
+        }
+    }
+
+    if (batch_path != NULL)
+    {
+        printf("Generating datamatrix batch from: %s\n", batch_path);
+        rc = make_datamatrix_batch(
+            batch_path, format, threads, output_path, print ? &target : NULL, cache_mb << 20);
+        if (rc < 0)
+        {
+            log_error("Failed to generate datamatrix batch");
+        }
+    }
+    else
+    {
+        printf("Generating datamatrix for: %s\n", sample_data);
+        rc = make_datamatrix(sample_data);
+        if (rc < 0)
+        {
+            log_error("Failed to generate datamatrix");
+        }
     }
 
     fflush(stdout);
@@ -1,572 +1,486 @@
-#include "windows.h"
-#include "winspool.h"
 #include "errno.h"
 #include "stdio.h"
+#include "stdlib.h"
+#include "string.h"
+
+#include "caps_cache.h"
+#include "display_list.h"
+#include "log.h"
+#include "print_backend.h"
+#include "print_queue.h"
+#include "printer_pool.h"
+#include "raster.h"
+#include "timing.h"
+#include "trace.h"
 
 static const char *A4_PAGE_NAME = "A4";
 
-struct page_details
-{
-    short size;
-    POINT dimensions;
-    char name[64];
-};
+/* Jobs that may wait for the print thread with --async. */
+#define ASYNC_QUEUE_JOBS 4
 
-struct coordinate_space
-{
-    struct
-    {
-        int width;
-        int height;
-        int offset_x;
-        int offset_y;
-    } logical;
+static const struct rect layout_box = {100, 100, 1100, 1100};
+static const struct point layout_arrow[] = {{800, 400}, {950, 450}, {800, 500}};
 
-    struct
-    {
-        int width;
-        int height;
-        int offset_x;
-        int offset_y;
-    } device;
-};
-
-struct page_details *get_page_details(const char *printer_name, const char *page_name)
+/* The parts of the label that are the same on every document. */
+static int draw_layout(struct print_session *session)
 {
-    int rc = 0;
-    int count = 0;
-    short *sizes = NULL;
-    POINT *dimensions = NULL;
-    char *page_names = NULL;
-
-    struct page_details *details = NULL;
-
-    count = DeviceCapabilities(printer_name, NULL, DC_PAPERS, NULL, NULL);
-    if (count <= 0)
-    {
-        printf("Failed to get page sizes\n");
-        rc = -EINVAL;
-        goto exit;
-    }
-
-    sizes = (short *)malloc(count * sizeof(short));
-    if (sizes == NULL)
-    {
-        printf("Failed to allocate memory\n");
-        rc = -ENOMEM;
-        goto exit;
-    }
-
-    if (DeviceCapabilities(printer_name, NULL, DC_PAPERS, (char *)sizes, NULL) <= 0)
-    {
-        printf("Failed to get page sizes\n");
-        rc = -EINVAL;
-        goto exit;
-    }
+    const struct print_backend *backend = session->backend;
+    const struct rect *r = &layout_box;
 
-    dimensions = (POINT *)malloc(count * sizeof(POINT));
-    if (dimensions == NULL)
-    {
-        printf("Failed to allocate memory\n");
-        rc = -ENOMEM;
-        goto exit;
-    }
+    printf("  Rectangle (1/10 mm) (%d,%d),(%d,%d)\n", r->left, r->top, r->right, r->bottom);
 
-    if (DeviceCapabilities(printer_name, NULL, DC_PAPERSIZE, (char *)dimensions, NULL) <= 0)
-    {
-        printf("Failed to get page dimensions\n");
-        rc = -EINVAL;
-        goto exit;
-    }
-
-    page_names = (char *)malloc(count * 64);
-    if (page_names == NULL)
-    {
-        printf("Failed to allocate memory\n");
-        rc = -ENOMEM;
-        goto exit;
-    }
+    if (backend->draw_rect(session, r) < 0 ||
+        backend->draw_line(session, r->left, 300, r->right, 300) < 0 ||
+        backend->draw_text(session, 150, 150, 100, "DEMO PRINT") < 0 ||
+        backend->fill_polygon(session, layout_arrow, 3) < 0)
+        return -EINVAL;
 
-    if (DeviceCapabilities(printer_name, NULL, DC_PAPERNAMES, page_names, NULL) <= 0)
-    {
-        printf("Failed to get page names\n");
-        rc = -EINVAL;
-        goto exit;
-    }
+    return 0;
+}
 
-    for (int i = 0; i < count; i++)
-    {
-        const char *name = page_names + (i * 64);
-        if (strcmp(name, page_name) == 0)
-        {
-            details = (struct page_details *)malloc(sizeof(struct page_details));
-            if (details == NULL)
-            {
-                printf("Failed to allocate memory\n");
-                rc = -ENOMEM;
-                goto exit;
-            }
-
-            details->size = sizes[i];
-            details->dimensions = dimensions[i];
-            strncpy(details->name, name, sizeof(details->name));
-            break;
-        }
-    }
+/* The same layout, recorded straight into a list for the print queue. */
+static int record_layout(struct display_list *list)
+{
+    const struct rect *r = &layout_box;
 
-exit:
-    if (sizes != NULL)
-        free(sizes);
+    if (display_list_rect(list, r) < 0 ||
+        display_list_line(list, r->left, 300, r->right, 300) < 0 ||
+        display_list_text(list, 150, 150, 100, "DEMO PRINT") < 0 ||
+        display_list_polygon(list, layout_arrow, 3) < 0)
+        return -ENOMEM;
 
-    if (dimensions != NULL)
-        free(dimensions);
+    return 0;
+}
 
-    if (page_names != NULL)
-        free(page_names);
+/* The fields that change from one document to the next. */
+static int draw_fields(struct print_session *session, int document)
+{
+    char text[32];
 
-    if (rc < 0)
-        errno = rc;
+    snprintf(text, sizeof(text), "Document %d", document + 1);
 
-    return details;
+    return session->backend->draw_text(session, 150, 400, 60, text);
 }
 
-int set_page_size(
-    const char *printer_name,
-    const struct page_details *details,
-    DEVMODE **devmode)
+/* Templates are handed to other threads and processes as buffers. Send
+ * the layout through one to check it survives the trip. */
+static int reload_template(struct print_session *session, struct page_template **page_template)
 {
     int rc = 0;
-    HANDLE printer = NULL;
-    int devmode_size = 0;
-
-    *devmode = NULL;
+    const struct print_backend *backend = session->backend;
+    struct page_template *loaded = NULL;
+    void *data = NULL;
+    size_t size = 0;
 
-    printf(
-        "Setting page size on \"%s\" to: \"%s\"\n",
-        printer_name,
-        details->name);
+    rc = backend->serialise_template(*page_template, &data, &size);
+    if (rc < 0)
+        return rc;
 
-    if (OpenPrinter((char *)printer_name, &printer, NULL) == 0)
-    {
-        printf("Failed to open printer\n");
-        rc = -EINVAL;
-        goto exit;
-    }
+    rc = backend->deserialise_template(session, data, size, &loaded);
+    free(data);
 
-    devmode_size = DocumentProperties(
-        NULL, printer, (char *)printer_name, NULL, NULL, 0);
+    if (rc < 0)
+        return rc;
 
-    if (devmode_size <= 0)
-    {
-        printf("Failed to get printer properties size\n");
-        rc = -EINVAL;
-        goto exit;
-    }
+    printf("Layout template: %lu octets\n", (unsigned long)size);
 
-    *devmode = (DEVMODE *)malloc(devmode_size);
-    if (*devmode == NULL)
-    {
-        printf("Failed to allocate %u octets\n", devmode_size);
-        rc = -ENOMEM;
-        goto exit;
-    }
+    backend->free_template(*page_template);
+    *page_template = loaded;
 
-    if (DocumentProperties(
-            NULL,
-            printer,
-            (char *)printer_name,
-            *devmode,
-            NULL,
-            DM_OUT_BUFFER) != IDOK)
-    {
-        printf("Failed to get printer properties\n");
-        rc = -EINVAL;
-        goto exit;
-    }
+    return 0;
+}
 
-    (*devmode)->dmPaperSize = details->size;
-    (*devmode)->dmOrientation = DMORIENT_PORTRAIT;
+/* A whole document's page, as draw_layout() and draw_fields() draw it. */
+static int record_document(struct display_list *page, const struct display_list *layout, int document)
+{
+    char text[32];
 
-    if (DocumentProperties(
-            NULL,
-            printer,
-            (char *)printer_name,
-            *devmode,
-            *devmode,
-            DM_IN_BUFFER | DM_OUT_BUFFER) != IDOK)
-    {
-        printf("Failed to set printer properties\n");
-        rc = -EINVAL;
-        goto exit;
-    }
+    snprintf(text, sizeof(text), "Document %d", document + 1);
 
-    if (ClosePrinter(printer) == 0)
-    {
-        printf("Failed to close printer\n");
-        rc = -EINVAL;
-        goto exit;
-    }
+    if (display_list_append(page, layout, 0, 0) < 0 || display_list_text(page, 150, 400, 60, text) < 0)
+        return -ENOMEM;
 
     return 0;
-
-exit:
-    if (printer != NULL)
-        ClosePrinter(printer);
-
-    if (*devmode == NULL)
-        free(*devmode);
-
-    return rc;
 }
 
-void draw(HDC printer, const struct coordinate_space *space)
+static void job_done(struct print_job *job, void *context)
 {
-    POINT p[2] = {{100, 100}, {1100, 1100}};
-
-    printf("  Rectangle (1/10 mm) (%d,%d),(%d,%d)\n", p[0].x, p[0].y, p[1].x, p[1].y);
-    Rectangle(printer, 100, 100, 1100, 1100);
+    (void)context;
 
-    LPtoDP(printer, p, 2);
-    printf("  Rectangle (pixels) (%d,%d),(%d,%d)\n", p[0].x, p[0].y, p[1].x, p[1].y);
+    printf(
+        "  Job %llu %s\n",
+        (unsigned long long)print_job_id(job),
+        print_job_state_name(print_job_state(job)));
 }
 
-HENHMETAFILE draw_document(int width_mm_10, int height_mm_10)
+/* Records each document on this thread and leaves the printing to the
+ * queue's. Only the last job's handle is kept, to wait on; the rest report
+ * through job_done(). */
+static int demo_print_async(
+    const struct print_backend *backend,
+    const char *printer_name,
+    const struct session_options *options,
+    int documents)
 {
-    const char *EMF_FILE_NAME = "OUTPUT.emf";
-
-    HENHMETAFILE emf = NULL;
-    HDC canvas = NULL;
-
-    /* We want to keep this document with consistent units! */
-    const struct coordinate_space space = {
-        .logical.width = width_mm_10,
-        .logical.height = height_mm_10,
-        .device.width = width_mm_10,
-        .device.height = height_mm_10,
-    };
-
-    canvas = CreateEnhMetaFile(NULL, EMF_FILE_NAME, NULL, NULL);
-    if (canvas == NULL)
-    {
-        printf("Failed to create canvas\n");
-        goto exit;
-    }
-
-    if (SetMapMode(canvas, MM_ISOTROPIC) == 0)
-    {
-        printf("Failed to set map mode\n");
+    int rc = 0;
+    struct print_queue *queue = NULL;
+    struct print_job *last = NULL;
+    struct display_list layout = {0};
+    struct print_queue_stats stats;
+    uint64_t start_ns = 0;
+    uint64_t submit_ns = 0;
+
+    rc = print_queue_create(backend, printer_name, options, ASYNC_QUEUE_JOBS, &queue);
+    if (rc < 0)
         goto exit;
-    }
 
-    if (SetWindowExtEx(
-            canvas, space.logical.width, space.logical.height, NULL) == 0)
-    {
-        printf("Failed to set window extents\n");
-        goto exit;
-    }
-
-    if (SetViewportExtEx(
-            canvas, space.device.width, space.device.height, NULL) == 0)
+    rc = record_layout(&layout);
+    if (rc < 0)
     {
-        printf("Failed to set viewport extents\n");
+        log_error("Failed to record layout");
         goto exit;
     }
 
-    /* Draw the document. */
-    draw(canvas, &space);
+    start_ns = timing_now_ns();
 
-    emf = CloseEnhMetaFile(canvas);
-    if (emf == NULL)
+    for (int i = 0; i < documents; i++)
     {
-        printf("Failed to close metafile\n");
-    }
+        struct display_list page = {0};
 
-exit:
-    if (canvas != NULL)
-        DeleteDC(canvas);
+        rc = record_document(&page, &layout, i);
+        if (rc >= 0)
+            rc = print_queue_submit(
+                queue,
+                "DEMO_PRINT",
+                &page,
+                1,
+                job_done,
+                NULL,
+                1,
+                i == documents - 1 ? &last : NULL);
 
-    return emf;
-}
+        display_list_free(&page);
 
-int direct_print(HDC printer, const struct coordinate_space *space)
-{
-    int rc = 0;
-
-    if (SaveDC(printer) == 0)
-    {
-        printf("Failed to save DC\n");
-        rc = -EINVAL;
-        goto exit;
-    }
-
-    /* We want to ensure symmetric scaling. */
-    if (SetMapMode(printer, MM_ISOTROPIC) == 0)
-    {
-        printf("Failed to set map mode\n");
-        rc = -EINVAL;
-        goto exit;
+        if (rc < 0)
+        {
+            log_error("Failed to queue document");
+            goto exit;
+        }
     }
 
-    /* Set up logical and device coordinate systems. */
-    if (SetWindowExtEx(printer, space->logical.width, space->logical.height, NULL) == 0)
-    {
-        printf("Failed to set window extents\n");
-        rc = -EINVAL;
-        goto exit;
-    }
+    submit_ns = timing_now_ns() - start_ns;
 
-    if (SetViewportExtEx(printer, space->device.width, space->device.height, NULL) == 0)
-    {
-        printf("Failed to set viewport extents\n");
-        rc = -EINVAL;
-        goto exit;
-    }
+    rc = print_job_wait(last);
+    print_job_release(last);
+    print_queue_drain(queue);
 
-    if (SetViewportOrgEx(printer, 0, 0, NULL) == 0)
-    {
-        printf("Failed to set viewport origin\n");
-        rc = -EINVAL;
-        goto exit;
-    }
+    printf(
+        "Queued %d documents in %.3f ms, all printed after %.3f ms\n",
+        documents,
+        timing_ns_to_s(submit_ns) * 1e3,
+        timing_ns_to_s(timing_now_ns() - start_ns) * 1e3);
 
-    /* Draw what we want to print. */
-    draw(printer, space);
+    print_queue_get_stats(queue, &stats);
+    print_queue_print_stats(&stats);
 
-    if (RestoreDC(printer, -1) == 0)
+    if (rc < 0 || stats.failed > 0)
     {
-        printf("Failed to restore DC\n");
-        rc = -EINVAL;
+        log_error("Failed to print every document");
+        rc = rc < 0 ? rc : -EIO;
         goto exit;
     }
 
+    printf("Print job complete!\n");
+
 exit:
+    print_queue_destroy(queue);
+    display_list_free(&layout);
+
     return rc;
 }
 
-int print_emf(HDC printer, HENHMETAFILE emf, const struct coordinate_space *space)
+/* Shares the documents out over a pool of printers, document i on stream
+ * i % streams. */
+static int demo_print_pool(
+    const struct print_backend *backend,
+    const char *printers,
+    const struct session_options *options,
+    int documents,
+    int streams)
 {
     int rc = 0;
-    ENHMETAHEADER header = {0};
+    struct printer_pool *pool = NULL;
+    struct display_list layout = {0};
+    struct printer_pool_stats stats;
+    uint64_t start_ns = 0;
+    uint64_t elapsed_ns = 0;
 
-    if (GetEnhMetaFileHeader(emf, sizeof(header), &header) == 0)
-    {
-        printf("Failed to get metafile header\n");
-        rc = -EINVAL;
+    rc = printer_pool_create(backend, printers, options, ASYNC_QUEUE_JOBS, &pool);
+    if (rc < 0)
         goto exit;
-    }
 
-    if (SaveDC(printer) == 0)
+    rc = record_layout(&layout);
+    if (rc < 0)
     {
-        printf("Failed to save DC\n");
-        rc = -EINVAL;
+        log_error("Failed to record layout");
         goto exit;
     }
 
-    if (SetMapMode(printer, MM_ISOTROPIC) == 0)
-    {
-        printf("Failed to set map mode\n");
-        rc = -EINVAL;
-        goto exit;
-    }
+    start_ns = timing_now_ns();
 
-    if (SetWindowExtEx(
-            printer, space->logical.width, space->logical.height, NULL) == 0)
+    for (int i = 0; i < documents; i++)
     {
-        printf("Failed to set window extents\n");
-        rc = -EINVAL;
-        goto exit;
-    }
+        struct display_list page = {0};
 
-    if (SetViewportExtEx(
-            printer, space->device.width, space->device.height, NULL) == 0)
-    {
-        printf("Failed to set viewport extents\n");
-        rc = -EINVAL;
-        goto exit;
+        rc = record_document(&page, &layout, i);
+        if (rc >= 0)
+            rc = printer_pool_submit(pool, i % streams, "DEMO_PRINT", &page, 1);
+
+        display_list_free(&page);
+
+        if (rc < 0)
+        {
+            log_error("Failed to queue document");
+            goto exit;
+        }
     }
 
-    RECT bounds = {
-        .left = header.rclBounds.left,
-        .top = header.rclBounds.top,
-        .right = header.rclBounds.right,
-        .bottom = header.rclBounds.bottom,
-    };
+    printer_pool_drain(pool);
+    elapsed_ns = timing_now_ns() - start_ns;
+
+    printer_pool_print_stats(pool);
+    printer_pool_get_stats(pool, &stats);
 
     printf(
-        "EMF bounds: (%d,%d),(%d,%d)\n",
-        bounds.left,
-        bounds.top,
-        bounds.right,
-        bounds.bottom);
+        "Printed %llu documents on %d printers in %.3f ms, %.1f documents/s\n",
+        (unsigned long long)stats.spooled,
+        printer_pool_size(pool),
+        timing_ns_to_s(elapsed_ns) * 1e3,
+        elapsed_ns > 0 ? (double)stats.spooled / timing_ns_to_s(elapsed_ns) : 0.0);
 
-    if (PlayEnhMetaFile(printer, emf, &bounds) == 0)
+    if (stats.failed > 0)
     {
-        printf("Failed to play metafile\n");
-        rc = -EINVAL;
+        log_error("Failed to print every document");
+        rc = -EIO;
         goto exit;
     }
 
-    if (RestoreDC(printer, -1) == 0)
-    {
-        printf("Failed to restore DC\n");
-        rc = -EINVAL;
-        goto exit;
-    }
+    printf("Print job complete!\n");
 
 exit:
+    printer_pool_destroy(pool);
+    display_list_free(&layout);
+
     return rc;
 }
 
-int demo_print(const char *printer_name, const char *page_size)
+int demo_print(
+    const struct print_backend *backend,
+    const char *printer_name,
+    const char *page_size,
+    int documents,
+    int use_template,
+    int raster,
+    size_t band_bytes,
+    int raster_threads,
+    int compress,
+    int async,
+    int streams)
 {
     int rc;
-    struct page_details *details = NULL;
-    DEVMODE *devmode = NULL;
-    struct coordinate_space space;
-    HDC printer = NULL;
-    DOCINFOA doc_info = {0};
-
-    /* Configure the printer - for now all we're doing is setting the
-     * page size. We have to do this first, because we then ask the printer
-     * to tell us, based on this page size, how many pixels it has in X
-     * and Y. */
-    details = get_page_details(printer_name, page_size);
-    if (details == NULL)
+    struct print_session *session = NULL;
+    struct page_template *layout = NULL;
+    struct caps_cache *cache = NULL;
+    const struct cached_printer *printer = NULL;
+    struct session_options options = {
+        .paper_name = page_size,
+        .raster = raster,
+        .band_bytes = band_bytes,
+        .raster_threads = raster_threads,
+        .compress = compress,
+    };
+    uint64_t start_ns = 0;
+    uint64_t setup_ns = 0;
+    struct trace_span span;
+    struct log_context context = {0, printer_name, NULL};
+    struct log_context saved = log_set_context(&context);
+
+    /* A pool is a list of printers, which each open their own session. */
+    if (streams > 0)
     {
-        printf("Failed to get page details\n");
-        rc = -EINVAL;
+        rc = demo_print_pool(backend, printer_name, &options, documents, streams);
         goto exit;
     }
 
-    rc = set_page_size(printer_name, details, &devmode);
-    if (rc < 0)
+    /* Take the paper details from the capability cache when we can. If
+     * that fails the backend queries the driver itself. */
+    span = trace_begin("caps lookup");
+    cache = caps_cache_open(NULL);
+    if (cache != NULL && caps_cache_get(cache, backend, printer_name, &printer) == 0)
+        options.paper = cached_printer_find_paper(printer, page_size, NULL);
+    trace_end(&span);
+
+    if (async)
     {
-        printf("Failed to set page size\n");
+        rc = demo_print_async(backend, printer_name, &options, documents);
         goto exit;
     }
 
-    printer = CreateDC("WINSPOOL", printer_name, NULL, devmode);
-    if (printer == NULL)
+    printf("Opening print session\n");
+
+    span = trace_begin("open session");
+
+    rc = backend->open_session(printer_name, &options, &session);
+    if (rc < 0)
     {
-        printf("Failed to create printer\n");
-        rc = -EINVAL;
+        log_error("Failed to open print session");
         goto exit;
     }
 
-    /* The printer coordinate space uses pixels, at some DPI. Our EMF
-     * represents an entire page - but we also need to account for the
-     * actual printable area. We handle this by capturing the offsets. */
-    space.device.width = GetDeviceCaps(printer, PHYSICALWIDTH);
-    space.device.height = GetDeviceCaps(printer, PHYSICALHEIGHT);
-    space.device.offset_x = GetDeviceCaps(printer, PHYSICALOFFSETX);
-    space.device.offset_y = GetDeviceCaps(printer, PHYSICALOFFSETY);
+    trace_end(&span);
+    setup_ns = timing_now_ns() - span.start_ns;
 
-    int printer_dpi_x = GetDeviceCaps(printer, LOGPIXELSX);
-    int printer_dpi_y = GetDeviceCaps(printer, LOGPIXELSY);
-    int printer_horz_res = GetDeviceCaps(printer, HORZRES);
-    int printer_vert_res = GetDeviceCaps(printer, VERTRES);
+    if (cache != NULL)
+        caps_cache_set_geometry(cache, printer_name, session);
+
+    const struct coordinate_space *space = &session->space;
 
     printf(
         "Printer resolution: %d x %d DPI\n",
-        printer_dpi_x,
-        printer_dpi_y);
+        session->dpi_x,
+        session->dpi_y);
 
     printf(
         "Physical page size: %d x %d px\n",
-        space.device.width,
-        space.device.height);
+        space->device.width,
+        space->device.height);
 
     printf(
         "Printable page size: %d x %d px\n",
-        printer_horz_res,
-        printer_vert_res);
+        session->printable_width,
+        session->printable_height);
 
     printf(
         "Print offsets (X, Y): (%d, %d) px\n",
-        space.device.offset_x,
-        space.device.offset_y);
+        space->device.offset_x,
+        space->device.offset_y);
 
-    /* Our drawing is done in logical units and, for convenience, we'll use
-     * 1/10 mm units (as returned by DC_PAPERSIZE) and represent the entire
-     * page. */
-    space.logical.width = details->dimensions.x;
-    space.logical.height = details->dimensions.y;
+    printf("Logical page size: %d x %d px\n", space->logical.width, space->logical.height);
+    printf("Logical offsets (X, Y): (%d, %d) px\n", space->logical.offset_x, space->logical.offset_y);
+    printf(
+        "Logical scaling factor: %f x %f\n",
+        (double)space->logical.width / (double)space->device.width,
+        (double)space->logical.height / (double)space->device.height);
 
-    double scale_x = (double)space.logical.width / (double)space.device.width;
-    double scale_y = (double)space.logical.height / (double)space.device.height;
+    start_ns = timing_now_ns();
 
-    space.logical.offset_x = (int)(space.device.offset_x * scale_x);
-    space.logical.offset_y = (int)(space.device.offset_y * scale_y);
+    /* Record the layout once. Each document then replays it and only draws
+     * its own fields. */
+    if (use_template)
+    {
+        span = trace_begin("record template");
 
-    printf("Logical page size: %d x %d px\n", space.logical.width, space.logical.height);
-    printf("Logical offsets (X, Y): (%d, %d) px\n", space.logical.offset_x, space.logical.offset_y);
-    printf("Logical scaling factor: %f x %f\n", scale_x, scale_y);
+        rc = backend->begin_template(session);
+        if (rc < 0)
+        {
+            log_error("Failed to start template");
+            goto exit;
+        }
 
-    /* Start the print job! */
-    doc_info.cbSize = sizeof(doc_info);
-    doc_info.lpszDocName = "DEMO_PRINT";
+        rc = draw_layout(session);
+        if (rc < 0)
+            log_error("Failed to draw layout");
 
-    printf("Starting print job\n");
+        if (backend->end_template(session, &layout) < 0 || rc < 0)
+        {
+            log_error("Failed to record template");
+            rc = -EINVAL;
+            goto exit;
+        }
 
-    if (StartDoc(printer, &doc_info) <= 0)
-    {
-        printf("Failed to start document\n");
-        rc = -EINVAL;
-        goto exit;
+        rc = reload_template(session, &layout);
+        if (rc < 0)
+        {
+            log_error("Failed to reload template");
+            goto exit;
+        }
+
+        trace_end(&span);
     }
 
-    if (StartPage(printer) <= 0)
+    /* The device was set up once above; each document only costs its
+     * StartDoc, the drawing and EndPage. */
+    for (int i = 0; i < documents; i++)
     {
-        printf("Failed to start page\n");
-        rc = -EINVAL;
-        goto exit;
-    }
+        span = trace_begin("document");
 
-    // rc = direct_print(printer, &space);
-    // if (rc < 0)
-    // {
-    //     printf("Failed to print directly\n");
-    // }
+        context.job = (uint64_t)i + 1;
+        log_set_context(&context);
 
-    HENHMETAFILE emf = draw_document(space.logical.width, space.logical.height);
-    if (emf == NULL)
-    {
-        printf("Failed to draw document\n");
-        rc = -EINVAL;
-        goto exit;
-    }
+        rc = print_session_start_document(session, "DEMO_PRINT");
+        if (rc < 0)
+        {
+            log_error("Failed to start document");
+            goto exit;
+        }
 
-    rc = print_emf(printer, emf, &space);
-    if (rc < 0)
-    {
-        printf("Failed to print EMF\n");
-        goto exit;
-    }
+        rc = print_session_start_page(session);
+        if (rc < 0)
+        {
+            log_error("Failed to start page");
+            goto exit;
+        }
 
-    if (EndPage(printer) <= 0)
-    {
-        printf("Failed to end page\n");
-        rc = -EINVAL;
-        goto exit;
-    }
+        if (layout != NULL)
+            rc = backend->draw_template(session, layout, 0, 0);
+        else
+            rc = draw_layout(session);
 
-    if (EndDoc(printer) <= 0)
-    {
-        printf("Failed to end document\n");
-        rc = -EINVAL;
-        goto exit;
+        if (rc < 0 || draw_fields(session, i) < 0)
+        {
+            log_error("Failed to draw document");
+            rc = -EINVAL;
+            goto exit;
+        }
+
+        rc = print_session_end_page(session);
+        if (rc < 0)
+        {
+            log_error("Failed to end page");
+            goto exit;
+        }
+
+        rc = print_session_end_document(session, 0);
+        if (rc < 0)
+        {
+            log_error("Failed to end document");
+            goto exit;
+        }
+
+        trace_end(&span);
     }
 
+    printf(
+        "Printed %d documents: setup %.3f ms, %.3f ms per document\n",
+        session->document_count,
+        timing_ns_to_s(setup_ns) * 1e3,
+        timing_ns_to_s(timing_now_ns() - start_ns) * 1e3 / documents);
+
+    print_raster_stats(&session->raster_stats);
+
     printf("Print job complete!\n");
 
     rc = 0;
 
 exit:
-    if (details != NULL)
-        free(details);
+    if (layout != NULL)
+        backend->free_template(layout);
 
-    if (printer != NULL)
-        DeleteDC(printer);
+    if (session != NULL)
+        print_session_close(session);
+
+    caps_cache_close(cache);
+    log_set_context(&saved);
 
     return rc;
 }
@@ -575,20 +489,125 @@ int main(int argc, char **argv)
 {
     int rc;
     const char *printer_name = NULL;
+    const char *backend_name = NULL;
+    const struct print_backend *backend = NULL;
+    const char *paper_name = A4_PAGE_NAME;
+    int documents = 1;
+    int use_template = 1;
+    int raster = 0;
+    size_t band_bytes = 0;
+    int raster_threads = 1;
+    int compress = 0;
+    int async = 0;
+    int streams = 0;
+    const char *trace_path = NULL;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--backend") == 0 && i + 1 < argc)
+        {
+            backend_name = argv[++i];
+        }
+        else if (strcmp(argv[i], "--paper") == 0 && i + 1 < argc)
+        {
+            paper_name = argv[++i];
+        }
+        else if (strcmp(argv[i], "--documents") == 0 && i + 1 < argc)
+        {
+            documents = atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--no-template") == 0)
+        {
+            use_template = 0;
+        }
+        else if (strcmp(argv[i], "--raster") == 0)
+        {
+            raster = 1;
+        }
+        else if (strcmp(argv[i], "--band-kb") == 0 && i + 1 < argc)
+        {
+            band_bytes = strtoul(argv[++i], NULL, 10) << 10;
+        }
+        else if (strcmp(argv[i], "--raster-threads") == 0 && i + 1 < argc)
+        {
+            /* 0 asks for one per CPU. */
+            raster_threads = atoi(argv[++i]);
+            if (raster_threads == 0)
+                raster_threads = -1;
+        }
+        else if (strcmp(argv[i], "--compress") == 0)
+        {
+            compress = 1;
+        }
+        else if (strcmp(argv[i], "--async") == 0)
+        {
+            async = 1;
+        }
+        else if (strcmp(argv[i], "--pool") == 0)
+        {
+            if (streams == 0)
+                streams = 1;
+        }
+        else if (strcmp(argv[i], "--streams") == 0 && i + 1 < argc)
+        {
+            streams = atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--trace") == 0 && i + 1 < argc)
+        {
+            trace_path = argv[++i];
+        }
+        else if (printer_name == NULL)
+        {
+            printer_name = argv[i];
+        }
+        else
+        {
+            printer_name = NULL;
+            break;
+        }
+    }
 
-    if (argc != 2)
+    if (printer_name == NULL || documents < 1 || streams < 0)
     {
-        printf("Usage: %s <printer name>\n", argv[0]);
+        printf("Usage: %s <printer name> [--backend <name>] [--paper <name>]\n", argv[0]);
+        printf("       [--documents <n>] [--no-template] [--raster]\n");
+        printf("       [--band-kb <n>] [--raster-threads <n>] [--compress]\n");
+        printf("       [--async] [--pool] [--streams <n>] [--trace <path>]\n");
         return -EINVAL;
     }
 
-    printer_name = argv[1];
+    backend = print_backend_find(backend_name);
+    if (backend == NULL)
+        return -EINVAL;
+
+    trace_thread_name("main");
 
     printf("Printing to: %s\n", printer_name);
-    rc = demo_print(printer_name, A4_PAGE_NAME);
+    rc = demo_print(
+        backend,
+        printer_name,
+        paper_name,
+        documents,
+        use_template,
+        raster,
+        band_bytes,
+        raster_threads,
+        compress,
+        async,
+        streams);
+
+    /* So the diagnostics come before the reports below. */
+    log_flush();
+
+    /* Every thread has finished by now, so the spans are complete. */
+    trace_print_histograms();
+
+    if (trace_path != NULL)
+        trace_write_chrome(trace_path);
+
     if (rc < 0)
     {
-        printf("Failed to print\n");
+        log_error("Failed to print");
         return rc;
     }
 
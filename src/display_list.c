@@ -0,0 +1,724 @@
+#include <errno.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "display_list.h"
+#include "log.h"
+
+#define DISPLAY_LIST_MAGIC 0x54534c44u /* "DLST" */
+#define DISPLAY_LIST_VERSION 2
+
+struct serialised_header
+{
+    uint32_t magic;
+    uint32_t version;
+    uint64_t count;
+    uint64_t data_size;
+};
+
+void display_list_clear(struct display_list *list)
+{
+    list->count = 0;
+    list->data_size = 0;
+}
+
+void display_list_free(struct display_list *list)
+{
+    free(list->commands);
+    free(list->data);
+    memset(list, 0, sizeof(*list));
+}
+
+static struct display_command *add_command(struct display_list *list, enum display_op op)
+{
+    struct display_command *command = NULL;
+
+    if (list->count == list->capacity)
+    {
+        size_t capacity = list->capacity > 0 ? list->capacity * 2 : 64;
+        struct display_command *commands =
+            (struct display_command *)realloc(list->commands, capacity * sizeof(*commands));
+        if (commands == NULL)
+            return NULL;
+
+        list->commands = commands;
+        list->capacity = capacity;
+    }
+
+    command = &list->commands[list->count++];
+    memset(command, 0, sizeof(*command));
+    command->op = op;
+
+    return command;
+}
+
+/* Reserves size octets of the data block, 4-byte aligned so bitmap rows
+ * stay aligned as StretchDIBits wants them. Returns the offset or -1. */
+static int64_t add_data(struct display_list *list, size_t size)
+{
+    size_t offset = (list->data_size + 3) & ~(size_t)3;
+
+    if (offset + size > UINT32_MAX)
+        return -1;
+
+    if (offset + size > list->data_capacity)
+    {
+        size_t capacity = list->data_capacity > 0 ? list->data_capacity * 2 : 4096;
+        unsigned char *data = NULL;
+
+        while (capacity < offset + size)
+            capacity *= 2;
+
+        data = (unsigned char *)realloc(list->data, capacity);
+        if (data == NULL)
+            return -1;
+
+        list->data = data;
+        list->data_capacity = capacity;
+    }
+
+    list->data_size = offset + size;
+
+    return (int64_t)offset;
+}
+
+int display_list_rect(struct display_list *list, const struct rect *r)
+{
+    struct display_command *command = add_command(list, DISPLAY_RECT);
+
+    if (command == NULL)
+        return -ENOMEM;
+
+    command->rect = *r;
+
+    return 0;
+}
+
+int display_list_fill(struct display_list *list, const struct rect *r)
+{
+    struct display_command *command = add_command(list, DISPLAY_FILL);
+
+    if (command == NULL)
+        return -ENOMEM;
+
+    command->rect = *r;
+
+    return 0;
+}
+
+int display_list_line(struct display_list *list, int x0, int y0, int x1, int y1)
+{
+    struct display_command *command = add_command(list, DISPLAY_LINE);
+
+    if (command == NULL)
+        return -ENOMEM;
+
+    command->line.x0 = x0;
+    command->line.y0 = y0;
+    command->line.x1 = x1;
+    command->line.y1 = y1;
+
+    return 0;
+}
+
+int display_list_text(struct display_list *list, int x, int y, int height, const char *text)
+{
+    size_t length = strlen(text) + 1;
+    int64_t offset = add_data(list, length);
+    struct display_command *command = NULL;
+
+    if (offset < 0)
+        return -ENOMEM;
+
+    command = add_command(list, DISPLAY_TEXT);
+    if (command == NULL)
+        return -ENOMEM;
+
+    memcpy(list->data + offset, text, length);
+
+    command->text.x = x;
+    command->text.y = y;
+    command->text.height = height;
+    command->text.text = (uint32_t)offset;
+
+    return 0;
+}
+
+int display_list_bitmap(struct display_list *list, const struct rect *r, const struct bitmap *bitmap)
+{
+    size_t size = bitmap->stride * (size_t)bitmap->height;
+    int64_t offset = add_data(list, size);
+    struct display_command *command = NULL;
+
+    if (offset < 0)
+        return -ENOMEM;
+
+    command = add_command(list, DISPLAY_BITMAP);
+    if (command == NULL)
+        return -ENOMEM;
+
+    memcpy(list->data + offset, bitmap->bits, size);
+
+    command->bitmap.rect = *r;
+    command->bitmap.width = bitmap->width;
+    command->bitmap.height = bitmap->height;
+    command->bitmap.bits = (uint32_t)offset;
+
+    return 0;
+}
+
+int display_list_polygon(struct display_list *list, const struct point *points, int count)
+{
+    size_t size = 0;
+    int64_t offset = 0;
+    struct display_command *command = NULL;
+
+    if (count < 0)
+        return -EINVAL;
+
+    size = (size_t)count * sizeof(*points);
+    offset = add_data(list, size);
+    if (offset < 0)
+        return -ENOMEM;
+
+    command = add_command(list, DISPLAY_POLYGON);
+    if (command == NULL)
+        return -ENOMEM;
+
+    if (size > 0)
+        memcpy(list->data + offset, points, size);
+
+    command->polygon.count = count;
+    command->polygon.points = (uint32_t)offset;
+
+    return 0;
+}
+
+static void move_rect(struct rect *r, int dx, int dy)
+{
+    r->left += dx;
+    r->top += dy;
+    r->right += dx;
+    r->bottom += dy;
+}
+
+int display_list_append(
+    struct display_list *list,
+    const struct display_list *src,
+    int dx,
+    int dy)
+{
+    int64_t base = 0;
+
+    if (src->count == 0)
+        return 0;
+
+    if (list->count + src->count > list->capacity)
+    {
+        size_t capacity = list->capacity > 0 ? list->capacity : 64;
+        struct display_command *commands = NULL;
+
+        while (capacity < list->count + src->count)
+            capacity *= 2;
+
+        commands = (struct display_command *)realloc(list->commands, capacity * sizeof(*commands));
+        if (commands == NULL)
+            return -ENOMEM;
+
+        list->commands = commands;
+        list->capacity = capacity;
+    }
+
+    /* The source's data block goes in whole, so its offsets only need
+     * rebasing. It's aligned, so the alignment within it carries over. */
+    base = add_data(list, src->data_size);
+    if (base < 0)
+        return -ENOMEM;
+
+    if (src->data_size > 0)
+        memcpy(list->data + base, src->data, src->data_size);
+
+    for (size_t i = 0; i < src->count; i++)
+    {
+        struct display_command *command = &list->commands[list->count++];
+
+        *command = src->commands[i];
+
+        switch (command->op)
+        {
+        case DISPLAY_RECT:
+        case DISPLAY_FILL:
+            move_rect(&command->rect, dx, dy);
+            break;
+
+        case DISPLAY_LINE:
+            command->line.x0 += dx;
+            command->line.y0 += dy;
+            command->line.x1 += dx;
+            command->line.y1 += dy;
+            break;
+
+        case DISPLAY_TEXT:
+            command->text.x += dx;
+            command->text.y += dy;
+            command->text.text += (uint32_t)base;
+            break;
+
+        case DISPLAY_BITMAP:
+            move_rect(&command->bitmap.rect, dx, dy);
+            command->bitmap.bits += (uint32_t)base;
+            break;
+
+        case DISPLAY_POLYGON:
+            command->polygon.points += (uint32_t)base;
+
+            /* The points are in this list's copy of the data. */
+            if (dx != 0 || dy != 0)
+            {
+                struct point *points = (struct point *)(list->data + command->polygon.points);
+
+                for (int j = 0; j < command->polygon.count; j++)
+                {
+                    points[j].x += dx;
+                    points[j].y += dy;
+                }
+            }
+            break;
+        }
+    }
+
+    return 0;
+}
+
+void display_command_bitmap(
+    const struct display_list *list,
+    const struct display_command *command,
+    struct bitmap *bitmap)
+{
+    bitmap->width = command->bitmap.width;
+    bitmap->height = command->bitmap.height;
+    bitmap->stride = (((size_t)command->bitmap.width + 31) / 32) * 4;
+    bitmap->bits = list->data + command->bitmap.bits;
+    bitmap->capacity = 0;
+}
+
+static int play_polygon(
+    const struct display_list *list,
+    const struct display_command *command,
+    struct print_session *session,
+    int dx,
+    int dy)
+{
+    int rc = 0;
+    const struct point *points = display_command_points(list, command);
+    struct point *moved = NULL;
+
+    /* Nothing to move, and no points would ask malloc() for nothing. */
+    if ((dx == 0 && dy == 0) || command->polygon.count == 0)
+        return session->backend->fill_polygon(session, points, command->polygon.count);
+
+    moved = (struct point *)malloc((size_t)command->polygon.count * sizeof(*moved));
+    if (moved == NULL)
+        return -ENOMEM;
+
+    for (int i = 0; i < command->polygon.count; i++)
+    {
+        moved[i].x = points[i].x + dx;
+        moved[i].y = points[i].y + dy;
+    }
+
+    rc = session->backend->fill_polygon(session, moved, command->polygon.count);
+    free(moved);
+
+    return rc;
+}
+
+int display_list_play(
+    const struct display_list *list,
+    struct print_session *session,
+    int dx,
+    int dy)
+{
+    int rc = 0;
+    const struct print_backend *backend = session->backend;
+
+    for (size_t i = 0; i < list->count && rc >= 0; i++)
+    {
+        const struct display_command *command = &list->commands[i];
+        struct rect r;
+        struct bitmap bitmap;
+
+        switch (command->op)
+        {
+        case DISPLAY_RECT:
+        case DISPLAY_FILL:
+            r = command->rect;
+            move_rect(&r, dx, dy);
+
+            if (command->op == DISPLAY_RECT)
+                rc = backend->draw_rect(session, &r);
+            else
+                rc = backend->fill_rect(session, &r);
+            break;
+
+        case DISPLAY_LINE:
+            rc = backend->draw_line(
+                session,
+                command->line.x0 + dx,
+                command->line.y0 + dy,
+                command->line.x1 + dx,
+                command->line.y1 + dy);
+            break;
+
+        case DISPLAY_TEXT:
+            rc = backend->draw_text(
+                session,
+                command->text.x + dx,
+                command->text.y + dy,
+                command->text.height,
+                display_command_text(list, command));
+            break;
+
+        case DISPLAY_BITMAP:
+            r = command->bitmap.rect;
+            move_rect(&r, dx, dy);
+            display_command_bitmap(list, command, &bitmap);
+            rc = backend->draw_bitmap(session, &r, &bitmap);
+            break;
+
+        case DISPLAY_POLYGON:
+            rc = play_polygon(list, command, session, dx, dy);
+            break;
+        }
+    }
+
+    return rc;
+}
+
+int display_list_serialise(const struct display_list *list, void **data, size_t *size)
+{
+    struct serialised_header header = {
+        .magic = DISPLAY_LIST_MAGIC,
+        .version = DISPLAY_LIST_VERSION,
+        .count = list->count,
+        .data_size = list->data_size,
+    };
+    size_t commands = list->count * sizeof(*list->commands);
+    unsigned char *out = NULL;
+
+    *data = NULL;
+    *size = 0;
+
+    out = (unsigned char *)malloc(sizeof(header) + commands + list->data_size);
+    if (out == NULL)
+    {
+        log_error("Failed to allocate memory");
+        return -ENOMEM;
+    }
+
+    memcpy(out, &header, sizeof(header));
+
+    if (commands > 0)
+        memcpy(out + sizeof(header), list->commands, commands);
+
+    if (list->data_size > 0)
+        memcpy(out + sizeof(header) + commands, list->data, list->data_size);
+
+    *data = out;
+    *size = sizeof(header) + commands + list->data_size;
+
+    return 0;
+}
+
+static int command_valid(const struct display_list *list, const struct display_command *command)
+{
+    uint64_t size = 0;
+
+    switch (command->op)
+    {
+    case DISPLAY_RECT:
+    case DISPLAY_FILL:
+    case DISPLAY_LINE:
+        return 1;
+
+    case DISPLAY_TEXT:
+        return command->text.text < list->data_size &&
+               memchr(list->data + command->text.text, '\0', list->data_size - command->text.text) != NULL;
+
+    case DISPLAY_BITMAP:
+        if (command->bitmap.width < 0 || command->bitmap.height < 0)
+            return 0;
+
+        size = (((uint64_t)command->bitmap.width + 31) / 32) * 4 * (uint64_t)command->bitmap.height;
+
+        return (uint64_t)command->bitmap.bits + size <= list->data_size;
+
+    case DISPLAY_POLYGON:
+        if (command->polygon.count < 0)
+            return 0;
+
+        size = (uint64_t)command->polygon.count * sizeof(struct point);
+
+        return command->polygon.points % 4 == 0 &&
+               (uint64_t)command->polygon.points + size <= list->data_size;
+    }
+
+    return 0;
+}
+
+int display_list_deserialise(struct display_list *list, const void *data, size_t size)
+{
+    const unsigned char *in = (const unsigned char *)data;
+    struct serialised_header header;
+    size_t commands = 0;
+
+    if (size < sizeof(header))
+        return -EINVAL;
+
+    memcpy(&header, in, sizeof(header));
+
+    if (header.magic != DISPLAY_LIST_MAGIC || header.version != DISPLAY_LIST_VERSION)
+    {
+        log_error("Not a display list");
+        return -EINVAL;
+    }
+
+    if (header.count > (size - sizeof(header)) / sizeof(*list->commands) ||
+        header.data_size != size - sizeof(header) - header.count * sizeof(*list->commands))
+    {
+        log_error("Display list is truncated");
+        return -EINVAL;
+    }
+
+    commands = (size_t)header.count * sizeof(*list->commands);
+
+    display_list_clear(list);
+
+    if (header.count > list->capacity)
+    {
+        struct display_command *grown =
+            (struct display_command *)realloc(list->commands, commands);
+        if (grown == NULL)
+            return -ENOMEM;
+
+        list->commands = grown;
+        list->capacity = (size_t)header.count;
+    }
+
+    if (header.data_size > list->data_capacity)
+    {
+        unsigned char *grown = (unsigned char *)realloc(list->data, (size_t)header.data_size);
+        if (grown == NULL)
+            return -ENOMEM;
+
+        list->data = grown;
+        list->data_capacity = (size_t)header.data_size;
+    }
+
+    if (commands > 0)
+        memcpy(list->commands, in + sizeof(header), commands);
+
+    if (header.data_size > 0)
+        memcpy(list->data, in + sizeof(header) + commands, (size_t)header.data_size);
+
+    list->count = (size_t)header.count;
+    list->data_size = (size_t)header.data_size;
+
+    /* Don't trust offsets that point outside the data. */
+    for (size_t i = 0; i < list->count; i++)
+    {
+        if (!command_valid(list, &list->commands[i]))
+        {
+            log_error("Display list is corrupt");
+            display_list_clear(list);
+            return -EINVAL;
+        }
+    }
+
+    return 0;
+}
+
+int page_template_create(struct page_template **page_template)
+{
+    *page_template = (struct page_template *)calloc(1, sizeof(**page_template));
+    if (*page_template == NULL)
+    {
+        log_error("Failed to allocate memory");
+        return -ENOMEM;
+    }
+
+    return 0;
+}
+
+int page_template_serialise(
+    const struct page_template *page_template,
+    void **data,
+    size_t *size)
+{
+    return display_list_serialise(&page_template->list, data, size);
+}
+
+int page_template_deserialise(
+    struct print_session *session,
+    const void *data,
+    size_t size,
+    struct page_template **page_template)
+{
+    int rc = 0;
+
+    (void)session;
+
+    rc = page_template_create(page_template);
+    if (rc < 0)
+        return rc;
+
+    rc = display_list_deserialise(&(*page_template)->list, data, size);
+    if (rc < 0)
+    {
+        page_template_free(*page_template);
+        *page_template = NULL;
+    }
+
+    return rc;
+}
+
+void page_template_free(struct page_template *page_template)
+{
+    if (page_template == NULL)
+        return;
+
+    display_list_free(&page_template->list);
+    free(page_template);
+}
+
+int display_session_start_page(struct display_session *session)
+{
+    if (!session->base.in_document || session->in_page)
+    {
+        log_error("Page already started");
+        return -EINVAL;
+    }
+
+    if (session->recording != NULL)
+    {
+        log_error("Template still recording");
+        return -EINVAL;
+    }
+
+    display_list_clear(&session->page);
+    session->in_page = 1;
+
+    return 0;
+}
+
+struct display_list *display_session_target(struct print_session *base)
+{
+    struct display_session *session = (struct display_session *)base;
+
+    if (session->recording != NULL)
+        return &session->recording->list;
+
+    return session->in_page ? &session->page : NULL;
+}
+
+int display_session_draw_rect(struct print_session *session, const struct rect *r)
+{
+    struct display_list *list = display_session_target(session);
+
+    return list != NULL ? display_list_rect(list, r) : -EINVAL;
+}
+
+int display_session_fill_rect(struct print_session *session, const struct rect *r)
+{
+    struct display_list *list = display_session_target(session);
+
+    return list != NULL ? display_list_fill(list, r) : -EINVAL;
+}
+
+int display_session_draw_line(struct print_session *session, int x0, int y0, int x1, int y1)
+{
+    struct display_list *list = display_session_target(session);
+
+    return list != NULL ? display_list_line(list, x0, y0, x1, y1) : -EINVAL;
+}
+
+int display_session_draw_text(struct print_session *session, int x, int y, int height, const char *text)
+{
+    struct display_list *list = display_session_target(session);
+
+    return list != NULL ? display_list_text(list, x, y, height, text) : -EINVAL;
+}
+
+int display_session_draw_bitmap(
+    struct print_session *session,
+    const struct rect *r,
+    const struct bitmap *bitmap)
+{
+    struct display_list *list = display_session_target(session);
+
+    return list != NULL ? display_list_bitmap(list, r, bitmap) : -EINVAL;
+}
+
+int display_session_fill_polygon(struct print_session *session, const struct point *points, int count)
+{
+    struct display_list *list = display_session_target(session);
+
+    return list != NULL ? display_list_polygon(list, points, count) : -EINVAL;
+}
+
+int display_session_begin_template(struct print_session *base)
+{
+    struct display_session *session = (struct display_session *)base;
+
+    if (session->in_page || session->recording != NULL)
+    {
+        log_error("Templates can't be recorded inside a page");
+        return -EINVAL;
+    }
+
+    return page_template_create(&session->recording);
+}
+
+int display_session_end_template(struct print_session *base, struct page_template **page_template)
+{
+    struct display_session *session = (struct display_session *)base;
+
+    *page_template = session->recording;
+
+    if (session->recording == NULL)
+    {
+        log_error("No template started");
+        return -EINVAL;
+    }
+
+    session->recording = NULL;
+
+    return 0;
+}
+
+int display_session_draw_template(
+    struct print_session *base,
+    const struct page_template *page_template,
+    int x,
+    int y)
+{
+    struct display_session *session = (struct display_session *)base;
+
+    if (!session->in_page)
+    {
+        log_error("No page started");
+        return -EINVAL;
+    }
+
+    return display_list_append(&session->page, &page_template->list, x, y);
+}
+
+void display_session_release(struct display_session *session)
+{
+    display_list_free(&session->page);
+    page_template_free(session->recording);
+    session->recording = NULL;
+    session->in_page = 0;
+}
@@ -0,0 +1,201 @@
+#ifndef DISPLAY_LIST_H
+#define DISPLAY_LIST_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "bitmap.h"
+#include "print_backend.h"
+
+/* A page's drawing as a flat array of fixed-size commands in logical units
+ * of 1/10 mm, the same units as the rest of the print backend. Text and
+ * bitmap bits live in a separate data block that commands refer to by
+ * offset, so a list is two allocations with no pointers in it: cheap to
+ * build, to copy, to walk and to serialise. Nothing in it depends on GDI,
+ * so pages can be recorded and played back on any platform.
+ *
+ * A list starts zeroed and is reused between pages; clearing it keeps its
+ * memory. */
+
+enum display_op
+{
+    DISPLAY_RECT,
+    DISPLAY_FILL,
+    DISPLAY_LINE,
+    DISPLAY_TEXT,
+    DISPLAY_BITMAP,
+    DISPLAY_POLYGON,
+};
+
+struct display_command
+{
+    enum display_op op;
+
+    union
+    {
+        /* DISPLAY_RECT and DISPLAY_FILL. */
+        struct rect rect;
+
+        struct
+        {
+            int x0;
+            int y0;
+            int x1;
+            int y1;
+        } line;
+
+        /* text is the offset of a NUL-terminated string. */
+        struct
+        {
+            int x;
+            int y;
+            int height;
+            uint32_t text;
+        } text;
+
+        /* bits is the offset of the rows, padded as struct bitmap pads
+         * them. */
+        struct
+        {
+            struct rect rect;
+            int width;
+            int height;
+            uint32_t bits;
+        } bitmap;
+
+        /* points is the offset of count struct points. */
+        struct
+        {
+            int count;
+            uint32_t points;
+        } polygon;
+    };
+};
+
+struct display_list
+{
+    struct display_command *commands;
+    size_t count;
+    size_t capacity;
+
+    unsigned char *data;
+    size_t data_size;
+    size_t data_capacity;
+};
+
+void display_list_clear(struct display_list *list);
+
+void display_list_free(struct display_list *list);
+
+int display_list_rect(struct display_list *list, const struct rect *r);
+int display_list_fill(struct display_list *list, const struct rect *r);
+int display_list_line(struct display_list *list, int x0, int y0, int x1, int y1);
+int display_list_text(struct display_list *list, int x, int y, int height, const char *text);
+int display_list_bitmap(struct display_list *list, const struct rect *r, const struct bitmap *bitmap);
+int display_list_polygon(struct display_list *list, const struct point *points, int count);
+
+/* Appends every command of src, moved by dx, dy. */
+int display_list_append(
+    struct display_list *list,
+    const struct display_list *src,
+    int dx,
+    int dy);
+
+static inline const char *display_command_text(
+    const struct display_list *list,
+    const struct display_command *command)
+{
+    return (const char *)list->data + command->text.text;
+}
+
+static inline const struct point *display_command_points(
+    const struct display_list *list,
+    const struct display_command *command)
+{
+    return (const struct point *)(list->data + command->polygon.points);
+}
+
+/* A view of a DISPLAY_BITMAP command's bits, valid while the list is
+ * unchanged. */
+void display_command_bitmap(
+    const struct display_list *list,
+    const struct display_command *command,
+    struct bitmap *bitmap);
+
+/* Draws every command onto the current page of a session, moved by dx,
+ * dy. */
+int display_list_play(
+    const struct display_list *list,
+    struct print_session *session,
+    int dx,
+    int dy);
+
+/* Flattens a list into a malloc'd buffer the caller frees, and back. The
+ * buffer is only meant for the same build on the same machine. */
+int display_list_serialise(const struct display_list *list, void **data, size_t *size);
+int display_list_deserialise(struct display_list *list, const void *data, size_t size);
+
+/* Every backend records page templates as display lists. */
+struct page_template
+{
+    struct display_list list;
+};
+
+int page_template_create(struct page_template **page_template);
+
+int page_template_serialise(
+    const struct page_template *page_template,
+    void **data,
+    size_t *size);
+
+int page_template_deserialise(
+    struct print_session *session,
+    const void *data,
+    size_t size,
+    struct page_template **page_template);
+
+void page_template_free(struct page_template *page_template);
+
+/* The common part of backends that record each page as a display list and
+ * output it when the page ends. Must be the first member of the backend's
+ * session, and the display_session_* functions below can be used directly
+ * as its backend operations. */
+struct display_session
+{
+    struct print_session base;
+
+    struct display_list page;
+    int in_page;
+
+    /* The template being recorded, if any. */
+    struct page_template *recording;
+};
+
+/* Starts recording a page. Backends call this from their own start_page. */
+int display_session_start_page(struct display_session *session);
+
+/* The list drawing goes to: the template being recorded or the page. */
+struct display_list *display_session_target(struct print_session *session);
+
+int display_session_draw_rect(struct print_session *session, const struct rect *r);
+int display_session_fill_rect(struct print_session *session, const struct rect *r);
+int display_session_draw_line(struct print_session *session, int x0, int y0, int x1, int y1);
+int display_session_draw_text(struct print_session *session, int x, int y, int height, const char *text);
+int display_session_draw_bitmap(
+    struct print_session *session,
+    const struct rect *r,
+    const struct bitmap *bitmap);
+int display_session_fill_polygon(struct print_session *session, const struct point *points, int count);
+
+int display_session_begin_template(struct print_session *session);
+int display_session_end_template(struct print_session *session, struct page_template **page_template);
+int display_session_draw_template(
+    struct print_session *session,
+    const struct page_template *page_template,
+    int x,
+    int y);
+
+/* Frees what the display session holds, but not the session itself. */
+void display_session_release(struct display_session *session);
+
+#endif /* DISPLAY_LIST_H */
@@ -0,0 +1,283 @@
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "document_builder.h"
+#include "log.h"
+#include "timing.h"
+
+struct document_builder
+{
+    struct print_session *session;
+    struct document_options options;
+
+    /* The printable area in logical units and the size of each cell. */
+    struct rect area;
+    int cell_width;
+    int cell_height;
+
+    int in_page;
+    int cell;
+
+    /* The current document. */
+    int labels;
+    size_t bytes;
+    uint64_t started_ns;
+
+    struct document_stats stats;
+};
+
+struct document_builder *document_builder_create(
+    struct print_session *session,
+    const struct document_options *options)
+{
+    struct document_builder *builder = NULL;
+    const struct coordinate_space *space = &session->space;
+    int width = 0;
+    int height = 0;
+
+    if (options->columns < 1 || options->rows < 1 || options->gap < 0)
+    {
+        log_error("Invalid label grid %dx%d", options->columns, options->rows);
+        return NULL;
+    }
+
+    builder = (struct document_builder *)calloc(1, sizeof(*builder));
+    if (builder == NULL)
+    {
+        log_error("Failed to allocate memory");
+        return NULL;
+    }
+
+    builder->session = session;
+    builder->options = *options;
+
+    /* Only the printable area can be used, so convert it back from device
+     * pixels into logical units. */
+    width = (int)((long long)session->printable_width * space->logical.width / space->device.width);
+    height = (int)((long long)session->printable_height * space->logical.height / space->device.height);
+
+    builder->area.left = space->logical.offset_x;
+    builder->area.top = space->logical.offset_y;
+    builder->area.right = builder->area.left + width;
+    builder->area.bottom = builder->area.top + height;
+
+    builder->cell_width = (width - (options->columns - 1) * options->gap) / options->columns;
+    builder->cell_height = (height - (options->rows - 1) * options->gap) / options->rows;
+
+    if (builder->cell_width <= 0 || builder->cell_height <= 0)
+    {
+        log_error("Label grid %dx%d doesn't fit on the page", options->columns, options->rows);
+        free(builder);
+        return NULL;
+    }
+
+    return builder;
+}
+
+int document_builder_destroy(struct document_builder *builder)
+{
+    int rc = 0;
+
+    if (builder == NULL)
+        return 0;
+
+    rc = document_builder_flush(builder);
+
+    free(builder);
+
+    return rc;
+}
+
+static int end_page(struct document_builder *builder)
+{
+    int rc = 0;
+
+    if (!builder->in_page)
+        return 0;
+
+    builder->in_page = 0;
+    builder->cell = 0;
+
+    rc = print_session_end_page(builder->session);
+    if (rc < 0)
+    {
+        log_error("Failed to end page");
+        return rc;
+    }
+
+    builder->stats.pages++;
+
+    return 0;
+}
+
+/* Abandons the current document, so a half drawn label or page never
+ * reaches the printer, and leaves the builder ready for the next one. */
+static void abort_document(struct document_builder *builder)
+{
+    if (builder->session->in_document)
+        print_session_end_document(builder->session, 1);
+
+    builder->in_page = 0;
+    builder->cell = 0;
+    builder->labels = 0;
+    builder->bytes = 0;
+}
+
+int document_builder_flush(struct document_builder *builder)
+{
+    int rc = 0;
+
+    if (!builder->session->in_document)
+        return 0;
+
+    rc = end_page(builder);
+    if (rc < 0)
+        goto error;
+
+    rc = print_session_end_document(builder->session, 0);
+    if (rc < 0)
+    {
+        log_error("Failed to end document");
+        goto error;
+    }
+
+    builder->stats.documents++;
+    builder->labels = 0;
+    builder->bytes = 0;
+
+    return 0;
+
+error:
+    /* Don't leave the session stuck half way through a document. */
+    abort_document(builder);
+
+    return rc;
+}
+
+static int policy_reached(const struct document_builder *builder, uint64_t now)
+{
+    const struct flush_policy *flush = &builder->options.flush;
+
+    if (flush->max_labels > 0 && builder->labels >= flush->max_labels)
+        return 1;
+
+    if (flush->max_bytes > 0 && builder->bytes >= flush->max_bytes)
+        return 1;
+
+    if (flush->max_age_ns > 0 && now - builder->started_ns >= flush->max_age_ns)
+        return 1;
+
+    return 0;
+}
+
+int document_builder_add(
+    struct document_builder *builder,
+    draw_label_fn draw,
+    void *context,
+    size_t bytes)
+{
+    int rc = 0;
+    struct rect cell;
+    int column = 0;
+    int row = 0;
+
+    if (!builder->session->in_document)
+    {
+        rc = print_session_start_document(builder->session, builder->options.document_name);
+        if (rc < 0)
+        {
+            log_error("Failed to start document");
+            return rc;
+        }
+
+        builder->started_ns = timing_now_ns();
+    }
+
+    if (!builder->in_page)
+    {
+        rc = print_session_start_page(builder->session);
+        if (rc < 0)
+        {
+            log_error("Failed to start page");
+            goto error;
+        }
+
+        builder->in_page = 1;
+    }
+
+    /* Cells fill across then down. */
+    column = builder->cell % builder->options.columns;
+    row = builder->cell / builder->options.columns;
+
+    cell.left = builder->area.left + column * (builder->cell_width + builder->options.gap);
+    cell.top = builder->area.top + row * (builder->cell_height + builder->options.gap);
+    cell.right = cell.left + builder->cell_width;
+    cell.bottom = cell.top + builder->cell_height;
+
+    rc = draw(builder->session, &cell, context);
+    if (rc < 0)
+    {
+        log_error("Failed to draw label");
+        goto error;
+    }
+
+    builder->cell++;
+    builder->labels++;
+    builder->bytes += bytes;
+    builder->stats.labels++;
+
+    if (builder->cell == builder->options.columns * builder->options.rows)
+    {
+        rc = end_page(builder);
+        if (rc < 0)
+            goto error;
+    }
+
+    if (policy_reached(builder, timing_now_ns()))
+        return document_builder_flush(builder);
+
+    return 0;
+
+error:
+    abort_document(builder);
+
+    return rc;
+}
+
+int document_builder_poll(struct document_builder *builder)
+{
+    const struct flush_policy *flush = &builder->options.flush;
+
+    if (!builder->session->in_document || flush->max_age_ns == 0)
+        return 0;
+
+    if (timing_now_ns() - builder->started_ns < flush->max_age_ns)
+        return 0;
+
+    return document_builder_flush(builder);
+}
+
+uint64_t document_builder_poll_ns(const struct document_builder *builder)
+{
+    const struct flush_policy *flush = &builder->options.flush;
+    uint64_t age = 0;
+
+    if (flush->max_age_ns == 0)
+        return UINT64_MAX;
+
+    if (!builder->session->in_document)
+        return flush->max_age_ns;
+
+    age = timing_now_ns() - builder->started_ns;
+
+    return age < flush->max_age_ns ? flush->max_age_ns - age : 0;
+}
+
+void document_builder_get_stats(
+    const struct document_builder *builder,
+    struct document_stats *stats)
+{
+    *stats = builder->stats;
+}
@@ -0,0 +1,96 @@
+#ifndef DOCUMENT_BUILDER_H
+#define DOCUMENT_BUILDER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "print_backend.h"
+
+/* Packs labels into documents on a print session so the spooler sees a
+ * few large jobs rather than one job per label. Labels are either printed
+ * one per page or tiled N-up on a grid of cells across the printable area.
+ *
+ * A document is ended when any limit of the flush policy is reached. Not
+ * thread safe. */
+
+struct flush_policy
+{
+    /* Zero means no limit. */
+    int max_labels;
+    size_t max_bytes;
+    uint64_t max_age_ns;
+};
+
+struct document_options
+{
+    const char *document_name;
+
+    /* The grid of labels on each page. 1 x 1 prints one label per page. */
+    int columns;
+    int rows;
+
+    /* Space between cells, in 1/10 mm. */
+    int gap;
+
+    struct flush_policy flush;
+};
+
+#define DOCUMENT_OPTIONS_DEFAULT      \
+    {                                 \
+        .document_name = "LABELS",    \
+        .columns = 1,                 \
+        .rows = 1,                    \
+        .gap = 0,                     \
+        .flush = {.max_labels = 500}, \
+    }
+
+/* Draws one label into the cell, which is in logical units. */
+typedef int (*draw_label_fn)(
+    struct print_session *session,
+    const struct rect *cell,
+    void *context);
+
+struct document_stats
+{
+    uint64_t labels;
+    uint64_t pages;
+    uint64_t documents;
+};
+
+struct document_builder;
+
+struct document_builder *document_builder_create(
+    struct print_session *session,
+    const struct document_options *options);
+
+/* Flushes anything outstanding and frees the builder. The session is left
+ * open. */
+int document_builder_destroy(struct document_builder *builder);
+
+/* Places one label, starting a document and page as needed. bytes is the
+ * caller's estimate of what the label adds to the spool file and only
+ * feeds the flush policy. If it fails, the document is abandoned rather
+ * than printed with the failed label in it. */
+int document_builder_add(
+    struct document_builder *builder,
+    draw_label_fn draw,
+    void *context,
+    size_t bytes);
+
+/* Ends the current document if its age limit has passed. Call this when
+ * labels stop arriving so a part-filled document isn't held back. */
+int document_builder_poll(struct document_builder *builder);
+
+/* How long until document_builder_poll() could next end a document: the
+ * time left on the current one, or the whole age limit if none is open.
+ * UINT64_MAX if there's no age limit. */
+uint64_t document_builder_poll_ns(const struct document_builder *builder);
+
+/* Ends the current page and document, if any. */
+int document_builder_flush(struct document_builder *builder);
+
+void document_builder_get_stats(
+    const struct document_builder *builder,
+    struct document_stats *stats);
+
+#endif /* DOCUMENT_BUILDER_H */
@@ -0,0 +1,323 @@
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "encode_pool.h"
+#include "log.h"
+#include "thread.h"
+#include "timing.h"
+
+enum slot_state
+{
+    SLOT_FREE,
+    SLOT_QUEUED,
+    SLOT_DONE,
+};
+
+struct slot
+{
+    enum slot_state state;
+    unsigned char *payload;
+    size_t length;
+    size_t capacity;
+    struct encode_result result;
+};
+
+struct worker
+{
+    struct encode_pool *pool;
+    struct datamatrix_encoder *encoder;
+    struct thread thread;
+    int running;
+};
+
+struct encode_pool
+{
+    struct mutex lock;
+    struct cond work;
+    struct cond done;
+    int shutdown;
+
+    /* Sequence numbers only ever increase. released <= claimed <=
+     * submitted, and submitted - released never exceeds the window. */
+    uint64_t submitted;
+    uint64_t claimed;
+    uint64_t released;
+
+    struct slot *slots;
+    int window;
+
+    struct worker *workers;
+    int threads;
+};
+
+static void worker_main(void *arg)
+{
+    struct worker *worker = (struct worker *)arg;
+    struct encode_pool *pool = worker->pool;
+
+    for (;;)
+    {
+        struct slot *slot = NULL;
+        uint64_t sequence = 0;
+
+        mutex_lock(&pool->lock);
+
+        while (!pool->shutdown && pool->claimed == pool->submitted)
+            cond_wait(&pool->work, &pool->lock);
+
+        if (pool->claimed == pool->submitted)
+        {
+            mutex_unlock(&pool->lock);
+            break;
+        }
+
+        sequence = pool->claimed++;
+        slot = &pool->slots[sequence % (uint64_t)pool->window];
+
+        mutex_unlock(&pool->lock);
+
+        uint64_t start = timing_now_ns();
+
+        slot->result.sequence = sequence;
+        slot->result.status = datamatrix_encode(
+            worker->encoder, slot->payload, slot->length, &slot->result.symbol);
+        slot->result.encode_ns = timing_now_ns() - start;
+        slot->result.payload = slot->payload;
+        slot->result.length = slot->length;
+
+        mutex_lock(&pool->lock);
+        slot->state = SLOT_DONE;
+        cond_broadcast(&pool->done);
+        mutex_unlock(&pool->lock);
+    }
+}
+
+struct encode_pool *encode_pool_create(
+    const struct datamatrix_options *options,
+    struct symbol_cache *cache,
+    int threads,
+    int window)
+{
+    struct encode_pool *pool = NULL;
+
+    if (threads <= 0)
+        threads = thread_cpu_count();
+
+    /* Enough slack that a slow symbol doesn't stall the other workers
+     * while the head of the window waits for it. */
+    if (window <= 0)
+        window = threads * 4;
+
+    if (window < threads)
+        window = threads;
+
+    pool = (struct encode_pool *)calloc(1, sizeof(*pool));
+    if (pool == NULL)
+    {
+        log_error("Failed to allocate memory");
+        return NULL;
+    }
+
+    mutex_init(&pool->lock);
+    cond_init(&pool->work);
+    cond_init(&pool->done);
+
+    pool->window = window;
+    pool->slots = (struct slot *)calloc((size_t)window, sizeof(*pool->slots));
+    pool->workers = (struct worker *)calloc((size_t)threads, sizeof(*pool->workers));
+    if (pool->slots == NULL || pool->workers == NULL)
+    {
+        log_error("Failed to allocate memory");
+        goto error;
+    }
+
+    for (int i = 0; i < threads; i++)
+    {
+        struct worker *worker = &pool->workers[i];
+
+        worker->pool = pool;
+        worker->encoder = datamatrix_encoder_create(options);
+        if (worker->encoder == NULL)
+        {
+            log_error("Failed to create encoder for worker %d", i);
+            goto error;
+        }
+
+        worker->encoder->cache = cache;
+        pool->threads++;
+
+        if (thread_create(&worker->thread, worker_main, worker) < 0)
+        {
+            log_error("Failed to start worker %d", i);
+            goto error;
+        }
+
+        worker->running = 1;
+    }
+
+    return pool;
+
+error:
+    encode_pool_destroy(pool);
+
+    return NULL;
+}
+
+void encode_pool_destroy(struct encode_pool *pool)
+{
+    if (pool == NULL)
+        return;
+
+    mutex_lock(&pool->lock);
+    pool->shutdown = 1;
+    cond_broadcast(&pool->work);
+    mutex_unlock(&pool->lock);
+
+    for (int i = 0; i < pool->threads; i++)
+    {
+        struct worker *worker = &pool->workers[i];
+
+        if (worker->running)
+            thread_join(&worker->thread);
+
+        datamatrix_encoder_destroy(worker->encoder);
+    }
+
+    if (pool->slots != NULL)
+    {
+        for (int i = 0; i < pool->window; i++)
+        {
+            free(pool->slots[i].payload);
+            datamatrix_symbol_free(&pool->slots[i].result.symbol);
+        }
+
+        free(pool->slots);
+    }
+
+    free(pool->workers);
+
+    cond_destroy(&pool->done);
+    cond_destroy(&pool->work);
+    mutex_destroy(&pool->lock);
+
+    free(pool);
+}
+
+int encode_pool_threads(const struct encode_pool *pool)
+{
+    return pool->threads;
+}
+
+int encode_pool_submit(
+    struct encode_pool *pool,
+    const unsigned char *data,
+    size_t length,
+    uint64_t record)
+{
+    struct slot *slot = NULL;
+
+    mutex_lock(&pool->lock);
+
+    if (pool->submitted - pool->released >= (uint64_t)pool->window)
+    {
+        mutex_unlock(&pool->lock);
+        return -EAGAIN;
+    }
+
+    slot = &pool->slots[pool->submitted % (uint64_t)pool->window];
+
+    mutex_unlock(&pool->lock);
+
+    /* The slot is free and not visible to the workers until submitted is
+     * bumped, so the copy can happen outside the lock. */
+    if (length > slot->capacity)
+    {
+        unsigned char *payload = (unsigned char *)realloc(slot->payload, length);
+        if (payload == NULL)
+            return -ENOMEM;
+
+        slot->payload = payload;
+        slot->capacity = length;
+    }
+
+    memcpy(slot->payload, data, length);
+    slot->length = length;
+    slot->result.record = record;
+
+    mutex_lock(&pool->lock);
+    slot->state = SLOT_QUEUED;
+    pool->submitted++;
+    cond_signal(&pool->work);
+    mutex_unlock(&pool->lock);
+
+    return 0;
+}
+
+int encode_pool_pending(struct encode_pool *pool)
+{
+    int pending;
+
+    mutex_lock(&pool->lock);
+    pending = (int)(pool->submitted - pool->released);
+    mutex_unlock(&pool->lock);
+
+    return pending;
+}
+
+int encode_pool_full(struct encode_pool *pool)
+{
+    return encode_pool_pending(pool) >= pool->window;
+}
+
+int encode_pool_ready(struct encode_pool *pool)
+{
+    int ready = 0;
+
+    mutex_lock(&pool->lock);
+
+    if (pool->released != pool->submitted)
+        ready = pool->slots[pool->released % (uint64_t)pool->window].state == SLOT_DONE;
+
+    mutex_unlock(&pool->lock);
+
+    return ready;
+}
+
+int encode_pool_next(struct encode_pool *pool, struct encode_result **result)
+{
+    struct slot *slot = NULL;
+
+    mutex_lock(&pool->lock);
+
+    if (pool->released == pool->submitted)
+    {
+        mutex_unlock(&pool->lock);
+        return -ENOENT;
+    }
+
+    slot = &pool->slots[pool->released % (uint64_t)pool->window];
+
+    while (slot->state != SLOT_DONE)
+        cond_wait(&pool->done, &pool->lock);
+
+    mutex_unlock(&pool->lock);
+
+    *result = &slot->result;
+
+    return 0;
+}
+
+void encode_pool_release(struct encode_pool *pool, struct encode_result *result)
+{
+    struct slot *slot = NULL;
+
+    mutex_lock(&pool->lock);
+
+    slot = &pool->slots[result->sequence % (uint64_t)pool->window];
+    slot->state = SLOT_FREE;
+    pool->released++;
+
+    mutex_unlock(&pool->lock);
+}
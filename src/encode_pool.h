@@ -0,0 +1,68 @@
+#ifndef ENCODE_POOL_H
+#define ENCODE_POOL_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "datamatrix.h"
+
+/* A fixed set of worker threads, each with its own encoder, fed through a
+ * window of in-flight payloads. Results come back strictly in submission
+ * order however the workers finish. */
+struct encode_pool;
+
+struct encode_result
+{
+    uint64_t sequence;
+
+    /* The caller's number for the payload, from encode_pool_submit(). */
+    uint64_t record;
+
+    /* As datamatrix_encode(): 1 for a cache hit. */
+    int status;
+    uint64_t encode_ns;
+    struct datamatrix_symbol symbol;
+
+    /* The payload it was encoded from. */
+    const unsigned char *payload;
+    size_t length;
+};
+
+/* threads <= 0 means one worker per CPU. window is the number of payloads
+ * that may be in flight, <= 0 picks a few per worker. cache is optional
+ * and shared by every worker. */
+struct encode_pool *encode_pool_create(
+    const struct datamatrix_options *options,
+    struct symbol_cache *cache,
+    int threads,
+    int window);
+
+void encode_pool_destroy(struct encode_pool *pool);
+
+int encode_pool_threads(const struct encode_pool *pool);
+
+/* Copies the payload into the window. record comes back in its result.
+ * Returns -EAGAIN if the window is full - collect a result first. */
+int encode_pool_submit(
+    struct encode_pool *pool,
+    const unsigned char *data,
+    size_t length,
+    uint64_t record);
+
+/* Number of payloads submitted but not yet released. */
+int encode_pool_pending(struct encode_pool *pool);
+
+int encode_pool_full(struct encode_pool *pool);
+
+/* 1 if the oldest outstanding payload is encoded, so encode_pool_next()
+ * won't block. */
+int encode_pool_ready(struct encode_pool *pool);
+
+/* Blocks until the oldest outstanding payload is encoded. The result stays
+ * valid until it's handed back with encode_pool_release(), which must
+ * happen before the next call. Returns -ENOENT if nothing is outstanding. */
+int encode_pool_next(struct encode_pool *pool, struct encode_result **result);
+
+void encode_pool_release(struct encode_pool *pool, struct encode_result *result);
+
+#endif /* ENCODE_POOL_H */
@@ -0,0 +1,300 @@
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "expand.h"
+#include "thread.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define EXPAND_X86 1
+#include <immintrin.h>
+#endif
+
+static void expand_8bpp_scalar(
+    const unsigned char *modules,
+    int count,
+    int module_size,
+    int margin,
+    unsigned char *pixels)
+{
+    memset(pixels, 0xff, (size_t)margin);
+    pixels += margin;
+
+    for (int i = 0; i < count; i++, pixels += module_size)
+        memset(pixels, modules[i] ? 0x00 : 0xff, (size_t)module_size);
+
+    memset(pixels, 0xff, (size_t)margin);
+}
+
+static void pack_1bpp_scalar(const unsigned char *pixels, int width, unsigned char *bits)
+{
+    int x = 0;
+
+    for (; x + 8 <= width; x += 8)
+    {
+        unsigned char byte = 0;
+
+        for (int i = 0; i < 8; i++)
+            byte = (unsigned char)((byte << 1) | (pixels[x + i] < 0x80));
+
+        *bits++ = byte;
+    }
+
+    if (x < width)
+    {
+        unsigned char byte = 0;
+
+        for (int i = 0; x + i < width; i++)
+            byte |= (unsigned char)((pixels[x + i] < 0x80) << (7 - i));
+
+        *bits = byte;
+    }
+}
+
+static const struct expand_kernel scalar_kernel = {
+    .name = "scalar",
+    .expand_8bpp = expand_8bpp_scalar,
+    .pack_1bpp = pack_1bpp_scalar,
+};
+
+#ifdef EXPAND_X86
+
+/* Each module is written with whole vector stores. A store overhangs into
+ * the next module, which then overwrites it, so modules go left to right
+ * and the last few, whose overhang would run off the end of the line, are
+ * left to memset. The right margin is written last for the same reason. */
+
+__attribute__((target("sse2"))) static void expand_8bpp_sse2(
+    const unsigned char *modules,
+    int count,
+    int module_size,
+    int margin,
+    unsigned char *pixels)
+{
+    const __m128i light = _mm_set1_epi8((char)0xff);
+    unsigned char *end = pixels + 2 * margin + (size_t)count * module_size;
+    unsigned char *p = pixels + margin;
+    int i = 0;
+
+    memset(pixels, 0xff, (size_t)margin);
+
+    if (module_size == 1)
+    {
+        /* One pixel per module: light wherever the module is zero. What's
+         * left over goes through the general case below. */
+        for (; i + 16 <= count; i += 16, p += 16)
+        {
+            __m128i m = _mm_loadu_si128((const __m128i *)(modules + i));
+            _mm_storeu_si128((__m128i *)p, _mm_cmpeq_epi8(m, _mm_setzero_si128()));
+        }
+    }
+
+    if (module_size <= 16)
+    {
+        for (; i < count && p + 16 <= end; i++, p += module_size)
+            _mm_storeu_si128((__m128i *)p, modules[i] ? _mm_setzero_si128() : light);
+    }
+    else
+    {
+        for (; i < count; i++, p += module_size)
+        {
+            __m128i v = modules[i] ? _mm_setzero_si128() : light;
+            int j = 0;
+
+            for (; j + 16 <= module_size; j += 16)
+                _mm_storeu_si128((__m128i *)(p + j), v);
+
+            /* Finish with a store ending exactly on the module edge. */
+            if (j < module_size)
+                _mm_storeu_si128((__m128i *)(p + module_size - 16), v);
+        }
+    }
+
+    for (; i < count; i++, p += module_size)
+        memset(p, modules[i] ? 0x00 : 0xff, (size_t)module_size);
+
+    memset(p, 0xff, (size_t)margin);
+}
+
+__attribute__((target("sse2"))) static void pack_1bpp_sse2(
+    const unsigned char *pixels,
+    int width,
+    unsigned char *bits)
+{
+    int x = 0;
+
+    for (; x + 16 <= width; x += 16, bits += 2)
+    {
+        __m128i v = _mm_loadu_si128((const __m128i *)(pixels + x));
+
+        /* movemask puts the first pixel in the lowest bit, so reverse the
+         * pixels in each group of eight to get the first pixel in the top
+         * bit of each byte. */
+        v = _mm_shufflelo_epi16(v, _MM_SHUFFLE(0, 1, 2, 3));
+        v = _mm_shufflehi_epi16(v, _MM_SHUFFLE(0, 1, 2, 3));
+        v = _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+
+        unsigned int mask = ~(unsigned int)_mm_movemask_epi8(v);
+
+        bits[0] = (unsigned char)mask;
+        bits[1] = (unsigned char)(mask >> 8);
+    }
+
+    if (x < width)
+        pack_1bpp_scalar(pixels + x, width - x, bits);
+}
+
+static const struct expand_kernel sse2_kernel = {
+    .name = "sse2",
+    .expand_8bpp = expand_8bpp_sse2,
+    .pack_1bpp = pack_1bpp_sse2,
+};
+
+__attribute__((target("avx2"))) static void expand_8bpp_avx2(
+    const unsigned char *modules,
+    int count,
+    int module_size,
+    int margin,
+    unsigned char *pixels)
+{
+    const __m256i light = _mm256_set1_epi8((char)0xff);
+    unsigned char *end = pixels + 2 * margin + (size_t)count * module_size;
+    unsigned char *p = pixels + margin;
+    int i = 0;
+
+    memset(pixels, 0xff, (size_t)margin);
+
+    if (module_size == 1)
+    {
+        for (; i + 32 <= count; i += 32, p += 32)
+        {
+            __m256i m = _mm256_loadu_si256((const __m256i *)(modules + i));
+            _mm256_storeu_si256((__m256i *)p, _mm256_cmpeq_epi8(m, _mm256_setzero_si256()));
+        }
+
+        if (i + 16 <= count)
+        {
+            __m128i m = _mm_loadu_si128((const __m128i *)(modules + i));
+            _mm_storeu_si128((__m128i *)p, _mm_cmpeq_epi8(m, _mm_setzero_si128()));
+            i += 16;
+            p += 16;
+        }
+    }
+
+    if (module_size <= 32)
+    {
+        for (; i < count && p + 32 <= end; i++, p += module_size)
+            _mm256_storeu_si256((__m256i *)p, modules[i] ? _mm256_setzero_si256() : light);
+    }
+    else
+    {
+        for (; i < count; i++, p += module_size)
+        {
+            __m256i v = modules[i] ? _mm256_setzero_si256() : light;
+            int j = 0;
+
+            for (; j + 32 <= module_size; j += 32)
+                _mm256_storeu_si256((__m256i *)(p + j), v);
+
+            if (j < module_size)
+                _mm256_storeu_si256((__m256i *)(p + module_size - 32), v);
+        }
+    }
+
+    for (; i < count; i++, p += module_size)
+        memset(p, modules[i] ? 0x00 : 0xff, (size_t)module_size);
+
+    memset(p, 0xff, (size_t)margin);
+}
+
+__attribute__((target("avx2"))) static void pack_1bpp_avx2(
+    const unsigned char *pixels,
+    int width,
+    unsigned char *bits)
+{
+    const __m256i reverse = _mm256_setr_epi8(
+        7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8,
+        7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8);
+    int x = 0;
+
+    for (; x + 32 <= width; x += 32, bits += 4)
+    {
+        __m256i v = _mm256_loadu_si256((const __m256i *)(pixels + x));
+        uint32_t mask = ~(uint32_t)_mm256_movemask_epi8(_mm256_shuffle_epi8(v, reverse));
+
+        bits[0] = (unsigned char)mask;
+        bits[1] = (unsigned char)(mask >> 8);
+        bits[2] = (unsigned char)(mask >> 16);
+        bits[3] = (unsigned char)(mask >> 24);
+    }
+
+    if (x < width)
+        pack_1bpp_sse2(pixels + x, width - x, bits);
+}
+
+static const struct expand_kernel avx2_kernel = {
+    .name = "avx2",
+    .expand_8bpp = expand_8bpp_avx2,
+    .pack_1bpp = pack_1bpp_avx2,
+};
+
+#endif /* EXPAND_X86 */
+
+static const struct expand_kernel *supported[3];
+static int supported_count;
+static struct once detect_once = ONCE_INIT;
+
+static void detect(void)
+{
+    int count = 0;
+
+    supported[count++] = &scalar_kernel;
+
+#ifdef EXPAND_X86
+    __builtin_cpu_init();
+
+    if (__builtin_cpu_supports("sse2"))
+        supported[count++] = &sse2_kernel;
+
+    if (__builtin_cpu_supports("avx2"))
+        supported[count++] = &avx2_kernel;
+#endif
+
+    supported_count = count;
+}
+
+const struct expand_kernel *const *expand_kernels(int *count)
+{
+    thread_once(&detect_once, detect);
+
+    *count = supported_count;
+
+    return supported;
+}
+
+const struct expand_kernel *expand_kernel_best(void)
+{
+    static _Atomic(const struct expand_kernel *) best;
+    const struct expand_kernel *kernel = atomic_load(&best);
+    const struct expand_kernel *const *kernels = NULL;
+    const char *name = NULL;
+    int count = 0;
+
+    if (kernel != NULL)
+        return kernel;
+
+    kernels = expand_kernels(&count);
+    kernel = kernels[count - 1];
+
+    name = getenv("EXPAND_KERNEL");
+    for (int i = 0; name != NULL && i < count; i++)
+    {
+        if (strcmp(kernels[i]->name, name) == 0)
+            kernel = kernels[i];
+    }
+
+    atomic_store(&best, kernel);
+
+    return kernel;
+}
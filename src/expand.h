@@ -0,0 +1,35 @@
+#ifndef EXPAND_H
+#define EXPAND_H
+
+/* Kernels that turn a row of modules into a scanline. Every kernel gives
+ * exactly the same output as the scalar one; the SSE2 and AVX2 versions
+ * are only used when the CPU has them. Set $EXPAND_KERNEL to "scalar",
+ * "sse2" or "avx2" to pick one. */
+
+struct expand_kernel
+{
+    const char *name;
+
+    /* Writes margin + count * module_size + margin pixels of 8bpp grey,
+     * 0x00 for a dark module and 0xff for light and the margins. modules
+     * holds one byte per module, non-zero for dark. */
+    void (*expand_8bpp)(
+        const unsigned char *modules,
+        int count,
+        int module_size,
+        int margin,
+        unsigned char *pixels);
+
+    /* Packs 8bpp grey into 1bpp, most significant bit first, with a set
+     * bit for each pixel below 0x80. Bits past width in the last byte are
+     * cleared. */
+    void (*pack_1bpp)(const unsigned char *pixels, int width, unsigned char *bits);
+};
+
+/* The fastest kernel this CPU supports. */
+const struct expand_kernel *expand_kernel_best(void);
+
+/* Every kernel this CPU supports, slowest first. */
+const struct expand_kernel *const *expand_kernels(int *count);
+
+#endif /* EXPAND_H */
@@ -0,0 +1,225 @@
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <dmtx.h>
+
+#include "count_of.h"
+#include "expand.h"
+#include "timing.h"
+
+/* Checks every kernel against the scalar one, then times them rendering a
+ * whole symbol image against libdmtx's own way of doing it, one
+ * dmtxImageSetPixelValue() call per pixel. */
+
+#define SYMBOL_MODULES 144
+#define CANARY 0x5a
+#define MIN_RUN_NS 200000000ull
+
+static unsigned char modules[SYMBOL_MODULES * SYMBOL_MODULES];
+
+static void random_modules(unsigned char *out, int count)
+{
+    for (int i = 0; i < count; i++)
+        out[i] = (rand() & 1) ? (unsigned char)(1 + rand() % 255) : 0;
+}
+
+static int verify(const struct expand_kernel *const *kernels, int count)
+{
+    static unsigned char expected[8192], actual[8192];
+    static unsigned char expected_bits[1024], actual_bits[1024];
+    unsigned char row[200];
+    int cases = 0;
+
+    for (int n = 1; n <= 150; n += 7)
+    {
+        for (int module_size = 1; module_size <= 40; module_size++)
+        {
+            for (int margin = 0; margin <= 12; margin += 3)
+            {
+                int width = n * module_size + 2 * margin;
+                int bytes = (width + 7) / 8;
+
+                random_modules(row, n);
+
+                memset(expected, CANARY, sizeof(expected));
+                kernels[0]->expand_8bpp(row, n, module_size, margin, expected);
+                memset(expected_bits, CANARY, sizeof(expected_bits));
+                kernels[0]->pack_1bpp(expected, width, expected_bits);
+
+                for (int k = 1; k < count; k++)
+                {
+                    memset(actual, CANARY, sizeof(actual));
+                    kernels[k]->expand_8bpp(row, n, module_size, margin, actual);
+                    memset(actual_bits, CANARY, sizeof(actual_bits));
+                    kernels[k]->pack_1bpp(expected, width, actual_bits);
+
+                    /* Compare one past the end too, to catch overruns. */
+                    if (memcmp(expected, actual, (size_t)width + 1) != 0 ||
+                        memcmp(expected_bits, actual_bits, (size_t)bytes + 1) != 0)
+                    {
+                        printf(
+                            "%s differs from %s: %d modules of %d px, margin %d\n",
+                            kernels[k]->name,
+                            kernels[0]->name,
+                            n,
+                            module_size,
+                            margin);
+                        return -EINVAL;
+                    }
+                }
+
+                cases++;
+            }
+        }
+    }
+
+    printf("Verified %d kernels against scalar over %d rows\n", count, cases);
+
+    return 0;
+}
+
+static double naive_dmtx(int module_size, int margin, unsigned char *image)
+{
+    int width = SYMBOL_MODULES * module_size + 2 * margin;
+    DmtxImage *img = dmtxImageCreate(image, width, width, DmtxPack8bppK);
+    uint64_t start = timing_now_ns();
+    uint64_t elapsed = 0;
+    uint64_t pixels = 0;
+
+    if (img == NULL)
+        return 0.0;
+
+    do
+    {
+        for (int y = 0; y < width; y++)
+        {
+            int row = (y - margin) / module_size;
+
+            for (int x = 0; x < width; x++)
+            {
+                int col = (x - margin) / module_size;
+                int dark = y >= margin && x >= margin && row < SYMBOL_MODULES && col < SYMBOL_MODULES &&
+                           modules[row * SYMBOL_MODULES + col];
+
+                dmtxImageSetPixelValue(img, x, y, 0, dark ? 0x00 : 0xff);
+            }
+        }
+
+        pixels += (uint64_t)width * width;
+        elapsed = timing_now_ns() - start;
+    } while (elapsed < MIN_RUN_NS);
+
+    dmtxImageDestroy(&img);
+
+    return (double)pixels / timing_ns_to_s(elapsed) / 1e6;
+}
+
+static double kernel_render(
+    const struct expand_kernel *kernel,
+    int module_size,
+    int margin,
+    int packed,
+    unsigned char *image,
+    unsigned char *line)
+{
+    int width = SYMBOL_MODULES * module_size + 2 * margin;
+    size_t stride = packed ? ((size_t)width + 7) / 8 : (size_t)width;
+    uint64_t start = timing_now_ns();
+    uint64_t elapsed = 0;
+    uint64_t pixels = 0;
+
+    do
+    {
+        /* Margin rows are blank. */
+        memset(image, packed ? 0x00 : 0xff, stride * margin);
+        memset(image + stride * (width - margin), packed ? 0x00 : 0xff, stride * margin);
+
+        for (int row = 0; row < SYMBOL_MODULES; row++)
+        {
+            unsigned char *out = image + stride * (size_t)(margin + row * module_size);
+
+            if (packed)
+            {
+                kernel->expand_8bpp(modules + row * SYMBOL_MODULES, SYMBOL_MODULES, module_size, margin, line);
+                kernel->pack_1bpp(line, width, out);
+            }
+            else
+            {
+                kernel->expand_8bpp(modules + row * SYMBOL_MODULES, SYMBOL_MODULES, module_size, margin, out);
+            }
+
+            for (int i = 1; i < module_size; i++)
+                memcpy(out + stride * i, out, stride);
+        }
+
+        pixels += (uint64_t)width * width;
+        elapsed = timing_now_ns() - start;
+    } while (elapsed < MIN_RUN_NS);
+
+    return (double)pixels / timing_ns_to_s(elapsed) / 1e6;
+}
+
+int main(int argc, char **argv)
+{
+    static const int module_sizes[] = {1, 2, 3, 5, 8, 12, 16, 24};
+    const struct expand_kernel *const *kernels = NULL;
+    unsigned char *image = NULL;
+    unsigned char *line = NULL;
+    int count = 0;
+    int max_width = SYMBOL_MODULES * 24 + 2 * 48;
+
+    (void)argv;
+
+    if (argc > 1)
+    {
+        printf("Usage: %s\n", argv[0]);
+        return -EINVAL;
+    }
+
+    kernels = expand_kernels(&count);
+
+    if (verify(kernels, count) < 0)
+        return 1;
+
+    image = (unsigned char *)malloc((size_t)max_width * max_width);
+    line = (unsigned char *)malloc((size_t)max_width);
+    if (image == NULL || line == NULL)
+    {
+        printf("Failed to allocate memory\n");
+        return -ENOMEM;
+    }
+
+    random_modules(modules, SYMBOL_MODULES * SYMBOL_MODULES);
+
+    printf("Rendering a %dx%d symbol, margin of two modules, Mpixels/s\n", SYMBOL_MODULES, SYMBOL_MODULES);
+    printf("%-8s %-6s", "module", "dmtx");
+    for (int k = 0; k < count; k++)
+        printf(" %-8s %-8s", kernels[k]->name, "(1bpp)");
+    printf("\n");
+
+    for (int m = 0; m < COUNT_OF(module_sizes); m++)
+    {
+        int module_size = module_sizes[m];
+        int margin = 2 * module_size;
+
+        printf("%-8d %-6.0f", module_size, naive_dmtx(module_size, margin, image));
+
+        for (int k = 0; k < count; k++)
+        {
+            printf(
+                " %-8.0f %-8.0f",
+                kernel_render(kernels[k], module_size, margin, 0, image, line),
+                kernel_render(kernels[k], module_size, margin, 1, image, line));
+        }
+
+        printf("\n");
+        fflush(stdout);
+    }
+
+    free(line);
+    free(image);
+
+    return 0;
+}
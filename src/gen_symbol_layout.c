@@ -0,0 +1,322 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "count_of.h"
+
+/* Writes the symbol layout tables (symbol_layout.h) as C source, checked
+ * in as symbol_layout_tables.c. It doesn't use libdmtx: the sizes are
+ * ISO/IEC 16022's and the placement is the algorithm from its annex F.
+ * LabelBench checks the results against libdmtx. */
+
+struct size
+{
+    int rows;
+    int cols;
+    int region_rows;
+    int region_cols;
+    int horiz_regions;
+    int vert_regions;
+    int blocks;
+    int data_words;
+    int error_words;
+};
+
+/* In DmtxSymbolSize order: squares, then rectangles. */
+static const struct size sizes[] = {
+    {10, 10, 8, 8, 1, 1, 1, 3, 5},
+    {12, 12, 10, 10, 1, 1, 1, 5, 7},
+    {14, 14, 12, 12, 1, 1, 1, 8, 10},
+    {16, 16, 14, 14, 1, 1, 1, 12, 12},
+    {18, 18, 16, 16, 1, 1, 1, 18, 14},
+    {20, 20, 18, 18, 1, 1, 1, 22, 18},
+    {22, 22, 20, 20, 1, 1, 1, 30, 20},
+    {24, 24, 22, 22, 1, 1, 1, 36, 24},
+    {26, 26, 24, 24, 1, 1, 1, 44, 28},
+    {32, 32, 14, 14, 2, 2, 1, 62, 36},
+    {36, 36, 16, 16, 2, 2, 1, 86, 42},
+    {40, 40, 18, 18, 2, 2, 1, 114, 48},
+    {44, 44, 20, 20, 2, 2, 1, 144, 56},
+    {48, 48, 22, 22, 2, 2, 1, 174, 68},
+    {52, 52, 24, 24, 2, 2, 2, 204, 84},
+    {64, 64, 14, 14, 4, 4, 2, 280, 112},
+    {72, 72, 16, 16, 4, 4, 4, 368, 144},
+    {80, 80, 18, 18, 4, 4, 4, 456, 192},
+    {88, 88, 20, 20, 4, 4, 4, 576, 224},
+    {96, 96, 22, 22, 4, 4, 4, 696, 272},
+    {104, 104, 24, 24, 4, 4, 6, 816, 336},
+    {120, 120, 18, 18, 6, 6, 6, 1050, 408},
+    {132, 132, 20, 20, 6, 6, 8, 1304, 496},
+    {144, 144, 22, 22, 6, 6, 10, 1558, 620},
+    {8, 18, 6, 16, 1, 1, 1, 5, 7},
+    {8, 32, 6, 14, 2, 1, 1, 10, 11},
+    {12, 26, 10, 24, 1, 1, 1, 16, 14},
+    {12, 36, 10, 16, 2, 1, 1, 22, 18},
+    {16, 36, 14, 16, 2, 1, 1, 32, 24},
+    {16, 48, 14, 22, 2, 1, 1, 49, 28},
+};
+
+/* The mapping matrix being filled: the data regions without their finder
+ * and timing bars. Each cell is 0 while empty, else 8 * codeword + bit + 1,
+ * with the codeword from 0 and bit 0 the most significant. */
+struct placement
+{
+    int rows;
+    int cols;
+    int *cells;
+};
+
+static void place_module(struct placement *p, int row, int col, int codeword, int bit)
+{
+    if (row < 0)
+    {
+        row += p->rows;
+        col += 4 - ((p->rows + 4) % 8);
+    }
+
+    if (col < 0)
+    {
+        col += p->cols;
+        row += 4 - ((p->cols + 4) % 8);
+    }
+
+    p->cells[row * p->cols + col] = codeword * 8 + bit + 1;
+}
+
+/* The usual L shaped placement of a codeword, its last bit at row, col. */
+static void place_utah(struct placement *p, int row, int col, int codeword)
+{
+    place_module(p, row - 2, col - 2, codeword, 0);
+    place_module(p, row - 2, col - 1, codeword, 1);
+    place_module(p, row - 1, col - 2, codeword, 2);
+    place_module(p, row - 1, col - 1, codeword, 3);
+    place_module(p, row - 1, col, codeword, 4);
+    place_module(p, row, col - 2, codeword, 5);
+    place_module(p, row, col - 1, codeword, 6);
+    place_module(p, row, col, codeword, 7);
+}
+
+/* The four ways a codeword wraps round the corners. */
+static void place_corner(struct placement *p, int corner, int codeword)
+{
+    static const int offsets[4][8][2] = {
+        {{-1, 0}, {-1, 1}, {-1, 2}, {0, -2}, {0, -1}, {1, -1}, {2, -1}, {3, -1}},
+        {{-3, 0}, {-2, 0}, {-1, 0}, {0, -4}, {0, -3}, {0, -2}, {0, -1}, {1, -1}},
+        {{-3, 0}, {-2, 0}, {-1, 0}, {0, -2}, {0, -1}, {1, -1}, {2, -1}, {3, -1}},
+        {{-1, 0}, {-1, -1}, {0, -3}, {0, -2}, {0, -1}, {1, -3}, {1, -2}, {1, -1}},
+    };
+
+    /* Negative offsets count back from the last row or column. */
+    for (int bit = 0; bit < 8; bit++)
+    {
+        int row = offsets[corner][bit][0];
+        int col = offsets[corner][bit][1];
+
+        place_module(
+            p,
+            row < 0 ? p->rows + row : row,
+            col < 0 ? p->cols + col : col,
+            codeword,
+            bit);
+    }
+}
+
+static int empty(const struct placement *p, int row, int col)
+{
+    return p->cells[row * p->cols + col] == 0;
+}
+
+/* Returns the number of codewords placed. */
+static int place_all(struct placement *p)
+{
+    int codeword = 0;
+    int row = 4;
+    int col = 0;
+
+    do
+    {
+        if (row == p->rows && col == 0)
+            place_corner(p, 0, codeword++);
+
+        if (row == p->rows - 2 && col == 0 && p->cols % 4 != 0)
+            place_corner(p, 1, codeword++);
+
+        if (row == p->rows - 2 && col == 0 && p->cols % 8 == 4)
+            place_corner(p, 2, codeword++);
+
+        if (row == p->rows + 4 && col == 2 && p->cols % 8 == 0)
+            place_corner(p, 3, codeword++);
+
+        /* Up and to the right... */
+        do
+        {
+            if (row < p->rows && col >= 0 && empty(p, row, col))
+                place_utah(p, row, col, codeword++);
+
+            row -= 2;
+            col += 2;
+        } while (row >= 0 && col < p->cols);
+
+        row += 1;
+        col += 3;
+
+        /* ...then down and to the left. */
+        do
+        {
+            if (row >= 0 && col < p->cols && empty(p, row, col))
+                place_utah(p, row, col, codeword++);
+
+            row += 2;
+            col -= 2;
+        } while (row < p->rows && col >= 0);
+
+        row += 3;
+        col += 1;
+    } while (row < p->rows || col < p->cols);
+
+    return codeword;
+}
+
+/* Where a mapping matrix cell is in the whole symbol, counted along the
+ * rows from the top left. */
+static int module_index(const struct size *size, int row, int col)
+{
+    int symbol_row = row + 2 * (row / size->region_rows) + 1;
+    int symbol_col = col + 2 * (col / size->region_cols) + 1;
+
+    return symbol_row * size->cols + symbol_col;
+}
+
+/* Writes the size's bits table. The corner left empty in some sizes has a
+ * fixed pattern, dark at its bottom right and top left; *corner gets
+ * those two modules, or -1 if there's no such corner. */
+static int write_size(FILE *out, int index, const struct size *size, int corner[2])
+{
+    struct placement p;
+    int words = size->data_words + size->error_words;
+    int *bits = NULL;
+    int placed = 0;
+    int rc = 0;
+
+    p.rows = size->region_rows * size->vert_regions;
+    p.cols = size->region_cols * size->horiz_regions;
+    p.cells = (int *)calloc((size_t)p.rows * p.cols, sizeof(*p.cells));
+    bits = (int *)malloc((size_t)words * 8 * sizeof(*bits));
+
+    if (p.cells == NULL || bits == NULL)
+    {
+        printf("Failed to allocate memory\n");
+        rc = -1;
+        goto exit;
+    }
+
+    placed = place_all(&p);
+    if (placed != words)
+    {
+        printf("Placed %d codewords in a %dx%d symbol, not %d\n", placed, size->rows, size->cols, words);
+        rc = -1;
+        goto exit;
+    }
+
+    corner[0] = -1;
+    corner[1] = -1;
+
+    if (empty(&p, p.rows - 1, p.cols - 1))
+    {
+        corner[0] = module_index(size, p.rows - 1, p.cols - 1);
+        corner[1] = module_index(size, p.rows - 2, p.cols - 2);
+    }
+
+    for (int row = 0; row < p.rows; row++)
+    {
+        for (int col = 0; col < p.cols; col++)
+        {
+            int cell = p.cells[row * p.cols + col];
+
+            if (cell > 0)
+                bits[cell - 1] = module_index(size, row, col);
+        }
+    }
+
+    fprintf(out, "static const uint16_t bits_%d[%d] = {", index, words * 8);
+
+    for (int i = 0; i < words * 8; i++)
+        fprintf(out, "%s%d,", i % 12 == 0 ? "\n    " : " ", bits[i]);
+
+    fprintf(out, "\n};\n\n");
+
+exit:
+    free(p.cells);
+    free(bits);
+
+    return rc;
+}
+
+int main(int argc, char **argv)
+{
+    FILE *out = NULL;
+    int corners[COUNT_OF(sizes)][2];
+    int rc = 0;
+
+    if (argc != 2)
+    {
+        printf("Usage: %s <output.c>\n", argv[0]);
+        return 1;
+    }
+
+    out = fopen(argv[1], "w");
+    if (out == NULL)
+    {
+        printf("Failed to create \"%s\"\n", argv[1]);
+        return 1;
+    }
+
+    fprintf(out, "/* Generated by gen_symbol_layout.c. Don't edit; rebuild the\n");
+    fprintf(out, " * symbol_layout_tables target instead. */\n\n");
+    fprintf(out, "#include \"symbol_layout.h\"\n\n");
+
+    for (int i = 0; i < COUNT_OF(sizes) && rc == 0; i++)
+        rc = write_size(out, i, &sizes[i], corners[i]);
+
+    fprintf(out, "const struct symbol_layout symbol_layouts[SYMBOL_LAYOUT_COUNT] = {\n");
+
+    for (int i = 0; i < COUNT_OF(sizes) && rc == 0; i++)
+    {
+        const struct size *size = &sizes[i];
+
+        fprintf(out, "    {\n");
+        fprintf(out, "        .rows = %d,\n", size->rows);
+        fprintf(out, "        .cols = %d,\n", size->cols);
+        fprintf(out, "        .region_rows = %d,\n", size->region_rows);
+        fprintf(out, "        .region_cols = %d,\n", size->region_cols);
+        fprintf(out, "        .horiz_regions = %d,\n", size->horiz_regions);
+        fprintf(out, "        .vert_regions = %d,\n", size->vert_regions);
+        fprintf(out, "        .blocks = %d,\n", size->blocks);
+        fprintf(out, "        .data_words = %d,\n", size->data_words);
+        fprintf(out, "        .error_words = %d,\n", size->error_words);
+        fprintf(out, "        .bits = bits_%d,\n", i);
+
+        if (corners[i][0] >= 0)
+        {
+            fprintf(out, "        .corner_count = 2,\n");
+            fprintf(out, "        .corner = {%d, %d},\n", corners[i][0], corners[i][1]);
+        }
+
+        fprintf(out, "    },\n");
+    }
+
+    fprintf(out, "};\n");
+
+    if (fclose(out) != 0)
+    {
+        printf("Failed to write \"%s\"\n", argv[1]);
+        rc = -1;
+    }
+
+    if (rc < 0)
+    {
+        remove(argv[1]);
+        return 1;
+    }
+
+    return 0;
+}
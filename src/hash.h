@@ -0,0 +1,30 @@
+#ifndef HASH_H
+#define HASH_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#define HASH_FNV1A_INIT 2166136261u
+
+/* 32 bit FNV-1a. Pass HASH_FNV1A_INIT, or the result of a previous call
+ * to hash several fields as one. */
+static inline uint32_t hash_fnv1a(const void *data, size_t length, uint32_t hash)
+{
+    const unsigned char *bytes = (const unsigned char *)data;
+
+    for (size_t i = 0; i < length; i++)
+    {
+        hash ^= bytes[i];
+        hash *= 16777619u;
+    }
+
+    return hash;
+}
+
+static inline uint32_t hash_string(const char *text)
+{
+    return hash_fnv1a(text, strlen(text), HASH_FNV1A_INIT);
+}
+
+#endif /* HASH_H */
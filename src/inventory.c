@@ -0,0 +1,827 @@
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "inventory.h"
+#include "log.h"
+#include "text_record.h"
+#include "thread.h"
+#include "timing.h"
+
+#define INVENTORY_MAGIC "# printer inventory v1"
+#define DEFAULT_THREADS 16
+#define DEFAULT_TIMEOUT_MS 10000
+
+enum probe_state
+{
+    PROBE_WAITING,
+    PROBE_RUNNING,
+    PROBE_DONE,
+
+    /* Timed out. Whatever the probe comes back with is thrown away. */
+    PROBE_ABANDONED,
+};
+
+/* Shared by inventory_take() and the workers probing for it. A worker
+ * stuck in a probe that timed out can outlive inventory_take(), so the
+ * last one to let go of the run frees it. */
+struct probe_run
+{
+    const struct print_backend *backend;
+
+    struct mutex lock;
+    struct cond changed;
+    int refs;
+
+    /* The printers to probe, where each is in the inventory, and how each
+     * is getting on. Probes are handed out in order from next. */
+    struct inventory_printer *printers;
+    int *index;
+    enum probe_state *states;
+    uint64_t *started_ns;
+    int count;
+    int next;
+
+    /* Probes that are neither done nor abandoned. */
+    int remaining;
+
+    /* Workers that aren't stuck in a probe that timed out. */
+    int workers;
+};
+
+static void free_run(struct probe_run *run)
+{
+    for (int i = 0; i < run->count; i++)
+        printer_caps_free(&run->printers[i].caps);
+
+    free(run->printers);
+    free(run->index);
+    free(run->states);
+    free(run->started_ns);
+    cond_destroy(&run->changed);
+    mutex_destroy(&run->lock);
+    free(run);
+}
+
+static int copy_printer(struct inventory_printer *to, const struct inventory_printer *from)
+{
+    size_t size = from->caps.paper_count * sizeof(*from->caps.papers);
+
+    *to = *from;
+    to->caps.papers = NULL;
+
+    if (size == 0)
+        return 0;
+
+    to->caps.papers = (struct paper_info *)malloc(size);
+    if (to->caps.papers == NULL)
+    {
+        to->caps.paper_count = 0;
+        return -ENOMEM;
+    }
+
+    memcpy(to->caps.papers, from->caps.papers, size);
+
+    return 0;
+}
+
+/* The snapshot's copy of a printer, if it was probed successfully and its
+ * driver, port and processor are what they were. */
+static const struct inventory_printer *find_unchanged(
+    const struct inventory *previous,
+    const struct printer_info *info)
+{
+    if (previous == NULL)
+        return NULL;
+
+    for (int i = 0; i < previous->count; i++)
+    {
+        const struct inventory_printer *printer = &previous->printers[i];
+
+        if (strcmp(printer->info.name, info->name) != 0)
+            continue;
+
+        if (printer->status == 0 &&
+            strcmp(printer->info.port, info->port) == 0 &&
+            strcmp(printer->info.driver, info->driver) == 0 &&
+            strcmp(printer->info.processor, info->processor) == 0)
+            return printer;
+
+        return NULL;
+    }
+
+    return NULL;
+}
+
+static void probe(const struct print_backend *backend, struct inventory_printer *printer)
+{
+    uint64_t start_ns = timing_now_ns();
+    struct log_context context = {0, printer->info.name, "probe"};
+    struct log_context saved = log_set_context(&context);
+    int count = 0;
+
+    printer->status = backend->get_driver_version(
+        printer->info.name,
+        printer->driver_version,
+        sizeof(printer->driver_version));
+    if (printer->status < 0)
+        goto exit;
+
+    count = backend->get_datatypes(&printer->info, printer->datatypes, INVENTORY_DATATYPES);
+    if (count < 0)
+    {
+        printer->status = count;
+        goto exit;
+    }
+
+    printer->datatype_count = count < INVENTORY_DATATYPES ? count : INVENTORY_DATATYPES;
+
+    printer->status = backend->get_capabilities(printer->info.name, &printer->caps);
+
+exit:
+    printer->probe_ns = timing_now_ns() - start_ns;
+
+    log_debug("Probed in %.3f ms", timing_ns_to_s(printer->probe_ns) * 1e3);
+    log_set_context(&saved);
+}
+
+static void probe_worker(void *arg)
+{
+    struct probe_run *run = (struct probe_run *)arg;
+    int last = 0;
+
+    mutex_lock(&run->lock);
+
+    while (run->next < run->count)
+    {
+        int i = run->next++;
+        struct inventory_printer printer;
+
+        memset(&printer, 0, sizeof(printer));
+        printer.info = run->printers[i].info;
+
+        run->states[i] = PROBE_RUNNING;
+        run->started_ns[i] = timing_now_ns();
+
+        /* So the timeout is counted from now. */
+        cond_signal(&run->changed);
+
+        mutex_unlock(&run->lock);
+
+        probe(run->backend, &printer);
+
+        mutex_lock(&run->lock);
+
+        if (run->states[i] == PROBE_ABANDONED)
+        {
+            /* Given up on, and another worker has taken our place. */
+            printer_caps_free(&printer.caps);
+            goto exit;
+        }
+
+        run->printers[i] = printer;
+        run->states[i] = PROBE_DONE;
+        run->remaining--;
+        cond_signal(&run->changed);
+    }
+
+    run->workers--;
+
+exit:
+    last = --run->refs == 0;
+    mutex_unlock(&run->lock);
+
+    if (last)
+        free_run(run);
+}
+
+/* Called with the run locked. */
+static int start_worker(struct probe_run *run)
+{
+    struct thread thread;
+
+    run->refs++;
+
+    if (thread_create(&thread, probe_worker, run) < 0)
+    {
+        run->refs--;
+        return -EAGAIN;
+    }
+
+    thread_detach(&thread);
+    run->workers++;
+
+    return 0;
+}
+
+/* Called with the run locked. Gives up on probes that have run for longer
+ * than timeout_ns and returns how long until the next one would time out,
+ * or 0 if there's nothing running. */
+static uint64_t expire_probes(struct probe_run *run, uint64_t timeout_ns)
+{
+    uint64_t now = timing_now_ns();
+    uint64_t wait_ns = 0;
+
+    for (int i = 0; i < run->count; i++)
+    {
+        uint64_t elapsed = now - run->started_ns[i];
+
+        if (run->states[i] != PROBE_RUNNING)
+            continue;
+
+        if (elapsed < timeout_ns)
+        {
+            if (wait_ns == 0 || timeout_ns - elapsed < wait_ns)
+                wait_ns = timeout_ns - elapsed;
+
+            continue;
+        }
+
+        run->states[i] = PROBE_ABANDONED;
+        run->printers[i].status = -ETIMEDOUT;
+        run->printers[i].probe_ns = elapsed;
+        run->remaining--;
+        run->workers--;
+
+        /* The worker may never come back, so start another in its place. */
+        if (run->next < run->count)
+            start_worker(run);
+    }
+
+    return wait_ns;
+}
+
+static void probe_all(
+    struct probe_run *run,
+    const struct inventory_options *options,
+    struct inventory *inventory)
+{
+    int threads = options != NULL && options->threads > 0 ? options->threads : DEFAULT_THREADS;
+    int timeout_ms = options != NULL && options->timeout_ms > 0 ?
+        options->timeout_ms : DEFAULT_TIMEOUT_MS;
+    uint64_t timeout_ns = (uint64_t)timeout_ms * 1000000;
+
+    mutex_lock(&run->lock);
+
+    for (int i = 0; i < threads && i < run->count; i++)
+    {
+        if (start_worker(run) < 0)
+            break;
+    }
+
+    while (run->remaining > 0)
+    {
+        uint64_t wait_ns = expire_probes(run, timeout_ns);
+
+        if (run->remaining == 0)
+            break;
+
+        if (run->workers == 0)
+        {
+            /* No threads left to probe the rest with. */
+            log_error("Failed to start probe threads");
+
+            for (; run->next < run->count; run->next++)
+            {
+                run->states[run->next] = PROBE_DONE;
+                run->printers[run->next].status = -EAGAIN;
+                run->remaining--;
+            }
+
+            continue;
+        }
+
+        if (wait_ns == 0)
+            cond_wait(&run->changed, &run->lock);
+        else
+            cond_wait_ms(&run->changed, &run->lock, (int)((wait_ns + 999999) / 1000000));
+    }
+
+    for (int i = 0; i < run->count; i++)
+    {
+        struct inventory_printer *printer = &inventory->printers[run->index[i]];
+
+        /* The caps move into the inventory. */
+        *printer = run->printers[i];
+        memset(&run->printers[i].caps, 0, sizeof(run->printers[i].caps));
+
+        inventory->probed++;
+
+        if (printer->status == -ETIMEDOUT)
+            inventory->timed_out++;
+        else if (printer->status < 0)
+            inventory->failed++;
+    }
+
+    mutex_unlock(&run->lock);
+}
+
+int inventory_take(
+    const struct print_backend *backend,
+    const struct inventory *previous,
+    const struct inventory_options *options,
+    struct inventory *inventory)
+{
+    int rc = 0;
+    uint64_t start_ns = timing_now_ns();
+    struct printer_info *infos = NULL;
+    int count = 0;
+    struct probe_run *run = NULL;
+    int last = 0;
+
+    memset(inventory, 0, sizeof(*inventory));
+
+    rc = backend->enum_printers(&infos, &count);
+    if (rc < 0)
+    {
+        log_error("Failed to get printer info");
+        return rc;
+    }
+
+    /* No printers, so nothing to probe. */
+    if (count == 0)
+    {
+        free(infos);
+        inventory->elapsed_ns = timing_now_ns() - start_ns;
+        return 0;
+    }
+
+    run = (struct probe_run *)calloc(1, sizeof(*run));
+    inventory->printers = (struct inventory_printer *)calloc(
+        count, sizeof(*inventory->printers));
+    if (run == NULL || inventory->printers == NULL)
+    {
+        free(run);
+        run = NULL;
+        rc = -ENOMEM;
+        goto error;
+    }
+
+    mutex_init(&run->lock);
+    cond_init(&run->changed);
+    run->backend = backend;
+    run->refs = 1;
+
+    run->printers = (struct inventory_printer *)calloc(count, sizeof(*run->printers));
+    run->index = (int *)calloc(count, sizeof(*run->index));
+    run->states = (enum probe_state *)calloc(count, sizeof(*run->states));
+    run->started_ns = (uint64_t *)calloc(count, sizeof(*run->started_ns));
+    if (run->printers == NULL || run->index == NULL ||
+        run->states == NULL || run->started_ns == NULL)
+    {
+        rc = -ENOMEM;
+        goto error;
+    }
+
+    inventory->count = count;
+
+    for (int i = 0; i < count; i++)
+    {
+        const struct inventory_printer *unchanged = find_unchanged(previous, &infos[i]);
+
+        if (unchanged != NULL)
+        {
+            if (copy_printer(&inventory->printers[i], unchanged) < 0)
+            {
+                rc = -ENOMEM;
+                goto error;
+            }
+
+            inventory->printers[i].reused = 1;
+            inventory->printers[i].probe_ns = 0;
+            inventory->reused++;
+            continue;
+        }
+
+        inventory->printers[i].info = infos[i];
+        run->printers[run->count].info = infos[i];
+        run->index[run->count] = i;
+        run->count++;
+    }
+
+    run->remaining = run->count;
+
+    probe_all(run, options, inventory);
+
+    inventory->elapsed_ns = timing_now_ns() - start_ns;
+
+    goto exit;
+
+error:
+    log_error("Failed to allocate memory");
+    inventory_free(inventory);
+
+exit:
+    if (run != NULL)
+    {
+        mutex_lock(&run->lock);
+        last = --run->refs == 0;
+        mutex_unlock(&run->lock);
+
+        if (last)
+            free_run(run);
+    }
+
+    free(infos);
+
+    return rc;
+}
+
+void inventory_free(struct inventory *inventory)
+{
+    for (int i = 0; i < inventory->count; i++)
+        printer_caps_free(&inventory->printers[i].caps);
+
+    free(inventory->printers);
+    memset(inventory, 0, sizeof(*inventory));
+}
+
+static int parse_printer(char *line, struct inventory_printer *printer)
+{
+    char *cursor = line + strlen("PRINTER");
+    struct printer_info *info = &printer->info;
+
+    memset(printer, 0, sizeof(*printer));
+
+    if (text_record_next_token(&cursor, info->name, sizeof(info->name)) < 0 ||
+        text_record_next_token(&cursor, info->port, sizeof(info->port)) < 0 ||
+        text_record_next_token(&cursor, info->driver, sizeof(info->driver)) < 0 ||
+        text_record_next_token(&cursor, info->processor, sizeof(info->processor)) < 0 ||
+        text_record_next_token(
+            &cursor, printer->driver_version, sizeof(printer->driver_version)) < 0 ||
+        text_record_next_int(&cursor, &printer->status) < 0 ||
+        text_record_next_int(&cursor, &printer->datatype_count) < 0 ||
+        text_record_next_int(&cursor, &printer->caps.dpi_x) < 0 ||
+        text_record_next_int(&cursor, &printer->caps.dpi_y) < 0 ||
+        text_record_next_int(&cursor, &printer->caps.colour) < 0 ||
+        text_record_next_int(&cursor, &printer->caps.paper_count) < 0 ||
+        printer->datatype_count < 0 || printer->datatype_count > INVENTORY_DATATYPES ||
+        printer->caps.paper_count < 0)
+        return -EINVAL;
+
+    if (printer->caps.paper_count == 0)
+        return 0;
+
+    printer->caps.papers = (struct paper_info *)calloc(
+        printer->caps.paper_count, sizeof(*printer->caps.papers));
+    if (printer->caps.papers == NULL)
+        return -ENOMEM;
+
+    return 0;
+}
+
+static int parse_paper(char *line, struct paper_info *paper)
+{
+    char *cursor = line + strlen("PAPER");
+    int size = 0;
+
+    if (text_record_next_int(&cursor, &size) < 0 ||
+        text_record_next_int(&cursor, &paper->width) < 0 ||
+        text_record_next_int(&cursor, &paper->height) < 0 ||
+        text_record_next_token(&cursor, paper->name, sizeof(paper->name)) < 0)
+        return -EINVAL;
+
+    paper->size = (short)size;
+
+    return 0;
+}
+
+static int load(struct inventory *inventory, FILE *in)
+{
+    char line[1024];
+    struct inventory_printer *printer = NULL;
+    int capacity = 0;
+    int datatypes = 0;
+    int papers = 0;
+
+    if (fgets(line, sizeof(line), in) == NULL ||
+        strncmp(line, INVENTORY_MAGIC, strlen(INVENTORY_MAGIC)) != 0)
+    {
+        log_warn("Ignoring printer inventory with unknown format");
+        return -EINVAL;
+    }
+
+    while (fgets(line, sizeof(line), in) != NULL)
+    {
+        if (strncmp(line, "PRINTER ", 8) == 0)
+        {
+            if (printer != NULL)
+                goto error;
+
+            if (inventory->count == capacity)
+            {
+                struct inventory_printer *grown = NULL;
+
+                capacity = capacity > 0 ? capacity * 2 : 16;
+                grown = (struct inventory_printer *)realloc(
+                    inventory->printers, capacity * sizeof(*grown));
+                if (grown == NULL)
+                    goto error;
+
+                inventory->printers = grown;
+            }
+
+            printer = &inventory->printers[inventory->count++];
+            if (parse_printer(line, printer) < 0)
+                goto error;
+
+            datatypes = 0;
+            papers = 0;
+        }
+        else if (strncmp(line, "DATATYPE ", 9) == 0)
+        {
+            char *cursor = line + strlen("DATATYPE");
+
+            if (printer == NULL || datatypes >= printer->datatype_count)
+                goto error;
+
+            if (text_record_next_token(
+                    &cursor, printer->datatypes[datatypes], DATATYPE_NAME_LENGTH) < 0)
+                goto error;
+
+            datatypes++;
+        }
+        else if (strncmp(line, "PAPER ", 6) == 0)
+        {
+            if (printer == NULL || datatypes < printer->datatype_count ||
+                papers >= printer->caps.paper_count)
+                goto error;
+
+            if (parse_paper(line, &printer->caps.papers[papers]) < 0)
+                goto error;
+
+            papers++;
+        }
+        else
+        {
+            goto error;
+        }
+
+        if (printer != NULL && datatypes == printer->datatype_count &&
+            papers == printer->caps.paper_count)
+            printer = NULL;
+    }
+
+    if (printer != NULL)
+        goto error;
+
+    return 0;
+
+error:
+    log_warn("Ignoring corrupt printer inventory");
+
+    return -EINVAL;
+}
+
+int inventory_load(struct inventory *inventory, const char *path)
+{
+    int rc = 0;
+    FILE *in = NULL;
+
+    memset(inventory, 0, sizeof(*inventory));
+
+    in = fopen(path, "r");
+    if (in == NULL)
+        return -ENOENT;
+
+    rc = load(inventory, in);
+    if (rc < 0)
+        inventory_free(inventory);
+
+    fclose(in);
+
+    return rc;
+}
+
+int inventory_save(const struct inventory *inventory, const char *path)
+{
+    int rc = 0;
+    FILE *out = NULL;
+    char temp_path[520];
+
+    snprintf(temp_path, sizeof(temp_path), "%s.tmp", path);
+
+    out = fopen(temp_path, "w");
+    if (out == NULL)
+    {
+        log_error("Failed to create \"%s\"", temp_path);
+        return -EIO;
+    }
+
+    fprintf(out, "%s\n", INVENTORY_MAGIC);
+
+    for (int i = 0; i < inventory->count; i++)
+    {
+        const struct inventory_printer *printer = &inventory->printers[i];
+
+        fprintf(out, "PRINTER ");
+        text_record_write_string(out, printer->info.name);
+        fputc(' ', out);
+        text_record_write_string(out, printer->info.port);
+        fputc(' ', out);
+        text_record_write_string(out, printer->info.driver);
+        fputc(' ', out);
+        text_record_write_string(out, printer->info.processor);
+        fputc(' ', out);
+        text_record_write_string(out, printer->driver_version);
+        fprintf(
+            out,
+            " %d %d %d %d %d %d\n",
+            printer->status,
+            printer->datatype_count,
+            printer->caps.dpi_x,
+            printer->caps.dpi_y,
+            printer->caps.colour,
+            printer->caps.paper_count);
+
+        for (int j = 0; j < printer->datatype_count; j++)
+        {
+            fprintf(out, "DATATYPE ");
+            text_record_write_string(out, printer->datatypes[j]);
+            fputc('\n', out);
+        }
+
+        for (int j = 0; j < printer->caps.paper_count; j++)
+        {
+            const struct paper_info *paper = &printer->caps.papers[j];
+
+            fprintf(out, "PAPER %d %d %d ", paper->size, paper->width, paper->height);
+            text_record_write_string(out, paper->name);
+            fputc('\n', out);
+        }
+    }
+
+    if (fclose(out) != 0)
+    {
+        log_error("Failed to write \"%s\"", temp_path);
+        rc = -EIO;
+        goto exit;
+    }
+
+    /* rename() won't replace an existing file on Windows. */
+    remove(path);
+
+    if (rename(temp_path, path) != 0)
+    {
+        log_error("Failed to replace \"%s\"", path);
+        rc = -EIO;
+        goto exit;
+    }
+
+exit:
+    if (rc < 0)
+        remove(temp_path);
+
+    return rc;
+}
+
+static const char *status_name(int status)
+{
+    if (status == 0)
+        return "ok";
+
+    return status == -ETIMEDOUT ? "timed out" : "failed";
+}
+
+static void write_json_field(FILE *out, const char *name, const char *value)
+{
+    fprintf(out, "      \"%s\": ", name);
+    text_record_write_json_string(out, value);
+    fprintf(out, ",\n");
+}
+
+void inventory_write_json(const struct inventory *inventory, FILE *out)
+{
+    fprintf(out, "{\n");
+    fprintf(out, "  \"printers\": [\n");
+
+    for (int i = 0; i < inventory->count; i++)
+    {
+        const struct inventory_printer *printer = &inventory->printers[i];
+
+        fprintf(out, "    {\n");
+        write_json_field(out, "name", printer->info.name);
+        write_json_field(out, "port", printer->info.port);
+        write_json_field(out, "driver", printer->info.driver);
+        write_json_field(out, "processor", printer->info.processor);
+        write_json_field(out, "driver_version", printer->driver_version);
+        write_json_field(out, "status", status_name(printer->status));
+        fprintf(out, "      \"error\": %d,\n", -printer->status);
+        fprintf(out, "      \"reused\": %s,\n", printer->reused ? "true" : "false");
+        fprintf(out, "      \"probe_ms\": %.3f,\n", (double)printer->probe_ns / 1e6);
+
+        fprintf(out, "      \"datatypes\": [");
+        for (int j = 0; j < printer->datatype_count; j++)
+        {
+            if (j > 0)
+                fprintf(out, ", ");
+
+            text_record_write_json_string(out, printer->datatypes[j]);
+        }
+        fprintf(out, "],\n");
+
+        fprintf(out, "      \"colour\": %s,\n", printer->caps.colour ? "true" : "false");
+        fprintf(out, "      \"dpi_x\": %d,\n", printer->caps.dpi_x);
+        fprintf(out, "      \"dpi_y\": %d,\n", printer->caps.dpi_y);
+
+        fprintf(out, "      \"papers\": [");
+        for (int j = 0; j < printer->caps.paper_count; j++)
+        {
+            const struct paper_info *paper = &printer->caps.papers[j];
+
+            fprintf(out, "%s\n        {\"size\": %d, \"name\": ", j > 0 ? "," : "", paper->size);
+            text_record_write_json_string(out, paper->name);
+            fprintf(out, ", \"width\": %d, \"height\": %d}", paper->width, paper->height);
+        }
+        fprintf(out, "%s]\n", printer->caps.paper_count > 0 ? "\n      " : "");
+
+        fprintf(out, "    }%s\n", i + 1 < inventory->count ? "," : "");
+    }
+
+    fprintf(out, "  ],\n");
+    fprintf(out, "  \"probed\": %d,\n", inventory->probed);
+    fprintf(out, "  \"reused\": %d,\n", inventory->reused);
+    fprintf(out, "  \"failed\": %d,\n", inventory->failed);
+    fprintf(out, "  \"timed_out\": %d,\n", inventory->timed_out);
+    fprintf(out, "  \"elapsed_ms\": %.3f\n", (double)inventory->elapsed_ns / 1e6);
+    fprintf(out, "}\n");
+}
+
+static void write_csv_field(FILE *out, const char *text, int last)
+{
+    if (strpbrk(text, ",\"\r\n") == NULL)
+    {
+        fputs(text, out);
+    }
+    else
+    {
+        fputc('"', out);
+
+        for (; *text != '\0'; text++)
+        {
+            if (*text == '"')
+                fputc('"', out);
+
+            fputc(*text, out);
+        }
+
+        fputc('"', out);
+    }
+
+    fputc(last ? '\n' : ',', out);
+}
+
+void inventory_write_csv(const struct inventory *inventory, FILE *out)
+{
+    fprintf(
+        out,
+        "name,port,driver,processor,driver_version,status,reused,probe_ms,"
+        "datatypes,colour,dpi_x,dpi_y,papers\n");
+
+    for (int i = 0; i < inventory->count; i++)
+    {
+        const struct inventory_printer *printer = &inventory->printers[i];
+        char list[1024];
+        size_t length = 0;
+
+        write_csv_field(out, printer->info.name, 0);
+        write_csv_field(out, printer->info.port, 0);
+        write_csv_field(out, printer->info.driver, 0);
+        write_csv_field(out, printer->info.processor, 0);
+        write_csv_field(out, printer->driver_version, 0);
+        write_csv_field(out, status_name(printer->status), 0);
+        fprintf(out, "%d,%.3f,", printer->reused, (double)printer->probe_ns / 1e6);
+
+        list[0] = '\0';
+        for (int j = 0; j < printer->datatype_count && length < sizeof(list); j++)
+        {
+            length += snprintf(
+                list + length,
+                sizeof(list) - length,
+                "%s%s",
+                j > 0 ? ";" : "",
+                printer->datatypes[j]);
+        }
+        write_csv_field(out, list, 0);
+
+        fprintf(out, "%d,%d,%d,", printer->caps.colour, printer->caps.dpi_x, printer->caps.dpi_y);
+
+        list[0] = '\0';
+        length = 0;
+        for (int j = 0; j < printer->caps.paper_count && length < sizeof(list); j++)
+        {
+            const struct paper_info *paper = &printer->caps.papers[j];
+
+            length += snprintf(
+                list + length,
+                sizeof(list) - length,
+                "%s%s %dx%d",
+                j > 0 ? ";" : "",
+                paper->name,
+                paper->width,
+                paper->height);
+        }
+        write_csv_field(out, list, 1);
+    }
+}
@@ -0,0 +1,83 @@
+#ifndef INVENTORY_H
+#define INVENTORY_H
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "print_backend.h"
+
+/* A snapshot of every printer a backend knows: what EnumPrinters says of
+ * it, its datatypes, driver version and capabilities.
+ *
+ * Probing a network printer is a round trip per query, and a print server
+ * can have hundreds of queues, so printers are probed on a set of threads
+ * at once. A probe that hangs is given up on after a timeout and the
+ * printer is listed as timed out. The thread stuck in it is left to finish
+ * on its own and a new one takes its place.
+ *
+ * Given the last snapshot, only printers that are new or whose driver,
+ * port or processor have changed are probed again. Snapshots are saved in
+ * the same line format as the capability cache. */
+
+#define INVENTORY_DATATYPES 16
+
+struct inventory_printer
+{
+    struct printer_info info;
+    char driver_version[DRIVER_VERSION_LENGTH];
+
+    /* 0, or what the probe failed with: -ETIMEDOUT if it didn't finish in
+     * time. Printers that failed have no datatypes or capabilities. */
+    int status;
+
+    /* Copied from the last snapshot rather than probed. */
+    int reused;
+    uint64_t probe_ns;
+
+    char datatypes[INVENTORY_DATATYPES][DATATYPE_NAME_LENGTH];
+    int datatype_count;
+
+    struct printer_caps caps;
+};
+
+struct inventory
+{
+    struct inventory_printer *printers;
+    int count;
+
+    int probed;
+    int reused;
+    int failed;
+    int timed_out;
+    uint64_t elapsed_ns;
+};
+
+struct inventory_options
+{
+    /* Probes at once, <= 0 for a default. */
+    int threads;
+
+    /* How long a printer's probe may take, <= 0 for a default. */
+    int timeout_ms;
+};
+
+/* Enumerates the printers and probes those that previous, which may be
+ * NULL, doesn't already have. */
+int inventory_take(
+    const struct print_backend *backend,
+    const struct inventory *previous,
+    const struct inventory_options *options,
+    struct inventory *inventory);
+
+void inventory_free(struct inventory *inventory);
+
+/* Returns -ENOENT if there's no snapshot at path. */
+int inventory_load(struct inventory *inventory, const char *path);
+int inventory_save(const struct inventory *inventory, const char *path);
+
+void inventory_write_json(const struct inventory *inventory, FILE *out);
+
+/* One row per printer, with papers and datatypes joined by ';'. */
+void inventory_write_csv(const struct inventory *inventory, FILE *out);
+
+#endif /* INVENTORY_H */
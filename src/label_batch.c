@@ -0,0 +1,674 @@
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "encode_pool.h"
+#include "label_batch.h"
+#include "log.h"
+#include "symbol_cache.h"
+#include "thread.h"
+#include "timing.h"
+
+/* Anything bigger can't fit in the largest symbol anyway. */
+#define MAX_PAYLOAD_LENGTH 4096
+
+/* The longest the flusher sleeps: how late past its age limit a document
+ * can end, and how long an encoded symbol can wait while input is idle. */
+#define FLUSH_CHECK_MS 100
+
+static int reserve(struct payload_reader *reader, size_t size)
+{
+    unsigned char *buffer = NULL;
+
+    if (size <= reader->capacity)
+        return 0;
+
+    buffer = (unsigned char *)realloc(reader->buffer, size);
+    if (buffer == NULL)
+        return -ENOMEM;
+
+    reader->buffer = buffer;
+    reader->capacity = size;
+
+    return 0;
+}
+
+int payload_reader_open(
+    struct payload_reader *reader,
+    const char *path,
+    enum payload_format format)
+{
+    int rc = 0;
+
+    memset(reader, 0, sizeof(*reader));
+    reader->format = format;
+
+    if (strcmp(path, "-") == 0)
+    {
+        reader->in = stdin;
+    }
+    else
+    {
+        reader->in = fopen(path, "rb");
+        if (reader->in == NULL)
+        {
+            log_error("Failed to open \"%s\"", path);
+            return -ENOENT;
+        }
+    }
+
+    /* One allocation up front covers every valid record: in lines, the
+     * payload, a CR LF and the terminator. */
+    rc = reserve(reader, MAX_PAYLOAD_LENGTH + 3);
+    if (rc < 0)
+    {
+        log_error("Failed to allocate memory");
+        payload_reader_close(reader);
+        return rc;
+    }
+
+    return 0;
+}
+
+static int next_line(
+    struct payload_reader *reader,
+    const unsigned char **data,
+    size_t *length)
+{
+    char *line = (char *)reader->buffer;
+
+    for (;;)
+    {
+        if (fgets(line, (int)reader->capacity, reader->in) == NULL)
+            return ferror(reader->in) ? -EIO : 0;
+
+        reader->record++;
+
+        size_t n = strlen(line);
+        if (n == reader->capacity - 1 && line[n - 1] != '\n' && !feof(reader->in))
+        {
+            log_error("Payload %llu is too long", (unsigned long long)reader->record);
+
+            /* Skip the rest of the line so we stay in sync. */
+            int c;
+            while ((c = fgetc(reader->in)) != EOF && c != '\n')
+                ;
+
+            return -E2BIG;
+        }
+
+        while (n > 0 && (line[n - 1] == '\n' || line[n - 1] == '\r'))
+            n--;
+
+        /* The buffer also takes a line one over with a bare LF. */
+        if (n > MAX_PAYLOAD_LENGTH)
+        {
+            log_error("Payload %llu is too long", (unsigned long long)reader->record);
+            return -E2BIG;
+        }
+
+        if (n == 0)
+            continue;
+
+        *data = reader->buffer;
+        *length = n;
+
+        return 1;
+    }
+}
+
+static int next_length_prefixed(
+    struct payload_reader *reader,
+    const unsigned char **data,
+    size_t *length)
+{
+    unsigned char header[4];
+    size_t n = 0;
+    size_t got = 0;
+
+    got = fread(header, 1, sizeof(header), reader->in);
+    if (got == 0 && feof(reader->in))
+        return 0;
+
+    if (got != sizeof(header))
+    {
+        log_error("Truncated length prefix");
+        return -EIO;
+    }
+
+    reader->record++;
+
+    n = ((size_t)header[0] << 24) | ((size_t)header[1] << 16) |
+        ((size_t)header[2] << 8) | (size_t)header[3];
+
+    if (n > MAX_PAYLOAD_LENGTH)
+    {
+        log_error("Payload %llu is too long", (unsigned long long)reader->record);
+        return -E2BIG;
+    }
+
+    if (fread(reader->buffer, 1, n, reader->in) != n)
+    {
+        log_error("Truncated payload");
+        return -EIO;
+    }
+
+    *data = reader->buffer;
+    *length = n;
+
+    return 1;
+}
+
+int payload_reader_next(
+    struct payload_reader *reader,
+    const unsigned char **data,
+    size_t *length)
+{
+    if (reader->format == PAYLOAD_FORMAT_LENGTH_PREFIXED)
+        return next_length_prefixed(reader, data, length);
+
+    return next_line(reader, data, length);
+}
+
+void payload_reader_close(struct payload_reader *reader)
+{
+    if (reader->in != NULL && reader->in != stdin)
+        fclose(reader->in);
+
+    if (reader->buffer != NULL)
+        free(reader->buffer);
+
+    memset(reader, 0, sizeof(*reader));
+}
+
+/* Where encoded symbols go. Either destination may be NULL. */
+struct batch_output
+{
+    FILE *out;
+    struct document_builder *document;
+
+    /* Optional, shared with the encoders. */
+    struct symbol_cache *cache;
+
+    /* Scratch space for rendering labels. */
+    struct bitmap bitmap;
+
+    /* With an age limit on documents, a thread of its own ends them on
+     * time even while the input is idle and the batch is blocked reading,
+     * first collecting whatever the pool has encoded so that isn't held
+     * back either. output_lock guards the builder, the pool's results and
+     * the stats between the two. */
+    struct mutex output_lock;
+    struct cond flusher_wake;
+    struct thread flusher;
+    int flusher_running;
+    int flusher_stop;
+    int flusher_rc;
+
+    /* The parallel batch's, while it runs. */
+    struct encode_pool *pool;
+    const struct datamatrix_options *options;
+    struct batch_stats *stats;
+};
+
+struct label
+{
+    const struct datamatrix_options *options;
+    const unsigned char *data;
+    size_t length;
+    const struct datamatrix_symbol *symbol;
+    struct symbol_cache *cache;
+    struct bitmap *bitmap;
+};
+
+static int draw_label(struct print_session *session, const struct rect *cell, void *context)
+{
+    const struct label *label = (const struct label *)context;
+    int module_size = label->options->module_size;
+    int module_height = 0;
+    int rc = 0;
+
+    if (label->cache == NULL)
+        return datamatrix_draw(session, label->symbol, cell, module_size, label->bitmap);
+
+    module_height = datamatrix_module_height(session, module_size);
+
+    rc = symbol_cache_get_bitmap(
+        label->cache,
+        label->options,
+        label->data,
+        label->length,
+        module_size,
+        module_height,
+        0,
+        label->bitmap);
+    if (rc < 0)
+        return rc;
+
+    if (rc == 0)
+    {
+        rc = datamatrix_render(label->symbol, module_size, module_height, 0, label->bitmap);
+        if (rc < 0)
+            return rc;
+
+        symbol_cache_put_bitmap(
+            label->cache,
+            label->options,
+            label->data,
+            label->length,
+            module_size,
+            module_height,
+            0,
+            label->bitmap);
+    }
+
+    return datamatrix_place(session, cell, label->bitmap);
+}
+
+/* Writes and/or prints one symbol. Returns the PBM octets written or a
+ * negative errno. */
+static int output_symbol(
+    const struct datamatrix_options *options,
+    const unsigned char *data,
+    size_t length,
+    const struct datamatrix_symbol *symbol,
+    struct batch_output *output)
+{
+    int rc = 0;
+    int written = 0;
+
+    if (output->out != NULL)
+    {
+        written = datamatrix_write_pbm(output->out, symbol, options->module_size, options->margin_size);
+        if (written < 0)
+            return written;
+    }
+
+    if (output->document != NULL)
+    {
+        const struct label label = {
+            .options = options,
+            .data = data,
+            .length = length,
+            .symbol = symbol,
+            .cache = output->cache,
+            .bitmap = &output->bitmap,
+        };
+        size_t side = (size_t)options->module_size;
+
+        /* Roughly what the symbol costs the spooler as a 1bpp bitmap. */
+        rc = document_builder_add(
+            output->document,
+            draw_label,
+            (void *)&label,
+            (size_t)symbol->rows * side * (((size_t)symbol->cols * side + 7) / 8));
+        if (rc < 0)
+            return rc;
+    }
+
+    return written;
+}
+
+static int run_batch_serial(
+    struct payload_reader *reader,
+    const struct datamatrix_options *options,
+    struct batch_output *output,
+    struct batch_stats *stats)
+{
+    int rc = 0;
+    struct datamatrix_encoder *encoder = NULL;
+    struct datamatrix_symbol symbol = {0};
+    uint64_t t0 = 0;
+    uint64_t t1 = 0;
+
+    encoder = datamatrix_encoder_create(options);
+    if (encoder == NULL)
+    {
+        log_error("Failed to create encoder");
+        rc = -ENOMEM;
+        goto exit;
+    }
+
+    encoder->cache = output->cache;
+
+    for (;;)
+    {
+        const unsigned char *data = NULL;
+        size_t length = 0;
+
+        t0 = timing_now_ns();
+        rc = payload_reader_next(reader, &data, &length);
+        t1 = timing_now_ns();
+        stats->read_ns += t1 - t0;
+
+        if (rc == 0)
+            break;
+
+        if (rc == -E2BIG)
+        {
+            stats->failed++;
+            continue;
+        }
+
+        if (rc < 0)
+        {
+            log_error("Failed to read payload %llu", (unsigned long long)reader->record);
+            goto exit;
+        }
+
+        rc = datamatrix_encode(encoder, data, length, &symbol);
+        t0 = timing_now_ns();
+        stats->encode_ns += t0 - t1;
+
+        if (rc < 0)
+        {
+            log_error("Failed to encode payload %llu", (unsigned long long)reader->record);
+            stats->failed++;
+            continue;
+        }
+
+        stats->labels++;
+
+        if (output->out == NULL && output->document == NULL)
+            continue;
+
+        mutex_lock(&output->output_lock);
+        rc = output_symbol(options, data, length, &symbol, output);
+        mutex_unlock(&output->output_lock);
+
+        t1 = timing_now_ns();
+        stats->output_ns += t1 - t0;
+
+        if (rc < 0)
+        {
+            log_error("Failed to write symbol %llu", (unsigned long long)reader->record);
+            goto exit;
+        }
+
+        stats->bytes_out += (uint64_t)rc;
+    }
+
+    rc = 0;
+
+exit:
+    datamatrix_symbol_free(&symbol);
+    datamatrix_encoder_destroy(encoder);
+
+    return rc;
+}
+
+/* Takes the oldest result off the pool and writes it out. */
+static int emit_next(
+    struct encode_pool *pool,
+    const struct datamatrix_options *options,
+    struct batch_output *output,
+    struct batch_stats *stats)
+{
+    int rc = 0;
+    struct encode_result *result = NULL;
+    uint64_t start = 0;
+
+    rc = encode_pool_next(pool, &result);
+    if (rc < 0)
+        return rc;
+
+    stats->encode_ns += result->encode_ns;
+
+    if (result->status < 0)
+    {
+        log_error("Failed to encode payload %llu", (unsigned long long)result->record);
+        stats->failed++;
+        goto exit;
+    }
+
+    stats->labels++;
+
+    if (output->out == NULL && output->document == NULL)
+        goto exit;
+
+    start = timing_now_ns();
+    rc = output_symbol(options, result->payload, result->length, &result->symbol, output);
+    stats->output_ns += timing_now_ns() - start;
+
+    if (rc < 0)
+    {
+        log_error("Failed to write symbol %llu", (unsigned long long)result->record);
+        goto exit;
+    }
+
+    stats->bytes_out += (uint64_t)rc;
+    rc = 0;
+
+exit:
+    encode_pool_release(pool, result);
+
+    return rc;
+}
+
+static void flusher_main(void *arg)
+{
+    struct batch_output *output = (struct batch_output *)arg;
+
+    mutex_lock(&output->output_lock);
+
+    while (!output->flusher_stop)
+    {
+        uint64_t wait_ns = document_builder_poll_ns(output->document);
+        int wait_ms = FLUSH_CHECK_MS;
+
+        if (wait_ns < (uint64_t)FLUSH_CHECK_MS * 1000000)
+            wait_ms = (int)((wait_ns + 999999) / 1000000);
+
+        if (wait_ms > 0)
+            cond_wait_ms(&output->flusher_wake, &output->output_lock, wait_ms);
+
+        if (output->flusher_stop)
+            break;
+
+        /* Only what's already encoded, so the reader isn't kept waiting
+         * on the lock for encodes still running. */
+        while (output->pool != NULL && output->flusher_rc == 0 && encode_pool_ready(output->pool))
+            output->flusher_rc = emit_next(output->pool, output->options, output, output->stats);
+
+        if (document_builder_poll(output->document) < 0)
+            log_error("Failed to end document");
+    }
+
+    mutex_unlock(&output->output_lock);
+}
+
+static void start_flusher(struct batch_output *output)
+{
+    mutex_init(&output->output_lock);
+    cond_init(&output->flusher_wake);
+
+    if (output->document == NULL || document_builder_poll_ns(output->document) == UINT64_MAX)
+        return;
+
+    /* Without it documents still end on age, but only as labels arrive. */
+    if (thread_create(&output->flusher, flusher_main, output) < 0)
+    {
+        log_warn("Failed to start the document flusher");
+        return;
+    }
+
+    output->flusher_running = 1;
+}
+
+static void stop_flusher(struct batch_output *output)
+{
+    if (output->flusher_running)
+    {
+        mutex_lock(&output->output_lock);
+        output->flusher_stop = 1;
+        cond_signal(&output->flusher_wake);
+        mutex_unlock(&output->output_lock);
+
+        thread_join(&output->flusher);
+    }
+
+    cond_destroy(&output->flusher_wake);
+    mutex_destroy(&output->output_lock);
+}
+
+static int run_batch_parallel(
+    struct payload_reader *reader,
+    const struct datamatrix_options *options,
+    int threads,
+    struct batch_output *output,
+    struct batch_stats *stats)
+{
+    int rc = 0;
+    struct encode_pool *pool = NULL;
+    uint64_t t0 = 0;
+
+    pool = encode_pool_create(options, output->cache, threads, 0);
+    if (pool == NULL)
+    {
+        log_error("Failed to create encode pool");
+        return -ENOMEM;
+    }
+
+    log_info("Encoding with %d threads", encode_pool_threads(pool));
+
+    mutex_lock(&output->output_lock);
+    output->pool = pool;
+    output->options = options;
+    output->stats = stats;
+    mutex_unlock(&output->output_lock);
+
+    for (;;)
+    {
+        const unsigned char *data = NULL;
+        size_t length = 0;
+
+        t0 = timing_now_ns();
+        rc = payload_reader_next(reader, &data, &length);
+        stats->read_ns += timing_now_ns() - t0;
+
+        if (rc == 0)
+            break;
+
+        if (rc == -E2BIG)
+        {
+            mutex_lock(&output->output_lock);
+            stats->failed++;
+            mutex_unlock(&output->output_lock);
+            continue;
+        }
+
+        if (rc < 0)
+        {
+            log_error("Failed to read payload %llu", (unsigned long long)reader->record);
+            goto exit;
+        }
+
+        /* The reader thread doubles as the writer, so once the window is
+         * full drain the head before handing out more work. */
+        mutex_lock(&output->output_lock);
+
+        rc = output->flusher_rc;
+        while (rc == 0 && encode_pool_full(pool))
+            rc = emit_next(pool, options, output, stats);
+
+        mutex_unlock(&output->output_lock);
+
+        if (rc < 0)
+            goto exit;
+
+        rc = encode_pool_submit(pool, data, length, reader->record);
+        if (rc < 0)
+        {
+            log_error("Failed to queue payload %llu", (unsigned long long)reader->record);
+            goto exit;
+        }
+    }
+
+    mutex_lock(&output->output_lock);
+
+    rc = output->flusher_rc;
+    while (rc == 0 && encode_pool_pending(pool) > 0)
+        rc = emit_next(pool, options, output, stats);
+
+    mutex_unlock(&output->output_lock);
+
+exit:
+    mutex_lock(&output->output_lock);
+    output->pool = NULL;
+    mutex_unlock(&output->output_lock);
+
+    encode_pool_destroy(pool);
+
+    return rc;
+}
+
+int run_batch(
+    struct payload_reader *reader,
+    const struct datamatrix_options *options,
+    int threads,
+    FILE *out,
+    struct document_builder *document,
+    struct symbol_cache *cache,
+    struct batch_stats *stats)
+{
+    int rc = 0;
+    uint64_t start = 0;
+    struct batch_output output = {
+        .out = out,
+        .document = document,
+        .cache = cache,
+    };
+
+    memset(stats, 0, sizeof(*stats));
+    start = timing_now_ns();
+
+    start_flusher(&output);
+
+    if (threads == 1)
+        rc = run_batch_serial(reader, options, &output, stats);
+    else
+        rc = run_batch_parallel(reader, options, threads, &output, stats);
+
+    stop_flusher(&output);
+    bitmap_free(&output.bitmap);
+
+    if (out != NULL)
+        fflush(out);
+
+    if (document != NULL && document_builder_flush(document) < 0 && rc == 0)
+        rc = -EIO;
+
+    stats->total_ns = timing_now_ns() - start;
+
+    return rc;
+}
+
+static double per_second(uint64_t count, uint64_t ns)
+{
+    return ns > 0 ? (double)count / timing_ns_to_s(ns) : 0.0;
+}
+
+void print_batch_stats(const struct batch_stats *stats)
+{
+    printf("Labels: %llu encoded, %llu failed\n",
+           (unsigned long long)stats->labels,
+           (unsigned long long)stats->failed);
+
+    printf("  Total:  %.3f s, %.1f labels/s\n",
+           timing_ns_to_s(stats->total_ns),
+           per_second(stats->labels, stats->total_ns));
+
+    printf("  Read:   %.3f s\n", timing_ns_to_s(stats->read_ns));
+
+    /* With a pool this is the sum over the workers, so it can exceed the
+     * total. */
+    printf("  Encode: %.3f s, %.1f labels/s per thread\n",
+           timing_ns_to_s(stats->encode_ns),
+           per_second(stats->labels, stats->encode_ns));
+
+    printf("  Output: %.3f s, %.1f labels/s, %llu octets\n",
+           timing_ns_to_s(stats->output_ns),
+           per_second(stats->labels, stats->output_ns),
+           (unsigned long long)stats->bytes_out);
+}
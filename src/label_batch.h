@@ -0,0 +1,73 @@
+#ifndef LABEL_BATCH_H
+#define LABEL_BATCH_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "datamatrix.h"
+#include "document_builder.h"
+
+enum payload_format
+{
+    /* One payload per line. Trailing CR/LF is stripped and blank lines are
+     * skipped. */
+    PAYLOAD_FORMAT_LINES,
+
+    /* Each payload is preceded by its length as a 32 bit big-endian
+     * integer, so payloads may contain any byte. */
+    PAYLOAD_FORMAT_LENGTH_PREFIXED,
+};
+
+struct payload_reader
+{
+    FILE *in;
+    enum payload_format format;
+    unsigned char *buffer;
+    size_t capacity;
+    uint64_t record;
+};
+
+struct batch_stats
+{
+    uint64_t labels;
+    uint64_t failed;
+    uint64_t bytes_out;
+    uint64_t read_ns;
+    uint64_t encode_ns;
+    uint64_t output_ns;
+    uint64_t total_ns;
+};
+
+/* Opens a payload source. A path of "-" reads from stdin. */
+int payload_reader_open(
+    struct payload_reader *reader,
+    const char *path,
+    enum payload_format format);
+
+/* Returns 1 and points data at the next payload, 0 at the end of the
+ * input or a negative errno. The data is valid until the next call. */
+int payload_reader_next(
+    struct payload_reader *reader,
+    const unsigned char **data,
+    size_t *length);
+
+void payload_reader_close(struct payload_reader *reader);
+
+/* Encodes every payload from the reader and, in input order, writes the
+ * rendered symbols to out as a stream of PBM frames and/or prints them as
+ * labels through document. Either may be NULL. threads is the number of
+ * encode workers, <= 0 for one per CPU and 1 to encode on the calling
+ * thread. cache, if not NULL, is used for both symbols and label bitmaps. */
+int run_batch(
+    struct payload_reader *reader,
+    const struct datamatrix_options *options,
+    int threads,
+    FILE *out,
+    struct document_builder *document,
+    struct symbol_cache *cache,
+    struct batch_stats *stats);
+
+void print_batch_stats(const struct batch_stats *stats);
+
+#endif /* LABEL_BATCH_H */
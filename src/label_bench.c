@@ -0,0 +1,992 @@
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <dmtx.h>
+
+#include "bitmap.h"
+#include "count_of.h"
+#include "datamatrix.h"
+#include "document_builder.h"
+#include "log.h"
+#include "print_backend.h"
+#include "symbol_layout.h"
+#include "timing.h"
+
+/* Times each stage of the label pipeline on its own and then all of them
+ * together: encoding payloads of a few sizes in each scheme, rendering a
+ * symbol to a bitmap at 203, 300 and 600 DPI, composing rendered labels
+ * into pages, and encoding, drawing and printing labels end to end.
+ *
+ * Every label is timed, and each case runs for at least --min-ms. The
+ * median and 99th percentile time per label and the labels per second
+ * are printed as a table and, with --json, written out so one build can
+ * be compared with another. */
+
+#define DEFAULT_MIN_MS 200
+#define MIN_SAMPLES 50
+#define MAX_SAMPLES (1 << 20)
+
+/* Distinct payloads of each size, cycled through. */
+#define PAYLOADS 64
+#define MAX_PAYLOAD 256
+
+/* Half millimetre modules, in tenths of a millimetre. */
+#define MODULE_MM_10 5
+
+struct bench_result
+{
+    const char *stage;
+    char name[64];
+    int samples;
+    uint64_t p50_ns;
+    uint64_t p99_ns;
+    double per_sec;
+};
+
+struct bench
+{
+    uint64_t min_ns;
+    const char *stage;
+
+    uint64_t *samples;
+
+    struct bench_result *results;
+    int result_count;
+    int result_capacity;
+};
+
+struct scheme
+{
+    const char *name;
+    int scheme;
+};
+
+static const struct scheme schemes[] = {
+    {"auto", DmtxSchemeAutoBest},
+    {"ascii", DmtxSchemeAscii},
+    {"c40", DmtxSchemeC40},
+    {"text", DmtxSchemeText},
+    {"x12", DmtxSchemeX12},
+    {"edifact", DmtxSchemeEdifact},
+    {"base256", DmtxSchemeBase256},
+};
+
+struct mix
+{
+    const char *name;
+    const char *alphabet;
+};
+
+/* What payloads are made of. The first, upper case and digits, which every
+ * scheme can encode, is what the other stages use. */
+static const struct mix mixes[] = {
+    {"upper", "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ"},
+    {"digits", "0123456789"},
+    {"lower", "0123456789abcdefghijklmnopqrstuvwxyz "},
+    {"mixed", "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz -./:#"},
+};
+
+static const int payload_sizes[] = {16, 64, MAX_PAYLOAD};
+static const int dpis[] = {203, 300, 600};
+
+static unsigned char payloads[COUNT_OF(mixes)][PAYLOADS][MAX_PAYLOAD];
+
+static void make_payloads(void)
+{
+    srand(1);
+
+    for (int m = 0; m < COUNT_OF(mixes); m++)
+    {
+        int size = (int)strlen(mixes[m].alphabet);
+
+        for (int i = 0; i < PAYLOADS; i++)
+        {
+            for (int j = 0; j < MAX_PAYLOAD; j++)
+                payloads[m][i][j] = (unsigned char)mixes[m].alphabet[rand() % size];
+        }
+    }
+}
+
+static int wanted(const struct bench *bench, const char *stage)
+{
+    return bench->stage == NULL || strcmp(bench->stage, stage) == 0;
+}
+
+static int keep_sampling(const struct bench *bench, int count, uint64_t start_ns)
+{
+    if (count >= MAX_SAMPLES)
+        return 0;
+
+    return count < MIN_SAMPLES || timing_now_ns() - start_ns < bench->min_ns;
+}
+
+static int compare_ns(const void *a, const void *b)
+{
+    uint64_t x = *(const uint64_t *)a;
+    uint64_t y = *(const uint64_t *)b;
+
+    return x < y ? -1 : x > y;
+}
+
+static uint64_t percentile(const uint64_t *sorted, int count, int p)
+{
+    return sorted[(size_t)(count - 1) * p / 100];
+}
+
+/* Adds a case from the samples taken, elapsed_ns being how long taking
+ * them took from start to finish. */
+static int record(
+    struct bench *bench,
+    const char *stage,
+    const char *name,
+    int count,
+    uint64_t elapsed_ns)
+{
+    struct bench_result *result = NULL;
+
+    if (bench->result_count == bench->result_capacity)
+    {
+        int capacity = bench->result_capacity > 0 ? bench->result_capacity * 2 : 32;
+        struct bench_result *grown = (struct bench_result *)realloc(
+            bench->results, capacity * sizeof(*grown));
+
+        if (grown == NULL)
+        {
+            log_error("Failed to allocate memory");
+            return -ENOMEM;
+        }
+
+        bench->results = grown;
+        bench->result_capacity = capacity;
+    }
+
+    result = &bench->results[bench->result_count++];
+
+    qsort(bench->samples, count, sizeof(*bench->samples), compare_ns);
+
+    result->stage = stage;
+    snprintf(result->name, sizeof(result->name), "%s", name);
+    result->samples = count;
+    result->p50_ns = percentile(bench->samples, count, 50);
+    result->p99_ns = percentile(bench->samples, count, 99);
+    result->per_sec = (double)count / timing_ns_to_s(elapsed_ns);
+
+    printf(
+        "%-8s %-24s %9d %10.1f %10.1f %12.0f\n",
+        result->stage,
+        result->name,
+        result->samples,
+        (double)result->p50_ns / 1e3,
+        (double)result->p99_ns / 1e3,
+        result->per_sec);
+    fflush(stdout);
+
+    return 0;
+}
+
+static int bench_encode(struct bench *bench)
+{
+    int rc = 0;
+    struct datamatrix_symbol symbol = {0};
+
+    for (int s = 0; s < COUNT_OF(schemes); s++)
+    {
+        struct datamatrix_options options = DATAMATRIX_OPTIONS_DEFAULT;
+        struct datamatrix_encoder *encoder = NULL;
+
+        options.scheme = schemes[s].scheme;
+
+        encoder = datamatrix_encoder_create(&options);
+        if (encoder == NULL)
+        {
+            rc = -ENOMEM;
+            goto exit;
+        }
+
+        for (int p = 0; p < COUNT_OF(payload_sizes); p++)
+        {
+            char name[64];
+            uint64_t start_ns = timing_now_ns();
+            uint64_t t0 = start_ns;
+            int count = 0;
+
+            snprintf(name, sizeof(name), "%s %d", schemes[s].name, payload_sizes[p]);
+
+            while (keep_sampling(bench, count, start_ns))
+            {
+                uint64_t t1 = 0;
+
+                rc = datamatrix_encode(
+                    encoder,
+                    payloads[0][count % PAYLOADS],
+                    (size_t)payload_sizes[p],
+                    &symbol);
+
+                t1 = timing_now_ns();
+                bench->samples[count++] = t1 - t0;
+                t0 = t1;
+
+                if (rc < 0)
+                    break;
+            }
+
+            if (rc < 0)
+            {
+                /* Some schemes can't fit the larger payloads in any size
+                 * of symbol. */
+                printf("%-8s %-24s failed to encode\n", "encode", name);
+                rc = 0;
+                continue;
+            }
+
+            rc = record(bench, "encode", name, count, timing_now_ns() - start_ns);
+            if (rc < 0)
+                break;
+        }
+
+        datamatrix_encoder_destroy(encoder);
+
+        if (rc < 0)
+            goto exit;
+    }
+
+exit:
+    datamatrix_symbol_free(&symbol);
+
+    return rc;
+}
+
+/* Checks that picking a scheme up front never makes a symbol bigger than
+ * the full search does, for every payload of every mix and size. */
+static int verify_fast_scheme(
+    struct datamatrix_encoder *full,
+    struct datamatrix_encoder *fast,
+    struct datamatrix_symbol *symbol)
+{
+    int checked = 0;
+    int smaller = 0;
+
+    for (int m = 0; m < COUNT_OF(mixes); m++)
+    {
+        for (int p = 0; p < COUNT_OF(payload_sizes); p++)
+        {
+            for (int i = 0; i < PAYLOADS; i++)
+            {
+                int full_size = 0;
+
+                if (datamatrix_encode(full, payloads[m][i], (size_t)payload_sizes[p], symbol) < 0 ||
+                    (full_size = symbol->size_idx,
+                     datamatrix_encode(fast, payloads[m][i], (size_t)payload_sizes[p], symbol) < 0))
+                {
+                    log_error("Failed to encode %s payload %d", mixes[m].name, i);
+                    return -EINVAL;
+                }
+
+                if (symbol->size_idx > full_size)
+                {
+                    log_error(
+                        "Picked a bigger symbol than the full search for %s payload %d",
+                        mixes[m].name,
+                        i);
+                    return -EINVAL;
+                }
+
+                smaller += symbol->size_idx < full_size;
+                checked++;
+            }
+        }
+    }
+
+    printf(
+        "Verified picked schemes over %d payloads: %llu encoded directly, %d in smaller symbols\n",
+        checked,
+        (unsigned long long)fast->direct,
+        smaller);
+
+    return 0;
+}
+
+/* Encoding each mix with and without picking a scheme up front. */
+static int bench_fast_scheme(struct bench *bench)
+{
+    int rc = 0;
+    struct datamatrix_options options = DATAMATRIX_OPTIONS_DEFAULT;
+    struct datamatrix_encoder *encoders[2] = {NULL, NULL};
+    static const char *const names[] = {"full", "fast"};
+    struct datamatrix_symbol symbol = {0};
+
+    for (int e = 0; e < 2; e++)
+    {
+        options.fast_scheme = e;
+
+        encoders[e] = datamatrix_encoder_create(&options);
+        if (encoders[e] == NULL)
+        {
+            rc = -ENOMEM;
+            goto exit;
+        }
+    }
+
+    rc = verify_fast_scheme(encoders[0], encoders[1], &symbol);
+    if (rc < 0)
+        goto exit;
+
+    for (int m = 0; m < COUNT_OF(mixes); m++)
+    {
+        for (int p = 0; p < COUNT_OF(payload_sizes); p++)
+        {
+            for (int e = 0; e < 2; e++)
+            {
+                char name[64];
+                uint64_t start_ns = timing_now_ns();
+                uint64_t t0 = start_ns;
+                int count = 0;
+
+                snprintf(name, sizeof(name), "%s %s %d", mixes[m].name, names[e], payload_sizes[p]);
+
+                while (keep_sampling(bench, count, start_ns))
+                {
+                    uint64_t t1 = 0;
+
+                    rc = datamatrix_encode(
+                        encoders[e],
+                        payloads[m][count % PAYLOADS],
+                        (size_t)payload_sizes[p],
+                        &symbol);
+
+                    t1 = timing_now_ns();
+                    bench->samples[count++] = t1 - t0;
+                    t0 = t1;
+
+                    if (rc < 0)
+                    {
+                        log_error("Failed to encode data");
+                        goto exit;
+                    }
+                }
+
+                rc = record(bench, "encode", name, count, timing_now_ns() - start_ns);
+                if (rc < 0)
+                    goto exit;
+            }
+        }
+    }
+
+exit:
+    datamatrix_encoder_destroy(encoders[0]);
+    datamatrix_encoder_destroy(encoders[1]);
+    datamatrix_symbol_free(&symbol);
+
+    return rc;
+}
+
+/* Encodes digits into symbol size size_idx, as many as it holds up to a
+ * payload's worth, in ASCII so the count is exact. */
+static int encode_in_size(DmtxEncode *enc, int size_idx)
+{
+    int length = 2 * symbol_layouts[size_idx].data_words;
+
+    if (length > MAX_PAYLOAD)
+        length = MAX_PAYLOAD;
+
+    dmtxEncodeSetProp(enc, DmtxPropScheme, DmtxSchemeAscii);
+    dmtxEncodeSetProp(enc, DmtxPropSizeRequest, size_idx);
+
+    return dmtxEncodeDataMatrix(enc, length, payloads[1][0]) == DmtxFail ? -EINVAL : 0;
+}
+
+/* Checks the generated tables against libdmtx: each size's attributes,
+ * and every module of a symbol laid out from them. */
+static int verify_layouts(DmtxEncode *enc, unsigned char *modules)
+{
+    for (int i = 0; i < SYMBOL_LAYOUT_COUNT; i++)
+    {
+        const struct symbol_layout *layout = &symbol_layouts[i];
+
+        if (layout->rows != dmtxGetSymbolAttribute(DmtxSymAttribSymbolRows, i) ||
+            layout->cols != dmtxGetSymbolAttribute(DmtxSymAttribSymbolCols, i) ||
+            layout->region_rows != dmtxGetSymbolAttribute(DmtxSymAttribDataRegionRows, i) ||
+            layout->region_cols != dmtxGetSymbolAttribute(DmtxSymAttribDataRegionCols, i) ||
+            layout->horiz_regions != dmtxGetSymbolAttribute(DmtxSymAttribHorizDataRegions, i) ||
+            layout->vert_regions != dmtxGetSymbolAttribute(DmtxSymAttribVertDataRegions, i) ||
+            layout->blocks != dmtxGetSymbolAttribute(DmtxSymAttribInterleavedBlocks, i) ||
+            layout->data_words != dmtxGetSymbolAttribute(DmtxSymAttribSymbolDataWords, i) ||
+            layout->error_words != dmtxGetSymbolAttribute(DmtxSymAttribSymbolErrorWords, i))
+        {
+            log_error("Layout %d's attributes differ from libdmtx's", i);
+            return -EINVAL;
+        }
+
+        if (encode_in_size(enc, i) < 0 || enc->region.sizeIdx != i)
+        {
+            log_error("Failed to encode a %dx%d symbol", layout->rows, layout->cols);
+            return -EINVAL;
+        }
+
+        symbol_layout_draw(layout, enc->message->code, modules);
+
+        for (int row = 0; row < layout->rows; row++)
+        {
+            for (int col = 0; col < layout->cols; col++)
+            {
+                /* libdmtx counts rows from the bottom. */
+                int expected = (dmtxSymbolModuleStatus(enc->message, i, layout->rows - row - 1, col) &
+                                DmtxModuleOnRGB)
+                                   ? 1
+                                   : 0;
+
+                if (modules[row * layout->cols + col] != expected)
+                {
+                    log_error(
+                        "Module %d, %d of a %dx%d symbol differs from libdmtx's",
+                        row,
+                        col,
+                        layout->rows,
+                        layout->cols);
+                    return -EINVAL;
+                }
+            }
+        }
+    }
+
+    printf("Verified symbol layouts for all %d sizes\n", SYMBOL_LAYOUT_COUNT);
+
+    return 0;
+}
+
+/* Laying out an encoded symbol's modules, asking libdmtx about each one
+ * or walking the table. */
+static int bench_layout(struct bench *bench)
+{
+    static const int sizes[] = {DmtxSymbol16x16, DmtxSymbol26x26, DmtxSymbol52x52, DmtxSymbol144x144};
+    static const char *const names[] = {"libdmtx", "table"};
+    int rc = 0;
+    DmtxEncode *enc = dmtxEncodeCreate();
+    unsigned char *modules = (unsigned char *)malloc(144 * 144);
+
+    if (enc == NULL || modules == NULL)
+    {
+        log_error("Failed to allocate memory");
+        rc = -ENOMEM;
+        goto exit;
+    }
+
+    rc = verify_layouts(enc, modules);
+    if (rc < 0)
+        goto exit;
+
+    for (int s = 0; s < COUNT_OF(sizes); s++)
+    {
+        const struct symbol_layout *layout = &symbol_layouts[sizes[s]];
+
+        rc = encode_in_size(enc, sizes[s]);
+        if (rc < 0)
+        {
+            log_error("Failed to encode data");
+            goto exit;
+        }
+
+        for (int e = 0; e < 2; e++)
+        {
+            char name[64];
+            uint64_t start_ns = timing_now_ns();
+            uint64_t t0 = start_ns;
+            int count = 0;
+
+            snprintf(name, sizeof(name), "layout %s %dx%d", names[e], layout->rows, layout->cols);
+
+            while (keep_sampling(bench, count, start_ns))
+            {
+                uint64_t t1 = 0;
+
+                if (e == 0)
+                {
+                    unsigned char *out = modules;
+
+                    for (int row = layout->rows - 1; row >= 0; row--)
+                    {
+                        for (int col = 0; col < layout->cols; col++)
+                            *out++ = (dmtxSymbolModuleStatus(enc->message, sizes[s], row, col) &
+                                      DmtxModuleOnRGB)
+                                         ? 1
+                                         : 0;
+                    }
+                }
+                else
+                {
+                    symbol_layout_draw(layout, enc->message->code, modules);
+                }
+
+                t1 = timing_now_ns();
+                bench->samples[count++] = t1 - t0;
+                t0 = t1;
+            }
+
+            rc = record(bench, "encode", name, count, timing_now_ns() - start_ns);
+            if (rc < 0)
+                goto exit;
+        }
+    }
+
+exit:
+    free(modules);
+    dmtxEncodeDestroy(&enc);
+
+    return rc;
+}
+
+static int module_pixels(int dpi)
+{
+    return mm_10_to_px(MODULE_MM_10, dpi);
+}
+
+/* The symbol most labels would carry: 64 characters in the default
+ * scheme. */
+static int encode_typical(struct datamatrix_symbol *symbol)
+{
+    int rc = 0;
+    const struct datamatrix_options options = DATAMATRIX_OPTIONS_DEFAULT;
+    struct datamatrix_encoder *encoder = datamatrix_encoder_create(&options);
+
+    if (encoder == NULL)
+        return -ENOMEM;
+
+    rc = datamatrix_encode(encoder, payloads[0][0], 64, symbol);
+    if (rc < 0)
+        log_error("Failed to encode data");
+
+    datamatrix_encoder_destroy(encoder);
+
+    return rc;
+}
+
+static int bench_render(struct bench *bench)
+{
+    int rc = 0;
+    struct datamatrix_symbol symbol = {0};
+    struct bitmap bitmap = {0};
+
+    rc = encode_typical(&symbol);
+    if (rc < 0)
+        goto exit;
+
+    for (int d = 0; d < COUNT_OF(dpis); d++)
+    {
+        char name[64];
+        int module_size = module_pixels(dpis[d]);
+        uint64_t start_ns = timing_now_ns();
+        uint64_t t0 = start_ns;
+        int count = 0;
+
+        snprintf(name, sizeof(name), "%d dpi, %d px modules", dpis[d], module_size);
+
+        while (keep_sampling(bench, count, start_ns))
+        {
+            uint64_t t1 = 0;
+
+            rc = datamatrix_render(&symbol, module_size, module_size, 0, &bitmap);
+            if (rc < 0)
+                goto exit;
+
+            t1 = timing_now_ns();
+            bench->samples[count++] = t1 - t0;
+            t0 = t1;
+        }
+
+        rc = record(bench, "render", name, count, timing_now_ns() - start_ns);
+        if (rc < 0)
+            goto exit;
+    }
+
+exit:
+    bitmap_free(&bitmap);
+    datamatrix_symbol_free(&symbol);
+
+    return rc;
+}
+
+static int open_printer(
+    const char *backend_name,
+    const char *printer_name,
+    const char *paper_name,
+    int raster,
+    struct print_session **session,
+    struct document_builder **document)
+{
+    int rc = 0;
+    const struct print_backend *backend = NULL;
+    struct document_options document_options = DOCUMENT_OPTIONS_DEFAULT;
+    struct session_options options = {
+        .paper_name = paper_name,
+        .raster = raster,
+    };
+
+    /* A sheet of labels rather than one to a page, so composing a page
+     * places several. */
+    document_options.document_name = "BENCH";
+    document_options.columns = 2;
+    document_options.rows = 3;
+
+    backend = print_backend_find(backend_name);
+    if (backend == NULL)
+        return -EINVAL;
+
+    rc = backend->open_session(printer_name, &options, session);
+    if (rc < 0)
+    {
+        log_error("Failed to open print session");
+        return rc;
+    }
+
+    *document = document_builder_create(*session, &document_options);
+    if (*document == NULL)
+    {
+        print_session_close(*session);
+        *session = NULL;
+        return -EINVAL;
+    }
+
+    return 0;
+}
+
+static int place_label(struct print_session *session, const struct rect *cell, void *context)
+{
+    return datamatrix_place(session, cell, (const struct bitmap *)context);
+}
+
+static int bench_compose(struct bench *bench)
+{
+    int rc = 0;
+    struct datamatrix_symbol symbol = {0};
+    struct bitmap bitmap = {0};
+
+    rc = encode_typical(&symbol);
+    if (rc < 0)
+        goto exit;
+
+    for (int d = 0; d < COUNT_OF(dpis); d++)
+    {
+        char printer_name[32];
+        char name[64];
+        struct print_session *session = NULL;
+        struct document_builder *document = NULL;
+        int module_size = module_pixels(dpis[d]);
+        size_t bytes = 0;
+        uint64_t start_ns = 0;
+        uint64_t t0 = 0;
+        int count = 0;
+
+        if (dpis[d] == 203)
+            snprintf(printer_name, sizeof(printer_name), "Null Printer");
+        else
+            snprintf(printer_name, sizeof(printer_name), "Null Printer %d", dpis[d]);
+
+        rc = datamatrix_render(&symbol, module_size, module_size, 0, &bitmap);
+        if (rc < 0)
+            goto exit;
+
+        rc = open_printer("null", printer_name, "4x6in", 0, &session, &document);
+        if (rc < 0)
+            goto exit;
+
+        bytes = bitmap.stride * (size_t)bitmap.height;
+        snprintf(name, sizeof(name), "%d dpi, 2x3 a page", dpis[d]);
+
+        start_ns = timing_now_ns();
+        t0 = start_ns;
+
+        while (keep_sampling(bench, count, start_ns))
+        {
+            uint64_t t1 = 0;
+
+            rc = document_builder_add(document, place_label, &bitmap, bytes);
+            if (rc < 0)
+                break;
+
+            t1 = timing_now_ns();
+            bench->samples[count++] = t1 - t0;
+            t0 = t1;
+        }
+
+        if (document_builder_destroy(document) < 0 && rc == 0)
+            rc = -EIO;
+
+        print_session_close(session);
+
+        if (rc < 0)
+            goto exit;
+
+        rc = record(bench, "compose", name, count, timing_now_ns() - start_ns);
+        if (rc < 0)
+            goto exit;
+    }
+
+exit:
+    bitmap_free(&bitmap);
+    datamatrix_symbol_free(&symbol);
+
+    return rc;
+}
+
+struct end_to_end_label
+{
+    const struct datamatrix_symbol *symbol;
+    struct bitmap *bitmap;
+    int module_size;
+};
+
+static int draw_label(struct print_session *session, const struct rect *cell, void *context)
+{
+    const struct end_to_end_label *label = (const struct end_to_end_label *)context;
+
+    return datamatrix_draw(session, label->symbol, cell, label->module_size, label->bitmap);
+}
+
+/* Encodes, draws and prints labels from payloads of 64 characters. */
+static int bench_end_to_end(
+    struct bench *bench,
+    const char *backend_name,
+    const char *printer_name,
+    const char *paper_name,
+    int raster)
+{
+    int rc = 0;
+    const struct datamatrix_options options = DATAMATRIX_OPTIONS_DEFAULT;
+    struct datamatrix_encoder *encoder = NULL;
+    struct datamatrix_symbol symbol = {0};
+    struct bitmap bitmap = {0};
+    struct print_session *session = NULL;
+    struct document_builder *document = NULL;
+    struct end_to_end_label label = {.symbol = &symbol, .bitmap = &bitmap};
+    char name[64];
+    uint64_t start_ns = 0;
+    uint64_t t0 = 0;
+    int count = 0;
+
+    encoder = datamatrix_encoder_create(&options);
+    if (encoder == NULL)
+        return -ENOMEM;
+
+    rc = open_printer(backend_name, printer_name, paper_name, raster, &session, &document);
+    if (rc < 0)
+        goto exit;
+
+    label.module_size = module_pixels(session->dpi_x);
+    snprintf(name, sizeof(name), "%s%s", printer_name, raster ? ", raster" : "");
+
+    start_ns = timing_now_ns();
+    t0 = start_ns;
+
+    while (keep_sampling(bench, count, start_ns))
+    {
+        uint64_t t1 = 0;
+
+        rc = datamatrix_encode(encoder, payloads[0][count % PAYLOADS], 64, &symbol);
+        if (rc < 0)
+            break;
+
+        rc = document_builder_add(
+            document,
+            draw_label,
+            &label,
+            (size_t)symbol.rows * symbol.cols * label.module_size * label.module_size / 8);
+        if (rc < 0)
+            break;
+
+        t1 = timing_now_ns();
+        bench->samples[count++] = t1 - t0;
+        t0 = t1;
+    }
+
+    /* The last document is part of the cost. */
+    if (document_builder_destroy(document) < 0 && rc == 0)
+        rc = -EIO;
+
+    document = NULL;
+
+    if (rc < 0)
+        goto exit;
+
+    rc = record(bench, "e2e", name, count, timing_now_ns() - start_ns);
+
+exit:
+    if (document != NULL)
+        document_builder_destroy(document);
+
+    if (session != NULL)
+        print_session_close(session);
+
+    bitmap_free(&bitmap);
+    datamatrix_symbol_free(&symbol);
+    datamatrix_encoder_destroy(encoder);
+
+    return rc;
+}
+
+static int write_json(const struct bench *bench, const char *path)
+{
+    FILE *out = fopen(path, "w");
+
+    if (out == NULL)
+    {
+        log_error("Failed to create \"%s\"", path);
+        return -EIO;
+    }
+
+    fprintf(out, "{\n");
+    fprintf(out, "  \"min_ms\": %.0f,\n", (double)bench->min_ns / 1e6);
+    fprintf(out, "  \"results\": [\n");
+
+    /* Case names are our own, so need no escaping. */
+    for (int i = 0; i < bench->result_count; i++)
+    {
+        const struct bench_result *result = &bench->results[i];
+
+        fprintf(
+            out,
+            "    {\"stage\": \"%s\", \"case\": \"%s\", \"samples\": %d, "
+            "\"p50_us\": %.3f, \"p99_us\": %.3f, \"labels_per_sec\": %.1f}%s\n",
+            result->stage,
+            result->name,
+            result->samples,
+            (double)result->p50_ns / 1e3,
+            (double)result->p99_ns / 1e3,
+            result->per_sec,
+            i + 1 < bench->result_count ? "," : "");
+    }
+
+    fprintf(out, "  ]\n");
+    fprintf(out, "}\n");
+
+    if (fclose(out) != 0)
+    {
+        log_error("Failed to write \"%s\"", path);
+        return -EIO;
+    }
+
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    int rc = 0;
+    struct bench bench = {.min_ns = (uint64_t)DEFAULT_MIN_MS * 1000000};
+    const char *json_path = NULL;
+    const char *backend_name = "null";
+    const char *printer_name = "Null Printer";
+    const char *paper_name = "4x6in";
+    int raster = 0;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--min-ms") == 0 && i + 1 < argc)
+        {
+            bench.min_ns = (uint64_t)atoi(argv[++i]) * 1000000;
+        }
+        else if (strcmp(argv[i], "--stage") == 0 && i + 1 < argc)
+        {
+            bench.stage = argv[++i];
+        }
+        else if (strcmp(argv[i], "--json") == 0 && i + 1 < argc)
+        {
+            json_path = argv[++i];
+        }
+        else if (strcmp(argv[i], "--backend") == 0 && i + 1 < argc)
+        {
+            backend_name = argv[++i];
+        }
+        else if (strcmp(argv[i], "--printer") == 0 && i + 1 < argc)
+        {
+            printer_name = argv[++i];
+        }
+        else if (strcmp(argv[i], "--paper") == 0 && i + 1 < argc)
+        {
+            paper_name = argv[++i];
+        }
+        else if (strcmp(argv[i], "--raster") == 0)
+        {
+            raster = 1;
+        }
+        else
+        {
+            printf(
+                "Usage: %s [--min-ms <n>] [--stage encode|render|compose|e2e] [--json <path>]\n"
+                "       [--backend <name>] [--printer <name>] [--paper <name>] [--raster]\n",
+                argv[0]);
+            return -EINVAL;
+        }
+    }
+
+    if (bench.stage != NULL && strcmp(bench.stage, "encode") != 0 &&
+        strcmp(bench.stage, "render") != 0 && strcmp(bench.stage, "compose") != 0 &&
+        strcmp(bench.stage, "e2e") != 0)
+    {
+        log_error("Unknown stage \"%s\"", bench.stage);
+        return -EINVAL;
+    }
+
+    bench.samples = (uint64_t *)malloc(MAX_SAMPLES * sizeof(*bench.samples));
+    if (bench.samples == NULL)
+    {
+        log_error("Failed to allocate memory");
+        return -ENOMEM;
+    }
+
+    make_payloads();
+
+    printf(
+        "%-8s %-24s %9s %10s %10s %12s\n",
+        "stage",
+        "case",
+        "samples",
+        "p50 us",
+        "p99 us",
+        "labels/s");
+
+    if (wanted(&bench, "encode"))
+    {
+        rc = bench_encode(&bench);
+        if (rc < 0)
+            goto exit;
+
+        rc = bench_fast_scheme(&bench);
+        if (rc < 0)
+            goto exit;
+
+        rc = bench_layout(&bench);
+        if (rc < 0)
+            goto exit;
+    }
+
+    if (wanted(&bench, "render"))
+    {
+        rc = bench_render(&bench);
+        if (rc < 0)
+            goto exit;
+    }
+
+    if (wanted(&bench, "compose"))
+    {
+        rc = bench_compose(&bench);
+        if (rc < 0)
+            goto exit;
+    }
+
+    if (wanted(&bench, "e2e"))
+    {
+        rc = bench_end_to_end(&bench, backend_name, printer_name, paper_name, raster);
+        if (rc < 0)
+            goto exit;
+    }
+
+    if (json_path != NULL)
+        rc = write_json(&bench, json_path);
+
+exit:
+    free(bench.results);
+    free(bench.samples);
+
+    return rc < 0 ? 1 : 0;
+}
@@ -1,193 +1,213 @@
-#include "windows.h"
-#include "winspool.h"
 #include "errno.h"
 #include "stdio.h"
-
-void list_print_processor_datatypes(LPCSTR processor)
+#include "stdlib.h"
+#include "string.h"
+
+#include "caps_cache.h"
+#include "inventory.h"
+#include "log.h"
+#include "print_backend.h"
+#include "timing.h"
+
+void list_capabilities(
+    FILE *out,
+    const struct inventory_printer *printer,
+    const struct cached_printer *cached)
 {
-    DWORD needed = 0, returned = 0;
-    DATATYPES_INFO_1 *pInfo = NULL;
+    const struct printer_caps *caps = &printer->caps;
 
-    EnumPrintProcessorDatatypes(NULL, (LPSTR)processor, 1, NULL, 0, &needed, &returned);
-    if (needed <= 0)
-    {
-        printf("    Failed to get print processor data types\n");
-        goto exit;
-    }
+    fprintf(out, "  Found %d page types\n", caps->paper_count);
 
-    pInfo = (DATATYPES_INFO_1 *)malloc(needed);
-    if (pInfo == NULL)
+    for (int i = 0; i < caps->paper_count; i++)
     {
-        printf("    Failed to allocate memory\n");
-        goto exit;
-    }
+        const struct paper_info *paper = &caps->papers[i];
+        const struct paper_geometry *geometry = NULL;
 
-    if (!EnumPrintProcessorDatatypes(NULL, (LPSTR)processor, 1, (LPBYTE)pInfo, needed, &needed, &returned))
-    {
-        printf("    Failed to get print processor data types\n");
-        goto exit;
-    }
+        fprintf(out, "    %d: %s %dx%d\n", paper->size, paper->name, paper->width, paper->height);
 
-    for (DWORD i = 0; i < returned; i++)
-    {
-        DATATYPES_INFO_1 *pDatatypeInfo = &pInfo[i];
-        wprintf(L"    %s\n", pDatatypeInfo->pName);
-    }
-
-exit:
-    if (pInfo != NULL)
-        free(pInfo);
-}
+        /* Geometry is only known once a session has used the paper. */
+        if (cached != NULL)
+            cached_printer_find_paper(cached, paper->name, &geometry);
 
-void list_capabilities(LPCSTR name)
-{
-    DWORD pageCount = 0;
-    WORD *pSizes = NULL;
-    POINT *pDimensions = NULL;
-    LPSTR pPageNames = NULL;
-    DWORD colourCapability = 0;
-
-    pageCount = DeviceCapabilities(name, NULL, DC_PAPERS, NULL, NULL);
-    if (pageCount <= 0)
-    {
-        printf("    Failed to get page sizes\n");
-        goto exit;
+        if (geometry != NULL && geometry->known)
+        {
+            fprintf(
+                out,
+                "      printable %dx%d px at (%d, %d)\n",
+                geometry->printable_width,
+                geometry->printable_height,
+                geometry->offset_x,
+                geometry->offset_y);
+        }
     }
 
-    pSizes = (WORD *)malloc(pageCount * sizeof(WORD));
-    if (pSizes == NULL)
+    if (caps->colour)
     {
-        printf("    Failed to allocate memory\n");
-        goto exit;
-    }
-
-    pDimensions = (POINT *)malloc(pageCount * sizeof(POINT));
-    if (pDimensions == NULL)
-    {
-        printf("    Failed to allocate memory\n");
-        goto exit;
-    }
-
-    pPageNames = (LPSTR)malloc(pageCount * 64);
-    if (pPageNames == NULL)
-    {
-        printf("    Failed to allocate memory\n");
-        goto exit;
-    }
-
-    if (DeviceCapabilities(name, NULL, DC_PAPERS, (LPSTR)pSizes, NULL) <= 0)
-    {
-        printf("    Failed to get page sizes\n");
-        goto exit;
-    }
-
-    if (DeviceCapabilities(name, NULL, DC_PAPERSIZE, (LPSTR)pDimensions, NULL) <= 0)
-    {
-        printf("    Failed to get page dimensions\n");
-        goto exit;
-    }
-
-    if (DeviceCapabilities(name, NULL, DC_PAPERNAMES, pPageNames, NULL) <= 0)
-    {
-        printf("    Failed to get page names\n");
-        goto exit;
-    }
-
-    printf("  Found %u page types\n", pageCount);
-
-    for (DWORD i = 0; i < pageCount; i++)
-    {
-        WORD size = pSizes[i];
-        POINT *pDimension = &pDimensions[i];
-        LPSTR pPageName = pPageNames + (i * 64);
-        printf("    %u: %s %ux%u\n", size, pPageName, pDimension->x, pDimension->y);
-    }
-
-    colourCapability = DeviceCapabilities(name, NULL, DC_COLORDEVICE, NULL, NULL);
-    if (colourCapability == 1)
-    {
-        printf("  Colour: Yes\n");
+        fprintf(out, "  Colour: Yes\n");
     }
     else
     {
-        printf("  Colour: No\n");
+        fprintf(out, "  Colour: No\n");
     }
 
-exit:
-    if (pSizes != NULL)
-        free(pSizes);
-
-    if (pDimensions != NULL)
-        free(pDimensions);
-
-    if (pPageNames != NULL)
-        free(pPageNames);
+    fprintf(out, "  DPI: %dx%d\n", caps->dpi_x, caps->dpi_y);
 }
 
-void get_printer_dpi(LPCSTR name)
+void list_printers(FILE *out, const struct inventory *inventory)
 {
-    HDC hPrinter = NULL;
-    DWORD xDPI = 0, yDPI = 0;
-
-    hPrinter = CreateDC("WINSPOOL", name, NULL, NULL);
-
-    xDPI = GetDeviceCaps(hPrinter, LOGPIXELSX);
-    yDPI = GetDeviceCaps(hPrinter, LOGPIXELSY);
-
-    DeleteDC(hPrinter);
-
-    printf("  DPI: %ux%u\n", xDPI, yDPI);
+    struct caps_cache *cache = NULL;
+
+    cache = caps_cache_open(NULL);
+    if (cache == NULL)
+        log_error("Failed to open capability cache");
+
+    fprintf(out, "Found %d printers\n", inventory->count);
+    for (int i = 0; i < inventory->count; i++)
+    {
+        const struct inventory_printer *printer = &inventory->printers[i];
+
+        fprintf(out, "%s\n", printer->info.name);
+        fprintf(out, "  port: %s\n", printer->info.port);
+        fprintf(out, "  driver: %s\n", printer->info.driver);
+        fprintf(out, "  processor: %s\n", printer->info.processor);
+
+        if (printer->status == -ETIMEDOUT)
+        {
+            fprintf(out, "    Timed out after %.3f s\n", timing_ns_to_s(printer->probe_ns));
+            continue;
+        }
+
+        if (printer->status < 0)
+        {
+            fprintf(out, "    Failed to get capabilities (%d)\n", printer->status);
+            continue;
+        }
+
+        for (int j = 0; j < printer->datatype_count; j++)
+            fprintf(out, "    %s\n", printer->datatypes[j]);
+
+        list_capabilities(
+            out,
+            printer,
+            cache != NULL ?
+                caps_cache_peek(cache, printer->info.name, printer->driver_version) : NULL);
+    }
+
+    fprintf(
+        out,
+        "Probed %d printers in %.3f s, %d from the snapshot, %d failed, %d timed out\n",
+        inventory->probed,
+        timing_ns_to_s(inventory->elapsed_ns),
+        inventory->reused,
+        inventory->failed,
+        inventory->timed_out);
+
+    caps_cache_close(cache);
 }
 
-void list_printers(void)
+int main(int argc, char **argv)
 {
-    DWORD needed = 0, returned = 0;
-    PRINTER_INFO_2 *pInfo = NULL;
-
-    printf("Listing printers\n");
-
-    EnumPrinters(PRINTER_ENUM_LOCAL | PRINTER_ENUM_CONNECTIONS, NULL, 2, NULL, 0, &needed, &returned);
-    if (needed <= 0)
-    {
-        printf("Failed to get printer info\n");
+    int rc = 0;
+    const struct print_backend *backend = NULL;
+    const char *backend_name = NULL;
+    const char *format = "text";
+    const char *output_path = NULL;
+    const char *snapshot_path = NULL;
+    struct inventory_options options = {0};
+    struct inventory previous = {0};
+    struct inventory inventory = {0};
+    FILE *out = stdout;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--backend") == 0 && i + 1 < argc)
+        {
+            backend_name = argv[++i];
+        }
+        else if (strcmp(argv[i], "--format") == 0 && i + 1 < argc)
+        {
+            format = argv[++i];
+        }
+        else if (strcmp(argv[i], "--output") == 0 && i + 1 < argc)
+        {
+            output_path = argv[++i];
+        }
+        else if (strcmp(argv[i], "--snapshot") == 0 && i + 1 < argc)
+        {
+            snapshot_path = argv[++i];
+        }
+        else if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc)
+        {
+            options.threads = atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--timeout-ms") == 0 && i + 1 < argc)
+        {
+            options.timeout_ms = atoi(argv[++i]);
+        }
+        else
+        {
+            printf(
+                "Usage: %s [--backend <name>] [--format text|json|csv] [--output <path>]\n"
+                "       [--snapshot <path>] [--threads <n>] [--timeout-ms <n>]\n",
+                argv[0]);
+            return -EINVAL;
+        }
+    }
+
+    if (strcmp(format, "text") != 0 && strcmp(format, "json") != 0 && strcmp(format, "csv") != 0)
+    {
+        log_error("Unknown format \"%s\"", format);
+        return -EINVAL;
+    }
+
+    backend = print_backend_find(backend_name);
+    if (backend == NULL)
+        return -EINVAL;
+
+    if (snapshot_path != NULL)
+    {
+        rc = inventory_load(&previous, snapshot_path);
+        if (rc < 0 && rc != -ENOENT)
+            printf("Probing every printer again\n");
+    }
+
+    if (strcmp(format, "text") == 0)
+        printf("Listing printers\n");
+
+    rc = inventory_take(backend, &previous, &options, &inventory);
+    if (rc < 0)
         goto exit;
-    }
 
-    pInfo = (PRINTER_INFO_2 *)malloc(needed);
-    if (pInfo == NULL)
-    {
-        printf("Failed to allocate memory\n");
-        goto exit;
-    }
+    if (snapshot_path != NULL)
+        inventory_save(&inventory, snapshot_path);
 
-    if (!EnumPrinters(PRINTER_ENUM_LOCAL | PRINTER_ENUM_CONNECTIONS, NULL, 2, (LPBYTE)pInfo, needed, &needed, &returned))
+    if (output_path != NULL)
     {
-        printf("Failed to get printer info\n");
-        goto exit;
+        out = fopen(output_path, "w");
+        if (out == NULL)
+        {
+            log_error("Failed to create \"%s\"", output_path);
+            rc = -EIO;
+            goto exit;
+        }
     }
 
-    printf("Found %u printers\n", returned);
-    for (DWORD i = 0; i < returned; i++)
+    if (strcmp(format, "json") == 0)
+        inventory_write_json(&inventory, out);
+    else if (strcmp(format, "csv") == 0)
+        inventory_write_csv(&inventory, out);
+    else
+        list_printers(out, &inventory);
+
+    if (out != stdout && fclose(out) != 0)
     {
-        PRINTER_INFO_2 *pPrinterInfo = &pInfo[i];
-
-        printf("%s\n", pPrinterInfo->pPrinterName);
-        printf("  port: %s\n", pPrinterInfo->pPortName);
-        printf("  driver: %s\n", pPrinterInfo->pDriverName);
-        printf("  processor: %s\n", pPrinterInfo->pPrintProcessor);
-        list_print_processor_datatypes(pPrinterInfo->pPrintProcessor);
-        list_capabilities(pPrinterInfo->pPrinterName);
-        get_printer_dpi(pPrinterInfo->pPrinterName);
+        log_error("Failed to write \"%s\"", output_path);
+        rc = -EIO;
     }
 
 exit:
-    if (pInfo != NULL)
-        free(pInfo);
-}
-
-int main()
-{
-    list_printers();
+    inventory_free(&inventory);
+    inventory_free(&previous);
 
-    return 0;
+    return rc;
 }
@@ -0,0 +1,433 @@
+#include <stdarg.h>
+#include <stdatomic.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "log.h"
+#include "text_record.h"
+#include "thread.h"
+#include "timing.h"
+
+/* Records the queue holds, a power of two. */
+#define LOG_QUEUE_RECORDS 1024
+
+/* How long the writer sleeps when there's nothing to write. Waking it is
+ * best effort, so this is also the longest a record can sit unwritten. */
+#define LOG_IDLE_MS 100
+
+struct log_record
+{
+    uint64_t time_ns;
+    uint64_t job;
+    const char *stage;
+    int level;
+    int thread;
+    char printer[64];
+    char message[256];
+};
+
+/* A bounded queue for many producers and one consumer. A slot's sequence
+ * says whose turn it is: equal to its position when it's free to fill,
+ * one past when it holds a record for the writer. Producers claim
+ * positions by compare and swap, so logging never takes a lock. */
+struct log_slot
+{
+    atomic_size_t sequence;
+    struct log_record record;
+};
+
+static struct log_slot slots[LOG_QUEUE_RECORDS];
+static atomic_size_t enqueue_pos;
+
+/* Only the writer moves this. */
+static size_t dequeue_pos;
+
+static atomic_ullong dropped;
+
+static struct once log_once = ONCE_INIT;
+static atomic_int min_level = LOG_LEVEL_INFO;
+static int json;
+static FILE *sink;
+static uint64_t origin_ns;
+
+/* Whether records go through the writer. If it can't start, and once it
+ * has stopped at exit, they're written as they're logged, under
+ * direct_lock, which the writer also holds while it writes. */
+static atomic_int queued;
+static struct mutex direct_lock;
+
+static struct thread writer;
+static struct mutex writer_lock;
+static struct cond wake;
+static struct cond drained;
+static atomic_int writer_idle;
+static int writer_stop;
+
+/* Records written, up to which position. Guarded by writer_lock. */
+static size_t written_pos;
+
+static atomic_int next_thread;
+static THREAD_LOCAL int this_thread;
+static THREAD_LOCAL struct log_context context;
+
+static const char *const level_names[] = {"debug", "info", "warn", "error"};
+
+static int parse_level(const char *name)
+{
+    for (int i = 0; i < LOG_LEVEL_OFF; i++)
+    {
+        if (strcmp(name, level_names[i]) == 0)
+            return i;
+    }
+
+    if (strcmp(name, "off") == 0)
+        return LOG_LEVEL_OFF;
+
+    return -1;
+}
+
+static void write_record(const struct log_record *record)
+{
+    double time_s = timing_ns_to_s(record->time_ns - origin_ns);
+
+    if (json)
+    {
+        fprintf(
+            sink,
+            "{\"time\": %.6f, \"level\": \"%s\", \"thread\": %d",
+            time_s,
+            level_names[record->level],
+            record->thread);
+
+        if (record->job != 0)
+            fprintf(sink, ", \"job\": %llu", (unsigned long long)record->job);
+
+        if (record->printer[0] != '\0')
+        {
+            fprintf(sink, ", \"printer\": ");
+            text_record_write_json_string(sink, record->printer);
+        }
+
+        if (record->stage != NULL)
+        {
+            fprintf(sink, ", \"stage\": ");
+            text_record_write_json_string(sink, record->stage);
+        }
+
+        fprintf(sink, ", \"message\": ");
+        text_record_write_json_string(sink, record->message);
+        fprintf(sink, "}\n");
+
+        return;
+    }
+
+    fprintf(sink, "%10.6f %-5s %d", time_s, level_names[record->level], record->thread);
+
+    if (record->job != 0)
+        fprintf(sink, " job=%llu", (unsigned long long)record->job);
+
+    if (record->printer[0] != '\0')
+        fprintf(sink, " printer=\"%s\"", record->printer);
+
+    if (record->stage != NULL)
+        fprintf(sink, " stage=\"%s\"", record->stage);
+
+    fprintf(sink, ": %s\n", record->message);
+}
+
+/* Writes everything queued, oldest first. Only the writer calls this. */
+static void drain(void)
+{
+    unsigned long long lost = atomic_exchange(&dropped, 0);
+
+    mutex_lock(&direct_lock);
+
+    if (lost > 0)
+    {
+        if (json)
+        {
+            struct log_record notice = {
+                .time_ns = timing_now_ns(),
+                .level = LOG_LEVEL_WARN,
+            };
+
+            snprintf(notice.message, sizeof(notice.message), "%llu records dropped", lost);
+            write_record(&notice);
+        }
+        else
+        {
+            fprintf(sink, "%10s %-5s -: %llu records dropped\n", "", "warn", lost);
+        }
+    }
+
+    for (;;)
+    {
+        struct log_slot *slot = &slots[dequeue_pos & (LOG_QUEUE_RECORDS - 1)];
+        size_t sequence = atomic_load_explicit(&slot->sequence, memory_order_acquire);
+
+        if (sequence != dequeue_pos + 1)
+            break;
+
+        write_record(&slot->record);
+
+        atomic_store_explicit(
+            &slot->sequence,
+            dequeue_pos + LOG_QUEUE_RECORDS,
+            memory_order_release);
+        dequeue_pos++;
+    }
+
+    fflush(sink);
+    mutex_unlock(&direct_lock);
+}
+
+static int queue_empty(void)
+{
+    struct log_slot *slot = &slots[dequeue_pos & (LOG_QUEUE_RECORDS - 1)];
+
+    return atomic_load_explicit(&slot->sequence, memory_order_acquire) != dequeue_pos + 1;
+}
+
+static void writer_main(void *arg)
+{
+    (void)arg;
+
+    mutex_lock(&writer_lock);
+
+    for (;;)
+    {
+        int stop = writer_stop;
+
+        mutex_unlock(&writer_lock);
+        drain();
+        mutex_lock(&writer_lock);
+
+        written_pos = dequeue_pos;
+        cond_broadcast(&drained);
+
+        /* Stopping, but only once everything queued has been written. */
+        if (stop)
+            break;
+
+        atomic_store(&writer_idle, 1);
+
+        if (queue_empty() && !writer_stop)
+            cond_wait_ms(&wake, &writer_lock, LOG_IDLE_MS);
+
+        atomic_store(&writer_idle, 0);
+    }
+
+    mutex_unlock(&writer_lock);
+}
+
+static void stop_writer(void)
+{
+    atomic_store(&queued, 0);
+
+    mutex_lock(&writer_lock);
+    writer_stop = 1;
+    cond_signal(&wake);
+    mutex_unlock(&writer_lock);
+
+    thread_join(&writer);
+}
+
+static void init_log(void)
+{
+    const char *level = getenv("PRINT_LOG_LEVEL");
+    const char *format = getenv("PRINT_LOG_FORMAT");
+    const char *path = getenv("PRINT_LOG_FILE");
+
+    origin_ns = timing_now_ns();
+    sink = stderr;
+
+    mutex_init(&direct_lock);
+    mutex_init(&writer_lock);
+    cond_init(&wake);
+    cond_init(&drained);
+
+    for (size_t i = 0; i < LOG_QUEUE_RECORDS; i++)
+        atomic_init(&slots[i].sequence, i);
+
+    if (level != NULL && parse_level(level) >= 0)
+        atomic_store(&min_level, parse_level(level));
+
+    json = format != NULL && strcmp(format, "json") == 0;
+
+    if (path != NULL && path[0] != '\0')
+    {
+        sink = fopen(path, "a");
+        if (sink == NULL)
+        {
+            fprintf(stderr, "Failed to open log \"%s\"\n", path);
+            sink = stderr;
+        }
+    }
+
+    if (thread_create(&writer, writer_main, NULL) < 0)
+        return;
+
+    atomic_store(&queued, 1);
+    atexit(stop_writer);
+}
+
+static void start_log(void)
+{
+    thread_once(&log_once, init_log);
+}
+
+/* Claims the next free slot, or returns NULL if the queue is full. */
+static struct log_slot *claim_slot(size_t *position)
+{
+    size_t pos = atomic_load_explicit(&enqueue_pos, memory_order_relaxed);
+
+    for (;;)
+    {
+        struct log_slot *slot = &slots[pos & (LOG_QUEUE_RECORDS - 1)];
+        size_t sequence = atomic_load_explicit(&slot->sequence, memory_order_acquire);
+
+        if (sequence == pos)
+        {
+            if (atomic_compare_exchange_weak_explicit(
+                    &enqueue_pos,
+                    &pos,
+                    pos + 1,
+                    memory_order_relaxed,
+                    memory_order_relaxed))
+            {
+                *position = pos;
+                return slot;
+            }
+        }
+        else if ((ptrdiff_t)(sequence - pos) < 0)
+        {
+            /* The writer hasn't got to this slot since it was last used. */
+            return NULL;
+        }
+        else
+        {
+            pos = atomic_load_explicit(&enqueue_pos, memory_order_relaxed);
+        }
+    }
+}
+
+static void fill_record(struct log_record *record, int level, const char *format, va_list args)
+{
+    if (this_thread == 0)
+        this_thread = atomic_fetch_add(&next_thread, 1) + 1;
+
+    record->time_ns = timing_now_ns();
+    record->job = context.job;
+    record->stage = context.stage;
+    record->level = level;
+    record->thread = this_thread;
+
+    snprintf(
+        record->printer,
+        sizeof(record->printer),
+        "%s",
+        context.printer != NULL ? context.printer : "");
+    vsnprintf(record->message, sizeof(record->message), format, args);
+}
+
+void log_write(int level, const char *format, ...)
+{
+    va_list args;
+    struct log_slot *slot = NULL;
+    size_t position = 0;
+
+    start_log();
+
+    if (level < atomic_load_explicit(&min_level, memory_order_relaxed))
+        return;
+
+    va_start(args, format);
+
+    if (!atomic_load(&queued))
+    {
+        struct log_record record;
+
+        fill_record(&record, level, format, args);
+
+        mutex_lock(&direct_lock);
+        write_record(&record);
+        fflush(sink);
+        mutex_unlock(&direct_lock);
+
+        goto exit;
+    }
+
+    slot = claim_slot(&position);
+    if (slot == NULL)
+    {
+        atomic_fetch_add(&dropped, 1);
+        goto exit;
+    }
+
+    fill_record(&slot->record, level, format, args);
+    atomic_store_explicit(&slot->sequence, position + 1, memory_order_release);
+
+    if (atomic_load(&writer_idle))
+        cond_signal(&wake);
+
+exit:
+    va_end(args);
+}
+
+int log_enabled(int level)
+{
+    start_log();
+
+    return level >= LOG_MIN_LEVEL && level >= atomic_load(&min_level);
+}
+
+void log_set_level(int level)
+{
+    start_log();
+
+    atomic_store(&min_level, level);
+}
+
+struct log_context log_set_context(const struct log_context *new_context)
+{
+    struct log_context old = context;
+
+    context = *new_context;
+
+    return old;
+}
+
+const char *log_set_stage(const char *stage)
+{
+    const char *old = context.stage;
+
+    context.stage = stage;
+
+    return old;
+}
+
+void log_flush(void)
+{
+    size_t target = 0;
+
+    start_log();
+
+    if (!atomic_load(&queued))
+        return;
+
+    target = atomic_load(&enqueue_pos);
+
+    mutex_lock(&writer_lock);
+
+    /* A record claimed but not yet filled in holds the writer up, so keep
+     * waking it until it's past. */
+    while (written_pos < target && !writer_stop)
+    {
+        cond_signal(&wake);
+        cond_wait_ms(&drained, &writer_lock, LOG_IDLE_MS);
+    }
+
+    mutex_unlock(&writer_lock);
+}
@@ -0,0 +1,89 @@
+#ifndef LOG_H
+#define LOG_H
+
+#include <stdint.h>
+
+/* Diagnostics. A record is formatted into memory on the thread that logs
+ * it and put on a lock-free queue, and a writer thread of the logger's own
+ * does the console or file I/O. Logging never waits: if the writer falls
+ * behind and the queue fills, records are dropped and counted.
+ *
+ * Each record carries the level, the time, the thread, and whatever job,
+ * printer and stage the thread has set in its context (log_set_context()).
+ *
+ * Records go to stderr, or to the file $PRINT_LOG_FILE, as text lines or,
+ * with $PRINT_LOG_FORMAT=json, one JSON object per line. $PRINT_LOG_LEVEL
+ * (debug, info, warn, error or off) sets the least severe level written,
+ * info by default. Levels below LOG_MIN_LEVEL aren't compiled in at all. */
+
+#define LOG_LEVEL_DEBUG 0
+#define LOG_LEVEL_INFO 1
+#define LOG_LEVEL_WARN 2
+#define LOG_LEVEL_ERROR 3
+#define LOG_LEVEL_OFF 4
+
+#ifndef LOG_MIN_LEVEL
+#define LOG_MIN_LEVEL LOG_LEVEL_DEBUG
+#endif
+
+#if defined(__GNUC__) && !defined(_WIN32)
+#define LOG_FORMAT_CHECK __attribute__((format(printf, 2, 3)))
+#else
+#define LOG_FORMAT_CHECK
+#endif
+
+struct log_context
+{
+    /* 0 for none. */
+    uint64_t job;
+
+    /* Kept by pointer, so they must last as long as the context is set.
+     * NULL for none. */
+    const char *printer;
+    const char *stage;
+};
+
+void log_write(int level, const char *format, ...) LOG_FORMAT_CHECK;
+
+#if LOG_MIN_LEVEL <= LOG_LEVEL_DEBUG
+#define log_debug(...) log_write(LOG_LEVEL_DEBUG, __VA_ARGS__)
+#else
+#define log_debug(...) ((void)0)
+#endif
+
+#if LOG_MIN_LEVEL <= LOG_LEVEL_INFO
+#define log_info(...) log_write(LOG_LEVEL_INFO, __VA_ARGS__)
+#else
+#define log_info(...) ((void)0)
+#endif
+
+#if LOG_MIN_LEVEL <= LOG_LEVEL_WARN
+#define log_warn(...) log_write(LOG_LEVEL_WARN, __VA_ARGS__)
+#else
+#define log_warn(...) ((void)0)
+#endif
+
+#if LOG_MIN_LEVEL <= LOG_LEVEL_ERROR
+#define log_error(...) log_write(LOG_LEVEL_ERROR, __VA_ARGS__)
+#else
+#define log_error(...) ((void)0)
+#endif
+
+/* Whether a record at level would be written, for callers that have work
+ * to do to make one. */
+int log_enabled(int level);
+
+void log_set_level(int level);
+
+/* Sets the calling thread's context, returning the one it replaces so it
+ * can be put back. */
+struct log_context log_set_context(const struct log_context *context);
+
+/* Sets just the stage, returning the one it replaces. */
+const char *log_set_stage(const char *stage);
+
+/* Waits until every record logged so far has been written. Records still
+ * queued when the program exits are written then. */
+void log_flush(void);
+
+#endif /* LOG_H */
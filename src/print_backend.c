@@ -0,0 +1,80 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "count_of.h"
+#include "log.h"
+#include "print_backend.h"
+
+static const struct print_backend *const backends[] = {
+#ifdef _WIN32
+    &win32_backend,
+#endif
+    &file_backend,
+    &zpl_backend,
+    &null_backend,
+};
+
+const struct print_backend *print_backend_find(const char *name)
+{
+    if (name == NULL)
+        return backends[0];
+
+    for (int i = 0; i < COUNT_OF(backends); i++)
+    {
+        if (strcmp(backends[i]->name, name) == 0)
+            return backends[i];
+    }
+
+    log_error("Unknown print backend \"%s\"", name);
+
+    return NULL;
+}
+
+void printer_caps_free(struct printer_caps *caps)
+{
+    if (caps->papers != NULL)
+        free(caps->papers);
+
+    memset(caps, 0, sizeof(*caps));
+}
+
+const struct paper_info *printer_caps_find_paper(
+    const struct printer_caps *caps,
+    const char *paper_name)
+{
+    for (int i = 0; i < caps->paper_count; i++)
+    {
+        if (strcmp(caps->papers[i].name, paper_name) == 0)
+            return &caps->papers[i];
+    }
+
+    return NULL;
+}
+
+void coordinate_space_from_device(
+    struct coordinate_space *space,
+    const struct paper_info *paper)
+{
+    /* Our drawing is done in logical units and, for convenience, we'll use
+     * 1/10 mm units (as returned by DC_PAPERSIZE) and represent the entire
+     * page. */
+    space->logical.width = paper->width;
+    space->logical.height = paper->height;
+
+    double scale_x = (double)space->logical.width / (double)space->device.width;
+    double scale_y = (double)space->logical.height / (double)space->device.height;
+
+    space->logical.offset_x = (int)(space->device.offset_x * scale_x);
+    space->logical.offset_y = (int)(space->device.offset_y * scale_y);
+}
+
+int coordinate_space_device_x(const struct coordinate_space *space, int x)
+{
+    return (int)round_div((long long)x * space->device.width, space->logical.width);
+}
+
+int coordinate_space_device_y(const struct coordinate_space *space, int y)
+{
+    return (int)round_div((long long)y * space->device.height, space->logical.height);
+}
@@ -0,0 +1,329 @@
+#ifndef PRINT_BACKEND_H
+#define PRINT_BACKEND_H
+
+/* The narrow set of operations the tools need from a print system. The
+ * Win32 backend talks to the spooler and GDI; the file backend is an
+ * in-process spooler that writes each job to a text file, so the pipeline
+ * can run and be tested without a Windows print host. The zpl backend
+ * skips the driver and sends label printers ZPL.
+ *
+ * All drawing is in logical units of 1/10 mm on the physical page, the
+ * same units DC_PAPERSIZE reports. */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "bitmap.h"
+#include "scanline.h"
+
+#define PRINTER_NAME_LENGTH 256
+#define PAPER_NAME_LENGTH 64
+#define DATATYPE_NAME_LENGTH 32
+#define DRIVER_VERSION_LENGTH 128
+
+struct printer_info
+{
+    char name[PRINTER_NAME_LENGTH];
+    char port[PRINTER_NAME_LENGTH];
+    char driver[PRINTER_NAME_LENGTH];
+    char processor[PRINTER_NAME_LENGTH];
+};
+
+struct paper_info
+{
+    short size;
+    int width;
+    int height;
+    char name[PAPER_NAME_LENGTH];
+};
+
+struct printer_caps
+{
+    struct paper_info *papers;
+    int paper_count;
+    int colour;
+    int dpi_x;
+    int dpi_y;
+};
+
+struct coordinate_space
+{
+    struct
+    {
+        int width;
+        int height;
+        int offset_x;
+        int offset_y;
+    } logical;
+
+    struct
+    {
+        int width;
+        int height;
+        int offset_x;
+        int offset_y;
+    } device;
+};
+
+struct rect
+{
+    int left;
+    int top;
+    int right;
+    int bottom;
+};
+
+struct point
+{
+    int x;
+    int y;
+};
+
+struct session_options
+{
+    const char *paper_name;
+
+    /* Optional. When the caller already knows the paper details, e.g.
+     * from the capability cache, the backend doesn't query them again. */
+    const struct paper_info *paper;
+
+    /* Render pages with the built-in rasteriser and send the printer 1bpp
+     * bands at its own resolution instead of drawing commands. */
+    int raster;
+
+    /* The most memory a raster band may use, which bounds the memory
+     * rendering a page takes whatever its size. 0 for the default. */
+    size_t band_bytes;
+
+    /* Threads to render raster bands on, < 0 for one per CPU. 0 or 1
+     * renders them on the thread that ends the page. */
+    int raster_threads;
+
+    /* Send rastered rows compressed, each in whichever of the methods in
+     * scanline.h is smallest for it. */
+    int compress;
+};
+
+/* What rendering pages with the rasteriser has cost a session so far. */
+struct raster_stats
+{
+    uint64_t pages;
+    uint64_t bands;
+
+    /* Commands rendered, counting a command once for each band it
+     * touches. */
+    uint64_t commands;
+
+    uint64_t plan_ns;
+    uint64_t render_ns;
+    uint64_t emit_ns;
+    uint64_t slowest_band_ns;
+
+    /* From the start of a page to its first band being handed on, and to
+     * its last. */
+    uint64_t first_band_ns;
+    uint64_t page_ns;
+
+    /* The band buffer and per-band command lists at their largest. */
+    size_t peak_bytes;
+
+    /* Rows sent compressed, and what they came to. */
+    struct scanline_stats compression;
+};
+
+struct print_backend;
+
+/* Drawing recorded once and replayed onto any number of pages, kept in
+ * memory by the backend. Labels are mostly static layout, so the layout is
+ * recorded as a template and each label only draws its own fields over
+ * it. Only valid with the session that recorded or loaded it. */
+struct page_template;
+
+/* An open printer configured for one paper. Setting up the device is the
+ * expensive part of printing, so a session is opened once and then used
+ * for any number of documents, each with any number of pages.
+ *
+ * Backends extend this with their own state, so it must be the first
+ * member of their session structure. */
+struct print_session
+{
+    const struct print_backend *backend;
+    struct paper_info paper;
+    struct coordinate_space space;
+    int dpi_x;
+    int dpi_y;
+    int printable_width;
+    int printable_height;
+
+    int raster;
+    int compress;
+    struct raster_stats raster_stats;
+
+    int in_document;
+
+    /* Pages in the current document. */
+    int page_count;
+    int document_count;
+};
+
+struct print_backend
+{
+    const char *name;
+
+    /* Fills a malloc'd array the caller frees. */
+    int (*enum_printers)(struct printer_info **printers, int *count);
+
+    /* Fills names with up to max datatypes the printer's print processor
+     * accepts and returns how many there are. */
+    int (*get_datatypes)(
+        const struct printer_info *printer,
+        char (*names)[DATATYPE_NAME_LENGTH],
+        int max);
+
+    /* Release with printer_caps_free(). */
+    int (*get_capabilities)(const char *printer_name, struct printer_caps *caps);
+
+    /* A string that changes whenever the printer's driver does. Much
+     * cheaper than get_capabilities, so it's used to validate cached
+     * capabilities. */
+    int (*get_driver_version)(const char *printer_name, char *version, size_t size);
+
+    /* Configures the printer for the requested paper and works out the
+     * page geometry. */
+    int (*open_session)(
+        const char *printer_name,
+        const struct session_options *options,
+        struct print_session **session);
+
+    /* Each document becomes one spool job. */
+    int (*start_document)(struct print_session *session, const char *document_name);
+
+    /* Ends the document, or throws it away if abort is set. */
+    int (*end_document)(struct print_session *session, int abort);
+
+    int (*start_page)(struct print_session *session);
+    int (*end_page)(struct print_session *session);
+
+    /* Outlined and solid rectangles, lines and a single line of text whose
+     * top-left corner is at x, y. */
+    int (*draw_rect)(struct print_session *session, const struct rect *r);
+    int (*fill_rect)(struct print_session *session, const struct rect *r);
+    int (*draw_line)(struct print_session *session, int x0, int y0, int x1, int y1);
+    int (*draw_text)(struct print_session *session, int x, int y, int height, const char *text);
+
+    /* A solid polygon, filled even-odd. */
+    int (*fill_polygon)(struct print_session *session, const struct point *points, int count);
+
+    /* Stretches a 1bpp bitmap over the rectangle. Sized at the device
+     * resolution, it maps one pixel to one pixel. */
+    int (*draw_bitmap)(
+        struct print_session *session,
+        const struct rect *r,
+        const struct bitmap *bitmap);
+
+    /* Between begin_template and end_template drawing goes into a new
+     * template instead of onto a page. Templates are recorded outside of
+     * pages, but can be recorded inside a document. */
+    int (*begin_template)(struct print_session *session);
+    int (*end_template)(struct print_session *session, struct page_template **page_template);
+
+    /* Replays a template onto the current page, moved by x, y. */
+    int (*draw_template)(
+        struct print_session *session,
+        const struct page_template *page_template,
+        int x,
+        int y);
+
+    /* Copies a template into a malloc'd buffer the caller frees, and back.
+     * The buffer can be handed to another thread or process and loaded
+     * into any session printing on the same paper. */
+    int (*serialise_template)(
+        const struct page_template *page_template,
+        void **data,
+        size_t *size);
+    int (*deserialise_template)(
+        struct print_session *session,
+        const void *data,
+        size_t size,
+        struct page_template **page_template);
+
+    void (*free_template)(struct page_template *page_template);
+
+    /* Aborts any unfinished document and frees the session. */
+    void (*close_session)(struct print_session *session);
+};
+
+extern const struct print_backend file_backend;
+extern const struct print_backend null_backend;
+extern const struct print_backend zpl_backend;
+
+#ifdef _WIN32
+extern const struct print_backend win32_backend;
+#endif
+
+/* Looks a backend up by name. NULL picks the platform default. */
+const struct print_backend *print_backend_find(const char *name);
+
+void printer_caps_free(struct printer_caps *caps);
+
+const struct paper_info *printer_caps_find_paper(
+    const struct printer_caps *caps,
+    const char *paper_name);
+
+/* Works out the logical side of the coordinate space from the paper size
+ * once the device side is known. */
+void coordinate_space_from_device(
+    struct coordinate_space *space,
+    const struct paper_info *paper);
+
+/* n / d rounded to nearest, for either sign of n. */
+static inline long long round_div(long long n, long long d)
+{
+    if (d < 0)
+    {
+        n = -n;
+        d = -d;
+    }
+
+    return n >= 0 ? (n + d / 2) / d : -((-n + d / 2) / d);
+}
+
+/* Tenths of a millimetre to pixels at dpi, rounded to the nearest. */
+static inline int mm_10_to_px(int mm_10, int dpi)
+{
+    /* 254 tenths of a millimetre to the inch. */
+    return (mm_10 * dpi + 127) / 254;
+}
+
+/* Logical units to device pixels, rounded to the nearest pixel. */
+int coordinate_space_device_x(const struct coordinate_space *space, int x);
+int coordinate_space_device_y(const struct coordinate_space *space, int y);
+
+static inline int print_session_start_document(
+    struct print_session *session,
+    const char *document_name)
+{
+    return session->backend->start_document(session, document_name);
+}
+
+static inline int print_session_end_document(struct print_session *session, int abort)
+{
+    return session->backend->end_document(session, abort);
+}
+
+static inline int print_session_start_page(struct print_session *session)
+{
+    return session->backend->start_page(session);
+}
+
+static inline int print_session_end_page(struct print_session *session)
+{
+    return session->backend->end_page(session);
+}
+
+static inline void print_session_close(struct print_session *session)
+{
+    session->backend->close_session(session);
+}
+
+#endif /* PRINT_BACKEND_H */
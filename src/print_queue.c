@@ -0,0 +1,613 @@
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "log.h"
+#include "print_queue.h"
+#include "raster.h"
+#include "thread.h"
+#include "timing.h"
+#include "trace.h"
+
+#define DEFAULT_CAPACITY 8
+
+struct print_job
+{
+    struct print_queue *queue;
+    struct print_job *next;
+
+    uint64_t id;
+    char name[128];
+
+    struct display_list *pages;
+    int page_count;
+
+    enum print_job_state state;
+    int rc;
+    int cancelled;
+    uint64_t print_ns;
+
+    print_job_fn done;
+    void *context;
+
+    /* The queue's until the job finishes, and the caller's until it's
+     * released. Guarded by the queue's lock. */
+    int refs;
+
+    uint64_t submitted_ns;
+};
+
+struct print_queue
+{
+    struct mutex lock;
+    struct cond work;
+    struct cond room;
+    struct cond done;
+    int shutdown;
+
+    /* Jobs waiting to print, oldest first. */
+    struct print_job *head;
+    struct print_job *tail;
+    int depth;
+    int capacity;
+
+    /* Jobs submitted that haven't finished, printing or not. */
+    int pending;
+    uint64_t next_id;
+
+    struct thread thread;
+
+    /* Only read by the I/O thread, and by print_queue_create() until the
+     * session is open. */
+    const struct print_backend *backend;
+    const char *printer_name;
+    const struct session_options *options;
+    int opened;
+    int open_rc;
+
+    struct print_queue_stats stats;
+};
+
+static void free_pages(struct print_job *job)
+{
+    for (int i = 0; i < job->page_count; i++)
+        display_list_free(&job->pages[i]);
+
+    free(job->pages);
+    job->pages = NULL;
+    job->page_count = 0;
+}
+
+/* Called with the queue locked. */
+static int unref_job(struct print_job *job)
+{
+    return --job->refs == 0;
+}
+
+static void free_job(struct print_job *job)
+{
+    free_pages(job);
+    free(job);
+}
+
+static int print_document(struct print_session *session, struct print_job *job)
+{
+    int rc = 0;
+
+    rc = print_session_start_document(session, job->name);
+    if (rc < 0)
+    {
+        log_error("Failed to start document");
+        return rc;
+    }
+
+    for (int i = 0; i < job->page_count; i++)
+    {
+        rc = print_session_start_page(session);
+        if (rc < 0)
+        {
+            log_error("Failed to start page");
+            goto error;
+        }
+
+        rc = display_list_play(&job->pages[i], session, 0, 0);
+        if (rc < 0)
+        {
+            log_error("Failed to draw page");
+            goto error;
+        }
+
+        rc = print_session_end_page(session);
+        if (rc < 0)
+        {
+            log_error("Failed to end page");
+            goto error;
+        }
+    }
+
+    rc = print_session_end_document(session, 0);
+    if (rc < 0)
+        log_error("Failed to end document");
+
+    return rc;
+
+error:
+    print_session_end_document(session, 1);
+
+    return rc;
+}
+
+static void io_main(void *arg)
+{
+    struct print_queue *queue = (struct print_queue *)arg;
+    struct print_session *session = NULL;
+    struct log_context context = {0};
+    char printer[PRINTER_NAME_LENGTH];
+    int rc = 0;
+
+    trace_thread_name("print queue");
+
+    /* The name is only the caller's until the session is open. */
+    snprintf(printer, sizeof(printer), "%s", queue->printer_name);
+    context.printer = printer;
+    log_set_context(&context);
+
+    rc = queue->backend->open_session(queue->printer_name, queue->options, &session);
+
+    mutex_lock(&queue->lock);
+    queue->open_rc = rc < 0 ? rc : 0;
+    queue->opened = 1;
+    cond_broadcast(&queue->done);
+    mutex_unlock(&queue->lock);
+
+    if (rc < 0)
+        return;
+
+    for (;;)
+    {
+        struct print_job *job = NULL;
+        uint64_t start_ns = 0;
+        int last = 0;
+
+        mutex_lock(&queue->lock);
+
+        while (queue->head == NULL && !queue->shutdown)
+            cond_wait(&queue->work, &queue->lock);
+
+        /* Shutting down, but only once everything queued has printed. */
+        if (queue->head == NULL)
+        {
+            mutex_unlock(&queue->lock);
+            break;
+        }
+
+        job = queue->head;
+        queue->head = job->next;
+        if (queue->head == NULL)
+            queue->tail = NULL;
+
+        queue->depth--;
+        job->state = PRINT_JOB_PRINTING;
+
+        start_ns = timing_now_ns();
+        queue->stats.queued_ns += start_ns - job->submitted_ns;
+
+        cond_broadcast(&queue->room);
+        mutex_unlock(&queue->lock);
+
+        /* Cancelling sets the flag under the lock while the job is still
+         * queued, so it can't change once the job has been taken. */
+        if (job->cancelled)
+        {
+            rc = -ECANCELED;
+        }
+        else
+        {
+            struct trace_span span = trace_begin("print job");
+
+            context.job = job->id;
+            context.stage = "print job";
+            log_set_context(&context);
+
+            rc = print_document(session, job);
+            trace_end(&span);
+
+            if (rc >= 0)
+                log_debug(
+                    "Spooled \"%s\", %d pages in %.3f ms",
+                    job->name,
+                    job->page_count,
+                    timing_ns_to_s(timing_now_ns() - start_ns) * 1e3);
+
+            context.job = 0;
+            context.stage = NULL;
+            log_set_context(&context);
+        }
+
+        mutex_lock(&queue->lock);
+
+        job->rc = rc;
+        job->state = rc < 0 ? PRINT_JOB_FAILED : PRINT_JOB_SPOOLED;
+        job->print_ns = timing_now_ns() - start_ns;
+
+        if (rc == -ECANCELED)
+            queue->stats.cancelled++;
+        else if (rc < 0)
+            queue->stats.failed++;
+        else
+            queue->stats.spooled++;
+
+        if (rc >= 0)
+            queue->stats.pages += (uint64_t)job->page_count;
+
+        queue->stats.print_ns += job->print_ns;
+        queue->stats.raster = session->raster_stats;
+
+        cond_broadcast(&queue->done);
+        mutex_unlock(&queue->lock);
+
+        if (job->done != NULL)
+            job->done(job, job->context);
+
+        free_pages(job);
+
+        mutex_lock(&queue->lock);
+        queue->pending--;
+        last = unref_job(job);
+        cond_broadcast(&queue->done);
+        mutex_unlock(&queue->lock);
+
+        if (last)
+            free_job(job);
+    }
+
+    print_session_close(session);
+}
+
+int print_queue_create(
+    const struct print_backend *backend,
+    const char *printer_name,
+    const struct session_options *options,
+    int capacity,
+    struct print_queue **queue)
+{
+    int rc = 0;
+    struct print_queue *q = NULL;
+
+    q = (struct print_queue *)calloc(1, sizeof(*q));
+    if (q == NULL)
+    {
+        log_error("Failed to allocate memory");
+        return -ENOMEM;
+    }
+
+    mutex_init(&q->lock);
+    cond_init(&q->work);
+    cond_init(&q->room);
+    cond_init(&q->done);
+
+    q->capacity = capacity > 0 ? capacity : DEFAULT_CAPACITY;
+    q->backend = backend;
+    q->printer_name = printer_name;
+    q->options = options;
+
+    rc = thread_create(&q->thread, io_main, q);
+    if (rc < 0)
+    {
+        log_error("Failed to start print thread");
+        goto error;
+    }
+
+    /* The session is opened on the I/O thread, which then owns it. */
+    mutex_lock(&q->lock);
+
+    while (!q->opened)
+        cond_wait(&q->done, &q->lock);
+
+    rc = q->open_rc;
+    q->printer_name = NULL;
+    q->options = NULL;
+
+    mutex_unlock(&q->lock);
+
+    if (rc < 0)
+    {
+        log_error("Failed to open print session");
+        thread_join(&q->thread);
+        goto error;
+    }
+
+    *queue = q;
+
+    return 0;
+
+error:
+    cond_destroy(&q->done);
+    cond_destroy(&q->room);
+    cond_destroy(&q->work);
+    mutex_destroy(&q->lock);
+    free(q);
+
+    return rc;
+}
+
+void print_queue_destroy(struct print_queue *queue)
+{
+    if (queue == NULL)
+        return;
+
+    mutex_lock(&queue->lock);
+    queue->shutdown = 1;
+    cond_broadcast(&queue->work);
+    cond_broadcast(&queue->room);
+    mutex_unlock(&queue->lock);
+
+    thread_join(&queue->thread);
+
+    cond_destroy(&queue->done);
+    cond_destroy(&queue->room);
+    cond_destroy(&queue->work);
+    mutex_destroy(&queue->lock);
+
+    free(queue);
+}
+
+int print_queue_submit(
+    struct print_queue *queue,
+    const char *document_name,
+    struct display_list *pages,
+    int page_count,
+    print_job_fn done,
+    void *context,
+    int wait,
+    struct print_job **job)
+{
+    int rc = 0;
+    struct print_job *j = NULL;
+
+    if (page_count < 1)
+        return -EINVAL;
+
+    j = (struct print_job *)calloc(1, sizeof(*j));
+    if (j == NULL)
+    {
+        log_error("Failed to allocate memory");
+        return -ENOMEM;
+    }
+
+    j->pages = (struct display_list *)malloc((size_t)page_count * sizeof(*j->pages));
+    if (j->pages == NULL)
+    {
+        log_error("Failed to allocate memory");
+        free(j);
+        return -ENOMEM;
+    }
+
+    j->queue = queue;
+    snprintf(j->name, sizeof(j->name), "%s", document_name);
+    j->done = done;
+    j->context = context;
+    j->refs = job != NULL ? 2 : 1;
+
+    mutex_lock(&queue->lock);
+
+    if (queue->depth >= queue->capacity && !queue->shutdown)
+    {
+        uint64_t start_ns = timing_now_ns();
+
+        if (!wait)
+        {
+            rc = -EAGAIN;
+            goto exit;
+        }
+
+        while (queue->depth >= queue->capacity && !queue->shutdown)
+            cond_wait(&queue->room, &queue->lock);
+
+        queue->stats.full_waits++;
+        queue->stats.full_wait_ns += timing_now_ns() - start_ns;
+    }
+
+    if (queue->shutdown)
+    {
+        rc = -EPIPE;
+        goto exit;
+    }
+
+    /* The pages are only taken once the job is sure to be queued. */
+    memcpy(j->pages, pages, (size_t)page_count * sizeof(*pages));
+    memset(pages, 0, (size_t)page_count * sizeof(*pages));
+    j->page_count = page_count;
+
+    j->id = ++queue->next_id;
+    j->state = PRINT_JOB_QUEUED;
+    j->submitted_ns = timing_now_ns();
+
+    if (queue->tail != NULL)
+        queue->tail->next = j;
+    else
+        queue->head = j;
+
+    queue->tail = j;
+    queue->depth++;
+    queue->pending++;
+    queue->stats.submitted++;
+
+    if (queue->depth > queue->stats.peak_depth)
+        queue->stats.peak_depth = queue->depth;
+
+    cond_signal(&queue->work);
+
+exit:
+    mutex_unlock(&queue->lock);
+
+    if (rc < 0)
+    {
+        free(j->pages);
+        free(j);
+        return rc;
+    }
+
+    if (job != NULL)
+        *job = j;
+
+    return 0;
+}
+
+int print_queue_pending(struct print_queue *queue)
+{
+    int pending = 0;
+
+    mutex_lock(&queue->lock);
+    pending = queue->pending;
+    mutex_unlock(&queue->lock);
+
+    return pending;
+}
+
+void print_queue_drain(struct print_queue *queue)
+{
+    mutex_lock(&queue->lock);
+
+    while (queue->pending > 0)
+        cond_wait(&queue->done, &queue->lock);
+
+    mutex_unlock(&queue->lock);
+}
+
+void print_queue_get_stats(struct print_queue *queue, struct print_queue_stats *stats)
+{
+    mutex_lock(&queue->lock);
+    *stats = queue->stats;
+    mutex_unlock(&queue->lock);
+}
+
+void print_queue_print_stats(const struct print_queue_stats *stats)
+{
+    uint64_t finished = stats->spooled + stats->failed + stats->cancelled;
+
+    printf("Queued %llu jobs: %llu spooled, %llu failed, %llu cancelled, %llu pages\n",
+           (unsigned long long)stats->submitted,
+           (unsigned long long)stats->spooled,
+           (unsigned long long)stats->failed,
+           (unsigned long long)stats->cancelled,
+           (unsigned long long)stats->pages);
+
+    if (finished > 0)
+    {
+        printf("  %.3f ms queued, %.3f ms printing per job\n",
+               timing_ns_to_s(stats->queued_ns) * 1e3 / (double)finished,
+               timing_ns_to_s(stats->print_ns) * 1e3 / (double)finished);
+    }
+
+    printf("  At most %d jobs waiting, submitters held back %llu times for %.3f ms\n",
+           stats->peak_depth,
+           (unsigned long long)stats->full_waits,
+           timing_ns_to_s(stats->full_wait_ns) * 1e3);
+
+    print_raster_stats(&stats->raster);
+}
+
+uint64_t print_job_id(const struct print_job *job)
+{
+    return job->id;
+}
+
+enum print_job_state print_job_state(struct print_job *job)
+{
+    enum print_job_state state;
+
+    mutex_lock(&job->queue->lock);
+    state = job->state;
+    mutex_unlock(&job->queue->lock);
+
+    return state;
+}
+
+int print_job_wait(struct print_job *job)
+{
+    struct print_queue *queue = job->queue;
+    int rc = 0;
+
+    mutex_lock(&queue->lock);
+
+    while (job->state == PRINT_JOB_QUEUED || job->state == PRINT_JOB_PRINTING)
+        cond_wait(&queue->done, &queue->lock);
+
+    rc = job->rc;
+
+    mutex_unlock(&queue->lock);
+
+    return rc;
+}
+
+int print_job_cancel(struct print_job *job)
+{
+    int rc = 0;
+
+    mutex_lock(&job->queue->lock);
+
+    if (job->state == PRINT_JOB_QUEUED)
+        job->cancelled = 1;
+    else
+        rc = -EBUSY;
+
+    mutex_unlock(&job->queue->lock);
+
+    return rc;
+}
+
+uint64_t print_job_print_ns(struct print_job *job)
+{
+    uint64_t print_ns = 0;
+
+    mutex_lock(&job->queue->lock);
+    print_ns = job->print_ns;
+    mutex_unlock(&job->queue->lock);
+
+    return print_ns;
+}
+
+void print_job_take_pages(struct print_job *job, struct display_list **pages, int *page_count)
+{
+    /* The I/O thread only frees the pages after the callback returns, so
+     * nothing else touches them now. */
+    *pages = job->pages;
+    *page_count = job->page_count;
+
+    job->pages = NULL;
+    job->page_count = 0;
+}
+
+void print_job_release(struct print_job *job)
+{
+    int last = 0;
+
+    if (job == NULL)
+        return;
+
+    mutex_lock(&job->queue->lock);
+    last = unref_job(job);
+    mutex_unlock(&job->queue->lock);
+
+    if (last)
+        free_job(job);
+}
+
+const char *print_job_state_name(enum print_job_state state)
+{
+    switch (state)
+    {
+    case PRINT_JOB_QUEUED:
+        return "queued";
+    case PRINT_JOB_PRINTING:
+        return "printing";
+    case PRINT_JOB_SPOOLED:
+        return "spooled";
+    case PRINT_JOB_FAILED:
+        return "failed";
+    }
+
+    return "unknown";
+}
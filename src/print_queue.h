@@ -0,0 +1,131 @@
+#ifndef PRINT_QUEUE_H
+#define PRINT_QUEUE_H
+
+#include <stdint.h>
+
+#include "display_list.h"
+#include "print_backend.h"
+
+/* Prints documents on a thread of its own, so the threads that make them
+ * never wait on StartDoc, the driver or the spooler. The queue's I/O
+ * thread opens the session and is the only thread that uses it. Each job
+ * is one document, its pages recorded as display lists, and is printed in
+ * the order it was submitted.
+ *
+ * The queue holds a fixed number of jobs that haven't started printing.
+ * When it's full, submitting either waits for room or fails with -EAGAIN,
+ * so a producer that outpaces the printer is held back rather than piling
+ * up pages in memory. */
+
+enum print_job_state
+{
+    PRINT_JOB_QUEUED,
+    PRINT_JOB_PRINTING,
+
+    /* The backend took the whole document. Backends don't say when the
+     * printer itself is done, so this is as far as a job goes. */
+    PRINT_JOB_SPOOLED,
+
+    /* Including jobs cancelled before they started, which fail with
+     * -ECANCELED. */
+    PRINT_JOB_FAILED,
+};
+
+struct print_job;
+struct print_queue;
+
+/* Called on the I/O thread once a job is spooled or has failed. It mustn't
+ * wait on the queue, and should be quick, as the next job waits for it. */
+typedef void (*print_job_fn)(struct print_job *job, void *context);
+
+struct print_queue_stats
+{
+    uint64_t submitted;
+    uint64_t spooled;
+    uint64_t failed;
+    uint64_t cancelled;
+    uint64_t pages;
+
+    /* Jobs waiting to print, at most. */
+    int peak_depth;
+
+    /* Submitters held back by a full queue, and for how long in all. */
+    uint64_t full_waits;
+    uint64_t full_wait_ns;
+
+    /* From submission to the job starting, and from then to it being
+     * spooled or failing. */
+    uint64_t queued_ns;
+    uint64_t print_ns;
+
+    /* The session's, as of the last job. */
+    struct raster_stats raster;
+};
+
+/* Starts the I/O thread and opens a session on it. capacity is the number
+ * of jobs that may wait to print, <= 0 for a default. Fails if the session
+ * can't be opened. */
+int print_queue_create(
+    const struct print_backend *backend,
+    const char *printer_name,
+    const struct session_options *options,
+    int capacity,
+    struct print_queue **queue);
+
+/* Waits for every job submitted to finish, then closes the session and
+ * stops the I/O thread. Handles must be released first. */
+void print_queue_destroy(struct print_queue *queue);
+
+/* Queues a document of page_count pages. The pages are moved into the job,
+ * leaving the caller's lists empty, and freed once it's printed. With wait
+ * clear, returns -EAGAIN rather than waiting when the queue is full. done,
+ * if not NULL, is called when the job finishes. job, if not NULL, gets a
+ * handle to it, which must be released. */
+int print_queue_submit(
+    struct print_queue *queue,
+    const char *document_name,
+    struct display_list *pages,
+    int page_count,
+    print_job_fn done,
+    void *context,
+    int wait,
+    struct print_job **job);
+
+/* Jobs submitted that haven't finished. */
+int print_queue_pending(struct print_queue *queue);
+
+/* Waits until every job submitted so far has finished. */
+void print_queue_drain(struct print_queue *queue);
+
+void print_queue_get_stats(struct print_queue *queue, struct print_queue_stats *stats);
+
+void print_queue_print_stats(const struct print_queue_stats *stats);
+
+/* The order the job was submitted in, from 1. */
+uint64_t print_job_id(const struct print_job *job);
+
+enum print_job_state print_job_state(struct print_job *job);
+
+/* Waits for the job to finish. Returns 0 once it's spooled or the error it
+ * failed with. In the job's callback it has finished, so this returns at
+ * once. */
+int print_job_wait(struct print_job *job);
+
+/* Stops a job that hasn't started printing. It finishes as failed with
+ * -ECANCELED, callback and all, in its turn. Returns -EBUSY if it has
+ * already started. */
+int print_job_cancel(struct print_job *job);
+
+/* How long the job took to print, once it has finished. */
+uint64_t print_job_print_ns(struct print_job *job);
+
+/* Only from the job's callback: takes its pages back, so a job that failed
+ * can be submitted again elsewhere. The caller frees them, as a malloc'd
+ * array of page_count lists. */
+void print_job_take_pages(struct print_job *job, struct display_list **pages, int *page_count);
+
+void print_job_release(struct print_job *job);
+
+const char *print_job_state_name(enum print_job_state state);
+
+#endif /* PRINT_QUEUE_H */
@@ -0,0 +1,801 @@
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "log.h"
+#include "print_queue.h"
+#include "printer_pool.h"
+#include "thread.h"
+#include "timing.h"
+
+#define DEFAULT_CAPACITY 4
+
+/* How long a printer is out of use after a failure, doubling with each
+ * failure in a row. */
+#define BACKOFF_MS 1000
+#define MAX_BACKOFF_MS 30000
+
+struct device;
+
+struct pool_job
+{
+    struct printer_pool *pool;
+
+    /* On its printer's list while it's there, or on the retry list. */
+    struct pool_job *next;
+
+    int stream;
+    char name[128];
+
+    /* Only held while the job isn't on a printer. */
+    struct display_list *pages;
+    int page_count;
+
+    /* Failures, not counting being cancelled. */
+    int attempts;
+
+    struct device *device;
+    struct print_job *handle;
+};
+
+struct device
+{
+    char name[PRINTER_NAME_LENGTH];
+    struct print_queue *queue;
+
+    /* Jobs sent and not finished, oldest first, as the queue prints them. */
+    struct pool_job *head;
+    struct pool_job *tail;
+    int in_flight;
+
+    /* A moving average of recent jobs, 0 until one is done. */
+    uint64_t job_ns;
+
+    uint64_t down_until_ns;
+    int failures;
+
+    uint64_t spooled;
+    uint64_t errors;
+};
+
+/* Where a stream's outstanding jobs are. Entries with nothing outstanding
+ * are reused. */
+struct stream
+{
+    int id;
+    int device;
+    int in_flight;
+
+    /* Waiting for its jobs to finish so it can move to an idle printer. */
+    int moving;
+
+    /* The retry pass that found it blocked, so its later jobs wait too. */
+    unsigned pass;
+};
+
+struct printer_pool
+{
+    struct mutex lock;
+
+    /* Signalled whenever a job finishes. */
+    struct cond changed;
+
+    struct device *devices;
+    int device_count;
+    int capacity;
+
+    /* Where the search for the least-loaded printer starts, so ties are
+     * shared out. */
+    int next_device;
+
+    struct stream *streams;
+    int stream_count;
+    int stream_capacity;
+    unsigned pass;
+
+    /* Jobs waiting to be sent again, oldest first. */
+    struct pool_job *retry_head;
+    struct pool_job *retry_tail;
+
+    /* Jobs submitted and not yet spooled or given up on. */
+    int pending;
+
+    struct printer_pool_stats stats;
+};
+
+/* Only * and ? are special. */
+static int match_pattern(const char *pattern, const char *name)
+{
+    if (*pattern == '\0')
+        return *name == '\0';
+
+    if (*pattern == '*')
+        return match_pattern(pattern + 1, name) ||
+               (*name != '\0' && match_pattern(pattern, name + 1));
+
+    if (*name == '\0' || (*pattern != '?' && *pattern != *name))
+        return 0;
+
+    return match_pattern(pattern + 1, name + 1);
+}
+
+static int add_device(struct printer_pool *pool, const char *name)
+{
+    struct device *devices = NULL;
+
+    for (int i = 0; i < pool->device_count; i++)
+    {
+        if (strcmp(pool->devices[i].name, name) == 0)
+            return 0;
+    }
+
+    devices = (struct device *)realloc(
+        pool->devices,
+        (size_t)(pool->device_count + 1) * sizeof(*devices));
+    if (devices == NULL)
+    {
+        log_error("Failed to allocate memory");
+        return -ENOMEM;
+    }
+
+    pool->devices = devices;
+    memset(&devices[pool->device_count], 0, sizeof(*devices));
+    snprintf(devices[pool->device_count].name, PRINTER_NAME_LENGTH, "%s", name);
+    pool->device_count++;
+
+    return 0;
+}
+
+/* Adds every printer the list names or matches. */
+static int add_devices(
+    struct printer_pool *pool,
+    const struct print_backend *backend,
+    const char *printers)
+{
+    int rc = 0;
+    struct printer_info *found = NULL;
+    int found_count = -1;
+    char *list = NULL;
+    char *next = NULL;
+
+    list = (char *)malloc(strlen(printers) + 1);
+    if (list == NULL)
+    {
+        log_error("Failed to allocate memory");
+        return -ENOMEM;
+    }
+
+    strcpy(list, printers);
+
+    for (char *item = list; item != NULL; item = next)
+    {
+        next = strchr(item, ',');
+        if (next != NULL)
+            *next++ = '\0';
+
+        while (*item == ' ')
+            item++;
+
+        if (*item == '\0')
+            continue;
+
+        if (strpbrk(item, "*?") == NULL)
+        {
+            rc = add_device(pool, item);
+            if (rc < 0)
+                goto exit;
+
+            continue;
+        }
+
+        if (found_count < 0)
+        {
+            rc = backend->enum_printers(&found, &found_count);
+            if (rc < 0)
+            {
+                log_error("Failed to enumerate printers");
+                goto exit;
+            }
+        }
+
+        for (int i = 0; i < found_count; i++)
+        {
+            if (!match_pattern(item, found[i].name))
+                continue;
+
+            rc = add_device(pool, found[i].name);
+            if (rc < 0)
+                goto exit;
+        }
+    }
+
+    if (pool->device_count == 0)
+    {
+        log_error("No printers match \"%s\"", printers);
+        rc = -ENOENT;
+    }
+
+exit:
+    free(found);
+    free(list);
+
+    return rc;
+}
+
+static struct stream *find_stream(struct printer_pool *pool, int id)
+{
+    struct stream *unused = NULL;
+
+    for (int i = 0; i < pool->stream_count; i++)
+    {
+        struct stream *stream = &pool->streams[i];
+
+        if (stream->id == id)
+            return stream;
+
+        /* Not one the retry pass under way has held back. */
+        if (stream->in_flight == 0 && stream->pass != pool->pass && unused == NULL)
+            unused = stream;
+    }
+
+    if (unused == NULL)
+    {
+        if (pool->stream_count == pool->stream_capacity)
+        {
+            int capacity = pool->stream_capacity > 0 ? pool->stream_capacity * 2 : 16;
+            struct stream *streams = NULL;
+
+            streams = (struct stream *)realloc(pool->streams, (size_t)capacity * sizeof(*streams));
+            if (streams == NULL)
+                return NULL;
+
+            pool->streams = streams;
+            pool->stream_capacity = capacity;
+        }
+
+        unused = &pool->streams[pool->stream_count++];
+    }
+
+    memset(unused, 0, sizeof(*unused));
+    unused->id = id;
+
+    return unused;
+}
+
+static int device_ready(const struct device *device, uint64_t now)
+{
+    return now >= device->down_until_ns;
+}
+
+/* The printer with room that should finish another job first, or NULL to
+ * wait for room. */
+static struct device *choose_device(struct printer_pool *pool)
+{
+    uint64_t now = timing_now_ns();
+    uint64_t typical = 0;
+    uint64_t best_cost = 0;
+    struct device *best = NULL;
+    int timed = 0;
+    int any_ready = 0;
+
+    /* Printers that haven't finished a job yet are assumed to be as fast
+     * as the rest. */
+    for (int i = 0; i < pool->device_count; i++)
+    {
+        if (pool->devices[i].job_ns > 0)
+        {
+            typical += pool->devices[i].job_ns;
+            timed++;
+        }
+    }
+
+    typical = timed > 0 ? typical / (uint64_t)timed : 1;
+
+    for (int k = 0; k < pool->device_count; k++)
+    {
+        int i = (pool->next_device + k) % pool->device_count;
+        struct device *device = &pool->devices[i];
+        uint64_t cost = 0;
+
+        if (!device_ready(device, now))
+            continue;
+
+        any_ready = 1;
+
+        if (device->in_flight >= pool->capacity)
+            continue;
+
+        cost = (uint64_t)(device->in_flight + 1) * (device->job_ns > 0 ? device->job_ns : typical);
+        if (best == NULL || cost < best_cost)
+        {
+            best = device;
+            best_cost = cost;
+        }
+    }
+
+    /* With every printer out of use, try the one due back first rather
+     * than hold the job. */
+    if (!any_ready)
+    {
+        for (int i = 0; i < pool->device_count; i++)
+        {
+            struct device *device = &pool->devices[i];
+
+            if (device->in_flight >= pool->capacity)
+                continue;
+
+            if (best == NULL || device->down_until_ns < best->down_until_ns)
+                best = device;
+        }
+    }
+
+    if (best != NULL)
+        pool->next_device = (int)(best - pool->devices + 1) % pool->device_count;
+
+    return best;
+}
+
+static int has_idle_device(const struct printer_pool *pool)
+{
+    uint64_t now = timing_now_ns();
+
+    for (int i = 0; i < pool->device_count; i++)
+    {
+        if (pool->devices[i].in_flight == 0 && device_ready(&pool->devices[i], now))
+            return 1;
+    }
+
+    return 0;
+}
+
+static void free_job(struct pool_job *job)
+{
+    if (job->pages != NULL)
+    {
+        for (int i = 0; i < job->page_count; i++)
+            display_list_free(&job->pages[i]);
+
+        free(job->pages);
+    }
+
+    free(job);
+}
+
+static void job_done(struct print_job *handle, void *context);
+
+/* Sends a job to a printer. Returns 1 once it's sent, 0 if it has to wait
+ * and < 0 if it can't be sent at all. Called with the pool locked. */
+static int place_job(struct printer_pool *pool, struct pool_job *job)
+{
+    int rc = 0;
+    struct stream *stream = find_stream(pool, job->stream);
+    struct device *device = NULL;
+
+    if (stream == NULL)
+    {
+        log_error("Failed to allocate memory");
+        return -ENOMEM;
+    }
+
+    /* A stream stays on one printer while it has jobs there, so they print
+     * in order. A busy stream would never leave a full printer, so when
+     * another is idle it stops there and moves once its jobs are done. */
+    if (stream->in_flight > 0)
+    {
+        device = &pool->devices[stream->device];
+
+        if (device->in_flight >= pool->capacity && has_idle_device(pool))
+            stream->moving = 1;
+
+        if (stream->moving ||
+            device->in_flight >= pool->capacity ||
+            !device_ready(device, timing_now_ns()))
+            return 0;
+    }
+    else
+    {
+        device = choose_device(pool);
+        if (device == NULL)
+            return 0;
+
+        stream->moving = 0;
+    }
+
+    rc = print_queue_submit(
+        device->queue,
+        job->name,
+        job->pages,
+        job->page_count,
+        job_done,
+        job,
+        0,
+        &job->handle);
+    if (rc == -EAGAIN)
+        return 0;
+
+    if (rc < 0)
+        return rc;
+
+    /* The queue has the pages now. */
+    free(job->pages);
+    job->pages = NULL;
+
+    job->device = device;
+    job->next = NULL;
+
+    if (device->tail != NULL)
+        device->tail->next = job;
+    else
+        device->head = job;
+
+    device->tail = job;
+    device->in_flight++;
+
+    stream->device = (int)(device - pool->devices);
+    stream->in_flight++;
+
+    return 1;
+}
+
+static void give_up(struct printer_pool *pool, struct pool_job *job)
+{
+    log_warn("Gave up on \"%s\" after %d attempts", job->name, job->attempts);
+
+    pool->stats.failed++;
+    pool->pending--;
+}
+
+/* Sends what it can of the retry list, keeping each stream in order.
+ * Called with the pool locked. */
+static void place_retries(struct printer_pool *pool)
+{
+    struct pool_job **link = &pool->retry_head;
+    struct pool_job *previous = NULL;
+    unsigned pass = ++pool->pass;
+
+    while (*link != NULL)
+    {
+        struct pool_job *job = *link;
+        struct pool_job *next = job->next;
+        struct stream *stream = find_stream(pool, job->stream);
+        int rc = 0;
+
+        if (stream != NULL && stream->pass == pass)
+        {
+            previous = job;
+            link = &job->next;
+            continue;
+        }
+
+        rc = place_job(pool, job);
+        if (rc == 0)
+        {
+            /* Anything later on the same stream waits behind it. */
+            stream->pass = pass;
+            previous = job;
+            link = &job->next;
+            continue;
+        }
+
+        /* Placing it has reused next for the printer's list. */
+        *link = next;
+        if (pool->retry_tail == job)
+            pool->retry_tail = previous;
+
+        if (rc < 0)
+        {
+            give_up(pool, job);
+            free_job(job);
+        }
+    }
+}
+
+static int has_retry(const struct printer_pool *pool, int stream)
+{
+    for (const struct pool_job *job = pool->retry_head; job != NULL; job = job->next)
+    {
+        if (job->stream == stream)
+            return 1;
+    }
+
+    return 0;
+}
+
+/* Runs on the printer's I/O thread. */
+static void job_done(struct print_job *handle, void *context)
+{
+    struct pool_job *job = (struct pool_job *)context;
+    struct printer_pool *pool = job->pool;
+    struct device *device = NULL;
+    struct stream *stream = NULL;
+    struct pool_job **link = NULL;
+    int rc = print_job_wait(handle);
+    uint64_t print_ns = print_job_print_ns(handle);
+    int finished = 0;
+
+    /* The job can finish before place_job() has let go of the lock. */
+    mutex_lock(&pool->lock);
+
+    device = job->device;
+
+    if (rc < 0)
+        print_job_take_pages(handle, &job->pages, &job->page_count);
+
+    for (link = &device->head; *link != NULL; link = &(*link)->next)
+    {
+        if (*link == job)
+        {
+            *link = job->next;
+            break;
+        }
+    }
+
+    device->tail = NULL;
+    for (struct pool_job *k = device->head; k != NULL; k = k->next)
+        device->tail = k;
+
+    device->in_flight--;
+
+    stream = find_stream(pool, job->stream);
+    if (stream != NULL)
+        stream->in_flight--;
+
+    if (rc >= 0)
+    {
+        device->spooled++;
+        device->failures = 0;
+        device->job_ns = device->job_ns > 0 ? (device->job_ns * 3 + print_ns) / 4 : print_ns;
+
+        pool->stats.spooled++;
+        pool->stats.pages += (uint64_t)job->page_count;
+        pool->pending--;
+        finished = 1;
+    }
+    else
+    {
+        /* Take the printer out of use, and send everything waiting for it
+         * elsewhere after this job. */
+        if (rc != -ECANCELED)
+        {
+            int backoff_ms = MAX_BACKOFF_MS;
+
+            if (device->failures < 5 && (BACKOFF_MS << device->failures) < MAX_BACKOFF_MS)
+                backoff_ms = BACKOFF_MS << device->failures;
+
+            device->errors++;
+            device->failures++;
+            device->down_until_ns = timing_now_ns() + (uint64_t)backoff_ms * 1000000;
+
+            log_warn("Printer \"%s\" failed, out of use for %d ms", device->name, backoff_ms);
+
+            for (struct pool_job *k = device->head; k != NULL; k = k->next)
+                print_job_cancel(k->handle);
+
+            job->attempts++;
+        }
+
+        if (job->attempts >= pool->device_count)
+        {
+            give_up(pool, job);
+            finished = 1;
+        }
+        else
+        {
+            job->next = NULL;
+            job->device = NULL;
+
+            if (pool->retry_tail != NULL)
+                pool->retry_tail->next = job;
+            else
+                pool->retry_head = job;
+
+            pool->retry_tail = job;
+            pool->stats.retried++;
+        }
+    }
+
+    print_job_release(handle);
+    job->handle = NULL;
+
+    cond_broadcast(&pool->changed);
+    mutex_unlock(&pool->lock);
+
+    if (finished)
+        free_job(job);
+}
+
+int printer_pool_create(
+    const struct print_backend *backend,
+    const char *printers,
+    const struct session_options *options,
+    int capacity,
+    struct printer_pool **pool)
+{
+    int rc = 0;
+    struct printer_pool *p = NULL;
+
+    p = (struct printer_pool *)calloc(1, sizeof(*p));
+    if (p == NULL)
+    {
+        log_error("Failed to allocate memory");
+        return -ENOMEM;
+    }
+
+    mutex_init(&p->lock);
+    cond_init(&p->changed);
+
+    p->capacity = capacity > 0 ? capacity : DEFAULT_CAPACITY;
+
+    rc = add_devices(p, backend, printers);
+    if (rc < 0)
+        goto error;
+
+    /* The pool counts each printer's jobs itself and never sends one more
+     * than capacity, so the queue never has to turn one away. */
+    for (int i = 0; i < p->device_count; i++)
+    {
+        rc = print_queue_create(backend, p->devices[i].name, options, p->capacity, &p->devices[i].queue);
+        if (rc < 0)
+        {
+            log_error("Failed to open \"%s\"", p->devices[i].name);
+            goto error;
+        }
+    }
+
+    *pool = p;
+
+    return 0;
+
+error:
+    printer_pool_destroy(p);
+
+    return rc;
+}
+
+void printer_pool_destroy(struct printer_pool *pool)
+{
+    if (pool == NULL)
+        return;
+
+    printer_pool_drain(pool);
+
+    for (int i = 0; i < pool->device_count; i++)
+        print_queue_destroy(pool->devices[i].queue);
+
+    free(pool->devices);
+    free(pool->streams);
+
+    cond_destroy(&pool->changed);
+    mutex_destroy(&pool->lock);
+
+    free(pool);
+}
+
+int printer_pool_size(const struct printer_pool *pool)
+{
+    return pool->device_count;
+}
+
+int printer_pool_submit(
+    struct printer_pool *pool,
+    int stream,
+    const char *document_name,
+    struct display_list *pages,
+    int page_count)
+{
+    int rc = 0;
+    struct pool_job *job = NULL;
+
+    if (page_count < 1)
+        return -EINVAL;
+
+    job = (struct pool_job *)calloc(1, sizeof(*job));
+    if (job != NULL)
+        job->pages = (struct display_list *)malloc((size_t)page_count * sizeof(*job->pages));
+
+    if (job == NULL || job->pages == NULL)
+    {
+        log_error("Failed to allocate memory");
+        free(job);
+        return -ENOMEM;
+    }
+
+    job->pool = pool;
+    job->stream = stream;
+    snprintf(job->name, sizeof(job->name), "%s", document_name);
+
+    memcpy(job->pages, pages, (size_t)page_count * sizeof(*pages));
+    memset(pages, 0, (size_t)page_count * sizeof(*pages));
+    job->page_count = page_count;
+
+    mutex_lock(&pool->lock);
+
+    pool->stats.submitted++;
+    pool->pending++;
+
+    /* Retries are older than anything new on their stream, so they go
+     * first. */
+    for (;;)
+    {
+        place_retries(pool);
+
+        if (!has_retry(pool, stream))
+        {
+            rc = place_job(pool, job);
+            if (rc != 0)
+                break;
+        }
+
+        cond_wait(&pool->changed, &pool->lock);
+    }
+
+    if (rc < 0)
+    {
+        log_error("Failed to queue \"%s\"", job->name);
+        pool->stats.submitted--;
+        pool->pending--;
+    }
+
+    mutex_unlock(&pool->lock);
+
+    if (rc < 0)
+    {
+        free_job(job);
+        return rc;
+    }
+
+    return 0;
+}
+
+void printer_pool_drain(struct printer_pool *pool)
+{
+    mutex_lock(&pool->lock);
+
+    for (;;)
+    {
+        place_retries(pool);
+
+        if (pool->pending == 0)
+            break;
+
+        cond_wait(&pool->changed, &pool->lock);
+    }
+
+    mutex_unlock(&pool->lock);
+}
+
+void printer_pool_get_stats(struct printer_pool *pool, struct printer_pool_stats *stats)
+{
+    mutex_lock(&pool->lock);
+    *stats = pool->stats;
+    mutex_unlock(&pool->lock);
+}
+
+void printer_pool_print_stats(struct printer_pool *pool)
+{
+    uint64_t now = timing_now_ns();
+
+    mutex_lock(&pool->lock);
+
+    printf("Pool of %d printers: %llu documents, %llu spooled, %llu given up on, %llu retried\n",
+           pool->device_count,
+           (unsigned long long)pool->stats.submitted,
+           (unsigned long long)pool->stats.spooled,
+           (unsigned long long)pool->stats.failed,
+           (unsigned long long)pool->stats.retried);
+
+    for (int i = 0; i < pool->device_count; i++)
+    {
+        const struct device *device = &pool->devices[i];
+
+        printf("  %s: %llu spooled, %.3f ms each lately, %llu failures%s\n",
+               device->name,
+               (unsigned long long)device->spooled,
+               timing_ns_to_s(device->job_ns) * 1e3,
+               (unsigned long long)device->errors,
+               device_ready(device, now) ? "" : " (out of use)");
+    }
+
+    mutex_unlock(&pool->lock);
+}
@@ -0,0 +1,74 @@
+#ifndef PRINTER_POOL_H
+#define PRINTER_POOL_H
+
+#include <stdint.h>
+
+#include "display_list.h"
+#include "print_backend.h"
+
+/* Spreads documents over a bank of printers, each with a print queue and
+ * I/O thread of its own, so throughput grows with the number of printers.
+ *
+ * Each document goes to the printer expected to finish it first: the jobs
+ * it already has times how long its recent jobs took. Documents belong to
+ * a stream, and a stream's documents print in the order they were
+ * submitted: while a stream has documents outstanding, the next one goes
+ * to the same printer.
+ *
+ * When a printer fails a document, the pool takes it out of use for a
+ * while and cancels what was waiting for it. Those documents are printed
+ * elsewhere, still in order within their streams. A document is given up
+ * on after failing on every printer in turn. */
+
+struct printer_pool;
+
+struct printer_pool_stats
+{
+    uint64_t submitted;
+    uint64_t spooled;
+
+    /* Given up on, after every attempt failed. */
+    uint64_t failed;
+
+    /* Documents sent to another printer after a failure or cancel. */
+    uint64_t retried;
+    uint64_t pages;
+};
+
+/* printers is a comma separated list of printer names, where * and ? in a
+ * name match it against the backend's printers. capacity is the number of
+ * documents each printer may have outstanding, <= 0 for a default. Fails if
+ * nothing matches or any printer can't be opened. */
+int printer_pool_create(
+    const struct print_backend *backend,
+    const char *printers,
+    const struct session_options *options,
+    int capacity,
+    struct printer_pool **pool);
+
+/* Waits for every document to finish, retries and all, then closes the
+ * printers. */
+void printer_pool_destroy(struct printer_pool *pool);
+
+int printer_pool_size(const struct printer_pool *pool);
+
+/* Queues a document of page_count pages on stream, waiting while the
+ * printer it must go to has no room. The pages are moved into the pool, as
+ * print_queue_submit() moves them. */
+int printer_pool_submit(
+    struct printer_pool *pool,
+    int stream,
+    const char *document_name,
+    struct display_list *pages,
+    int page_count);
+
+/* Waits until every document submitted so far has been spooled or given
+ * up on. */
+void printer_pool_drain(struct printer_pool *pool);
+
+void printer_pool_get_stats(struct printer_pool *pool, struct printer_pool_stats *stats);
+
+/* Prints the totals and a line for each printer. */
+void printer_pool_print_stats(struct printer_pool *pool);
+
+#endif /* PRINTER_POOL_H */
@@ -0,0 +1,930 @@
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "band_pool.h"
+#include "log.h"
+#include "raster.h"
+#include "timing.h"
+#include "trace.h"
+
+/* Printable ASCII, one byte per column, top row in the lowest bit. */
+static const unsigned char font_5x7[95][5] = {
+    {0x00, 0x00, 0x00, 0x00, 0x00}, /*   */
+    {0x00, 0x00, 0x5f, 0x00, 0x00}, /* ! */
+    {0x00, 0x07, 0x00, 0x07, 0x00}, /* " */
+    {0x14, 0x7f, 0x14, 0x7f, 0x14}, /* # */
+    {0x24, 0x2a, 0x7f, 0x2a, 0x12}, /* $ */
+    {0x23, 0x13, 0x08, 0x64, 0x62}, /* % */
+    {0x36, 0x49, 0x55, 0x22, 0x50}, /* & */
+    {0x00, 0x05, 0x03, 0x00, 0x00}, /* ' */
+    {0x00, 0x1c, 0x22, 0x41, 0x00}, /* ( */
+    {0x00, 0x41, 0x22, 0x1c, 0x00}, /* ) */
+    {0x08, 0x2a, 0x1c, 0x2a, 0x08}, /* * */
+    {0x08, 0x08, 0x3e, 0x08, 0x08}, /* + */
+    {0x00, 0x50, 0x30, 0x00, 0x00}, /* , */
+    {0x08, 0x08, 0x08, 0x08, 0x08}, /* - */
+    {0x00, 0x60, 0x60, 0x00, 0x00}, /* . */
+    {0x20, 0x10, 0x08, 0x04, 0x02}, /* / */
+    {0x3e, 0x51, 0x49, 0x45, 0x3e}, /* 0 */
+    {0x00, 0x42, 0x7f, 0x40, 0x00}, /* 1 */
+    {0x42, 0x61, 0x51, 0x49, 0x46}, /* 2 */
+    {0x21, 0x41, 0x45, 0x4b, 0x31}, /* 3 */
+    {0x18, 0x14, 0x12, 0x7f, 0x10}, /* 4 */
+    {0x27, 0x45, 0x45, 0x45, 0x39}, /* 5 */
+    {0x3c, 0x4a, 0x49, 0x49, 0x30}, /* 6 */
+    {0x01, 0x71, 0x09, 0x05, 0x03}, /* 7 */
+    {0x36, 0x49, 0x49, 0x49, 0x36}, /* 8 */
+    {0x06, 0x49, 0x49, 0x29, 0x1e}, /* 9 */
+    {0x00, 0x36, 0x36, 0x00, 0x00}, /* : */
+    {0x00, 0x56, 0x36, 0x00, 0x00}, /* ; */
+    {0x08, 0x14, 0x22, 0x41, 0x00}, /* < */
+    {0x14, 0x14, 0x14, 0x14, 0x14}, /* = */
+    {0x00, 0x41, 0x22, 0x14, 0x08}, /* > */
+    {0x02, 0x01, 0x51, 0x09, 0x06}, /* ? */
+    {0x32, 0x49, 0x79, 0x41, 0x3e}, /* @ */
+    {0x7e, 0x11, 0x11, 0x11, 0x7e}, /* A */
+    {0x7f, 0x49, 0x49, 0x49, 0x36}, /* B */
+    {0x3e, 0x41, 0x41, 0x41, 0x22}, /* C */
+    {0x7f, 0x41, 0x41, 0x22, 0x1c}, /* D */
+    {0x7f, 0x49, 0x49, 0x49, 0x41}, /* E */
+    {0x7f, 0x09, 0x09, 0x09, 0x01}, /* F */
+    {0x3e, 0x41, 0x49, 0x49, 0x7a}, /* G */
+    {0x7f, 0x08, 0x08, 0x08, 0x7f}, /* H */
+    {0x00, 0x41, 0x7f, 0x41, 0x00}, /* I */
+    {0x20, 0x40, 0x41, 0x3f, 0x01}, /* J */
+    {0x7f, 0x08, 0x14, 0x22, 0x41}, /* K */
+    {0x7f, 0x40, 0x40, 0x40, 0x40}, /* L */
+    {0x7f, 0x02, 0x0c, 0x02, 0x7f}, /* M */
+    {0x7f, 0x04, 0x08, 0x10, 0x7f}, /* N */
+    {0x3e, 0x41, 0x41, 0x41, 0x3e}, /* O */
+    {0x7f, 0x09, 0x09, 0x09, 0x06}, /* P */
+    {0x3e, 0x41, 0x51, 0x21, 0x5e}, /* Q */
+    {0x7f, 0x09, 0x19, 0x29, 0x46}, /* R */
+    {0x46, 0x49, 0x49, 0x49, 0x31}, /* S */
+    {0x01, 0x01, 0x7f, 0x01, 0x01}, /* T */
+    {0x3f, 0x40, 0x40, 0x40, 0x3f}, /* U */
+    {0x1f, 0x20, 0x40, 0x20, 0x1f}, /* V */
+    {0x3f, 0x40, 0x38, 0x40, 0x3f}, /* W */
+    {0x63, 0x14, 0x08, 0x14, 0x63}, /* X */
+    {0x07, 0x08, 0x70, 0x08, 0x07}, /* Y */
+    {0x61, 0x51, 0x49, 0x45, 0x43}, /* Z */
+    {0x00, 0x7f, 0x41, 0x41, 0x00}, /* [ */
+    {0x02, 0x04, 0x08, 0x10, 0x20}, /* \ */
+    {0x00, 0x41, 0x41, 0x7f, 0x00}, /* ] */
+    {0x04, 0x02, 0x01, 0x02, 0x04}, /* ^ */
+    {0x40, 0x40, 0x40, 0x40, 0x40}, /* _ */
+    {0x00, 0x01, 0x02, 0x04, 0x00}, /* ` */
+    {0x20, 0x54, 0x54, 0x54, 0x78}, /* a */
+    {0x7f, 0x48, 0x44, 0x44, 0x38}, /* b */
+    {0x38, 0x44, 0x44, 0x44, 0x20}, /* c */
+    {0x38, 0x44, 0x44, 0x48, 0x7f}, /* d */
+    {0x38, 0x54, 0x54, 0x54, 0x18}, /* e */
+    {0x08, 0x7e, 0x09, 0x01, 0x02}, /* f */
+    {0x0c, 0x52, 0x52, 0x52, 0x3e}, /* g */
+    {0x7f, 0x08, 0x04, 0x04, 0x78}, /* h */
+    {0x00, 0x44, 0x7d, 0x40, 0x00}, /* i */
+    {0x20, 0x40, 0x44, 0x3d, 0x00}, /* j */
+    {0x7f, 0x10, 0x28, 0x44, 0x00}, /* k */
+    {0x00, 0x41, 0x7f, 0x40, 0x00}, /* l */
+    {0x7c, 0x04, 0x18, 0x04, 0x78}, /* m */
+    {0x7c, 0x08, 0x04, 0x04, 0x78}, /* n */
+    {0x38, 0x44, 0x44, 0x44, 0x38}, /* o */
+    {0x7c, 0x14, 0x14, 0x14, 0x08}, /* p */
+    {0x08, 0x14, 0x14, 0x18, 0x7c}, /* q */
+    {0x7c, 0x08, 0x04, 0x04, 0x08}, /* r */
+    {0x48, 0x54, 0x54, 0x54, 0x20}, /* s */
+    {0x04, 0x3f, 0x44, 0x40, 0x20}, /* t */
+    {0x3c, 0x40, 0x40, 0x20, 0x7c}, /* u */
+    {0x1c, 0x20, 0x40, 0x20, 0x1c}, /* v */
+    {0x3c, 0x40, 0x30, 0x40, 0x3c}, /* w */
+    {0x44, 0x28, 0x10, 0x28, 0x44}, /* x */
+    {0x0c, 0x50, 0x50, 0x50, 0x3c}, /* y */
+    {0x44, 0x64, 0x54, 0x4c, 0x44}, /* z */
+    {0x00, 0x08, 0x36, 0x41, 0x00}, /* { */
+    {0x00, 0x00, 0x7f, 0x00, 0x00}, /* | */
+    {0x00, 0x41, 0x36, 0x08, 0x00}, /* } */
+    {0x08, 0x04, 0x08, 0x10, 0x08}, /* ~ */
+};
+
+#define FONT_ROWS 7
+#define FONT_COLUMNS 5
+
+/* The font is drawn in a cell one pixel wider and taller than a glyph. */
+#define FONT_CELL_WIDTH (FONT_COLUMNS + 1)
+#define FONT_CELL_HEIGHT (FONT_ROWS + 1)
+
+#define STACK_CROSSINGS 64
+
+/* The band being rendered, in device pixels. */
+struct band_target
+{
+    struct bitmap *band;
+    const struct coordinate_space *space;
+    int top;
+    int bottom;
+};
+
+static int clamp(int value, int low, int high)
+{
+    return value < low ? low : value > high ? high : value;
+}
+
+/* Fills or clears [x0, x1) x [y0, y1), clipped to the band. */
+static void paint_rect(struct band_target *t, int x0, int y0, int x1, int y1, int black)
+{
+    x0 = clamp(x0, 0, t->band->width);
+    x1 = clamp(x1, 0, t->band->width);
+    y0 = clamp(y0, t->top, t->bottom);
+    y1 = clamp(y1, t->top, t->bottom);
+
+    if (x1 <= x0)
+        return;
+
+    for (int y = y0; y < y1; y++)
+    {
+        unsigned char *row = bitmap_row(t->band, y - t->top);
+
+        if (black)
+            bitmap_fill_span(row, x0, x1);
+        else
+            bitmap_clear_span(row, x0, x1);
+    }
+}
+
+static void set_pixel(struct band_target *t, int x, int y)
+{
+    if (x < 0 || x >= t->band->width || y < t->top || y >= t->bottom)
+        return;
+
+    bitmap_row(t->band, y - t->top)[x / 8] |= (unsigned char)(0x80 >> (x % 8));
+}
+
+static void device_rect(const struct coordinate_space *space, const struct rect *r, int *x0, int *y0, int *x1, int *y1)
+{
+    int left = coordinate_space_device_x(space, r->left);
+    int right = coordinate_space_device_x(space, r->right);
+    int top = coordinate_space_device_y(space, r->top);
+    int bottom = coordinate_space_device_y(space, r->bottom);
+
+    *x0 = left < right ? left : right;
+    *x1 = left < right ? right : left;
+    *y0 = top < bottom ? top : bottom;
+    *y1 = top < bottom ? bottom : top;
+}
+
+static void render_fill(struct band_target *t, const struct rect *r)
+{
+    int x0, y0, x1, y1;
+
+    device_rect(t->space, r, &x0, &y0, &x1, &y1);
+    paint_rect(t, x0, y0, x1, y1, 1);
+}
+
+/* Like GDI's Rectangle() with a one pixel pen and a white brush: the
+ * right and bottom edges are inside the rectangle, and the inside is
+ * painted white. */
+static void render_rect(struct band_target *t, const struct rect *r)
+{
+    int x0, y0, x1, y1;
+
+    device_rect(t->space, r, &x0, &y0, &x1, &y1);
+
+    if (x1 <= x0 || y1 <= y0 || y1 <= t->top || y0 >= t->bottom)
+        return;
+
+    paint_rect(t, x0 + 1, y0 + 1, x1 - 1, y1 - 1, 0);
+    paint_rect(t, x0, y0, x1, y0 + 1, 1);
+    paint_rect(t, x0, y1 - 1, x1, y1, 1);
+    paint_rect(t, x0, y0, x0 + 1, y1, 1);
+    paint_rect(t, x1 - 1, y0, x1, y1, 1);
+}
+
+/* One pixel wide, leaving out the end point as LineTo() does. */
+static void render_line(struct band_target *t, int lx0, int ly0, int lx1, int ly1)
+{
+    int x0 = coordinate_space_device_x(t->space, lx0);
+    int y0 = coordinate_space_device_y(t->space, ly0);
+    int x1 = coordinate_space_device_x(t->space, lx1);
+    int y1 = coordinate_space_device_y(t->space, ly1);
+    int dx = x1 - x0;
+    int dy = y1 - y0;
+
+    if (dx == 0 && dy == 0)
+        return;
+
+    if (dy == 0)
+    {
+        if (dx > 0)
+            paint_rect(t, x0, y0, x1, y0 + 1, 1);
+        else
+            paint_rect(t, x1 + 1, y0, x0 + 1, y0 + 1, 1);
+        return;
+    }
+
+    if (abs(dy) >= abs(dx))
+    {
+        /* One pixel per row, and only the rows in this band. */
+        int first = dy > 0 ? y0 : y1 + 1;
+        int last = dy > 0 ? y1 : y0 + 1;
+
+        first = clamp(first, t->top, t->bottom);
+        last = clamp(last, t->top, t->bottom);
+
+        for (int y = first; y < last; y++)
+            set_pixel(t, x0 + (int)round_div((long long)(y - y0) * dx, dy), y);
+    }
+    else
+    {
+        int step = dx > 0 ? 1 : -1;
+
+        for (int x = x0; x != x1; x += step)
+            set_pixel(t, x, y0 + (int)round_div((long long)(x - x0) * dy, dx));
+    }
+}
+
+/* Device pixels per font pixel for text of the given logical height. */
+static int text_scale(const struct coordinate_space *space, int height)
+{
+    int size = (int)round_div((long long)coordinate_space_device_y(space, height), FONT_CELL_HEIGHT);
+
+    return size < 1 ? 1 : size;
+}
+
+static void render_text(struct band_target *t, int lx, int ly, int height, const char *text)
+{
+    int x = coordinate_space_device_x(t->space, lx);
+    int y = coordinate_space_device_y(t->space, ly);
+    int size = text_scale(t->space, height);
+
+    if (y >= t->bottom || y + FONT_ROWS * size <= t->top)
+        return;
+
+    for (; *text != '\0'; text++, x += FONT_CELL_WIDTH * size)
+    {
+        unsigned char c = (unsigned char)*text;
+        const unsigned char *glyph = font_5x7[(c >= 32 && c < 127 ? c : '?') - 32];
+
+        if (x >= t->band->width)
+            break;
+
+        for (int column = 0; column < FONT_COLUMNS; column++)
+        {
+            for (int row = 0; row < FONT_ROWS; row++)
+            {
+                if (glyph[column] & (1 << row))
+                {
+                    paint_rect(
+                        t,
+                        x + column * size,
+                        y + row * size,
+                        x + (column + 1) * size,
+                        y + (row + 1) * size,
+                        1);
+                }
+            }
+        }
+    }
+}
+
+/* A bitmap sized at the device resolution maps one pixel to one pixel,
+ * but its rectangle has been through logical units and may have gained or
+ * lost a pixel on the way. */
+static void bitmap_device_rect(
+    const struct coordinate_space *space,
+    const struct rect *r,
+    int width,
+    int height,
+    int *x0,
+    int *y0,
+    int *x1,
+    int *y1)
+{
+    device_rect(space, r, x0, y0, x1, y1);
+
+    if (abs(*x1 - *x0 - width) <= 1)
+        *x1 = *x0 + width;
+
+    if (abs(*y1 - *y0 - height) <= 1)
+        *y1 = *y0 + height;
+}
+
+/* ORs count bits of src onto dst starting at bit x. */
+static void or_bits(unsigned char *dst, int x, const unsigned char *src, int count)
+{
+    int shift = x % 8;
+    int bytes = count / 8;
+    int rest = count % 8;
+
+    dst += x / 8;
+
+    for (int i = 0; i < bytes; i++)
+    {
+        dst[i] |= (unsigned char)(src[i] >> shift);
+
+        if (shift != 0)
+            dst[i + 1] |= (unsigned char)(src[i] << (8 - shift));
+    }
+
+    if (rest > 0)
+    {
+        unsigned char last = (unsigned char)(src[bytes] & (0xff << (8 - rest)));
+
+        dst[bytes] |= (unsigned char)(last >> shift);
+
+        if (shift + rest > 8)
+            dst[bytes + 1] |= (unsigned char)(last << (8 - shift));
+    }
+}
+
+/* Stretched over the rectangle by nearest neighbour, replacing what's
+ * underneath like SRCCOPY. */
+static void render_bitmap(struct band_target *t, const struct rect *r, const struct bitmap *bitmap)
+{
+    int x0, y0, x1, y1;
+    int width = 0;
+    int height = 0;
+    int first = 0;
+    int last = 0;
+    int left = 0;
+    int right = 0;
+
+    bitmap_device_rect(t->space, r, bitmap->width, bitmap->height, &x0, &y0, &x1, &y1);
+
+    width = x1 - x0;
+    height = y1 - y0;
+    first = clamp(y0, t->top, t->bottom);
+    last = clamp(y1, t->top, t->bottom);
+    left = clamp(x0, 0, t->band->width);
+    right = clamp(x1, 0, t->band->width);
+
+    if (width <= 0 || height <= 0 || bitmap->width <= 0 || bitmap->height <= 0 || right <= left)
+        return;
+
+    for (int y = first; y < last; y++)
+    {
+        unsigned char *row = bitmap_row(t->band, y - t->top);
+        const unsigned char *src = bitmap_row(bitmap, (int)((long long)(y - y0) * bitmap->height / height));
+
+        bitmap_clear_span(row, left, right);
+
+        /* Symbols are rendered at the device resolution, so one pixel
+         * usually maps to one pixel and whole bytes can be shifted in. */
+        if (width == bitmap->width && left == x0 && right == x1)
+        {
+            or_bits(row, x0, src, width);
+            continue;
+        }
+
+        for (int x = left; x < right; x++)
+        {
+            int sx = (int)((long long)(x - x0) * bitmap->width / width);
+
+            if (src[sx / 8] & (0x80 >> (sx % 8)))
+                row[x / 8] |= (unsigned char)(0x80 >> (x % 8));
+        }
+    }
+}
+
+static void sort_crossings(double *crossings, int count)
+{
+    for (int i = 1; i < count; i++)
+    {
+        double value = crossings[i];
+        int j = i;
+
+        for (; j > 0 && crossings[j - 1] > value; j--)
+            crossings[j] = crossings[j - 1];
+
+        crossings[j] = value;
+    }
+}
+
+/* The first pixel whose centre is at or right of x. */
+static int first_centre(double x)
+{
+    int pixel = (int)(x - 0.5);
+
+    return pixel < x - 0.5 ? pixel + 1 : pixel;
+}
+
+/* Even-odd, sampling each pixel at its centre. */
+static int render_polygon(struct band_target *t, const struct point *logical, int count)
+{
+    struct point stack_points[STACK_CROSSINGS];
+    double stack_crossings[STACK_CROSSINGS];
+    struct point *points = stack_points;
+    double *crossings = stack_crossings;
+    int top = 0;
+    int bottom = 0;
+
+    if (count < 3)
+        return 0;
+
+    if (count > STACK_CROSSINGS)
+    {
+        points = (struct point *)malloc((size_t)count * sizeof(*points));
+        crossings = (double *)malloc((size_t)count * sizeof(*crossings));
+        if (points == NULL || crossings == NULL)
+        {
+            free(points);
+            free(crossings);
+            return -ENOMEM;
+        }
+    }
+
+    for (int i = 0; i < count; i++)
+    {
+        points[i].x = coordinate_space_device_x(t->space, logical[i].x);
+        points[i].y = coordinate_space_device_y(t->space, logical[i].y);
+
+        if (i == 0 || points[i].y < top)
+            top = points[i].y;
+
+        if (i == 0 || points[i].y > bottom)
+            bottom = points[i].y;
+    }
+
+    top = clamp(top, t->top, t->bottom);
+    bottom = clamp(bottom, t->top, t->bottom);
+
+    for (int y = top; y < bottom; y++)
+    {
+        double centre = y + 0.5;
+        int found = 0;
+
+        for (int i = 0, j = count - 1; i < count; j = i++)
+        {
+            const struct point *a = &points[j];
+            const struct point *b = &points[i];
+
+            if ((a->y <= centre) != (b->y <= centre))
+                crossings[found++] = a->x + (centre - a->y) * (b->x - a->x) / (b->y - a->y);
+        }
+
+        sort_crossings(crossings, found);
+
+        for (int i = 0; i + 1 < found; i += 2)
+        {
+            /* The pixels whose centres lie between the crossings. */
+            paint_rect(t, first_centre(crossings[i]), y, first_centre(crossings[i + 1]), y + 1, 1);
+        }
+    }
+
+    if (points != stack_points)
+    {
+        free(points);
+        free(crossings);
+    }
+
+    return 0;
+}
+
+/* The device rows [*top, *bottom) a command can draw on. */
+static void command_extent(
+    const struct display_list *page,
+    const struct coordinate_space *space,
+    const struct display_command *command,
+    int *top,
+    int *bottom)
+{
+    int x0, y0, x1, y1;
+
+    switch (command->op)
+    {
+    case DISPLAY_RECT:
+    case DISPLAY_FILL:
+        device_rect(space, &command->rect, &x0, top, &x1, bottom);
+        break;
+
+    case DISPLAY_LINE:
+        y0 = coordinate_space_device_y(space, command->line.y0);
+        y1 = coordinate_space_device_y(space, command->line.y1);
+        *top = y0 < y1 ? y0 : y1;
+        *bottom = (y0 < y1 ? y1 : y0) + 1;
+        break;
+
+    case DISPLAY_TEXT:
+        *top = coordinate_space_device_y(space, command->text.y);
+        *bottom = *top + FONT_ROWS * text_scale(space, command->text.height);
+        break;
+
+    case DISPLAY_BITMAP:
+        bitmap_device_rect(
+            space,
+            &command->bitmap.rect,
+            command->bitmap.width,
+            command->bitmap.height,
+            &x0,
+            top,
+            &x1,
+            bottom);
+        break;
+
+    case DISPLAY_POLYGON:
+        *top = 0;
+        *bottom = 0;
+
+        for (int i = 0; i < command->polygon.count; i++)
+        {
+            int y = coordinate_space_device_y(space, display_command_points(page, command)[i].y);
+
+            if (i == 0 || y < *top)
+                *top = y;
+
+            if (i == 0 || y > *bottom)
+                *bottom = y;
+        }
+        break;
+
+    default:
+        *top = 0;
+        *bottom = 0;
+        break;
+    }
+}
+
+static int reserve(void **buffer, size_t *capacity, size_t count, size_t size)
+{
+    void *grown = NULL;
+
+    if (count <= *capacity)
+        return 0;
+
+    grown = realloc(*buffer, count * size);
+    if (grown == NULL)
+    {
+        log_error("Failed to allocate memory");
+        return -ENOMEM;
+    }
+
+    *buffer = grown;
+    *capacity = count;
+
+    return 0;
+}
+
+int raster_plan_page(
+    struct raster_plan *plan,
+    const struct display_list *page,
+    const struct coordinate_space *space,
+    int band_height)
+{
+    int rc = 0;
+    int height = space->device.height;
+    int band_count = (height + band_height - 1) / band_height;
+    size_t total = 0;
+
+    plan->band_height = band_height;
+    plan->band_count = 0;
+
+    /* starts has room for a count ahead of the first band while it's
+     * being filled. */
+    rc = reserve((void **)&plan->starts, &plan->start_capacity, (size_t)band_count + 2, sizeof(*plan->starts));
+    if (rc < 0)
+        return rc;
+
+    rc = reserve((void **)&plan->extents, &plan->extent_capacity, page->count * 2, sizeof(*plan->extents));
+    if (rc < 0)
+        return rc;
+
+    memset(plan->starts, 0, ((size_t)band_count + 2) * sizeof(*plan->starts));
+
+    /* Count the commands in each band... */
+    for (size_t i = 0; i < page->count; i++)
+    {
+        int *extent = &plan->extents[i * 2];
+
+        command_extent(page, space, &page->commands[i], &extent[0], &extent[1]);
+
+        extent[0] = clamp(extent[0], 0, height);
+        extent[1] = clamp(extent[1], 0, height);
+
+        if (extent[1] <= extent[0])
+            continue;
+
+        for (int b = extent[0] / band_height; b <= (extent[1] - 1) / band_height; b++)
+            plan->starts[b + 2]++;
+    }
+
+    for (int b = 0; b < band_count; b++)
+    {
+        total += plan->starts[b + 2];
+        plan->starts[b + 2] = total;
+    }
+
+    rc = reserve((void **)&plan->commands, &plan->command_capacity, total, sizeof(*plan->commands));
+    if (rc < 0)
+        return rc;
+
+    /* ...then fill them in, which moves each band's start along to where
+     * the next band starts. */
+    for (size_t i = 0; i < page->count; i++)
+    {
+        const int *extent = &plan->extents[i * 2];
+
+        if (extent[1] <= extent[0])
+            continue;
+
+        for (int b = extent[0] / band_height; b <= (extent[1] - 1) / band_height; b++)
+            plan->commands[plan->starts[b + 1]++] = (uint32_t)i;
+    }
+
+    plan->band_count = band_count;
+
+    return 0;
+}
+
+size_t raster_plan_bytes(const struct raster_plan *plan)
+{
+    return plan->start_capacity * sizeof(*plan->starts) +
+           plan->command_capacity * sizeof(*plan->commands) +
+           plan->extent_capacity * sizeof(*plan->extents);
+}
+
+void raster_plan_free(struct raster_plan *plan)
+{
+    free(plan->starts);
+    free(plan->commands);
+    free(plan->extents);
+    memset(plan, 0, sizeof(*plan));
+}
+
+static int render_command(
+    struct band_target *t,
+    const struct display_list *page,
+    const struct display_command *command)
+{
+    struct bitmap bitmap;
+
+    switch (command->op)
+    {
+    case DISPLAY_RECT:
+        render_rect(t, &command->rect);
+        break;
+
+    case DISPLAY_FILL:
+        render_fill(t, &command->rect);
+        break;
+
+    case DISPLAY_LINE:
+        render_line(t, command->line.x0, command->line.y0, command->line.x1, command->line.y1);
+        break;
+
+    case DISPLAY_TEXT:
+        render_text(
+            t,
+            command->text.x,
+            command->text.y,
+            command->text.height,
+            display_command_text(page, command));
+        break;
+
+    case DISPLAY_BITMAP:
+        display_command_bitmap(page, command, &bitmap);
+        render_bitmap(t, &command->bitmap.rect, &bitmap);
+        break;
+
+    case DISPLAY_POLYGON:
+        return render_polygon(t, display_command_points(page, command), command->polygon.count);
+    }
+
+    return 0;
+}
+
+int raster_render_band(
+    const struct display_list *page,
+    const struct coordinate_space *space,
+    const struct raster_plan *plan,
+    int index,
+    struct bitmap *band)
+{
+    int rc = 0;
+    size_t first = plan->starts[index];
+    size_t last = plan->starts[index + 1];
+    struct band_target t = {
+        .band = band,
+        .space = space,
+        .top = index * plan->band_height,
+        .bottom = index * plan->band_height + band->height,
+    };
+
+    for (size_t i = first; i < last; i++)
+    {
+        rc = render_command(&t, page, &page->commands[plan->commands[i]]);
+        if (rc < 0)
+            return rc;
+    }
+
+    return (int)(last - first);
+}
+
+int raster_render_list(
+    const struct display_list *list,
+    const struct coordinate_space *space,
+    int y,
+    struct bitmap *band)
+{
+    int rc = 0;
+    struct band_target t = {
+        .band = band,
+        .space = space,
+        .top = y,
+        .bottom = y + band->height,
+    };
+
+    for (size_t i = 0; i < list->count && rc >= 0; i++)
+        rc = render_command(&t, list, &list->commands[i]);
+
+    return rc;
+}
+
+/* Renders the bands one after another on this thread. */
+static int render_bands(
+    struct raster_renderer *renderer,
+    const struct display_list *page,
+    const struct coordinate_space *space,
+    raster_band_fn emit,
+    void *context,
+    struct raster_stats *stats)
+{
+    int rc = 0;
+    const struct raster_plan *plan = &renderer->plan;
+    int height = space->device.height;
+    uint64_t start_ns = timing_now_ns();
+    struct trace_span span;
+
+    for (int b = 0; b < plan->band_count; b++)
+    {
+        int y = b * plan->band_height;
+        struct raster_band band = {
+            .bitmap = &renderer->band,
+            .index = b,
+            .y = y,
+        };
+        uint64_t render_ns = timing_now_ns();
+        uint64_t emit_ns = 0;
+
+        rc = bitmap_resize(
+            &renderer->band,
+            space->device.width,
+            height - y < plan->band_height ? height - y : plan->band_height);
+        if (rc < 0)
+        {
+            log_error("Failed to allocate band");
+            return rc;
+        }
+
+        span = trace_begin("render band");
+        rc = raster_render_band(page, space, plan, b, &renderer->band);
+        trace_end(&span);
+        if (rc < 0)
+            return rc;
+
+        stats->commands += (uint64_t)rc;
+
+        emit_ns = timing_now_ns();
+        band.render_ns = emit_ns - render_ns;
+
+        rc = emit(&band, context);
+        if (rc < 0)
+            return rc;
+
+        if (b == 0)
+            stats->first_band_ns += timing_now_ns() - start_ns;
+
+        stats->bands++;
+        stats->render_ns += band.render_ns;
+        stats->emit_ns += timing_now_ns() - emit_ns;
+
+        if (band.render_ns > stats->slowest_band_ns)
+            stats->slowest_band_ns = band.render_ns;
+    }
+
+    return 0;
+}
+
+int raster_render_page(
+    struct raster_renderer *renderer,
+    const struct display_list *page,
+    const struct coordinate_space *space,
+    raster_band_fn emit,
+    void *context,
+    struct raster_stats *stats)
+{
+    int rc = 0;
+    int height = space->device.height;
+    size_t budget = renderer->band_bytes > 0 ? renderer->band_bytes : RASTER_BAND_BYTES;
+    size_t stride = (((size_t)space->device.width + 31) / 32) * 4;
+    int band_height = stride > 0 && budget / stride < (size_t)height ? (int)(budget / stride) : height;
+    uint64_t start_ns = timing_now_ns();
+    struct raster_stats page_stats = {0};
+    size_t bytes = 0;
+    struct trace_span span = trace_begin("raster page");
+
+    if (band_height < 1)
+        band_height = 1;
+
+    if (renderer->threads != 0 && renderer->threads != 1 && renderer->pool == NULL)
+    {
+        renderer->pool = band_pool_create(renderer->threads, 0);
+        if (renderer->pool == NULL)
+            return -ENOMEM;
+    }
+
+    rc = raster_plan_page(&renderer->plan, page, space, band_height);
+    if (rc < 0)
+        return rc;
+
+    page_stats.plan_ns = timing_now_ns() - start_ns;
+
+    if (renderer->pool != NULL)
+        rc = band_pool_render(renderer->pool, page, space, &renderer->plan, emit, context, &page_stats);
+    else
+        rc = render_bands(renderer, page, space, emit, context, &page_stats);
+
+    if (rc < 0)
+        return rc;
+
+    page_stats.page_ns = timing_now_ns() - start_ns;
+    trace_end(&span);
+
+    if (stats == NULL)
+        return 0;
+
+    bytes = raster_plan_bytes(&renderer->plan);
+    bytes += renderer->pool != NULL ? band_pool_bytes(renderer->pool) : renderer->band.capacity;
+
+    stats->pages++;
+    stats->bands += page_stats.bands;
+    stats->commands += page_stats.commands;
+    stats->plan_ns += page_stats.plan_ns;
+    stats->render_ns += page_stats.render_ns;
+    stats->emit_ns += page_stats.emit_ns;
+    stats->first_band_ns += page_stats.first_band_ns;
+    stats->page_ns += page_stats.page_ns;
+
+    if (page_stats.slowest_band_ns > stats->slowest_band_ns)
+        stats->slowest_band_ns = page_stats.slowest_band_ns;
+
+    if (bytes > stats->peak_bytes)
+        stats->peak_bytes = bytes;
+
+    return 0;
+}
+
+void raster_renderer_free(struct raster_renderer *renderer)
+{
+    band_pool_destroy(renderer->pool);
+    renderer->pool = NULL;
+
+    raster_plan_free(&renderer->plan);
+    bitmap_free(&renderer->band);
+}
+
+void print_raster_stats(const struct raster_stats *stats)
+{
+    if (stats->pages == 0)
+        return;
+
+    printf("Rastered %llu pages in %llu bands, %.1f commands per band\n",
+           (unsigned long long)stats->pages,
+           (unsigned long long)stats->bands,
+           stats->bands > 0 ? (double)stats->commands / (double)stats->bands : 0.0);
+
+    printf("  Plan %.3f ms, render %.3f ms, output %.3f ms per page\n",
+           timing_ns_to_s(stats->plan_ns) * 1e3 / (double)stats->pages,
+           timing_ns_to_s(stats->render_ns) * 1e3 / (double)stats->pages,
+           timing_ns_to_s(stats->emit_ns) * 1e3 / (double)stats->pages);
+
+    printf("  First band out after %.3f ms, page done after %.3f ms\n",
+           timing_ns_to_s(stats->first_band_ns) * 1e3 / (double)stats->pages,
+           timing_ns_to_s(stats->page_ns) * 1e3 / (double)stats->pages);
+
+    printf("  Band render %.3f ms mean, %.3f ms slowest\n",
+           stats->bands > 0 ? timing_ns_to_s(stats->render_ns) * 1e3 / (double)stats->bands : 0.0,
+           timing_ns_to_s(stats->slowest_band_ns) * 1e3);
+
+    printf("  Peak memory %llu octets\n", (unsigned long long)stats->peak_bytes);
+
+    if (stats->compression.raw_bytes > 0)
+    {
+        const struct scanline_stats *compression = &stats->compression;
+
+        printf("  Compressed %llu octets of rows to %llu, %.1f to 1\n",
+               (unsigned long long)compression->raw_bytes,
+               (unsigned long long)compression->encoded_bytes,
+               compression->encoded_bytes > 0
+                   ? (double)compression->raw_bytes / (double)compression->encoded_bytes
+                   : 0.0);
+
+        for (int i = 0; i < SCANLINE_METHODS; i++)
+        {
+            if (compression->rows[i] > 0)
+                printf("    %llu rows %s\n",
+                       (unsigned long long)compression->rows[i],
+                       scanline_method_name((enum scanline_method)i));
+        }
+    }
+}
@@ -0,0 +1,126 @@
+#ifndef RASTER_H
+#define RASTER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "bitmap.h"
+#include "display_list.h"
+#include "print_backend.h"
+
+/* A scanline rasteriser that renders display lists into 1bpp bitmaps at
+ * the printer's resolution, so label pages can be printed as raster
+ * without going through the driver, and on any platform.
+ *
+ * Pages are rendered in horizontal bands into one reused band buffer, and
+ * each band is handed on as soon as it's done. The band is sized to a
+ * memory budget rather than a number of rows, so a page takes the same
+ * memory whatever its size: an A4 page at 600 DPI is 4.4 MB at 1bpp, or
+ * 100 MB at 24bpp, against 256 KB of band at the default budget. Before
+ * rendering, the page's commands are sorted into the bands they touch, so
+ * each band only walks its own commands.
+ *
+ * Rendering follows what GDI does with the backend's defaults: outlines
+ * and lines are one device pixel wide and lines leave out their last
+ * pixel, rectangles are filled white inside, bitmaps replace what's under
+ * them and polygons fill even-odd. Text uses a built-in 5x7 font scaled to
+ * the requested height. */
+
+#define RASTER_BAND_BYTES (256 * 1024)
+
+/* The commands of a page sorted by the bands they touch. Kept between
+ * pages, it only grows. */
+struct raster_plan
+{
+    int band_height;
+    int band_count;
+
+    /* Band b renders commands[starts[b]] up to commands[starts[b + 1]],
+     * in page order. */
+    size_t *starts;
+    uint32_t *commands;
+    int *extents;
+
+    size_t start_capacity;
+    size_t command_capacity;
+    size_t extent_capacity;
+};
+
+struct raster_band
+{
+    const struct bitmap *bitmap;
+    int index;
+
+    /* The device row the band starts at. */
+    int y;
+
+    uint64_t render_ns;
+};
+
+/* Called with each band of the page in turn, top first. */
+typedef int (*raster_band_fn)(const struct raster_band *band, void *context);
+
+/* Sorts the commands of a page into bands of band_height device rows. */
+int raster_plan_page(
+    struct raster_plan *plan,
+    const struct display_list *page,
+    const struct coordinate_space *space,
+    int band_height);
+
+size_t raster_plan_bytes(const struct raster_plan *plan);
+
+void raster_plan_free(struct raster_plan *plan);
+
+/* Renders one band of a planned page. The bitmap must already be sized
+ * for the band and white, as bitmap_resize() leaves it. Returns how many
+ * commands it rendered. */
+int raster_render_band(
+    const struct display_list *page,
+    const struct coordinate_space *space,
+    const struct raster_plan *plan,
+    int index,
+    struct bitmap *band);
+
+/* Renders every command of a list into band, whose top row is device row
+ * y, without planning it first. For lists of a few commands. */
+int raster_render_list(
+    const struct display_list *list,
+    const struct coordinate_space *space,
+    int y,
+    struct bitmap *band);
+
+struct band_pool;
+
+/* The state kept between the pages of a session. Starts zeroed. */
+struct raster_renderer
+{
+    /* 0 for RASTER_BAND_BYTES. A band is never less than one row. */
+    size_t band_bytes;
+
+    /* 0 or 1 renders on the calling thread, < 0 on one thread per CPU. */
+    int threads;
+
+    struct raster_plan plan;
+    struct bitmap band;
+
+    /* Started with the first page when threads asks for one. */
+    struct band_pool *pool;
+};
+
+/* Renders a whole page band by band, handing each to emit in order, top
+ * first. With more than one thread, each thread keeps a band of its own,
+ * so there are a few times band_bytes of bands in memory. stats, if not
+ * NULL, is added to. */
+int raster_render_page(
+    struct raster_renderer *renderer,
+    const struct display_list *page,
+    const struct coordinate_space *space,
+    raster_band_fn emit,
+    void *context,
+    struct raster_stats *stats);
+
+void raster_renderer_free(struct raster_renderer *renderer);
+
+void print_raster_stats(const struct raster_stats *stats);
+
+#endif /* RASTER_H */
@@ -0,0 +1,358 @@
+#include <errno.h>
+#include <string.h>
+
+#include "scanline.h"
+
+/* Each encoder returns the size it encodes to and only writes it when out
+ * isn't NULL, so the methods can be sized before one is picked. */
+
+static size_t run_length(const unsigned char *row, size_t i, size_t bytes, size_t max)
+{
+    size_t run = 1;
+
+    while (i + run < bytes && run < max && row[i + run] == row[i])
+        run++;
+
+    return run;
+}
+
+static size_t encode_rle(const unsigned char *row, size_t bytes, unsigned char *out)
+{
+    size_t size = 0;
+
+    for (size_t i = 0; i < bytes;)
+    {
+        size_t run = run_length(row, i, bytes, 256);
+
+        if (out != NULL)
+        {
+            out[size] = (unsigned char)(run - 1);
+            out[size + 1] = row[i];
+        }
+
+        size += 2;
+        i += run;
+    }
+
+    return size;
+}
+
+static size_t encode_packbits(const unsigned char *row, size_t bytes, unsigned char *out)
+{
+    size_t size = 0;
+
+    for (size_t i = 0; i < bytes;)
+    {
+        size_t run = run_length(row, i, bytes, 128);
+        size_t start = i;
+
+        if (run >= 2)
+        {
+            if (out != NULL)
+            {
+                out[size] = (unsigned char)(signed char)(1 - (int)run);
+                out[size + 1] = row[i];
+            }
+
+            size += 2;
+            i += run;
+            continue;
+        }
+
+        /* Pairs are cheaper left in a literal than split out of it. */
+        while (i < bytes && i - start < 128 && run_length(row, i, bytes, 3) < 3)
+            i++;
+
+        if (out != NULL)
+        {
+            out[size] = (unsigned char)(i - start - 1);
+            memcpy(out + size + 1, row + start, i - start);
+        }
+
+        size += 1 + i - start;
+    }
+
+    return size;
+}
+
+static unsigned char above(const unsigned char *previous, size_t i)
+{
+    return previous != NULL ? previous[i] : 0;
+}
+
+static size_t encode_delta(
+    const unsigned char *row,
+    const unsigned char *previous,
+    size_t bytes,
+    unsigned char *out)
+{
+    size_t size = 0;
+    size_t last = 0;
+
+    for (size_t i = 0; i < bytes;)
+    {
+        size_t count = 0;
+        size_t offset = 0;
+
+        if (row[i] == above(previous, i))
+        {
+            i++;
+            continue;
+        }
+
+        while (i + count < bytes && count < 8 && row[i + count] != above(previous, i + count))
+            count++;
+
+        offset = i - last;
+
+        if (out != NULL)
+            out[size] = (unsigned char)(((count - 1) << 5) | (offset < 31 ? offset : 31));
+
+        size++;
+
+        if (offset >= 31)
+        {
+            offset -= 31;
+
+            for (;;)
+            {
+                unsigned char part = (unsigned char)(offset < 255 ? offset : 255);
+
+                if (out != NULL)
+                    out[size] = part;
+
+                size++;
+                offset -= part;
+
+                if (part < 255)
+                    break;
+            }
+        }
+
+        if (out != NULL)
+            memcpy(out + size, row + i, count);
+
+        size += count;
+        i += count;
+        last = i;
+    }
+
+    return size;
+}
+
+size_t scanline_encode_method(
+    enum scanline_method method,
+    const unsigned char *row,
+    const unsigned char *previous,
+    size_t bytes,
+    unsigned char *out)
+{
+    switch (method)
+    {
+    case SCANLINE_RLE:
+        return encode_rle(row, bytes, out);
+    case SCANLINE_PACKBITS:
+        return encode_packbits(row, bytes, out);
+    case SCANLINE_DELTA:
+        return encode_delta(row, previous, bytes, out);
+    default:
+        memcpy(out, row, bytes);
+        return bytes;
+    }
+}
+
+size_t scanline_encode(
+    const unsigned char *row,
+    const unsigned char *previous,
+    size_t bytes,
+    unsigned char *out,
+    enum scanline_method *method,
+    struct scanline_stats *stats)
+{
+    enum scanline_method best = SCANLINE_RAW;
+    size_t size = bytes;
+    size_t rle = encode_rle(row, bytes, NULL);
+    size_t packbits = encode_packbits(row, bytes, NULL);
+    size_t delta = encode_delta(row, previous, bytes, NULL);
+
+    if (rle < size)
+    {
+        best = SCANLINE_RLE;
+        size = rle;
+    }
+
+    if (packbits < size)
+    {
+        best = SCANLINE_PACKBITS;
+        size = packbits;
+    }
+
+    if (delta < size)
+    {
+        best = SCANLINE_DELTA;
+        size = delta;
+    }
+
+    scanline_encode_method(best, row, previous, bytes, out);
+
+    if (stats != NULL)
+    {
+        stats->rows[best]++;
+        stats->raw_bytes += bytes;
+        stats->encoded_bytes += size;
+    }
+
+    *method = best;
+
+    return size;
+}
+
+static int decode_rle(const unsigned char *data, size_t size, unsigned char *row, size_t bytes)
+{
+    size_t filled = 0;
+
+    if (size % 2 != 0)
+        return -EINVAL;
+
+    for (size_t i = 0; i < size; i += 2)
+    {
+        size_t run = (size_t)data[i] + 1;
+
+        if (run > bytes - filled)
+            return -EINVAL;
+
+        memset(row + filled, data[i + 1], run);
+        filled += run;
+    }
+
+    return filled == bytes ? 0 : -EINVAL;
+}
+
+static int decode_packbits(const unsigned char *data, size_t size, unsigned char *row, size_t bytes)
+{
+    size_t filled = 0;
+
+    for (size_t i = 0; i < size;)
+    {
+        int header = (signed char)data[i++];
+        size_t count = 0;
+
+        /* -128 is a no-op. */
+        if (header == -128)
+            continue;
+
+        if (header >= 0)
+        {
+            count = (size_t)header + 1;
+            if (count > size - i || count > bytes - filled)
+                return -EINVAL;
+
+            memcpy(row + filled, data + i, count);
+            i += count;
+        }
+        else
+        {
+            count = (size_t)(1 - header);
+            if (i >= size || count > bytes - filled)
+                return -EINVAL;
+
+            memset(row + filled, data[i], count);
+            i++;
+        }
+
+        filled += count;
+    }
+
+    return filled == bytes ? 0 : -EINVAL;
+}
+
+static int decode_delta(
+    const unsigned char *data,
+    size_t size,
+    const unsigned char *previous,
+    unsigned char *row,
+    size_t bytes)
+{
+    size_t at = 0;
+
+    if (previous != NULL)
+        memcpy(row, previous, bytes);
+    else
+        memset(row, 0, bytes);
+
+    for (size_t i = 0; i < size;)
+    {
+        size_t count = (size_t)(data[i] >> 5) + 1;
+        size_t offset = data[i] & 31;
+
+        i++;
+
+        if (offset == 31)
+        {
+            for (;;)
+            {
+                if (i >= size)
+                    return -EINVAL;
+
+                offset += data[i];
+
+                if (data[i++] < 255)
+                    break;
+            }
+        }
+
+        if (offset > bytes - at || count > bytes - at - offset || count > size - i)
+            return -EINVAL;
+
+        at += offset;
+        memcpy(row + at, data + i, count);
+        at += count;
+        i += count;
+    }
+
+    return 0;
+}
+
+int scanline_decode(
+    enum scanline_method method,
+    const unsigned char *data,
+    size_t size,
+    const unsigned char *previous,
+    unsigned char *row,
+    size_t bytes)
+{
+    switch (method)
+    {
+    case SCANLINE_RAW:
+        if (size != bytes)
+            return -EINVAL;
+
+        memcpy(row, data, bytes);
+        return 0;
+    case SCANLINE_RLE:
+        return decode_rle(data, size, row, bytes);
+    case SCANLINE_PACKBITS:
+        return decode_packbits(data, size, row, bytes);
+    case SCANLINE_DELTA:
+        return decode_delta(data, size, previous, row, bytes);
+    }
+
+    return -EINVAL;
+}
+
+const char *scanline_method_name(enum scanline_method method)
+{
+    switch (method)
+    {
+    case SCANLINE_RAW:
+        return "raw";
+    case SCANLINE_RLE:
+        return "run-length";
+    case SCANLINE_PACKBITS:
+        return "PackBits";
+    case SCANLINE_DELTA:
+        return "delta row";
+    }
+
+    return "unknown";
+}
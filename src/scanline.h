@@ -0,0 +1,81 @@
+#ifndef SCANLINE_H
+#define SCANLINE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* Compression for rows of 1bpp raster on their way to a printer. Label
+ * pages are mostly white with a few symbols, and on USB and serial links
+ * the bytes sent are what limits throughput, so each row is sent in
+ * whichever of these is smallest for it. The numbers are the PCL raster
+ * compression modes, which these follow. */
+
+enum scanline_method
+{
+    /* The bytes as they are. */
+    SCANLINE_RAW = 0,
+
+    /* Pairs of a repeat count less one and a byte. */
+    SCANLINE_RLE = 1,
+
+    /* TIFF PackBits: a header n of 0 to 127 is followed by n + 1 literal
+     * bytes, -1 to -127 by one byte repeated 1 - n times. */
+    SCANLINE_PACKBITS = 2,
+
+    /* Only the bytes that differ from the row above: a command byte with
+     * the count less one in its top 3 bits and the offset from the end of
+     * the last change in the bottom 5, then the bytes. An offset of 31
+     * continues in the bytes after it until one isn't 255. A row the same
+     * as the one above is empty. */
+    SCANLINE_DELTA = 3,
+};
+
+#define SCANLINE_METHODS 4
+
+/* The most a row of bytes can encode to, in any method. */
+#define SCANLINE_BOUND(bytes) (2 * (bytes) + 8)
+
+struct scanline_stats
+{
+    /* Indexed by method. */
+    uint64_t rows[SCANLINE_METHODS];
+    uint64_t raw_bytes;
+    uint64_t encoded_bytes;
+};
+
+/* Encodes a row in whichever method is smallest for it, into out, which
+ * has room for SCANLINE_BOUND(bytes). previous is the row above, or NULL
+ * for the first row, which is compared against white. Returns the encoded
+ * size. stats, if not NULL, is added to. */
+size_t scanline_encode(
+    const unsigned char *row,
+    const unsigned char *previous,
+    size_t bytes,
+    unsigned char *out,
+    enum scanline_method *method,
+    struct scanline_stats *stats);
+
+/* Encodes a row in the given method, whether or not it's the smallest,
+ * and returns the encoded size. */
+size_t scanline_encode_method(
+    enum scanline_method method,
+    const unsigned char *row,
+    const unsigned char *previous,
+    size_t bytes,
+    unsigned char *out);
+
+/* Decodes size bytes of a row encoded with method into bytes of row.
+ * previous is as for scanline_encode(). Returns -EINVAL if the data is
+ * malformed or doesn't fill the row exactly, except that delta rows leave
+ * what they don't change as it was in previous. */
+int scanline_decode(
+    enum scanline_method method,
+    const unsigned char *data,
+    size_t size,
+    const unsigned char *previous,
+    unsigned char *row,
+    size_t bytes);
+
+const char *scanline_method_name(enum scanline_method method);
+
+#endif /* SCANLINE_H */
@@ -0,0 +1,475 @@
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "hash.h"
+#include "log.h"
+#include "symbol_cache.h"
+#include "thread.h"
+
+#define INITIAL_BUCKETS 256
+
+struct entry
+{
+    struct entry *next;
+
+    /* Most recently used at the head. */
+    struct entry *newer;
+    struct entry *older;
+
+    uint32_t hash;
+    struct datamatrix_options options;
+    unsigned char *payload;
+    size_t length;
+
+    int size_idx;
+    int rows;
+    int cols;
+    unsigned char *modules;
+
+    /* The last rendering, if any. */
+    int module_width;
+    int module_height;
+    int margin_size;
+    struct bitmap bitmap;
+
+    size_t bytes;
+};
+
+struct symbol_cache
+{
+    struct mutex lock;
+
+    struct entry **buckets;
+    int bucket_count;
+
+    struct entry *newest;
+    struct entry *oldest;
+
+    struct symbol_cache_stats stats;
+};
+
+static uint32_t hash_key(
+    const struct datamatrix_options *options,
+    const unsigned char *data,
+    size_t length)
+{
+    uint32_t hash = hash_fnv1a(data, length, HASH_FNV1A_INIT);
+
+    hash = hash_fnv1a(&options->scheme, sizeof(options->scheme), hash);
+    hash = hash_fnv1a(&options->size_request, sizeof(options->size_request), hash);
+    hash = hash_fnv1a(&options->module_size, sizeof(options->module_size), hash);
+    hash = hash_fnv1a(&options->margin_size, sizeof(options->margin_size), hash);
+    hash = hash_fnv1a(&options->fast_scheme, sizeof(options->fast_scheme), hash);
+
+    return hash;
+}
+
+static int same_key(
+    const struct entry *entry,
+    uint32_t hash,
+    const struct datamatrix_options *options,
+    const unsigned char *data,
+    size_t length)
+{
+    return entry->hash == hash &&
+           entry->length == length &&
+           entry->options.scheme == options->scheme &&
+           entry->options.size_request == options->size_request &&
+           entry->options.module_size == options->module_size &&
+           entry->options.margin_size == options->margin_size &&
+           entry->options.fast_scheme == options->fast_scheme &&
+           memcmp(entry->payload, data, length) == 0;
+}
+
+static struct entry *find(
+    struct symbol_cache *cache,
+    uint32_t hash,
+    const struct datamatrix_options *options,
+    const unsigned char *data,
+    size_t length)
+{
+    struct entry *entry = cache->buckets[hash & (uint32_t)(cache->bucket_count - 1)];
+
+    while (entry != NULL && !same_key(entry, hash, options, data, length))
+        entry = entry->next;
+
+    return entry;
+}
+
+static void unlink_lru(struct symbol_cache *cache, struct entry *entry)
+{
+    if (entry->newer != NULL)
+        entry->newer->older = entry->older;
+    else
+        cache->newest = entry->older;
+
+    if (entry->older != NULL)
+        entry->older->newer = entry->newer;
+    else
+        cache->oldest = entry->newer;
+
+    entry->newer = NULL;
+    entry->older = NULL;
+}
+
+static void push_lru(struct symbol_cache *cache, struct entry *entry)
+{
+    entry->older = cache->newest;
+    entry->newer = NULL;
+
+    if (cache->newest != NULL)
+        cache->newest->newer = entry;
+    else
+        cache->oldest = entry;
+
+    cache->newest = entry;
+}
+
+static void touch(struct symbol_cache *cache, struct entry *entry)
+{
+    if (cache->newest == entry)
+        return;
+
+    unlink_lru(cache, entry);
+    push_lru(cache, entry);
+}
+
+static void free_entry(struct entry *entry)
+{
+    bitmap_free(&entry->bitmap);
+    free(entry);
+}
+
+static void remove_entry(struct symbol_cache *cache, struct entry *entry)
+{
+    struct entry **link = &cache->buckets[entry->hash & (uint32_t)(cache->bucket_count - 1)];
+
+    while (*link != entry)
+        link = &(*link)->next;
+
+    *link = entry->next;
+
+    unlink_lru(cache, entry);
+
+    cache->stats.bytes -= entry->bytes;
+    cache->stats.entries--;
+
+    free_entry(entry);
+}
+
+static void evict(struct symbol_cache *cache)
+{
+    while (cache->stats.bytes > cache->stats.budget && cache->oldest != NULL)
+    {
+        remove_entry(cache, cache->oldest);
+        cache->stats.evictions++;
+    }
+}
+
+static void grow(struct symbol_cache *cache)
+{
+    int count = cache->bucket_count * 2;
+    struct entry **buckets = (struct entry **)calloc(count, sizeof(*buckets));
+
+    /* Carry on with longer chains if there's no memory. */
+    if (buckets == NULL)
+        return;
+
+    for (int i = 0; i < cache->bucket_count; i++)
+    {
+        struct entry *entry = cache->buckets[i];
+
+        while (entry != NULL)
+        {
+            struct entry *next = entry->next;
+            struct entry **bucket = &buckets[entry->hash & (uint32_t)(count - 1)];
+
+            entry->next = *bucket;
+            *bucket = entry;
+            entry = next;
+        }
+    }
+
+    free(cache->buckets);
+    cache->buckets = buckets;
+    cache->bucket_count = count;
+}
+
+struct symbol_cache *symbol_cache_create(size_t budget)
+{
+    struct symbol_cache *cache = NULL;
+
+    cache = (struct symbol_cache *)calloc(1, sizeof(*cache));
+    if (cache == NULL)
+    {
+        log_error("Failed to allocate memory");
+        return NULL;
+    }
+
+    cache->buckets = (struct entry **)calloc(INITIAL_BUCKETS, sizeof(*cache->buckets));
+    if (cache->buckets == NULL)
+    {
+        log_error("Failed to allocate memory");
+        free(cache);
+        return NULL;
+    }
+
+    cache->bucket_count = INITIAL_BUCKETS;
+    cache->stats.budget = budget;
+
+    mutex_init(&cache->lock);
+
+    return cache;
+}
+
+void symbol_cache_destroy(struct symbol_cache *cache)
+{
+    if (cache == NULL)
+        return;
+
+    while (cache->oldest != NULL)
+    {
+        struct entry *entry = cache->oldest;
+
+        unlink_lru(cache, entry);
+        free_entry(entry);
+    }
+
+    mutex_destroy(&cache->lock);
+    free(cache->buckets);
+    free(cache);
+}
+
+int symbol_cache_get(
+    struct symbol_cache *cache,
+    const struct datamatrix_options *options,
+    const unsigned char *data,
+    size_t length,
+    struct datamatrix_symbol *symbol)
+{
+    int rc = 0;
+    uint32_t hash = hash_key(options, data, length);
+    struct entry *entry = NULL;
+
+    mutex_lock(&cache->lock);
+
+    entry = find(cache, hash, options, data, length);
+    if (entry == NULL)
+    {
+        cache->stats.misses++;
+        goto exit;
+    }
+
+    size_t needed = (size_t)entry->rows * (size_t)entry->cols;
+    if (needed > symbol->capacity)
+    {
+        unsigned char *modules = (unsigned char *)realloc(symbol->modules, needed);
+        if (modules == NULL)
+        {
+            rc = -ENOMEM;
+            goto exit;
+        }
+
+        symbol->modules = modules;
+        symbol->capacity = needed;
+    }
+
+    symbol->size_idx = entry->size_idx;
+    symbol->rows = entry->rows;
+    symbol->cols = entry->cols;
+    memcpy(symbol->modules, entry->modules, needed);
+
+    touch(cache, entry);
+    cache->stats.hits++;
+    rc = 1;
+
+exit:
+    mutex_unlock(&cache->lock);
+
+    return rc;
+}
+
+int symbol_cache_put(
+    struct symbol_cache *cache,
+    const struct datamatrix_options *options,
+    const unsigned char *data,
+    size_t length,
+    const struct datamatrix_symbol *symbol)
+{
+    uint32_t hash = hash_key(options, data, length);
+    size_t modules = (size_t)symbol->rows * (size_t)symbol->cols;
+    size_t bytes = sizeof(struct entry) + length + modules;
+    struct entry *entry = NULL;
+
+    /* Don't throw everything else out for something that won't fit. */
+    if (bytes > cache->stats.budget)
+        return 0;
+
+    /* The key, the entry and the modules share one allocation. */
+    entry = (struct entry *)calloc(1, bytes);
+    if (entry == NULL)
+        return -ENOMEM;
+
+    entry->hash = hash;
+    entry->options = *options;
+    entry->payload = (unsigned char *)(entry + 1);
+    entry->length = length;
+    entry->modules = entry->payload + length;
+    entry->size_idx = symbol->size_idx;
+    entry->rows = symbol->rows;
+    entry->cols = symbol->cols;
+    entry->bytes = bytes;
+
+    memcpy(entry->payload, data, length);
+    memcpy(entry->modules, symbol->modules, modules);
+
+    mutex_lock(&cache->lock);
+
+    /* Another thread may have encoded the same payload meanwhile. */
+    if (find(cache, hash, options, data, length) != NULL)
+    {
+        mutex_unlock(&cache->lock);
+        free(entry);
+        return 0;
+    }
+
+    if (cache->stats.entries >= (uint64_t)cache->bucket_count)
+        grow(cache);
+
+    struct entry **bucket = &cache->buckets[hash & (uint32_t)(cache->bucket_count - 1)];
+    entry->next = *bucket;
+    *bucket = entry;
+
+    push_lru(cache, entry);
+
+    cache->stats.entries++;
+    cache->stats.bytes += bytes;
+
+    evict(cache);
+
+    mutex_unlock(&cache->lock);
+
+    return 0;
+}
+
+int symbol_cache_get_bitmap(
+    struct symbol_cache *cache,
+    const struct datamatrix_options *options,
+    const unsigned char *data,
+    size_t length,
+    int module_width,
+    int module_height,
+    int margin_size,
+    struct bitmap *bitmap)
+{
+    int rc = 0;
+    uint32_t hash = hash_key(options, data, length);
+    struct entry *entry = NULL;
+
+    mutex_lock(&cache->lock);
+
+    entry = find(cache, hash, options, data, length);
+    if (entry == NULL ||
+        entry->bitmap.bits == NULL ||
+        entry->module_width != module_width ||
+        entry->module_height != module_height ||
+        entry->margin_size != margin_size)
+    {
+        cache->stats.bitmap_misses++;
+        goto exit;
+    }
+
+    rc = bitmap_resize(bitmap, entry->bitmap.width, entry->bitmap.height);
+    if (rc < 0)
+        goto exit;
+
+    memcpy(bitmap->bits, entry->bitmap.bits, bitmap->stride * (size_t)bitmap->height);
+
+    touch(cache, entry);
+    cache->stats.bitmap_hits++;
+    rc = 1;
+
+exit:
+    mutex_unlock(&cache->lock);
+
+    return rc;
+}
+
+int symbol_cache_put_bitmap(
+    struct symbol_cache *cache,
+    const struct datamatrix_options *options,
+    const unsigned char *data,
+    size_t length,
+    int module_width,
+    int module_height,
+    int margin_size,
+    const struct bitmap *bitmap)
+{
+    int rc = 0;
+    uint32_t hash = hash_key(options, data, length);
+    struct entry *entry = NULL;
+    size_t size = bitmap->stride * (size_t)bitmap->height;
+
+    mutex_lock(&cache->lock);
+
+    /* Only symbols that are already cached get their bitmaps cached. */
+    entry = find(cache, hash, options, data, length);
+    if (entry == NULL || entry->bytes + size > cache->stats.budget)
+        goto exit;
+
+    cache->stats.bytes -= entry->bitmap.capacity;
+    entry->bytes -= entry->bitmap.capacity;
+
+    rc = bitmap_resize(&entry->bitmap, bitmap->width, bitmap->height);
+    if (rc < 0)
+    {
+        bitmap_free(&entry->bitmap);
+        goto exit;
+    }
+
+    memcpy(entry->bitmap.bits, bitmap->bits, size);
+
+    entry->module_width = module_width;
+    entry->module_height = module_height;
+    entry->margin_size = margin_size;
+
+    cache->stats.bytes += entry->bitmap.capacity;
+    entry->bytes += entry->bitmap.capacity;
+
+    touch(cache, entry);
+    evict(cache);
+
+exit:
+    mutex_unlock(&cache->lock);
+
+    return rc;
+}
+
+void symbol_cache_get_stats(struct symbol_cache *cache, struct symbol_cache_stats *stats)
+{
+    mutex_lock(&cache->lock);
+    *stats = cache->stats;
+    mutex_unlock(&cache->lock);
+}
+
+void print_symbol_cache_stats(const struct symbol_cache_stats *stats)
+{
+    uint64_t lookups = stats->hits + stats->misses;
+
+    printf("Symbol cache: %llu hits, %llu misses (%.1f%%), %llu evictions\n",
+           (unsigned long long)stats->hits,
+           (unsigned long long)stats->misses,
+           lookups > 0 ? 100.0 * (double)stats->hits / (double)lookups : 0.0,
+           (unsigned long long)stats->evictions);
+
+    printf("  Bitmaps: %llu hits, %llu misses\n",
+           (unsigned long long)stats->bitmap_hits,
+           (unsigned long long)stats->bitmap_misses);
+
+    printf("  Holding %llu symbols in %llu of %llu octets\n",
+           (unsigned long long)stats->entries,
+           (unsigned long long)stats->bytes,
+           (unsigned long long)stats->budget);
+}
@@ -0,0 +1,78 @@
+#ifndef SYMBOL_CACHE_H
+#define SYMBOL_CACHE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "bitmap.h"
+#include "datamatrix.h"
+
+/* An LRU cache of encoded symbols, so payloads that keep coming back - lot
+ * codes, SKU headers, fixed URLs - skip encoding altogether. Entries are
+ * keyed by the payload bytes and the encode options, and can also hold
+ * the symbol rendered as a bitmap. The least recently used entries are
+ * dropped once the cache holds more than its byte budget.
+ *
+ * Thread safe. Lookups copy out, so an entry can be evicted while the
+ * caller is still using what it got. */
+
+struct symbol_cache;
+
+struct symbol_cache_stats
+{
+    uint64_t hits;
+    uint64_t misses;
+    uint64_t bitmap_hits;
+    uint64_t bitmap_misses;
+    uint64_t evictions;
+    uint64_t entries;
+    size_t bytes;
+    size_t budget;
+};
+
+struct symbol_cache *symbol_cache_create(size_t budget);
+
+void symbol_cache_destroy(struct symbol_cache *cache);
+
+/* Returns 1 and fills symbol if the payload is cached, 0 if not. */
+int symbol_cache_get(
+    struct symbol_cache *cache,
+    const struct datamatrix_options *options,
+    const unsigned char *data,
+    size_t length,
+    struct datamatrix_symbol *symbol);
+
+int symbol_cache_put(
+    struct symbol_cache *cache,
+    const struct datamatrix_options *options,
+    const unsigned char *data,
+    size_t length,
+    const struct datamatrix_symbol *symbol);
+
+/* The same for the symbol rendered with the given module size and margin
+ * in pixels. Each entry keeps the last rendering it was given. */
+int symbol_cache_get_bitmap(
+    struct symbol_cache *cache,
+    const struct datamatrix_options *options,
+    const unsigned char *data,
+    size_t length,
+    int module_width,
+    int module_height,
+    int margin_size,
+    struct bitmap *bitmap);
+
+int symbol_cache_put_bitmap(
+    struct symbol_cache *cache,
+    const struct datamatrix_options *options,
+    const unsigned char *data,
+    size_t length,
+    int module_width,
+    int module_height,
+    int margin_size,
+    const struct bitmap *bitmap);
+
+void symbol_cache_get_stats(struct symbol_cache *cache, struct symbol_cache_stats *stats);
+
+void print_symbol_cache_stats(const struct symbol_cache_stats *stats);
+
+#endif /* SYMBOL_CACHE_H */
@@ -0,0 +1,73 @@
+#include <stddef.h>
+#include <string.h>
+
+#include "symbol_layout.h"
+
+/* The finder and timing bars, with every data module light. Each data
+ * region has a solid bar along its left and bottom edges and an
+ * alternating one along its top and right. */
+static void draw_frame(const struct symbol_layout *layout, unsigned char *modules)
+{
+    int band_rows = layout->region_rows + 2;
+    int band_cols = layout->region_cols + 2;
+
+    for (int row = 0; row < layout->rows; row++)
+    {
+        unsigned char *out = modules + (size_t)row * layout->cols;
+
+        /* Counted from the bottom, as the alternating bars are. */
+        int symbol_row = layout->rows - row - 1;
+
+        if (symbol_row % band_rows == 0)
+        {
+            memset(out, 1, (size_t)layout->cols);
+            continue;
+        }
+
+        if (row % band_rows == 0)
+        {
+            /* Solid where it crosses a left bar, otherwise dark on even
+             * columns. */
+            for (int col = 0; col < layout->cols; col++)
+                out[col] = (col % band_cols == 0 || (col & 1) == 0) ? 1 : 0;
+
+            continue;
+        }
+
+        memset(out, 0, (size_t)layout->cols);
+
+        for (int col = 0; col < layout->cols; col += band_cols)
+        {
+            out[col] = 1;
+            out[col + band_cols - 1] = (symbol_row & 1) ? 0 : 1;
+        }
+    }
+}
+
+void symbol_layout_draw(
+    const struct symbol_layout *layout,
+    const unsigned char *codewords,
+    unsigned char *modules)
+{
+    const uint16_t *bits = layout->bits;
+    int words = layout->data_words + layout->error_words;
+
+    draw_frame(layout, modules);
+
+    for (int k = 0; k < words; k++, bits += 8)
+    {
+        unsigned int word = codewords[k];
+
+        modules[bits[0]] = (word >> 7) & 1;
+        modules[bits[1]] = (word >> 6) & 1;
+        modules[bits[2]] = (word >> 5) & 1;
+        modules[bits[3]] = (word >> 4) & 1;
+        modules[bits[4]] = (word >> 3) & 1;
+        modules[bits[5]] = (word >> 2) & 1;
+        modules[bits[6]] = (word >> 1) & 1;
+        modules[bits[7]] = word & 1;
+    }
+
+    for (int i = 0; i < layout->corner_count; i++)
+        modules[layout->corner[i]] = 1;
+}
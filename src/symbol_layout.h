@@ -0,0 +1,48 @@
+#ifndef SYMBOL_LAYOUT_H
+#define SYMBOL_LAYOUT_H
+
+#include <stdint.h>
+
+/* Where every module of every ECC 200 symbol size goes, worked out ahead
+ * of time (gen_symbol_layout.c) rather than asked of libdmtx module by
+ * module. Laying out a symbol is then a walk down one table: each bit of
+ * each codeword, in order, straight to its module. */
+
+/* Square sizes then rectangles, indexed the same as DmtxSymbolSize. */
+#define SYMBOL_LAYOUT_COUNT 30
+
+struct symbol_layout
+{
+    int rows;
+    int cols;
+
+    /* The data regions, and how many there are across and down. */
+    int region_rows;
+    int region_cols;
+    int horiz_regions;
+    int vert_regions;
+
+    int blocks;
+    int data_words;
+    int error_words;
+
+    /* For bit j of codeword k, most significant first, bits[k * 8 + j] is
+     * the module it goes in, counted along the rows from the top left. */
+    const uint16_t *bits;
+
+    /* Modules the codewords don't fill that are dark, if any. The other
+     * two of that corner's four are light. */
+    int corner_count;
+    uint16_t corner[2];
+};
+
+extern const struct symbol_layout symbol_layouts[SYMBOL_LAYOUT_COUNT];
+
+/* Lays a symbol out one byte a module, non-zero for dark, from its data
+ * and error codewords in the order libdmtx places them. */
+void symbol_layout_draw(
+    const struct symbol_layout *layout,
+    const unsigned char *codewords,
+    unsigned char *modules);
+
+#endif /* SYMBOL_LAYOUT_H */
@@ -0,0 +1,8193 @@
+/* Generated by gen_symbol_layout.c. Don't edit; rebuild the
+ * symbol_layout_tables target instead. */
+
+#include "symbol_layout.h"
+
+static const uint16_t bits_0[64] = {
+    37, 38, 47, 48, 41, 57, 58, 51, 11, 12, 21, 22,
+    23, 31, 32, 33, 73, 74, 83, 84, 85, 13, 14, 15,
+    86, 87, 16, 17, 18, 26, 27, 28, 24, 25, 34, 35,
+    36, 44, 45, 46, 42, 43, 52, 53, 54, 62, 63, 64,
+    68, 61, 78, 71, 72, 88, 81, 82, 55, 56, 65, 66,
+    67, 75, 76, 77,
+};
+
+static const uint16_t bits_1[96] = {
+    21, 22, 33, 34, 49, 45, 46, 61, 13, 14, 25, 26,
+    27, 37, 38, 39, 109, 110, 121, 122, 123, 15, 16, 17,
+    124, 125, 18, 19, 20, 30, 31, 32, 28, 29, 40, 41,
+    42, 52, 53, 54, 50, 51, 62, 63, 64, 74, 75, 76,
+    58, 73, 70, 85, 86, 82, 97, 98, 87, 88, 99, 100,
+    101, 111, 112, 113, 65, 66, 77, 78, 79, 89, 90, 91,
+    43, 44, 55, 56, 57, 67, 68, 69, 80, 81, 92, 93,
+    94, 104, 105, 106, 102, 103, 114, 115, 116, 126, 127, 128,
+};
+
+static const uint16_t bits_2[144] = {
+    109, 110, 123, 124, 57, 137, 138, 71, 15, 16, 29, 30,
+    31, 43, 44, 45, 161, 162, 175, 176, 177, 17, 18, 19,
+    178, 179, 20, 21, 22, 34, 35, 36, 32, 33, 46, 47,
+    48, 60, 61, 62, 58, 59, 72, 73, 74, 86, 87, 88,
+    152, 85, 166, 99, 100, 180, 113, 114, 169, 170, 171, 25,
+    26, 40, 54, 68, 127, 128, 141, 142, 143, 155, 156, 157,
+    101, 102, 115, 116, 117, 129, 130, 131, 75, 76, 89, 90,
+    91, 103, 104, 105, 49, 50, 63, 64, 65, 77, 78, 79,
+    23, 24, 37, 38, 39, 51, 52, 53, 66, 67, 80, 81,
+    82, 94, 95, 96, 92, 93, 106, 107, 108, 120, 121, 122,
+    118, 119, 132, 133, 134, 146, 147, 148, 144, 145, 158, 159,
+    160, 172, 173, 174, 135, 136, 149, 150, 151, 163, 164, 165,
+};
+
+static const uint16_t bits_3[192] = {
+    93, 94, 109, 110, 65, 125, 126, 81, 17, 18, 33, 34,
+    35, 49, 50, 51, 213, 214, 229, 230, 231, 19, 20, 21,
+    232, 233, 22, 23, 24, 38, 39, 40, 36, 37, 52, 53,
+    54, 68, 69, 70, 66, 67, 82, 83, 84, 98, 99, 100,
+    142, 97, 158, 113, 114, 174, 129, 130, 193, 209, 225, 27,
+    28, 29, 30, 46, 145, 146, 161, 162, 163, 177, 178, 179,
+    115, 116, 131, 132, 133, 147, 148, 149, 85, 86, 101, 102,
+    103, 117, 118, 119, 55, 56, 71, 72, 73, 87, 88, 89,
+    25, 26, 41, 42, 43, 57, 58, 59, 44, 45, 60, 61,
+    62, 76, 77, 78, 74, 75, 90, 91, 92, 106, 107, 108,
+    104, 105, 120, 121, 122, 136, 137, 138, 134, 135, 150, 151,
+    152, 166, 167, 168, 164, 165, 180, 181, 182, 196, 197, 198,
+    194, 195, 210, 211, 212, 226, 227, 228, 183, 184, 199, 200,
+    201, 215, 216, 217, 153, 154, 169, 170, 171, 185, 186, 187,
+    123, 124, 139, 140, 141, 155, 156, 157, 172, 173, 188, 189,
+    190, 204, 205, 206, 202, 203, 218, 219, 220, 234, 235, 236,
+};
+
+static const uint16_t bits_4[256] = {
+    69, 70, 87, 88, 73, 105, 106, 91, 19, 20, 37, 38,
+    39, 55, 56, 57, 273, 274, 291, 292, 293, 21, 22, 23,
+    294, 295, 24, 25, 26, 42, 43, 44, 40, 41, 58, 59,
+    60, 76, 77, 78, 74, 75, 92, 93, 94, 110, 111, 112,
+    124, 109, 142, 127, 128, 160, 145, 146, 213, 214, 231, 232,
+    217, 249, 250, 235, 163, 164, 181, 182, 183, 199, 200, 201,
+    129, 130, 147, 148, 149, 165, 166, 167, 95, 96, 113, 114,
+    115, 131, 132, 133, 61, 62, 79, 80, 81, 97, 98, 99,
+    27, 28, 45, 46, 47, 63, 64, 65, 281, 282, 299, 300,
+    301, 29, 30, 31, 302, 303, 32, 33, 34, 50, 51, 52,
+    48, 49, 66, 67, 68, 84, 85, 86, 82, 83, 100, 101,
+    102, 118, 119, 120, 116, 117, 134, 135, 136, 152, 153, 154,
+    150, 151, 168, 169, 170, 186, 187, 188, 184, 185, 202, 203,
+    204, 220, 221, 222, 218, 219, 236, 237, 238, 254, 255, 256,
+    268, 253, 286, 271, 272, 304, 289, 290, 239, 240, 257, 258,
+    259, 275, 276, 277, 205, 206, 223, 224, 225, 241, 242, 243,
+    171, 172, 189, 190, 191, 207, 208, 209, 137, 138, 155, 156,
+    157, 173, 174, 175, 103, 104, 121, 122, 123, 139, 140, 141,
+    158, 159, 176, 177, 178, 194, 195, 196, 192, 193, 210, 211,
+    212, 228, 229, 230, 226, 227, 244, 245, 246, 262, 263, 264,
+    260, 261, 278, 279, 280, 296, 297, 298, 247, 248, 265, 266,
+    267, 283, 284, 285,
+};
+
+static const uint16_t bits_5[320] = {
+    37, 38, 57, 58, 81, 77, 78, 101, 21, 22, 41, 42,
+    43, 61, 62, 63, 341, 342, 361, 362, 363, 23, 24, 25,
+    364, 365, 26, 27, 28, 46, 47, 48, 44, 45, 64, 65,
+    66, 84, 85, 86, 82, 83, 102, 103, 104, 122, 123, 124,
+    98, 121, 118, 141, 142, 138, 161, 162, 197, 198, 217, 218,
+    241, 237, 238, 261, 181, 182, 201, 202, 203, 221, 222, 223,
+    143, 144, 163, 164, 165, 183, 184, 185, 105, 106, 125, 126,
+    127, 145, 146, 147, 67, 68, 87, 88, 89, 107, 108, 109,
+    29, 30, 49, 50, 51, 69, 70, 71, 349, 350, 369, 370,
+    371, 31, 32, 33, 372, 373, 34, 35, 36, 54, 55, 56,
+    52, 53, 72, 73, 74, 92, 93, 94, 90, 91, 110, 111,
+    112, 130, 131, 132, 128, 129, 148, 149, 150, 168, 169, 170,
+    166, 167, 186, 187, 188, 206, 207, 208, 204, 205, 224, 225,
+    226, 244, 245, 246, 242, 243, 262, 263, 264, 282, 283, 284,
+    258, 281, 278, 301, 302, 298, 321, 322, 303, 304, 323, 324,
+    325, 343, 344, 345, 265, 266, 285, 286, 287, 305, 306, 307,
+    227, 228, 247, 248, 249, 267, 268, 269, 189, 190, 209, 210,
+    211, 229, 230, 231, 151, 152, 171, 172, 173, 191, 192, 193,
+    113, 114, 133, 134, 135, 153, 154, 155, 75, 76, 95, 96,
+    97, 115, 116, 117, 136, 137, 156, 157, 158, 176, 177, 178,
+    174, 175, 194, 195, 196, 214, 215, 216, 212, 213, 232, 233,
+    234, 252, 253, 254, 250, 251, 270, 271, 272, 290, 291, 292,
+    288, 289, 308, 309, 310, 328, 329, 330, 326, 327, 346, 347,
+    348, 366, 367, 368, 311, 312, 331, 332, 333, 351, 352, 353,
+    273, 274, 293, 294, 295, 313, 314, 315, 235, 236, 255, 256,
+    257, 275, 276, 277, 296, 297, 316, 317, 318, 336, 337, 338,
+    334, 335, 354, 355, 356, 374, 375, 376,
+};
+
+static const uint16_t bits_6[400] = {
+    173, 174, 195, 196, 89, 217, 218, 111, 23, 24, 45, 46,
+    47, 67, 68, 69, 425, 426, 447, 448, 449, 25, 26, 27,
+    450, 451, 28, 29, 30, 50, 51, 52, 48, 49, 70, 71,
+    72, 92, 93, 94, 90, 91, 112, 113, 114, 134, 135, 136,
+    240, 133, 262, 155, 156, 284, 177, 178, 349, 350, 371, 372,
+    265, 393, 394, 287, 199, 200, 221, 222, 223, 243, 244, 245,
+    157, 158, 179, 180, 181, 201, 202, 203, 115, 116, 137, 138,
+    139, 159, 160, 161, 73, 74, 95, 96, 97, 117, 118, 119,
+    31, 32, 53, 54, 55, 75, 76, 77, 433, 434, 455, 456,
+    457, 33, 34, 35, 458, 459, 36, 37, 38, 58, 59, 60,
+    56, 57, 78, 79, 80, 100, 101, 102, 98, 99, 120, 121,
+    122, 142, 143, 144, 140, 141, 162, 163, 164, 184, 185, 186,
+    182, 183, 204, 205, 206, 226, 227, 228, 224, 225, 246, 247,
+    248, 268, 269, 270, 266, 267, 288, 289, 290, 310, 311, 312,
+    416, 309, 438, 331, 332, 460, 353, 354, 441, 442, 443, 41,
+    42, 64, 86, 108, 375, 376, 397, 398, 399, 419, 420, 421,
+    333, 334, 355, 356, 357, 377, 378, 379, 291, 292, 313, 314,
+    315, 335, 336, 337, 249, 250, 271, 272, 273, 293, 294, 295,
+    207, 208, 229, 230, 231, 251, 252, 253, 165, 166, 187, 188,
+    189, 209, 210, 211, 123, 124, 145, 146, 147, 167, 168, 169,
+    81, 82, 103, 104, 105, 125, 126, 127, 39, 40, 61, 62,
+    63, 83, 84, 85, 106, 107, 128, 129, 130, 150, 151, 152,
+    148, 149, 170, 171, 172, 192, 193, 194, 190, 191, 212, 213,
+    214, 234, 235, 236, 232, 233, 254, 255, 256, 276, 277, 278,
+    274, 275, 296, 297, 298, 318, 319, 320, 316, 317, 338, 339,
+    340, 360, 361, 362, 358, 359, 380, 381, 382, 402, 403, 404,
+    400, 401, 422, 423, 424, 444, 445, 446, 383, 384, 405, 406,
+    407, 427, 428, 429, 341, 342, 363, 364, 365, 385, 386, 387,
+    299, 300, 321, 322, 323, 343, 344, 345, 257, 258, 279, 280,
+    281, 301, 302, 303, 215, 216, 237, 238, 239, 259, 260, 261,
+    282, 283, 304, 305, 306, 326, 327, 328, 324, 325, 346, 347,
+    348, 368, 369, 370, 366, 367, 388, 389, 390, 410, 411, 412,
+    408, 409, 430, 431, 432, 452, 453, 454, 391, 392, 413, 414,
+    415, 435, 436, 437,
+};
+
+static const uint16_t bits_7[480] = {
+    141, 142, 165, 166, 97, 189, 190, 121, 25, 26, 49, 50,
+    51, 73, 74, 75, 509, 510, 533, 534, 535, 27, 28, 29,
+    536, 537, 30, 31, 32, 54, 55, 56, 52, 53, 76, 77,
+    78, 100, 101, 102, 98, 99, 122, 123, 124, 146, 147, 148,
+    214, 145, 238, 169, 170, 262, 193, 194, 333, 334, 357, 358,
+    289, 381, 382, 313, 217, 218, 241, 242, 243, 265, 266, 267,
+    171, 172, 195, 196, 197, 219, 220, 221, 125, 126, 149, 150,
+    151, 173, 174, 175, 79, 80, 103, 104, 105, 127, 128, 129,
+    33, 34, 57, 58, 59, 81, 82, 83, 517, 518, 541, 542,
+    543, 35, 36, 37, 544, 545, 38, 39, 40, 62, 63, 64,
+    60, 61, 84, 85, 86, 108, 109, 110, 106, 107, 130, 131,
+    132, 154, 155, 156, 152, 153, 176, 177, 178, 200, 201, 202,
+    198, 199, 222, 223, 224, 246, 247, 248, 244, 245, 268, 269,
+    270, 292, 293, 294, 290, 291, 314, 315, 316, 338, 339, 340,
+    406, 337, 430, 361, 362, 454, 385, 386, 481, 505, 529, 43,
+    44, 45, 46, 70, 409, 410, 433, 434, 435, 457, 458, 459,
+    363, 364, 387, 388, 389, 411, 412, 413, 317, 318, 341, 342,
+    343, 365, 366, 367, 271, 272, 295, 296, 297, 319, 320, 321,
+    225, 226, 249, 250, 251, 273, 274, 275, 179, 180, 203, 204,
+    205, 227, 228, 229, 133, 134, 157, 158, 159, 181, 182, 183,
+    87, 88, 111, 112, 113, 135, 136, 137, 41, 42, 65, 66,
+    67, 89, 90, 91, 68, 69, 92, 93, 94, 116, 117, 118,
+    114, 115, 138, 139, 140, 162, 163, 164, 160, 161, 184, 185,
+    186, 208, 209, 210, 206, 207, 230, 231, 232, 254, 255, 256,
+    252, 253, 276, 277, 278, 300, 301, 302, 298, 299, 322, 323,
+    324, 346, 347, 348, 344, 345, 368, 369, 370, 392, 393, 394,
+    390, 391, 414, 415, 416, 438, 439, 440, 436, 437, 460, 461,
+    462, 484, 485, 486, 482, 483, 506, 507, 508, 530, 531, 532,
+    463, 464, 487, 488, 489, 511, 512, 513, 417, 418, 441, 442,
+    443, 465, 466, 467, 371, 372, 395, 396, 397, 419, 420, 421,
+    325, 326, 349, 350, 351, 373, 374, 375, 279, 280, 303, 304,
+    305, 327, 328, 329, 233, 234, 257, 258, 259, 281, 282, 283,
+    187, 188, 211, 212, 213, 235, 236, 237, 260, 261, 284, 285,
+    286, 308, 309, 310, 306, 307, 330, 331, 332, 354, 355, 356,
+    352, 353, 376, 377, 378, 400, 401, 402, 398, 399, 422, 423,
+    424, 446, 447, 448, 444, 445, 468, 469, 470, 492, 493, 494,
+    490, 491, 514, 515, 516, 538, 539, 540, 471, 472, 495, 496,
+    497, 519, 520, 521, 425, 426, 449, 450, 451, 473, 474, 475,
+    379, 380, 403, 404, 405, 427, 428, 429, 452, 453, 476, 477,
+    478, 500, 501, 502, 498, 499, 522, 523, 524, 546, 547, 548,
+};
+
+static const uint16_t bits_8[576] = {
+    101, 102, 127, 128, 105, 153, 154, 131, 27, 28, 53, 54,
+    55, 79, 80, 81, 601, 602, 627, 628, 629, 29, 30, 31,
+    630, 631, 32, 33, 34, 58, 59, 60, 56, 57, 82, 83,
+    84, 108, 109, 110, 106, 107, 132, 133, 134, 158, 159, 160,
+    180, 157, 206, 183, 184, 232, 209, 210, 309, 310, 335, 336,
+    313, 361, 362, 339, 235, 236, 261, 262, 263, 287, 288, 289,
+    185, 186, 211, 212, 213, 237, 238, 239, 135, 136, 161, 162,
+    163, 187, 188, 189, 85, 86, 111, 112, 113, 137, 138, 139,
+    35, 36, 61, 62, 63, 87, 88, 89, 609, 610, 635, 636,
+    637, 37, 38, 39, 638, 639, 40, 41, 42, 66, 67, 68,
+    64, 65, 90, 91, 92, 116, 117, 118, 114, 115, 140, 141,
+    142, 166, 167, 168, 164, 165, 190, 191, 192, 216, 217, 218,
+    214, 215, 240, 241, 242, 266, 267, 268, 264, 265, 290, 291,
+    292, 316, 317, 318, 314, 315, 340, 341, 342, 366, 367, 368,
+    388, 365, 414, 391, 392, 440, 417, 418, 517, 518, 543, 544,
+    521, 569, 570, 547, 443, 444, 469, 470, 471, 495, 496, 497,
+    393, 394, 419, 420, 421, 445, 446, 447, 343, 344, 369, 370,
+    371, 395, 396, 397, 293, 294, 319, 320, 321, 345, 346, 347,
+    243, 244, 269, 270, 271, 295, 296, 297, 193, 194, 219, 220,
+    221, 245, 246, 247, 143, 144, 169, 170, 171, 195, 196, 197,
+    93, 94, 119, 120, 121, 145, 146, 147, 43, 44, 69, 70,
+    71, 95, 96, 97, 617, 618, 643, 644, 645, 45, 46, 47,
+    646, 647, 48, 49, 50, 74, 75, 76, 72, 73, 98, 99,
+    100, 124, 125, 126, 122, 123, 148, 149, 150, 174, 175, 176,
+    172, 173, 198, 199, 200, 224, 225, 226, 222, 223, 248, 249,
+    250, 274, 275, 276, 272, 273, 298, 299, 300, 324, 325, 326,
+    322, 323, 348, 349, 350, 374, 375, 376, 372, 373, 398, 399,
+    400, 424, 425, 426, 422, 423, 448, 449, 450, 474, 475, 476,
+    472, 473, 498, 499, 500, 524, 525, 526, 522, 523, 548, 549,
+    550, 574, 575, 576, 596, 573, 622, 599, 600, 648, 625, 626,
+    551, 552, 577, 578, 579, 603, 604, 605, 501, 502, 527, 528,
+    529, 553, 554, 555, 451, 452, 477, 478, 479, 503, 504, 505,
+    401, 402, 427, 428, 429, 453, 454, 455, 351, 352, 377, 378,
+    379, 403, 404, 405, 301, 302, 327, 328, 329, 353, 354, 355,
+    251, 252, 277, 278, 279, 303, 304, 305, 201, 202, 227, 228,
+    229, 253, 254, 255, 151, 152, 177, 178, 179, 203, 204, 205,
+    230, 231, 256, 257, 258, 282, 283, 284, 280, 281, 306, 307,
+    308, 332, 333, 334, 330, 331, 356, 357, 358, 382, 383, 384,
+    380, 381, 406, 407, 408, 432, 433, 434, 430, 431, 456, 457,
+    458, 482, 483, 484, 480, 481, 506, 507, 508, 532, 533, 534,
+    530, 531, 556, 557, 558, 582, 583, 584, 580, 581, 606, 607,
+    608, 632, 633, 634, 559, 560, 585, 586, 587, 611, 612, 613,
+    509, 510, 535, 536, 537, 561, 562, 563, 459, 460, 485, 486,
+    487, 511, 512, 513, 409, 410, 435, 436, 437, 461, 462, 463,
+    359, 360, 385, 386, 387, 411, 412, 413, 438, 439, 464, 465,
+    466, 490, 491, 492, 488, 489, 514, 515, 516, 540, 541, 542,
+    538, 539, 564, 565, 566, 590, 591, 592, 588, 589, 614, 615,
+    616, 640, 641, 642, 567, 568, 593, 594, 595, 619, 620, 621,
+};
+
+static const uint16_t bits_9[784] = {
+    253, 254, 285, 286, 129, 317, 318, 161, 33, 34, 65, 66,
+    67, 97, 98, 99, 935, 936, 967, 968, 969, 35, 36, 37,
+    970, 971, 38, 39, 40, 70, 71, 72, 68, 69, 100, 101,
+    102, 132, 133, 134, 130, 131, 162, 163, 164, 194, 195, 196,
+    350, 193, 382, 225, 226, 414, 257, 258, 573, 574, 605, 606,
+    385, 637, 638, 417, 289, 290, 321, 322, 323, 353, 354, 355,
+    227, 228, 259, 260, 261, 291, 292, 293, 165, 166, 197, 198,
+    199, 229, 230, 231, 103, 104, 135, 136, 137, 167, 168, 169,
+    41, 42, 73, 74, 75, 105, 106, 107, 945, 946, 977, 978,
+    979, 43, 44, 45, 980, 981, 46, 49, 50, 78, 81, 82,
+    76, 77, 108, 109, 110, 140, 141, 142, 138, 139, 170, 171,
+    172, 202, 203, 204, 200, 201, 232, 233, 234, 264, 265, 266,
+    262, 263, 294, 295, 296, 326, 327, 328, 324, 325, 356, 357,
+    358, 388, 389, 390, 386, 387, 418, 419, 420, 450, 451, 452,
+    670, 449, 702, 545, 546, 734, 577, 578, 829, 830, 861, 862,
+    705, 893, 894, 737, 609, 610, 641, 642, 643, 673, 674, 675,
+    547, 548, 579, 580, 581, 611, 612, 613, 421, 422, 453, 454,
+    455, 549, 550, 551, 359, 360, 391, 392, 393, 423, 424, 425,
+    297, 298, 329, 330, 331, 361, 362, 363, 235, 236, 267, 268,
+    269, 299, 300, 301, 173, 174, 205, 206, 209, 237, 238, 241,
+    113, 114, 145, 146, 147, 177, 178, 179, 51, 52, 83, 84,
+    85, 115, 116, 117, 953, 954, 985, 986, 987, 53, 54, 55,
+    988, 989, 56, 57, 58, 88, 89, 90, 86, 87, 118, 119,
+    120, 150, 151, 152, 148, 149, 180, 181, 182, 212, 213, 214,
+    210, 211, 242, 243, 244, 274, 275, 276, 270, 273, 302, 305,
+    306, 334, 337, 338, 332, 333, 364, 365, 366, 396, 397, 398,
+    394, 395, 426, 427, 428, 458, 459, 460, 456, 457, 552, 553,
+    554, 584, 585, 586, 582, 583, 614, 615, 616, 646, 647, 648,
+    644, 645, 676, 677, 678, 708, 709, 710, 706, 707, 738, 739,
+    740, 770, 771, 772, 926, 769, 958, 801, 802, 990, 833, 834,
+    961, 962, 963, 61, 62, 94, 126, 158, 865, 866, 897, 898,
+    899, 929, 930, 931, 803, 804, 835, 836, 837, 867, 868, 869,
+    741, 742, 773, 774, 775, 805, 806, 807, 679, 680, 711, 712,
+    713, 743, 744, 745, 617, 618, 649, 650, 651, 681, 682, 683,
+    555, 556, 587, 588, 589, 619, 620, 621, 429, 430, 461, 462,
+    465, 557, 558, 561, 369, 370, 401, 402, 403, 433, 434, 435,
+    307, 308, 339, 340, 341, 371, 372, 373, 245, 246, 277, 278,
+    279, 309, 310, 311, 183, 184, 215, 216, 217, 247, 248, 249,
+    121, 122, 153, 154, 155, 185, 186, 187, 59, 60, 91, 92,
+    93, 123, 124, 125, 156, 157, 188, 189, 190, 220, 221, 222,
+    218, 219, 250, 251, 252, 282, 283, 284, 280, 281, 312, 313,
+    314, 344, 345, 346, 342, 343, 374, 375, 376, 406, 407, 408,
+    404, 405, 436, 437, 438, 468, 469, 470, 466, 467, 562, 563,
+    564, 594, 595, 596, 590, 593, 622, 625, 626, 654, 657, 658,
+    652, 653, 684, 685, 686, 716, 717, 718, 714, 715, 746, 747,
+    748, 778, 779, 780, 776, 777, 808, 809, 810, 840, 841, 842,
+    838, 839, 870, 871, 872, 902, 903, 904, 900, 901, 932, 933,
+    934, 964, 965, 966, 873, 874, 905, 906, 907, 937, 938, 939,
+    811, 812, 843, 844, 845, 875, 876, 877, 749, 750, 781, 782,
+    785, 813, 814, 817, 689, 690, 721, 722, 723, 753, 754, 755,
+    627, 628, 659, 660, 661, 691, 692, 693, 565, 566, 597, 598,
+    599, 629, 630, 631, 439, 440, 471, 472, 473, 567, 568, 569,
+    377, 378, 409, 410, 411, 441, 442, 443, 315, 316, 347, 348,
+    349, 379, 380, 381, 412, 413, 444, 445, 446, 476, 477, 478,
+    474, 475, 570, 571, 572, 602, 603, 604, 600, 601, 632, 633,
+    634, 664, 665, 666, 662, 663, 694, 695, 696, 726, 727, 728,
+    724, 725, 756, 757, 758, 788, 789, 790, 786, 787, 818, 819,
+    820, 850, 851, 852, 846, 849, 878, 881, 882, 910, 913, 914,
+    908, 909, 940, 941, 942, 972, 973, 974, 883, 884, 915, 916,
+    917, 947, 948, 949, 821, 822, 853, 854, 855, 885, 886, 887,
+    759, 760, 791, 792, 793, 823, 824, 825, 697, 698, 729, 730,
+    731, 761, 762, 763, 635, 636, 667, 668, 669, 699, 700, 701,
+    732, 733, 764, 765, 766, 796, 797, 798, 794, 795, 826, 827,
+    828, 858, 859, 860, 856, 857, 888, 889, 890, 920, 921, 922,
+    918, 919, 950, 951, 952, 982, 983, 984, 891, 892, 923, 924,
+    925, 955, 956, 957,
+};
+
+static const uint16_t bits_10[1024] = {
+    141, 142, 177, 178, 145, 213, 214, 181, 37, 38, 73, 74,
+    75, 109, 110, 111, 1191, 1192, 1227, 1228, 1229, 39, 40, 41,
+    1230, 1231, 42, 43, 44, 78, 79, 80, 76, 77, 112, 113,
+    114, 148, 149, 150, 146, 147, 182, 183, 184, 218, 219, 220,
+    250, 217, 286, 253, 254, 322, 289, 290, 429, 430, 465, 466,
+    433, 501, 502, 469, 325, 326, 361, 362, 363, 397, 398, 399,
+    255, 256, 291, 292, 293, 327, 328, 329, 185, 186, 221, 222,
+    223, 257, 258, 259, 115, 116, 151, 152, 153, 187, 188, 189,
+    45, 46, 81, 82, 83, 117, 118, 119, 1199, 1200, 1235, 1236,
+    1237, 47, 48, 49, 1238, 1239, 50, 51, 52, 86, 87, 88,
+    84, 85, 120, 121, 122, 156, 157, 158, 154, 155, 190, 191,
+    192, 226, 227, 228, 224, 225, 260, 261, 262, 296, 297, 298,
+    294, 295, 330, 331, 332, 366, 367, 368, 364, 365, 400, 401,
+    402, 436, 437, 438, 434, 435, 470, 471, 472, 506, 507, 508,
+    538, 505, 574, 541, 542, 610, 577, 578, 789, 790, 825, 826,
+    793, 861, 862, 829, 685, 686, 721, 722, 723, 757, 758, 759,
+    543, 544, 579, 580, 581, 687, 688, 689, 473, 474, 509, 510,
+    511, 545, 546, 547, 403, 404, 439, 440, 441, 475, 476, 477,
+    333, 334, 369, 370, 371, 405, 406, 407, 263, 264, 299, 300,
+    301, 335, 336, 337, 193, 194, 229, 230, 231, 265, 266, 267,
+    123, 124, 159, 160, 163, 195, 196, 199, 55, 56, 91, 92,
+    93, 127, 128, 129, 1209, 1210, 1245, 1246, 1247, 57, 58, 59,
+    1248, 1249, 60, 61, 62, 96, 97, 98, 94, 95, 130, 131,
+    132, 166, 167, 168, 164, 165, 200, 201, 202, 236, 237, 238,
+    232, 235, 268, 271, 272, 304, 307, 308, 302, 303, 338, 339,
+    340, 374, 375, 376, 372, 373, 408, 409, 410, 444, 445, 446,
+    442, 443, 478, 479, 480, 514, 515, 516, 512, 513, 548, 549,
+    550, 584, 585, 586, 582, 583, 690, 691, 692, 726, 727, 728,
+    724, 725, 760, 761, 762, 796, 797, 798, 794, 795, 830, 831,
+    832, 866, 867, 868, 898, 865, 934, 901, 902, 970, 937, 938,
+    1077, 1078, 1113, 1114, 1081, 1149, 1150, 1117, 973, 974, 1009, 1010,
+    1011, 1045, 1046, 1047, 903, 904, 939, 940, 941, 975, 976, 977,
+    833, 834, 869, 870, 871, 905, 906, 907, 763, 764, 799, 800,
+    801, 835, 836, 837, 693, 694, 729, 730, 731, 765, 766, 767,
+    551, 552, 587, 588, 589, 695, 696, 697, 481, 482, 517, 518,
+    519, 553, 554, 555, 411, 412, 447, 448, 451, 483, 484, 487,
+    343, 344, 379, 380, 381, 415, 416, 417, 273, 274, 309, 310,
+    311, 345, 346, 347, 203, 204, 239, 240, 241, 275, 276, 277,
+    133, 134, 169, 170, 171, 205, 206, 207, 63, 64, 99, 100,
+    101, 135, 136, 137, 1217, 1218, 1253, 1254, 1255, 65, 66, 67,
+    1256, 1257, 68, 69, 70, 104, 105, 106, 102, 103, 138, 139,
+    140, 174, 175, 176, 172, 173, 208, 209, 210, 244, 245, 246,
+    242, 243, 278, 279, 280, 314, 315, 316, 312, 313, 348, 349,
+    350, 384, 385, 386, 382, 383, 418, 419, 420, 454, 455, 456,
+    452, 453, 488, 489, 490, 524, 525, 526, 520, 523, 556, 559,
+    560, 592, 595, 596, 590, 591, 698, 699, 700, 734, 735, 736,
+    732, 733, 768, 769, 770, 804, 805, 806, 802, 803, 838, 839,
+    840, 874, 875, 876, 872, 873, 908, 909, 910, 944, 945, 946,
+    942, 943, 978, 979, 980, 1014, 1015, 1016, 1012, 1013, 1048, 1049,
+    1050, 1084, 1085, 1086, 1082, 1083, 1118, 1119, 1120, 1154, 1155, 1156,
+    1186, 1153, 1222, 1189, 1190, 1258, 1225, 1226, 1121, 1122, 1157, 1158,
+    1159, 1193, 1194, 1195, 1051, 1052, 1087, 1088, 1089, 1123, 1124, 1125,
+    981, 982, 1017, 1018, 1019, 1053, 1054, 1055, 911, 912, 947, 948,
+    949, 983, 984, 985, 841, 842, 877, 878, 879, 913, 914, 915,
+    771, 772, 807, 808, 811, 843, 844, 847, 703, 704, 739, 740,
+    741, 775, 776, 777, 561, 562, 597, 598, 599, 705, 706, 707,
+    491, 492, 527, 528, 529, 563, 564, 565, 421, 422, 457, 458,
+    459, 493, 494, 495, 351, 352, 387, 388, 389, 423, 424, 425,
+    281, 282, 317, 318, 319, 353, 354, 355, 211, 212, 247, 248,
+    249, 283, 284, 285, 320, 321, 356, 357, 358, 392, 393, 394,
+    390, 391, 426, 427, 428, 462, 463, 464, 460, 461, 496, 497,
+    498, 532, 533, 534, 530, 531, 566, 567, 568, 602, 603, 604,
+    600, 601, 708, 709, 710, 744, 745, 746, 742, 743, 778, 779,
+    780, 814, 815, 816, 812, 813, 848, 849, 850, 884, 885, 886,
+    880, 883, 916, 919, 920, 952, 955, 956, 950, 951, 986, 987,
+    988, 1022, 1023, 1024, 1020, 1021, 1056, 1057, 1058, 1092, 1093, 1094,
+    1090, 1091, 1126, 1127, 1128, 1162, 1163, 1164, 1160, 1161, 1196, 1197,
+    1198, 1232, 1233, 1234, 1129, 1130, 1165, 1166, 1167, 1201, 1202, 1203,
+    1059, 1060, 1095, 1096, 1099, 1131, 1132, 1135, 991, 992, 1027, 1028,
+    1029, 1063, 1064, 1065, 921, 922, 957, 958, 959, 993, 994, 995,
+    851, 852, 887, 888, 889, 923, 924, 925, 781, 782, 817, 818,
+    819, 853, 854, 855, 711, 712, 747, 748, 749, 783, 784, 785,
+    569, 570, 605, 606, 607, 713, 714, 715, 499, 500, 535, 536,
+    537, 571, 572, 573, 608, 609, 716, 717, 718, 752, 753, 754,
+    750, 751, 786, 787, 788, 822, 823, 824, 820, 821, 856, 857,
+    858, 892, 893, 894, 890, 891, 926, 927, 928, 962, 963, 964,
+    960, 961, 996, 997, 998, 1032, 1033, 1034, 1030, 1031, 1066, 1067,
+    1068, 1102, 1103, 1104, 1100, 1101, 1136, 1137, 1138, 1172, 1173, 1174,
+    1168, 1171, 1204, 1207, 1208, 1240, 1243, 1244, 1139, 1140, 1175, 1176,
+    1177, 1211, 1212, 1213, 1069, 1070, 1105, 1106, 1107, 1141, 1142, 1143,
+    999, 1000, 1035, 1036, 1037, 1071, 1072, 1073, 929, 930, 965, 966,
+    967, 1001, 1002, 1003, 859, 860, 895, 896, 897, 931, 932, 933,
+    968, 969, 1004, 1005, 1006, 1040, 1041, 1042, 1038, 1039, 1074, 1075,
+    1076, 1110, 1111, 1112, 1108, 1109, 1144, 1145, 1146, 1180, 1181, 1182,
+    1178, 1179, 1214, 1215, 1216, 1250, 1251, 1252, 1147, 1148, 1183, 1184,
+    1185, 1219, 1220, 1221,
+};
+
+static const uint16_t bits_11[1296] = {
+    317, 318, 357, 358, 161, 397, 398, 201, 41, 42, 81, 82,
+    83, 121, 122, 123, 1487, 1488, 1527, 1528, 1529, 43, 44, 45,
+    1530, 1531, 46, 47, 48, 86, 87, 88, 84, 85, 124, 125,
+    126, 164, 165, 166, 162, 163, 202, 203, 204, 242, 243, 244,
+    438, 241, 478, 281, 282, 518, 321, 322, 637, 638, 677, 678,
+    481, 717, 718, 521, 361, 362, 401, 402, 403, 441, 442, 443,
+    283, 284, 323, 324, 325, 363, 364, 365, 205, 206, 245, 246,
+    247, 285, 286, 287, 127, 128, 167, 168, 169, 207, 208, 209,
+    49, 50, 89, 90, 91, 129, 130, 131, 1495, 1496, 1535, 1536,
+    1537, 51, 52, 53, 1538, 1541, 54, 55, 56, 94, 95, 96,
+    92, 93, 132, 133, 134, 172, 173, 174, 170, 171, 210, 211,
+    212, 250, 251, 252, 248, 249, 288, 289, 290, 328, 329, 330,
+    326, 327, 366, 367, 368, 406, 407, 408, 404, 405, 444, 445,
+    446, 484, 485, 486, 482, 483, 522, 523, 524, 562, 563, 564,
+    758, 561, 878, 601, 602, 918, 641, 642, 1037, 1038, 1077, 1078,
+    881, 1117, 1118, 921, 681, 682, 721, 722, 723, 841, 842, 843,
+    603, 604, 643, 644, 645, 683, 684, 685, 525, 526, 565, 566,
+    567, 605, 606, 607, 447, 448, 487, 488, 489, 527, 528, 529,
+    369, 370, 409, 410, 411, 449, 450, 451, 291, 292, 331, 332,
+    333, 371, 372, 373, 213, 214, 253, 254, 255, 293, 294, 295,
+    135, 136, 175, 176, 177, 215, 216, 217, 57, 58, 97, 98,
+    101, 137, 138, 141, 1505, 1506, 1545, 1546, 1547, 61, 62, 63,
+    1548, 1549, 64, 65, 66, 104, 105, 106, 102, 103, 142, 143,
+    144, 182, 183, 184, 178, 181, 218, 221, 222, 258, 261, 262,
+    256, 257, 296, 297, 298, 336, 337, 338, 334, 335, 374, 375,
+    376, 414, 415, 416, 412, 413, 452, 453, 454, 492, 493, 494,
+    490, 491, 530, 531, 532, 570, 571, 572, 568, 569, 608, 609,
+    610, 648, 649, 650, 646, 647, 686, 687, 688, 726, 727, 728,
+    724, 725, 844, 845, 846, 884, 885, 886, 882, 883, 922, 923,
+    924, 962, 963, 964, 1158, 961, 1198, 1001, 1002, 1238, 1041, 1042,
+    1357, 1358, 1397, 1398, 1201, 1437, 1438, 1241, 1081, 1082, 1121, 1122,
+    1123, 1161, 1162, 1163, 1003, 1004, 1043, 1044, 1045, 1083, 1084, 1085,
+    925, 926, 965, 966, 967, 1005, 1006, 1007, 847, 848, 887, 888,
+    889, 927, 928, 929, 689, 690, 729, 730, 731, 849, 850, 851,
+    611, 612, 651, 652, 653, 691, 692, 693, 533, 534, 573, 574,
+    575, 613, 614, 615, 455, 456, 495, 496, 497, 535, 536, 537,
+    377, 378, 417, 418, 421, 457, 458, 461, 301, 302, 341, 342,
+    343, 381, 382, 383, 223, 224, 263, 264, 265, 303, 304, 305,
+    145, 146, 185, 186, 187, 225, 226, 227, 67, 68, 107, 108,
+    109, 147, 148, 149, 1513, 1514, 1553, 1554, 1555, 69, 70, 71,
+    1556, 1557, 72, 73, 74, 112, 113, 114, 110, 111, 150, 151,
+    152, 190, 191, 192, 188, 189, 228, 229, 230, 268, 269, 270,
+    266, 267, 306, 307, 308, 346, 347, 348, 344, 345, 384, 385,
+    386, 424, 425, 426, 422, 423, 462, 463, 464, 502, 503, 504,
+    498, 501, 538, 541, 542, 578, 581, 582, 576, 577, 616, 617,
+    618, 656, 657, 658, 654, 655, 694, 695, 696, 734, 735, 736,
+    732, 733, 852, 853, 854, 892, 893, 894, 890, 891, 930, 931,
+    932, 970, 971, 972, 968, 969, 1008, 1009, 1010, 1048, 1049, 1050,
+    1046, 1047, 1086, 1087, 1088, 1126, 1127, 1128, 1124, 1125, 1164, 1165,
+    1166, 1204, 1205, 1206, 1202, 1203, 1242, 1243, 1244, 1282, 1283, 1284,
+    1478, 1281, 1518, 1321, 1322, 1558, 1361, 1362, 1521, 1522, 1523, 77,
+    78, 118, 158, 198, 1401, 1402, 1441, 1442, 1443, 1481, 1482, 1483,
+    1323, 1324, 1363, 1364, 1365, 1403, 1404, 1405, 1245, 1246, 1285, 1286,
+    1287, 1325, 1326, 1327, 1167, 1168, 1207, 1208, 1209, 1247, 1248, 1249,
+    1089, 1090, 1129, 1130, 1131, 1169, 1170, 1171, 1011, 1012, 1051, 1052,
+    1053, 1091, 1092, 1093, 933, 934, 973, 974, 975, 1013, 1014, 1015,
+    855, 856, 895, 896, 897, 935, 936, 937, 697, 698, 737, 738,
+    741, 857, 858, 861, 621, 622, 661, 662, 663, 701, 702, 703,
+    543, 544, 583, 584, 585, 623, 624, 625, 465, 466, 505, 506,
+    507, 545, 546, 547, 387, 388, 427, 428, 429, 467, 468, 469,
+    309, 310, 349, 350, 351, 389, 390, 391, 231, 232, 271, 272,
+    273, 311, 312, 313, 153, 154, 193, 194, 195, 233, 234, 235,
+    75, 76, 115, 116, 117, 155, 156, 157, 196, 197, 236, 237,
+    238, 276, 277, 278, 274, 275, 314, 315, 316, 354, 355, 356,
+    352, 353, 392, 393, 394, 432, 433, 434, 430, 431, 470, 471,
+    472, 510, 511, 512, 508, 509, 548, 549, 550, 588, 589, 590,
+    586, 587, 626, 627, 628, 666, 667, 668, 664, 665, 704, 705,
+    706, 744, 745, 746, 742, 743, 862, 863, 864, 902, 903, 904,
+    898, 901, 938, 941, 942, 978, 981, 982, 976, 977, 1016, 1017,
+    1018, 1056, 1057, 1058, 1054, 1055, 1094, 1095, 1096, 1134, 1135, 1136,
+    1132, 1133, 1172, 1173, 1174, 1212, 1213, 1214, 1210, 1211, 1250, 1251,
+    1252, 1290, 1291, 1292, 1288, 1289, 1328, 1329, 1330, 1368, 1369, 1370,
+    1366, 1367, 1406, 1407, 1408, 1446, 1447, 1448, 1444, 1445, 1484, 1485,
+    1486, 1524, 1525, 1526, 1409, 1410, 1449, 1450, 1451, 1489, 1490, 1491,
+    1331, 1332, 1371, 1372, 1373, 1411, 1412, 1413, 1253, 1254, 1293, 1294,
+    1295, 1333, 1334, 1335, 1175, 1176, 1215, 1216, 1217, 1255, 1256, 1257,
+    1097, 1098, 1137, 1138, 1141, 1177, 1178, 1181, 1021, 1022, 1061, 1062,
+    1063, 1101, 1102, 1103, 943, 944, 983, 984, 985, 1023, 1024, 1025,
+    865, 866, 905, 906, 907, 945, 946, 947, 707, 708, 747, 748,
+    749, 867, 868, 869, 629, 630, 669, 670, 671, 709, 710, 711,
+    551, 552, 591, 592, 593, 631, 632, 633, 473, 474, 513, 514,
+    515, 553, 554, 555, 395, 396, 435, 436, 437, 475, 476, 477,
+    516, 517, 556, 557, 558, 596, 597, 598, 594, 595, 634, 635,
+    636, 674, 675, 676, 672, 673, 712, 713, 714, 752, 753, 754,
+    750, 751, 870, 871, 872, 910, 911, 912, 908, 909, 948, 949,
+    950, 988, 989, 990, 986, 987, 1026, 1027, 1028, 1066, 1067, 1068,
+    1064, 1065, 1104, 1105, 1106, 1144, 1145, 1146, 1142, 1143, 1182, 1183,
+    1184, 1222, 1223, 1224, 1218, 1221, 1258, 1261, 1262, 1298, 1301, 1302,
+    1296, 1297, 1336, 1337, 1338, 1376, 1377, 1378, 1374, 1375, 1414, 1415,
+    1416, 1454, 1455, 1456, 1452, 1453, 1492, 1493, 1494, 1532, 1533, 1534,
+    1417, 1418, 1457, 1458, 1461, 1497, 1498, 1501, 1341, 1342, 1381, 1382,
+    1383, 1421, 1422, 1423, 1263, 1264, 1303, 1304, 1305, 1343, 1344, 1345,
+    1185, 1186, 1225, 1226, 1227, 1265, 1266, 1267, 1107, 1108, 1147, 1148,
+    1149, 1187, 1188, 1189, 1029, 1030, 1069, 1070, 1071, 1109, 1110, 1111,
+    951, 952, 991, 992, 993, 1031, 1032, 1033, 873, 874, 913, 914,
+    915, 953, 954, 955, 715, 716, 755, 756, 757, 875, 876, 877,
+    916, 917, 956, 957, 958, 996, 997, 998, 994, 995, 1034, 1035,
+    1036, 1074, 1075, 1076, 1072, 1073, 1112, 1113, 1114, 1152, 1153, 1154,
+    1150, 1151, 1190, 1191, 1192, 1230, 1231, 1232, 1228, 1229, 1268, 1269,
+    1270, 1308, 1309, 1310, 1306, 1307, 1346, 1347, 1348, 1386, 1387, 1388,
+    1384, 1385, 1424, 1425, 1426, 1464, 1465, 1466, 1462, 1463, 1502, 1503,
+    1504, 1542, 1543, 1544, 1427, 1428, 1467, 1468, 1469, 1507, 1508, 1509,
+    1349, 1350, 1389, 1390, 1391, 1429, 1430, 1431, 1271, 1272, 1311, 1312,
+    1313, 1351, 1352, 1353, 1193, 1194, 1233, 1234, 1235, 1273, 1274, 1275,
+    1115, 1116, 1155, 1156, 1157, 1195, 1196, 1197, 1236, 1237, 1276, 1277,
+    1278, 1316, 1317, 1318, 1314, 1315, 1354, 1355, 1356, 1394, 1395, 1396,
+    1392, 1393, 1432, 1433, 1434, 1472, 1473, 1474, 1470, 1471, 1510, 1511,
+    1512, 1550, 1551, 1552, 1435, 1436, 1475, 1476, 1477, 1515, 1516, 1517,
+};
+
+static const uint16_t bits_12[1600] = {
+    173, 174, 217, 218, 177, 261, 262, 221, 45, 46, 89, 90,
+    91, 133, 134, 135, 1807, 1808, 1851, 1852, 1853, 47, 48, 49,
+    1854, 1855, 50, 51, 52, 94, 95, 96, 92, 93, 136, 137,
+    138, 180, 181, 182, 178, 179, 222, 223, 224, 266, 267, 268,
+    306, 265, 350, 309, 310, 394, 353, 354, 525, 526, 569, 570,
+    529, 613, 614, 573, 397, 398, 441, 442, 443, 485, 486, 487,
+    311, 312, 355, 356, 357, 399, 400, 401, 225, 226, 269, 270,
+    271, 313, 314, 315, 139, 140, 183, 184, 185, 227, 228, 229,
+    53, 54, 97, 98, 99, 141, 142, 143, 1815, 1816, 1859, 1860,
+    1861, 55, 56, 57, 1862, 1863, 58, 59, 60, 102, 103, 104,
+    100, 101, 144, 145, 146, 188, 189, 190, 186, 187, 230, 231,
+    232, 274, 275, 276, 272, 273, 316, 317, 318, 360, 361, 362,
+    358, 359, 402, 403, 404, 446, 447, 448, 444, 445, 488, 489,
+    490, 532, 533, 534, 530, 531, 574, 575, 576, 618, 619, 620,
+    658, 617, 702, 661, 662, 746, 705, 706, 877, 878, 921, 922,
+    881, 1053, 1054, 1013, 749, 750, 793, 794, 795, 837, 838, 839,
+    663, 664, 707, 708, 709, 751, 752, 753, 577, 578, 621, 622,
+    623, 665, 666, 667, 491, 492, 535, 536, 537, 579, 580, 581,
+    405, 406, 449, 450, 451, 493, 494, 495, 319, 320, 363, 364,
+    365, 407, 408, 409, 233, 234, 277, 278, 279, 321, 322, 323,
+    147, 148, 191, 192, 193, 235, 236, 237, 61, 62, 105, 106,
+    107, 149, 150, 151, 1823, 1824, 1867, 1868, 1871, 63, 64, 67,
+    1872, 1873, 68, 69, 70, 112, 113, 114, 108, 111, 152, 155,
+    156, 196, 199, 200, 194, 195, 238, 239, 240, 282, 283, 284,
+    280, 281, 324, 325, 326, 368, 369, 370, 366, 367, 410, 411,
+    412, 454, 455, 456, 452, 453, 496, 497, 498, 540, 541, 542,
+    538, 539, 582, 583, 584, 626, 627, 628, 624, 625, 668, 669,
+    670, 712, 713, 714, 710, 711, 754, 755, 756, 798, 799, 800,
+    796, 797, 840, 841, 842, 884, 885, 886, 882, 883, 1014, 1015,
+    1016, 1058, 1059, 1060, 1098, 1057, 1142, 1101, 1102, 1186, 1145, 1146,
+    1317, 1318, 1361, 1362, 1321, 1405, 1406, 1365, 1189, 1190, 1233, 1234,
+    1235, 1277, 1278, 1279, 1103, 1104, 1147, 1148, 1149, 1191, 1192, 1193,
+    1017, 1018, 1061, 1062, 1063, 1105, 1106, 1107, 843, 844, 887, 888,
+    889, 1019, 1020, 1021, 757, 758, 801, 802, 803, 845, 846, 847,
+    671, 672, 715, 716, 717, 759, 760, 761, 585, 586, 629, 630,
+    631, 673, 674, 675, 499, 500, 543, 544, 545, 587, 588, 589,
+    413, 414, 457, 458, 459, 501, 502, 503, 327, 328, 371, 372,
+    375, 415, 416, 419, 243, 244, 287, 288, 289, 331, 332, 333,
+    157, 158, 201, 202, 203, 245, 246, 247, 71, 72, 115, 116,
+    117, 159, 160, 161, 1833, 1834, 1877, 1878, 1879, 73, 74, 75,
+    1880, 1881, 76, 77, 78, 120, 121, 122, 118, 119, 162, 163,
+    164, 206, 207, 208, 204, 205, 248, 249, 250, 292, 293, 294,
+    290, 291, 334, 335, 336, 378, 379, 380, 376, 377, 420, 421,
+    422, 464, 465, 466, 460, 463, 504, 507, 508, 548, 551, 552,
+    546, 547, 590, 591, 592, 634, 635, 636, 632, 633, 676, 677,
+    678, 720, 721, 722, 718, 719, 762, 763, 764, 806, 807, 808,
+    804, 805, 848, 849, 850, 892, 893, 894, 890, 891, 1022, 1023,
+    1024, 1066, 1067, 1068, 1064, 1065, 1108, 1109, 1110, 1152, 1153, 1154,
+    1150, 1151, 1194, 1195, 1196, 1238, 1239, 1240, 1236, 1237, 1280, 1281,
+    1282, 1324, 1325, 1326, 1322, 1323, 1366, 1367, 1368, 1410, 1411, 1412,
+    1450, 1409, 1494, 1453, 1454, 1538, 1497, 1498, 1669, 1670, 1713, 1714,
+    1673, 1757, 1758, 1717, 1541, 1542, 1585, 1586, 1587, 1629, 1630, 1631,
+    1455, 1456, 1499, 1500, 1501, 1543, 1544, 1545, 1369, 1370, 1413, 1414,
+    1415, 1457, 1458, 1459, 1283, 1284, 1327, 1328, 1329, 1371, 1372, 1373,
+    1197, 1198, 1241, 1242, 1243, 1285, 1286, 1287, 1111, 1112, 1155, 1156,
+    1157, 1199, 1200, 1201, 1025, 1026, 1069, 1070, 1071, 1113, 1114, 1115,
+    851, 852, 895, 896, 897, 1027, 1028, 1029, 765, 766, 809, 810,
+    811, 853, 854, 855, 679, 680, 723, 724, 727, 767, 768, 771,
+    595, 596, 639, 640, 641, 683, 684, 685, 509, 510, 553, 554,
+    555, 597, 598, 599, 423, 424, 467, 468, 469, 511, 512, 513,
+    337, 338, 381, 382, 383, 425, 426, 427, 251, 252, 295, 296,
+    297, 339, 340, 341, 165, 166, 209, 210, 211, 253, 254, 255,
+    79, 80, 123, 124, 125, 167, 168, 169, 1841, 1842, 1885, 1886,
+    1887, 81, 82, 83, 1888, 1889, 84, 85, 86, 128, 129, 130,
+    126, 127, 170, 171, 172, 214, 215, 216, 212, 213, 256, 257,
+    258, 300, 301, 302, 298, 299, 342, 343, 344, 386, 387, 388,
+    384, 385, 428, 429, 430, 472, 473, 474, 470, 471, 514, 515,
+    516, 558, 559, 560, 556, 557, 600, 601, 602, 644, 645, 646,
+    642, 643, 686, 687, 688, 730, 731, 732, 728, 729, 772, 773,
+    774, 816, 817, 818, 812, 815, 856, 859, 860, 900, 903, 904,
+    898, 899, 1030, 1031, 1032, 1074, 1075, 1076, 1072, 1073, 1116, 1117,
+    1118, 1160, 1161, 1162, 1158, 1159, 1202, 1203, 1204, 1246, 1247, 1248,
+    1244, 1245, 1288, 1289, 1290, 1332, 1333, 1334, 1330, 1331, 1374, 1375,
+    1376, 1418, 1419, 1420, 1416, 1417, 1460, 1461, 1462, 1504, 1505, 1506,
+    1502, 1503, 1546, 1547, 1548, 1590, 1591, 1592, 1588, 1589, 1632, 1633,
+    1634, 1676, 1677, 1678, 1674, 1675, 1718, 1719, 1720, 1762, 1763, 1764,
+    1802, 1761, 1846, 1805, 1806, 1890, 1849, 1850, 1721, 1722, 1765, 1766,
+    1767, 1809, 1810, 1811, 1635, 1636, 1679, 1680, 1681, 1723, 1724, 1725,
+    1549, 1550, 1593, 1594, 1595, 1637, 1638, 1639, 1463, 1464, 1507, 1508,
+    1509, 1551, 1552, 1553, 1377, 1378, 1421, 1422, 1423, 1465, 1466, 1467,
+    1291, 1292, 1335, 1336, 1337, 1379, 1380, 1381, 1205, 1206, 1249, 1250,
+    1251, 1293, 1294, 1295, 1119, 1120, 1163, 1164, 1167, 1207, 1208, 1211,
+    1035, 1036, 1079, 1080, 1081, 1123, 1124, 1125, 861, 862, 905, 906,
+    907, 1037, 1038, 1039, 775, 776, 819, 820, 821, 863, 864, 865,
+    689, 690, 733, 734, 735, 777, 778, 779, 603, 604, 647, 648,
+    649, 691, 692, 693, 517, 518, 561, 562, 563, 605, 606, 607,
+    431, 432, 475, 476, 477, 519, 520, 521, 345, 346, 389, 390,
+    391, 433, 434, 435, 259, 260, 303, 304, 305, 347, 348, 349,
+    392, 393, 436, 437, 438, 480, 481, 482, 478, 479, 522, 523,
+    524, 566, 567, 568, 564, 565, 608, 609, 610, 652, 653, 654,
+    650, 651, 694, 695, 696, 738, 739, 740, 736, 737, 780, 781,
+    782, 824, 825, 826, 822, 823, 866, 867, 868, 910, 911, 912,
+    908, 909, 1040, 1041, 1042, 1084, 1085, 1086, 1082, 1083, 1126, 1127,
+    1128, 1170, 1171, 1172, 1168, 1169, 1212, 1213, 1214, 1256, 1257, 1258,
+    1252, 1255, 1296, 1299, 1300, 1340, 1343, 1344, 1338, 1339, 1382, 1383,
+    1384, 1426, 1427, 1428, 1424, 1425, 1468, 1469, 1470, 1512, 1513, 1514,
+    1510, 1511, 1554, 1555, 1556, 1598, 1599, 1600, 1596, 1597, 1640, 1641,
+    1642, 1684, 1685, 1686, 1682, 1683, 1726, 1727, 1728, 1770, 1771, 1772,
+    1768, 1769, 1812, 1813, 1814, 1856, 1857, 1858, 1729, 1730, 1773, 1774,
+    1775, 1817, 1818, 1819, 1643, 1644, 1687, 1688, 1689, 1731, 1732, 1733,
+    1557, 1558, 1601, 1602, 1603, 1645, 1646, 1647, 1471, 1472, 1515, 1516,
+    1519, 1559, 1560, 1563, 1387, 1388, 1431, 1432, 1433, 1475, 1476, 1477,
+    1301, 1302, 1345, 1346, 1347, 1389, 1390, 1391, 1215, 1216, 1259, 1260,
+    1261, 1303, 1304, 1305, 1129, 1130, 1173, 1174, 1175, 1217, 1218, 1219,
+    1043, 1044, 1087, 1088, 1089, 1131, 1132, 1133, 869, 870, 913, 914,
+    915, 1045, 1046, 1047, 783, 784, 827, 828, 829, 871, 872, 873,
+    697, 698, 741, 742, 743, 785, 786, 787, 611, 612, 655, 656,
+    657, 699, 700, 701, 744, 745, 788, 789, 790, 832, 833, 834,
+    830, 831, 874, 875, 876, 918, 919, 920, 916, 917, 1048, 1049,
+    1050, 1092, 1093, 1094, 1090, 1091, 1134, 1135, 1136, 1178, 1179, 1180,
+    1176, 1177, 1220, 1221, 1222, 1264, 1265, 1266, 1262, 1263, 1306, 1307,
+    1308, 1350, 1351, 1352, 1348, 1349, 1392, 1393, 1394, 1436, 1437, 1438,
+    1434, 1435, 1478, 1479, 1480, 1522, 1523, 1524, 1520, 1521, 1564, 1565,
+    1566, 1608, 1609, 1610, 1604, 1607, 1648, 1651, 1652, 1692, 1695, 1696,
+    1690, 1691, 1734, 1735, 1736, 1778, 1779, 1780, 1776, 1777, 1820, 1821,
+    1822, 1864, 1865, 1866, 1739, 1740, 1783, 1784, 1785, 1827, 1828, 1829,
+    1653, 1654, 1697, 1698, 1699, 1741, 1742, 1743, 1567, 1568, 1611, 1612,
+    1613, 1655, 1656, 1657, 1481, 1482, 1525, 1526, 1527, 1569, 1570, 1571,
+    1395, 1396, 1439, 1440, 1441, 1483, 1484, 1485, 1309, 1310, 1353, 1354,
+    1355, 1397, 1398, 1399, 1223, 1224, 1267, 1268, 1269, 1311, 1312, 1313,
+    1137, 1138, 1181, 1182, 1183, 1225, 1226, 1227, 1051, 1052, 1095, 1096,
+    1097, 1139, 1140, 1141, 1184, 1185, 1228, 1229, 1230, 1272, 1273, 1274,
+    1270, 1271, 1314, 1315, 1316, 1358, 1359, 1360, 1356, 1357, 1400, 1401,
+    1402, 1444, 1445, 1446, 1442, 1443, 1486, 1487, 1488, 1530, 1531, 1532,
+    1528, 1529, 1572, 1573, 1574, 1616, 1617, 1618, 1614, 1615, 1658, 1659,
+    1660, 1702, 1703, 1704, 1700, 1701, 1744, 1745, 1746, 1788, 1789, 1790,
+    1786, 1787, 1830, 1831, 1832, 1874, 1875, 1876, 1747, 1748, 1791, 1792,
+    1793, 1835, 1836, 1837, 1661, 1662, 1705, 1706, 1707, 1749, 1750, 1751,
+    1575, 1576, 1619, 1620, 1621, 1663, 1664, 1665, 1489, 1490, 1533, 1534,
+    1535, 1577, 1578, 1579, 1403, 1404, 1447, 1448, 1449, 1491, 1492, 1493,
+    1536, 1537, 1580, 1581, 1582, 1624, 1625, 1626, 1622, 1623, 1666, 1667,
+    1668, 1710, 1711, 1712, 1708, 1709, 1752, 1753, 1754, 1796, 1797, 1798,
+    1794, 1795, 1838, 1839, 1840, 1882, 1883, 1884, 1755, 1756, 1799, 1800,
+    1801, 1843, 1844, 1845,
+};
+
+static const uint16_t bits_13[1936] = {
+    381, 382, 429, 430, 193, 477, 478, 241, 49, 50, 97, 98,
+    99, 145, 146, 147, 2167, 2168, 2215, 2216, 2217, 51, 52, 53,
+    2218, 2219, 54, 55, 56, 102, 103, 104, 100, 101, 148, 149,
+    150, 196, 197, 198, 194, 195, 242, 243, 244, 290, 291, 292,
+    526, 289, 574, 337, 338, 622, 385, 386, 765, 766, 813, 814,
+    577, 861, 862, 625, 433, 434, 481, 482, 483, 529, 530, 531,
+    339, 340, 387, 388, 389, 435, 436, 437, 245, 246, 293, 294,
+    295, 341, 342, 343, 151, 152, 199, 200, 201, 247, 248, 249,
+    57, 58, 105, 106, 107, 153, 154, 155, 2175, 2176, 2223, 2224,
+    2225, 59, 60, 61, 2226, 2227, 62, 63, 64, 110, 111, 112,
+    108, 109, 156, 157, 158, 204, 205, 206, 202, 203, 250, 251,
+    252, 298, 299, 300, 296, 297, 344, 345, 346, 392, 393, 394,
+    390, 391, 438, 439, 440, 486, 487, 488, 484, 485, 532, 533,
+    534, 580, 581, 582, 578, 579, 626, 627, 628, 674, 675, 676,
+    910, 673, 958, 721, 722, 1006, 769, 770, 1245, 1246, 1293, 1294,
+    961, 1341, 1342, 1009, 817, 818, 865, 866, 867, 913, 914, 915,
+    723, 724, 771, 772, 773, 819, 820, 821, 629, 630, 677, 678,
+    679, 725, 726, 727, 535, 536, 583, 584, 585, 631, 632, 633,
+    441, 442, 489, 490, 491, 537, 538, 539, 347, 348, 395, 396,
+    397, 443, 444, 445, 253, 254, 301, 302, 303, 349, 350, 351,
+    159, 160, 207, 208, 209, 255, 256, 257, 65, 66, 113, 114,
+    115, 161, 162, 163, 2185, 2186, 2233, 2234, 2235, 67, 68, 69,
+    2236, 2237, 70, 73, 74, 118, 121, 122, 116, 117, 164, 165,
+    166, 212, 213, 214, 210, 211, 258, 259, 260, 306, 307, 308,
+    304, 305, 352, 353, 354, 400, 401, 402, 398, 399, 446, 447,
+    448, 494, 495, 496, 492, 493, 540, 541, 542, 588, 589, 590,
+    586, 587, 634, 635, 636, 682, 683, 684, 680, 681, 728, 729,
+    730, 776, 777, 778, 774, 775, 822, 823, 824, 870, 871, 872,
+    868, 869, 916, 917, 918, 964, 965, 966, 962, 963, 1010, 1011,
+    1012, 1058, 1059, 1060, 1390, 1057, 1438, 1201, 1202, 1486, 1249, 1250,
+    1629, 1630, 1677, 1678, 1441, 1725, 1726, 1489, 1297, 1298, 1345, 1346,
+    1347, 1393, 1394, 1395, 1203, 1204, 1251, 1252, 1253, 1299, 1300, 1301,
+    1013, 1014, 1061, 1062, 1063, 1205, 1206, 1207, 919, 920, 967, 968,
+    969, 1015, 1016, 1017, 825, 826, 873, 874, 875, 921, 922, 923,
+    731, 732, 779, 780, 781, 827, 828, 829, 637, 638, 685, 686,
+    687, 733, 734, 735, 543, 544, 591, 592, 593, 639, 640, 641,
+    449, 450, 497, 498, 499, 545, 546, 547, 355, 356, 403, 404,
+    405, 451, 452, 453, 261, 262, 309, 310, 313, 357, 358, 361,
+    169, 170, 217, 218, 219, 265, 266, 267, 75, 76, 123, 124,
+    125, 171, 172, 173, 2193, 2194, 2241, 2242, 2243, 77, 78, 79,
+    2244, 2245, 80, 81, 82, 128, 129, 130, 126, 127, 174, 175,
+    176, 222, 223, 224, 220, 221, 268, 269, 270, 316, 317, 318,
+    314, 315, 362, 363, 364, 410, 411, 412, 406, 409, 454, 457,
+    458, 502, 505, 506, 500, 501, 548, 549, 550, 596, 597, 598,
+    594, 595, 642, 643, 644, 690, 691, 692, 688, 689, 736, 737,
+    738, 784, 785, 786, 782, 783, 830, 831, 832, 878, 879, 880,
+    876, 877, 924, 925, 926, 972, 973, 974, 970, 971, 1018, 1019,
+    1020, 1066, 1067, 1068, 1064, 1065, 1208, 1209, 1210, 1256, 1257, 1258,
+    1254, 1255, 1302, 1303, 1304, 1350, 1351, 1352, 1348, 1349, 1396, 1397,
+    1398, 1444, 1445, 1446, 1442, 1443, 1490, 1491, 1492, 1538, 1539, 1540,
+    1774, 1537, 1822, 1585, 1586, 1870, 1633, 1634, 2013, 2014, 2061, 2062,
+    1825, 2109, 2110, 1873, 1681, 1682, 1729, 1730, 1731, 1777, 1778, 1779,
+    1587, 1588, 1635, 1636, 1637, 1683, 1684, 1685, 1493, 1494, 1541, 1542,
+    1543, 1589, 1590, 1591, 1399, 1400, 1447, 1448, 1449, 1495, 1496, 1497,
+    1305, 1306, 1353, 1354, 1355, 1401, 1402, 1403, 1211, 1212, 1259, 1260,
+    1261, 1307, 1308, 1309, 1021, 1022, 1069, 1070, 1071, 1213, 1214, 1215,
+    927, 928, 975, 976, 977, 1023, 1024, 1025, 833, 834, 881, 882,
+    883, 929, 930, 931, 739, 740, 787, 788, 789, 835, 836, 837,
+    645, 646, 693, 694, 697, 741, 742, 745, 553, 554, 601, 602,
+    603, 649, 650, 651, 459, 460, 507, 508, 509, 555, 556, 557,
+    365, 366, 413, 414, 415, 461, 462, 463, 271, 272, 319, 320,
+    321, 367, 368, 369, 177, 178, 225, 226, 227, 273, 274, 275,
+    83, 84, 131, 132, 133, 179, 180, 181, 2201, 2202, 2249, 2250,
+    2251, 85, 86, 87, 2252, 2253, 88, 89, 90, 136, 137, 138,
+    134, 135, 182, 183, 184, 230, 231, 232, 228, 229, 276, 277,
+    278, 324, 325, 326, 322, 323, 370, 371, 372, 418, 419, 420,
+    416, 417, 464, 465, 466, 512, 513, 514, 510, 511, 558, 559,
+    560, 606, 607, 608, 604, 605, 652, 653, 654, 700, 701, 702,
+    698, 699, 746, 747, 748, 794, 795, 796, 790, 793, 838, 841,
+    842, 886, 889, 890, 884, 885, 932, 933, 934, 980, 981, 982,
+    978, 979, 1026, 1027, 1028, 1074, 1075, 1076, 1072, 1073, 1216, 1217,
+    1218, 1264, 1265, 1266, 1262, 1263, 1310, 1311, 1312, 1358, 1359, 1360,
+    1356, 1357, 1404, 1405, 1406, 1452, 1453, 1454, 1450, 1451, 1498, 1499,
+    1500, 1546, 1547, 1548, 1544, 1545, 1592, 1593, 1594, 1640, 1641, 1642,
+    1638, 1639, 1686, 1687, 1688, 1734, 1735, 1736, 1732, 1733, 1780, 1781,
+    1782, 1828, 1829, 1830, 1826, 1827, 1874, 1875, 1876, 1922, 1923, 1924,
+    2158, 1921, 2206, 1969, 1970, 2254, 2017, 2018, 2209, 2210, 2211, 93,
+    94, 142, 190, 238, 2065, 2066, 2113, 2114, 2115, 2161, 2162, 2163,
+    1971, 1972, 2019, 2020, 2021, 2067, 2068, 2069, 1877, 1878, 1925, 1926,
+    1927, 1973, 1974, 1975, 1783, 1784, 1831, 1832, 1833, 1879, 1880, 1881,
+    1689, 1690, 1737, 1738, 1739, 1785, 1786, 1787, 1595, 1596, 1643, 1644,
+    1645, 1691, 1692, 1693, 1501, 1502, 1549, 1550, 1551, 1597, 1598, 1599,
+    1407, 1408, 1455, 1456, 1457, 1503, 1504, 1505, 1313, 1314, 1361, 1362,
+    1363, 1409, 1410, 1411, 1219, 1220, 1267, 1268, 1269, 1315, 1316, 1317,
+    1029, 1030, 1077, 1078, 1081, 1221, 1222, 1225, 937, 938, 985, 986,
+    987, 1033, 1034, 1035, 843, 844, 891, 892, 893, 939, 940, 941,
+    749, 750, 797, 798, 799, 845, 846, 847, 655, 656, 703, 704,
+    705, 751, 752, 753, 561, 562, 609, 610, 611, 657, 658, 659,
+    467, 468, 515, 516, 517, 563, 564, 565, 373, 374, 421, 422,
+    423, 469, 470, 471, 279, 280, 327, 328, 329, 375, 376, 377,
+    185, 186, 233, 234, 235, 281, 282, 283, 91, 92, 139, 140,
+    141, 187, 188, 189, 236, 237, 284, 285, 286, 332, 333, 334,
+    330, 331, 378, 379, 380, 426, 427, 428, 424, 425, 472, 473,
+    474, 520, 521, 522, 518, 519, 566, 567, 568, 614, 615, 616,
+    612, 613, 660, 661, 662, 708, 709, 710, 706, 707, 754, 755,
+    756, 802, 803, 804, 800, 801, 848, 849, 850, 896, 897, 898,
+    894, 895, 942, 943, 944, 990, 991, 992, 988, 989, 1036, 1037,
+    1038, 1084, 1085, 1086, 1082, 1083, 1226, 1227, 1228, 1274, 1275, 1276,
+    1270, 1273, 1318, 1321, 1322, 1366, 1369, 1370, 1364, 1365, 1412, 1413,
+    1414, 1460, 1461, 1462, 1458, 1459, 1506, 1507, 1508, 1554, 1555, 1556,
+    1552, 1553, 1600, 1601, 1602, 1648, 1649, 1650, 1646, 1647, 1694, 1695,
+    1696, 1742, 1743, 1744, 1740, 1741, 1788, 1789, 1790, 1836, 1837, 1838,
+    1834, 1835, 1882, 1883, 1884, 1930, 1931, 1932, 1928, 1929, 1976, 1977,
+    1978, 2024, 2025, 2026, 2022, 2023, 2070, 2071, 2072, 2118, 2119, 2120,
+    2116, 2117, 2164, 2165, 2166, 2212, 2213, 2214, 2073, 2074, 2121, 2122,
+    2123, 2169, 2170, 2171, 1979, 1980, 2027, 2028, 2029, 2075, 2076, 2077,
+    1885, 1886, 1933, 1934, 1935, 1981, 1982, 1983, 1791, 1792, 1839, 1840,
+    1841, 1887, 1888, 1889, 1697, 1698, 1745, 1746, 1747, 1793, 1794, 1795,
+    1603, 1604, 1651, 1652, 1653, 1699, 1700, 1701, 1509, 1510, 1557, 1558,
+    1561, 1605, 1606, 1609, 1417, 1418, 1465, 1466, 1467, 1513, 1514, 1515,
+    1323, 1324, 1371, 1372, 1373, 1419, 1420, 1421, 1229, 1230, 1277, 1278,
+    1279, 1325, 1326, 1327, 1039, 1040, 1087, 1088, 1089, 1231, 1232, 1233,
+    945, 946, 993, 994, 995, 1041, 1042, 1043, 851, 852, 899, 900,
+    901, 947, 948, 949, 757, 758, 805, 806, 807, 853, 854, 855,
+    663, 664, 711, 712, 713, 759, 760, 761, 569, 570, 617, 618,
+    619, 665, 666, 667, 475, 476, 523, 524, 525, 571, 572, 573,
+    620, 621, 668, 669, 670, 716, 717, 718, 714, 715, 762, 763,
+    764, 810, 811, 812, 808, 809, 856, 857, 858, 904, 905, 906,
+    902, 903, 950, 951, 952, 998, 999, 1000, 996, 997, 1044, 1045,
+    1046, 1092, 1093, 1094, 1090, 1091, 1234, 1235, 1236, 1282, 1283, 1284,
+    1280, 1281, 1328, 1329, 1330, 1376, 1377, 1378, 1374, 1375, 1422, 1423,
+    1424, 1470, 1471, 1472, 1468, 1469, 1516, 1517, 1518, 1564, 1565, 1566,
+    1562, 1563, 1610, 1611, 1612, 1658, 1659, 1660, 1654, 1657, 1702, 1705,
+    1706, 1750, 1753, 1754, 1748, 1749, 1796, 1797, 1798, 1844, 1845, 1846,
+    1842, 1843, 1890, 1891, 1892, 1938, 1939, 1940, 1936, 1937, 1984, 1985,
+    1986, 2032, 2033, 2034, 2030, 2031, 2078, 2079, 2080, 2126, 2127, 2128,
+    2124, 2125, 2172, 2173, 2174, 2220, 2221, 2222, 2081, 2082, 2129, 2130,
+    2131, 2177, 2178, 2179, 1987, 1988, 2035, 2036, 2037, 2083, 2084, 2085,
+    1893, 1894, 1941, 1942, 1945, 1989, 1990, 1993, 1801, 1802, 1849, 1850,
+    1851, 1897, 1898, 1899, 1707, 1708, 1755, 1756, 1757, 1803, 1804, 1805,
+    1613, 1614, 1661, 1662, 1663, 1709, 1710, 1711, 1519, 1520, 1567, 1568,
+    1569, 1615, 1616, 1617, 1425, 1426, 1473, 1474, 1475, 1521, 1522, 1523,
+    1331, 1332, 1379, 1380, 1381, 1427, 1428, 1429, 1237, 1238, 1285, 1286,
+    1287, 1333, 1334, 1335, 1047, 1048, 1095, 1096, 1097, 1239, 1240, 1241,
+    953, 954, 1001, 1002, 1003, 1049, 1050, 1051, 859, 860, 907, 908,
+    909, 955, 956, 957, 1004, 1005, 1052, 1053, 1054, 1100, 1101, 1102,
+    1098, 1099, 1242, 1243, 1244, 1290, 1291, 1292, 1288, 1289, 1336, 1337,
+    1338, 1384, 1385, 1386, 1382, 1383, 1430, 1431, 1432, 1478, 1479, 1480,
+    1476, 1477, 1524, 1525, 1526, 1572, 1573, 1574, 1570, 1571, 1618, 1619,
+    1620, 1666, 1667, 1668, 1664, 1665, 1712, 1713, 1714, 1760, 1761, 1762,
+    1758, 1759, 1806, 1807, 1808, 1854, 1855, 1856, 1852, 1853, 1900, 1901,
+    1902, 1948, 1949, 1950, 1946, 1947, 1994, 1995, 1996, 2042, 2043, 2044,
+    2038, 2041, 2086, 2089, 2090, 2134, 2137, 2138, 2132, 2133, 2180, 2181,
+    2182, 2228, 2229, 2230, 2091, 2092, 2139, 2140, 2141, 2187, 2188, 2189,
+    1997, 1998, 2045, 2046, 2047, 2093, 2094, 2095, 1903, 1904, 1951, 1952,
+    1953, 1999, 2000, 2001, 1809, 1810, 1857, 1858, 1859, 1905, 1906, 1907,
+    1715, 1716, 1763, 1764, 1765, 1811, 1812, 1813, 1621, 1622, 1669, 1670,
+    1671, 1717, 1718, 1719, 1527, 1528, 1575, 1576, 1577, 1623, 1624, 1625,
+    1433, 1434, 1481, 1482, 1483, 1529, 1530, 1531, 1339, 1340, 1387, 1388,
+    1389, 1435, 1436, 1437, 1484, 1485, 1532, 1533, 1534, 1580, 1581, 1582,
+    1578, 1579, 1626, 1627, 1628, 1674, 1675, 1676, 1672, 1673, 1720, 1721,
+    1722, 1768, 1769, 1770, 1766, 1767, 1814, 1815, 1816, 1862, 1863, 1864,
+    1860, 1861, 1908, 1909, 1910, 1956, 1957, 1958, 1954, 1955, 2002, 2003,
+    2004, 2050, 2051, 2052, 2048, 2049, 2096, 2097, 2098, 2144, 2145, 2146,
+    2142, 2143, 2190, 2191, 2192, 2238, 2239, 2240, 2099, 2100, 2147, 2148,
+    2149, 2195, 2196, 2197, 2005, 2006, 2053, 2054, 2055, 2101, 2102, 2103,
+    1911, 1912, 1959, 1960, 1961, 2007, 2008, 2009, 1817, 1818, 1865, 1866,
+    1867, 1913, 1914, 1915, 1723, 1724, 1771, 1772, 1773, 1819, 1820, 1821,
+    1868, 1869, 1916, 1917, 1918, 1964, 1965, 1966, 1962, 1963, 2010, 2011,
+    2012, 2058, 2059, 2060, 2056, 2057, 2104, 2105, 2106, 2152, 2153, 2154,
+    2150, 2151, 2198, 2199, 2200, 2246, 2247, 2248, 2107, 2108, 2155, 2156,
+    2157, 2203, 2204, 2205,
+};
+
+static const uint16_t bits_14[2304] = {
+    205, 206, 257, 258, 209, 309, 310, 261, 53, 54, 105, 106,
+    107, 157, 158, 159, 2551, 2552, 2603, 2604, 2605, 55, 56, 57,
+    2606, 2607, 58, 59, 60, 110, 111, 112, 108, 109, 160, 161,
+    162, 212, 213, 214, 210, 211, 262, 263, 264, 314, 315, 316,
+    362, 313, 414, 365, 366, 466, 417, 418, 621, 622, 673, 674,
+    625, 725, 726, 677, 469, 470, 521, 522, 523, 573, 574, 575,
+    367, 368, 419, 420, 421, 471, 472, 473, 265, 266, 317, 318,
+    319, 369, 370, 371, 163, 164, 215, 216, 217, 267, 268, 269,
+    61, 62, 113, 114, 115, 165, 166, 167, 2559, 2560, 2611, 2612,
+    2613, 63, 64, 65, 2614, 2615, 66, 67, 68, 118, 119, 120,
+    116, 117, 168, 169, 170, 220, 221, 222, 218, 219, 270, 271,
+    272, 322, 323, 324, 320, 321, 372, 373, 374, 424, 425, 426,
+    422, 423, 474, 475, 476, 526, 527, 528, 524, 525, 576, 577,
+    578, 628, 629, 630, 626, 627, 678, 679, 680, 730, 731, 732,
+    778, 729, 830, 781, 782, 882, 833, 834, 1037, 1038, 1089, 1090,
+    1041, 1141, 1142, 1093, 885, 886, 937, 938, 939, 989, 990, 991,
+    783, 784, 835, 836, 837, 887, 888, 889, 681, 682, 733, 734,
+    735, 785, 786, 787, 579, 580, 631, 632, 633, 683, 684, 685,
+    477, 478, 529, 530, 531, 581, 582, 583, 375, 376, 427, 428,
+    429, 479, 480, 481, 273, 274, 325, 326, 327, 377, 378, 379,
+    171, 172, 223, 224, 225, 275, 276, 277, 69, 70, 121, 122,
+    123, 173, 174, 175, 2567, 2568, 2619, 2620, 2621, 71, 72, 73,
+    2622, 2623, 74, 75, 76, 126, 127, 128, 124, 125, 176, 177,
+    178, 228, 229, 230, 226, 227, 278, 279, 280, 330, 331, 332,
+    328, 329, 380, 381, 382, 432, 433, 434, 430, 431, 482, 483,
+    484, 534, 535, 536, 532, 533, 584, 585, 586, 636, 637, 638,
+    634, 635, 686, 687, 688, 738, 739, 740, 736, 737, 788, 789,
+    790, 840, 841, 842, 838, 839, 890, 891, 892, 942, 943, 944,
+    940, 941, 992, 993, 994, 1044, 1045, 1046, 1042, 1043, 1094, 1095,
+    1096, 1146, 1147, 1148, 1194, 1145, 1246, 1197, 1198, 1298, 1249, 1250,
+    1557, 1558, 1609, 1610, 1561, 1661, 1662, 1613, 1405, 1406, 1457, 1458,
+    1459, 1509, 1510, 1511, 1199, 1200, 1251, 1252, 1253, 1407, 1408, 1409,
+    1097, 1098, 1149, 1150, 1151, 1201, 1202, 1203, 995, 996, 1047, 1048,
+    1049, 1099, 1100, 1101, 893, 894, 945, 946, 947, 997, 998, 999,
+    791, 792, 843, 844, 845, 895, 896, 897, 689, 690, 741, 742,
+    743, 793, 794, 795, 587, 588, 639, 640, 641, 691, 692, 693,
+    485, 486, 537, 538, 539, 589, 590, 591, 383, 384, 435, 436,
+    437, 487, 488, 489, 281, 282, 333, 334, 335, 385, 386, 387,
+    179, 180, 231, 232, 235, 283, 284, 287, 79, 80, 131, 132,
+    133, 183, 184, 185, 2577, 2578, 2629, 2630, 2631, 81, 82, 83,
+    2632, 2633, 84, 85, 86, 136, 137, 138, 134, 135, 186, 187,
+    188, 238, 239, 240, 236, 237, 288, 289, 290, 340, 341, 342,
+    336, 339, 388, 391, 392, 440, 443, 444, 438, 439, 490, 491,
+    492, 542, 543, 544, 540, 541, 592, 593, 594, 644, 645, 646,
+    642, 643, 694, 695, 696, 746, 747, 748, 744, 745, 796, 797,
+    798, 848, 849, 850, 846, 847, 898, 899, 900, 950, 951, 952,
+    948, 949, 1000, 1001, 1002, 1052, 1053, 1054, 1050, 1051, 1102, 1103,
+    1104, 1154, 1155, 1156, 1152, 1153, 1204, 1205, 1206, 1256, 1257, 1258,
+    1254, 1255, 1410, 1411, 1412, 1462, 1463, 1464, 1460, 1461, 1512, 1513,
+    1514, 1564, 1565, 1566, 1562, 1563, 1614, 1615, 1616, 1666, 1667, 1668,
+    1714, 1665, 1766, 1717, 1718, 1818, 1769, 1770, 1973, 1974, 2025, 2026,
+    1977, 2077, 2078, 2029, 1821, 1822, 1873, 1874, 1875, 1925, 1926, 1927,
+    1719, 1720, 1771, 1772, 1773, 1823, 1824, 1825, 1617, 1618, 1669, 1670,
+    1671, 1721, 1722, 1723, 1515, 1516, 1567, 1568, 1569, 1619, 1620, 1621,
+    1413, 1414, 1465, 1466, 1467, 1517, 1518, 1519, 1207, 1208, 1259, 1260,
+    1261, 1415, 1416, 1417, 1105, 1106, 1157, 1158, 1159, 1209, 1210, 1211,
+    1003, 1004, 1055, 1056, 1057, 1107, 1108, 1109, 901, 902, 953, 954,
+    955, 1005, 1006, 1007, 799, 800, 851, 852, 853, 903, 904, 905,
+    697, 698, 749, 750, 751, 801, 802, 803, 595, 596, 647, 648,
+    651, 699, 700, 703, 495, 496, 547, 548, 549, 599, 600, 601,
+    393, 394, 445, 446, 447, 497, 498, 499, 291, 292, 343, 344,
+    345, 395, 396, 397, 189, 190, 241, 242, 243, 293, 294, 295,
+    87, 88, 139, 140, 141, 191, 192, 193, 2585, 2586, 2637, 2638,
+    2639, 89, 90, 91, 2640, 2641, 92, 93, 94, 144, 145, 146,
+    142, 143, 194, 195, 196, 246, 247, 248, 244, 245, 296, 297,
+    298, 348, 349, 350, 346, 347, 398, 399, 400, 450, 451, 452,
+    448, 449, 500, 501, 502, 552, 553, 554, 550, 551, 602, 603,
+    604, 654, 655, 656, 652, 653, 704, 705, 706, 756, 757, 758,
+    752, 755, 804, 807, 808, 856, 859, 860, 854, 855, 906, 907,
+    908, 958, 959, 960, 956, 957, 1008, 1009, 1010, 1060, 1061, 1062,
+    1058, 1059, 1110, 1111, 1112, 1162, 1163, 1164, 1160, 1161, 1212, 1213,
+    1214, 1264, 1265, 1266, 1262, 1263, 1418, 1419, 1420, 1470, 1471, 1472,
+    1468, 1469, 1520, 1521, 1522, 1572, 1573, 1574, 1570, 1571, 1622, 1623,
+    1624, 1674, 1675, 1676, 1672, 1673, 1724, 1725, 1726, 1776, 1777, 1778,
+    1774, 1775, 1826, 1827, 1828, 1878, 1879, 1880, 1876, 1877, 1928, 1929,
+    1930, 1980, 1981, 1982, 1978, 1979, 2030, 2031, 2032, 2082, 2083, 2084,
+    2130, 2081, 2182, 2133, 2134, 2234, 2185, 2186, 2389, 2390, 2441, 2442,
+    2393, 2493, 2494, 2445, 2237, 2238, 2289, 2290, 2291, 2341, 2342, 2343,
+    2135, 2136, 2187, 2188, 2189, 2239, 2240, 2241, 2033, 2034, 2085, 2086,
+    2087, 2137, 2138, 2139, 1931, 1932, 1983, 1984, 1985, 2035, 2036, 2037,
+    1829, 1830, 1881, 1882, 1883, 1933, 1934, 1935, 1727, 1728, 1779, 1780,
+    1781, 1831, 1832, 1833, 1625, 1626, 1677, 1678, 1679, 1729, 1730, 1731,
+    1523, 1524, 1575, 1576, 1577, 1627, 1628, 1629, 1421, 1422, 1473, 1474,
+    1475, 1525, 1526, 1527, 1215, 1216, 1267, 1268, 1269, 1423, 1424, 1425,
+    1113, 1114, 1165, 1166, 1167, 1217, 1218, 1219, 1011, 1012, 1063, 1064,
+    1067, 1115, 1116, 1119, 911, 912, 963, 964, 965, 1015, 1016, 1017,
+    809, 810, 861, 862, 863, 913, 914, 915, 707, 708, 759, 760,
+    761, 811, 812, 813, 605, 606, 657, 658, 659, 709, 710, 711,
+    503, 504, 555, 556, 557, 607, 608, 609, 401, 402, 453, 454,
+    455, 505, 506, 507, 299, 300, 351, 352, 353, 403, 404, 405,
+    197, 198, 249, 250, 251, 301, 302, 303, 95, 96, 147, 148,
+    149, 199, 200, 201, 2593, 2594, 2645, 2646, 2647, 97, 98, 99,
+    2648, 2649, 100, 101, 102, 152, 153, 154, 150, 151, 202, 203,
+    204, 254, 255, 256, 252, 253, 304, 305, 306, 356, 357, 358,
+    354, 355, 406, 407, 408, 458, 459, 460, 456, 457, 508, 509,
+    510, 560, 561, 562, 558, 559, 610, 611, 612, 662, 663, 664,
+    660, 661, 712, 713, 714, 764, 765, 766, 762, 763, 814, 815,
+    816, 866, 867, 868, 864, 865, 916, 917, 918, 968, 969, 970,
+    966, 967, 1018, 1019, 1020, 1070, 1071, 1072, 1068, 1069, 1120, 1121,
+    1122, 1172, 1173, 1174, 1168, 1171, 1220, 1223, 1224, 1272, 1275, 1276,
+    1270, 1271, 1426, 1427, 1428, 1478, 1479, 1480, 1476, 1477, 1528, 1529,
+    1530, 1580, 1581, 1582, 1578, 1579, 1630, 1631, 1632, 1682, 1683, 1684,
+    1680, 1681, 1732, 1733, 1734, 1784, 1785, 1786, 1782, 1783, 1834, 1835,
+    1836, 1886, 1887, 1888, 1884, 1885, 1936, 1937, 1938, 1988, 1989, 1990,
+    1986, 1987, 2038, 2039, 2040, 2090, 2091, 2092, 2088, 2089, 2140, 2141,
+    2142, 2192, 2193, 2194, 2190, 2191, 2242, 2243, 2244, 2294, 2295, 2296,
+    2292, 2293, 2344, 2345, 2346, 2396, 2397, 2398, 2394, 2395, 2446, 2447,
+    2448, 2498, 2499, 2500, 2546, 2497, 2598, 2549, 2550, 2650, 2601, 2602,
+    2449, 2450, 2501, 2502, 2503, 2553, 2554, 2555, 2347, 2348, 2399, 2400,
+    2401, 2451, 2452, 2453, 2245, 2246, 2297, 2298, 2299, 2349, 2350, 2351,
+    2143, 2144, 2195, 2196, 2197, 2247, 2248, 2249, 2041, 2042, 2093, 2094,
+    2095, 2145, 2146, 2147, 1939, 1940, 1991, 1992, 1993, 2043, 2044, 2045,
+    1837, 1838, 1889, 1890, 1891, 1941, 1942, 1943, 1735, 1736, 1787, 1788,
+    1789, 1839, 1840, 1841, 1633, 1634, 1685, 1686, 1687, 1737, 1738, 1739,
+    1531, 1532, 1583, 1584, 1587, 1635, 1636, 1639, 1431, 1432, 1483, 1484,
+    1485, 1535, 1536, 1537, 1225, 1226, 1277, 1278, 1279, 1433, 1434, 1435,
+    1123, 1124, 1175, 1176, 1177, 1227, 1228, 1229, 1021, 1022, 1073, 1074,
+    1075, 1125, 1126, 1127, 919, 920, 971, 972, 973, 1023, 1024, 1025,
+    817, 818, 869, 870, 871, 921, 922, 923, 715, 716, 767, 768,
+    769, 819, 820, 821, 613, 614, 665, 666, 667, 717, 718, 719,
+    511, 512, 563, 564, 565, 615, 616, 617, 409, 410, 461, 462,
+    463, 513, 514, 515, 307, 308, 359, 360, 361, 411, 412, 413,
+    464, 465, 516, 517, 518, 568, 569, 570, 566, 567, 618, 619,
+    620, 670, 671, 672, 668, 669, 720, 721, 722, 772, 773, 774,
+    770, 771, 822, 823, 824, 874, 875, 876, 872, 873, 924, 925,
+    926, 976, 977, 978, 974, 975, 1026, 1027, 1028, 1078, 1079, 1080,
+    1076, 1077, 1128, 1129, 1130, 1180, 1181, 1182, 1178, 1179, 1230, 1231,
+    1232, 1282, 1283, 1284, 1280, 1281, 1436, 1437, 1438, 1488, 1489, 1490,
+    1486, 1487, 1538, 1539, 1540, 1590, 1591, 1592, 1588, 1589, 1640, 1641,
+    1642, 1692, 1693, 1694, 1688, 1691, 1740, 1743, 1744, 1792, 1795, 1796,
+    1790, 1791, 1842, 1843, 1844, 1894, 1895, 1896, 1892, 1893, 1944, 1945,
+    1946, 1996, 1997, 1998, 1994, 1995, 2046, 2047, 2048, 2098, 2099, 2100,
+    2096, 2097, 2148, 2149, 2150, 2200, 2201, 2202, 2198, 2199, 2250, 2251,
+    2252, 2302, 2303, 2304, 2300, 2301, 2352, 2353, 2354, 2404, 2405, 2406,
+    2402, 2403, 2454, 2455, 2456, 2506, 2507, 2508, 2504, 2505, 2556, 2557,
+    2558, 2608, 2609, 2610, 2457, 2458, 2509, 2510, 2511, 2561, 2562, 2563,
+    2355, 2356, 2407, 2408, 2409, 2459, 2460, 2461, 2253, 2254, 2305, 2306,
+    2307, 2357, 2358, 2359, 2151, 2152, 2203, 2204, 2205, 2255, 2256, 2257,
+    2049, 2050, 2101, 2102, 2103, 2153, 2154, 2155, 1947, 1948, 1999, 2000,
+    2003, 2051, 2052, 2055, 1847, 1848, 1899, 1900, 1901, 1951, 1952, 1953,
+    1745, 1746, 1797, 1798, 1799, 1849, 1850, 1851, 1643, 1644, 1695, 1696,
+    1697, 1747, 1748, 1749, 1541, 1542, 1593, 1594, 1595, 1645, 1646, 1647,
+    1439, 1440, 1491, 1492, 1493, 1543, 1544, 1545, 1233, 1234, 1285, 1286,
+    1287, 1441, 1442, 1443, 1131, 1132, 1183, 1184, 1185, 1235, 1236, 1237,
+    1029, 1030, 1081, 1082, 1083, 1133, 1134, 1135, 927, 928, 979, 980,
+    981, 1031, 1032, 1033, 825, 826, 877, 878, 879, 929, 930, 931,
+    723, 724, 775, 776, 777, 827, 828, 829, 880, 881, 932, 933,
+    934, 984, 985, 986, 982, 983, 1034, 1035, 1036, 1086, 1087, 1088,
+    1084, 1085, 1136, 1137, 1138, 1188, 1189, 1190, 1186, 1187, 1238, 1239,
+    1240, 1290, 1291, 1292, 1288, 1289, 1444, 1445, 1446, 1496, 1497, 1498,
+    1494, 1495, 1546, 1547, 1548, 1598, 1599, 1600, 1596, 1597, 1648, 1649,
+    1650, 1700, 1701, 1702, 1698, 1699, 1750, 1751, 1752, 1802, 1803, 1804,
+    1800, 1801, 1852, 1853, 1854, 1904, 1905, 1906, 1902, 1903, 1954, 1955,
+    1956, 2006, 2007, 2008, 2004, 2005, 2056, 2057, 2058, 2108, 2109, 2110,
+    2104, 2107, 2156, 2159, 2160, 2208, 2211, 2212, 2206, 2207, 2258, 2259,
+    2260, 2310, 2311, 2312, 2308, 2309, 2360, 2361, 2362, 2412, 2413, 2414,
+    2410, 2411, 2462, 2463, 2464, 2514, 2515, 2516, 2512, 2513, 2564, 2565,
+    2566, 2616, 2617, 2618, 2465, 2466, 2517, 2518, 2519, 2569, 2570, 2571,
+    2363, 2364, 2415, 2416, 2419, 2467, 2468, 2471, 2263, 2264, 2315, 2316,
+    2317, 2367, 2368, 2369, 2161, 2162, 2213, 2214, 2215, 2265, 2266, 2267,
+    2059, 2060, 2111, 2112, 2113, 2163, 2164, 2165, 1957, 1958, 2009, 2010,
+    2011, 2061, 2062, 2063, 1855, 1856, 1907, 1908, 1909, 1959, 1960, 1961,
+    1753, 1754, 1805, 1806, 1807, 1857, 1858, 1859, 1651, 1652, 1703, 1704,
+    1705, 1755, 1756, 1757, 1549, 1550, 1601, 1602, 1603, 1653, 1654, 1655,
+    1447, 1448, 1499, 1500, 1501, 1551, 1552, 1553, 1241, 1242, 1293, 1294,
+    1295, 1449, 1450, 1451, 1139, 1140, 1191, 1192, 1193, 1243, 1244, 1245,
+    1296, 1297, 1452, 1453, 1454, 1504, 1505, 1506, 1502, 1503, 1554, 1555,
+    1556, 1606, 1607, 1608, 1604, 1605, 1656, 1657, 1658, 1708, 1709, 1710,
+    1706, 1707, 1758, 1759, 1760, 1810, 1811, 1812, 1808, 1809, 1860, 1861,
+    1862, 1912, 1913, 1914, 1910, 1911, 1962, 1963, 1964, 2014, 2015, 2016,
+    2012, 2013, 2064, 2065, 2066, 2116, 2117, 2118, 2114, 2115, 2166, 2167,
+    2168, 2218, 2219, 2220, 2216, 2217, 2268, 2269, 2270, 2320, 2321, 2322,
+    2318, 2319, 2370, 2371, 2372, 2422, 2423, 2424, 2420, 2421, 2472, 2473,
+    2474, 2524, 2525, 2526, 2520, 2523, 2572, 2575, 2576, 2624, 2627, 2628,
+    2475, 2476, 2527, 2528, 2529, 2579, 2580, 2581, 2373, 2374, 2425, 2426,
+    2427, 2477, 2478, 2479, 2271, 2272, 2323, 2324, 2325, 2375, 2376, 2377,
+    2169, 2170, 2221, 2222, 2223, 2273, 2274, 2275, 2067, 2068, 2119, 2120,
+    2121, 2171, 2172, 2173, 1965, 1966, 2017, 2018, 2019, 2069, 2070, 2071,
+    1863, 1864, 1915, 1916, 1917, 1967, 1968, 1969, 1761, 1762, 1813, 1814,
+    1815, 1865, 1866, 1867, 1659, 1660, 1711, 1712, 1713, 1763, 1764, 1765,
+    1816, 1817, 1868, 1869, 1870, 1920, 1921, 1922, 1918, 1919, 1970, 1971,
+    1972, 2022, 2023, 2024, 2020, 2021, 2072, 2073, 2074, 2124, 2125, 2126,
+    2122, 2123, 2174, 2175, 2176, 2226, 2227, 2228, 2224, 2225, 2276, 2277,
+    2278, 2328, 2329, 2330, 2326, 2327, 2378, 2379, 2380, 2430, 2431, 2432,
+    2428, 2429, 2480, 2481, 2482, 2532, 2533, 2534, 2530, 2531, 2582, 2583,
+    2584, 2634, 2635, 2636, 2483, 2484, 2535, 2536, 2537, 2587, 2588, 2589,
+    2381, 2382, 2433, 2434, 2435, 2485, 2486, 2487, 2279, 2280, 2331, 2332,
+    2333, 2383, 2384, 2385, 2177, 2178, 2229, 2230, 2231, 2281, 2282, 2283,
+    2075, 2076, 2127, 2128, 2129, 2179, 2180, 2181, 2232, 2233, 2284, 2285,
+    2286, 2336, 2337, 2338, 2334, 2335, 2386, 2387, 2388, 2438, 2439, 2440,
+    2436, 2437, 2488, 2489, 2490, 2540, 2541, 2542, 2538, 2539, 2590, 2591,
+    2592, 2642, 2643, 2644, 2491, 2492, 2543, 2544, 2545, 2595, 2596, 2597,
+};
+
+static const uint16_t bits_15[3136] = {
+    253, 254, 317, 318, 257, 381, 382, 321, 65, 66, 129, 130,
+    131, 193, 194, 195, 3907, 3908, 3971, 3972, 3973, 67, 68, 69,
+    3974, 3975, 70, 71, 72, 134, 135, 136, 132, 133, 196, 197,
+    198, 260, 261, 262, 258, 259, 322, 323, 324, 386, 387, 388,
+    446, 385, 510, 449, 450, 574, 513, 514, 765, 766, 829, 830,
+    769, 893, 894, 833, 577, 578, 641, 642, 643, 705, 706, 707,
+    451, 452, 515, 516, 517, 579, 580, 581, 325, 326, 389, 390,
+    391, 453, 454, 455, 199, 200, 263, 264, 265, 327, 328, 329,
+    73, 74, 137, 138, 139, 201, 202, 203, 3915, 3916, 3979, 3980,
+    3981, 75, 76, 77, 3982, 3985, 78, 81, 82, 142, 145, 146,
+    140, 141, 204, 205, 206, 268, 269, 270, 266, 267, 330, 331,
+    332, 394, 395, 396, 392, 393, 456, 457, 458, 520, 521, 522,
+    518, 519, 582, 583, 584, 646, 647, 648, 644, 645, 708, 709,
+    710, 772, 773, 774, 770, 771, 834, 835, 836, 898, 899, 900,
+    958, 897, 1150, 1089, 1090, 1214, 1153, 1154, 1405, 1406, 1469, 1470,
+    1409, 1533, 1534, 1473, 1217, 1218, 1281, 1282, 1283, 1345, 1346, 1347,
+    1091, 1092, 1155, 1156, 1157, 1219, 1220, 1221, 837, 838, 901, 902,
+    903, 1093, 1094, 1095, 711, 712, 775, 776, 777, 839, 840, 841,
+    585, 586, 649, 650, 651, 713, 714, 715, 459, 460, 523, 524,
+    525, 587, 588, 589, 333, 334, 397, 398, 401, 461, 462, 465,
+    209, 210, 273, 274, 275, 337, 338, 339, 83, 84, 147, 148,
+    149, 211, 212, 213, 3925, 3926, 3989, 3990, 3991, 85, 86, 87,
+    3992, 3993, 88, 89, 90, 152, 153, 154, 150, 151, 214, 215,
+    216, 278, 279, 280, 276, 277, 340, 341, 342, 404, 405, 406,
+    402, 403, 466, 467, 468, 530, 531, 532, 526, 529, 590, 593,
+    594, 654, 657, 658, 652, 653, 716, 717, 718, 780, 781, 782,
+    778, 779, 842, 843, 844, 906, 907, 908, 904, 905, 1096, 1097,
+    1098, 1160, 1161, 1162, 1158, 1159, 1222, 1223, 1224, 1286, 1287, 1288,
+    1284, 1285, 1348, 1349, 1350, 1412, 1413, 1414, 1410, 1411, 1474, 1475,
+    1476, 1538, 1539, 1540, 1598, 1537, 1662, 1601, 1602, 1726, 1665, 1666,
+    1917, 1918, 1981, 1982, 1921, 2173, 2174, 2113, 1729, 1730, 1793, 1794,
+    1795, 1857, 1858, 1859, 1603, 1604, 1667, 1668, 1669, 1731, 1732, 1733,
+    1477, 1478, 1541, 1542, 1543, 1605, 1606, 1607, 1351, 1352, 1415, 1416,
+    1417, 1479, 1480, 1481, 1225, 1226, 1289, 1290, 1291, 1353, 1354, 1355,
+    1099, 1100, 1163, 1164, 1165, 1227, 1228, 1229, 845, 846, 909, 910,
+    913, 1101, 1102, 1105, 721, 722, 785, 786, 787, 849, 850, 851,
+    595, 596, 659, 660, 661, 723, 724, 725, 469, 470, 533, 534,
+    535, 597, 598, 599, 343, 344, 407, 408, 409, 471, 472, 473,
+    217, 218, 281, 282, 283, 345, 346, 347, 91, 92, 155, 156,
+    157, 219, 220, 221, 3933, 3934, 3997, 3998, 4001, 93, 94, 97,
+    4002, 4003, 98, 99, 100, 162, 163, 164, 158, 161, 222, 225,
+    226, 286, 289, 290, 284, 285, 348, 349, 350, 412, 413, 414,
+    410, 411, 474, 475, 476, 538, 539, 540, 536, 537, 600, 601,
+    602, 664, 665, 666, 662, 663, 726, 727, 728, 790, 791, 792,
+    788, 789, 852, 853, 854, 916, 917, 918, 914, 915, 1106, 1107,
+    1108, 1170, 1171, 1172, 1166, 1169, 1230, 1233, 1234, 1294, 1297, 1298,
+    1292, 1293, 1356, 1357, 1358, 1420, 1421, 1422, 1418, 1419, 1482, 1483,
+    1484, 1546, 1547, 1548, 1544, 1545, 1608, 1609, 1610, 1672, 1673, 1674,
+    1670, 1671, 1734, 1735, 1736, 1798, 1799, 1800, 1796, 1797, 1860, 1861,
+    1862, 1924, 1925, 1926, 1922, 1923, 2114, 2115, 2116, 2178, 2179, 2180,
+    2238, 2177, 2302, 2241, 2242, 2366, 2305, 2306, 2557, 2558, 2621, 2622,
+    2561, 2685, 2686, 2625, 2369, 2370, 2433, 2434, 2435, 2497, 2498, 2499,
+    2243, 2244, 2307, 2308, 2309, 2371, 2372, 2373, 2117, 2118, 2181, 2182,
+    2183, 2245, 2246, 2247, 1863, 1864, 1927, 1928, 1929, 2119, 2120, 2121,
+    1737, 1738, 1801, 1802, 1803, 1865, 1866, 1867, 1611, 1612, 1675, 1676,
+    1677, 1739, 1740, 1741, 1485, 1486, 1549, 1550, 1553, 1613, 1614, 1617,
+    1361, 1362, 1425, 1426, 1427, 1489, 1490, 1491, 1235, 1236, 1299, 1300,
+    1301, 1363, 1364, 1365, 1109, 1110, 1173, 1174, 1175, 1237, 1238, 1239,
+    855, 856, 919, 920, 921, 1111, 1112, 1113, 729, 730, 793, 794,
+    795, 857, 858, 859, 603, 604, 667, 668, 669, 731, 732, 733,
+    477, 478, 541, 542, 545, 605, 606, 609, 353, 354, 417, 418,
+    419, 481, 482, 483, 227, 228, 291, 292, 293, 355, 356, 357,
+    101, 102, 165, 166, 167, 229, 230, 231, 3943, 3944, 4007, 4008,
+    4009, 103, 104, 105, 4010, 4011, 106, 107, 108, 170, 171, 172,
+    168, 169, 232, 233, 234, 296, 297, 298, 294, 295, 358, 359,
+    360, 422, 423, 424, 420, 421, 484, 485, 486, 548, 549, 550,
+    546, 547, 610, 611, 612, 674, 675, 676, 670, 673, 734, 737,
+    738, 798, 801, 802, 796, 797, 860, 861, 862, 924, 925, 926,
+    922, 923, 1114, 1115, 1116, 1178, 1179, 1180, 1176, 1177, 1240, 1241,
+    1242, 1304, 1305, 1306, 1302, 1303, 1366, 1367, 1368, 1430, 1431, 1432,
+    1428, 1429, 1492, 1493, 1494, 1556, 1557, 1558, 1554, 1555, 1618, 1619,
+    1620, 1682, 1683, 1684, 1678, 1681, 1742, 1745, 1746, 1806, 1809, 1810,
+    1804, 1805, 1868, 1869, 1870, 1932, 1933, 1934, 1930, 1931, 2122, 2123,
+    2124, 2186, 2187, 2188, 2184, 2185, 2248, 2249, 2250, 2312, 2313, 2314,
+    2310, 2311, 2374, 2375, 2376, 2438, 2439, 2440, 2436, 2437, 2500, 2501,
+    2502, 2564, 2565, 2566, 2562, 2563, 2626, 2627, 2628, 2690, 2691, 2692,
+    2750, 2689, 2814, 2753, 2754, 2878, 2817, 2818, 3197, 3198, 3261, 3262,
+    3201, 3325, 3326, 3265, 2881, 2882, 2945, 2946, 2947, 3137, 3138, 3139,
+    2755, 2756, 2819, 2820, 2821, 2883, 2884, 2885, 2629, 2630, 2693, 2694,
+    2695, 2757, 2758, 2759, 2503, 2504, 2567, 2568, 2569, 2631, 2632, 2633,
+    2377, 2378, 2441, 2442, 2443, 2505, 2506, 2507, 2251, 2252, 2315, 2316,
+    2317, 2379, 2380, 2381, 2125, 2126, 2189, 2190, 2193, 2253, 2254, 2257,
+    1873, 1874, 1937, 1938, 1939, 2129, 2130, 2131, 1747, 1748, 1811, 1812,
+    1813, 1875, 1876, 1877, 1621, 1622, 1685, 1686, 1687, 1749, 1750, 1751,
+    1495, 1496, 1559, 1560, 1561, 1623, 1624, 1625, 1369, 1370, 1433, 1434,
+    1435, 1497, 1498, 1499, 1243, 1244, 1307, 1308, 1309, 1371, 1372, 1373,
+    1117, 1118, 1181, 1182, 1185, 1245, 1246, 1249, 865, 866, 929, 930,
+    931, 1121, 1122, 1123, 739, 740, 803, 804, 805, 867, 868, 869,
+    613, 614, 677, 678, 679, 741, 742, 743, 487, 488, 551, 552,
+    553, 615, 616, 617, 361, 362, 425, 426, 427, 489, 490, 491,
+    235, 236, 299, 300, 301, 363, 364, 365, 109, 110, 173, 174,
+    177, 237, 238, 241, 3953, 3954, 4017, 4018, 4019, 113, 114, 115,
+    4020, 4021, 116, 117, 118, 180, 181, 182, 178, 179, 242, 243,
+    244, 306, 307, 308, 302, 305, 366, 369, 370, 430, 433, 434,
+    428, 429, 492, 493, 494, 556, 557, 558, 554, 555, 618, 619,
+    620, 682, 683, 684, 680, 681, 744, 745, 746, 808, 809, 810,
+    806, 807, 870, 871, 872, 934, 935, 936, 932, 933, 1124, 1125,
+    1126, 1188, 1189, 1190, 1186, 1187, 1250, 1251, 1252, 1314, 1315, 1316,
+    1310, 1313, 1374, 1377, 1378, 1438, 1441, 1442, 1436, 1437, 1500, 1501,
+    1502, 1564, 1565, 1566, 1562, 1563, 1626, 1627, 1628, 1690, 1691, 1692,
+    1688, 1689, 1752, 1753, 1754, 1816, 1817, 1818, 1814, 1815, 1878, 1879,
+    1880, 1942, 1943, 1944, 1940, 1941, 2132, 2133, 2134, 2196, 2197, 2198,
+    2194, 2195, 2258, 2259, 2260, 2322, 2323, 2324, 2318, 2321, 2382, 2385,
+    2386, 2446, 2449, 2450, 2444, 2445, 2508, 2509, 2510, 2572, 2573, 2574,
+    2570, 2571, 2634, 2635, 2636, 2698, 2699, 2700, 2696, 2697, 2760, 2761,
+    2762, 2824, 2825, 2826, 2822, 2823, 2886, 2887, 2888, 2950, 2951, 2952,
+    2948, 2949, 3140, 3141, 3142, 3204, 3205, 3206, 3202, 3203, 3266, 3267,
+    3268, 3330, 3331, 3332, 3390, 3329, 3454, 3393, 3394, 3518, 3457, 3458,
+    3709, 3710, 3773, 3774, 3713, 3837, 3838, 3777, 3521, 3522, 3585, 3586,
+    3587, 3649, 3650, 3651, 3395, 3396, 3459, 3460, 3461, 3523, 3524, 3525,
+    3269, 3270, 3333, 3334, 3335, 3397, 3398, 3399, 3143, 3144, 3207, 3208,
+    3209, 3271, 3272, 3273, 2889, 2890, 2953, 2954, 2955, 3145, 3146, 3147,
+    2763, 2764, 2827, 2828, 2829, 2891, 2892, 2893, 2637, 2638, 2701, 2702,
+    2705, 2765, 2766, 2769, 2513, 2514, 2577, 2578, 2579, 2641, 2642, 2643,
+    2387, 2388, 2451, 2452, 2453, 2515, 2516, 2517, 2261, 2262, 2325, 2326,
+    2327, 2389, 2390, 2391, 2135, 2136, 2199, 2200, 2201, 2263, 2264, 2265,
+    1881, 1882, 1945, 1946, 1947, 2137, 2138, 2139, 1755, 1756, 1819, 1820,
+    1821, 1883, 1884, 1885, 1629, 1630, 1693, 1694, 1697, 1757, 1758, 1761,
+    1505, 1506, 1569, 1570, 1571, 1633, 1634, 1635, 1379, 1380, 1443, 1444,
+    1445, 1507, 1508, 1509, 1253, 1254, 1317, 1318, 1319, 1381, 1382, 1383,
+    1127, 1128, 1191, 1192, 1193, 1255, 1256, 1257, 873, 874, 937, 938,
+    939, 1129, 1130, 1131, 747, 748, 811, 812, 813, 875, 876, 877,
+    621, 622, 685, 686, 689, 749, 750, 753, 497, 498, 561, 562,
+    563, 625, 626, 627, 371, 372, 435, 436, 437, 499, 500, 501,
+    245, 246, 309, 310, 311, 373, 374, 375, 119, 120, 183, 184,
+    185, 247, 248, 249, 3961, 3962, 4025, 4026, 4027, 121, 122, 123,
+    4028, 4029, 124, 125, 126, 188, 189, 190, 186, 187, 250, 251,
+    252, 314, 315, 316, 312, 313, 376, 377, 378, 440, 441, 442,
+    438, 439, 502, 503, 504, 566, 567, 568, 564, 565, 628, 629,
+    630, 692, 693, 694, 690, 691, 754, 755, 756, 818, 819, 820,
+    814, 817, 878, 881, 882, 942, 945, 946, 940, 941, 1132, 1133,
+    1134, 1196, 1197, 1198, 1194, 1195, 1258, 1259, 1260, 1322, 1323, 1324,
+    1320, 1321, 1384, 1385, 1386, 1448, 1449, 1450, 1446, 1447, 1510, 1511,
+    1512, 1574, 1575, 1576, 1572, 1573, 1636, 1637, 1638, 1700, 1701, 1702,
+    1698, 1699, 1762, 1763, 1764, 1826, 1827, 1828, 1822, 1825, 1886, 1889,
+    1890, 1950, 1953, 1954, 1948, 1949, 2140, 2141, 2142, 2204, 2205, 2206,
+    2202, 2203, 2266, 2267, 2268, 2330, 2331, 2332, 2328, 2329, 2392, 2393,
+    2394, 2456, 2457, 2458, 2454, 2455, 2518, 2519, 2520, 2582, 2583, 2584,
+    2580, 2581, 2644, 2645, 2646, 2708, 2709, 2710, 2706, 2707, 2770, 2771,
+    2772, 2834, 2835, 2836, 2830, 2833, 2894, 2897, 2898, 2958, 2961, 2962,
+    2956, 2957, 3148, 3149, 3150, 3212, 3213, 3214, 3210, 3211, 3274, 3275,
+    3276, 3338, 3339, 3340, 3336, 3337, 3400, 3401, 3402, 3464, 3465, 3466,
+    3462, 3463, 3526, 3527, 3528, 3590, 3591, 3592, 3588, 3589, 3652, 3653,
+    3654, 3716, 3717, 3718, 3714, 3715, 3778, 3779, 3780, 3842, 3843, 3844,
+    3902, 3841, 3966, 3905, 3906, 4030, 3969, 3970, 3781, 3782, 3845, 3846,
+    3847, 3909, 3910, 3911, 3655, 3656, 3719, 3720, 3721, 3783, 3784, 3785,
+    3529, 3530, 3593, 3594, 3595, 3657, 3658, 3659, 3403, 3404, 3467, 3468,
+    3469, 3531, 3532, 3533, 3277, 3278, 3341, 3342, 3345, 3405, 3406, 3409,
+    3153, 3154, 3217, 3218, 3219, 3281, 3282, 3283, 2899, 2900, 2963, 2964,
+    2965, 3155, 3156, 3157, 2773, 2774, 2837, 2838, 2839, 2901, 2902, 2903,
+    2647, 2648, 2711, 2712, 2713, 2775, 2776, 2777, 2521, 2522, 2585, 2586,
+    2587, 2649, 2650, 2651, 2395, 2396, 2459, 2460, 2461, 2523, 2524, 2525,
+    2269, 2270, 2333, 2334, 2337, 2397, 2398, 2401, 2145, 2146, 2209, 2210,
+    2211, 2273, 2274, 2275, 1891, 1892, 1955, 1956, 1957, 2147, 2148, 2149,
+    1765, 1766, 1829, 1830, 1831, 1893, 1894, 1895, 1639, 1640, 1703, 1704,
+    1705, 1767, 1768, 1769, 1513, 1514, 1577, 1578, 1579, 1641, 1642, 1643,
+    1387, 1388, 1451, 1452, 1453, 1515, 1516, 1517, 1261, 1262, 1325, 1326,
+    1329, 1389, 1390, 1393, 1137, 1138, 1201, 1202, 1203, 1265, 1266, 1267,
+    883, 884, 947, 948, 949, 1139, 1140, 1141, 757, 758, 821, 822,
+    823, 885, 886, 887, 631, 632, 695, 696, 697, 759, 760, 761,
+    505, 506, 569, 570, 571, 633, 634, 635, 379, 380, 443, 444,
+    445, 507, 508, 509, 572, 573, 636, 637, 638, 700, 701, 702,
+    698, 699, 762, 763, 764, 826, 827, 828, 824, 825, 888, 889,
+    890, 952, 953, 954, 950, 951, 1142, 1143, 1144, 1206, 1207, 1208,
+    1204, 1205, 1268, 1269, 1270, 1332, 1333, 1334, 1330, 1331, 1394, 1395,
+    1396, 1458, 1459, 1460, 1454, 1457, 1518, 1521, 1522, 1582, 1585, 1586,
+    1580, 1581, 1644, 1645, 1646, 1708, 1709, 1710, 1706, 1707, 1770, 1771,
+    1772, 1834, 1835, 1836, 1832, 1833, 1896, 1897, 1898, 1960, 1961, 1962,
+    1958, 1959, 2150, 2151, 2152, 2214, 2215, 2216, 2212, 2213, 2276, 2277,
+    2278, 2340, 2341, 2342, 2338, 2339, 2402, 2403, 2404, 2466, 2467, 2468,
+    2462, 2465, 2526, 2529, 2530, 2590, 2593, 2594, 2588, 2589, 2652, 2653,
+    2654, 2716, 2717, 2718, 2714, 2715, 2778, 2779, 2780, 2842, 2843, 2844,
+    2840, 2841, 2904, 2905, 2906, 2968, 2969, 2970, 2966, 2967, 3158, 3159,
+    3160, 3222, 3223, 3224, 3220, 3221, 3284, 3285, 3286, 3348, 3349, 3350,
+    3346, 3347, 3410, 3411, 3412, 3474, 3475, 3476, 3470, 3473, 3534, 3537,
+    3538, 3598, 3601, 3602, 3596, 3597, 3660, 3661, 3662, 3724, 3725, 3726,
+    3722, 3723, 3786, 3787, 3788, 3850, 3851, 3852, 3848, 3849, 3912, 3913,
+    3914, 3976, 3977, 3978, 3789, 3790, 3853, 3854, 3857, 3917, 3918, 3921,
+    3665, 3666, 3729, 3730, 3731, 3793, 3794, 3795, 3539, 3540, 3603, 3604,
+    3605, 3667, 3668, 3669, 3413, 3414, 3477, 3478, 3479, 3541, 3542, 3543,
+    3287, 3288, 3351, 3352, 3353, 3415, 3416, 3417, 3161, 3162, 3225, 3226,
+    3227, 3289, 3290, 3291, 2907, 2908, 2971, 2972, 2973, 3163, 3164, 3165,
+    2781, 2782, 2845, 2846, 2849, 2909, 2910, 2913, 2657, 2658, 2721, 2722,
+    2723, 2785, 2786, 2787, 2531, 2532, 2595, 2596, 2597, 2659, 2660, 2661,
+    2405, 2406, 2469, 2470, 2471, 2533, 2534, 2535, 2279, 2280, 2343, 2344,
+    2345, 2407, 2408, 2409, 2153, 2154, 2217, 2218, 2219, 2281, 2282, 2283,
+    1899, 1900, 1963, 1964, 1965, 2155, 2156, 2157, 1773, 1774, 1837, 1838,
+    1841, 1901, 1902, 1905, 1649, 1650, 1713, 1714, 1715, 1777, 1778, 1779,
+    1523, 1524, 1587, 1588, 1589, 1651, 1652, 1653, 1397, 1398, 1461, 1462,
+    1463, 1525, 1526, 1527, 1271, 1272, 1335, 1336, 1337, 1399, 1400, 1401,
+    1145, 1146, 1209, 1210, 1211, 1273, 1274, 1275, 891, 892, 955, 956,
+    957, 1147, 1148, 1149, 1212, 1213, 1276, 1277, 1278, 1340, 1341, 1342,
+    1338, 1339, 1402, 1403, 1404, 1466, 1467, 1468, 1464, 1465, 1528, 1529,
+    1530, 1592, 1593, 1594, 1590, 1591, 1654, 1655, 1656, 1718, 1719, 1720,
+    1716, 1717, 1780, 1781, 1782, 1844, 1845, 1846, 1842, 1843, 1906, 1907,
+    1908, 1970, 1971, 1972, 1966, 1969, 2158, 2161, 2162, 2222, 2225, 2226,
+    2220, 2221, 2284, 2285, 2286, 2348, 2349, 2350, 2346, 2347, 2410, 2411,
+    2412, 2474, 2475, 2476, 2472, 2473, 2536, 2537, 2538, 2600, 2601, 2602,
+    2598, 2599, 2662, 2663, 2664, 2726, 2727, 2728, 2724, 2725, 2788, 2789,
+    2790, 2852, 2853, 2854, 2850, 2851, 2914, 2915, 2916, 2978, 2979, 2980,
+    2974, 2977, 3166, 3169, 3170, 3230, 3233, 3234, 3228, 3229, 3292, 3293,
+    3294, 3356, 3357, 3358, 3354, 3355, 3418, 3419, 3420, 3482, 3483, 3484,
+    3480, 3481, 3544, 3545, 3546, 3608, 3609, 3610, 3606, 3607, 3670, 3671,
+    3672, 3734, 3735, 3736, 3732, 3733, 3796, 3797, 3798, 3860, 3861, 3862,
+    3858, 3859, 3922, 3923, 3924, 3986, 3987, 3988, 3799, 3800, 3863, 3864,
+    3865, 3927, 3928, 3929, 3673, 3674, 3737, 3738, 3739, 3801, 3802, 3803,
+    3547, 3548, 3611, 3612, 3613, 3675, 3676, 3677, 3421, 3422, 3485, 3486,
+    3489, 3549, 3550, 3553, 3297, 3298, 3361, 3362, 3363, 3425, 3426, 3427,
+    3171, 3172, 3235, 3236, 3237, 3299, 3300, 3301, 2917, 2918, 2981, 2982,
+    2983, 3173, 3174, 3175, 2791, 2792, 2855, 2856, 2857, 2919, 2920, 2921,
+    2665, 2666, 2729, 2730, 2731, 2793, 2794, 2795, 2539, 2540, 2603, 2604,
+    2605, 2667, 2668, 2669, 2413, 2414, 2477, 2478, 2481, 2541, 2542, 2545,
+    2289, 2290, 2353, 2354, 2355, 2417, 2418, 2419, 2163, 2164, 2227, 2228,
+    2229, 2291, 2292, 2293, 1909, 1910, 1973, 1974, 1975, 2165, 2166, 2167,
+    1783, 1784, 1847, 1848, 1849, 1911, 1912, 1913, 1657, 1658, 1721, 1722,
+    1723, 1785, 1786, 1787, 1531, 1532, 1595, 1596, 1597, 1659, 1660, 1661,
+    1724, 1725, 1788, 1789, 1790, 1852, 1853, 1854, 1850, 1851, 1914, 1915,
+    1916, 1978, 1979, 1980, 1976, 1977, 2168, 2169, 2170, 2232, 2233, 2234,
+    2230, 2231, 2294, 2295, 2296, 2358, 2359, 2360, 2356, 2357, 2420, 2421,
+    2422, 2484, 2485, 2486, 2482, 2483, 2546, 2547, 2548, 2610, 2611, 2612,
+    2606, 2609, 2670, 2673, 2674, 2734, 2737, 2738, 2732, 2733, 2796, 2797,
+    2798, 2860, 2861, 2862, 2858, 2859, 2922, 2923, 2924, 2986, 2987, 2988,
+    2984, 2985, 3176, 3177, 3178, 3240, 3241, 3242, 3238, 3239, 3302, 3303,
+    3304, 3366, 3367, 3368, 3364, 3365, 3428, 3429, 3430, 3492, 3493, 3494,
+    3490, 3491, 3554, 3555, 3556, 3618, 3619, 3620, 3614, 3617, 3678, 3681,
+    3682, 3742, 3745, 3746, 3740, 3741, 3804, 3805, 3806, 3868, 3869, 3870,
+    3866, 3867, 3930, 3931, 3932, 3994, 3995, 3996, 3809, 3810, 3873, 3874,
+    3875, 3937, 3938, 3939, 3683, 3684, 3747, 3748, 3749, 3811, 3812, 3813,
+    3557, 3558, 3621, 3622, 3623, 3685, 3686, 3687, 3431, 3432, 3495, 3496,
+    3497, 3559, 3560, 3561, 3305, 3306, 3369, 3370, 3371, 3433, 3434, 3435,
+    3179, 3180, 3243, 3244, 3245, 3307, 3308, 3309, 2925, 2926, 2989, 2990,
+    2993, 3181, 3182, 3185, 2801, 2802, 2865, 2866, 2867, 2929, 2930, 2931,
+    2675, 2676, 2739, 2740, 2741, 2803, 2804, 2805, 2549, 2550, 2613, 2614,
+    2615, 2677, 2678, 2679, 2423, 2424, 2487, 2488, 2489, 2551, 2552, 2553,
+    2297, 2298, 2361, 2362, 2363, 2425, 2426, 2427, 2171, 2172, 2235, 2236,
+    2237, 2299, 2300, 2301, 2364, 2365, 2428, 2429, 2430, 2492, 2493, 2494,
+    2490, 2491, 2554, 2555, 2556, 2618, 2619, 2620, 2616, 2617, 2680, 2681,
+    2682, 2744, 2745, 2746, 2742, 2743, 2806, 2807, 2808, 2870, 2871, 2872,
+    2868, 2869, 2932, 2933, 2934, 2996, 2997, 2998, 2994, 2995, 3186, 3187,
+    3188, 3250, 3251, 3252, 3246, 3249, 3310, 3313, 3314, 3374, 3377, 3378,
+    3372, 3373, 3436, 3437, 3438, 3500, 3501, 3502, 3498, 3499, 3562, 3563,
+    3564, 3626, 3627, 3628, 3624, 3625, 3688, 3689, 3690, 3752, 3753, 3754,
+    3750, 3751, 3814, 3815, 3816, 3878, 3879, 3880, 3876, 3877, 3940, 3941,
+    3942, 4004, 4005, 4006, 3817, 3818, 3881, 3882, 3883, 3945, 3946, 3947,
+    3691, 3692, 3755, 3756, 3757, 3819, 3820, 3821, 3565, 3566, 3629, 3630,
+    3633, 3693, 3694, 3697, 3441, 3442, 3505, 3506, 3507, 3569, 3570, 3571,
+    3315, 3316, 3379, 3380, 3381, 3443, 3444, 3445, 3189, 3190, 3253, 3254,
+    3255, 3317, 3318, 3319, 2935, 2936, 2999, 3000, 3001, 3191, 3192, 3193,
+    2809, 2810, 2873, 2874, 2875, 2937, 2938, 2939, 2683, 2684, 2747, 2748,
+    2749, 2811, 2812, 2813, 2876, 2877, 2940, 2941, 2942, 3004, 3005, 3006,
+    3002, 3003, 3194, 3195, 3196, 3258, 3259, 3260, 3256, 3257, 3320, 3321,
+    3322, 3384, 3385, 3386, 3382, 3383, 3446, 3447, 3448, 3510, 3511, 3512,
+    3508, 3509, 3572, 3573, 3574, 3636, 3637, 3638, 3634, 3635, 3698, 3699,
+    3700, 3762, 3763, 3764, 3758, 3761, 3822, 3825, 3826, 3886, 3889, 3890,
+    3884, 3885, 3948, 3949, 3950, 4012, 4013, 4014, 3827, 3828, 3891, 3892,
+    3893, 3955, 3956, 3957, 3701, 3702, 3765, 3766, 3767, 3829, 3830, 3831,
+    3575, 3576, 3639, 3640, 3641, 3703, 3704, 3705, 3449, 3450, 3513, 3514,
+    3515, 3577, 3578, 3579, 3323, 3324, 3387, 3388, 3389, 3451, 3452, 3453,
+    3516, 3517, 3580, 3581, 3582, 3644, 3645, 3646, 3642, 3643, 3706, 3707,
+    3708, 3770, 3771, 3772, 3768, 3769, 3832, 3833, 3834, 3896, 3897, 3898,
+    3894, 3895, 3958, 3959, 3960, 4022, 4023, 4024, 3835, 3836, 3899, 3900,
+    3901, 3963, 3964, 3965,
+};
+
+static const uint16_t bits_16[4096] = {
+    285, 286, 357, 358, 289, 429, 430, 361, 73, 74, 145, 146,
+    147, 217, 218, 219, 4971, 4972, 5043, 5044, 5045, 75, 76, 77,
+    5046, 5047, 78, 79, 80, 150, 151, 152, 148, 149, 220, 221,
+    222, 292, 293, 294, 290, 291, 362, 363, 364, 434, 435, 436,
+    502, 433, 574, 505, 506, 646, 577, 578, 861, 862, 933, 934,
+    865, 1005, 1006, 937, 649, 650, 721, 722, 723, 793, 794, 795,
+    507, 508, 579, 580, 581, 651, 652, 653, 365, 366, 437, 438,
+    439, 509, 510, 511, 223, 224, 295, 296, 297, 367, 368, 369,
+    81, 82, 153, 154, 155, 225, 226, 227, 4979, 4980, 5051, 5052,
+    5053, 83, 84, 85, 5054, 5055, 86, 87, 88, 158, 159, 160,
+    156, 157, 228, 229, 230, 300, 301, 302, 298, 299, 370, 371,
+    372, 442, 443, 444, 440, 441, 512, 513, 514, 584, 585, 586,
+    582, 583, 654, 655, 656, 726, 727, 728, 724, 725, 796, 797,
+    798, 868, 869, 870, 866, 867, 938, 939, 940, 1010, 1011, 1012,
+    1078, 1009, 1150, 1081, 1082, 1222, 1153, 1154, 1581, 1582, 1653, 1654,
+    1585, 1725, 1726, 1657, 1369, 1370, 1441, 1442, 1443, 1513, 1514, 1515,
+    1083, 1084, 1155, 1156, 1157, 1371, 1372, 1373, 941, 942, 1013, 1014,
+    1015, 1085, 1086, 1087, 799, 800, 871, 872, 873, 943, 944, 945,
+    657, 658, 729, 730, 731, 801, 802, 803, 515, 516, 587, 588,
+    589, 659, 660, 661, 373, 374, 445, 446, 447, 517, 518, 519,
+    231, 232, 303, 304, 307, 375, 376, 379, 91, 92, 163, 164,
+    165, 235, 236, 237, 4989, 4990, 5061, 5062, 5063, 93, 94, 95,
+    5064, 5065, 96, 97, 98, 168, 169, 170, 166, 167, 238, 239,
+    240, 310, 311, 312, 308, 309, 380, 381, 382, 452, 453, 454,
+    448, 451, 520, 523, 524, 592, 595, 596, 590, 591, 662, 663,
+    664, 734, 735, 736, 732, 733, 804, 805, 806, 876, 877, 878,
+    874, 875, 946, 947, 948, 1018, 1019, 1020, 1016, 1017, 1088, 1089,
+    1090, 1160, 1161, 1162, 1158, 1159, 1374, 1375, 1376, 1446, 1447, 1448,
+    1444, 1445, 1516, 1517, 1518, 1588, 1589, 1590, 1586, 1587, 1658, 1659,
+    1660, 1730, 1731, 1732, 1798, 1729, 1870, 1801, 1802, 1942, 1873, 1874,
+    2157, 2158, 2229, 2230, 2161, 2301, 2302, 2233, 1945, 1946, 2017, 2018,
+    2019, 2089, 2090, 2091, 1803, 1804, 1875, 1876, 1877, 1947, 1948, 1949,
+    1661, 1662, 1733, 1734, 1735, 1805, 1806, 1807, 1519, 1520, 1591, 1592,
+    1593, 1663, 1664, 1665, 1377, 1378, 1449, 1450, 1451, 1521, 1522, 1523,
+    1091, 1092, 1163, 1164, 1165, 1379, 1380, 1381, 949, 950, 1021, 1022,
+    1023, 1093, 1094, 1095, 807, 808, 879, 880, 883, 951, 952, 955,
+    667, 668, 739, 740, 741, 811, 812, 813, 525, 526, 597, 598,
+    599, 669, 670, 671, 383, 384, 455, 456, 457, 527, 528, 529,
+    241, 242, 313, 314, 315, 385, 386, 387, 99, 100, 171, 172,
+    173, 243, 244, 245, 4997, 4998, 5069, 5070, 5071, 101, 102, 103,
+    5072, 5073, 104, 105, 106, 176, 177, 178, 174, 175, 246, 247,
+    248, 318, 319, 320, 316, 317, 388, 389, 390, 460, 461, 462,
+    458, 459, 530, 531, 532, 602, 603, 604, 600, 601, 672, 673,
+    674, 744, 745, 746, 742, 743, 814, 815, 816, 886, 887, 888,
+    884, 885, 956, 957, 958, 1028, 1029, 1030, 1024, 1027, 1096, 1099,
+    1100, 1168, 1171, 1172, 1166, 1167, 1382, 1383, 1384, 1454, 1455, 1456,
+    1452, 1453, 1524, 1525, 1526, 1596, 1597, 1598, 1594, 1595, 1666, 1667,
+    1668, 1738, 1739, 1740, 1736, 1737, 1808, 1809, 1810, 1880, 1881, 1882,
+    1878, 1879, 1950, 1951, 1952, 2022, 2023, 2024, 2020, 2021, 2092, 2093,
+    2094, 2164, 2165, 2166, 2162, 2163, 2234, 2235, 2236, 2306, 2307, 2308,
+    2374, 2305, 2446, 2377, 2378, 2518, 2449, 2450, 2877, 2878, 2949, 2950,
+    2881, 3021, 3022, 2953, 2665, 2666, 2737, 2738, 2739, 2809, 2810, 2811,
+    2379, 2380, 2451, 2452, 2453, 2667, 2668, 2669, 2237, 2238, 2309, 2310,
+    2311, 2381, 2382, 2383, 2095, 2096, 2167, 2168, 2169, 2239, 2240, 2241,
+    1953, 1954, 2025, 2026, 2027, 2097, 2098, 2099, 1811, 1812, 1883, 1884,
+    1885, 1955, 1956, 1957, 1669, 1670, 1741, 1742, 1743, 1813, 1814, 1815,
+    1527, 1528, 1599, 1600, 1603, 1671, 1672, 1675, 1387, 1388, 1459, 1460,
+    1461, 1531, 1532, 1533, 1101, 1102, 1173, 1174, 1175, 1389, 1390, 1391,
+    959, 960, 1031, 1032, 1033, 1103, 1104, 1105, 817, 818, 889, 890,
+    891, 961, 962, 963, 675, 676, 747, 748, 749, 819, 820, 821,
+    533, 534, 605, 606, 607, 677, 678, 679, 391, 392, 463, 464,
+    465, 535, 536, 537, 249, 250, 321, 322, 325, 393, 394, 397,
+    109, 110, 181, 182, 183, 253, 254, 255, 5007, 5008, 5079, 5080,
+    5081, 111, 112, 113, 5082, 5083, 114, 115, 116, 186, 187, 188,
+    184, 185, 256, 257, 258, 328, 329, 330, 326, 327, 398, 399,
+    400, 470, 471, 472, 466, 469, 538, 541, 542, 610, 613, 614,
+    608, 609, 680, 681, 682, 752, 753, 754, 750, 751, 822, 823,
+    824, 894, 895, 896, 892, 893, 964, 965, 966, 1036, 1037, 1038,
+    1034, 1035, 1106, 1107, 1108, 1178, 1179, 1180, 1176, 1177, 1392, 1393,
+    1394, 1464, 1465, 1466, 1462, 1463, 1534, 1535, 1536, 1606, 1607, 1608,
+    1604, 1605, 1676, 1677, 1678, 1748, 1749, 1750, 1744, 1747, 1816, 1819,
+    1820, 1888, 1891, 1892, 1886, 1887, 1958, 1959, 1960, 2030, 2031, 2032,
+    2028, 2029, 2100, 2101, 2102, 2172, 2173, 2174, 2170, 2171, 2242, 2243,
+    2244, 2314, 2315, 2316, 2312, 2313, 2384, 2385, 2386, 2456, 2457, 2458,
+    2454, 2455, 2670, 2671, 2672, 2742, 2743, 2744, 2740, 2741, 2812, 2813,
+    2814, 2884, 2885, 2886, 2882, 2883, 2954, 2955, 2956, 3026, 3027, 3028,
+    3094, 3025, 3166, 3097, 3098, 3238, 3169, 3170, 3453, 3454, 3525, 3526,
+    3457, 3597, 3598, 3529, 3241, 3242, 3313, 3314, 3315, 3385, 3386, 3387,
+    3099, 3100, 3171, 3172, 3173, 3243, 3244, 3245, 2957, 2958, 3029, 3030,
+    3031, 3101, 3102, 3103, 2815, 2816, 2887, 2888, 2889, 2959, 2960, 2961,
+    2673, 2674, 2745, 2746, 2747, 2817, 2818, 2819, 2387, 2388, 2459, 2460,
+    2461, 2675, 2676, 2677, 2245, 2246, 2317, 2318, 2319, 2389, 2390, 2391,
+    2103, 2104, 2175, 2176, 2179, 2247, 2248, 2251, 1963, 1964, 2035, 2036,
+    2037, 2107, 2108, 2109, 1821, 1822, 1893, 1894, 1895, 1965, 1966, 1967,
+    1679, 1680, 1751, 1752, 1753, 1823, 1824, 1825, 1537, 1538, 1609, 1610,
+    1611, 1681, 1682, 1683, 1395, 1396, 1467, 1468, 1469, 1539, 1540, 1541,
+    1109, 1110, 1181, 1182, 1183, 1397, 1398, 1399, 967, 968, 1039, 1040,
+    1041, 1111, 1112, 1113, 825, 826, 897, 898, 901, 969, 970, 973,
+    685, 686, 757, 758, 759, 829, 830, 831, 543, 544, 615, 616,
+    617, 687, 688, 689, 401, 402, 473, 474, 475, 545, 546, 547,
+    259, 260, 331, 332, 333, 403, 404, 405, 117, 118, 189, 190,
+    191, 261, 262, 263, 5015, 5016, 5087, 5088, 5089, 119, 120, 121,
+    5090, 5091, 122, 123, 124, 194, 195, 196, 192, 193, 264, 265,
+    266, 336, 337, 338, 334, 335, 406, 407, 408, 478, 479, 480,
+    476, 477, 548, 549, 550, 620, 621, 622, 618, 619, 690, 691,
+    692, 762, 763, 764, 760, 761, 832, 833, 834, 904, 905, 906,
+    902, 903, 974, 975, 976, 1046, 1047, 1048, 1042, 1045, 1114, 1117,
+    1118, 1186, 1189, 1190, 1184, 1185, 1400, 1401, 1402, 1472, 1473, 1474,
+    1470, 1471, 1542, 1543, 1544, 1614, 1615, 1616, 1612, 1613, 1684, 1685,
+    1686, 1756, 1757, 1758, 1754, 1755, 1826, 1827, 1828, 1898, 1899, 1900,
+    1896, 1897, 1968, 1969, 1970, 2040, 2041, 2042, 2038, 2039, 2110, 2111,
+    2112, 2182, 2183, 2184, 2180, 2181, 2252, 2253, 2254, 2324, 2325, 2326,
+    2320, 2323, 2392, 2395, 2396, 2464, 2467, 2468, 2462, 2463, 2678, 2679,
+    2680, 2750, 2751, 2752, 2748, 2749, 2820, 2821, 2822, 2892, 2893, 2894,
+    2890, 2891, 2962, 2963, 2964, 3034, 3035, 3036, 3032, 3033, 3104, 3105,
+    3106, 3176, 3177, 3178, 3174, 3175, 3246, 3247, 3248, 3318, 3319, 3320,
+    3316, 3317, 3388, 3389, 3390, 3460, 3461, 3462, 3458, 3459, 3530, 3531,
+    3532, 3602, 3603, 3604, 3670, 3601, 3742, 3673, 3674, 3814, 3745, 3746,
+    4173, 4174, 4245, 4246, 4177, 4317, 4318, 4249, 3961, 3962, 4033, 4034,
+    4035, 4105, 4106, 4107, 3675, 3676, 3747, 3748, 3749, 3963, 3964, 3965,
+    3533, 3534, 3605, 3606, 3607, 3677, 3678, 3679, 3391, 3392, 3463, 3464,
+    3465, 3535, 3536, 3537, 3249, 3250, 3321, 3322, 3323, 3393, 3394, 3395,
+    3107, 3108, 3179, 3180, 3181, 3251, 3252, 3253, 2965, 2966, 3037, 3038,
+    3039, 3109, 3110, 3111, 2823, 2824, 2895, 2896, 2899, 2967, 2968, 2971,
+    2683, 2684, 2755, 2756, 2757, 2827, 2828, 2829, 2397, 2398, 2469, 2470,
+    2471, 2685, 2686, 2687, 2255, 2256, 2327, 2328, 2329, 2399, 2400, 2401,
+    2113, 2114, 2185, 2186, 2187, 2257, 2258, 2259, 1971, 1972, 2043, 2044,
+    2045, 2115, 2116, 2117, 1829, 1830, 1901, 1902, 1903, 1973, 1974, 1975,
+    1687, 1688, 1759, 1760, 1761, 1831, 1832, 1833, 1545, 1546, 1617, 1618,
+    1621, 1689, 1690, 1693, 1405, 1406, 1477, 1478, 1479, 1549, 1550, 1551,
+    1119, 1120, 1191, 1192, 1193, 1407, 1408, 1409, 977, 978, 1049, 1050,
+    1051, 1121, 1122, 1123, 835, 836, 907, 908, 909, 979, 980, 981,
+    693, 694, 765, 766, 767, 837, 838, 839, 551, 552, 623, 624,
+    625, 695, 696, 697, 409, 410, 481, 482, 483, 553, 554, 555,
+    267, 268, 339, 340, 343, 411, 412, 415, 127, 128, 199, 200,
+    201, 271, 272, 273, 5025, 5026, 5097, 5098, 5099, 129, 130, 131,
+    5100, 5101, 132, 133, 134, 204, 205, 206, 202, 203, 274, 275,
+    276, 346, 347, 348, 344, 345, 416, 417, 418, 488, 489, 490,
+    484, 487, 556, 559, 560, 628, 631, 632, 626, 627, 698, 699,
+    700, 770, 771, 772, 768, 769, 840, 841, 842, 912, 913, 914,
+    910, 911, 982, 983, 984, 1054, 1055, 1056, 1052, 1053, 1124, 1125,
+    1126, 1196, 1197, 1198, 1194, 1195, 1410, 1411, 1412, 1482, 1483, 1484,
+    1480, 1481, 1552, 1553, 1554, 1624, 1625, 1626, 1622, 1623, 1694, 1695,
+    1696, 1766, 1767, 1768, 1762, 1765, 1834, 1837, 1838, 1906, 1909, 1910,
+    1904, 1905, 1976, 1977, 1978, 2048, 2049, 2050, 2046, 2047, 2118, 2119,
+    2120, 2190, 2191, 2192, 2188, 2189, 2260, 2261, 2262, 2332, 2333, 2334,
+    2330, 2331, 2402, 2403, 2404, 2474, 2475, 2476, 2472, 2473, 2688, 2689,
+    2690, 2760, 2761, 2762, 2758, 2759, 2830, 2831, 2832, 2902, 2903, 2904,
+    2900, 2901, 2972, 2973, 2974, 3044, 3045, 3046, 3040, 3043, 3112, 3115,
+    3116, 3184, 3187, 3188, 3182, 3183, 3254, 3255, 3256, 3326, 3327, 3328,
+    3324, 3325, 3396, 3397, 3398, 3468, 3469, 3470, 3466, 3467, 3538, 3539,
+    3540, 3610, 3611, 3612, 3608, 3609, 3680, 3681, 3682, 3752, 3753, 3754,
+    3750, 3751, 3966, 3967, 3968, 4038, 4039, 4040, 4036, 4037, 4108, 4109,
+    4110, 4180, 4181, 4182, 4178, 4179, 4250, 4251, 4252, 4322, 4323, 4324,
+    4390, 4321, 4462, 4393, 4394, 4534, 4465, 4466, 4749, 4750, 4821, 4822,
+    4753, 4893, 4894, 4825, 4537, 4538, 4609, 4610, 4611, 4681, 4682, 4683,
+    4395, 4396, 4467, 4468, 4469, 4539, 4540, 4541, 4253, 4254, 4325, 4326,
+    4327, 4397, 4398, 4399, 4111, 4112, 4183, 4184, 4185, 4255, 4256, 4257,
+    3969, 3970, 4041, 4042, 4043, 4113, 4114, 4115, 3683, 3684, 3755, 3756,
+    3757, 3971, 3972, 3973, 3541, 3542, 3613, 3614, 3615, 3685, 3686, 3687,
+    3399, 3400, 3471, 3472, 3475, 3543, 3544, 3547, 3259, 3260, 3331, 3332,
+    3333, 3403, 3404, 3405, 3117, 3118, 3189, 3190, 3191, 3261, 3262, 3263,
+    2975, 2976, 3047, 3048, 3049, 3119, 3120, 3121, 2833, 2834, 2905, 2906,
+    2907, 2977, 2978, 2979, 2691, 2692, 2763, 2764, 2765, 2835, 2836, 2837,
+    2405, 2406, 2477, 2478, 2479, 2693, 2694, 2695, 2263, 2264, 2335, 2336,
+    2337, 2407, 2408, 2409, 2121, 2122, 2193, 2194, 2197, 2265, 2266, 2269,
+    1981, 1982, 2053, 2054, 2055, 2125, 2126, 2127, 1839, 1840, 1911, 1912,
+    1913, 1983, 1984, 1985, 1697, 1698, 1769, 1770, 1771, 1841, 1842, 1843,
+    1555, 1556, 1627, 1628, 1629, 1699, 1700, 1701, 1413, 1414, 1485, 1486,
+    1487, 1557, 1558, 1559, 1127, 1128, 1199, 1200, 1201, 1415, 1416, 1417,
+    985, 986, 1057, 1058, 1059, 1129, 1130, 1131, 843, 844, 915, 916,
+    919, 987, 988, 991, 703, 704, 775, 776, 777, 847, 848, 849,
+    561, 562, 633, 634, 635, 705, 706, 707, 419, 420, 491, 492,
+    493, 563, 564, 565, 277, 278, 349, 350, 351, 421, 422, 423,
+    135, 136, 207, 208, 209, 279, 280, 281, 5033, 5034, 5105, 5106,
+    5107, 137, 138, 139, 5108, 5109, 140, 141, 142, 212, 213, 214,
+    210, 211, 282, 283, 284, 354, 355, 356, 352, 353, 424, 425,
+    426, 496, 497, 498, 494, 495, 566, 567, 568, 638, 639, 640,
+    636, 637, 708, 709, 710, 780, 781, 782, 778, 779, 850, 851,
+    852, 922, 923, 924, 920, 921, 992, 993, 994, 1064, 1065, 1066,
+    1060, 1063, 1132, 1135, 1136, 1204, 1207, 1208, 1202, 1203, 1418, 1419,
+    1420, 1490, 1491, 1492, 1488, 1489, 1560, 1561, 1562, 1632, 1633, 1634,
+    1630, 1631, 1702, 1703, 1704, 1774, 1775, 1776, 1772, 1773, 1844, 1845,
+    1846, 1916, 1917, 1918, 1914, 1915, 1986, 1987, 1988, 2058, 2059, 2060,
+    2056, 2057, 2128, 2129, 2130, 2200, 2201, 2202, 2198, 2199, 2270, 2271,
+    2272, 2342, 2343, 2344, 2338, 2341, 2410, 2413, 2414, 2482, 2485, 2486,
+    2480, 2481, 2696, 2697, 2698, 2768, 2769, 2770, 2766, 2767, 2838, 2839,
+    2840, 2910, 2911, 2912, 2908, 2909, 2980, 2981, 2982, 3052, 3053, 3054,
+    3050, 3051, 3122, 3123, 3124, 3194, 3195, 3196, 3192, 3193, 3264, 3265,
+    3266, 3336, 3337, 3338, 3334, 3335, 3406, 3407, 3408, 3478, 3479, 3480,
+    3476, 3477, 3548, 3549, 3550, 3620, 3621, 3622, 3616, 3619, 3688, 3691,
+    3692, 3760, 3763, 3764, 3758, 3759, 3974, 3975, 3976, 4046, 4047, 4048,
+    4044, 4045, 4116, 4117, 4118, 4188, 4189, 4190, 4186, 4187, 4258, 4259,
+    4260, 4330, 4331, 4332, 4328, 4329, 4400, 4401, 4402, 4472, 4473, 4474,
+    4470, 4471, 4542, 4543, 4544, 4614, 4615, 4616, 4612, 4613, 4684, 4685,
+    4686, 4756, 4757, 4758, 4754, 4755, 4826, 4827, 4828, 4898, 4899, 4900,
+    4966, 4897, 5038, 4969, 4970, 5110, 5041, 5042, 4829, 4830, 4901, 4902,
+    4903, 4973, 4974, 4975, 4687, 4688, 4759, 4760, 4761, 4831, 4832, 4833,
+    4545, 4546, 4617, 4618, 4619, 4689, 4690, 4691, 4403, 4404, 4475, 4476,
+    4477, 4547, 4548, 4549, 4261, 4262, 4333, 4334, 4335, 4405, 4406, 4407,
+    4119, 4120, 4191, 4192, 4195, 4263, 4264, 4267, 3979, 3980, 4051, 4052,
+    4053, 4123, 4124, 4125, 3693, 3694, 3765, 3766, 3767, 3981, 3982, 3983,
+    3551, 3552, 3623, 3624, 3625, 3695, 3696, 3697, 3409, 3410, 3481, 3482,
+    3483, 3553, 3554, 3555, 3267, 3268, 3339, 3340, 3341, 3411, 3412, 3413,
+    3125, 3126, 3197, 3198, 3199, 3269, 3270, 3271, 2983, 2984, 3055, 3056,
+    3057, 3127, 3128, 3129, 2841, 2842, 2913, 2914, 2917, 2985, 2986, 2989,
+    2701, 2702, 2773, 2774, 2775, 2845, 2846, 2847, 2415, 2416, 2487, 2488,
+    2489, 2703, 2704, 2705, 2273, 2274, 2345, 2346, 2347, 2417, 2418, 2419,
+    2131, 2132, 2203, 2204, 2205, 2275, 2276, 2277, 1989, 1990, 2061, 2062,
+    2063, 2133, 2134, 2135, 1847, 1848, 1919, 1920, 1921, 1991, 1992, 1993,
+    1705, 1706, 1777, 1778, 1779, 1849, 1850, 1851, 1563, 1564, 1635, 1636,
+    1639, 1707, 1708, 1711, 1423, 1424, 1495, 1496, 1497, 1567, 1568, 1569,
+    1137, 1138, 1209, 1210, 1211, 1425, 1426, 1427, 995, 996, 1067, 1068,
+    1069, 1139, 1140, 1141, 853, 854, 925, 926, 927, 997, 998, 999,
+    711, 712, 783, 784, 785, 855, 856, 857, 569, 570, 641, 642,
+    643, 713, 714, 715, 427, 428, 499, 500, 501, 571, 572, 573,
+    644, 645, 716, 717, 718, 788, 789, 790, 786, 787, 858, 859,
+    860, 930, 931, 932, 928, 929, 1000, 1001, 1002, 1072, 1073, 1074,
+    1070, 1071, 1142, 1143, 1144, 1214, 1215, 1216, 1212, 1213, 1428, 1429,
+    1430, 1500, 1501, 1502, 1498, 1499, 1570, 1571, 1572, 1642, 1643, 1644,
+    1640, 1641, 1712, 1713, 1714, 1784, 1785, 1786, 1780, 1783, 1852, 1855,
+    1856, 1924, 1927, 1928, 1922, 1923, 1994, 1995, 1996, 2066, 2067, 2068,
+    2064, 2065, 2136, 2137, 2138, 2208, 2209, 2210, 2206, 2207, 2278, 2279,
+    2280, 2350, 2351, 2352, 2348, 2349, 2420, 2421, 2422, 2492, 2493, 2494,
+    2490, 2491, 2706, 2707, 2708, 2778, 2779, 2780, 2776, 2777, 2848, 2849,
+    2850, 2920, 2921, 2922, 2918, 2919, 2990, 2991, 2992, 3062, 3063, 3064,
+    3058, 3061, 3130, 3133, 3134, 3202, 3205, 3206, 3200, 3201, 3272, 3273,
+    3274, 3344, 3345, 3346, 3342, 3343, 3414, 3415, 3416, 3486, 3487, 3488,
+    3484, 3485, 3556, 3557, 3558, 3628, 3629, 3630, 3626, 3627, 3698, 3699,
+    3700, 3770, 3771, 3772, 3768, 3769, 3984, 3985, 3986, 4056, 4057, 4058,
+    4054, 4055, 4126, 4127, 4128, 4198, 4199, 4200, 4196, 4197, 4268, 4269,
+    4270, 4340, 4341, 4342, 4336, 4339, 4408, 4411, 4412, 4480, 4483, 4484,
+    4478, 4479, 4550, 4551, 4552, 4622, 4623, 4624, 4620, 4621, 4692, 4693,
+    4694, 4764, 4765, 4766, 4762, 4763, 4834, 4835, 4836, 4906, 4907, 4908,
+    4904, 4905, 4976, 4977, 4978, 5048, 5049, 5050, 4837, 4838, 4909, 4910,
+    4911, 4981, 4982, 4983, 4695, 4696, 4767, 4768, 4771, 4839, 4840, 4843,
+    4555, 4556, 4627, 4628, 4629, 4699, 4700, 4701, 4413, 4414, 4485, 4486,
+    4487, 4557, 4558, 4559, 4271, 4272, 4343, 4344, 4345, 4415, 4416, 4417,
+    4129, 4130, 4201, 4202, 4203, 4273, 4274, 4275, 3987, 3988, 4059, 4060,
+    4061, 4131, 4132, 4133, 3701, 3702, 3773, 3774, 3775, 3989, 3990, 3991,
+    3559, 3560, 3631, 3632, 3633, 3703, 3704, 3705, 3417, 3418, 3489, 3490,
+    3493, 3561, 3562, 3565, 3277, 3278, 3349, 3350, 3351, 3421, 3422, 3423,
+    3135, 3136, 3207, 3208, 3209, 3279, 3280, 3281, 2993, 2994, 3065, 3066,
+    3067, 3137, 3138, 3139, 2851, 2852, 2923, 2924, 2925, 2995, 2996, 2997,
+    2709, 2710, 2781, 2782, 2783, 2853, 2854, 2855, 2423, 2424, 2495, 2496,
+    2497, 2711, 2712, 2713, 2281, 2282, 2353, 2354, 2355, 2425, 2426, 2427,
+    2139, 2140, 2211, 2212, 2215, 2283, 2284, 2287, 1999, 2000, 2071, 2072,
+    2073, 2143, 2144, 2145, 1857, 1858, 1929, 1930, 1931, 2001, 2002, 2003,
+    1715, 1716, 1787, 1788, 1789, 1859, 1860, 1861, 1573, 1574, 1645, 1646,
+    1647, 1717, 1718, 1719, 1431, 1432, 1503, 1504, 1505, 1575, 1576, 1577,
+    1145, 1146, 1217, 1218, 1219, 1433, 1434, 1435, 1003, 1004, 1075, 1076,
+    1077, 1147, 1148, 1149, 1220, 1221, 1436, 1437, 1438, 1508, 1509, 1510,
+    1506, 1507, 1578, 1579, 1580, 1650, 1651, 1652, 1648, 1649, 1720, 1721,
+    1722, 1792, 1793, 1794, 1790, 1791, 1862, 1863, 1864, 1934, 1935, 1936,
+    1932, 1933, 2004, 2005, 2006, 2076, 2077, 2078, 2074, 2075, 2146, 2147,
+    2148, 2218, 2219, 2220, 2216, 2217, 2288, 2289, 2290, 2360, 2361, 2362,
+    2356, 2359, 2428, 2431, 2432, 2500, 2503, 2504, 2498, 2499, 2714, 2715,
+    2716, 2786, 2787, 2788, 2784, 2785, 2856, 2857, 2858, 2928, 2929, 2930,
+    2926, 2927, 2998, 2999, 3000, 3070, 3071, 3072, 3068, 3069, 3140, 3141,
+    3142, 3212, 3213, 3214, 3210, 3211, 3282, 3283, 3284, 3354, 3355, 3356,
+    3352, 3353, 3424, 3425, 3426, 3496, 3497, 3498, 3494, 3495, 3566, 3567,
+    3568, 3638, 3639, 3640, 3634, 3637, 3706, 3709, 3710, 3778, 3781, 3782,
+    3776, 3777, 3992, 3993, 3994, 4064, 4065, 4066, 4062, 4063, 4134, 4135,
+    4136, 4206, 4207, 4208, 4204, 4205, 4276, 4277, 4278, 4348, 4349, 4350,
+    4346, 4347, 4418, 4419, 4420, 4490, 4491, 4492, 4488, 4489, 4560, 4561,
+    4562, 4632, 4633, 4634, 4630, 4631, 4702, 4703, 4704, 4774, 4775, 4776,
+    4772, 4773, 4844, 4845, 4846, 4916, 4917, 4918, 4912, 4915, 4984, 4987,
+    4988, 5056, 5059, 5060, 4847, 4848, 4919, 4920, 4921, 4991, 4992, 4993,
+    4705, 4706, 4777, 4778, 4779, 4849, 4850, 4851, 4563, 4564, 4635, 4636,
+    4637, 4707, 4708, 4709, 4421, 4422, 4493, 4494, 4495, 4565, 4566, 4567,
+    4279, 4280, 4351, 4352, 4353, 4423, 4424, 4425, 4137, 4138, 4209, 4210,
+    4213, 4281, 4282, 4285, 3997, 3998, 4069, 4070, 4071, 4141, 4142, 4143,
+    3711, 3712, 3783, 3784, 3785, 3999, 4000, 4001, 3569, 3570, 3641, 3642,
+    3643, 3713, 3714, 3715, 3427, 3428, 3499, 3500, 3501, 3571, 3572, 3573,
+    3285, 3286, 3357, 3358, 3359, 3429, 3430, 3431, 3143, 3144, 3215, 3216,
+    3217, 3287, 3288, 3289, 3001, 3002, 3073, 3074, 3075, 3145, 3146, 3147,
+    2859, 2860, 2931, 2932, 2935, 3003, 3004, 3007, 2719, 2720, 2791, 2792,
+    2793, 2863, 2864, 2865, 2433, 2434, 2505, 2506, 2507, 2721, 2722, 2723,
+    2291, 2292, 2363, 2364, 2365, 2435, 2436, 2437, 2149, 2150, 2221, 2222,
+    2223, 2293, 2294, 2295, 2007, 2008, 2079, 2080, 2081, 2151, 2152, 2153,
+    1865, 1866, 1937, 1938, 1939, 2009, 2010, 2011, 1723, 1724, 1795, 1796,
+    1797, 1867, 1868, 1869, 1940, 1941, 2012, 2013, 2014, 2084, 2085, 2086,
+    2082, 2083, 2154, 2155, 2156, 2226, 2227, 2228, 2224, 2225, 2296, 2297,
+    2298, 2368, 2369, 2370, 2366, 2367, 2438, 2439, 2440, 2510, 2511, 2512,
+    2508, 2509, 2724, 2725, 2726, 2796, 2797, 2798, 2794, 2795, 2866, 2867,
+    2868, 2938, 2939, 2940, 2936, 2937, 3008, 3009, 3010, 3080, 3081, 3082,
+    3076, 3079, 3148, 3151, 3152, 3220, 3223, 3224, 3218, 3219, 3290, 3291,
+    3292, 3362, 3363, 3364, 3360, 3361, 3432, 3433, 3434, 3504, 3505, 3506,
+    3502, 3503, 3574, 3575, 3576, 3646, 3647, 3648, 3644, 3645, 3716, 3717,
+    3718, 3788, 3789, 3790, 3786, 3787, 4002, 4003, 4004, 4074, 4075, 4076,
+    4072, 4073, 4144, 4145, 4146, 4216, 4217, 4218, 4214, 4215, 4286, 4287,
+    4288, 4358, 4359, 4360, 4354, 4357, 4426, 4429, 4430, 4498, 4501, 4502,
+    4496, 4497, 4568, 4569, 4570, 4640, 4641, 4642, 4638, 4639, 4710, 4711,
+    4712, 4782, 4783, 4784, 4780, 4781, 4852, 4853, 4854, 4924, 4925, 4926,
+    4922, 4923, 4994, 4995, 4996, 5066, 5067, 5068, 4855, 4856, 4927, 4928,
+    4929, 4999, 5000, 5001, 4713, 4714, 4785, 4786, 4789, 4857, 4858, 4861,
+    4573, 4574, 4645, 4646, 4647, 4717, 4718, 4719, 4431, 4432, 4503, 4504,
+    4505, 4575, 4576, 4577, 4289, 4290, 4361, 4362, 4363, 4433, 4434, 4435,
+    4147, 4148, 4219, 4220, 4221, 4291, 4292, 4293, 4005, 4006, 4077, 4078,
+    4079, 4149, 4150, 4151, 3719, 3720, 3791, 3792, 3793, 4007, 4008, 4009,
+    3577, 3578, 3649, 3650, 3651, 3721, 3722, 3723, 3435, 3436, 3507, 3508,
+    3511, 3579, 3580, 3583, 3295, 3296, 3367, 3368, 3369, 3439, 3440, 3441,
+    3153, 3154, 3225, 3226, 3227, 3297, 3298, 3299, 3011, 3012, 3083, 3084,
+    3085, 3155, 3156, 3157, 2869, 2870, 2941, 2942, 2943, 3013, 3014, 3015,
+    2727, 2728, 2799, 2800, 2801, 2871, 2872, 2873, 2441, 2442, 2513, 2514,
+    2515, 2729, 2730, 2731, 2299, 2300, 2371, 2372, 2373, 2443, 2444, 2445,
+    2516, 2517, 2732, 2733, 2734, 2804, 2805, 2806, 2802, 2803, 2874, 2875,
+    2876, 2946, 2947, 2948, 2944, 2945, 3016, 3017, 3018, 3088, 3089, 3090,
+    3086, 3087, 3158, 3159, 3160, 3230, 3231, 3232, 3228, 3229, 3300, 3301,
+    3302, 3372, 3373, 3374, 3370, 3371, 3442, 3443, 3444, 3514, 3515, 3516,
+    3512, 3513, 3584, 3585, 3586, 3656, 3657, 3658, 3652, 3655, 3724, 3727,
+    3728, 3796, 3799, 3800, 3794, 3795, 4010, 4011, 4012, 4082, 4083, 4084,
+    4080, 4081, 4152, 4153, 4154, 4224, 4225, 4226, 4222, 4223, 4294, 4295,
+    4296, 4366, 4367, 4368, 4364, 4365, 4436, 4437, 4438, 4508, 4509, 4510,
+    4506, 4507, 4578, 4579, 4580, 4650, 4651, 4652, 4648, 4649, 4720, 4721,
+    4722, 4792, 4793, 4794, 4790, 4791, 4862, 4863, 4864, 4934, 4935, 4936,
+    4930, 4933, 5002, 5005, 5006, 5074, 5077, 5078, 4865, 4866, 4937, 4938,
+    4939, 5009, 5010, 5011, 4723, 4724, 4795, 4796, 4797, 4867, 4868, 4869,
+    4581, 4582, 4653, 4654, 4655, 4725, 4726, 4727, 4439, 4440, 4511, 4512,
+    4513, 4583, 4584, 4585, 4297, 4298, 4369, 4370, 4371, 4441, 4442, 4443,
+    4155, 4156, 4227, 4228, 4231, 4299, 4300, 4303, 4015, 4016, 4087, 4088,
+    4089, 4159, 4160, 4161, 3729, 3730, 3801, 3802, 3803, 4017, 4018, 4019,
+    3587, 3588, 3659, 3660, 3661, 3731, 3732, 3733, 3445, 3446, 3517, 3518,
+    3519, 3589, 3590, 3591, 3303, 3304, 3375, 3376, 3377, 3447, 3448, 3449,
+    3161, 3162, 3233, 3234, 3235, 3305, 3306, 3307, 3019, 3020, 3091, 3092,
+    3093, 3163, 3164, 3165, 3236, 3237, 3308, 3309, 3310, 3380, 3381, 3382,
+    3378, 3379, 3450, 3451, 3452, 3522, 3523, 3524, 3520, 3521, 3592, 3593,
+    3594, 3664, 3665, 3666, 3662, 3663, 3734, 3735, 3736, 3806, 3807, 3808,
+    3804, 3805, 4020, 4021, 4022, 4092, 4093, 4094, 4090, 4091, 4162, 4163,
+    4164, 4234, 4235, 4236, 4232, 4233, 4304, 4305, 4306, 4376, 4377, 4378,
+    4372, 4375, 4444, 4447, 4448, 4516, 4519, 4520, 4514, 4515, 4586, 4587,
+    4588, 4658, 4659, 4660, 4656, 4657, 4728, 4729, 4730, 4800, 4801, 4802,
+    4798, 4799, 4870, 4871, 4872, 4942, 4943, 4944, 4940, 4941, 5012, 5013,
+    5014, 5084, 5085, 5086, 4873, 4874, 4945, 4946, 4947, 5017, 5018, 5019,
+    4731, 4732, 4803, 4804, 4807, 4875, 4876, 4879, 4591, 4592, 4663, 4664,
+    4665, 4735, 4736, 4737, 4449, 4450, 4521, 4522, 4523, 4593, 4594, 4595,
+    4307, 4308, 4379, 4380, 4381, 4451, 4452, 4453, 4165, 4166, 4237, 4238,
+    4239, 4309, 4310, 4311, 4023, 4024, 4095, 4096, 4097, 4167, 4168, 4169,
+    3737, 3738, 3809, 3810, 3811, 4025, 4026, 4027, 3595, 3596, 3667, 3668,
+    3669, 3739, 3740, 3741, 3812, 3813, 4028, 4029, 4030, 4100, 4101, 4102,
+    4098, 4099, 4170, 4171, 4172, 4242, 4243, 4244, 4240, 4241, 4312, 4313,
+    4314, 4384, 4385, 4386, 4382, 4383, 4454, 4455, 4456, 4526, 4527, 4528,
+    4524, 4525, 4596, 4597, 4598, 4668, 4669, 4670, 4666, 4667, 4738, 4739,
+    4740, 4810, 4811, 4812, 4808, 4809, 4880, 4881, 4882, 4952, 4953, 4954,
+    4948, 4951, 5020, 5023, 5024, 5092, 5095, 5096, 4883, 4884, 4955, 4956,
+    4957, 5027, 5028, 5029, 4741, 4742, 4813, 4814, 4815, 4885, 4886, 4887,
+    4599, 4600, 4671, 4672, 4673, 4743, 4744, 4745, 4457, 4458, 4529, 4530,
+    4531, 4601, 4602, 4603, 4315, 4316, 4387, 4388, 4389, 4459, 4460, 4461,
+    4532, 4533, 4604, 4605, 4606, 4676, 4677, 4678, 4674, 4675, 4746, 4747,
+    4748, 4818, 4819, 4820, 4816, 4817, 4888, 4889, 4890, 4960, 4961, 4962,
+    4958, 4959, 5030, 5031, 5032, 5102, 5103, 5104, 4891, 4892, 4963, 4964,
+    4965, 5035, 5036, 5037,
+};
+
+static const uint16_t bits_17[5184] = {
+    317, 318, 397, 398, 321, 477, 478, 401, 81, 82, 161, 162,
+    163, 241, 242, 243, 6163, 6164, 6243, 6244, 6245, 83, 84, 85,
+    6246, 6247, 86, 87, 88, 166, 167, 168, 164, 165, 244, 245,
+    246, 324, 325, 326, 322, 323, 402, 403, 404, 482, 483, 484,
+    558, 481, 638, 561, 562, 718, 641, 642, 957, 958, 1037, 1038,
+    961, 1117, 1118, 1041, 721, 722, 801, 802, 803, 881, 882, 883,
+    563, 564, 643, 644, 645, 723, 724, 725, 405, 406, 485, 486,
+    487, 565, 566, 567, 247, 248, 327, 328, 329, 407, 408, 409,
+    89, 90, 169, 170, 171, 249, 250, 251, 6171, 6172, 6251, 6252,
+    6253, 91, 92, 93, 6254, 6255, 94, 95, 96, 174, 175, 176,
+    172, 173, 252, 253, 254, 332, 333, 334, 330, 331, 410, 411,
+    412, 490, 491, 492, 488, 489, 568, 569, 570, 648, 649, 650,
+    646, 647, 726, 727, 728, 806, 807, 808, 804, 805, 884, 885,
+    886, 964, 965, 966, 962, 963, 1042, 1043, 1044, 1122, 1123, 1124,
+    1198, 1121, 1278, 1201, 1202, 1358, 1281, 1282, 1757, 1758, 1837, 1838,
+    1761, 1917, 1918, 1841, 1361, 1362, 1441, 1442, 1443, 1681, 1682, 1683,
+    1203, 1204, 1283, 1284, 1285, 1363, 1364, 1365, 1045, 1046, 1125, 1126,
+    1127, 1205, 1206, 1207, 887, 888, 967, 968, 969, 1047, 1048, 1049,
+    729, 730, 809, 810, 811, 889, 890, 891, 571, 572, 651, 652,
+    653, 731, 732, 733, 413, 414, 493, 494, 495, 573, 574, 575,
+    255, 256, 335, 336, 337, 415, 416, 417, 97, 98, 177, 178,
+    181, 257, 258, 261, 6181, 6182, 6261, 6262, 6263, 101, 102, 103,
+    6264, 6265, 104, 105, 106, 184, 185, 186, 182, 183, 262, 263,
+    264, 342, 343, 344, 338, 341, 418, 421, 422, 498, 501, 502,
+    496, 497, 576, 577, 578, 656, 657, 658, 654, 655, 734, 735,
+    736, 814, 815, 816, 812, 813, 892, 893, 894, 972, 973, 974,
+    970, 971, 1050, 1051, 1052, 1130, 1131, 1132, 1128, 1129, 1208, 1209,
+    1210, 1288, 1289, 1290, 1286, 1287, 1366, 1367, 1368, 1446, 1447, 1448,
+    1444, 1445, 1684, 1685, 1686, 1764, 1765, 1766, 1762, 1763, 1842, 1843,
+    1844, 1922, 1923, 1924, 1998, 1921, 2078, 2001, 2002, 2158, 2081, 2082,
+    2397, 2398, 2477, 2478, 2401, 2557, 2558, 2481, 2161, 2162, 2241, 2242,
+    2243, 2321, 2322, 2323, 2003, 2004, 2083, 2084, 2085, 2163, 2164, 2165,
+    1845, 1846, 1925, 1926, 1927, 2005, 2006, 2007, 1687, 1688, 1767, 1768,
+    1769, 1847, 1848, 1849, 1369, 1370, 1449, 1450, 1451, 1689, 1690, 1691,
+    1211, 1212, 1291, 1292, 1293, 1371, 1372, 1373, 1053, 1054, 1133, 1134,
+    1135, 1213, 1214, 1215, 895, 896, 975, 976, 977, 1055, 1056, 1057,
+    737, 738, 817, 818, 821, 897, 898, 901, 581, 582, 661, 662,
+    663, 741, 742, 743, 423, 424, 503, 504, 505, 583, 584, 585,
+    265, 266, 345, 346, 347, 425, 426, 427, 107, 108, 187, 188,
+    189, 267, 268, 269, 6189, 6190, 6269, 6270, 6271, 109, 110, 111,
+    6272, 6273, 112, 113, 114, 192, 193, 194, 190, 191, 270, 271,
+    272, 350, 351, 352, 348, 349, 428, 429, 430, 508, 509, 510,
+    506, 507, 586, 587, 588, 666, 667, 668, 664, 665, 744, 745,
+    746, 824, 825, 826, 822, 823, 902, 903, 904, 982, 983, 984,
+    978, 981, 1058, 1061, 1062, 1138, 1141, 1142, 1136, 1137, 1216, 1217,
+    1218, 1296, 1297, 1298, 1294, 1295, 1374, 1375, 1376, 1454, 1455, 1456,
+    1452, 1453, 1692, 1693, 1694, 1772, 1773, 1774, 1770, 1771, 1850, 1851,
+    1852, 1930, 1931, 1932, 1928, 1929, 2008, 2009, 2010, 2088, 2089, 2090,
+    2086, 2087, 2166, 2167, 2168, 2246, 2247, 2248, 2244, 2245, 2324, 2325,
+    2326, 2404, 2405, 2406, 2402, 2403, 2482, 2483, 2484, 2562, 2563, 2564,
+    2638, 2561, 2718, 2641, 2642, 2798, 2721, 2722, 3037, 3038, 3117, 3118,
+    3041, 3357, 3358, 3281, 2801, 2802, 2881, 2882, 2883, 2961, 2962, 2963,
+    2643, 2644, 2723, 2724, 2725, 2803, 2804, 2805, 2485, 2486, 2565, 2566,
+    2567, 2645, 2646, 2647, 2327, 2328, 2407, 2408, 2409, 2487, 2488, 2489,
+    2169, 2170, 2249, 2250, 2251, 2329, 2330, 2331, 2011, 2012, 2091, 2092,
+    2093, 2171, 2172, 2173, 1853, 1854, 1933, 1934, 1935, 2013, 2014, 2015,
+    1695, 1696, 1775, 1776, 1777, 1855, 1856, 1857, 1377, 1378, 1457, 1458,
+    1461, 1697, 1698, 1701, 1221, 1222, 1301, 1302, 1303, 1381, 1382, 1383,
+    1063, 1064, 1143, 1144, 1145, 1223, 1224, 1225, 905, 906, 985, 986,
+    987, 1065, 1066, 1067, 747, 748, 827, 828, 829, 907, 908, 909,
+    589, 590, 669, 670, 671, 749, 750, 751, 431, 432, 511, 512,
+    513, 591, 592, 593, 273, 274, 353, 354, 355, 433, 434, 435,
+    115, 116, 195, 196, 197, 275, 276, 277, 6197, 6198, 6277, 6278,
+    6281, 117, 118, 121, 6282, 6283, 122, 123, 124, 202, 203, 204,
+    198, 201, 278, 281, 282, 358, 361, 362, 356, 357, 436, 437,
+    438, 516, 517, 518, 514, 515, 594, 595, 596, 674, 675, 676,
+    672, 673, 752, 753, 754, 832, 833, 834, 830, 831, 910, 911,
+    912, 990, 991, 992, 988, 989, 1068, 1069, 1070, 1148, 1149, 1150,
+    1146, 1147, 1226, 1227, 1228, 1306, 1307, 1308, 1304, 1305, 1384, 1385,
+    1386, 1464, 1465, 1466, 1462, 1463, 1702, 1703, 1704, 1782, 1783, 1784,
+    1778, 1781, 1858, 1861, 1862, 1938, 1941, 1942, 1936, 1937, 2016, 2017,
+    2018, 2096, 2097, 2098, 2094, 2095, 2174, 2175, 2176, 2254, 2255, 2256,
+    2252, 2253, 2332, 2333, 2334, 2412, 2413, 2414, 2410, 2411, 2490, 2491,
+    2492, 2570, 2571, 2572, 2568, 2569, 2648, 2649, 2650, 2728, 2729, 2730,
+    2726, 2727, 2806, 2807, 2808, 2886, 2887, 2888, 2884, 2885, 2964, 2965,
+    2966, 3044, 3045, 3046, 3042, 3043, 3282, 3283, 3284, 3362, 3363, 3364,
+    3438, 3361, 3518, 3441, 3442, 3598, 3521, 3522, 3837, 3838, 3917, 3918,
+    3841, 3997, 3998, 3921, 3601, 3602, 3681, 3682, 3683, 3761, 3762, 3763,
+    3443, 3444, 3523, 3524, 3525, 3603, 3604, 3605, 3285, 3286, 3365, 3366,
+    3367, 3445, 3446, 3447, 2967, 2968, 3047, 3048, 3049, 3287, 3288, 3289,
+    2809, 2810, 2889, 2890, 2891, 2969, 2970, 2971, 2651, 2652, 2731, 2732,
+    2733, 2811, 2812, 2813, 2493, 2494, 2573, 2574, 2575, 2653, 2654, 2655,
+    2335, 2336, 2415, 2416, 2417, 2495, 2496, 2497, 2177, 2178, 2257, 2258,
+    2261, 2337, 2338, 2341, 2021, 2022, 2101, 2102, 2103, 2181, 2182, 2183,
+    1863, 1864, 1943, 1944, 1945, 2023, 2024, 2025, 1705, 1706, 1785, 1786,
+    1787, 1865, 1866, 1867, 1387, 1388, 1467, 1468, 1469, 1707, 1708, 1709,
+    1229, 1230, 1309, 1310, 1311, 1389, 1390, 1391, 1071, 1072, 1151, 1152,
+    1153, 1231, 1232, 1233, 913, 914, 993, 994, 995, 1073, 1074, 1075,
+    755, 756, 835, 836, 837, 915, 916, 917, 597, 598, 677, 678,
+    681, 757, 758, 761, 441, 442, 521, 522, 523, 601, 602, 603,
+    283, 284, 363, 364, 365, 443, 444, 445, 125, 126, 205, 206,
+    207, 285, 286, 287, 6207, 6208, 6287, 6288, 6289, 127, 128, 129,
+    6290, 6291, 130, 131, 132, 210, 211, 212, 208, 209, 288, 289,
+    290, 368, 369, 370, 366, 367, 446, 447, 448, 526, 527, 528,
+    524, 525, 604, 605, 606, 684, 685, 686, 682, 683, 762, 763,
+    764, 842, 843, 844, 838, 841, 918, 921, 922, 998, 1001, 1002,
+    996, 997, 1076, 1077, 1078, 1156, 1157, 1158, 1154, 1155, 1234, 1235,
+    1236, 1314, 1315, 1316, 1312, 1313, 1392, 1393, 1394, 1472, 1473, 1474,
+    1470, 1471, 1710, 1711, 1712, 1790, 1791, 1792, 1788, 1789, 1868, 1869,
+    1870, 1948, 1949, 1950, 1946, 1947, 2026, 2027, 2028, 2106, 2107, 2108,
+    2104, 2105, 2184, 2185, 2186, 2264, 2265, 2266, 2262, 2263, 2342, 2343,
+    2344, 2422, 2423, 2424, 2418, 2421, 2498, 2501, 2502, 2578, 2581, 2582,
+    2576, 2577, 2656, 2657, 2658, 2736, 2737, 2738, 2734, 2735, 2814, 2815,
+    2816, 2894, 2895, 2896, 2892, 2893, 2972, 2973, 2974, 3052, 3053, 3054,
+    3050, 3051, 3290, 3291, 3292, 3370, 3371, 3372, 3368, 3369, 3448, 3449,
+    3450, 3528, 3529, 3530, 3526, 3527, 3606, 3607, 3608, 3686, 3687, 3688,
+    3684, 3685, 3764, 3765, 3766, 3844, 3845, 3846, 3842, 3843, 3922, 3923,
+    3924, 4002, 4003, 4004, 4078, 4001, 4158, 4081, 4082, 4238, 4161, 4162,
+    4477, 4478, 4557, 4558, 4481, 4637, 4638, 4561, 4241, 4242, 4321, 4322,
+    4323, 4401, 4402, 4403, 4083, 4084, 4163, 4164, 4165, 4243, 4244, 4245,
+    3925, 3926, 4005, 4006, 4007, 4085, 4086, 4087, 3767, 3768, 3847, 3848,
+    3849, 3927, 3928, 3929, 3609, 3610, 3689, 3690, 3691, 3769, 3770, 3771,
+    3451, 3452, 3531, 3532, 3533, 3611, 3612, 3613, 3293, 3294, 3373, 3374,
+    3375, 3453, 3454, 3455, 2975, 2976, 3055, 3056, 3057, 3295, 3296, 3297,
+    2817, 2818, 2897, 2898, 2901, 2977, 2978, 2981, 2661, 2662, 2741, 2742,
+    2743, 2821, 2822, 2823, 2503, 2504, 2583, 2584, 2585, 2663, 2664, 2665,
+    2345, 2346, 2425, 2426, 2427, 2505, 2506, 2507, 2187, 2188, 2267, 2268,
+    2269, 2347, 2348, 2349, 2029, 2030, 2109, 2110, 2111, 2189, 2190, 2191,
+    1871, 1872, 1951, 1952, 1953, 2031, 2032, 2033, 1713, 1714, 1793, 1794,
+    1795, 1873, 1874, 1875, 1395, 1396, 1475, 1476, 1477, 1715, 1716, 1717,
+    1237, 1238, 1317, 1318, 1321, 1397, 1398, 1401, 1081, 1082, 1161, 1162,
+    1163, 1241, 1242, 1243, 923, 924, 1003, 1004, 1005, 1083, 1084, 1085,
+    765, 766, 845, 846, 847, 925, 926, 927, 607, 608, 687, 688,
+    689, 767, 768, 769, 449, 450, 529, 530, 531, 609, 610, 611,
+    291, 292, 371, 372, 373, 451, 452, 453, 133, 134, 213, 214,
+    215, 293, 294, 295, 6215, 6216, 6295, 6296, 6297, 135, 136, 137,
+    6298, 6301, 138, 141, 142, 218, 221, 222, 216, 217, 296, 297,
+    298, 376, 377, 378, 374, 375, 454, 455, 456, 534, 535, 536,
+    532, 533, 612, 613, 614, 692, 693, 694, 690, 691, 770, 771,
+    772, 850, 851, 852, 848, 849, 928, 929, 930, 1008, 1009, 1010,
+    1006, 1007, 1086, 1087, 1088, 1166, 1167, 1168, 1164, 1165, 1244, 1245,
+    1246, 1324, 1325, 1326, 1322, 1323, 1402, 1403, 1404, 1482, 1483, 1484,
+    1478, 1481, 1718, 1721, 1722, 1798, 1801, 1802, 1796, 1797, 1876, 1877,
+    1878, 1956, 1957, 1958, 1954, 1955, 2034, 2035, 2036, 2114, 2115, 2116,
+    2112, 2113, 2192, 2193, 2194, 2272, 2273, 2274, 2270, 2271, 2350, 2351,
+    2352, 2430, 2431, 2432, 2428, 2429, 2508, 2509, 2510, 2588, 2589, 2590,
+    2586, 2587, 2666, 2667, 2668, 2746, 2747, 2748, 2744, 2745, 2824, 2825,
+    2826, 2904, 2905, 2906, 2902, 2903, 2982, 2983, 2984, 3062, 3063, 3064,
+    3058, 3061, 3298, 3301, 3302, 3378, 3381, 3382, 3376, 3377, 3456, 3457,
+    3458, 3536, 3537, 3538, 3534, 3535, 3614, 3615, 3616, 3694, 3695, 3696,
+    3692, 3693, 3772, 3773, 3774, 3852, 3853, 3854, 3850, 3851, 3930, 3931,
+    3932, 4010, 4011, 4012, 4008, 4009, 4088, 4089, 4090, 4168, 4169, 4170,
+    4166, 4167, 4246, 4247, 4248, 4326, 4327, 4328, 4324, 4325, 4404, 4405,
+    4406, 4484, 4485, 4486, 4482, 4483, 4562, 4563, 4564, 4642, 4643, 4644,
+    4718, 4641, 4958, 4881, 4882, 5038, 4961, 4962, 5277, 5278, 5357, 5358,
+    5281, 5437, 5438, 5361, 5041, 5042, 5121, 5122, 5123, 5201, 5202, 5203,
+    4883, 4884, 4963, 4964, 4965, 5043, 5044, 5045, 4565, 4566, 4645, 4646,
+    4647, 4885, 4886, 4887, 4407, 4408, 4487, 4488, 4489, 4567, 4568, 4569,
+    4249, 4250, 4329, 4330, 4331, 4409, 4410, 4411, 4091, 4092, 4171, 4172,
+    4173, 4251, 4252, 4253, 3933, 3934, 4013, 4014, 4015, 4093, 4094, 4095,
+    3775, 3776, 3855, 3856, 3857, 3935, 3936, 3937, 3617, 3618, 3697, 3698,
+    3701, 3777, 3778, 3781, 3461, 3462, 3541, 3542, 3543, 3621, 3622, 3623,
+    3303, 3304, 3383, 3384, 3385, 3463, 3464, 3465, 2985, 2986, 3065, 3066,
+    3067, 3305, 3306, 3307, 2827, 2828, 2907, 2908, 2909, 2987, 2988, 2989,
+    2669, 2670, 2749, 2750, 2751, 2829, 2830, 2831, 2511, 2512, 2591, 2592,
+    2593, 2671, 2672, 2673, 2353, 2354, 2433, 2434, 2435, 2513, 2514, 2515,
+    2195, 2196, 2275, 2276, 2277, 2355, 2356, 2357, 2037, 2038, 2117, 2118,
+    2121, 2197, 2198, 2201, 1881, 1882, 1961, 1962, 1963, 2041, 2042, 2043,
+    1723, 1724, 1803, 1804, 1805, 1883, 1884, 1885, 1405, 1406, 1485, 1486,
+    1487, 1725, 1726, 1727, 1247, 1248, 1327, 1328, 1329, 1407, 1408, 1409,
+    1089, 1090, 1169, 1170, 1171, 1249, 1250, 1251, 931, 932, 1011, 1012,
+    1013, 1091, 1092, 1093, 773, 774, 853, 854, 855, 933, 934, 935,
+    615, 616, 695, 696, 697, 775, 776, 777, 457, 458, 537, 538,
+    541, 617, 618, 621, 301, 302, 381, 382, 383, 461, 462, 463,
+    143, 144, 223, 224, 225, 303, 304, 305, 6225, 6226, 6305, 6306,
+    6307, 145, 146, 147, 6308, 6309, 148, 149, 150, 228, 229, 230,
+    226, 227, 306, 307, 308, 386, 387, 388, 384, 385, 464, 465,
+    466, 544, 545, 546, 542, 543, 622, 623, 624, 702, 703, 704,
+    698, 701, 778, 781, 782, 858, 861, 862, 856, 857, 936, 937,
+    938, 1016, 1017, 1018, 1014, 1015, 1094, 1095, 1096, 1174, 1175, 1176,
+    1172, 1173, 1252, 1253, 1254, 1332, 1333, 1334, 1330, 1331, 1410, 1411,
+    1412, 1490, 1491, 1492, 1488, 1489, 1728, 1729, 1730, 1808, 1809, 1810,
+    1806, 1807, 1886, 1887, 1888, 1966, 1967, 1968, 1964, 1965, 2044, 2045,
+    2046, 2124, 2125, 2126, 2122, 2123, 2202, 2203, 2204, 2282, 2283, 2284,
+    2278, 2281, 2358, 2361, 2362, 2438, 2441, 2442, 2436, 2437, 2516, 2517,
+    2518, 2596, 2597, 2598, 2594, 2595, 2674, 2675, 2676, 2754, 2755, 2756,
+    2752, 2753, 2832, 2833, 2834, 2912, 2913, 2914, 2910, 2911, 2990, 2991,
+    2992, 3070, 3071, 3072, 3068, 3069, 3308, 3309, 3310, 3388, 3389, 3390,
+    3386, 3387, 3466, 3467, 3468, 3546, 3547, 3548, 3544, 3545, 3624, 3625,
+    3626, 3704, 3705, 3706, 3702, 3703, 3782, 3783, 3784, 3862, 3863, 3864,
+    3858, 3861, 3938, 3941, 3942, 4018, 4021, 4022, 4016, 4017, 4096, 4097,
+    4098, 4176, 4177, 4178, 4174, 4175, 4254, 4255, 4256, 4334, 4335, 4336,
+    4332, 4333, 4412, 4413, 4414, 4492, 4493, 4494, 4490, 4491, 4570, 4571,
+    4572, 4650, 4651, 4652, 4648, 4649, 4888, 4889, 4890, 4968, 4969, 4970,
+    4966, 4967, 5046, 5047, 5048, 5126, 5127, 5128, 5124, 5125, 5204, 5205,
+    5206, 5284, 5285, 5286, 5282, 5283, 5362, 5363, 5364, 5442, 5443, 5444,
+    5518, 5441, 5598, 5521, 5522, 5678, 5601, 5602, 5917, 5918, 5997, 5998,
+    5921, 6077, 6078, 6001, 5681, 5682, 5761, 5762, 5763, 5841, 5842, 5843,
+    5523, 5524, 5603, 5604, 5605, 5683, 5684, 5685, 5365, 5366, 5445, 5446,
+    5447, 5525, 5526, 5527, 5207, 5208, 5287, 5288, 5289, 5367, 5368, 5369,
+    5049, 5050, 5129, 5130, 5131, 5209, 5210, 5211, 4891, 4892, 4971, 4972,
+    4973, 5051, 5052, 5053, 4573, 4574, 4653, 4654, 4655, 4893, 4894, 4895,
+    4415, 4416, 4495, 4496, 4497, 4575, 4576, 4577, 4257, 4258, 4337, 4338,
+    4341, 4417, 4418, 4421, 4101, 4102, 4181, 4182, 4183, 4261, 4262, 4263,
+    3943, 3944, 4023, 4024, 4025, 4103, 4104, 4105, 3785, 3786, 3865, 3866,
+    3867, 3945, 3946, 3947, 3627, 3628, 3707, 3708, 3709, 3787, 3788, 3789,
+    3469, 3470, 3549, 3550, 3551, 3629, 3630, 3631, 3311, 3312, 3391, 3392,
+    3393, 3471, 3472, 3473, 2993, 2994, 3073, 3074, 3075, 3313, 3314, 3315,
+    2835, 2836, 2915, 2916, 2917, 2995, 2996, 2997, 2677, 2678, 2757, 2758,
+    2761, 2837, 2838, 2841, 2521, 2522, 2601, 2602, 2603, 2681, 2682, 2683,
+    2363, 2364, 2443, 2444, 2445, 2523, 2524, 2525, 2205, 2206, 2285, 2286,
+    2287, 2365, 2366, 2367, 2047, 2048, 2127, 2128, 2129, 2207, 2208, 2209,
+    1889, 1890, 1969, 1970, 1971, 2049, 2050, 2051, 1731, 1732, 1811, 1812,
+    1813, 1891, 1892, 1893, 1413, 1414, 1493, 1494, 1495, 1733, 1734, 1735,
+    1255, 1256, 1335, 1336, 1337, 1415, 1416, 1417, 1097, 1098, 1177, 1178,
+    1181, 1257, 1258, 1261, 941, 942, 1021, 1022, 1023, 1101, 1102, 1103,
+    783, 784, 863, 864, 865, 943, 944, 945, 625, 626, 705, 706,
+    707, 785, 786, 787, 467, 468, 547, 548, 549, 627, 628, 629,
+    309, 310, 389, 390, 391, 469, 470, 471, 151, 152, 231, 232,
+    233, 311, 312, 313, 6233, 6234, 6313, 6314, 6315, 153, 154, 155,
+    6316, 6317, 156, 157, 158, 236, 237, 238, 234, 235, 314, 315,
+    316, 394, 395, 396, 392, 393, 472, 473, 474, 552, 553, 554,
+    550, 551, 630, 631, 632, 710, 711, 712, 708, 709, 788, 789,
+    790, 868, 869, 870, 866, 867, 946, 947, 948, 1026, 1027, 1028,
+    1024, 1025, 1104, 1105, 1106, 1184, 1185, 1186, 1182, 1183, 1262, 1263,
+    1264, 1342, 1343, 1344, 1338, 1341, 1418, 1421, 1422, 1498, 1501, 1502,
+    1496, 1497, 1736, 1737, 1738, 1816, 1817, 1818, 1814, 1815, 1894, 1895,
+    1896, 1974, 1975, 1976, 1972, 1973, 2052, 2053, 2054, 2132, 2133, 2134,
+    2130, 2131, 2210, 2211, 2212, 2290, 2291, 2292, 2288, 2289, 2368, 2369,
+    2370, 2448, 2449, 2450, 2446, 2447, 2526, 2527, 2528, 2606, 2607, 2608,
+    2604, 2605, 2684, 2685, 2686, 2764, 2765, 2766, 2762, 2763, 2842, 2843,
+    2844, 2922, 2923, 2924, 2918, 2921, 2998, 3001, 3002, 3078, 3081, 3082,
+    3076, 3077, 3316, 3317, 3318, 3396, 3397, 3398, 3394, 3395, 3474, 3475,
+    3476, 3554, 3555, 3556, 3552, 3553, 3632, 3633, 3634, 3712, 3713, 3714,
+    3710, 3711, 3790, 3791, 3792, 3870, 3871, 3872, 3868, 3869, 3948, 3949,
+    3950, 4028, 4029, 4030, 4026, 4027, 4106, 4107, 4108, 4186, 4187, 4188,
+    4184, 4185, 4264, 4265, 4266, 4344, 4345, 4346, 4342, 4343, 4422, 4423,
+    4424, 4502, 4503, 4504, 4498, 4501, 4578, 4581, 4582, 4658, 4661, 4662,
+    4656, 4657, 4896, 4897, 4898, 4976, 4977, 4978, 4974, 4975, 5054, 5055,
+    5056, 5134, 5135, 5136, 5132, 5133, 5212, 5213, 5214, 5292, 5293, 5294,
+    5290, 5291, 5370, 5371, 5372, 5450, 5451, 5452, 5448, 5449, 5528, 5529,
+    5530, 5608, 5609, 5610, 5606, 5607, 5686, 5687, 5688, 5766, 5767, 5768,
+    5764, 5765, 5844, 5845, 5846, 5924, 5925, 5926, 5922, 5923, 6002, 6003,
+    6004, 6082, 6083, 6084, 6158, 6081, 6238, 6161, 6162, 6318, 6241, 6242,
+    6005, 6006, 6085, 6086, 6087, 6165, 6166, 6167, 5847, 5848, 5927, 5928,
+    5929, 6007, 6008, 6009, 5689, 5690, 5769, 5770, 5771, 5849, 5850, 5851,
+    5531, 5532, 5611, 5612, 5613, 5691, 5692, 5693, 5373, 5374, 5453, 5454,
+    5455, 5533, 5534, 5535, 5215, 5216, 5295, 5296, 5297, 5375, 5376, 5377,
+    5057, 5058, 5137, 5138, 5141, 5217, 5218, 5221, 4901, 4902, 4981, 4982,
+    4983, 5061, 5062, 5063, 4583, 4584, 4663, 4664, 4665, 4903, 4904, 4905,
+    4425, 4426, 4505, 4506, 4507, 4585, 4586, 4587, 4267, 4268, 4347, 4348,
+    4349, 4427, 4428, 4429, 4109, 4110, 4189, 4190, 4191, 4269, 4270, 4271,
+    3951, 3952, 4031, 4032, 4033, 4111, 4112, 4113, 3793, 3794, 3873, 3874,
+    3875, 3953, 3954, 3955, 3635, 3636, 3715, 3716, 3717, 3795, 3796, 3797,
+    3477, 3478, 3557, 3558, 3561, 3637, 3638, 3641, 3321, 3322, 3401, 3402,
+    3403, 3481, 3482, 3483, 3003, 3004, 3083, 3084, 3085, 3323, 3324, 3325,
+    2845, 2846, 2925, 2926, 2927, 3005, 3006, 3007, 2687, 2688, 2767, 2768,
+    2769, 2847, 2848, 2849, 2529, 2530, 2609, 2610, 2611, 2689, 2690, 2691,
+    2371, 2372, 2451, 2452, 2453, 2531, 2532, 2533, 2213, 2214, 2293, 2294,
+    2295, 2373, 2374, 2375, 2055, 2056, 2135, 2136, 2137, 2215, 2216, 2217,
+    1897, 1898, 1977, 1978, 1981, 2057, 2058, 2061, 1741, 1742, 1821, 1822,
+    1823, 1901, 1902, 1903, 1423, 1424, 1503, 1504, 1505, 1743, 1744, 1745,
+    1265, 1266, 1345, 1346, 1347, 1425, 1426, 1427, 1107, 1108, 1187, 1188,
+    1189, 1267, 1268, 1269, 949, 950, 1029, 1030, 1031, 1109, 1110, 1111,
+    791, 792, 871, 872, 873, 951, 952, 953, 633, 634, 713, 714,
+    715, 793, 794, 795, 475, 476, 555, 556, 557, 635, 636, 637,
+    716, 717, 796, 797, 798, 876, 877, 878, 874, 875, 954, 955,
+    956, 1034, 1035, 1036, 1032, 1033, 1112, 1113, 1114, 1192, 1193, 1194,
+    1190, 1191, 1270, 1271, 1272, 1350, 1351, 1352, 1348, 1349, 1428, 1429,
+    1430, 1508, 1509, 1510, 1506, 1507, 1746, 1747, 1748, 1826, 1827, 1828,
+    1824, 1825, 1904, 1905, 1906, 1984, 1985, 1986, 1982, 1983, 2062, 2063,
+    2064, 2142, 2143, 2144, 2138, 2141, 2218, 2221, 2222, 2298, 2301, 2302,
+    2296, 2297, 2376, 2377, 2378, 2456, 2457, 2458, 2454, 2455, 2534, 2535,
+    2536, 2614, 2615, 2616, 2612, 2613, 2692, 2693, 2694, 2772, 2773, 2774,
+    2770, 2771, 2850, 2851, 2852, 2930, 2931, 2932, 2928, 2929, 3008, 3009,
+    3010, 3088, 3089, 3090, 3086, 3087, 3326, 3327, 3328, 3406, 3407, 3408,
+    3404, 3405, 3484, 3485, 3486, 3564, 3565, 3566, 3562, 3563, 3642, 3643,
+    3644, 3722, 3723, 3724, 3718, 3721, 3798, 3801, 3802, 3878, 3881, 3882,
+    3876, 3877, 3956, 3957, 3958, 4036, 4037, 4038, 4034, 4035, 4114, 4115,
+    4116, 4194, 4195, 4196, 4192, 4193, 4272, 4273, 4274, 4352, 4353, 4354,
+    4350, 4351, 4430, 4431, 4432, 4510, 4511, 4512, 4508, 4509, 4588, 4589,
+    4590, 4668, 4669, 4670, 4666, 4667, 4906, 4907, 4908, 4986, 4987, 4988,
+    4984, 4985, 5064, 5065, 5066, 5144, 5145, 5146, 5142, 5143, 5222, 5223,
+    5224, 5302, 5303, 5304, 5298, 5301, 5378, 5381, 5382, 5458, 5461, 5462,
+    5456, 5457, 5536, 5537, 5538, 5616, 5617, 5618, 5614, 5615, 5694, 5695,
+    5696, 5774, 5775, 5776, 5772, 5773, 5852, 5853, 5854, 5932, 5933, 5934,
+    5930, 5931, 6010, 6011, 6012, 6090, 6091, 6092, 6088, 6089, 6168, 6169,
+    6170, 6248, 6249, 6250, 6013, 6014, 6093, 6094, 6095, 6173, 6174, 6175,
+    5855, 5856, 5935, 5936, 5937, 6015, 6016, 6017, 5697, 5698, 5777, 5778,
+    5781, 5857, 5858, 5861, 5541, 5542, 5621, 5622, 5623, 5701, 5702, 5703,
+    5383, 5384, 5463, 5464, 5465, 5543, 5544, 5545, 5225, 5226, 5305, 5306,
+    5307, 5385, 5386, 5387, 5067, 5068, 5147, 5148, 5149, 5227, 5228, 5229,
+    4909, 4910, 4989, 4990, 4991, 5069, 5070, 5071, 4591, 4592, 4671, 4672,
+    4673, 4911, 4912, 4913, 4433, 4434, 4513, 4514, 4515, 4593, 4594, 4595,
+    4275, 4276, 4355, 4356, 4357, 4435, 4436, 4437, 4117, 4118, 4197, 4198,
+    4201, 4277, 4278, 4281, 3961, 3962, 4041, 4042, 4043, 4121, 4122, 4123,
+    3803, 3804, 3883, 3884, 3885, 3963, 3964, 3965, 3645, 3646, 3725, 3726,
+    3727, 3805, 3806, 3807, 3487, 3488, 3567, 3568, 3569, 3647, 3648, 3649,
+    3329, 3330, 3409, 3410, 3411, 3489, 3490, 3491, 3011, 3012, 3091, 3092,
+    3093, 3331, 3332, 3333, 2853, 2854, 2933, 2934, 2935, 3013, 3014, 3015,
+    2695, 2696, 2775, 2776, 2777, 2855, 2856, 2857, 2537, 2538, 2617, 2618,
+    2621, 2697, 2698, 2701, 2381, 2382, 2461, 2462, 2463, 2541, 2542, 2543,
+    2223, 2224, 2303, 2304, 2305, 2383, 2384, 2385, 2065, 2066, 2145, 2146,
+    2147, 2225, 2226, 2227, 1907, 1908, 1987, 1988, 1989, 2067, 2068, 2069,
+    1749, 1750, 1829, 1830, 1831, 1909, 1910, 1911, 1431, 1432, 1511, 1512,
+    1513, 1751, 1752, 1753, 1273, 1274, 1353, 1354, 1355, 1433, 1434, 1435,
+    1115, 1116, 1195, 1196, 1197, 1275, 1276, 1277, 1356, 1357, 1436, 1437,
+    1438, 1516, 1517, 1518, 1514, 1515, 1754, 1755, 1756, 1834, 1835, 1836,
+    1832, 1833, 1912, 1913, 1914, 1992, 1993, 1994, 1990, 1991, 2070, 2071,
+    2072, 2150, 2151, 2152, 2148, 2149, 2228, 2229, 2230, 2308, 2309, 2310,
+    2306, 2307, 2386, 2387, 2388, 2466, 2467, 2468, 2464, 2465, 2544, 2545,
+    2546, 2624, 2625, 2626, 2622, 2623, 2702, 2703, 2704, 2782, 2783, 2784,
+    2778, 2781, 2858, 2861, 2862, 2938, 2941, 2942, 2936, 2937, 3016, 3017,
+    3018, 3096, 3097, 3098, 3094, 3095, 3334, 3335, 3336, 3414, 3415, 3416,
+    3412, 3413, 3492, 3493, 3494, 3572, 3573, 3574, 3570, 3571, 3650, 3651,
+    3652, 3730, 3731, 3732, 3728, 3729, 3808, 3809, 3810, 3888, 3889, 3890,
+    3886, 3887, 3966, 3967, 3968, 4046, 4047, 4048, 4044, 4045, 4124, 4125,
+    4126, 4204, 4205, 4206, 4202, 4203, 4282, 4283, 4284, 4362, 4363, 4364,
+    4358, 4361, 4438, 4441, 4442, 4518, 4521, 4522, 4516, 4517, 4596, 4597,
+    4598, 4676, 4677, 4678, 4674, 4675, 4914, 4915, 4916, 4994, 4995, 4996,
+    4992, 4993, 5072, 5073, 5074, 5152, 5153, 5154, 5150, 5151, 5230, 5231,
+    5232, 5310, 5311, 5312, 5308, 5309, 5388, 5389, 5390, 5468, 5469, 5470,
+    5466, 5467, 5546, 5547, 5548, 5626, 5627, 5628, 5624, 5625, 5704, 5705,
+    5706, 5784, 5785, 5786, 5782, 5783, 5862, 5863, 5864, 5942, 5943, 5944,
+    5938, 5941, 6018, 6021, 6022, 6098, 6101, 6102, 6096, 6097, 6176, 6177,
+    6178, 6256, 6257, 6258, 6023, 6024, 6103, 6104, 6105, 6183, 6184, 6185,
+    5865, 5866, 5945, 5946, 5947, 6025, 6026, 6027, 5707, 5708, 5787, 5788,
+    5789, 5867, 5868, 5869, 5549, 5550, 5629, 5630, 5631, 5709, 5710, 5711,
+    5391, 5392, 5471, 5472, 5473, 5551, 5552, 5553, 5233, 5234, 5313, 5314,
+    5315, 5393, 5394, 5395, 5075, 5076, 5155, 5156, 5157, 5235, 5236, 5237,
+    4917, 4918, 4997, 4998, 5001, 5077, 5078, 5081, 4601, 4602, 4681, 4682,
+    4683, 4921, 4922, 4923, 4443, 4444, 4523, 4524, 4525, 4603, 4604, 4605,
+    4285, 4286, 4365, 4366, 4367, 4445, 4446, 4447, 4127, 4128, 4207, 4208,
+    4209, 4287, 4288, 4289, 3969, 3970, 4049, 4050, 4051, 4129, 4130, 4131,
+    3811, 3812, 3891, 3892, 3893, 3971, 3972, 3973, 3653, 3654, 3733, 3734,
+    3735, 3813, 3814, 3815, 3495, 3496, 3575, 3576, 3577, 3655, 3656, 3657,
+    3337, 3338, 3417, 3418, 3421, 3497, 3498, 3501, 3021, 3022, 3101, 3102,
+    3103, 3341, 3342, 3343, 2863, 2864, 2943, 2944, 2945, 3023, 3024, 3025,
+    2705, 2706, 2785, 2786, 2787, 2865, 2866, 2867, 2547, 2548, 2627, 2628,
+    2629, 2707, 2708, 2709, 2389, 2390, 2469, 2470, 2471, 2549, 2550, 2551,
+    2231, 2232, 2311, 2312, 2313, 2391, 2392, 2393, 2073, 2074, 2153, 2154,
+    2155, 2233, 2234, 2235, 1915, 1916, 1995, 1996, 1997, 2075, 2076, 2077,
+    2156, 2157, 2236, 2237, 2238, 2316, 2317, 2318, 2314, 2315, 2394, 2395,
+    2396, 2474, 2475, 2476, 2472, 2473, 2552, 2553, 2554, 2632, 2633, 2634,
+    2630, 2631, 2710, 2711, 2712, 2790, 2791, 2792, 2788, 2789, 2868, 2869,
+    2870, 2948, 2949, 2950, 2946, 2947, 3026, 3027, 3028, 3106, 3107, 3108,
+    3104, 3105, 3344, 3345, 3346, 3424, 3425, 3426, 3422, 3423, 3502, 3503,
+    3504, 3582, 3583, 3584, 3578, 3581, 3658, 3661, 3662, 3738, 3741, 3742,
+    3736, 3737, 3816, 3817, 3818, 3896, 3897, 3898, 3894, 3895, 3974, 3975,
+    3976, 4054, 4055, 4056, 4052, 4053, 4132, 4133, 4134, 4212, 4213, 4214,
+    4210, 4211, 4290, 4291, 4292, 4370, 4371, 4372, 4368, 4369, 4448, 4449,
+    4450, 4528, 4529, 4530, 4526, 4527, 4606, 4607, 4608, 4686, 4687, 4688,
+    4684, 4685, 4924, 4925, 4926, 5004, 5005, 5006, 5002, 5003, 5082, 5083,
+    5084, 5162, 5163, 5164, 5158, 5161, 5238, 5241, 5242, 5318, 5321, 5322,
+    5316, 5317, 5396, 5397, 5398, 5476, 5477, 5478, 5474, 5475, 5554, 5555,
+    5556, 5634, 5635, 5636, 5632, 5633, 5712, 5713, 5714, 5792, 5793, 5794,
+    5790, 5791, 5870, 5871, 5872, 5950, 5951, 5952, 5948, 5949, 6028, 6029,
+    6030, 6108, 6109, 6110, 6106, 6107, 6186, 6187, 6188, 6266, 6267, 6268,
+    6031, 6032, 6111, 6112, 6113, 6191, 6192, 6193, 5873, 5874, 5953, 5954,
+    5955, 6033, 6034, 6035, 5715, 5716, 5795, 5796, 5797, 5875, 5876, 5877,
+    5557, 5558, 5637, 5638, 5641, 5717, 5718, 5721, 5401, 5402, 5481, 5482,
+    5483, 5561, 5562, 5563, 5243, 5244, 5323, 5324, 5325, 5403, 5404, 5405,
+    5085, 5086, 5165, 5166, 5167, 5245, 5246, 5247, 4927, 4928, 5007, 5008,
+    5009, 5087, 5088, 5089, 4609, 4610, 4689, 4690, 4691, 4929, 4930, 4931,
+    4451, 4452, 4531, 4532, 4533, 4611, 4612, 4613, 4293, 4294, 4373, 4374,
+    4375, 4453, 4454, 4455, 4135, 4136, 4215, 4216, 4217, 4295, 4296, 4297,
+    3977, 3978, 4057, 4058, 4061, 4137, 4138, 4141, 3821, 3822, 3901, 3902,
+    3903, 3981, 3982, 3983, 3663, 3664, 3743, 3744, 3745, 3823, 3824, 3825,
+    3505, 3506, 3585, 3586, 3587, 3665, 3666, 3667, 3347, 3348, 3427, 3428,
+    3429, 3507, 3508, 3509, 3029, 3030, 3109, 3110, 3111, 3349, 3350, 3351,
+    2871, 2872, 2951, 2952, 2953, 3031, 3032, 3033, 2713, 2714, 2793, 2794,
+    2795, 2873, 2874, 2875, 2555, 2556, 2635, 2636, 2637, 2715, 2716, 2717,
+    2796, 2797, 2876, 2877, 2878, 2956, 2957, 2958, 2954, 2955, 3034, 3035,
+    3036, 3114, 3115, 3116, 3112, 3113, 3352, 3353, 3354, 3432, 3433, 3434,
+    3430, 3431, 3510, 3511, 3512, 3590, 3591, 3592, 3588, 3589, 3668, 3669,
+    3670, 3748, 3749, 3750, 3746, 3747, 3826, 3827, 3828, 3906, 3907, 3908,
+    3904, 3905, 3984, 3985, 3986, 4064, 4065, 4066, 4062, 4063, 4142, 4143,
+    4144, 4222, 4223, 4224, 4218, 4221, 4298, 4301, 4302, 4378, 4381, 4382,
+    4376, 4377, 4456, 4457, 4458, 4536, 4537, 4538, 4534, 4535, 4614, 4615,
+    4616, 4694, 4695, 4696, 4692, 4693, 4932, 4933, 4934, 5012, 5013, 5014,
+    5010, 5011, 5090, 5091, 5092, 5170, 5171, 5172, 5168, 5169, 5248, 5249,
+    5250, 5328, 5329, 5330, 5326, 5327, 5406, 5407, 5408, 5486, 5487, 5488,
+    5484, 5485, 5564, 5565, 5566, 5644, 5645, 5646, 5642, 5643, 5722, 5723,
+    5724, 5802, 5803, 5804, 5798, 5801, 5878, 5881, 5882, 5958, 5961, 5962,
+    5956, 5957, 6036, 6037, 6038, 6116, 6117, 6118, 6114, 6115, 6194, 6195,
+    6196, 6274, 6275, 6276, 6041, 6042, 6121, 6122, 6123, 6201, 6202, 6203,
+    5883, 5884, 5963, 5964, 5965, 6043, 6044, 6045, 5725, 5726, 5805, 5806,
+    5807, 5885, 5886, 5887, 5567, 5568, 5647, 5648, 5649, 5727, 5728, 5729,
+    5409, 5410, 5489, 5490, 5491, 5569, 5570, 5571, 5251, 5252, 5331, 5332,
+    5333, 5411, 5412, 5413, 5093, 5094, 5173, 5174, 5175, 5253, 5254, 5255,
+    4935, 4936, 5015, 5016, 5017, 5095, 5096, 5097, 4617, 4618, 4697, 4698,
+    4701, 4937, 4938, 4941, 4461, 4462, 4541, 4542, 4543, 4621, 4622, 4623,
+    4303, 4304, 4383, 4384, 4385, 4463, 4464, 4465, 4145, 4146, 4225, 4226,
+    4227, 4305, 4306, 4307, 3987, 3988, 4067, 4068, 4069, 4147, 4148, 4149,
+    3829, 3830, 3909, 3910, 3911, 3989, 3990, 3991, 3671, 3672, 3751, 3752,
+    3753, 3831, 3832, 3833, 3513, 3514, 3593, 3594, 3595, 3673, 3674, 3675,
+    3355, 3356, 3435, 3436, 3437, 3515, 3516, 3517, 3596, 3597, 3676, 3677,
+    3678, 3756, 3757, 3758, 3754, 3755, 3834, 3835, 3836, 3914, 3915, 3916,
+    3912, 3913, 3992, 3993, 3994, 4072, 4073, 4074, 4070, 4071, 4150, 4151,
+    4152, 4230, 4231, 4232, 4228, 4229, 4308, 4309, 4310, 4388, 4389, 4390,
+    4386, 4387, 4466, 4467, 4468, 4546, 4547, 4548, 4544, 4545, 4624, 4625,
+    4626, 4704, 4705, 4706, 4702, 4703, 4942, 4943, 4944, 5022, 5023, 5024,
+    5018, 5021, 5098, 5101, 5102, 5178, 5181, 5182, 5176, 5177, 5256, 5257,
+    5258, 5336, 5337, 5338, 5334, 5335, 5414, 5415, 5416, 5494, 5495, 5496,
+    5492, 5493, 5572, 5573, 5574, 5652, 5653, 5654, 5650, 5651, 5730, 5731,
+    5732, 5810, 5811, 5812, 5808, 5809, 5888, 5889, 5890, 5968, 5969, 5970,
+    5966, 5967, 6046, 6047, 6048, 6126, 6127, 6128, 6124, 6125, 6204, 6205,
+    6206, 6284, 6285, 6286, 6049, 6050, 6129, 6130, 6131, 6209, 6210, 6211,
+    5891, 5892, 5971, 5972, 5973, 6051, 6052, 6053, 5733, 5734, 5813, 5814,
+    5815, 5893, 5894, 5895, 5575, 5576, 5655, 5656, 5657, 5735, 5736, 5737,
+    5417, 5418, 5497, 5498, 5501, 5577, 5578, 5581, 5261, 5262, 5341, 5342,
+    5343, 5421, 5422, 5423, 5103, 5104, 5183, 5184, 5185, 5263, 5264, 5265,
+    4945, 4946, 5025, 5026, 5027, 5105, 5106, 5107, 4627, 4628, 4707, 4708,
+    4709, 4947, 4948, 4949, 4469, 4470, 4549, 4550, 4551, 4629, 4630, 4631,
+    4311, 4312, 4391, 4392, 4393, 4471, 4472, 4473, 4153, 4154, 4233, 4234,
+    4235, 4313, 4314, 4315, 3995, 3996, 4075, 4076, 4077, 4155, 4156, 4157,
+    4236, 4237, 4316, 4317, 4318, 4396, 4397, 4398, 4394, 4395, 4474, 4475,
+    4476, 4554, 4555, 4556, 4552, 4553, 4632, 4633, 4634, 4712, 4713, 4714,
+    4710, 4711, 4950, 4951, 4952, 5030, 5031, 5032, 5028, 5029, 5108, 5109,
+    5110, 5188, 5189, 5190, 5186, 5187, 5266, 5267, 5268, 5346, 5347, 5348,
+    5344, 5345, 5424, 5425, 5426, 5504, 5505, 5506, 5502, 5503, 5582, 5583,
+    5584, 5662, 5663, 5664, 5658, 5661, 5738, 5741, 5742, 5818, 5821, 5822,
+    5816, 5817, 5896, 5897, 5898, 5976, 5977, 5978, 5974, 5975, 6054, 6055,
+    6056, 6134, 6135, 6136, 6132, 6133, 6212, 6213, 6214, 6292, 6293, 6294,
+    6057, 6058, 6137, 6138, 6141, 6217, 6218, 6221, 5901, 5902, 5981, 5982,
+    5983, 6061, 6062, 6063, 5743, 5744, 5823, 5824, 5825, 5903, 5904, 5905,
+    5585, 5586, 5665, 5666, 5667, 5745, 5746, 5747, 5427, 5428, 5507, 5508,
+    5509, 5587, 5588, 5589, 5269, 5270, 5349, 5350, 5351, 5429, 5430, 5431,
+    5111, 5112, 5191, 5192, 5193, 5271, 5272, 5273, 4953, 4954, 5033, 5034,
+    5035, 5113, 5114, 5115, 4635, 4636, 4715, 4716, 4717, 4955, 4956, 4957,
+    5036, 5037, 5116, 5117, 5118, 5196, 5197, 5198, 5194, 5195, 5274, 5275,
+    5276, 5354, 5355, 5356, 5352, 5353, 5432, 5433, 5434, 5512, 5513, 5514,
+    5510, 5511, 5590, 5591, 5592, 5670, 5671, 5672, 5668, 5669, 5748, 5749,
+    5750, 5828, 5829, 5830, 5826, 5827, 5906, 5907, 5908, 5986, 5987, 5988,
+    5984, 5985, 6064, 6065, 6066, 6144, 6145, 6146, 6142, 6143, 6222, 6223,
+    6224, 6302, 6303, 6304, 6067, 6068, 6147, 6148, 6149, 6227, 6228, 6229,
+    5909, 5910, 5989, 5990, 5991, 6069, 6070, 6071, 5751, 5752, 5831, 5832,
+    5833, 5911, 5912, 5913, 5593, 5594, 5673, 5674, 5675, 5753, 5754, 5755,
+    5435, 5436, 5515, 5516, 5517, 5595, 5596, 5597, 5676, 5677, 5756, 5757,
+    5758, 5836, 5837, 5838, 5834, 5835, 5914, 5915, 5916, 5994, 5995, 5996,
+    5992, 5993, 6072, 6073, 6074, 6152, 6153, 6154, 6150, 6151, 6230, 6231,
+    6232, 6310, 6311, 6312, 6075, 6076, 6155, 6156, 6157, 6235, 6236, 6237,
+};
+
+static const uint16_t bits_18[6400] = {
+    349, 350, 437, 438, 353, 525, 526, 441, 89, 90, 177, 178,
+    179, 265, 266, 267, 7483, 7484, 7571, 7572, 7573, 91, 92, 93,
+    7574, 7575, 94, 95, 96, 182, 183, 184, 180, 181, 268, 269,
+    270, 356, 357, 358, 354, 355, 442, 443, 444, 530, 531, 532,
+    614, 529, 702, 617, 618, 790, 705, 706, 1053, 1054, 1141, 1142,
+    1057, 1229, 1230, 1145, 793, 794, 881, 882, 883, 969, 970, 971,
+    619, 620, 707, 708, 709, 795, 796, 797, 445, 446, 533, 534,
+    535, 621, 622, 623, 271, 272, 359, 360, 361, 447, 448, 449,
+    97, 98, 185, 186, 187, 273, 274, 275, 7491, 7492, 7579, 7580,
+    7581, 99, 100, 101, 7582, 7583, 102, 103, 104, 190, 191, 192,
+    188, 189, 276, 277, 278, 364, 365, 366, 362, 363, 450, 451,
+    452, 538, 539, 540, 536, 537, 624, 625, 626, 712, 713, 714,
+    710, 711, 798, 799, 800, 886, 887, 888, 884, 885, 972, 973,
+    974, 1060, 1061, 1062, 1058, 1059, 1146, 1147, 1148, 1234, 1235, 1236,
+    1318, 1233, 1406, 1321, 1322, 1494, 1409, 1410, 1757, 1758, 1845, 1846,
+    1761, 2109, 2110, 2025, 1497, 1498, 1585, 1586, 1587, 1673, 1674, 1675,
+    1323, 1324, 1411, 1412, 1413, 1499, 1500, 1501, 1149, 1150, 1237, 1238,
+    1239, 1325, 1326, 1327, 975, 976, 1063, 1064, 1065, 1151, 1152, 1153,
+    801, 802, 889, 890, 891, 977, 978, 979, 627, 628, 715, 716,
+    717, 803, 804, 805, 453, 454, 541, 542, 543, 629, 630, 631,
+    279, 280, 367, 368, 369, 455, 456, 457, 105, 106, 193, 194,
+    195, 281, 282, 283, 7499, 7500, 7587, 7588, 7591, 107, 108, 111,
+    7592, 7593, 112, 113, 114, 200, 201, 202, 196, 199, 284, 287,
+    288, 372, 375, 376, 370, 371, 458, 459, 460, 546, 547, 548,
+    544, 545, 632, 633, 634, 720, 721, 722, 718, 719, 806, 807,
+    808, 894, 895, 896, 892, 893, 980, 981, 982, 1068, 1069, 1070,
+    1066, 1067, 1154, 1155, 1156, 1242, 1243, 1244, 1240, 1241, 1328, 1329,
+    1330, 1416, 1417, 1418, 1414, 1415, 1502, 1503, 1504, 1590, 1591, 1592,
+    1588, 1589, 1676, 1677, 1678, 1764, 1765, 1766, 1762, 1763, 2026, 2027,
+    2028, 2114, 2115, 2116, 2198, 2113, 2286, 2201, 2202, 2374, 2289, 2290,
+    2637, 2638, 2725, 2726, 2641, 2813, 2814, 2729, 2377, 2378, 2465, 2466,
+    2467, 2553, 2554, 2555, 2203, 2204, 2291, 2292, 2293, 2379, 2380, 2381,
+    2029, 2030, 2117, 2118, 2119, 2205, 2206, 2207, 1679, 1680, 1767, 1768,
+    1769, 2031, 2032, 2033, 1505, 1506, 1593, 1594, 1595, 1681, 1682, 1683,
+    1331, 1332, 1419, 1420, 1421, 1507, 1508, 1509, 1157, 1158, 1245, 1246,
+    1247, 1333, 1334, 1335, 983, 984, 1071, 1072, 1073, 1159, 1160, 1161,
+    809, 810, 897, 898, 899, 985, 986, 987, 635, 636, 723, 724,
+    727, 811, 812, 815, 463, 464, 551, 552, 553, 639, 640, 641,
+    289, 290, 377, 378, 379, 465, 466, 467, 115, 116, 203, 204,
+    205, 291, 292, 293, 7509, 7510, 7597, 7598, 7599, 117, 118, 119,
+    7600, 7601, 120, 121, 122, 208, 209, 210, 206, 207, 294, 295,
+    296, 382, 383, 384, 380, 381, 468, 469, 470, 556, 557, 558,
+    554, 555, 642, 643, 644, 730, 731, 732, 728, 729, 816, 817,
+    818, 904, 905, 906, 900, 903, 988, 991, 992, 1076, 1079, 1080,
+    1074, 1075, 1162, 1163, 1164, 1250, 1251, 1252, 1248, 1249, 1336, 1337,
+    1338, 1424, 1425, 1426, 1422, 1423, 1510, 1511, 1512, 1598, 1599, 1600,
+    1596, 1597, 1684, 1685, 1686, 1772, 1773, 1774, 1770, 1771, 2034, 2035,
+    2036, 2122, 2123, 2124, 2120, 2121, 2208, 2209, 2210, 2296, 2297, 2298,
+    2294, 2295, 2382, 2383, 2384, 2470, 2471, 2472, 2468, 2469, 2556, 2557,
+    2558, 2644, 2645, 2646, 2642, 2643, 2730, 2731, 2732, 2818, 2819, 2820,
+    2902, 2817, 2990, 2905, 2906, 3078, 2993, 2994, 3341, 3342, 3429, 3430,
+    3345, 3517, 3518, 3433, 3081, 3082, 3169, 3170, 3171, 3257, 3258, 3259,
+    2907, 2908, 2995, 2996, 2997, 3083, 3084, 3085, 2733, 2734, 2821, 2822,
+    2823, 2909, 2910, 2911, 2559, 2560, 2647, 2648, 2649, 2735, 2736, 2737,
+    2385, 2386, 2473, 2474, 2475, 2561, 2562, 2563, 2211, 2212, 2299, 2300,
+    2301, 2387, 2388, 2389, 2037, 2038, 2125, 2126, 2127, 2213, 2214, 2215,
+    1687, 1688, 1775, 1776, 1777, 2039, 2040, 2041, 1513, 1514, 1601, 1602,
+    1603, 1689, 1690, 1691, 1339, 1340, 1427, 1428, 1431, 1515, 1516, 1519,
+    1167, 1168, 1255, 1256, 1257, 1343, 1344, 1345, 993, 994, 1081, 1082,
+    1083, 1169, 1170, 1171, 819, 820, 907, 908, 909, 995, 996, 997,
+    645, 646, 733, 734, 735, 821, 822, 823, 471, 472, 559, 560,
+    561, 647, 648, 649, 297, 298, 385, 386, 387, 473, 474, 475,
+    123, 124, 211, 212, 213, 299, 300, 301, 7517, 7518, 7605, 7606,
+    7607, 125, 126, 127, 7608, 7609, 128, 129, 130, 216, 217, 218,
+    214, 215, 302, 303, 304, 390, 391, 392, 388, 389, 476, 477,
+    478, 564, 565, 566, 562, 563, 650, 651, 652, 738, 739, 740,
+    736, 737, 824, 825, 826, 912, 913, 914, 910, 911, 998, 999,
+    1000, 1086, 1087, 1088, 1084, 1085, 1172, 1173, 1174, 1260, 1261, 1262,
+    1258, 1259, 1346, 1347, 1348, 1434, 1435, 1436, 1432, 1433, 1520, 1521,
+    1522, 1608, 1609, 1610, 1604, 1607, 1692, 1695, 1696, 1780, 1783, 1784,
+    1778, 1779, 2042, 2043, 2044, 2130, 2131, 2132, 2128, 2129, 2216, 2217,
+    2218, 2304, 2305, 2306, 2302, 2303, 2390, 2391, 2392, 2478, 2479, 2480,
+    2476, 2477, 2564, 2565, 2566, 2652, 2653, 2654, 2650, 2651, 2738, 2739,
+    2740, 2826, 2827, 2828, 2824, 2825, 2912, 2913, 2914, 3000, 3001, 3002,
+    2998, 2999, 3086, 3087, 3088, 3174, 3175, 3176, 3172, 3173, 3260, 3261,
+    3262, 3348, 3349, 3350, 3346, 3347, 3434, 3435, 3436, 3522, 3523, 3524,
+    3606, 3521, 3694, 3609, 3610, 3782, 3697, 3698, 4221, 4222, 4309, 4310,
+    4225, 4397, 4398, 4313, 3961, 3962, 4049, 4050, 4051, 4137, 4138, 4139,
+    3611, 3612, 3699, 3700, 3701, 3963, 3964, 3965, 3437, 3438, 3525, 3526,
+    3527, 3613, 3614, 3615, 3263, 3264, 3351, 3352, 3353, 3439, 3440, 3441,
+    3089, 3090, 3177, 3178, 3179, 3265, 3266, 3267, 2915, 2916, 3003, 3004,
+    3005, 3091, 3092, 3093, 2741, 2742, 2829, 2830, 2831, 2917, 2918, 2919,
+    2567, 2568, 2655, 2656, 2657, 2743, 2744, 2745, 2393, 2394, 2481, 2482,
+    2483, 2569, 2570, 2571, 2219, 2220, 2307, 2308, 2311, 2395, 2396, 2399,
+    2047, 2048, 2135, 2136, 2137, 2223, 2224, 2225, 1697, 1698, 1785, 1786,
+    1787, 2049, 2050, 2051, 1523, 1524, 1611, 1612, 1613, 1699, 1700, 1701,
+    1349, 1350, 1437, 1438, 1439, 1525, 1526, 1527, 1175, 1176, 1263, 1264,
+    1265, 1351, 1352, 1353, 1001, 1002, 1089, 1090, 1091, 1177, 1178, 1179,
+    827, 828, 915, 916, 917, 1003, 1004, 1005, 653, 654, 741, 742,
+    743, 829, 830, 831, 479, 480, 567, 568, 569, 655, 656, 657,
+    305, 306, 393, 394, 397, 481, 482, 485, 133, 134, 221, 222,
+    223, 309, 310, 311, 7527, 7528, 7615, 7616, 7617, 135, 136, 137,
+    7618, 7619, 138, 139, 140, 226, 227, 228, 224, 225, 312, 313,
+    314, 400, 401, 402, 398, 399, 486, 487, 488, 574, 575, 576,
+    570, 573, 658, 661, 662, 746, 749, 750, 744, 745, 832, 833,
+    834, 920, 921, 922, 918, 919, 1006, 1007, 1008, 1094, 1095, 1096,
+    1092, 1093, 1180, 1181, 1182, 1268, 1269, 1270, 1266, 1267, 1354, 1355,
+    1356, 1442, 1443, 1444, 1440, 1441, 1528, 1529, 1530, 1616, 1617, 1618,
+    1614, 1615, 1702, 1703, 1704, 1790, 1791, 1792, 1788, 1789, 2052, 2053,
+    2054, 2140, 2141, 2142, 2138, 2139, 2226, 2227, 2228, 2314, 2315, 2316,
+    2312, 2313, 2400, 2401, 2402, 2488, 2489, 2490, 2484, 2487, 2572, 2575,
+    2576, 2660, 2663, 2664, 2658, 2659, 2746, 2747, 2748, 2834, 2835, 2836,
+    2832, 2833, 2920, 2921, 2922, 3008, 3009, 3010, 3006, 3007, 3094, 3095,
+    3096, 3182, 3183, 3184, 3180, 3181, 3268, 3269, 3270, 3356, 3357, 3358,
+    3354, 3355, 3442, 3443, 3444, 3530, 3531, 3532, 3528, 3529, 3616, 3617,
+    3618, 3704, 3705, 3706, 3702, 3703, 3966, 3967, 3968, 4054, 4055, 4056,
+    4052, 4053, 4140, 4141, 4142, 4228, 4229, 4230, 4226, 4227, 4314, 4315,
+    4316, 4402, 4403, 4404, 4486, 4401, 4574, 4489, 4490, 4662, 4577, 4578,
+    4925, 4926, 5013, 5014, 4929, 5101, 5102, 5017, 4665, 4666, 4753, 4754,
+    4755, 4841, 4842, 4843, 4491, 4492, 4579, 4580, 4581, 4667, 4668, 4669,
+    4317, 4318, 4405, 4406, 4407, 4493, 4494, 4495, 4143, 4144, 4231, 4232,
+    4233, 4319, 4320, 4321, 3969, 3970, 4057, 4058, 4059, 4145, 4146, 4147,
+    3619, 3620, 3707, 3708, 3709, 3971, 3972, 3973, 3445, 3446, 3533, 3534,
+    3535, 3621, 3622, 3623, 3271, 3272, 3359, 3360, 3361, 3447, 3448, 3449,
+    3097, 3098, 3185, 3186, 3187, 3273, 3274, 3275, 2923, 2924, 3011, 3012,
+    3015, 3099, 3100, 3103, 2751, 2752, 2839, 2840, 2841, 2927, 2928, 2929,
+    2577, 2578, 2665, 2666, 2667, 2753, 2754, 2755, 2403, 2404, 2491, 2492,
+    2493, 2579, 2580, 2581, 2229, 2230, 2317, 2318, 2319, 2405, 2406, 2407,
+    2055, 2056, 2143, 2144, 2145, 2231, 2232, 2233, 1705, 1706, 1793, 1794,
+    1795, 2057, 2058, 2059, 1531, 1532, 1619, 1620, 1621, 1707, 1708, 1709,
+    1357, 1358, 1445, 1446, 1447, 1533, 1534, 1535, 1183, 1184, 1271, 1272,
+    1273, 1359, 1360, 1361, 1009, 1010, 1097, 1098, 1101, 1185, 1186, 1189,
+    837, 838, 925, 926, 927, 1013, 1014, 1015, 663, 664, 751, 752,
+    753, 839, 840, 841, 489, 490, 577, 578, 579, 665, 666, 667,
+    315, 316, 403, 404, 405, 491, 492, 493, 141, 142, 229, 230,
+    231, 317, 318, 319, 7535, 7536, 7623, 7624, 7625, 143, 144, 145,
+    7626, 7627, 146, 147, 148, 234, 235, 236, 232, 233, 320, 321,
+    322, 408, 409, 410, 406, 407, 494, 495, 496, 582, 583, 584,
+    580, 581, 668, 669, 670, 756, 757, 758, 754, 755, 842, 843,
+    844, 930, 931, 932, 928, 929, 1016, 1017, 1018, 1104, 1105, 1106,
+    1102, 1103, 1190, 1191, 1192, 1278, 1279, 1280, 1274, 1277, 1362, 1365,
+    1366, 1450, 1453, 1454, 1448, 1449, 1536, 1537, 1538, 1624, 1625, 1626,
+    1622, 1623, 1710, 1711, 1712, 1798, 1799, 1800, 1796, 1797, 2060, 2061,
+    2062, 2148, 2149, 2150, 2146, 2147, 2234, 2235, 2236, 2322, 2323, 2324,
+    2320, 2321, 2408, 2409, 2410, 2496, 2497, 2498, 2494, 2495, 2582, 2583,
+    2584, 2670, 2671, 2672, 2668, 2669, 2756, 2757, 2758, 2844, 2845, 2846,
+    2842, 2843, 2930, 2931, 2932, 3018, 3019, 3020, 3016, 3017, 3104, 3105,
+    3106, 3192, 3193, 3194, 3188, 3191, 3276, 3279, 3280, 3364, 3367, 3368,
+    3362, 3363, 3450, 3451, 3452, 3538, 3539, 3540, 3536, 3537, 3624, 3625,
+    3626, 3712, 3713, 3714, 3710, 3711, 3974, 3975, 3976, 4062, 4063, 4064,
+    4060, 4061, 4148, 4149, 4150, 4236, 4237, 4238, 4234, 4235, 4322, 4323,
+    4324, 4410, 4411, 4412, 4408, 4409, 4496, 4497, 4498, 4584, 4585, 4586,
+    4582, 4583, 4670, 4671, 4672, 4758, 4759, 4760, 4756, 4757, 4844, 4845,
+    4846, 4932, 4933, 4934, 4930, 4931, 5018, 5019, 5020, 5106, 5107, 5108,
+    5190, 5105, 5278, 5193, 5194, 5366, 5281, 5282, 5629, 5630, 5717, 5718,
+    5633, 5981, 5982, 5897, 5369, 5370, 5457, 5458, 5459, 5545, 5546, 5547,
+    5195, 5196, 5283, 5284, 5285, 5371, 5372, 5373, 5021, 5022, 5109, 5110,
+    5111, 5197, 5198, 5199, 4847, 4848, 4935, 4936, 4937, 5023, 5024, 5025,
+    4673, 4674, 4761, 4762, 4763, 4849, 4850, 4851, 4499, 4500, 4587, 4588,
+    4589, 4675, 4676, 4677, 4325, 4326, 4413, 4414, 4415, 4501, 4502, 4503,
+    4151, 4152, 4239, 4240, 4241, 4327, 4328, 4329, 3977, 3978, 4065, 4066,
+    4067, 4153, 4154, 4155, 3627, 3628, 3715, 3716, 3719, 3979, 3980, 3983,
+    3455, 3456, 3543, 3544, 3545, 3631, 3632, 3633, 3281, 3282, 3369, 3370,
+    3371, 3457, 3458, 3459, 3107, 3108, 3195, 3196, 3197, 3283, 3284, 3285,
+    2933, 2934, 3021, 3022, 3023, 3109, 3110, 3111, 2759, 2760, 2847, 2848,
+    2849, 2935, 2936, 2937, 2585, 2586, 2673, 2674, 2675, 2761, 2762, 2763,
+    2411, 2412, 2499, 2500, 2501, 2587, 2588, 2589, 2237, 2238, 2325, 2326,
+    2327, 2413, 2414, 2415, 2063, 2064, 2151, 2152, 2153, 2239, 2240, 2241,
+    1713, 1714, 1801, 1802, 1805, 2065, 2066, 2069, 1541, 1542, 1629, 1630,
+    1631, 1717, 1718, 1719, 1367, 1368, 1455, 1456, 1457, 1543, 1544, 1545,
+    1193, 1194, 1281, 1282, 1283, 1369, 1370, 1371, 1019, 1020, 1107, 1108,
+    1109, 1195, 1196, 1197, 845, 846, 933, 934, 935, 1021, 1022, 1023,
+    671, 672, 759, 760, 761, 847, 848, 849, 497, 498, 585, 586,
+    587, 673, 674, 675, 323, 324, 411, 412, 413, 499, 500, 501,
+    149, 150, 237, 238, 239, 325, 326, 327, 7543, 7544, 7631, 7632,
+    7635, 151, 152, 155, 7636, 7637, 156, 157, 158, 244, 245, 246,
+    240, 243, 328, 331, 332, 416, 419, 420, 414, 415, 502, 503,
+    504, 590, 591, 592, 588, 589, 676, 677, 678, 764, 765, 766,
+    762, 763, 850, 851, 852, 938, 939, 940, 936, 937, 1024, 1025,
+    1026, 1112, 1113, 1114, 1110, 1111, 1198, 1199, 1200, 1286, 1287, 1288,
+    1284, 1285, 1372, 1373, 1374, 1460, 1461, 1462, 1458, 1459, 1546, 1547,
+    1548, 1634, 1635, 1636, 1632, 1633, 1720, 1721, 1722, 1808, 1809, 1810,
+    1806, 1807, 2070, 2071, 2072, 2158, 2159, 2160, 2154, 2157, 2242, 2245,
+    2246, 2330, 2333, 2334, 2328, 2329, 2416, 2417, 2418, 2504, 2505, 2506,
+    2502, 2503, 2590, 2591, 2592, 2678, 2679, 2680, 2676, 2677, 2764, 2765,
+    2766, 2852, 2853, 2854, 2850, 2851, 2938, 2939, 2940, 3026, 3027, 3028,
+    3024, 3025, 3112, 3113, 3114, 3200, 3201, 3202, 3198, 3199, 3286, 3287,
+    3288, 3374, 3375, 3376, 3372, 3373, 3460, 3461, 3462, 3548, 3549, 3550,
+    3546, 3547, 3634, 3635, 3636, 3722, 3723, 3724, 3720, 3721, 3984, 3985,
+    3986, 4072, 4073, 4074, 4068, 4071, 4156, 4159, 4160, 4244, 4247, 4248,
+    4242, 4243, 4330, 4331, 4332, 4418, 4419, 4420, 4416, 4417, 4504, 4505,
+    4506, 4592, 4593, 4594, 4590, 4591, 4678, 4679, 4680, 4766, 4767, 4768,
+    4764, 4765, 4852, 4853, 4854, 4940, 4941, 4942, 4938, 4939, 5026, 5027,
+    5028, 5114, 5115, 5116, 5112, 5113, 5200, 5201, 5202, 5288, 5289, 5290,
+    5286, 5287, 5374, 5375, 5376, 5462, 5463, 5464, 5460, 5461, 5548, 5549,
+    5550, 5636, 5637, 5638, 5634, 5635, 5898, 5899, 5900, 5986, 5987, 5988,
+    6070, 5985, 6158, 6073, 6074, 6246, 6161, 6162, 6509, 6510, 6597, 6598,
+    6513, 6685, 6686, 6601, 6249, 6250, 6337, 6338, 6339, 6425, 6426, 6427,
+    6075, 6076, 6163, 6164, 6165, 6251, 6252, 6253, 5901, 5902, 5989, 5990,
+    5991, 6077, 6078, 6079, 5551, 5552, 5639, 5640, 5641, 5903, 5904, 5905,
+    5377, 5378, 5465, 5466, 5467, 5553, 5554, 5555, 5203, 5204, 5291, 5292,
+    5293, 5379, 5380, 5381, 5029, 5030, 5117, 5118, 5119, 5205, 5206, 5207,
+    4855, 4856, 4943, 4944, 4945, 5031, 5032, 5033, 4681, 4682, 4769, 4770,
+    4771, 4857, 4858, 4859, 4507, 4508, 4595, 4596, 4599, 4683, 4684, 4687,
+    4335, 4336, 4423, 4424, 4425, 4511, 4512, 4513, 4161, 4162, 4249, 4250,
+    4251, 4337, 4338, 4339, 3987, 3988, 4075, 4076, 4077, 4163, 4164, 4165,
+    3637, 3638, 3725, 3726, 3727, 3989, 3990, 3991, 3463, 3464, 3551, 3552,
+    3553, 3639, 3640, 3641, 3289, 3290, 3377, 3378, 3379, 3465, 3466, 3467,
+    3115, 3116, 3203, 3204, 3205, 3291, 3292, 3293, 2941, 2942, 3029, 3030,
+    3031, 3117, 3118, 3119, 2767, 2768, 2855, 2856, 2857, 2943, 2944, 2945,
+    2593, 2594, 2681, 2682, 2685, 2769, 2770, 2773, 2421, 2422, 2509, 2510,
+    2511, 2597, 2598, 2599, 2247, 2248, 2335, 2336, 2337, 2423, 2424, 2425,
+    2073, 2074, 2161, 2162, 2163, 2249, 2250, 2251, 1723, 1724, 1811, 1812,
+    1813, 2075, 2076, 2077, 1549, 1550, 1637, 1638, 1639, 1725, 1726, 1727,
+    1375, 1376, 1463, 1464, 1465, 1551, 1552, 1553, 1201, 1202, 1289, 1290,
+    1291, 1377, 1378, 1379, 1027, 1028, 1115, 1116, 1117, 1203, 1204, 1205,
+    853, 854, 941, 942, 943, 1029, 1030, 1031, 679, 680, 767, 768,
+    771, 855, 856, 859, 507, 508, 595, 596, 597, 683, 684, 685,
+    333, 334, 421, 422, 423, 509, 510, 511, 159, 160, 247, 248,
+    249, 335, 336, 337, 7553, 7554, 7641, 7642, 7643, 161, 162, 163,
+    7644, 7645, 164, 165, 166, 252, 253, 254, 250, 251, 338, 339,
+    340, 426, 427, 428, 424, 425, 512, 513, 514, 600, 601, 602,
+    598, 599, 686, 687, 688, 774, 775, 776, 772, 773, 860, 861,
+    862, 948, 949, 950, 944, 947, 1032, 1035, 1036, 1120, 1123, 1124,
+    1118, 1119, 1206, 1207, 1208, 1294, 1295, 1296, 1292, 1293, 1380, 1381,
+    1382, 1468, 1469, 1470, 1466, 1467, 1554, 1555, 1556, 1642, 1643, 1644,
+    1640, 1641, 1728, 1729, 1730, 1816, 1817, 1818, 1814, 1815, 2078, 2079,
+    2080, 2166, 2167, 2168, 2164, 2165, 2252, 2253, 2254, 2340, 2341, 2342,
+    2338, 2339, 2426, 2427, 2428, 2514, 2515, 2516, 2512, 2513, 2600, 2601,
+    2602, 2688, 2689, 2690, 2686, 2687, 2774, 2775, 2776, 2862, 2863, 2864,
+    2858, 2861, 2946, 2949, 2950, 3034, 3037, 3038, 3032, 3033, 3120, 3121,
+    3122, 3208, 3209, 3210, 3206, 3207, 3294, 3295, 3296, 3382, 3383, 3384,
+    3380, 3381, 3468, 3469, 3470, 3556, 3557, 3558, 3554, 3555, 3642, 3643,
+    3644, 3730, 3731, 3732, 3728, 3729, 3992, 3993, 3994, 4080, 4081, 4082,
+    4078, 4079, 4166, 4167, 4168, 4254, 4255, 4256, 4252, 4253, 4340, 4341,
+    4342, 4428, 4429, 4430, 4426, 4427, 4514, 4515, 4516, 4602, 4603, 4604,
+    4600, 4601, 4688, 4689, 4690, 4776, 4777, 4778, 4772, 4775, 4860, 4863,
+    4864, 4948, 4951, 4952, 4946, 4947, 5034, 5035, 5036, 5122, 5123, 5124,
+    5120, 5121, 5208, 5209, 5210, 5296, 5297, 5298, 5294, 5295, 5382, 5383,
+    5384, 5470, 5471, 5472, 5468, 5469, 5556, 5557, 5558, 5644, 5645, 5646,
+    5642, 5643, 5906, 5907, 5908, 5994, 5995, 5996, 5992, 5993, 6080, 6081,
+    6082, 6168, 6169, 6170, 6166, 6167, 6254, 6255, 6256, 6342, 6343, 6344,
+    6340, 6341, 6428, 6429, 6430, 6516, 6517, 6518, 6514, 6515, 6602, 6603,
+    6604, 6690, 6691, 6692, 6774, 6689, 6862, 6777, 6778, 6950, 6865, 6866,
+    7213, 7214, 7301, 7302, 7217, 7389, 7390, 7305, 6953, 6954, 7041, 7042,
+    7043, 7129, 7130, 7131, 6779, 6780, 6867, 6868, 6869, 6955, 6956, 6957,
+    6605, 6606, 6693, 6694, 6695, 6781, 6782, 6783, 6431, 6432, 6519, 6520,
+    6521, 6607, 6608, 6609, 6257, 6258, 6345, 6346, 6347, 6433, 6434, 6435,
+    6083, 6084, 6171, 6172, 6173, 6259, 6260, 6261, 5909, 5910, 5997, 5998,
+    5999, 6085, 6086, 6087, 5559, 5560, 5647, 5648, 5649, 5911, 5912, 5913,
+    5385, 5386, 5473, 5474, 5475, 5561, 5562, 5563, 5211, 5212, 5299, 5300,
+    5303, 5387, 5388, 5391, 5039, 5040, 5127, 5128, 5129, 5215, 5216, 5217,
+    4865, 4866, 4953, 4954, 4955, 5041, 5042, 5043, 4691, 4692, 4779, 4780,
+    4781, 4867, 4868, 4869, 4517, 4518, 4605, 4606, 4607, 4693, 4694, 4695,
+    4343, 4344, 4431, 4432, 4433, 4519, 4520, 4521, 4169, 4170, 4257, 4258,
+    4259, 4345, 4346, 4347, 3995, 3996, 4083, 4084, 4085, 4171, 4172, 4173,
+    3645, 3646, 3733, 3734, 3735, 3997, 3998, 3999, 3471, 3472, 3559, 3560,
+    3561, 3647, 3648, 3649, 3297, 3298, 3385, 3386, 3389, 3473, 3474, 3477,
+    3125, 3126, 3213, 3214, 3215, 3301, 3302, 3303, 2951, 2952, 3039, 3040,
+    3041, 3127, 3128, 3129, 2777, 2778, 2865, 2866, 2867, 2953, 2954, 2955,
+    2603, 2604, 2691, 2692, 2693, 2779, 2780, 2781, 2429, 2430, 2517, 2518,
+    2519, 2605, 2606, 2607, 2255, 2256, 2343, 2344, 2345, 2431, 2432, 2433,
+    2081, 2082, 2169, 2170, 2171, 2257, 2258, 2259, 1731, 1732, 1819, 1820,
+    1821, 2083, 2084, 2085, 1557, 1558, 1645, 1646, 1647, 1733, 1734, 1735,
+    1383, 1384, 1471, 1472, 1475, 1559, 1560, 1563, 1211, 1212, 1299, 1300,
+    1301, 1387, 1388, 1389, 1037, 1038, 1125, 1126, 1127, 1213, 1214, 1215,
+    863, 864, 951, 952, 953, 1039, 1040, 1041, 689, 690, 777, 778,
+    779, 865, 866, 867, 515, 516, 603, 604, 605, 691, 692, 693,
+    341, 342, 429, 430, 431, 517, 518, 519, 167, 168, 255, 256,
+    257, 343, 344, 345, 7561, 7562, 7649, 7650, 7651, 169, 170, 171,
+    7652, 7653, 172, 173, 174, 260, 261, 262, 258, 259, 346, 347,
+    348, 434, 435, 436, 432, 433, 520, 521, 522, 608, 609, 610,
+    606, 607, 694, 695, 696, 782, 783, 784, 780, 781, 868, 869,
+    870, 956, 957, 958, 954, 955, 1042, 1043, 1044, 1130, 1131, 1132,
+    1128, 1129, 1216, 1217, 1218, 1304, 1305, 1306, 1302, 1303, 1390, 1391,
+    1392, 1478, 1479, 1480, 1476, 1477, 1564, 1565, 1566, 1652, 1653, 1654,
+    1648, 1651, 1736, 1739, 1740, 1824, 1827, 1828, 1822, 1823, 2086, 2087,
+    2088, 2174, 2175, 2176, 2172, 2173, 2260, 2261, 2262, 2348, 2349, 2350,
+    2346, 2347, 2434, 2435, 2436, 2522, 2523, 2524, 2520, 2521, 2608, 2609,
+    2610, 2696, 2697, 2698, 2694, 2695, 2782, 2783, 2784, 2870, 2871, 2872,
+    2868, 2869, 2956, 2957, 2958, 3044, 3045, 3046, 3042, 3043, 3130, 3131,
+    3132, 3218, 3219, 3220, 3216, 3217, 3304, 3305, 3306, 3392, 3393, 3394,
+    3390, 3391, 3478, 3479, 3480, 3566, 3567, 3568, 3562, 3565, 3650, 3653,
+    3654, 3738, 3741, 3742, 3736, 3737, 4000, 4001, 4002, 4088, 4089, 4090,
+    4086, 4087, 4174, 4175, 4176, 4262, 4263, 4264, 4260, 4261, 4348, 4349,
+    4350, 4436, 4437, 4438, 4434, 4435, 4522, 4523, 4524, 4610, 4611, 4612,
+    4608, 4609, 4696, 4697, 4698, 4784, 4785, 4786, 4782, 4783, 4870, 4871,
+    4872, 4958, 4959, 4960, 4956, 4957, 5044, 5045, 5046, 5132, 5133, 5134,
+    5130, 5131, 5218, 5219, 5220, 5306, 5307, 5308, 5304, 5305, 5392, 5393,
+    5394, 5480, 5481, 5482, 5476, 5479, 5564, 5567, 5568, 5652, 5655, 5656,
+    5650, 5651, 5914, 5915, 5916, 6002, 6003, 6004, 6000, 6001, 6088, 6089,
+    6090, 6176, 6177, 6178, 6174, 6175, 6262, 6263, 6264, 6350, 6351, 6352,
+    6348, 6349, 6436, 6437, 6438, 6524, 6525, 6526, 6522, 6523, 6610, 6611,
+    6612, 6698, 6699, 6700, 6696, 6697, 6784, 6785, 6786, 6872, 6873, 6874,
+    6870, 6871, 6958, 6959, 6960, 7046, 7047, 7048, 7044, 7045, 7132, 7133,
+    7134, 7220, 7221, 7222, 7218, 7219, 7306, 7307, 7308, 7394, 7395, 7396,
+    7478, 7393, 7566, 7481, 7482, 7654, 7569, 7570, 7309, 7310, 7397, 7398,
+    7399, 7485, 7486, 7487, 7135, 7136, 7223, 7224, 7225, 7311, 7312, 7313,
+    6961, 6962, 7049, 7050, 7051, 7137, 7138, 7139, 6787, 6788, 6875, 6876,
+    6877, 6963, 6964, 6965, 6613, 6614, 6701, 6702, 6703, 6789, 6790, 6791,
+    6439, 6440, 6527, 6528, 6529, 6615, 6616, 6617, 6265, 6266, 6353, 6354,
+    6355, 6441, 6442, 6443, 6091, 6092, 6179, 6180, 6183, 6267, 6268, 6271,
+    5919, 5920, 6007, 6008, 6009, 6095, 6096, 6097, 5569, 5570, 5657, 5658,
+    5659, 5921, 5922, 5923, 5395, 5396, 5483, 5484, 5485, 5571, 5572, 5573,
+    5221, 5222, 5309, 5310, 5311, 5397, 5398, 5399, 5047, 5048, 5135, 5136,
+    5137, 5223, 5224, 5225, 4873, 4874, 4961, 4962, 4963, 5049, 5050, 5051,
+    4699, 4700, 4787, 4788, 4789, 4875, 4876, 4877, 4525, 4526, 4613, 4614,
+    4615, 4701, 4702, 4703, 4351, 4352, 4439, 4440, 4441, 4527, 4528, 4529,
+    4177, 4178, 4265, 4266, 4269, 4353, 4354, 4357, 4005, 4006, 4093, 4094,
+    4095, 4181, 4182, 4183, 3655, 3656, 3743, 3744, 3745, 4007, 4008, 4009,
+    3481, 3482, 3569, 3570, 3571, 3657, 3658, 3659, 3307, 3308, 3395, 3396,
+    3397, 3483, 3484, 3485, 3133, 3134, 3221, 3222, 3223, 3309, 3310, 3311,
+    2959, 2960, 3047, 3048, 3049, 3135, 3136, 3137, 2785, 2786, 2873, 2874,
+    2875, 2961, 2962, 2963, 2611, 2612, 2699, 2700, 2701, 2787, 2788, 2789,
+    2437, 2438, 2525, 2526, 2527, 2613, 2614, 2615, 2263, 2264, 2351, 2352,
+    2355, 2439, 2440, 2443, 2091, 2092, 2179, 2180, 2181, 2267, 2268, 2269,
+    1741, 1742, 1829, 1830, 1831, 2093, 2094, 2095, 1567, 1568, 1655, 1656,
+    1657, 1743, 1744, 1745, 1393, 1394, 1481, 1482, 1483, 1569, 1570, 1571,
+    1219, 1220, 1307, 1308, 1309, 1395, 1396, 1397, 1045, 1046, 1133, 1134,
+    1135, 1221, 1222, 1223, 871, 872, 959, 960, 961, 1047, 1048, 1049,
+    697, 698, 785, 786, 787, 873, 874, 875, 523, 524, 611, 612,
+    613, 699, 700, 701, 788, 789, 876, 877, 878, 964, 965, 966,
+    962, 963, 1050, 1051, 1052, 1138, 1139, 1140, 1136, 1137, 1224, 1225,
+    1226, 1312, 1313, 1314, 1310, 1311, 1398, 1399, 1400, 1486, 1487, 1488,
+    1484, 1485, 1572, 1573, 1574, 1660, 1661, 1662, 1658, 1659, 1746, 1747,
+    1748, 1834, 1835, 1836, 1832, 1833, 2096, 2097, 2098, 2184, 2185, 2186,
+    2182, 2183, 2270, 2271, 2272, 2358, 2359, 2360, 2356, 2357, 2444, 2445,
+    2446, 2532, 2533, 2534, 2528, 2531, 2616, 2619, 2620, 2704, 2707, 2708,
+    2702, 2703, 2790, 2791, 2792, 2878, 2879, 2880, 2876, 2877, 2964, 2965,
+    2966, 3052, 3053, 3054, 3050, 3051, 3138, 3139, 3140, 3226, 3227, 3228,
+    3224, 3225, 3312, 3313, 3314, 3400, 3401, 3402, 3398, 3399, 3486, 3487,
+    3488, 3574, 3575, 3576, 3572, 3573, 3660, 3661, 3662, 3748, 3749, 3750,
+    3746, 3747, 4010, 4011, 4012, 4098, 4099, 4100, 4096, 4097, 4184, 4185,
+    4186, 4272, 4273, 4274, 4270, 4271, 4358, 4359, 4360, 4446, 4447, 4448,
+    4442, 4445, 4530, 4533, 4534, 4618, 4621, 4622, 4616, 4617, 4704, 4705,
+    4706, 4792, 4793, 4794, 4790, 4791, 4878, 4879, 4880, 4966, 4967, 4968,
+    4964, 4965, 5052, 5053, 5054, 5140, 5141, 5142, 5138, 5139, 5226, 5227,
+    5228, 5314, 5315, 5316, 5312, 5313, 5400, 5401, 5402, 5488, 5489, 5490,
+    5486, 5487, 5574, 5575, 5576, 5662, 5663, 5664, 5660, 5661, 5924, 5925,
+    5926, 6012, 6013, 6014, 6010, 6011, 6098, 6099, 6100, 6186, 6187, 6188,
+    6184, 6185, 6272, 6273, 6274, 6360, 6361, 6362, 6356, 6359, 6444, 6447,
+    6448, 6532, 6535, 6536, 6530, 6531, 6618, 6619, 6620, 6706, 6707, 6708,
+    6704, 6705, 6792, 6793, 6794, 6880, 6881, 6882, 6878, 6879, 6966, 6967,
+    6968, 7054, 7055, 7056, 7052, 7053, 7140, 7141, 7142, 7228, 7229, 7230,
+    7226, 7227, 7314, 7315, 7316, 7402, 7403, 7404, 7400, 7401, 7488, 7489,
+    7490, 7576, 7577, 7578, 7317, 7318, 7405, 7406, 7407, 7493, 7494, 7495,
+    7143, 7144, 7231, 7232, 7233, 7319, 7320, 7321, 6969, 6970, 7057, 7058,
+    7059, 7145, 7146, 7147, 6795, 6796, 6883, 6884, 6887, 6971, 6972, 6975,
+    6623, 6624, 6711, 6712, 6713, 6799, 6800, 6801, 6449, 6450, 6537, 6538,
+    6539, 6625, 6626, 6627, 6275, 6276, 6363, 6364, 6365, 6451, 6452, 6453,
+    6101, 6102, 6189, 6190, 6191, 6277, 6278, 6279, 5927, 5928, 6015, 6016,
+    6017, 6103, 6104, 6105, 5577, 5578, 5665, 5666, 5667, 5929, 5930, 5931,
+    5403, 5404, 5491, 5492, 5493, 5579, 5580, 5581, 5229, 5230, 5317, 5318,
+    5319, 5405, 5406, 5407, 5055, 5056, 5143, 5144, 5145, 5231, 5232, 5233,
+    4881, 4882, 4969, 4970, 4973, 5057, 5058, 5061, 4709, 4710, 4797, 4798,
+    4799, 4885, 4886, 4887, 4535, 4536, 4623, 4624, 4625, 4711, 4712, 4713,
+    4361, 4362, 4449, 4450, 4451, 4537, 4538, 4539, 4187, 4188, 4275, 4276,
+    4277, 4363, 4364, 4365, 4013, 4014, 4101, 4102, 4103, 4189, 4190, 4191,
+    3663, 3664, 3751, 3752, 3753, 4015, 4016, 4017, 3489, 3490, 3577, 3578,
+    3579, 3665, 3666, 3667, 3315, 3316, 3403, 3404, 3405, 3491, 3492, 3493,
+    3141, 3142, 3229, 3230, 3231, 3317, 3318, 3319, 2967, 2968, 3055, 3056,
+    3059, 3143, 3144, 3147, 2795, 2796, 2883, 2884, 2885, 2971, 2972, 2973,
+    2621, 2622, 2709, 2710, 2711, 2797, 2798, 2799, 2447, 2448, 2535, 2536,
+    2537, 2623, 2624, 2625, 2273, 2274, 2361, 2362, 2363, 2449, 2450, 2451,
+    2099, 2100, 2187, 2188, 2189, 2275, 2276, 2277, 1749, 1750, 1837, 1838,
+    1839, 2101, 2102, 2103, 1575, 1576, 1663, 1664, 1665, 1751, 1752, 1753,
+    1401, 1402, 1489, 1490, 1491, 1577, 1578, 1579, 1227, 1228, 1315, 1316,
+    1317, 1403, 1404, 1405, 1492, 1493, 1580, 1581, 1582, 1668, 1669, 1670,
+    1666, 1667, 1754, 1755, 1756, 1842, 1843, 1844, 1840, 1841, 2104, 2105,
+    2106, 2192, 2193, 2194, 2190, 2191, 2278, 2279, 2280, 2366, 2367, 2368,
+    2364, 2365, 2452, 2453, 2454, 2540, 2541, 2542, 2538, 2539, 2626, 2627,
+    2628, 2714, 2715, 2716, 2712, 2713, 2800, 2801, 2802, 2888, 2889, 2890,
+    2886, 2887, 2974, 2975, 2976, 3062, 3063, 3064, 3060, 3061, 3148, 3149,
+    3150, 3236, 3237, 3238, 3232, 3235, 3320, 3323, 3324, 3408, 3411, 3412,
+    3406, 3407, 3494, 3495, 3496, 3582, 3583, 3584, 3580, 3581, 3668, 3669,
+    3670, 3756, 3757, 3758, 3754, 3755, 4018, 4019, 4020, 4106, 4107, 4108,
+    4104, 4105, 4192, 4193, 4194, 4280, 4281, 4282, 4278, 4279, 4366, 4367,
+    4368, 4454, 4455, 4456, 4452, 4453, 4540, 4541, 4542, 4628, 4629, 4630,
+    4626, 4627, 4714, 4715, 4716, 4802, 4803, 4804, 4800, 4801, 4888, 4889,
+    4890, 4976, 4977, 4978, 4974, 4975, 5062, 5063, 5064, 5150, 5151, 5152,
+    5146, 5149, 5234, 5237, 5238, 5322, 5325, 5326, 5320, 5321, 5408, 5409,
+    5410, 5496, 5497, 5498, 5494, 5495, 5582, 5583, 5584, 5670, 5671, 5672,
+    5668, 5669, 5932, 5933, 5934, 6020, 6021, 6022, 6018, 6019, 6106, 6107,
+    6108, 6194, 6195, 6196, 6192, 6193, 6280, 6281, 6282, 6368, 6369, 6370,
+    6366, 6367, 6454, 6455, 6456, 6542, 6543, 6544, 6540, 6541, 6628, 6629,
+    6630, 6716, 6717, 6718, 6714, 6715, 6802, 6803, 6804, 6890, 6891, 6892,
+    6888, 6889, 6976, 6977, 6978, 7064, 7065, 7066, 7060, 7063, 7148, 7151,
+    7152, 7236, 7239, 7240, 7234, 7235, 7322, 7323, 7324, 7410, 7411, 7412,
+    7408, 7409, 7496, 7497, 7498, 7584, 7585, 7586, 7327, 7328, 7415, 7416,
+    7417, 7503, 7504, 7505, 7153, 7154, 7241, 7242, 7243, 7329, 7330, 7331,
+    6979, 6980, 7067, 7068, 7069, 7155, 7156, 7157, 6805, 6806, 6893, 6894,
+    6895, 6981, 6982, 6983, 6631, 6632, 6719, 6720, 6721, 6807, 6808, 6809,
+    6457, 6458, 6545, 6546, 6547, 6633, 6634, 6635, 6283, 6284, 6371, 6372,
+    6373, 6459, 6460, 6461, 6109, 6110, 6197, 6198, 6199, 6285, 6286, 6287,
+    5935, 5936, 6023, 6024, 6025, 6111, 6112, 6113, 5585, 5586, 5673, 5674,
+    5677, 5937, 5938, 5941, 5413, 5414, 5501, 5502, 5503, 5589, 5590, 5591,
+    5239, 5240, 5327, 5328, 5329, 5415, 5416, 5417, 5065, 5066, 5153, 5154,
+    5155, 5241, 5242, 5243, 4891, 4892, 4979, 4980, 4981, 5067, 5068, 5069,
+    4717, 4718, 4805, 4806, 4807, 4893, 4894, 4895, 4543, 4544, 4631, 4632,
+    4633, 4719, 4720, 4721, 4369, 4370, 4457, 4458, 4459, 4545, 4546, 4547,
+    4195, 4196, 4283, 4284, 4285, 4371, 4372, 4373, 4021, 4022, 4109, 4110,
+    4111, 4197, 4198, 4199, 3671, 3672, 3759, 3760, 3763, 4023, 4024, 4027,
+    3499, 3500, 3587, 3588, 3589, 3675, 3676, 3677, 3325, 3326, 3413, 3414,
+    3415, 3501, 3502, 3503, 3151, 3152, 3239, 3240, 3241, 3327, 3328, 3329,
+    2977, 2978, 3065, 3066, 3067, 3153, 3154, 3155, 2803, 2804, 2891, 2892,
+    2893, 2979, 2980, 2981, 2629, 2630, 2717, 2718, 2719, 2805, 2806, 2807,
+    2455, 2456, 2543, 2544, 2545, 2631, 2632, 2633, 2281, 2282, 2369, 2370,
+    2371, 2457, 2458, 2459, 2107, 2108, 2195, 2196, 2197, 2283, 2284, 2285,
+    2372, 2373, 2460, 2461, 2462, 2548, 2549, 2550, 2546, 2547, 2634, 2635,
+    2636, 2722, 2723, 2724, 2720, 2721, 2808, 2809, 2810, 2896, 2897, 2898,
+    2894, 2895, 2982, 2983, 2984, 3070, 3071, 3072, 3068, 3069, 3156, 3157,
+    3158, 3244, 3245, 3246, 3242, 3243, 3330, 3331, 3332, 3418, 3419, 3420,
+    3416, 3417, 3504, 3505, 3506, 3592, 3593, 3594, 3590, 3591, 3678, 3679,
+    3680, 3766, 3767, 3768, 3764, 3765, 4028, 4029, 4030, 4116, 4117, 4118,
+    4112, 4115, 4200, 4203, 4204, 4288, 4291, 4292, 4286, 4287, 4374, 4375,
+    4376, 4462, 4463, 4464, 4460, 4461, 4548, 4549, 4550, 4636, 4637, 4638,
+    4634, 4635, 4722, 4723, 4724, 4810, 4811, 4812, 4808, 4809, 4896, 4897,
+    4898, 4984, 4985, 4986, 4982, 4983, 5070, 5071, 5072, 5158, 5159, 5160,
+    5156, 5157, 5244, 5245, 5246, 5332, 5333, 5334, 5330, 5331, 5418, 5419,
+    5420, 5506, 5507, 5508, 5504, 5505, 5592, 5593, 5594, 5680, 5681, 5682,
+    5678, 5679, 5942, 5943, 5944, 6030, 6031, 6032, 6026, 6029, 6114, 6117,
+    6118, 6202, 6205, 6206, 6200, 6201, 6288, 6289, 6290, 6376, 6377, 6378,
+    6374, 6375, 6462, 6463, 6464, 6550, 6551, 6552, 6548, 6549, 6636, 6637,
+    6638, 6724, 6725, 6726, 6722, 6723, 6810, 6811, 6812, 6898, 6899, 6900,
+    6896, 6897, 6984, 6985, 6986, 7072, 7073, 7074, 7070, 7071, 7158, 7159,
+    7160, 7246, 7247, 7248, 7244, 7245, 7332, 7333, 7334, 7420, 7421, 7422,
+    7418, 7419, 7506, 7507, 7508, 7594, 7595, 7596, 7335, 7336, 7423, 7424,
+    7425, 7511, 7512, 7513, 7161, 7162, 7249, 7250, 7251, 7337, 7338, 7339,
+    6987, 6988, 7075, 7076, 7077, 7163, 7164, 7165, 6813, 6814, 6901, 6902,
+    6903, 6989, 6990, 6991, 6639, 6640, 6727, 6728, 6729, 6815, 6816, 6817,
+    6465, 6466, 6553, 6554, 6557, 6641, 6642, 6645, 6293, 6294, 6381, 6382,
+    6383, 6469, 6470, 6471, 6119, 6120, 6207, 6208, 6209, 6295, 6296, 6297,
+    5945, 5946, 6033, 6034, 6035, 6121, 6122, 6123, 5595, 5596, 5683, 5684,
+    5685, 5947, 5948, 5949, 5421, 5422, 5509, 5510, 5511, 5597, 5598, 5599,
+    5247, 5248, 5335, 5336, 5337, 5423, 5424, 5425, 5073, 5074, 5161, 5162,
+    5163, 5249, 5250, 5251, 4899, 4900, 4987, 4988, 4989, 5075, 5076, 5077,
+    4725, 4726, 4813, 4814, 4815, 4901, 4902, 4903, 4551, 4552, 4639, 4640,
+    4643, 4727, 4728, 4731, 4379, 4380, 4467, 4468, 4469, 4555, 4556, 4557,
+    4205, 4206, 4293, 4294, 4295, 4381, 4382, 4383, 4031, 4032, 4119, 4120,
+    4121, 4207, 4208, 4209, 3681, 3682, 3769, 3770, 3771, 4033, 4034, 4035,
+    3507, 3508, 3595, 3596, 3597, 3683, 3684, 3685, 3333, 3334, 3421, 3422,
+    3423, 3509, 3510, 3511, 3159, 3160, 3247, 3248, 3249, 3335, 3336, 3337,
+    2985, 2986, 3073, 3074, 3075, 3161, 3162, 3163, 2811, 2812, 2899, 2900,
+    2901, 2987, 2988, 2989, 3076, 3077, 3164, 3165, 3166, 3252, 3253, 3254,
+    3250, 3251, 3338, 3339, 3340, 3426, 3427, 3428, 3424, 3425, 3512, 3513,
+    3514, 3600, 3601, 3602, 3598, 3599, 3686, 3687, 3688, 3774, 3775, 3776,
+    3772, 3773, 4036, 4037, 4038, 4124, 4125, 4126, 4122, 4123, 4210, 4211,
+    4212, 4298, 4299, 4300, 4296, 4297, 4384, 4385, 4386, 4472, 4473, 4474,
+    4470, 4471, 4558, 4559, 4560, 4646, 4647, 4648, 4644, 4645, 4732, 4733,
+    4734, 4820, 4821, 4822, 4816, 4819, 4904, 4907, 4908, 4992, 4995, 4996,
+    4990, 4991, 5078, 5079, 5080, 5166, 5167, 5168, 5164, 5165, 5252, 5253,
+    5254, 5340, 5341, 5342, 5338, 5339, 5426, 5427, 5428, 5514, 5515, 5516,
+    5512, 5513, 5600, 5601, 5602, 5688, 5689, 5690, 5686, 5687, 5950, 5951,
+    5952, 6038, 6039, 6040, 6036, 6037, 6124, 6125, 6126, 6212, 6213, 6214,
+    6210, 6211, 6298, 6299, 6300, 6386, 6387, 6388, 6384, 6385, 6472, 6473,
+    6474, 6560, 6561, 6562, 6558, 6559, 6646, 6647, 6648, 6734, 6735, 6736,
+    6730, 6733, 6818, 6821, 6822, 6906, 6909, 6910, 6904, 6905, 6992, 6993,
+    6994, 7080, 7081, 7082, 7078, 7079, 7166, 7167, 7168, 7254, 7255, 7256,
+    7252, 7253, 7340, 7341, 7342, 7428, 7429, 7430, 7426, 7427, 7514, 7515,
+    7516, 7602, 7603, 7604, 7343, 7344, 7431, 7432, 7433, 7519, 7520, 7521,
+    7169, 7170, 7257, 7258, 7261, 7345, 7346, 7349, 6997, 6998, 7085, 7086,
+    7087, 7173, 7174, 7175, 6823, 6824, 6911, 6912, 6913, 6999, 7000, 7001,
+    6649, 6650, 6737, 6738, 6739, 6825, 6826, 6827, 6475, 6476, 6563, 6564,
+    6565, 6651, 6652, 6653, 6301, 6302, 6389, 6390, 6391, 6477, 6478, 6479,
+    6127, 6128, 6215, 6216, 6217, 6303, 6304, 6305, 5953, 5954, 6041, 6042,
+    6043, 6129, 6130, 6131, 5603, 5604, 5691, 5692, 5693, 5955, 5956, 5957,
+    5429, 5430, 5517, 5518, 5519, 5605, 5606, 5607, 5255, 5256, 5343, 5344,
+    5347, 5431, 5432, 5435, 5083, 5084, 5171, 5172, 5173, 5259, 5260, 5261,
+    4909, 4910, 4997, 4998, 4999, 5085, 5086, 5087, 4735, 4736, 4823, 4824,
+    4825, 4911, 4912, 4913, 4561, 4562, 4649, 4650, 4651, 4737, 4738, 4739,
+    4387, 4388, 4475, 4476, 4477, 4563, 4564, 4565, 4213, 4214, 4301, 4302,
+    4303, 4389, 4390, 4391, 4039, 4040, 4127, 4128, 4129, 4215, 4216, 4217,
+    3689, 3690, 3777, 3778, 3779, 4041, 4042, 4043, 3515, 3516, 3603, 3604,
+    3605, 3691, 3692, 3693, 3780, 3781, 4044, 4045, 4046, 4132, 4133, 4134,
+    4130, 4131, 4218, 4219, 4220, 4306, 4307, 4308, 4304, 4305, 4392, 4393,
+    4394, 4480, 4481, 4482, 4478, 4479, 4566, 4567, 4568, 4654, 4655, 4656,
+    4652, 4653, 4740, 4741, 4742, 4828, 4829, 4830, 4826, 4827, 4914, 4915,
+    4916, 5002, 5003, 5004, 5000, 5001, 5088, 5089, 5090, 5176, 5177, 5178,
+    5174, 5175, 5262, 5263, 5264, 5350, 5351, 5352, 5348, 5349, 5436, 5437,
+    5438, 5524, 5525, 5526, 5520, 5523, 5608, 5611, 5612, 5696, 5699, 5700,
+    5694, 5695, 5958, 5959, 5960, 6046, 6047, 6048, 6044, 6045, 6132, 6133,
+    6134, 6220, 6221, 6222, 6218, 6219, 6306, 6307, 6308, 6394, 6395, 6396,
+    6392, 6393, 6480, 6481, 6482, 6568, 6569, 6570, 6566, 6567, 6654, 6655,
+    6656, 6742, 6743, 6744, 6740, 6741, 6828, 6829, 6830, 6916, 6917, 6918,
+    6914, 6915, 7002, 7003, 7004, 7090, 7091, 7092, 7088, 7089, 7176, 7177,
+    7178, 7264, 7265, 7266, 7262, 7263, 7350, 7351, 7352, 7438, 7439, 7440,
+    7434, 7437, 7522, 7525, 7526, 7610, 7613, 7614, 7353, 7354, 7441, 7442,
+    7443, 7529, 7530, 7531, 7179, 7180, 7267, 7268, 7269, 7355, 7356, 7357,
+    7005, 7006, 7093, 7094, 7095, 7181, 7182, 7183, 6831, 6832, 6919, 6920,
+    6921, 7007, 7008, 7009, 6657, 6658, 6745, 6746, 6747, 6833, 6834, 6835,
+    6483, 6484, 6571, 6572, 6573, 6659, 6660, 6661, 6309, 6310, 6397, 6398,
+    6399, 6485, 6486, 6487, 6135, 6136, 6223, 6224, 6227, 6311, 6312, 6315,
+    5963, 5964, 6051, 6052, 6053, 6139, 6140, 6141, 5613, 5614, 5701, 5702,
+    5703, 5965, 5966, 5967, 5439, 5440, 5527, 5528, 5529, 5615, 5616, 5617,
+    5265, 5266, 5353, 5354, 5355, 5441, 5442, 5443, 5091, 5092, 5179, 5180,
+    5181, 5267, 5268, 5269, 4917, 4918, 5005, 5006, 5007, 5093, 5094, 5095,
+    4743, 4744, 4831, 4832, 4833, 4919, 4920, 4921, 4569, 4570, 4657, 4658,
+    4659, 4745, 4746, 4747, 4395, 4396, 4483, 4484, 4485, 4571, 4572, 4573,
+    4660, 4661, 4748, 4749, 4750, 4836, 4837, 4838, 4834, 4835, 4922, 4923,
+    4924, 5010, 5011, 5012, 5008, 5009, 5096, 5097, 5098, 5184, 5185, 5186,
+    5182, 5183, 5270, 5271, 5272, 5358, 5359, 5360, 5356, 5357, 5444, 5445,
+    5446, 5532, 5533, 5534, 5530, 5531, 5618, 5619, 5620, 5706, 5707, 5708,
+    5704, 5705, 5968, 5969, 5970, 6056, 6057, 6058, 6054, 6055, 6142, 6143,
+    6144, 6230, 6231, 6232, 6228, 6229, 6316, 6317, 6318, 6404, 6405, 6406,
+    6400, 6403, 6488, 6491, 6492, 6576, 6579, 6580, 6574, 6575, 6662, 6663,
+    6664, 6750, 6751, 6752, 6748, 6749, 6836, 6837, 6838, 6924, 6925, 6926,
+    6922, 6923, 7010, 7011, 7012, 7098, 7099, 7100, 7096, 7097, 7184, 7185,
+    7186, 7272, 7273, 7274, 7270, 7271, 7358, 7359, 7360, 7446, 7447, 7448,
+    7444, 7445, 7532, 7533, 7534, 7620, 7621, 7622, 7361, 7362, 7449, 7450,
+    7451, 7537, 7538, 7539, 7187, 7188, 7275, 7276, 7277, 7363, 7364, 7365,
+    7013, 7014, 7101, 7102, 7103, 7189, 7190, 7191, 6839, 6840, 6927, 6928,
+    6931, 7015, 7016, 7019, 6667, 6668, 6755, 6756, 6757, 6843, 6844, 6845,
+    6493, 6494, 6581, 6582, 6583, 6669, 6670, 6671, 6319, 6320, 6407, 6408,
+    6409, 6495, 6496, 6497, 6145, 6146, 6233, 6234, 6235, 6321, 6322, 6323,
+    5971, 5972, 6059, 6060, 6061, 6147, 6148, 6149, 5621, 5622, 5709, 5710,
+    5711, 5973, 5974, 5975, 5447, 5448, 5535, 5536, 5537, 5623, 5624, 5625,
+    5273, 5274, 5361, 5362, 5363, 5449, 5450, 5451, 5099, 5100, 5187, 5188,
+    5189, 5275, 5276, 5277, 5364, 5365, 5452, 5453, 5454, 5540, 5541, 5542,
+    5538, 5539, 5626, 5627, 5628, 5714, 5715, 5716, 5712, 5713, 5976, 5977,
+    5978, 6064, 6065, 6066, 6062, 6063, 6150, 6151, 6152, 6238, 6239, 6240,
+    6236, 6237, 6324, 6325, 6326, 6412, 6413, 6414, 6410, 6411, 6498, 6499,
+    6500, 6586, 6587, 6588, 6584, 6585, 6672, 6673, 6674, 6760, 6761, 6762,
+    6758, 6759, 6846, 6847, 6848, 6934, 6935, 6936, 6932, 6933, 7020, 7021,
+    7022, 7108, 7109, 7110, 7104, 7107, 7192, 7195, 7196, 7280, 7283, 7284,
+    7278, 7279, 7366, 7367, 7368, 7454, 7455, 7456, 7452, 7453, 7540, 7541,
+    7542, 7628, 7629, 7630, 7371, 7372, 7459, 7460, 7461, 7547, 7548, 7549,
+    7197, 7198, 7285, 7286, 7287, 7373, 7374, 7375, 7023, 7024, 7111, 7112,
+    7113, 7199, 7200, 7201, 6849, 6850, 6937, 6938, 6939, 7025, 7026, 7027,
+    6675, 6676, 6763, 6764, 6765, 6851, 6852, 6853, 6501, 6502, 6589, 6590,
+    6591, 6677, 6678, 6679, 6327, 6328, 6415, 6416, 6417, 6503, 6504, 6505,
+    6153, 6154, 6241, 6242, 6243, 6329, 6330, 6331, 5979, 5980, 6067, 6068,
+    6069, 6155, 6156, 6157, 6244, 6245, 6332, 6333, 6334, 6420, 6421, 6422,
+    6418, 6419, 6506, 6507, 6508, 6594, 6595, 6596, 6592, 6593, 6680, 6681,
+    6682, 6768, 6769, 6770, 6766, 6767, 6854, 6855, 6856, 6942, 6943, 6944,
+    6940, 6941, 7028, 7029, 7030, 7116, 7117, 7118, 7114, 7115, 7202, 7203,
+    7204, 7290, 7291, 7292, 7288, 7289, 7376, 7377, 7378, 7464, 7465, 7466,
+    7462, 7463, 7550, 7551, 7552, 7638, 7639, 7640, 7379, 7380, 7467, 7468,
+    7469, 7555, 7556, 7557, 7205, 7206, 7293, 7294, 7295, 7381, 7382, 7383,
+    7031, 7032, 7119, 7120, 7121, 7207, 7208, 7209, 6857, 6858, 6945, 6946,
+    6947, 7033, 7034, 7035, 6683, 6684, 6771, 6772, 6773, 6859, 6860, 6861,
+    6948, 6949, 7036, 7037, 7038, 7124, 7125, 7126, 7122, 7123, 7210, 7211,
+    7212, 7298, 7299, 7300, 7296, 7297, 7384, 7385, 7386, 7472, 7473, 7474,
+    7470, 7471, 7558, 7559, 7560, 7646, 7647, 7648, 7387, 7388, 7475, 7476,
+    7477, 7563, 7564, 7565,
+};
+
+static const uint16_t bits_19[7744] = {
+    381, 382, 477, 478, 385, 573, 574, 481, 97, 98, 193, 194,
+    195, 289, 290, 291, 8931, 8932, 9027, 9028, 9029, 99, 100, 101,
+    9030, 9031, 102, 103, 104, 198, 199, 200, 196, 197, 292, 293,
+    294, 388, 389, 390, 386, 387, 482, 483, 484, 578, 579, 580,
+    670, 577, 766, 673, 674, 862, 769, 770, 1149, 1150, 1245, 1246,
+    1153, 1341, 1342, 1249, 865, 866, 961, 962, 963, 1057, 1058, 1059,
+    675, 676, 771, 772, 773, 867, 868, 869, 485, 486, 581, 582,
+    583, 677, 678, 679, 295, 296, 391, 392, 393, 487, 488, 489,
+    105, 106, 201, 202, 203, 297, 298, 299, 8939, 8940, 9035, 9036,
+    9037, 107, 108, 109, 9038, 9039, 110, 111, 112, 206, 207, 208,
+    204, 205, 300, 301, 302, 396, 397, 398, 394, 395, 490, 491,
+    492, 586, 587, 588, 584, 585, 680, 681, 682, 776, 777, 778,
+    774, 775, 870, 871, 872, 966, 967, 968, 964, 965, 1060, 1061,
+    1062, 1156, 1157, 1158, 1154, 1155, 1250, 1251, 1252, 1346, 1347, 1348,
+    1438, 1345, 1534, 1441, 1442, 1630, 1537, 1538, 1917, 1918, 2013, 2014,
+    1921, 2109, 2110, 2017, 1633, 1634, 1729, 1730, 1731, 1825, 1826, 1827,
+    1443, 1444, 1539, 1540, 1541, 1635, 1636, 1637, 1253, 1254, 1349, 1350,
+    1351, 1445, 1446, 1447, 1063, 1064, 1159, 1160, 1161, 1255, 1256, 1257,
+    873, 874, 969, 970, 971, 1065, 1066, 1067, 683, 684, 779, 780,
+    781, 875, 876, 877, 493, 494, 589, 590, 591, 685, 686, 687,
+    303, 304, 399, 400, 401, 495, 496, 497, 113, 114, 209, 210,
+    211, 305, 306, 307, 8947, 8948, 9043, 9044, 9045, 115, 116, 117,
+    9046, 9049, 118, 121, 122, 214, 217, 218, 212, 213, 308, 309,
+    310, 404, 405, 406, 402, 403, 498, 499, 500, 594, 595, 596,
+    592, 593, 688, 689, 690, 784, 785, 786, 782, 783, 878, 879,
+    880, 974, 975, 976, 972, 973, 1068, 1069, 1070, 1164, 1165, 1166,
+    1162, 1163, 1258, 1259, 1260, 1354, 1355, 1356, 1352, 1353, 1448, 1449,
+    1450, 1544, 1545, 1546, 1542, 1543, 1638, 1639, 1640, 1734, 1735, 1736,
+    1732, 1733, 1828, 1829, 1830, 1924, 1925, 1926, 1922, 1923, 2018, 2019,
+    2020, 2114, 2115, 2116, 2206, 2113, 2494, 2401, 2402, 2590, 2497, 2498,
+    2877, 2878, 2973, 2974, 2881, 3069, 3070, 2977, 2593, 2594, 2689, 2690,
+    2691, 2785, 2786, 2787, 2403, 2404, 2499, 2500, 2501, 2595, 2596, 2597,
+    2021, 2022, 2117, 2118, 2119, 2405, 2406, 2407, 1831, 1832, 1927, 1928,
+    1929, 2023, 2024, 2025, 1641, 1642, 1737, 1738, 1739, 1833, 1834, 1835,
+    1451, 1452, 1547, 1548, 1549, 1643, 1644, 1645, 1261, 1262, 1357, 1358,
+    1359, 1453, 1454, 1455, 1071, 1072, 1167, 1168, 1169, 1263, 1264, 1265,
+    881, 882, 977, 978, 979, 1073, 1074, 1075, 691, 692, 787, 788,
+    789, 883, 884, 885, 501, 502, 597, 598, 601, 693, 694, 697,
+    313, 314, 409, 410, 411, 505, 506, 507, 123, 124, 219, 220,
+    221, 315, 316, 317, 8957, 8958, 9053, 9054, 9055, 125, 126, 127,
+    9056, 9057, 128, 129, 130, 224, 225, 226, 222, 223, 318, 319,
+    320, 414, 415, 416, 412, 413, 508, 509, 510, 604, 605, 606,
+    602, 603, 698, 699, 700, 794, 795, 796, 790, 793, 886, 889,
+    890, 982, 985, 986, 980, 981, 1076, 1077, 1078, 1172, 1173, 1174,
+    1170, 1171, 1266, 1267, 1268, 1362, 1363, 1364, 1360, 1361, 1456, 1457,
+    1458, 1552, 1553, 1554, 1550, 1551, 1646, 1647, 1648, 1742, 1743, 1744,
+    1740, 1741, 1836, 1837, 1838, 1932, 1933, 1934, 1930, 1931, 2026, 2027,
+    2028, 2122, 2123, 2124, 2120, 2121, 2408, 2409, 2410, 2504, 2505, 2506,
+    2502, 2503, 2598, 2599, 2600, 2694, 2695, 2696, 2692, 2693, 2788, 2789,
+    2790, 2884, 2885, 2886, 2882, 2883, 2978, 2979, 2980, 3074, 3075, 3076,
+    3166, 3073, 3262, 3169, 3170, 3358, 3265, 3266, 3645, 3646, 3741, 3742,
+    3649, 3837, 3838, 3745, 3361, 3362, 3457, 3458, 3459, 3553, 3554, 3555,
+    3171, 3172, 3267, 3268, 3269, 3363, 3364, 3365, 2981, 2982, 3077, 3078,
+    3079, 3173, 3174, 3175, 2791, 2792, 2887, 2888, 2889, 2983, 2984, 2985,
+    2601, 2602, 2697, 2698, 2699, 2793, 2794, 2795, 2411, 2412, 2507, 2508,
+    2509, 2603, 2604, 2605, 2029, 2030, 2125, 2126, 2127, 2413, 2414, 2415,
+    1839, 1840, 1935, 1936, 1937, 2031, 2032, 2033, 1649, 1650, 1745, 1746,
+    1747, 1841, 1842, 1843, 1459, 1460, 1555, 1556, 1557, 1651, 1652, 1653,
+    1269, 1270, 1365, 1366, 1369, 1461, 1462, 1465, 1081, 1082, 1177, 1178,
+    1179, 1273, 1274, 1275, 891, 892, 987, 988, 989, 1083, 1084, 1085,
+    701, 702, 797, 798, 799, 893, 894, 895, 511, 512, 607, 608,
+    609, 703, 704, 705, 321, 322, 417, 418, 419, 513, 514, 515,
+    131, 132, 227, 228, 229, 323, 324, 325, 8965, 8966, 9061, 9062,
+    9063, 133, 134, 135, 9064, 9065, 136, 137, 138, 232, 233, 234,
+    230, 231, 326, 327, 328, 422, 423, 424, 420, 421, 516, 517,
+    518, 612, 613, 614, 610, 611, 706, 707, 708, 802, 803, 804,
+    800, 801, 896, 897, 898, 992, 993, 994, 990, 991, 1086, 1087,
+    1088, 1182, 1183, 1184, 1180, 1181, 1276, 1277, 1278, 1372, 1373, 1374,
+    1370, 1371, 1466, 1467, 1468, 1562, 1563, 1564, 1558, 1561, 1654, 1657,
+    1658, 1750, 1753, 1754, 1748, 1749, 1844, 1845, 1846, 1940, 1941, 1942,
+    1938, 1939, 2034, 2035, 2036, 2130, 2131, 2132, 2128, 2129, 2416, 2417,
+    2418, 2512, 2513, 2514, 2510, 2511, 2606, 2607, 2608, 2702, 2703, 2704,
+    2700, 2701, 2796, 2797, 2798, 2892, 2893, 2894, 2890, 2891, 2986, 2987,
+    2988, 3082, 3083, 3084, 3080, 3081, 3176, 3177, 3178, 3272, 3273, 3274,
+    3270, 3271, 3366, 3367, 3368, 3462, 3463, 3464, 3460, 3461, 3556, 3557,
+    3558, 3652, 3653, 3654, 3650, 3651, 3746, 3747, 3748, 3842, 3843, 3844,
+    3934, 3841, 4030, 3937, 3938, 4126, 4033, 4034, 4413, 4414, 4509, 4510,
+    4417, 4797, 4798, 4705, 4129, 4130, 4225, 4226, 4227, 4321, 4322, 4323,
+    3939, 3940, 4035, 4036, 4037, 4131, 4132, 4133, 3749, 3750, 3845, 3846,
+    3847, 3941, 3942, 3943, 3559, 3560, 3655, 3656, 3657, 3751, 3752, 3753,
+    3369, 3370, 3465, 3466, 3467, 3561, 3562, 3563, 3179, 3180, 3275, 3276,
+    3277, 3371, 3372, 3373, 2989, 2990, 3085, 3086, 3087, 3181, 3182, 3183,
+    2799, 2800, 2895, 2896, 2897, 2991, 2992, 2993, 2609, 2610, 2705, 2706,
+    2707, 2801, 2802, 2803, 2419, 2420, 2515, 2516, 2517, 2611, 2612, 2613,
+    2037, 2038, 2133, 2134, 2137, 2421, 2422, 2425, 1849, 1850, 1945, 1946,
+    1947, 2041, 2042, 2043, 1659, 1660, 1755, 1756, 1757, 1851, 1852, 1853,
+    1469, 1470, 1565, 1566, 1567, 1661, 1662, 1663, 1279, 1280, 1375, 1376,
+    1377, 1471, 1472, 1473, 1089, 1090, 1185, 1186, 1187, 1281, 1282, 1283,
+    899, 900, 995, 996, 997, 1091, 1092, 1093, 709, 710, 805, 806,
+    807, 901, 902, 903, 519, 520, 615, 616, 617, 711, 712, 713,
+    329, 330, 425, 426, 427, 521, 522, 523, 139, 140, 235, 236,
+    237, 331, 332, 333, 8973, 8974, 9069, 9070, 9073, 141, 142, 145,
+    9074, 9075, 146, 147, 148, 242, 243, 244, 238, 241, 334, 337,
+    338, 430, 433, 434, 428, 429, 524, 525, 526, 620, 621, 622,
+    618, 619, 714, 715, 716, 810, 811, 812, 808, 809, 904, 905,
+    906, 1000, 1001, 1002, 998, 999, 1094, 1095, 1096, 1190, 1191, 1192,
+    1188, 1189, 1284, 1285, 1286, 1380, 1381, 1382, 1378, 1379, 1474, 1475,
+    1476, 1570, 1571, 1572, 1568, 1569, 1664, 1665, 1666, 1760, 1761, 1762,
+    1758, 1759, 1854, 1855, 1856, 1950, 1951, 1952, 1948, 1949, 2044, 2045,
+    2046, 2140, 2141, 2142, 2138, 2139, 2426, 2427, 2428, 2522, 2523, 2524,
+    2518, 2521, 2614, 2617, 2618, 2710, 2713, 2714, 2708, 2709, 2804, 2805,
+    2806, 2900, 2901, 2902, 2898, 2899, 2994, 2995, 2996, 3090, 3091, 3092,
+    3088, 3089, 3184, 3185, 3186, 3280, 3281, 3282, 3278, 3279, 3374, 3375,
+    3376, 3470, 3471, 3472, 3468, 3469, 3564, 3565, 3566, 3660, 3661, 3662,
+    3658, 3659, 3754, 3755, 3756, 3850, 3851, 3852, 3848, 3849, 3944, 3945,
+    3946, 4040, 4041, 4042, 4038, 4039, 4134, 4135, 4136, 4230, 4231, 4232,
+    4228, 4229, 4324, 4325, 4326, 4420, 4421, 4422, 4418, 4419, 4706, 4707,
+    4708, 4802, 4803, 4804, 4894, 4801, 4990, 4897, 4898, 5086, 4993, 4994,
+    5373, 5374, 5469, 5470, 5377, 5565, 5566, 5473, 5089, 5090, 5185, 5186,
+    5187, 5281, 5282, 5283, 4899, 4900, 4995, 4996, 4997, 5091, 5092, 5093,
+    4709, 4710, 4805, 4806, 4807, 4901, 4902, 4903, 4327, 4328, 4423, 4424,
+    4425, 4711, 4712, 4713, 4137, 4138, 4233, 4234, 4235, 4329, 4330, 4331,
+    3947, 3948, 4043, 4044, 4045, 4139, 4140, 4141, 3757, 3758, 3853, 3854,
+    3855, 3949, 3950, 3951, 3567, 3568, 3663, 3664, 3665, 3759, 3760, 3761,
+    3377, 3378, 3473, 3474, 3475, 3569, 3570, 3571, 3187, 3188, 3283, 3284,
+    3285, 3379, 3380, 3381, 2997, 2998, 3093, 3094, 3097, 3189, 3190, 3193,
+    2809, 2810, 2905, 2906, 2907, 3001, 3002, 3003, 2619, 2620, 2715, 2716,
+    2717, 2811, 2812, 2813, 2429, 2430, 2525, 2526, 2527, 2621, 2622, 2623,
+    2047, 2048, 2143, 2144, 2145, 2431, 2432, 2433, 1857, 1858, 1953, 1954,
+    1955, 2049, 2050, 2051, 1667, 1668, 1763, 1764, 1765, 1859, 1860, 1861,
+    1477, 1478, 1573, 1574, 1575, 1669, 1670, 1671, 1287, 1288, 1383, 1384,
+    1385, 1479, 1480, 1481, 1097, 1098, 1193, 1194, 1195, 1289, 1290, 1291,
+    907, 908, 1003, 1004, 1005, 1099, 1100, 1101, 717, 718, 813, 814,
+    817, 909, 910, 913, 529, 530, 625, 626, 627, 721, 722, 723,
+    339, 340, 435, 436, 437, 531, 532, 533, 149, 150, 245, 246,
+    247, 341, 342, 343, 8983, 8984, 9079, 9080, 9081, 151, 152, 153,
+    9082, 9083, 154, 155, 156, 250, 251, 252, 248, 249, 344, 345,
+    346, 440, 441, 442, 438, 439, 534, 535, 536, 630, 631, 632,
+    628, 629, 724, 725, 726, 820, 821, 822, 818, 819, 914, 915,
+    916, 1010, 1011, 1012, 1006, 1009, 1102, 1105, 1106, 1198, 1201, 1202,
+    1196, 1197, 1292, 1293, 1294, 1388, 1389, 1390, 1386, 1387, 1482, 1483,
+    1484, 1578, 1579, 1580, 1576, 1577, 1672, 1673, 1674, 1768, 1769, 1770,
+    1766, 1767, 1862, 1863, 1864, 1958, 1959, 1960, 1956, 1957, 2052, 2053,
+    2054, 2148, 2149, 2150, 2146, 2147, 2434, 2435, 2436, 2530, 2531, 2532,
+    2528, 2529, 2624, 2625, 2626, 2720, 2721, 2722, 2718, 2719, 2814, 2815,
+    2816, 2910, 2911, 2912, 2908, 2909, 3004, 3005, 3006, 3100, 3101, 3102,
+    3098, 3099, 3194, 3195, 3196, 3290, 3291, 3292, 3286, 3289, 3382, 3385,
+    3386, 3478, 3481, 3482, 3476, 3477, 3572, 3573, 3574, 3668, 3669, 3670,
+    3666, 3667, 3762, 3763, 3764, 3858, 3859, 3860, 3856, 3857, 3952, 3953,
+    3954, 4048, 4049, 4050, 4046, 4047, 4142, 4143, 4144, 4238, 4239, 4240,
+    4236, 4237, 4332, 4333, 4334, 4428, 4429, 4430, 4426, 4427, 4714, 4715,
+    4716, 4810, 4811, 4812, 4808, 4809, 4904, 4905, 4906, 5000, 5001, 5002,
+    4998, 4999, 5094, 5095, 5096, 5190, 5191, 5192, 5188, 5189, 5284, 5285,
+    5286, 5380, 5381, 5382, 5378, 5379, 5474, 5475, 5476, 5570, 5571, 5572,
+    5662, 5569, 5758, 5665, 5666, 5854, 5761, 5762, 6141, 6142, 6237, 6238,
+    6145, 6333, 6334, 6241, 5857, 5858, 5953, 5954, 5955, 6049, 6050, 6051,
+    5667, 5668, 5763, 5764, 5765, 5859, 5860, 5861, 5477, 5478, 5573, 5574,
+    5575, 5669, 5670, 5671, 5287, 5288, 5383, 5384, 5385, 5479, 5480, 5481,
+    5097, 5098, 5193, 5194, 5195, 5289, 5290, 5291, 4907, 4908, 5003, 5004,
+    5005, 5099, 5100, 5101, 4717, 4718, 4813, 4814, 4815, 4909, 4910, 4911,
+    4335, 4336, 4431, 4432, 4433, 4719, 4720, 4721, 4145, 4146, 4241, 4242,
+    4243, 4337, 4338, 4339, 3955, 3956, 4051, 4052, 4053, 4147, 4148, 4149,
+    3765, 3766, 3861, 3862, 3865, 3957, 3958, 3961, 3577, 3578, 3673, 3674,
+    3675, 3769, 3770, 3771, 3387, 3388, 3483, 3484, 3485, 3579, 3580, 3581,
+    3197, 3198, 3293, 3294, 3295, 3389, 3390, 3391, 3007, 3008, 3103, 3104,
+    3105, 3199, 3200, 3201, 2817, 2818, 2913, 2914, 2915, 3009, 3010, 3011,
+    2627, 2628, 2723, 2724, 2725, 2819, 2820, 2821, 2437, 2438, 2533, 2534,
+    2535, 2629, 2630, 2631, 2055, 2056, 2151, 2152, 2153, 2439, 2440, 2441,
+    1865, 1866, 1961, 1962, 1963, 2057, 2058, 2059, 1675, 1676, 1771, 1772,
+    1773, 1867, 1868, 1869, 1485, 1486, 1581, 1582, 1585, 1677, 1678, 1681,
+    1297, 1298, 1393, 1394, 1395, 1489, 1490, 1491, 1107, 1108, 1203, 1204,
+    1205, 1299, 1300, 1301, 917, 918, 1013, 1014, 1015, 1109, 1110, 1111,
+    727, 728, 823, 824, 825, 919, 920, 921, 537, 538, 633, 634,
+    635, 729, 730, 731, 347, 348, 443, 444, 445, 539, 540, 541,
+    157, 158, 253, 254, 255, 349, 350, 351, 8991, 8992, 9087, 9088,
+    9089, 159, 160, 161, 9090, 9091, 162, 163, 164, 258, 259, 260,
+    256, 257, 352, 353, 354, 448, 449, 450, 446, 447, 542, 543,
+    544, 638, 639, 640, 636, 637, 732, 733, 734, 828, 829, 830,
+    826, 827, 922, 923, 924, 1018, 1019, 1020, 1016, 1017, 1112, 1113,
+    1114, 1208, 1209, 1210, 1206, 1207, 1302, 1303, 1304, 1398, 1399, 1400,
+    1396, 1397, 1492, 1493, 1494, 1588, 1589, 1590, 1586, 1587, 1682, 1683,
+    1684, 1778, 1779, 1780, 1774, 1777, 1870, 1873, 1874, 1966, 1969, 1970,
+    1964, 1965, 2060, 2061, 2062, 2156, 2157, 2158, 2154, 2155, 2442, 2443,
+    2444, 2538, 2539, 2540, 2536, 2537, 2632, 2633, 2634, 2728, 2729, 2730,
+    2726, 2727, 2822, 2823, 2824, 2918, 2919, 2920, 2916, 2917, 3012, 3013,
+    3014, 3108, 3109, 3110, 3106, 3107, 3202, 3203, 3204, 3298, 3299, 3300,
+    3296, 3297, 3392, 3393, 3394, 3488, 3489, 3490, 3486, 3487, 3582, 3583,
+    3584, 3678, 3679, 3680, 3676, 3677, 3772, 3773, 3774, 3868, 3869, 3870,
+    3866, 3867, 3962, 3963, 3964, 4058, 4059, 4060, 4054, 4057, 4150, 4153,
+    4154, 4246, 4249, 4250, 4244, 4245, 4340, 4341, 4342, 4436, 4437, 4438,
+    4434, 4435, 4722, 4723, 4724, 4818, 4819, 4820, 4816, 4817, 4912, 4913,
+    4914, 5008, 5009, 5010, 5006, 5007, 5102, 5103, 5104, 5198, 5199, 5200,
+    5196, 5197, 5292, 5293, 5294, 5388, 5389, 5390, 5386, 5387, 5482, 5483,
+    5484, 5578, 5579, 5580, 5576, 5577, 5672, 5673, 5674, 5768, 5769, 5770,
+    5766, 5767, 5862, 5863, 5864, 5958, 5959, 5960, 5956, 5957, 6052, 6053,
+    6054, 6148, 6149, 6150, 6146, 6147, 6242, 6243, 6244, 6338, 6339, 6340,
+    6430, 6337, 6526, 6433, 6434, 6622, 6529, 6530, 7101, 7102, 7197, 7198,
+    7105, 7293, 7294, 7201, 6625, 6626, 6721, 6722, 6723, 7009, 7010, 7011,
+    6435, 6436, 6531, 6532, 6533, 6627, 6628, 6629, 6245, 6246, 6341, 6342,
+    6343, 6437, 6438, 6439, 6055, 6056, 6151, 6152, 6153, 6247, 6248, 6249,
+    5865, 5866, 5961, 5962, 5963, 6057, 6058, 6059, 5675, 5676, 5771, 5772,
+    5773, 5867, 5868, 5869, 5485, 5486, 5581, 5582, 5583, 5677, 5678, 5679,
+    5295, 5296, 5391, 5392, 5393, 5487, 5488, 5489, 5105, 5106, 5201, 5202,
+    5203, 5297, 5298, 5299, 4915, 4916, 5011, 5012, 5013, 5107, 5108, 5109,
+    4725, 4726, 4821, 4822, 4825, 4917, 4918, 4921, 4345, 4346, 4441, 4442,
+    4443, 4729, 4730, 4731, 4155, 4156, 4251, 4252, 4253, 4347, 4348, 4349,
+    3965, 3966, 4061, 4062, 4063, 4157, 4158, 4159, 3775, 3776, 3871, 3872,
+    3873, 3967, 3968, 3969, 3585, 3586, 3681, 3682, 3683, 3777, 3778, 3779,
+    3395, 3396, 3491, 3492, 3493, 3587, 3588, 3589, 3205, 3206, 3301, 3302,
+    3303, 3397, 3398, 3399, 3015, 3016, 3111, 3112, 3113, 3207, 3208, 3209,
+    2825, 2826, 2921, 2922, 2923, 3017, 3018, 3019, 2635, 2636, 2731, 2732,
+    2733, 2827, 2828, 2829, 2445, 2446, 2541, 2542, 2545, 2637, 2638, 2641,
+    2065, 2066, 2161, 2162, 2163, 2449, 2450, 2451, 1875, 1876, 1971, 1972,
+    1973, 2067, 2068, 2069, 1685, 1686, 1781, 1782, 1783, 1877, 1878, 1879,
+    1495, 1496, 1591, 1592, 1593, 1687, 1688, 1689, 1305, 1306, 1401, 1402,
+    1403, 1497, 1498, 1499, 1115, 1116, 1211, 1212, 1213, 1307, 1308, 1309,
+    925, 926, 1021, 1022, 1023, 1117, 1118, 1119, 735, 736, 831, 832,
+    833, 927, 928, 929, 545, 546, 641, 642, 643, 737, 738, 739,
+    355, 356, 451, 452, 453, 547, 548, 549, 165, 166, 261, 262,
+    265, 357, 358, 361, 9001, 9002, 9097, 9098, 9099, 169, 170, 171,
+    9100, 9101, 172, 173, 174, 268, 269, 270, 266, 267, 362, 363,
+    364, 458, 459, 460, 454, 457, 550, 553, 554, 646, 649, 650,
+    644, 645, 740, 741, 742, 836, 837, 838, 834, 835, 930, 931,
+    932, 1026, 1027, 1028, 1024, 1025, 1120, 1121, 1122, 1216, 1217, 1218,
+    1214, 1215, 1310, 1311, 1312, 1406, 1407, 1408, 1404, 1405, 1500, 1501,
+    1502, 1596, 1597, 1598, 1594, 1595, 1690, 1691, 1692, 1786, 1787, 1788,
+    1784, 1785, 1880, 1881, 1882, 1976, 1977, 1978, 1974, 1975, 2070, 2071,
+    2072, 2166, 2167, 2168, 2164, 2165, 2452, 2453, 2454, 2548, 2549, 2550,
+    2546, 2547, 2642, 2643, 2644, 2738, 2739, 2740, 2734, 2737, 2830, 2833,
+    2834, 2926, 2929, 2930, 2924, 2925, 3020, 3021, 3022, 3116, 3117, 3118,
+    3114, 3115, 3210, 3211, 3212, 3306, 3307, 3308, 3304, 3305, 3400, 3401,
+    3402, 3496, 3497, 3498, 3494, 3495, 3590, 3591, 3592, 3686, 3687, 3688,
+    3684, 3685, 3780, 3781, 3782, 3876, 3877, 3878, 3874, 3875, 3970, 3971,
+    3972, 4066, 4067, 4068, 4064, 4065, 4160, 4161, 4162, 4256, 4257, 4258,
+    4254, 4255, 4350, 4351, 4352, 4446, 4447, 4448, 4444, 4445, 4732, 4733,
+    4734, 4828, 4829, 4830, 4826, 4827, 4922, 4923, 4924, 5018, 5019, 5020,
+    5014, 5017, 5110, 5113, 5114, 5206, 5209, 5210, 5204, 5205, 5300, 5301,
+    5302, 5396, 5397, 5398, 5394, 5395, 5490, 5491, 5492, 5586, 5587, 5588,
+    5584, 5585, 5680, 5681, 5682, 5776, 5777, 5778, 5774, 5775, 5870, 5871,
+    5872, 5966, 5967, 5968, 5964, 5965, 6060, 6061, 6062, 6156, 6157, 6158,
+    6154, 6155, 6250, 6251, 6252, 6346, 6347, 6348, 6344, 6345, 6440, 6441,
+    6442, 6536, 6537, 6538, 6534, 6535, 6630, 6631, 6632, 6726, 6727, 6728,
+    6724, 6725, 7012, 7013, 7014, 7108, 7109, 7110, 7106, 7107, 7202, 7203,
+    7204, 7298, 7299, 7300, 7390, 7297, 7486, 7393, 7394, 7582, 7489, 7490,
+    7869, 7870, 7965, 7966, 7873, 8061, 8062, 7969, 7585, 7586, 7681, 7682,
+    7683, 7777, 7778, 7779, 7395, 7396, 7491, 7492, 7493, 7587, 7588, 7589,
+    7205, 7206, 7301, 7302, 7303, 7397, 7398, 7399, 7015, 7016, 7111, 7112,
+    7113, 7207, 7208, 7209, 6633, 6634, 6729, 6730, 6731, 7017, 7018, 7019,
+    6443, 6444, 6539, 6540, 6541, 6635, 6636, 6637, 6253, 6254, 6349, 6350,
+    6351, 6445, 6446, 6447, 6063, 6064, 6159, 6160, 6161, 6255, 6256, 6257,
+    5873, 5874, 5969, 5970, 5971, 6065, 6066, 6067, 5683, 5684, 5779, 5780,
+    5781, 5875, 5876, 5877, 5493, 5494, 5589, 5590, 5593, 5685, 5686, 5689,
+    5305, 5306, 5401, 5402, 5403, 5497, 5498, 5499, 5115, 5116, 5211, 5212,
+    5213, 5307, 5308, 5309, 4925, 4926, 5021, 5022, 5023, 5117, 5118, 5119,
+    4735, 4736, 4831, 4832, 4833, 4927, 4928, 4929, 4353, 4354, 4449, 4450,
+    4451, 4737, 4738, 4739, 4163, 4164, 4259, 4260, 4261, 4355, 4356, 4357,
+    3973, 3974, 4069, 4070, 4071, 4165, 4166, 4167, 3783, 3784, 3879, 3880,
+    3881, 3975, 3976, 3977, 3593, 3594, 3689, 3690, 3691, 3785, 3786, 3787,
+    3403, 3404, 3499, 3500, 3501, 3595, 3596, 3597, 3213, 3214, 3309, 3310,
+    3313, 3405, 3406, 3409, 3025, 3026, 3121, 3122, 3123, 3217, 3218, 3219,
+    2835, 2836, 2931, 2932, 2933, 3027, 3028, 3029, 2645, 2646, 2741, 2742,
+    2743, 2837, 2838, 2839, 2455, 2456, 2551, 2552, 2553, 2647, 2648, 2649,
+    2073, 2074, 2169, 2170, 2171, 2457, 2458, 2459, 1883, 1884, 1979, 1980,
+    1981, 2075, 2076, 2077, 1693, 1694, 1789, 1790, 1791, 1885, 1886, 1887,
+    1503, 1504, 1599, 1600, 1601, 1695, 1696, 1697, 1313, 1314, 1409, 1410,
+    1411, 1505, 1506, 1507, 1123, 1124, 1219, 1220, 1221, 1315, 1316, 1317,
+    933, 934, 1029, 1030, 1033, 1125, 1126, 1129, 745, 746, 841, 842,
+    843, 937, 938, 939, 555, 556, 651, 652, 653, 747, 748, 749,
+    365, 366, 461, 462, 463, 557, 558, 559, 175, 176, 271, 272,
+    273, 367, 368, 369, 9009, 9010, 9105, 9106, 9107, 177, 178, 179,
+    9108, 9109, 180, 181, 182, 276, 277, 278, 274, 275, 370, 371,
+    372, 466, 467, 468, 464, 465, 560, 561, 562, 656, 657, 658,
+    654, 655, 750, 751, 752, 846, 847, 848, 844, 845, 940, 941,
+    942, 1036, 1037, 1038, 1034, 1035, 1130, 1131, 1132, 1226, 1227, 1228,
+    1222, 1225, 1318, 1321, 1322, 1414, 1417, 1418, 1412, 1413, 1508, 1509,
+    1510, 1604, 1605, 1606, 1602, 1603, 1698, 1699, 1700, 1794, 1795, 1796,
+    1792, 1793, 1888, 1889, 1890, 1984, 1985, 1986, 1982, 1983, 2078, 2079,
+    2080, 2174, 2175, 2176, 2172, 2173, 2460, 2461, 2462, 2556, 2557, 2558,
+    2554, 2555, 2650, 2651, 2652, 2746, 2747, 2748, 2744, 2745, 2840, 2841,
+    2842, 2936, 2937, 2938, 2934, 2935, 3030, 3031, 3032, 3126, 3127, 3128,
+    3124, 3125, 3220, 3221, 3222, 3316, 3317, 3318, 3314, 3315, 3410, 3411,
+    3412, 3506, 3507, 3508, 3502, 3505, 3598, 3601, 3602, 3694, 3697, 3698,
+    3692, 3693, 3788, 3789, 3790, 3884, 3885, 3886, 3882, 3883, 3978, 3979,
+    3980, 4074, 4075, 4076, 4072, 4073, 4168, 4169, 4170, 4264, 4265, 4266,
+    4262, 4263, 4358, 4359, 4360, 4454, 4455, 4456, 4452, 4453, 4740, 4741,
+    4742, 4836, 4837, 4838, 4834, 4835, 4930, 4931, 4932, 5026, 5027, 5028,
+    5024, 5025, 5120, 5121, 5122, 5216, 5217, 5218, 5214, 5215, 5310, 5311,
+    5312, 5406, 5407, 5408, 5404, 5405, 5500, 5501, 5502, 5596, 5597, 5598,
+    5594, 5595, 5690, 5691, 5692, 5786, 5787, 5788, 5782, 5785, 5878, 5881,
+    5882, 5974, 5977, 5978, 5972, 5973, 6068, 6069, 6070, 6164, 6165, 6166,
+    6162, 6163, 6258, 6259, 6260, 6354, 6355, 6356, 6352, 6353, 6448, 6449,
+    6450, 6544, 6545, 6546, 6542, 6543, 6638, 6639, 6640, 6734, 6735, 6736,
+    6732, 6733, 7020, 7021, 7022, 7116, 7117, 7118, 7114, 7115, 7210, 7211,
+    7212, 7306, 7307, 7308, 7304, 7305, 7400, 7401, 7402, 7496, 7497, 7498,
+    7494, 7495, 7590, 7591, 7592, 7686, 7687, 7688, 7684, 7685, 7780, 7781,
+    7782, 7876, 7877, 7878, 7874, 7875, 7970, 7971, 7972, 8066, 8067, 8068,
+    8158, 8065, 8254, 8161, 8162, 8350, 8257, 8258, 8637, 8638, 8733, 8734,
+    8641, 8829, 8830, 8737, 8353, 8354, 8449, 8450, 8451, 8545, 8546, 8547,
+    8163, 8164, 8259, 8260, 8261, 8355, 8356, 8357, 7973, 7974, 8069, 8070,
+    8071, 8165, 8166, 8167, 7783, 7784, 7879, 7880, 7881, 7975, 7976, 7977,
+    7593, 7594, 7689, 7690, 7691, 7785, 7786, 7787, 7403, 7404, 7499, 7500,
+    7501, 7595, 7596, 7597, 7213, 7214, 7309, 7310, 7311, 7405, 7406, 7407,
+    7023, 7024, 7119, 7120, 7121, 7215, 7216, 7217, 6641, 6642, 6737, 6738,
+    6739, 7025, 7026, 7027, 6451, 6452, 6547, 6548, 6549, 6643, 6644, 6645,
+    6261, 6262, 6357, 6358, 6361, 6453, 6454, 6457, 6073, 6074, 6169, 6170,
+    6171, 6265, 6266, 6267, 5883, 5884, 5979, 5980, 5981, 6075, 6076, 6077,
+    5693, 5694, 5789, 5790, 5791, 5885, 5886, 5887, 5503, 5504, 5599, 5600,
+    5601, 5695, 5696, 5697, 5313, 5314, 5409, 5410, 5411, 5505, 5506, 5507,
+    5123, 5124, 5219, 5220, 5221, 5315, 5316, 5317, 4933, 4934, 5029, 5030,
+    5031, 5125, 5126, 5127, 4743, 4744, 4839, 4840, 4841, 4935, 4936, 4937,
+    4361, 4362, 4457, 4458, 4459, 4745, 4746, 4747, 4171, 4172, 4267, 4268,
+    4269, 4363, 4364, 4365, 3981, 3982, 4077, 4078, 4081, 4173, 4174, 4177,
+    3793, 3794, 3889, 3890, 3891, 3985, 3986, 3987, 3603, 3604, 3699, 3700,
+    3701, 3795, 3796, 3797, 3413, 3414, 3509, 3510, 3511, 3605, 3606, 3607,
+    3223, 3224, 3319, 3320, 3321, 3415, 3416, 3417, 3033, 3034, 3129, 3130,
+    3131, 3225, 3226, 3227, 2843, 2844, 2939, 2940, 2941, 3035, 3036, 3037,
+    2653, 2654, 2749, 2750, 2751, 2845, 2846, 2847, 2463, 2464, 2559, 2560,
+    2561, 2655, 2656, 2657, 2081, 2082, 2177, 2178, 2179, 2465, 2466, 2467,
+    1891, 1892, 1987, 1988, 1989, 2083, 2084, 2085, 1701, 1702, 1797, 1798,
+    1801, 1893, 1894, 1897, 1513, 1514, 1609, 1610, 1611, 1705, 1706, 1707,
+    1323, 1324, 1419, 1420, 1421, 1515, 1516, 1517, 1133, 1134, 1229, 1230,
+    1231, 1325, 1326, 1327, 943, 944, 1039, 1040, 1041, 1135, 1136, 1137,
+    753, 754, 849, 850, 851, 945, 946, 947, 563, 564, 659, 660,
+    661, 755, 756, 757, 373, 374, 469, 470, 471, 565, 566, 567,
+    183, 184, 279, 280, 281, 375, 376, 377, 9017, 9018, 9113, 9114,
+    9115, 185, 186, 187, 9116, 9117, 188, 189, 190, 284, 285, 286,
+    282, 283, 378, 379, 380, 474, 475, 476, 472, 473, 568, 569,
+    570, 664, 665, 666, 662, 663, 758, 759, 760, 854, 855, 856,
+    852, 853, 948, 949, 950, 1044, 1045, 1046, 1042, 1043, 1138, 1139,
+    1140, 1234, 1235, 1236, 1232, 1233, 1328, 1329, 1330, 1424, 1425, 1426,
+    1422, 1423, 1518, 1519, 1520, 1614, 1615, 1616, 1612, 1613, 1708, 1709,
+    1710, 1804, 1805, 1806, 1802, 1803, 1898, 1899, 1900, 1994, 1995, 1996,
+    1990, 1993, 2086, 2089, 2090, 2182, 2185, 2186, 2180, 2181, 2468, 2469,
+    2470, 2564, 2565, 2566, 2562, 2563, 2658, 2659, 2660, 2754, 2755, 2756,
+    2752, 2753, 2848, 2849, 2850, 2944, 2945, 2946, 2942, 2943, 3038, 3039,
+    3040, 3134, 3135, 3136, 3132, 3133, 3228, 3229, 3230, 3324, 3325, 3326,
+    3322, 3323, 3418, 3419, 3420, 3514, 3515, 3516, 3512, 3513, 3608, 3609,
+    3610, 3704, 3705, 3706, 3702, 3703, 3798, 3799, 3800, 3894, 3895, 3896,
+    3892, 3893, 3988, 3989, 3990, 4084, 4085, 4086, 4082, 4083, 4178, 4179,
+    4180, 4274, 4275, 4276, 4270, 4273, 4366, 4369, 4370, 4462, 4465, 4466,
+    4460, 4461, 4748, 4749, 4750, 4844, 4845, 4846, 4842, 4843, 4938, 4939,
+    4940, 5034, 5035, 5036, 5032, 5033, 5128, 5129, 5130, 5224, 5225, 5226,
+    5222, 5223, 5318, 5319, 5320, 5414, 5415, 5416, 5412, 5413, 5508, 5509,
+    5510, 5604, 5605, 5606, 5602, 5603, 5698, 5699, 5700, 5794, 5795, 5796,
+    5792, 5793, 5888, 5889, 5890, 5984, 5985, 5986, 5982, 5983, 6078, 6079,
+    6080, 6174, 6175, 6176, 6172, 6173, 6268, 6269, 6270, 6364, 6365, 6366,
+    6362, 6363, 6458, 6459, 6460, 6554, 6555, 6556, 6550, 6553, 6646, 6649,
+    6650, 6742, 6745, 6746, 6740, 6741, 7028, 7029, 7030, 7124, 7125, 7126,
+    7122, 7123, 7218, 7219, 7220, 7314, 7315, 7316, 7312, 7313, 7408, 7409,
+    7410, 7504, 7505, 7506, 7502, 7503, 7598, 7599, 7600, 7694, 7695, 7696,
+    7692, 7693, 7788, 7789, 7790, 7884, 7885, 7886, 7882, 7883, 7978, 7979,
+    7980, 8074, 8075, 8076, 8072, 8073, 8168, 8169, 8170, 8264, 8265, 8266,
+    8262, 8263, 8358, 8359, 8360, 8454, 8455, 8456, 8452, 8453, 8548, 8549,
+    8550, 8644, 8645, 8646, 8642, 8643, 8738, 8739, 8740, 8834, 8835, 8836,
+    8926, 8833, 9022, 8929, 8930, 9118, 9025, 9026, 8741, 8742, 8837, 8838,
+    8839, 8933, 8934, 8935, 8551, 8552, 8647, 8648, 8649, 8743, 8744, 8745,
+    8361, 8362, 8457, 8458, 8459, 8553, 8554, 8555, 8171, 8172, 8267, 8268,
+    8269, 8363, 8364, 8365, 7981, 7982, 8077, 8078, 8079, 8173, 8174, 8175,
+    7791, 7792, 7887, 7888, 7889, 7983, 7984, 7985, 7601, 7602, 7697, 7698,
+    7699, 7793, 7794, 7795, 7411, 7412, 7507, 7508, 7509, 7603, 7604, 7605,
+    7221, 7222, 7317, 7318, 7321, 7413, 7414, 7417, 7033, 7034, 7129, 7130,
+    7131, 7225, 7226, 7227, 6651, 6652, 6747, 6748, 6749, 7035, 7036, 7037,
+    6461, 6462, 6557, 6558, 6559, 6653, 6654, 6655, 6271, 6272, 6367, 6368,
+    6369, 6463, 6464, 6465, 6081, 6082, 6177, 6178, 6179, 6273, 6274, 6275,
+    5891, 5892, 5987, 5988, 5989, 6083, 6084, 6085, 5701, 5702, 5797, 5798,
+    5799, 5893, 5894, 5895, 5511, 5512, 5607, 5608, 5609, 5703, 5704, 5705,
+    5321, 5322, 5417, 5418, 5419, 5513, 5514, 5515, 5131, 5132, 5227, 5228,
+    5229, 5323, 5324, 5325, 4941, 4942, 5037, 5038, 5041, 5133, 5134, 5137,
+    4753, 4754, 4849, 4850, 4851, 4945, 4946, 4947, 4371, 4372, 4467, 4468,
+    4469, 4755, 4756, 4757, 4181, 4182, 4277, 4278, 4279, 4373, 4374, 4375,
+    3991, 3992, 4087, 4088, 4089, 4183, 4184, 4185, 3801, 3802, 3897, 3898,
+    3899, 3993, 3994, 3995, 3611, 3612, 3707, 3708, 3709, 3803, 3804, 3805,
+    3421, 3422, 3517, 3518, 3519, 3613, 3614, 3615, 3231, 3232, 3327, 3328,
+    3329, 3423, 3424, 3425, 3041, 3042, 3137, 3138, 3139, 3233, 3234, 3235,
+    2851, 2852, 2947, 2948, 2949, 3043, 3044, 3045, 2661, 2662, 2757, 2758,
+    2761, 2853, 2854, 2857, 2473, 2474, 2569, 2570, 2571, 2665, 2666, 2667,
+    2091, 2092, 2187, 2188, 2189, 2475, 2476, 2477, 1901, 1902, 1997, 1998,
+    1999, 2093, 2094, 2095, 1711, 1712, 1807, 1808, 1809, 1903, 1904, 1905,
+    1521, 1522, 1617, 1618, 1619, 1713, 1714, 1715, 1331, 1332, 1427, 1428,
+    1429, 1523, 1524, 1525, 1141, 1142, 1237, 1238, 1239, 1333, 1334, 1335,
+    951, 952, 1047, 1048, 1049, 1143, 1144, 1145, 761, 762, 857, 858,
+    859, 953, 954, 955, 571, 572, 667, 668, 669, 763, 764, 765,
+    860, 861, 956, 957, 958, 1052, 1053, 1054, 1050, 1051, 1146, 1147,
+    1148, 1242, 1243, 1244, 1240, 1241, 1336, 1337, 1338, 1432, 1433, 1434,
+    1430, 1431, 1526, 1527, 1528, 1622, 1623, 1624, 1620, 1621, 1716, 1717,
+    1718, 1812, 1813, 1814, 1810, 1811, 1906, 1907, 1908, 2002, 2003, 2004,
+    2000, 2001, 2096, 2097, 2098, 2192, 2193, 2194, 2190, 2191, 2478, 2479,
+    2480, 2574, 2575, 2576, 2572, 2573, 2668, 2669, 2670, 2764, 2765, 2766,
+    2762, 2763, 2858, 2859, 2860, 2954, 2955, 2956, 2950, 2953, 3046, 3049,
+    3050, 3142, 3145, 3146, 3140, 3141, 3236, 3237, 3238, 3332, 3333, 3334,
+    3330, 3331, 3426, 3427, 3428, 3522, 3523, 3524, 3520, 3521, 3616, 3617,
+    3618, 3712, 3713, 3714, 3710, 3711, 3806, 3807, 3808, 3902, 3903, 3904,
+    3900, 3901, 3996, 3997, 3998, 4092, 4093, 4094, 4090, 4091, 4186, 4187,
+    4188, 4282, 4283, 4284, 4280, 4281, 4376, 4377, 4378, 4472, 4473, 4474,
+    4470, 4471, 4758, 4759, 4760, 4854, 4855, 4856, 4852, 4853, 4948, 4949,
+    4950, 5044, 5045, 5046, 5042, 5043, 5138, 5139, 5140, 5234, 5235, 5236,
+    5230, 5233, 5326, 5329, 5330, 5422, 5425, 5426, 5420, 5421, 5516, 5517,
+    5518, 5612, 5613, 5614, 5610, 5611, 5706, 5707, 5708, 5802, 5803, 5804,
+    5800, 5801, 5896, 5897, 5898, 5992, 5993, 5994, 5990, 5991, 6086, 6087,
+    6088, 6182, 6183, 6184, 6180, 6181, 6276, 6277, 6278, 6372, 6373, 6374,
+    6370, 6371, 6466, 6467, 6468, 6562, 6563, 6564, 6560, 6561, 6656, 6657,
+    6658, 6752, 6753, 6754, 6750, 6751, 7038, 7039, 7040, 7134, 7135, 7136,
+    7132, 7133, 7228, 7229, 7230, 7324, 7325, 7326, 7322, 7323, 7418, 7419,
+    7420, 7514, 7515, 7516, 7510, 7513, 7606, 7609, 7610, 7702, 7705, 7706,
+    7700, 7701, 7796, 7797, 7798, 7892, 7893, 7894, 7890, 7891, 7986, 7987,
+    7988, 8082, 8083, 8084, 8080, 8081, 8176, 8177, 8178, 8272, 8273, 8274,
+    8270, 8271, 8366, 8367, 8368, 8462, 8463, 8464, 8460, 8461, 8556, 8557,
+    8558, 8652, 8653, 8654, 8650, 8651, 8746, 8747, 8748, 8842, 8843, 8844,
+    8840, 8841, 8936, 8937, 8938, 9032, 9033, 9034, 8749, 8750, 8845, 8846,
+    8847, 8941, 8942, 8943, 8559, 8560, 8655, 8656, 8657, 8751, 8752, 8753,
+    8369, 8370, 8465, 8466, 8467, 8561, 8562, 8563, 8179, 8180, 8275, 8276,
+    8277, 8371, 8372, 8373, 7989, 7990, 8085, 8086, 8089, 8181, 8182, 8185,
+    7801, 7802, 7897, 7898, 7899, 7993, 7994, 7995, 7611, 7612, 7707, 7708,
+    7709, 7803, 7804, 7805, 7421, 7422, 7517, 7518, 7519, 7613, 7614, 7615,
+    7231, 7232, 7327, 7328, 7329, 7423, 7424, 7425, 7041, 7042, 7137, 7138,
+    7139, 7233, 7234, 7235, 6659, 6660, 6755, 6756, 6757, 7043, 7044, 7045,
+    6469, 6470, 6565, 6566, 6567, 6661, 6662, 6663, 6279, 6280, 6375, 6376,
+    6377, 6471, 6472, 6473, 6089, 6090, 6185, 6186, 6187, 6281, 6282, 6283,
+    5899, 5900, 5995, 5996, 5997, 6091, 6092, 6093, 5709, 5710, 5805, 5806,
+    5809, 5901, 5902, 5905, 5521, 5522, 5617, 5618, 5619, 5713, 5714, 5715,
+    5331, 5332, 5427, 5428, 5429, 5523, 5524, 5525, 5141, 5142, 5237, 5238,
+    5239, 5333, 5334, 5335, 4951, 4952, 5047, 5048, 5049, 5143, 5144, 5145,
+    4761, 4762, 4857, 4858, 4859, 4953, 4954, 4955, 4379, 4380, 4475, 4476,
+    4477, 4763, 4764, 4765, 4189, 4190, 4285, 4286, 4287, 4381, 4382, 4383,
+    3999, 4000, 4095, 4096, 4097, 4191, 4192, 4193, 3809, 3810, 3905, 3906,
+    3907, 4001, 4002, 4003, 3619, 3620, 3715, 3716, 3717, 3811, 3812, 3813,
+    3429, 3430, 3525, 3526, 3529, 3621, 3622, 3625, 3241, 3242, 3337, 3338,
+    3339, 3433, 3434, 3435, 3051, 3052, 3147, 3148, 3149, 3243, 3244, 3245,
+    2861, 2862, 2957, 2958, 2959, 3053, 3054, 3055, 2671, 2672, 2767, 2768,
+    2769, 2863, 2864, 2865, 2481, 2482, 2577, 2578, 2579, 2673, 2674, 2675,
+    2099, 2100, 2195, 2196, 2197, 2483, 2484, 2485, 1909, 1910, 2005, 2006,
+    2007, 2101, 2102, 2103, 1719, 1720, 1815, 1816, 1817, 1911, 1912, 1913,
+    1529, 1530, 1625, 1626, 1627, 1721, 1722, 1723, 1339, 1340, 1435, 1436,
+    1437, 1531, 1532, 1533, 1628, 1629, 1724, 1725, 1726, 1820, 1821, 1822,
+    1818, 1819, 1914, 1915, 1916, 2010, 2011, 2012, 2008, 2009, 2104, 2105,
+    2106, 2200, 2201, 2202, 2198, 2199, 2486, 2487, 2488, 2582, 2583, 2584,
+    2580, 2581, 2676, 2677, 2678, 2772, 2773, 2774, 2770, 2771, 2866, 2867,
+    2868, 2962, 2963, 2964, 2960, 2961, 3056, 3057, 3058, 3152, 3153, 3154,
+    3150, 3151, 3246, 3247, 3248, 3342, 3343, 3344, 3340, 3341, 3436, 3437,
+    3438, 3532, 3533, 3534, 3530, 3531, 3626, 3627, 3628, 3722, 3723, 3724,
+    3718, 3721, 3814, 3817, 3818, 3910, 3913, 3914, 3908, 3909, 4004, 4005,
+    4006, 4100, 4101, 4102, 4098, 4099, 4194, 4195, 4196, 4290, 4291, 4292,
+    4288, 4289, 4384, 4385, 4386, 4480, 4481, 4482, 4478, 4479, 4766, 4767,
+    4768, 4862, 4863, 4864, 4860, 4861, 4956, 4957, 4958, 5052, 5053, 5054,
+    5050, 5051, 5146, 5147, 5148, 5242, 5243, 5244, 5240, 5241, 5336, 5337,
+    5338, 5432, 5433, 5434, 5430, 5431, 5526, 5527, 5528, 5622, 5623, 5624,
+    5620, 5621, 5716, 5717, 5718, 5812, 5813, 5814, 5810, 5811, 5906, 5907,
+    5908, 6002, 6003, 6004, 5998, 6001, 6094, 6097, 6098, 6190, 6193, 6194,
+    6188, 6189, 6284, 6285, 6286, 6380, 6381, 6382, 6378, 6379, 6474, 6475,
+    6476, 6570, 6571, 6572, 6568, 6569, 6664, 6665, 6666, 6760, 6761, 6762,
+    6758, 6759, 7046, 7047, 7048, 7142, 7143, 7144, 7140, 7141, 7236, 7237,
+    7238, 7332, 7333, 7334, 7330, 7331, 7426, 7427, 7428, 7522, 7523, 7524,
+    7520, 7521, 7616, 7617, 7618, 7712, 7713, 7714, 7710, 7711, 7806, 7807,
+    7808, 7902, 7903, 7904, 7900, 7901, 7996, 7997, 7998, 8092, 8093, 8094,
+    8090, 8091, 8186, 8187, 8188, 8282, 8283, 8284, 8278, 8281, 8374, 8377,
+    8378, 8470, 8473, 8474, 8468, 8469, 8564, 8565, 8566, 8660, 8661, 8662,
+    8658, 8659, 8754, 8755, 8756, 8850, 8851, 8852, 8848, 8849, 8944, 8945,
+    8946, 9040, 9041, 9042, 8757, 8758, 8853, 8854, 8857, 8949, 8950, 8953,
+    8569, 8570, 8665, 8666, 8667, 8761, 8762, 8763, 8379, 8380, 8475, 8476,
+    8477, 8571, 8572, 8573, 8189, 8190, 8285, 8286, 8287, 8381, 8382, 8383,
+    7999, 8000, 8095, 8096, 8097, 8191, 8192, 8193, 7809, 7810, 7905, 7906,
+    7907, 8001, 8002, 8003, 7619, 7620, 7715, 7716, 7717, 7811, 7812, 7813,
+    7429, 7430, 7525, 7526, 7527, 7621, 7622, 7623, 7239, 7240, 7335, 7336,
+    7337, 7431, 7432, 7433, 7049, 7050, 7145, 7146, 7147, 7241, 7242, 7243,
+    6667, 6668, 6763, 6764, 6765, 7051, 7052, 7053, 6477, 6478, 6573, 6574,
+    6577, 6669, 6670, 6673, 6289, 6290, 6385, 6386, 6387, 6481, 6482, 6483,
+    6099, 6100, 6195, 6196, 6197, 6291, 6292, 6293, 5909, 5910, 6005, 6006,
+    6007, 6101, 6102, 6103, 5719, 5720, 5815, 5816, 5817, 5911, 5912, 5913,
+    5529, 5530, 5625, 5626, 5627, 5721, 5722, 5723, 5339, 5340, 5435, 5436,
+    5437, 5531, 5532, 5533, 5149, 5150, 5245, 5246, 5247, 5341, 5342, 5343,
+    4959, 4960, 5055, 5056, 5057, 5151, 5152, 5153, 4769, 4770, 4865, 4866,
+    4867, 4961, 4962, 4963, 4387, 4388, 4483, 4484, 4485, 4771, 4772, 4773,
+    4197, 4198, 4293, 4294, 4297, 4389, 4390, 4393, 4009, 4010, 4105, 4106,
+    4107, 4201, 4202, 4203, 3819, 3820, 3915, 3916, 3917, 4011, 4012, 4013,
+    3629, 3630, 3725, 3726, 3727, 3821, 3822, 3823, 3439, 3440, 3535, 3536,
+    3537, 3631, 3632, 3633, 3249, 3250, 3345, 3346, 3347, 3441, 3442, 3443,
+    3059, 3060, 3155, 3156, 3157, 3251, 3252, 3253, 2869, 2870, 2965, 2966,
+    2967, 3061, 3062, 3063, 2679, 2680, 2775, 2776, 2777, 2871, 2872, 2873,
+    2489, 2490, 2585, 2586, 2587, 2681, 2682, 2683, 2107, 2108, 2203, 2204,
+    2205, 2491, 2492, 2493, 2588, 2589, 2684, 2685, 2686, 2780, 2781, 2782,
+    2778, 2779, 2874, 2875, 2876, 2970, 2971, 2972, 2968, 2969, 3064, 3065,
+    3066, 3160, 3161, 3162, 3158, 3159, 3254, 3255, 3256, 3350, 3351, 3352,
+    3348, 3349, 3444, 3445, 3446, 3540, 3541, 3542, 3538, 3539, 3634, 3635,
+    3636, 3730, 3731, 3732, 3728, 3729, 3824, 3825, 3826, 3920, 3921, 3922,
+    3918, 3919, 4014, 4015, 4016, 4110, 4111, 4112, 4108, 4109, 4204, 4205,
+    4206, 4300, 4301, 4302, 4298, 4299, 4394, 4395, 4396, 4490, 4491, 4492,
+    4486, 4489, 4774, 4777, 4778, 4870, 4873, 4874, 4868, 4869, 4964, 4965,
+    4966, 5060, 5061, 5062, 5058, 5059, 5154, 5155, 5156, 5250, 5251, 5252,
+    5248, 5249, 5344, 5345, 5346, 5440, 5441, 5442, 5438, 5439, 5534, 5535,
+    5536, 5630, 5631, 5632, 5628, 5629, 5724, 5725, 5726, 5820, 5821, 5822,
+    5818, 5819, 5914, 5915, 5916, 6010, 6011, 6012, 6008, 6009, 6104, 6105,
+    6106, 6200, 6201, 6202, 6198, 6199, 6294, 6295, 6296, 6390, 6391, 6392,
+    6388, 6389, 6484, 6485, 6486, 6580, 6581, 6582, 6578, 6579, 6674, 6675,
+    6676, 6770, 6771, 6772, 6766, 6769, 7054, 7057, 7058, 7150, 7153, 7154,
+    7148, 7149, 7244, 7245, 7246, 7340, 7341, 7342, 7338, 7339, 7434, 7435,
+    7436, 7530, 7531, 7532, 7528, 7529, 7624, 7625, 7626, 7720, 7721, 7722,
+    7718, 7719, 7814, 7815, 7816, 7910, 7911, 7912, 7908, 7909, 8004, 8005,
+    8006, 8100, 8101, 8102, 8098, 8099, 8194, 8195, 8196, 8290, 8291, 8292,
+    8288, 8289, 8384, 8385, 8386, 8480, 8481, 8482, 8478, 8479, 8574, 8575,
+    8576, 8670, 8671, 8672, 8668, 8669, 8764, 8765, 8766, 8860, 8861, 8862,
+    8858, 8859, 8954, 8955, 8956, 9050, 9051, 9052, 8767, 8768, 8863, 8864,
+    8865, 8959, 8960, 8961, 8577, 8578, 8673, 8674, 8675, 8769, 8770, 8771,
+    8387, 8388, 8483, 8484, 8485, 8579, 8580, 8581, 8197, 8198, 8293, 8294,
+    8295, 8389, 8390, 8391, 8007, 8008, 8103, 8104, 8105, 8199, 8200, 8201,
+    7817, 7818, 7913, 7914, 7915, 8009, 8010, 8011, 7627, 7628, 7723, 7724,
+    7725, 7819, 7820, 7821, 7437, 7438, 7533, 7534, 7537, 7629, 7630, 7633,
+    7249, 7250, 7345, 7346, 7347, 7441, 7442, 7443, 7059, 7060, 7155, 7156,
+    7157, 7251, 7252, 7253, 6677, 6678, 6773, 6774, 6775, 7061, 7062, 7063,
+    6487, 6488, 6583, 6584, 6585, 6679, 6680, 6681, 6297, 6298, 6393, 6394,
+    6395, 6489, 6490, 6491, 6107, 6108, 6203, 6204, 6205, 6299, 6300, 6301,
+    5917, 5918, 6013, 6014, 6015, 6109, 6110, 6111, 5727, 5728, 5823, 5824,
+    5825, 5919, 5920, 5921, 5537, 5538, 5633, 5634, 5635, 5729, 5730, 5731,
+    5347, 5348, 5443, 5444, 5445, 5539, 5540, 5541, 5157, 5158, 5253, 5254,
+    5257, 5349, 5350, 5353, 4969, 4970, 5065, 5066, 5067, 5161, 5162, 5163,
+    4779, 4780, 4875, 4876, 4877, 4971, 4972, 4973, 4397, 4398, 4493, 4494,
+    4495, 4781, 4782, 4783, 4207, 4208, 4303, 4304, 4305, 4399, 4400, 4401,
+    4017, 4018, 4113, 4114, 4115, 4209, 4210, 4211, 3827, 3828, 3923, 3924,
+    3925, 4019, 4020, 4021, 3637, 3638, 3733, 3734, 3735, 3829, 3830, 3831,
+    3447, 3448, 3543, 3544, 3545, 3639, 3640, 3641, 3257, 3258, 3353, 3354,
+    3355, 3449, 3450, 3451, 3067, 3068, 3163, 3164, 3165, 3259, 3260, 3261,
+    3356, 3357, 3452, 3453, 3454, 3548, 3549, 3550, 3546, 3547, 3642, 3643,
+    3644, 3738, 3739, 3740, 3736, 3737, 3832, 3833, 3834, 3928, 3929, 3930,
+    3926, 3927, 4022, 4023, 4024, 4118, 4119, 4120, 4116, 4117, 4212, 4213,
+    4214, 4308, 4309, 4310, 4306, 4307, 4402, 4403, 4404, 4498, 4499, 4500,
+    4496, 4497, 4784, 4785, 4786, 4880, 4881, 4882, 4878, 4879, 4974, 4975,
+    4976, 5070, 5071, 5072, 5068, 5069, 5164, 5165, 5166, 5260, 5261, 5262,
+    5258, 5259, 5354, 5355, 5356, 5450, 5451, 5452, 5446, 5449, 5542, 5545,
+    5546, 5638, 5641, 5642, 5636, 5637, 5732, 5733, 5734, 5828, 5829, 5830,
+    5826, 5827, 5922, 5923, 5924, 6018, 6019, 6020, 6016, 6017, 6112, 6113,
+    6114, 6208, 6209, 6210, 6206, 6207, 6302, 6303, 6304, 6398, 6399, 6400,
+    6396, 6397, 6492, 6493, 6494, 6588, 6589, 6590, 6586, 6587, 6682, 6683,
+    6684, 6778, 6779, 6780, 6776, 6777, 7064, 7065, 7066, 7160, 7161, 7162,
+    7158, 7159, 7254, 7255, 7256, 7350, 7351, 7352, 7348, 7349, 7444, 7445,
+    7446, 7540, 7541, 7542, 7538, 7539, 7634, 7635, 7636, 7730, 7731, 7732,
+    7726, 7729, 7822, 7825, 7826, 7918, 7921, 7922, 7916, 7917, 8012, 8013,
+    8014, 8108, 8109, 8110, 8106, 8107, 8202, 8203, 8204, 8298, 8299, 8300,
+    8296, 8297, 8392, 8393, 8394, 8488, 8489, 8490, 8486, 8487, 8582, 8583,
+    8584, 8678, 8679, 8680, 8676, 8677, 8772, 8773, 8774, 8868, 8869, 8870,
+    8866, 8867, 8962, 8963, 8964, 9058, 9059, 9060, 8775, 8776, 8871, 8872,
+    8873, 8967, 8968, 8969, 8585, 8586, 8681, 8682, 8683, 8777, 8778, 8779,
+    8395, 8396, 8491, 8492, 8493, 8587, 8588, 8589, 8205, 8206, 8301, 8302,
+    8305, 8397, 8398, 8401, 8017, 8018, 8113, 8114, 8115, 8209, 8210, 8211,
+    7827, 7828, 7923, 7924, 7925, 8019, 8020, 8021, 7637, 7638, 7733, 7734,
+    7735, 7829, 7830, 7831, 7447, 7448, 7543, 7544, 7545, 7639, 7640, 7641,
+    7257, 7258, 7353, 7354, 7355, 7449, 7450, 7451, 7067, 7068, 7163, 7164,
+    7165, 7259, 7260, 7261, 6685, 6686, 6781, 6782, 6783, 7069, 7070, 7071,
+    6495, 6496, 6591, 6592, 6593, 6687, 6688, 6689, 6305, 6306, 6401, 6402,
+    6403, 6497, 6498, 6499, 6115, 6116, 6211, 6212, 6213, 6307, 6308, 6309,
+    5925, 5926, 6021, 6022, 6025, 6117, 6118, 6121, 5737, 5738, 5833, 5834,
+    5835, 5929, 5930, 5931, 5547, 5548, 5643, 5644, 5645, 5739, 5740, 5741,
+    5357, 5358, 5453, 5454, 5455, 5549, 5550, 5551, 5167, 5168, 5263, 5264,
+    5265, 5359, 5360, 5361, 4977, 4978, 5073, 5074, 5075, 5169, 5170, 5171,
+    4787, 4788, 4883, 4884, 4885, 4979, 4980, 4981, 4405, 4406, 4501, 4502,
+    4503, 4789, 4790, 4791, 4215, 4216, 4311, 4312, 4313, 4407, 4408, 4409,
+    4025, 4026, 4121, 4122, 4123, 4217, 4218, 4219, 3835, 3836, 3931, 3932,
+    3933, 4027, 4028, 4029, 4124, 4125, 4220, 4221, 4222, 4316, 4317, 4318,
+    4314, 4315, 4410, 4411, 4412, 4506, 4507, 4508, 4504, 4505, 4792, 4793,
+    4794, 4888, 4889, 4890, 4886, 4887, 4982, 4983, 4984, 5078, 5079, 5080,
+    5076, 5077, 5172, 5173, 5174, 5268, 5269, 5270, 5266, 5267, 5362, 5363,
+    5364, 5458, 5459, 5460, 5456, 5457, 5552, 5553, 5554, 5648, 5649, 5650,
+    5646, 5647, 5742, 5743, 5744, 5838, 5839, 5840, 5836, 5837, 5932, 5933,
+    5934, 6028, 6029, 6030, 6026, 6027, 6122, 6123, 6124, 6218, 6219, 6220,
+    6214, 6217, 6310, 6313, 6314, 6406, 6409, 6410, 6404, 6405, 6500, 6501,
+    6502, 6596, 6597, 6598, 6594, 6595, 6690, 6691, 6692, 6786, 6787, 6788,
+    6784, 6785, 7072, 7073, 7074, 7168, 7169, 7170, 7166, 7167, 7262, 7263,
+    7264, 7358, 7359, 7360, 7356, 7357, 7452, 7453, 7454, 7548, 7549, 7550,
+    7546, 7547, 7642, 7643, 7644, 7738, 7739, 7740, 7736, 7737, 7832, 7833,
+    7834, 7928, 7929, 7930, 7926, 7927, 8022, 8023, 8024, 8118, 8119, 8120,
+    8116, 8117, 8212, 8213, 8214, 8308, 8309, 8310, 8306, 8307, 8402, 8403,
+    8404, 8498, 8499, 8500, 8494, 8497, 8590, 8593, 8594, 8686, 8689, 8690,
+    8684, 8685, 8780, 8781, 8782, 8876, 8877, 8878, 8874, 8875, 8970, 8971,
+    8972, 9066, 9067, 9068, 8785, 8786, 8881, 8882, 8883, 8977, 8978, 8979,
+    8595, 8596, 8691, 8692, 8693, 8787, 8788, 8789, 8405, 8406, 8501, 8502,
+    8503, 8597, 8598, 8599, 8215, 8216, 8311, 8312, 8313, 8407, 8408, 8409,
+    8025, 8026, 8121, 8122, 8123, 8217, 8218, 8219, 7835, 7836, 7931, 7932,
+    7933, 8027, 8028, 8029, 7645, 7646, 7741, 7742, 7743, 7837, 7838, 7839,
+    7455, 7456, 7551, 7552, 7553, 7647, 7648, 7649, 7265, 7266, 7361, 7362,
+    7363, 7457, 7458, 7459, 7075, 7076, 7171, 7172, 7173, 7267, 7268, 7269,
+    6693, 6694, 6789, 6790, 6793, 7077, 7078, 7081, 6505, 6506, 6601, 6602,
+    6603, 6697, 6698, 6699, 6315, 6316, 6411, 6412, 6413, 6507, 6508, 6509,
+    6125, 6126, 6221, 6222, 6223, 6317, 6318, 6319, 5935, 5936, 6031, 6032,
+    6033, 6127, 6128, 6129, 5745, 5746, 5841, 5842, 5843, 5937, 5938, 5939,
+    5555, 5556, 5651, 5652, 5653, 5747, 5748, 5749, 5365, 5366, 5461, 5462,
+    5463, 5557, 5558, 5559, 5175, 5176, 5271, 5272, 5273, 5367, 5368, 5369,
+    4985, 4986, 5081, 5082, 5083, 5177, 5178, 5179, 4795, 4796, 4891, 4892,
+    4893, 4987, 4988, 4989, 5084, 5085, 5180, 5181, 5182, 5276, 5277, 5278,
+    5274, 5275, 5370, 5371, 5372, 5466, 5467, 5468, 5464, 5465, 5560, 5561,
+    5562, 5656, 5657, 5658, 5654, 5655, 5750, 5751, 5752, 5846, 5847, 5848,
+    5844, 5845, 5940, 5941, 5942, 6036, 6037, 6038, 6034, 6035, 6130, 6131,
+    6132, 6226, 6227, 6228, 6224, 6225, 6320, 6321, 6322, 6416, 6417, 6418,
+    6414, 6415, 6510, 6511, 6512, 6606, 6607, 6608, 6604, 6605, 6700, 6701,
+    6702, 6796, 6797, 6798, 6794, 6795, 7082, 7083, 7084, 7178, 7179, 7180,
+    7174, 7177, 7270, 7273, 7274, 7366, 7369, 7370, 7364, 7365, 7460, 7461,
+    7462, 7556, 7557, 7558, 7554, 7555, 7650, 7651, 7652, 7746, 7747, 7748,
+    7744, 7745, 7840, 7841, 7842, 7936, 7937, 7938, 7934, 7935, 8030, 8031,
+    8032, 8126, 8127, 8128, 8124, 8125, 8220, 8221, 8222, 8316, 8317, 8318,
+    8314, 8315, 8410, 8411, 8412, 8506, 8507, 8508, 8504, 8505, 8600, 8601,
+    8602, 8696, 8697, 8698, 8694, 8695, 8790, 8791, 8792, 8886, 8887, 8888,
+    8884, 8885, 8980, 8981, 8982, 9076, 9077, 9078, 8793, 8794, 8889, 8890,
+    8891, 8985, 8986, 8987, 8603, 8604, 8699, 8700, 8701, 8795, 8796, 8797,
+    8413, 8414, 8509, 8510, 8511, 8605, 8606, 8607, 8223, 8224, 8319, 8320,
+    8321, 8415, 8416, 8417, 8033, 8034, 8129, 8130, 8131, 8225, 8226, 8227,
+    7843, 7844, 7939, 7940, 7941, 8035, 8036, 8037, 7653, 7654, 7749, 7750,
+    7753, 7845, 7846, 7849, 7465, 7466, 7561, 7562, 7563, 7657, 7658, 7659,
+    7275, 7276, 7371, 7372, 7373, 7467, 7468, 7469, 7085, 7086, 7181, 7182,
+    7183, 7277, 7278, 7279, 6703, 6704, 6799, 6800, 6801, 7087, 7088, 7089,
+    6513, 6514, 6609, 6610, 6611, 6705, 6706, 6707, 6323, 6324, 6419, 6420,
+    6421, 6515, 6516, 6517, 6133, 6134, 6229, 6230, 6231, 6325, 6326, 6327,
+    5943, 5944, 6039, 6040, 6041, 6135, 6136, 6137, 5753, 5754, 5849, 5850,
+    5851, 5945, 5946, 5947, 5563, 5564, 5659, 5660, 5661, 5755, 5756, 5757,
+    5852, 5853, 5948, 5949, 5950, 6044, 6045, 6046, 6042, 6043, 6138, 6139,
+    6140, 6234, 6235, 6236, 6232, 6233, 6328, 6329, 6330, 6424, 6425, 6426,
+    6422, 6423, 6518, 6519, 6520, 6614, 6615, 6616, 6612, 6613, 6708, 6709,
+    6710, 6804, 6805, 6806, 6802, 6803, 7090, 7091, 7092, 7186, 7187, 7188,
+    7184, 7185, 7280, 7281, 7282, 7376, 7377, 7378, 7374, 7375, 7470, 7471,
+    7472, 7566, 7567, 7568, 7564, 7565, 7660, 7661, 7662, 7756, 7757, 7758,
+    7754, 7755, 7850, 7851, 7852, 7946, 7947, 7948, 7942, 7945, 8038, 8041,
+    8042, 8134, 8137, 8138, 8132, 8133, 8228, 8229, 8230, 8324, 8325, 8326,
+    8322, 8323, 8418, 8419, 8420, 8514, 8515, 8516, 8512, 8513, 8608, 8609,
+    8610, 8704, 8705, 8706, 8702, 8703, 8798, 8799, 8800, 8894, 8895, 8896,
+    8892, 8893, 8988, 8989, 8990, 9084, 9085, 9086, 8801, 8802, 8897, 8898,
+    8899, 8993, 8994, 8995, 8611, 8612, 8707, 8708, 8709, 8803, 8804, 8805,
+    8421, 8422, 8517, 8518, 8521, 8613, 8614, 8617, 8233, 8234, 8329, 8330,
+    8331, 8425, 8426, 8427, 8043, 8044, 8139, 8140, 8141, 8235, 8236, 8237,
+    7853, 7854, 7949, 7950, 7951, 8045, 8046, 8047, 7663, 7664, 7759, 7760,
+    7761, 7855, 7856, 7857, 7473, 7474, 7569, 7570, 7571, 7665, 7666, 7667,
+    7283, 7284, 7379, 7380, 7381, 7475, 7476, 7477, 7093, 7094, 7189, 7190,
+    7191, 7285, 7286, 7287, 6711, 6712, 6807, 6808, 6809, 7095, 7096, 7097,
+    6521, 6522, 6617, 6618, 6619, 6713, 6714, 6715, 6331, 6332, 6427, 6428,
+    6429, 6523, 6524, 6525, 6620, 6621, 6716, 6717, 6718, 6812, 6813, 6814,
+    6810, 6811, 7098, 7099, 7100, 7194, 7195, 7196, 7192, 7193, 7288, 7289,
+    7290, 7384, 7385, 7386, 7382, 7383, 7478, 7479, 7480, 7574, 7575, 7576,
+    7572, 7573, 7668, 7669, 7670, 7764, 7765, 7766, 7762, 7763, 7858, 7859,
+    7860, 7954, 7955, 7956, 7952, 7953, 8048, 8049, 8050, 8144, 8145, 8146,
+    8142, 8143, 8238, 8239, 8240, 8334, 8335, 8336, 8332, 8333, 8428, 8429,
+    8430, 8524, 8525, 8526, 8522, 8523, 8618, 8619, 8620, 8714, 8715, 8716,
+    8710, 8713, 8806, 8809, 8810, 8902, 8905, 8906, 8900, 8901, 8996, 8997,
+    8998, 9092, 9093, 9094, 8811, 8812, 8907, 8908, 8909, 9003, 9004, 9005,
+    8621, 8622, 8717, 8718, 8719, 8813, 8814, 8815, 8431, 8432, 8527, 8528,
+    8529, 8623, 8624, 8625, 8241, 8242, 8337, 8338, 8339, 8433, 8434, 8435,
+    8051, 8052, 8147, 8148, 8149, 8243, 8244, 8245, 7861, 7862, 7957, 7958,
+    7959, 8053, 8054, 8055, 7671, 7672, 7767, 7768, 7769, 7863, 7864, 7865,
+    7481, 7482, 7577, 7578, 7579, 7673, 7674, 7675, 7291, 7292, 7387, 7388,
+    7389, 7483, 7484, 7485, 7580, 7581, 7676, 7677, 7678, 7772, 7773, 7774,
+    7770, 7771, 7866, 7867, 7868, 7962, 7963, 7964, 7960, 7961, 8056, 8057,
+    8058, 8152, 8153, 8154, 8150, 8151, 8246, 8247, 8248, 8342, 8343, 8344,
+    8340, 8341, 8436, 8437, 8438, 8532, 8533, 8534, 8530, 8531, 8626, 8627,
+    8628, 8722, 8723, 8724, 8720, 8721, 8816, 8817, 8818, 8912, 8913, 8914,
+    8910, 8911, 9006, 9007, 9008, 9102, 9103, 9104, 8819, 8820, 8915, 8916,
+    8917, 9011, 9012, 9013, 8629, 8630, 8725, 8726, 8727, 8821, 8822, 8823,
+    8439, 8440, 8535, 8536, 8537, 8631, 8632, 8633, 8249, 8250, 8345, 8346,
+    8347, 8441, 8442, 8443, 8059, 8060, 8155, 8156, 8157, 8251, 8252, 8253,
+    8348, 8349, 8444, 8445, 8446, 8540, 8541, 8542, 8538, 8539, 8634, 8635,
+    8636, 8730, 8731, 8732, 8728, 8729, 8824, 8825, 8826, 8920, 8921, 8922,
+    8918, 8919, 9014, 9015, 9016, 9110, 9111, 9112, 8827, 8828, 8923, 8924,
+    8925, 9019, 9020, 9021,
+};
+
+static const uint16_t bits_20[9216] = {
+    413, 414, 517, 518, 417, 621, 622, 521, 105, 106, 209, 210,
+    211, 313, 314, 315, 10507, 10508, 10611, 10612, 10613, 107, 108, 109,
+    10614, 10615, 110, 111, 112, 214, 215, 216, 212, 213, 316, 317,
+    318, 420, 421, 422, 418, 419, 522, 523, 524, 626, 627, 628,
+    726, 625, 830, 729, 730, 934, 833, 834, 1245, 1246, 1349, 1350,
+    1249, 1453, 1454, 1353, 937, 938, 1041, 1042, 1043, 1145, 1146, 1147,
+    731, 732, 835, 836, 837, 939, 940, 941, 525, 526, 629, 630,
+    631, 733, 734, 735, 319, 320, 423, 424, 425, 527, 528, 529,
+    113, 114, 217, 218, 219, 321, 322, 323, 10515, 10516, 10619, 10620,
+    10621, 115, 116, 117, 10622, 10623, 118, 119, 120, 222, 223, 224,
+    220, 221, 324, 325, 326, 428, 429, 430, 426, 427, 530, 531,
+    532, 634, 635, 636, 632, 633, 736, 737, 738, 840, 841, 842,
+    838, 839, 942, 943, 944, 1046, 1047, 1048, 1044, 1045, 1148, 1149,
+    1150, 1252, 1253, 1254, 1250, 1251, 1354, 1355, 1356, 1458, 1459, 1460,
+    1558, 1457, 1662, 1561, 1562, 1766, 1665, 1666, 2077, 2078, 2181, 2182,
+    2081, 2285, 2286, 2185, 1769, 1770, 1873, 1874, 1875, 1977, 1978, 1979,
+    1563, 1564, 1667, 1668, 1669, 1771, 1772, 1773, 1357, 1358, 1461, 1462,
+    1463, 1565, 1566, 1567, 1151, 1152, 1255, 1256, 1257, 1359, 1360, 1361,
+    945, 946, 1049, 1050, 1051, 1153, 1154, 1155, 739, 740, 843, 844,
+    845, 947, 948, 949, 533, 534, 637, 638, 639, 741, 742, 743,
+    327, 328, 431, 432, 433, 535, 536, 537, 121, 122, 225, 226,
+    227, 329, 330, 331, 10523, 10524, 10627, 10628, 10629, 123, 124, 125,
+    10630, 10631, 126, 127, 128, 230, 231, 232, 228, 229, 332, 333,
+    334, 436, 437, 438, 434, 435, 538, 539, 540, 642, 643, 644,
+    640, 641, 744, 745, 746, 848, 849, 850, 846, 847, 950, 951,
+    952, 1054, 1055, 1056, 1052, 1053, 1156, 1157, 1158, 1260, 1261, 1262,
+    1258, 1259, 1362, 1363, 1364, 1466, 1467, 1468, 1464, 1465, 1568, 1569,
+    1570, 1672, 1673, 1674, 1670, 1671, 1774, 1775, 1776, 1878, 1879, 1880,
+    1876, 1877, 1980, 1981, 1982, 2084, 2085, 2086, 2082, 2083, 2186, 2187,
+    2188, 2290, 2291, 2292, 2390, 2289, 2494, 2393, 2394, 2598, 2497, 2498,
+    3117, 3118, 3221, 3222, 3121, 3325, 3326, 3225, 2809, 2810, 2913, 2914,
+    2915, 3017, 3018, 3019, 2395, 2396, 2499, 2500, 2501, 2811, 2812, 2813,
+    2189, 2190, 2293, 2294, 2295, 2397, 2398, 2399, 1983, 1984, 2087, 2088,
+    2089, 2191, 2192, 2193, 1777, 1778, 1881, 1882, 1883, 1985, 1986, 1987,
+    1571, 1572, 1675, 1676, 1677, 1779, 1780, 1781, 1365, 1366, 1469, 1470,
+    1471, 1573, 1574, 1575, 1159, 1160, 1263, 1264, 1265, 1367, 1368, 1369,
+    953, 954, 1057, 1058, 1059, 1161, 1162, 1163, 747, 748, 851, 852,
+    853, 955, 956, 957, 541, 542, 645, 646, 647, 749, 750, 751,
+    335, 336, 439, 440, 443, 543, 544, 547, 131, 132, 235, 236,
+    237, 339, 340, 341, 10533, 10534, 10637, 10638, 10639, 133, 134, 135,
+    10640, 10641, 136, 137, 138, 240, 241, 242, 238, 239, 342, 343,
+    344, 446, 447, 448, 444, 445, 548, 549, 550, 652, 653, 654,
+    648, 651, 752, 755, 756, 856, 859, 860, 854, 855, 958, 959,
+    960, 1062, 1063, 1064, 1060, 1061, 1164, 1165, 1166, 1268, 1269, 1270,
+    1266, 1267, 1370, 1371, 1372, 1474, 1475, 1476, 1472, 1473, 1576, 1577,
+    1578, 1680, 1681, 1682, 1678, 1679, 1782, 1783, 1784, 1886, 1887, 1888,
+    1884, 1885, 1988, 1989, 1990, 2092, 2093, 2094, 2090, 2091, 2194, 2195,
+    2196, 2298, 2299, 2300, 2296, 2297, 2400, 2401, 2402, 2504, 2505, 2506,
+    2502, 2503, 2814, 2815, 2816, 2918, 2919, 2920, 2916, 2917, 3020, 3021,
+    3022, 3124, 3125, 3126, 3122, 3123, 3226, 3227, 3228, 3330, 3331, 3332,
+    3430, 3329, 3534, 3433, 3434, 3638, 3537, 3538, 3949, 3950, 4053, 4054,
+    3953, 4157, 4158, 4057, 3641, 3642, 3745, 3746, 3747, 3849, 3850, 3851,
+    3435, 3436, 3539, 3540, 3541, 3643, 3644, 3645, 3229, 3230, 3333, 3334,
+    3335, 3437, 3438, 3439, 3023, 3024, 3127, 3128, 3129, 3231, 3232, 3233,
+    2817, 2818, 2921, 2922, 2923, 3025, 3026, 3027, 2403, 2404, 2507, 2508,
+    2509, 2819, 2820, 2821, 2197, 2198, 2301, 2302, 2303, 2405, 2406, 2407,
+    1991, 1992, 2095, 2096, 2097, 2199, 2200, 2201, 1785, 1786, 1889, 1890,
+    1891, 1993, 1994, 1995, 1579, 1580, 1683, 1684, 1685, 1787, 1788, 1789,
+    1373, 1374, 1477, 1478, 1479, 1581, 1582, 1583, 1167, 1168, 1271, 1272,
+    1275, 1375, 1376, 1379, 963, 964, 1067, 1068, 1069, 1171, 1172, 1173,
+    757, 758, 861, 862, 863, 965, 966, 967, 551, 552, 655, 656,
+    657, 759, 760, 761, 345, 346, 449, 450, 451, 553, 554, 555,
+    139, 140, 243, 244, 245, 347, 348, 349, 10541, 10542, 10645, 10646,
+    10647, 141, 142, 143, 10648, 10649, 144, 145, 146, 248, 249, 250,
+    246, 247, 350, 351, 352, 454, 455, 456, 452, 453, 556, 557,
+    558, 660, 661, 662, 658, 659, 762, 763, 764, 866, 867, 868,
+    864, 865, 968, 969, 970, 1072, 1073, 1074, 1070, 1071, 1174, 1175,
+    1176, 1278, 1279, 1280, 1276, 1277, 1380, 1381, 1382, 1484, 1485, 1486,
+    1480, 1483, 1584, 1587, 1588, 1688, 1691, 1692, 1686, 1687, 1790, 1791,
+    1792, 1894, 1895, 1896, 1892, 1893, 1996, 1997, 1998, 2100, 2101, 2102,
+    2098, 2099, 2202, 2203, 2204, 2306, 2307, 2308, 2304, 2305, 2408, 2409,
+    2410, 2512, 2513, 2514, 2510, 2511, 2822, 2823, 2824, 2926, 2927, 2928,
+    2924, 2925, 3028, 3029, 3030, 3132, 3133, 3134, 3130, 3131, 3234, 3235,
+    3236, 3338, 3339, 3340, 3336, 3337, 3440, 3441, 3442, 3544, 3545, 3546,
+    3542, 3543, 3646, 3647, 3648, 3750, 3751, 3752, 3748, 3749, 3852, 3853,
+    3854, 3956, 3957, 3958, 3954, 3955, 4058, 4059, 4060, 4162, 4163, 4164,
+    4262, 4161, 4366, 4265, 4266, 4470, 4369, 4370, 4781, 4782, 4885, 4886,
+    4785, 4989, 4990, 4889, 4473, 4474, 4577, 4578, 4579, 4681, 4682, 4683,
+    4267, 4268, 4371, 4372, 4373, 4475, 4476, 4477, 4061, 4062, 4165, 4166,
+    4167, 4269, 4270, 4271, 3855, 3856, 3959, 3960, 3961, 4063, 4064, 4065,
+    3649, 3650, 3753, 3754, 3755, 3857, 3858, 3859, 3443, 3444, 3547, 3548,
+    3549, 3651, 3652, 3653, 3237, 3238, 3341, 3342, 3343, 3445, 3446, 3447,
+    3031, 3032, 3135, 3136, 3137, 3239, 3240, 3241, 2825, 2826, 2929, 2930,
+    2931, 3033, 3034, 3035, 2411, 2412, 2515, 2516, 2517, 2827, 2828, 2829,
+    2205, 2206, 2309, 2310, 2311, 2413, 2414, 2415, 1999, 2000, 2103, 2104,
+    2107, 2207, 2208, 2211, 1795, 1796, 1899, 1900, 1901, 2003, 2004, 2005,
+    1589, 1590, 1693, 1694, 1695, 1797, 1798, 1799, 1383, 1384, 1487, 1488,
+    1489, 1591, 1592, 1593, 1177, 1178, 1281, 1282, 1283, 1385, 1386, 1387,
+    971, 972, 1075, 1076, 1077, 1179, 1180, 1181, 765, 766, 869, 870,
+    871, 973, 974, 975, 559, 560, 663, 664, 665, 767, 768, 769,
+    353, 354, 457, 458, 459, 561, 562, 563, 147, 148, 251, 252,
+    253, 355, 356, 357, 10549, 10550, 10653, 10654, 10655, 149, 150, 151,
+    10656, 10657, 152, 153, 154, 256, 257, 258, 254, 255, 358, 359,
+    360, 462, 463, 464, 460, 461, 564, 565, 566, 668, 669, 670,
+    666, 667, 770, 771, 772, 874, 875, 876, 872, 873, 976, 977,
+    978, 1080, 1081, 1082, 1078, 1079, 1182, 1183, 1184, 1286, 1287, 1288,
+    1284, 1285, 1388, 1389, 1390, 1492, 1493, 1494, 1490, 1491, 1594, 1595,
+    1596, 1698, 1699, 1700, 1696, 1697, 1800, 1801, 1802, 1904, 1905, 1906,
+    1902, 1903, 2006, 2007, 2008, 2110, 2111, 2112, 2108, 2109, 2212, 2213,
+    2214, 2316, 2317, 2318, 2312, 2315, 2416, 2419, 2420, 2520, 2523, 2524,
+    2518, 2519, 2830, 2831, 2832, 2934, 2935, 2936, 2932, 2933, 3036, 3037,
+    3038, 3140, 3141, 3142, 3138, 3139, 3242, 3243, 3244, 3346, 3347, 3348,
+    3344, 3345, 3448, 3449, 3450, 3552, 3553, 3554, 3550, 3551, 3654, 3655,
+    3656, 3758, 3759, 3760, 3756, 3757, 3860, 3861, 3862, 3964, 3965, 3966,
+    3962, 3963, 4066, 4067, 4068, 4170, 4171, 4172, 4168, 4169, 4272, 4273,
+    4274, 4376, 4377, 4378, 4374, 4375, 4478, 4479, 4480, 4582, 4583, 4584,
+    4580, 4581, 4684, 4685, 4686, 4788, 4789, 4790, 4786, 4787, 4890, 4891,
+    4892, 4994, 4995, 4996, 5094, 4993, 5198, 5097, 5098, 5302, 5201, 5202,
+    5821, 5822, 5925, 5926, 5825, 6029, 6030, 5929, 5513, 5514, 5617, 5618,
+    5619, 5721, 5722, 5723, 5099, 5100, 5203, 5204, 5205, 5515, 5516, 5517,
+    4893, 4894, 4997, 4998, 4999, 5101, 5102, 5103, 4687, 4688, 4791, 4792,
+    4793, 4895, 4896, 4897, 4481, 4482, 4585, 4586, 4587, 4689, 4690, 4691,
+    4275, 4276, 4379, 4380, 4381, 4483, 4484, 4485, 4069, 4070, 4173, 4174,
+    4175, 4277, 4278, 4279, 3863, 3864, 3967, 3968, 3969, 4071, 4072, 4073,
+    3657, 3658, 3761, 3762, 3763, 3865, 3866, 3867, 3451, 3452, 3555, 3556,
+    3557, 3659, 3660, 3661, 3245, 3246, 3349, 3350, 3351, 3453, 3454, 3455,
+    3039, 3040, 3143, 3144, 3147, 3247, 3248, 3251, 2835, 2836, 2939, 2940,
+    2941, 3043, 3044, 3045, 2421, 2422, 2525, 2526, 2527, 2837, 2838, 2839,
+    2215, 2216, 2319, 2320, 2321, 2423, 2424, 2425, 2009, 2010, 2113, 2114,
+    2115, 2217, 2218, 2219, 1803, 1804, 1907, 1908, 1909, 2011, 2012, 2013,
+    1597, 1598, 1701, 1702, 1703, 1805, 1806, 1807, 1391, 1392, 1495, 1496,
+    1497, 1599, 1600, 1601, 1185, 1186, 1289, 1290, 1291, 1393, 1394, 1395,
+    979, 980, 1083, 1084, 1085, 1187, 1188, 1189, 773, 774, 877, 878,
+    879, 981, 982, 983, 567, 568, 671, 672, 673, 775, 776, 777,
+    361, 362, 465, 466, 469, 569, 570, 573, 157, 158, 261, 262,
+    263, 365, 366, 367, 10559, 10560, 10663, 10664, 10665, 159, 160, 161,
+    10666, 10667, 162, 163, 164, 266, 267, 268, 264, 265, 368, 369,
+    370, 472, 473, 474, 470, 471, 574, 575, 576, 678, 679, 680,
+    674, 677, 778, 781, 782, 882, 885, 886, 880, 881, 984, 985,
+    986, 1088, 1089, 1090, 1086, 1087, 1190, 1191, 1192, 1294, 1295, 1296,
+    1292, 1293, 1396, 1397, 1398, 1500, 1501, 1502, 1498, 1499, 1602, 1603,
+    1604, 1706, 1707, 1708, 1704, 1705, 1808, 1809, 1810, 1912, 1913, 1914,
+    1910, 1911, 2014, 2015, 2016, 2118, 2119, 2120, 2116, 2117, 2220, 2221,
+    2222, 2324, 2325, 2326, 2322, 2323, 2426, 2427, 2428, 2530, 2531, 2532,
+    2528, 2529, 2840, 2841, 2842, 2944, 2945, 2946, 2942, 2943, 3046, 3047,
+    3048, 3150, 3151, 3152, 3148, 3149, 3252, 3253, 3254, 3356, 3357, 3358,
+    3352, 3355, 3456, 3459, 3460, 3560, 3563, 3564, 3558, 3559, 3662, 3663,
+    3664, 3766, 3767, 3768, 3764, 3765, 3868, 3869, 3870, 3972, 3973, 3974,
+    3970, 3971, 4074, 4075, 4076, 4178, 4179, 4180, 4176, 4177, 4280, 4281,
+    4282, 4384, 4385, 4386, 4382, 4383, 4486, 4487, 4488, 4590, 4591, 4592,
+    4588, 4589, 4692, 4693, 4694, 4796, 4797, 4798, 4794, 4795, 4898, 4899,
+    4900, 5002, 5003, 5004, 5000, 5001, 5104, 5105, 5106, 5208, 5209, 5210,
+    5206, 5207, 5518, 5519, 5520, 5622, 5623, 5624, 5620, 5621, 5724, 5725,
+    5726, 5828, 5829, 5830, 5826, 5827, 5930, 5931, 5932, 6034, 6035, 6036,
+    6134, 6033, 6238, 6137, 6138, 6342, 6241, 6242, 6653, 6654, 6757, 6758,
+    6657, 6861, 6862, 6761, 6345, 6346, 6449, 6450, 6451, 6553, 6554, 6555,
+    6139, 6140, 6243, 6244, 6245, 6347, 6348, 6349, 5933, 5934, 6037, 6038,
+    6039, 6141, 6142, 6143, 5727, 5728, 5831, 5832, 5833, 5935, 5936, 5937,
+    5521, 5522, 5625, 5626, 5627, 5729, 5730, 5731, 5107, 5108, 5211, 5212,
+    5213, 5523, 5524, 5525, 4901, 4902, 5005, 5006, 5007, 5109, 5110, 5111,
+    4695, 4696, 4799, 4800, 4801, 4903, 4904, 4905, 4489, 4490, 4593, 4594,
+    4595, 4697, 4698, 4699, 4283, 4284, 4387, 4388, 4389, 4491, 4492, 4493,
+    4077, 4078, 4181, 4182, 4183, 4285, 4286, 4287, 3871, 3872, 3975, 3976,
+    3979, 4079, 4080, 4083, 3667, 3668, 3771, 3772, 3773, 3875, 3876, 3877,
+    3461, 3462, 3565, 3566, 3567, 3669, 3670, 3671, 3255, 3256, 3359, 3360,
+    3361, 3463, 3464, 3465, 3049, 3050, 3153, 3154, 3155, 3257, 3258, 3259,
+    2843, 2844, 2947, 2948, 2949, 3051, 3052, 3053, 2429, 2430, 2533, 2534,
+    2535, 2845, 2846, 2847, 2223, 2224, 2327, 2328, 2329, 2431, 2432, 2433,
+    2017, 2018, 2121, 2122, 2123, 2225, 2226, 2227, 1811, 1812, 1915, 1916,
+    1917, 2019, 2020, 2021, 1605, 1606, 1709, 1710, 1711, 1813, 1814, 1815,
+    1399, 1400, 1503, 1504, 1505, 1607, 1608, 1609, 1193, 1194, 1297, 1298,
+    1301, 1401, 1402, 1405, 989, 990, 1093, 1094, 1095, 1197, 1198, 1199,
+    783, 784, 887, 888, 889, 991, 992, 993, 577, 578, 681, 682,
+    683, 785, 786, 787, 371, 372, 475, 476, 477, 579, 580, 581,
+    165, 166, 269, 270, 271, 373, 374, 375, 10567, 10568, 10671, 10672,
+    10673, 167, 168, 169, 10674, 10675, 170, 171, 172, 274, 275, 276,
+    272, 273, 376, 377, 378, 480, 481, 482, 478, 479, 582, 583,
+    584, 686, 687, 688, 684, 685, 788, 789, 790, 892, 893, 894,
+    890, 891, 994, 995, 996, 1098, 1099, 1100, 1096, 1097, 1200, 1201,
+    1202, 1304, 1305, 1306, 1302, 1303, 1406, 1407, 1408, 1510, 1511, 1512,
+    1506, 1509, 1610, 1613, 1614, 1714, 1717, 1718, 1712, 1713, 1816, 1817,
+    1818, 1920, 1921, 1922, 1918, 1919, 2022, 2023, 2024, 2126, 2127, 2128,
+    2124, 2125, 2228, 2229, 2230, 2332, 2333, 2334, 2330, 2331, 2434, 2435,
+    2436, 2538, 2539, 2540, 2536, 2537, 2848, 2849, 2850, 2952, 2953, 2954,
+    2950, 2951, 3054, 3055, 3056, 3158, 3159, 3160, 3156, 3157, 3260, 3261,
+    3262, 3364, 3365, 3366, 3362, 3363, 3466, 3467, 3468, 3570, 3571, 3572,
+    3568, 3569, 3672, 3673, 3674, 3776, 3777, 3778, 3774, 3775, 3878, 3879,
+    3880, 3982, 3983, 3984, 3980, 3981, 4084, 4085, 4086, 4188, 4189, 4190,
+    4184, 4187, 4288, 4291, 4292, 4392, 4395, 4396, 4390, 4391, 4494, 4495,
+    4496, 4598, 4599, 4600, 4596, 4597, 4700, 4701, 4702, 4804, 4805, 4806,
+    4802, 4803, 4906, 4907, 4908, 5010, 5011, 5012, 5008, 5009, 5112, 5113,
+    5114, 5216, 5217, 5218, 5214, 5215, 5526, 5527, 5528, 5630, 5631, 5632,
+    5628, 5629, 5732, 5733, 5734, 5836, 5837, 5838, 5834, 5835, 5938, 5939,
+    5940, 6042, 6043, 6044, 6040, 6041, 6144, 6145, 6146, 6248, 6249, 6250,
+    6246, 6247, 6350, 6351, 6352, 6454, 6455, 6456, 6452, 6453, 6556, 6557,
+    6558, 6660, 6661, 6662, 6658, 6659, 6762, 6763, 6764, 6866, 6867, 6868,
+    6966, 6865, 7070, 6969, 6970, 7174, 7073, 7074, 7485, 7486, 7589, 7590,
+    7489, 7693, 7694, 7593, 7177, 7178, 7281, 7282, 7283, 7385, 7386, 7387,
+    6971, 6972, 7075, 7076, 7077, 7179, 7180, 7181, 6765, 6766, 6869, 6870,
+    6871, 6973, 6974, 6975, 6559, 6560, 6663, 6664, 6665, 6767, 6768, 6769,
+    6353, 6354, 6457, 6458, 6459, 6561, 6562, 6563, 6147, 6148, 6251, 6252,
+    6253, 6355, 6356, 6357, 5941, 5942, 6045, 6046, 6047, 6149, 6150, 6151,
+    5735, 5736, 5839, 5840, 5841, 5943, 5944, 5945, 5529, 5530, 5633, 5634,
+    5635, 5737, 5738, 5739, 5115, 5116, 5219, 5220, 5221, 5531, 5532, 5533,
+    4909, 4910, 5013, 5014, 5015, 5117, 5118, 5119, 4703, 4704, 4807, 4808,
+    4811, 4911, 4912, 4915, 4499, 4500, 4603, 4604, 4605, 4707, 4708, 4709,
+    4293, 4294, 4397, 4398, 4399, 4501, 4502, 4503, 4087, 4088, 4191, 4192,
+    4193, 4295, 4296, 4297, 3881, 3882, 3985, 3986, 3987, 4089, 4090, 4091,
+    3675, 3676, 3779, 3780, 3781, 3883, 3884, 3885, 3469, 3470, 3573, 3574,
+    3575, 3677, 3678, 3679, 3263, 3264, 3367, 3368, 3369, 3471, 3472, 3473,
+    3057, 3058, 3161, 3162, 3163, 3265, 3266, 3267, 2851, 2852, 2955, 2956,
+    2957, 3059, 3060, 3061, 2437, 2438, 2541, 2542, 2543, 2853, 2854, 2855,
+    2231, 2232, 2335, 2336, 2337, 2439, 2440, 2441, 2025, 2026, 2129, 2130,
+    2133, 2233, 2234, 2237, 1821, 1822, 1925, 1926, 1927, 2029, 2030, 2031,
+    1615, 1616, 1719, 1720, 1721, 1823, 1824, 1825, 1409, 1410, 1513, 1514,
+    1515, 1617, 1618, 1619, 1203, 1204, 1307, 1308, 1309, 1411, 1412, 1413,
+    997, 998, 1101, 1102, 1103, 1205, 1206, 1207, 791, 792, 895, 896,
+    897, 999, 1000, 1001, 585, 586, 689, 690, 691, 793, 794, 795,
+    379, 380, 483, 484, 485, 587, 588, 589, 173, 174, 277, 278,
+    279, 381, 382, 383, 10575, 10576, 10679, 10680, 10681, 175, 176, 177,
+    10682, 10683, 178, 179, 180, 282, 283, 284, 280, 281, 384, 385,
+    386, 488, 489, 490, 486, 487, 590, 591, 592, 694, 695, 696,
+    692, 693, 796, 797, 798, 900, 901, 902, 898, 899, 1002, 1003,
+    1004, 1106, 1107, 1108, 1104, 1105, 1208, 1209, 1210, 1312, 1313, 1314,
+    1310, 1311, 1414, 1415, 1416, 1518, 1519, 1520, 1516, 1517, 1620, 1621,
+    1622, 1724, 1725, 1726, 1722, 1723, 1826, 1827, 1828, 1930, 1931, 1932,
+    1928, 1929, 2032, 2033, 2034, 2136, 2137, 2138, 2134, 2135, 2238, 2239,
+    2240, 2342, 2343, 2344, 2338, 2341, 2442, 2445, 2446, 2546, 2549, 2550,
+    2544, 2545, 2856, 2857, 2858, 2960, 2961, 2962, 2958, 2959, 3062, 3063,
+    3064, 3166, 3167, 3168, 3164, 3165, 3268, 3269, 3270, 3372, 3373, 3374,
+    3370, 3371, 3474, 3475, 3476, 3578, 3579, 3580, 3576, 3577, 3680, 3681,
+    3682, 3784, 3785, 3786, 3782, 3783, 3886, 3887, 3888, 3990, 3991, 3992,
+    3988, 3989, 4092, 4093, 4094, 4196, 4197, 4198, 4194, 4195, 4298, 4299,
+    4300, 4402, 4403, 4404, 4400, 4401, 4504, 4505, 4506, 4608, 4609, 4610,
+    4606, 4607, 4710, 4711, 4712, 4814, 4815, 4816, 4812, 4813, 4916, 4917,
+    4918, 5020, 5021, 5022, 5016, 5019, 5120, 5123, 5124, 5224, 5227, 5228,
+    5222, 5223, 5534, 5535, 5536, 5638, 5639, 5640, 5636, 5637, 5740, 5741,
+    5742, 5844, 5845, 5846, 5842, 5843, 5946, 5947, 5948, 6050, 6051, 6052,
+    6048, 6049, 6152, 6153, 6154, 6256, 6257, 6258, 6254, 6255, 6358, 6359,
+    6360, 6462, 6463, 6464, 6460, 6461, 6564, 6565, 6566, 6668, 6669, 6670,
+    6666, 6667, 6770, 6771, 6772, 6874, 6875, 6876, 6872, 6873, 6976, 6977,
+    6978, 7080, 7081, 7082, 7078, 7079, 7182, 7183, 7184, 7286, 7287, 7288,
+    7284, 7285, 7388, 7389, 7390, 7492, 7493, 7494, 7490, 7491, 7594, 7595,
+    7596, 7698, 7699, 7700, 7798, 7697, 7902, 7801, 7802, 8006, 7905, 7906,
+    8525, 8526, 8629, 8630, 8529, 8733, 8734, 8633, 8217, 8218, 8321, 8322,
+    8323, 8425, 8426, 8427, 7803, 7804, 7907, 7908, 7909, 8219, 8220, 8221,
+    7597, 7598, 7701, 7702, 7703, 7805, 7806, 7807, 7391, 7392, 7495, 7496,
+    7497, 7599, 7600, 7601, 7185, 7186, 7289, 7290, 7291, 7393, 7394, 7395,
+    6979, 6980, 7083, 7084, 7085, 7187, 7188, 7189, 6773, 6774, 6877, 6878,
+    6879, 6981, 6982, 6983, 6567, 6568, 6671, 6672, 6673, 6775, 6776, 6777,
+    6361, 6362, 6465, 6466, 6467, 6569, 6570, 6571, 6155, 6156, 6259, 6260,
+    6261, 6363, 6364, 6365, 5949, 5950, 6053, 6054, 6055, 6157, 6158, 6159,
+    5743, 5744, 5847, 5848, 5851, 5951, 5952, 5955, 5539, 5540, 5643, 5644,
+    5645, 5747, 5748, 5749, 5125, 5126, 5229, 5230, 5231, 5541, 5542, 5543,
+    4919, 4920, 5023, 5024, 5025, 5127, 5128, 5129, 4713, 4714, 4817, 4818,
+    4819, 4921, 4922, 4923, 4507, 4508, 4611, 4612, 4613, 4715, 4716, 4717,
+    4301, 4302, 4405, 4406, 4407, 4509, 4510, 4511, 4095, 4096, 4199, 4200,
+    4201, 4303, 4304, 4305, 3889, 3890, 3993, 3994, 3995, 4097, 4098, 4099,
+    3683, 3684, 3787, 3788, 3789, 3891, 3892, 3893, 3477, 3478, 3581, 3582,
+    3583, 3685, 3686, 3687, 3271, 3272, 3375, 3376, 3377, 3479, 3480, 3481,
+    3065, 3066, 3169, 3170, 3173, 3273, 3274, 3277, 2861, 2862, 2965, 2966,
+    2967, 3069, 3070, 3071, 2447, 2448, 2551, 2552, 2553, 2863, 2864, 2865,
+    2241, 2242, 2345, 2346, 2347, 2449, 2450, 2451, 2035, 2036, 2139, 2140,
+    2141, 2243, 2244, 2245, 1829, 1830, 1933, 1934, 1935, 2037, 2038, 2039,
+    1623, 1624, 1727, 1728, 1729, 1831, 1832, 1833, 1417, 1418, 1521, 1522,
+    1523, 1625, 1626, 1627, 1211, 1212, 1315, 1316, 1317, 1419, 1420, 1421,
+    1005, 1006, 1109, 1110, 1111, 1213, 1214, 1215, 799, 800, 903, 904,
+    905, 1007, 1008, 1009, 593, 594, 697, 698, 699, 801, 802, 803,
+    387, 388, 491, 492, 495, 595, 596, 599, 183, 184, 287, 288,
+    289, 391, 392, 393, 10585, 10586, 10689, 10690, 10691, 185, 186, 187,
+    10692, 10693, 188, 189, 190, 292, 293, 294, 290, 291, 394, 395,
+    396, 498, 499, 500, 496, 497, 600, 601, 602, 704, 705, 706,
+    700, 703, 804, 807, 808, 908, 911, 912, 906, 907, 1010, 1011,
+    1012, 1114, 1115, 1116, 1112, 1113, 1216, 1217, 1218, 1320, 1321, 1322,
+    1318, 1319, 1422, 1423, 1424, 1526, 1527, 1528, 1524, 1525, 1628, 1629,
+    1630, 1732, 1733, 1734, 1730, 1731, 1834, 1835, 1836, 1938, 1939, 1940,
+    1936, 1937, 2040, 2041, 2042, 2144, 2145, 2146, 2142, 2143, 2246, 2247,
+    2248, 2350, 2351, 2352, 2348, 2349, 2452, 2453, 2454, 2556, 2557, 2558,
+    2554, 2555, 2866, 2867, 2868, 2970, 2971, 2972, 2968, 2969, 3072, 3073,
+    3074, 3176, 3177, 3178, 3174, 3175, 3278, 3279, 3280, 3382, 3383, 3384,
+    3378, 3381, 3482, 3485, 3486, 3586, 3589, 3590, 3584, 3585, 3688, 3689,
+    3690, 3792, 3793, 3794, 3790, 3791, 3894, 3895, 3896, 3998, 3999, 4000,
+    3996, 3997, 4100, 4101, 4102, 4204, 4205, 4206, 4202, 4203, 4306, 4307,
+    4308, 4410, 4411, 4412, 4408, 4409, 4512, 4513, 4514, 4616, 4617, 4618,
+    4614, 4615, 4718, 4719, 4720, 4822, 4823, 4824, 4820, 4821, 4924, 4925,
+    4926, 5028, 5029, 5030, 5026, 5027, 5130, 5131, 5132, 5234, 5235, 5236,
+    5232, 5233, 5544, 5545, 5546, 5648, 5649, 5650, 5646, 5647, 5750, 5751,
+    5752, 5854, 5855, 5856, 5852, 5853, 5956, 5957, 5958, 6060, 6061, 6062,
+    6056, 6059, 6160, 6163, 6164, 6264, 6267, 6268, 6262, 6263, 6366, 6367,
+    6368, 6470, 6471, 6472, 6468, 6469, 6572, 6573, 6574, 6676, 6677, 6678,
+    6674, 6675, 6778, 6779, 6780, 6882, 6883, 6884, 6880, 6881, 6984, 6985,
+    6986, 7088, 7089, 7090, 7086, 7087, 7190, 7191, 7192, 7294, 7295, 7296,
+    7292, 7293, 7396, 7397, 7398, 7500, 7501, 7502, 7498, 7499, 7602, 7603,
+    7604, 7706, 7707, 7708, 7704, 7705, 7808, 7809, 7810, 7912, 7913, 7914,
+    7910, 7911, 8222, 8223, 8224, 8326, 8327, 8328, 8324, 8325, 8428, 8429,
+    8430, 8532, 8533, 8534, 8530, 8531, 8634, 8635, 8636, 8738, 8739, 8740,
+    8838, 8737, 8942, 8841, 8842, 9046, 8945, 8946, 9357, 9358, 9461, 9462,
+    9361, 9565, 9566, 9465, 9049, 9050, 9153, 9154, 9155, 9257, 9258, 9259,
+    8843, 8844, 8947, 8948, 8949, 9051, 9052, 9053, 8637, 8638, 8741, 8742,
+    8743, 8845, 8846, 8847, 8431, 8432, 8535, 8536, 8537, 8639, 8640, 8641,
+    8225, 8226, 8329, 8330, 8331, 8433, 8434, 8435, 7811, 7812, 7915, 7916,
+    7917, 8227, 8228, 8229, 7605, 7606, 7709, 7710, 7711, 7813, 7814, 7815,
+    7399, 7400, 7503, 7504, 7505, 7607, 7608, 7609, 7193, 7194, 7297, 7298,
+    7299, 7401, 7402, 7403, 6987, 6988, 7091, 7092, 7093, 7195, 7196, 7197,
+    6781, 6782, 6885, 6886, 6887, 6989, 6990, 6991, 6575, 6576, 6679, 6680,
+    6683, 6783, 6784, 6787, 6371, 6372, 6475, 6476, 6477, 6579, 6580, 6581,
+    6165, 6166, 6269, 6270, 6271, 6373, 6374, 6375, 5959, 5960, 6063, 6064,
+    6065, 6167, 6168, 6169, 5753, 5754, 5857, 5858, 5859, 5961, 5962, 5963,
+    5547, 5548, 5651, 5652, 5653, 5755, 5756, 5757, 5133, 5134, 5237, 5238,
+    5239, 5549, 5550, 5551, 4927, 4928, 5031, 5032, 5033, 5135, 5136, 5137,
+    4721, 4722, 4825, 4826, 4827, 4929, 4930, 4931, 4515, 4516, 4619, 4620,
+    4621, 4723, 4724, 4725, 4309, 4310, 4413, 4414, 4415, 4517, 4518, 4519,
+    4103, 4104, 4207, 4208, 4209, 4311, 4312, 4313, 3897, 3898, 4001, 4002,
+    4005, 4105, 4106, 4109, 3693, 3694, 3797, 3798, 3799, 3901, 3902, 3903,
+    3487, 3488, 3591, 3592, 3593, 3695, 3696, 3697, 3281, 3282, 3385, 3386,
+    3387, 3489, 3490, 3491, 3075, 3076, 3179, 3180, 3181, 3283, 3284, 3285,
+    2869, 2870, 2973, 2974, 2975, 3077, 3078, 3079, 2455, 2456, 2559, 2560,
+    2561, 2871, 2872, 2873, 2249, 2250, 2353, 2354, 2355, 2457, 2458, 2459,
+    2043, 2044, 2147, 2148, 2149, 2251, 2252, 2253, 1837, 1838, 1941, 1942,
+    1943, 2045, 2046, 2047, 1631, 1632, 1735, 1736, 1737, 1839, 1840, 1841,
+    1425, 1426, 1529, 1530, 1531, 1633, 1634, 1635, 1219, 1220, 1323, 1324,
+    1327, 1427, 1428, 1431, 1015, 1016, 1119, 1120, 1121, 1223, 1224, 1225,
+    809, 810, 913, 914, 915, 1017, 1018, 1019, 603, 604, 707, 708,
+    709, 811, 812, 813, 397, 398, 501, 502, 503, 605, 606, 607,
+    191, 192, 295, 296, 297, 399, 400, 401, 10593, 10594, 10697, 10698,
+    10699, 193, 194, 195, 10700, 10701, 196, 197, 198, 300, 301, 302,
+    298, 299, 402, 403, 404, 506, 507, 508, 504, 505, 608, 609,
+    610, 712, 713, 714, 710, 711, 814, 815, 816, 918, 919, 920,
+    916, 917, 1020, 1021, 1022, 1124, 1125, 1126, 1122, 1123, 1226, 1227,
+    1228, 1330, 1331, 1332, 1328, 1329, 1432, 1433, 1434, 1536, 1537, 1538,
+    1532, 1535, 1636, 1639, 1640, 1740, 1743, 1744, 1738, 1739, 1842, 1843,
+    1844, 1946, 1947, 1948, 1944, 1945, 2048, 2049, 2050, 2152, 2153, 2154,
+    2150, 2151, 2254, 2255, 2256, 2358, 2359, 2360, 2356, 2357, 2460, 2461,
+    2462, 2564, 2565, 2566, 2562, 2563, 2874, 2875, 2876, 2978, 2979, 2980,
+    2976, 2977, 3080, 3081, 3082, 3184, 3185, 3186, 3182, 3183, 3286, 3287,
+    3288, 3390, 3391, 3392, 3388, 3389, 3492, 3493, 3494, 3596, 3597, 3598,
+    3594, 3595, 3698, 3699, 3700, 3802, 3803, 3804, 3800, 3801, 3904, 3905,
+    3906, 4008, 4009, 4010, 4006, 4007, 4110, 4111, 4112, 4214, 4215, 4216,
+    4210, 4213, 4314, 4317, 4318, 4418, 4421, 4422, 4416, 4417, 4520, 4521,
+    4522, 4624, 4625, 4626, 4622, 4623, 4726, 4727, 4728, 4830, 4831, 4832,
+    4828, 4829, 4932, 4933, 4934, 5036, 5037, 5038, 5034, 5035, 5138, 5139,
+    5140, 5242, 5243, 5244, 5240, 5241, 5552, 5553, 5554, 5656, 5657, 5658,
+    5654, 5655, 5758, 5759, 5760, 5862, 5863, 5864, 5860, 5861, 5964, 5965,
+    5966, 6068, 6069, 6070, 6066, 6067, 6170, 6171, 6172, 6274, 6275, 6276,
+    6272, 6273, 6376, 6377, 6378, 6480, 6481, 6482, 6478, 6479, 6582, 6583,
+    6584, 6686, 6687, 6688, 6684, 6685, 6788, 6789, 6790, 6892, 6893, 6894,
+    6888, 6891, 6992, 6995, 6996, 7096, 7099, 7100, 7094, 7095, 7198, 7199,
+    7200, 7302, 7303, 7304, 7300, 7301, 7404, 7405, 7406, 7508, 7509, 7510,
+    7506, 7507, 7610, 7611, 7612, 7714, 7715, 7716, 7712, 7713, 7816, 7817,
+    7818, 7920, 7921, 7922, 7918, 7919, 8230, 8231, 8232, 8334, 8335, 8336,
+    8332, 8333, 8436, 8437, 8438, 8540, 8541, 8542, 8538, 8539, 8642, 8643,
+    8644, 8746, 8747, 8748, 8744, 8745, 8848, 8849, 8850, 8952, 8953, 8954,
+    8950, 8951, 9054, 9055, 9056, 9158, 9159, 9160, 9156, 9157, 9260, 9261,
+    9262, 9364, 9365, 9366, 9362, 9363, 9466, 9467, 9468, 9570, 9571, 9572,
+    9670, 9569, 9774, 9673, 9674, 9878, 9777, 9778, 10189, 10190, 10293, 10294,
+    10193, 10397, 10398, 10297, 9881, 9882, 9985, 9986, 9987, 10089, 10090, 10091,
+    9675, 9676, 9779, 9780, 9781, 9883, 9884, 9885, 9469, 9470, 9573, 9574,
+    9575, 9677, 9678, 9679, 9263, 9264, 9367, 9368, 9369, 9471, 9472, 9473,
+    9057, 9058, 9161, 9162, 9163, 9265, 9266, 9267, 8851, 8852, 8955, 8956,
+    8957, 9059, 9060, 9061, 8645, 8646, 8749, 8750, 8751, 8853, 8854, 8855,
+    8439, 8440, 8543, 8544, 8545, 8647, 8648, 8649, 8233, 8234, 8337, 8338,
+    8339, 8441, 8442, 8443, 7819, 7820, 7923, 7924, 7925, 8235, 8236, 8237,
+    7613, 7614, 7717, 7718, 7719, 7821, 7822, 7823, 7407, 7408, 7511, 7512,
+    7515, 7615, 7616, 7619, 7203, 7204, 7307, 7308, 7309, 7411, 7412, 7413,
+    6997, 6998, 7101, 7102, 7103, 7205, 7206, 7207, 6791, 6792, 6895, 6896,
+    6897, 6999, 7000, 7001, 6585, 6586, 6689, 6690, 6691, 6793, 6794, 6795,
+    6379, 6380, 6483, 6484, 6485, 6587, 6588, 6589, 6173, 6174, 6277, 6278,
+    6279, 6381, 6382, 6383, 5967, 5968, 6071, 6072, 6073, 6175, 6176, 6177,
+    5761, 5762, 5865, 5866, 5867, 5969, 5970, 5971, 5555, 5556, 5659, 5660,
+    5661, 5763, 5764, 5765, 5141, 5142, 5245, 5246, 5247, 5557, 5558, 5559,
+    4935, 4936, 5039, 5040, 5041, 5143, 5144, 5145, 4729, 4730, 4833, 4834,
+    4837, 4937, 4938, 4941, 4525, 4526, 4629, 4630, 4631, 4733, 4734, 4735,
+    4319, 4320, 4423, 4424, 4425, 4527, 4528, 4529, 4113, 4114, 4217, 4218,
+    4219, 4321, 4322, 4323, 3907, 3908, 4011, 4012, 4013, 4115, 4116, 4117,
+    3701, 3702, 3805, 3806, 3807, 3909, 3910, 3911, 3495, 3496, 3599, 3600,
+    3601, 3703, 3704, 3705, 3289, 3290, 3393, 3394, 3395, 3497, 3498, 3499,
+    3083, 3084, 3187, 3188, 3189, 3291, 3292, 3293, 2877, 2878, 2981, 2982,
+    2983, 3085, 3086, 3087, 2463, 2464, 2567, 2568, 2569, 2879, 2880, 2881,
+    2257, 2258, 2361, 2362, 2363, 2465, 2466, 2467, 2051, 2052, 2155, 2156,
+    2159, 2259, 2260, 2263, 1847, 1848, 1951, 1952, 1953, 2055, 2056, 2057,
+    1641, 1642, 1745, 1746, 1747, 1849, 1850, 1851, 1435, 1436, 1539, 1540,
+    1541, 1643, 1644, 1645, 1229, 1230, 1333, 1334, 1335, 1437, 1438, 1439,
+    1023, 1024, 1127, 1128, 1129, 1231, 1232, 1233, 817, 818, 921, 922,
+    923, 1025, 1026, 1027, 611, 612, 715, 716, 717, 819, 820, 821,
+    405, 406, 509, 510, 511, 613, 614, 615, 199, 200, 303, 304,
+    305, 407, 408, 409, 10601, 10602, 10705, 10706, 10707, 201, 202, 203,
+    10708, 10709, 204, 205, 206, 308, 309, 310, 306, 307, 410, 411,
+    412, 514, 515, 516, 512, 513, 616, 617, 618, 720, 721, 722,
+    718, 719, 822, 823, 824, 926, 927, 928, 924, 925, 1028, 1029,
+    1030, 1132, 1133, 1134, 1130, 1131, 1234, 1235, 1236, 1338, 1339, 1340,
+    1336, 1337, 1440, 1441, 1442, 1544, 1545, 1546, 1542, 1543, 1646, 1647,
+    1648, 1750, 1751, 1752, 1748, 1749, 1852, 1853, 1854, 1956, 1957, 1958,
+    1954, 1955, 2058, 2059, 2060, 2162, 2163, 2164, 2160, 2161, 2264, 2265,
+    2266, 2368, 2369, 2370, 2364, 2367, 2468, 2471, 2472, 2572, 2575, 2576,
+    2570, 2571, 2882, 2883, 2884, 2986, 2987, 2988, 2984, 2985, 3088, 3089,
+    3090, 3192, 3193, 3194, 3190, 3191, 3294, 3295, 3296, 3398, 3399, 3400,
+    3396, 3397, 3500, 3501, 3502, 3604, 3605, 3606, 3602, 3603, 3706, 3707,
+    3708, 3810, 3811, 3812, 3808, 3809, 3912, 3913, 3914, 4016, 4017, 4018,
+    4014, 4015, 4118, 4119, 4120, 4222, 4223, 4224, 4220, 4221, 4324, 4325,
+    4326, 4428, 4429, 4430, 4426, 4427, 4530, 4531, 4532, 4634, 4635, 4636,
+    4632, 4633, 4736, 4737, 4738, 4840, 4841, 4842, 4838, 4839, 4942, 4943,
+    4944, 5046, 5047, 5048, 5042, 5045, 5146, 5149, 5150, 5250, 5253, 5254,
+    5248, 5249, 5560, 5561, 5562, 5664, 5665, 5666, 5662, 5663, 5766, 5767,
+    5768, 5870, 5871, 5872, 5868, 5869, 5972, 5973, 5974, 6076, 6077, 6078,
+    6074, 6075, 6178, 6179, 6180, 6282, 6283, 6284, 6280, 6281, 6384, 6385,
+    6386, 6488, 6489, 6490, 6486, 6487, 6590, 6591, 6592, 6694, 6695, 6696,
+    6692, 6693, 6796, 6797, 6798, 6900, 6901, 6902, 6898, 6899, 7002, 7003,
+    7004, 7106, 7107, 7108, 7104, 7105, 7208, 7209, 7210, 7312, 7313, 7314,
+    7310, 7311, 7414, 7415, 7416, 7518, 7519, 7520, 7516, 7517, 7620, 7621,
+    7622, 7724, 7725, 7726, 7720, 7723, 7824, 7827, 7828, 7928, 7931, 7932,
+    7926, 7927, 8238, 8239, 8240, 8342, 8343, 8344, 8340, 8341, 8444, 8445,
+    8446, 8548, 8549, 8550, 8546, 8547, 8650, 8651, 8652, 8754, 8755, 8756,
+    8752, 8753, 8856, 8857, 8858, 8960, 8961, 8962, 8958, 8959, 9062, 9063,
+    9064, 9166, 9167, 9168, 9164, 9165, 9268, 9269, 9270, 9372, 9373, 9374,
+    9370, 9371, 9474, 9475, 9476, 9578, 9579, 9580, 9576, 9577, 9680, 9681,
+    9682, 9784, 9785, 9786, 9782, 9783, 9886, 9887, 9888, 9990, 9991, 9992,
+    9988, 9989, 10092, 10093, 10094, 10196, 10197, 10198, 10194, 10195, 10298, 10299,
+    10300, 10402, 10403, 10404, 10502, 10401, 10606, 10505, 10506, 10710, 10609, 10610,
+    10301, 10302, 10405, 10406, 10407, 10509, 10510, 10511, 10095, 10096, 10199, 10200,
+    10201, 10303, 10304, 10305, 9889, 9890, 9993, 9994, 9995, 10097, 10098, 10099,
+    9683, 9684, 9787, 9788, 9789, 9891, 9892, 9893, 9477, 9478, 9581, 9582,
+    9583, 9685, 9686, 9687, 9271, 9272, 9375, 9376, 9377, 9479, 9480, 9481,
+    9065, 9066, 9169, 9170, 9171, 9273, 9274, 9275, 8859, 8860, 8963, 8964,
+    8965, 9067, 9068, 9069, 8653, 8654, 8757, 8758, 8759, 8861, 8862, 8863,
+    8447, 8448, 8551, 8552, 8555, 8655, 8656, 8659, 8243, 8244, 8347, 8348,
+    8349, 8451, 8452, 8453, 7829, 7830, 7933, 7934, 7935, 8245, 8246, 8247,
+    7623, 7624, 7727, 7728, 7729, 7831, 7832, 7833, 7417, 7418, 7521, 7522,
+    7523, 7625, 7626, 7627, 7211, 7212, 7315, 7316, 7317, 7419, 7420, 7421,
+    7005, 7006, 7109, 7110, 7111, 7213, 7214, 7215, 6799, 6800, 6903, 6904,
+    6905, 7007, 7008, 7009, 6593, 6594, 6697, 6698, 6699, 6801, 6802, 6803,
+    6387, 6388, 6491, 6492, 6493, 6595, 6596, 6597, 6181, 6182, 6285, 6286,
+    6287, 6389, 6390, 6391, 5975, 5976, 6079, 6080, 6081, 6183, 6184, 6185,
+    5769, 5770, 5873, 5874, 5877, 5977, 5978, 5981, 5565, 5566, 5669, 5670,
+    5671, 5773, 5774, 5775, 5151, 5152, 5255, 5256, 5257, 5567, 5568, 5569,
+    4945, 4946, 5049, 5050, 5051, 5153, 5154, 5155, 4739, 4740, 4843, 4844,
+    4845, 4947, 4948, 4949, 4533, 4534, 4637, 4638, 4639, 4741, 4742, 4743,
+    4327, 4328, 4431, 4432, 4433, 4535, 4536, 4537, 4121, 4122, 4225, 4226,
+    4227, 4329, 4330, 4331, 3915, 3916, 4019, 4020, 4021, 4123, 4124, 4125,
+    3709, 3710, 3813, 3814, 3815, 3917, 3918, 3919, 3503, 3504, 3607, 3608,
+    3609, 3711, 3712, 3713, 3297, 3298, 3401, 3402, 3403, 3505, 3506, 3507,
+    3091, 3092, 3195, 3196, 3199, 3299, 3300, 3303, 2887, 2888, 2991, 2992,
+    2993, 3095, 3096, 3097, 2473, 2474, 2577, 2578, 2579, 2889, 2890, 2891,
+    2267, 2268, 2371, 2372, 2373, 2475, 2476, 2477, 2061, 2062, 2165, 2166,
+    2167, 2269, 2270, 2271, 1855, 1856, 1959, 1960, 1961, 2063, 2064, 2065,
+    1649, 1650, 1753, 1754, 1755, 1857, 1858, 1859, 1443, 1444, 1547, 1548,
+    1549, 1651, 1652, 1653, 1237, 1238, 1341, 1342, 1343, 1445, 1446, 1447,
+    1031, 1032, 1135, 1136, 1137, 1239, 1240, 1241, 825, 826, 929, 930,
+    931, 1033, 1034, 1035, 619, 620, 723, 724, 725, 827, 828, 829,
+    932, 933, 1036, 1037, 1038, 1140, 1141, 1142, 1138, 1139, 1242, 1243,
+    1244, 1346, 1347, 1348, 1344, 1345, 1448, 1449, 1450, 1552, 1553, 1554,
+    1550, 1551, 1654, 1655, 1656, 1758, 1759, 1760, 1756, 1757, 1860, 1861,
+    1862, 1964, 1965, 1966, 1962, 1963, 2066, 2067, 2068, 2170, 2171, 2172,
+    2168, 2169, 2272, 2273, 2274, 2376, 2377, 2378, 2374, 2375, 2478, 2479,
+    2480, 2582, 2583, 2584, 2580, 2581, 2892, 2893, 2894, 2996, 2997, 2998,
+    2994, 2995, 3098, 3099, 3100, 3202, 3203, 3204, 3200, 3201, 3304, 3305,
+    3306, 3408, 3409, 3410, 3404, 3407, 3508, 3511, 3512, 3612, 3615, 3616,
+    3610, 3611, 3714, 3715, 3716, 3818, 3819, 3820, 3816, 3817, 3920, 3921,
+    3922, 4024, 4025, 4026, 4022, 4023, 4126, 4127, 4128, 4230, 4231, 4232,
+    4228, 4229, 4332, 4333, 4334, 4436, 4437, 4438, 4434, 4435, 4538, 4539,
+    4540, 4642, 4643, 4644, 4640, 4641, 4744, 4745, 4746, 4848, 4849, 4850,
+    4846, 4847, 4950, 4951, 4952, 5054, 5055, 5056, 5052, 5053, 5156, 5157,
+    5158, 5260, 5261, 5262, 5258, 5259, 5570, 5571, 5572, 5674, 5675, 5676,
+    5672, 5673, 5776, 5777, 5778, 5880, 5881, 5882, 5878, 5879, 5982, 5983,
+    5984, 6086, 6087, 6088, 6082, 6085, 6186, 6189, 6190, 6290, 6293, 6294,
+    6288, 6289, 6392, 6393, 6394, 6496, 6497, 6498, 6494, 6495, 6598, 6599,
+    6600, 6702, 6703, 6704, 6700, 6701, 6804, 6805, 6806, 6908, 6909, 6910,
+    6906, 6907, 7010, 7011, 7012, 7114, 7115, 7116, 7112, 7113, 7216, 7217,
+    7218, 7320, 7321, 7322, 7318, 7319, 7422, 7423, 7424, 7526, 7527, 7528,
+    7524, 7525, 7628, 7629, 7630, 7732, 7733, 7734, 7730, 7731, 7834, 7835,
+    7836, 7938, 7939, 7940, 7936, 7937, 8248, 8249, 8250, 8352, 8353, 8354,
+    8350, 8351, 8454, 8455, 8456, 8558, 8559, 8560, 8556, 8557, 8660, 8661,
+    8662, 8764, 8765, 8766, 8760, 8763, 8864, 8867, 8868, 8968, 8971, 8972,
+    8966, 8967, 9070, 9071, 9072, 9174, 9175, 9176, 9172, 9173, 9276, 9277,
+    9278, 9380, 9381, 9382, 9378, 9379, 9482, 9483, 9484, 9586, 9587, 9588,
+    9584, 9585, 9688, 9689, 9690, 9792, 9793, 9794, 9790, 9791, 9894, 9895,
+    9896, 9998, 9999, 10000, 9996, 9997, 10100, 10101, 10102, 10204, 10205, 10206,
+    10202, 10203, 10306, 10307, 10308, 10410, 10411, 10412, 10408, 10409, 10512, 10513,
+    10514, 10616, 10617, 10618, 10309, 10310, 10413, 10414, 10415, 10517, 10518, 10519,
+    10103, 10104, 10207, 10208, 10209, 10311, 10312, 10313, 9897, 9898, 10001, 10002,
+    10003, 10105, 10106, 10107, 9691, 9692, 9795, 9796, 9797, 9899, 9900, 9901,
+    9485, 9486, 9589, 9590, 9591, 9693, 9694, 9695, 9279, 9280, 9383, 9384,
+    9387, 9487, 9488, 9491, 9075, 9076, 9179, 9180, 9181, 9283, 9284, 9285,
+    8869, 8870, 8973, 8974, 8975, 9077, 9078, 9079, 8663, 8664, 8767, 8768,
+    8769, 8871, 8872, 8873, 8457, 8458, 8561, 8562, 8563, 8665, 8666, 8667,
+    8251, 8252, 8355, 8356, 8357, 8459, 8460, 8461, 7837, 7838, 7941, 7942,
+    7943, 8253, 8254, 8255, 7631, 7632, 7735, 7736, 7737, 7839, 7840, 7841,
+    7425, 7426, 7529, 7530, 7531, 7633, 7634, 7635, 7219, 7220, 7323, 7324,
+    7325, 7427, 7428, 7429, 7013, 7014, 7117, 7118, 7119, 7221, 7222, 7223,
+    6807, 6808, 6911, 6912, 6913, 7015, 7016, 7017, 6601, 6602, 6705, 6706,
+    6709, 6809, 6810, 6813, 6397, 6398, 6501, 6502, 6503, 6605, 6606, 6607,
+    6191, 6192, 6295, 6296, 6297, 6399, 6400, 6401, 5985, 5986, 6089, 6090,
+    6091, 6193, 6194, 6195, 5779, 5780, 5883, 5884, 5885, 5987, 5988, 5989,
+    5573, 5574, 5677, 5678, 5679, 5781, 5782, 5783, 5159, 5160, 5263, 5264,
+    5265, 5575, 5576, 5577, 4953, 4954, 5057, 5058, 5059, 5161, 5162, 5163,
+    4747, 4748, 4851, 4852, 4853, 4955, 4956, 4957, 4541, 4542, 4645, 4646,
+    4647, 4749, 4750, 4751, 4335, 4336, 4439, 4440, 4441, 4543, 4544, 4545,
+    4129, 4130, 4233, 4234, 4235, 4337, 4338, 4339, 3923, 3924, 4027, 4028,
+    4031, 4131, 4132, 4135, 3719, 3720, 3823, 3824, 3825, 3927, 3928, 3929,
+    3513, 3514, 3617, 3618, 3619, 3721, 3722, 3723, 3307, 3308, 3411, 3412,
+    3413, 3515, 3516, 3517, 3101, 3102, 3205, 3206, 3207, 3309, 3310, 3311,
+    2895, 2896, 2999, 3000, 3001, 3103, 3104, 3105, 2481, 2482, 2585, 2586,
+    2587, 2897, 2898, 2899, 2275, 2276, 2379, 2380, 2381, 2483, 2484, 2485,
+    2069, 2070, 2173, 2174, 2175, 2277, 2278, 2279, 1863, 1864, 1967, 1968,
+    1969, 2071, 2072, 2073, 1657, 1658, 1761, 1762, 1763, 1865, 1866, 1867,
+    1451, 1452, 1555, 1556, 1557, 1659, 1660, 1661, 1764, 1765, 1868, 1869,
+    1870, 1972, 1973, 1974, 1970, 1971, 2074, 2075, 2076, 2178, 2179, 2180,
+    2176, 2177, 2280, 2281, 2282, 2384, 2385, 2386, 2382, 2383, 2486, 2487,
+    2488, 2590, 2591, 2592, 2588, 2589, 2900, 2901, 2902, 3004, 3005, 3006,
+    3002, 3003, 3106, 3107, 3108, 3210, 3211, 3212, 3208, 3209, 3312, 3313,
+    3314, 3416, 3417, 3418, 3414, 3415, 3518, 3519, 3520, 3622, 3623, 3624,
+    3620, 3621, 3724, 3725, 3726, 3828, 3829, 3830, 3826, 3827, 3930, 3931,
+    3932, 4034, 4035, 4036, 4032, 4033, 4136, 4137, 4138, 4240, 4241, 4242,
+    4236, 4239, 4340, 4343, 4344, 4444, 4447, 4448, 4442, 4443, 4546, 4547,
+    4548, 4650, 4651, 4652, 4648, 4649, 4752, 4753, 4754, 4856, 4857, 4858,
+    4854, 4855, 4958, 4959, 4960, 5062, 5063, 5064, 5060, 5061, 5164, 5165,
+    5166, 5268, 5269, 5270, 5266, 5267, 5578, 5579, 5580, 5682, 5683, 5684,
+    5680, 5681, 5784, 5785, 5786, 5888, 5889, 5890, 5886, 5887, 5990, 5991,
+    5992, 6094, 6095, 6096, 6092, 6093, 6196, 6197, 6198, 6300, 6301, 6302,
+    6298, 6299, 6402, 6403, 6404, 6506, 6507, 6508, 6504, 6505, 6608, 6609,
+    6610, 6712, 6713, 6714, 6710, 6711, 6814, 6815, 6816, 6918, 6919, 6920,
+    6914, 6917, 7018, 7021, 7022, 7122, 7125, 7126, 7120, 7121, 7224, 7225,
+    7226, 7328, 7329, 7330, 7326, 7327, 7430, 7431, 7432, 7534, 7535, 7536,
+    7532, 7533, 7636, 7637, 7638, 7740, 7741, 7742, 7738, 7739, 7842, 7843,
+    7844, 7946, 7947, 7948, 7944, 7945, 8256, 8257, 8258, 8360, 8361, 8362,
+    8358, 8359, 8462, 8463, 8464, 8566, 8567, 8568, 8564, 8565, 8668, 8669,
+    8670, 8772, 8773, 8774, 8770, 8771, 8874, 8875, 8876, 8978, 8979, 8980,
+    8976, 8977, 9080, 9081, 9082, 9184, 9185, 9186, 9182, 9183, 9286, 9287,
+    9288, 9390, 9391, 9392, 9388, 9389, 9492, 9493, 9494, 9596, 9597, 9598,
+    9592, 9595, 9696, 9699, 9700, 9800, 9803, 9804, 9798, 9799, 9902, 9903,
+    9904, 10006, 10007, 10008, 10004, 10005, 10108, 10109, 10110, 10212, 10213, 10214,
+    10210, 10211, 10314, 10315, 10316, 10418, 10419, 10420, 10416, 10417, 10520, 10521,
+    10522, 10624, 10625, 10626, 10317, 10318, 10421, 10422, 10423, 10525, 10526, 10527,
+    10111, 10112, 10215, 10216, 10219, 10319, 10320, 10323, 9907, 9908, 10011, 10012,
+    10013, 10115, 10116, 10117, 9701, 9702, 9805, 9806, 9807, 9909, 9910, 9911,
+    9495, 9496, 9599, 9600, 9601, 9703, 9704, 9705, 9289, 9290, 9393, 9394,
+    9395, 9497, 9498, 9499, 9083, 9084, 9187, 9188, 9189, 9291, 9292, 9293,
+    8877, 8878, 8981, 8982, 8983, 9085, 9086, 9087, 8671, 8672, 8775, 8776,
+    8777, 8879, 8880, 8881, 8465, 8466, 8569, 8570, 8571, 8673, 8674, 8675,
+    8259, 8260, 8363, 8364, 8365, 8467, 8468, 8469, 7845, 7846, 7949, 7950,
+    7951, 8261, 8262, 8263, 7639, 7640, 7743, 7744, 7745, 7847, 7848, 7849,
+    7433, 7434, 7537, 7538, 7541, 7641, 7642, 7645, 7229, 7230, 7333, 7334,
+    7335, 7437, 7438, 7439, 7023, 7024, 7127, 7128, 7129, 7231, 7232, 7233,
+    6817, 6818, 6921, 6922, 6923, 7025, 7026, 7027, 6611, 6612, 6715, 6716,
+    6717, 6819, 6820, 6821, 6405, 6406, 6509, 6510, 6511, 6613, 6614, 6615,
+    6199, 6200, 6303, 6304, 6305, 6407, 6408, 6409, 5993, 5994, 6097, 6098,
+    6099, 6201, 6202, 6203, 5787, 5788, 5891, 5892, 5893, 5995, 5996, 5997,
+    5581, 5582, 5685, 5686, 5687, 5789, 5790, 5791, 5167, 5168, 5271, 5272,
+    5273, 5583, 5584, 5585, 4961, 4962, 5065, 5066, 5067, 5169, 5170, 5171,
+    4755, 4756, 4859, 4860, 4863, 4963, 4964, 4967, 4551, 4552, 4655, 4656,
+    4657, 4759, 4760, 4761, 4345, 4346, 4449, 4450, 4451, 4553, 4554, 4555,
+    4139, 4140, 4243, 4244, 4245, 4347, 4348, 4349, 3933, 3934, 4037, 4038,
+    4039, 4141, 4142, 4143, 3727, 3728, 3831, 3832, 3833, 3935, 3936, 3937,
+    3521, 3522, 3625, 3626, 3627, 3729, 3730, 3731, 3315, 3316, 3419, 3420,
+    3421, 3523, 3524, 3525, 3109, 3110, 3213, 3214, 3215, 3317, 3318, 3319,
+    2903, 2904, 3007, 3008, 3009, 3111, 3112, 3113, 2489, 2490, 2593, 2594,
+    2595, 2905, 2906, 2907, 2283, 2284, 2387, 2388, 2389, 2491, 2492, 2493,
+    2596, 2597, 2908, 2909, 2910, 3012, 3013, 3014, 3010, 3011, 3114, 3115,
+    3116, 3218, 3219, 3220, 3216, 3217, 3320, 3321, 3322, 3424, 3425, 3426,
+    3422, 3423, 3526, 3527, 3528, 3630, 3631, 3632, 3628, 3629, 3732, 3733,
+    3734, 3836, 3837, 3838, 3834, 3835, 3938, 3939, 3940, 4042, 4043, 4044,
+    4040, 4041, 4144, 4145, 4146, 4248, 4249, 4250, 4246, 4247, 4350, 4351,
+    4352, 4454, 4455, 4456, 4452, 4453, 4556, 4557, 4558, 4660, 4661, 4662,
+    4658, 4659, 4762, 4763, 4764, 4866, 4867, 4868, 4864, 4865, 4968, 4969,
+    4970, 5072, 5073, 5074, 5068, 5071, 5172, 5175, 5176, 5276, 5279, 5280,
+    5274, 5275, 5586, 5587, 5588, 5690, 5691, 5692, 5688, 5689, 5792, 5793,
+    5794, 5896, 5897, 5898, 5894, 5895, 5998, 5999, 6000, 6102, 6103, 6104,
+    6100, 6101, 6204, 6205, 6206, 6308, 6309, 6310, 6306, 6307, 6410, 6411,
+    6412, 6514, 6515, 6516, 6512, 6513, 6616, 6617, 6618, 6720, 6721, 6722,
+    6718, 6719, 6822, 6823, 6824, 6926, 6927, 6928, 6924, 6925, 7028, 7029,
+    7030, 7132, 7133, 7134, 7130, 7131, 7234, 7235, 7236, 7338, 7339, 7340,
+    7336, 7337, 7440, 7441, 7442, 7544, 7545, 7546, 7542, 7543, 7646, 7647,
+    7648, 7750, 7751, 7752, 7746, 7749, 7850, 7853, 7854, 7954, 7957, 7958,
+    7952, 7953, 8264, 8265, 8266, 8368, 8369, 8370, 8366, 8367, 8470, 8471,
+    8472, 8574, 8575, 8576, 8572, 8573, 8676, 8677, 8678, 8780, 8781, 8782,
+    8778, 8779, 8882, 8883, 8884, 8986, 8987, 8988, 8984, 8985, 9088, 9089,
+    9090, 9192, 9193, 9194, 9190, 9191, 9294, 9295, 9296, 9398, 9399, 9400,
+    9396, 9397, 9500, 9501, 9502, 9604, 9605, 9606, 9602, 9603, 9706, 9707,
+    9708, 9810, 9811, 9812, 9808, 9809, 9912, 9913, 9914, 10016, 10017, 10018,
+    10014, 10015, 10118, 10119, 10120, 10222, 10223, 10224, 10220, 10221, 10324, 10325,
+    10326, 10428, 10429, 10430, 10424, 10427, 10528, 10531, 10532, 10632, 10635, 10636,
+    10327, 10328, 10431, 10432, 10433, 10535, 10536, 10537, 10121, 10122, 10225, 10226,
+    10227, 10329, 10330, 10331, 9915, 9916, 10019, 10020, 10021, 10123, 10124, 10125,
+    9709, 9710, 9813, 9814, 9815, 9917, 9918, 9919, 9503, 9504, 9607, 9608,
+    9609, 9711, 9712, 9713, 9297, 9298, 9401, 9402, 9403, 9505, 9506, 9507,
+    9091, 9092, 9195, 9196, 9197, 9299, 9300, 9301, 8885, 8886, 8989, 8990,
+    8991, 9093, 9094, 9095, 8679, 8680, 8783, 8784, 8785, 8887, 8888, 8889,
+    8473, 8474, 8577, 8578, 8581, 8681, 8682, 8685, 8269, 8270, 8373, 8374,
+    8375, 8477, 8478, 8479, 7855, 7856, 7959, 7960, 7961, 8271, 8272, 8273,
+    7649, 7650, 7753, 7754, 7755, 7857, 7858, 7859, 7443, 7444, 7547, 7548,
+    7549, 7651, 7652, 7653, 7237, 7238, 7341, 7342, 7343, 7445, 7446, 7447,
+    7031, 7032, 7135, 7136, 7137, 7239, 7240, 7241, 6825, 6826, 6929, 6930,
+    6931, 7033, 7034, 7035, 6619, 6620, 6723, 6724, 6725, 6827, 6828, 6829,
+    6413, 6414, 6517, 6518, 6519, 6621, 6622, 6623, 6207, 6208, 6311, 6312,
+    6313, 6415, 6416, 6417, 6001, 6002, 6105, 6106, 6107, 6209, 6210, 6211,
+    5795, 5796, 5899, 5900, 5903, 6003, 6004, 6007, 5591, 5592, 5695, 5696,
+    5697, 5799, 5800, 5801, 5177, 5178, 5281, 5282, 5283, 5593, 5594, 5595,
+    4971, 4972, 5075, 5076, 5077, 5179, 5180, 5181, 4765, 4766, 4869, 4870,
+    4871, 4973, 4974, 4975, 4559, 4560, 4663, 4664, 4665, 4767, 4768, 4769,
+    4353, 4354, 4457, 4458, 4459, 4561, 4562, 4563, 4147, 4148, 4251, 4252,
+    4253, 4355, 4356, 4357, 3941, 3942, 4045, 4046, 4047, 4149, 4150, 4151,
+    3735, 3736, 3839, 3840, 3841, 3943, 3944, 3945, 3529, 3530, 3633, 3634,
+    3635, 3737, 3738, 3739, 3323, 3324, 3427, 3428, 3429, 3531, 3532, 3533,
+    3636, 3637, 3740, 3741, 3742, 3844, 3845, 3846, 3842, 3843, 3946, 3947,
+    3948, 4050, 4051, 4052, 4048, 4049, 4152, 4153, 4154, 4256, 4257, 4258,
+    4254, 4255, 4358, 4359, 4360, 4462, 4463, 4464, 4460, 4461, 4564, 4565,
+    4566, 4668, 4669, 4670, 4666, 4667, 4770, 4771, 4772, 4874, 4875, 4876,
+    4872, 4873, 4976, 4977, 4978, 5080, 5081, 5082, 5078, 5079, 5182, 5183,
+    5184, 5286, 5287, 5288, 5284, 5285, 5596, 5597, 5598, 5700, 5701, 5702,
+    5698, 5699, 5802, 5803, 5804, 5906, 5907, 5908, 5904, 5905, 6008, 6009,
+    6010, 6112, 6113, 6114, 6108, 6111, 6212, 6215, 6216, 6316, 6319, 6320,
+    6314, 6315, 6418, 6419, 6420, 6522, 6523, 6524, 6520, 6521, 6624, 6625,
+    6626, 6728, 6729, 6730, 6726, 6727, 6830, 6831, 6832, 6934, 6935, 6936,
+    6932, 6933, 7036, 7037, 7038, 7140, 7141, 7142, 7138, 7139, 7242, 7243,
+    7244, 7346, 7347, 7348, 7344, 7345, 7448, 7449, 7450, 7552, 7553, 7554,
+    7550, 7551, 7654, 7655, 7656, 7758, 7759, 7760, 7756, 7757, 7860, 7861,
+    7862, 7964, 7965, 7966, 7962, 7963, 8274, 8275, 8276, 8378, 8379, 8380,
+    8376, 8377, 8480, 8481, 8482, 8584, 8585, 8586, 8582, 8583, 8686, 8687,
+    8688, 8790, 8791, 8792, 8786, 8789, 8890, 8893, 8894, 8994, 8997, 8998,
+    8992, 8993, 9096, 9097, 9098, 9200, 9201, 9202, 9198, 9199, 9302, 9303,
+    9304, 9406, 9407, 9408, 9404, 9405, 9508, 9509, 9510, 9612, 9613, 9614,
+    9610, 9611, 9714, 9715, 9716, 9818, 9819, 9820, 9816, 9817, 9920, 9921,
+    9922, 10024, 10025, 10026, 10022, 10023, 10126, 10127, 10128, 10230, 10231, 10232,
+    10228, 10229, 10332, 10333, 10334, 10436, 10437, 10438, 10434, 10435, 10538, 10539,
+    10540, 10642, 10643, 10644, 10335, 10336, 10439, 10440, 10441, 10543, 10544, 10545,
+    10129, 10130, 10233, 10234, 10235, 10337, 10338, 10339, 9923, 9924, 10027, 10028,
+    10029, 10131, 10132, 10133, 9717, 9718, 9821, 9822, 9823, 9925, 9926, 9927,
+    9511, 9512, 9615, 9616, 9617, 9719, 9720, 9721, 9305, 9306, 9409, 9410,
+    9413, 9513, 9514, 9517, 9101, 9102, 9205, 9206, 9207, 9309, 9310, 9311,
+    8895, 8896, 8999, 9000, 9001, 9103, 9104, 9105, 8689, 8690, 8793, 8794,
+    8795, 8897, 8898, 8899, 8483, 8484, 8587, 8588, 8589, 8691, 8692, 8693,
+    8277, 8278, 8381, 8382, 8383, 8485, 8486, 8487, 7863, 7864, 7967, 7968,
+    7969, 8279, 8280, 8281, 7657, 7658, 7761, 7762, 7763, 7865, 7866, 7867,
+    7451, 7452, 7555, 7556, 7557, 7659, 7660, 7661, 7245, 7246, 7349, 7350,
+    7351, 7453, 7454, 7455, 7039, 7040, 7143, 7144, 7145, 7247, 7248, 7249,
+    6833, 6834, 6937, 6938, 6939, 7041, 7042, 7043, 6627, 6628, 6731, 6732,
+    6735, 6835, 6836, 6839, 6423, 6424, 6527, 6528, 6529, 6631, 6632, 6633,
+    6217, 6218, 6321, 6322, 6323, 6425, 6426, 6427, 6011, 6012, 6115, 6116,
+    6117, 6219, 6220, 6221, 5805, 5806, 5909, 5910, 5911, 6013, 6014, 6015,
+    5599, 5600, 5703, 5704, 5705, 5807, 5808, 5809, 5185, 5186, 5289, 5290,
+    5291, 5601, 5602, 5603, 4979, 4980, 5083, 5084, 5085, 5187, 5188, 5189,
+    4773, 4774, 4877, 4878, 4879, 4981, 4982, 4983, 4567, 4568, 4671, 4672,
+    4673, 4775, 4776, 4777, 4361, 4362, 4465, 4466, 4467, 4569, 4570, 4571,
+    4155, 4156, 4259, 4260, 4261, 4363, 4364, 4365, 4468, 4469, 4572, 4573,
+    4574, 4676, 4677, 4678, 4674, 4675, 4778, 4779, 4780, 4882, 4883, 4884,
+    4880, 4881, 4984, 4985, 4986, 5088, 5089, 5090, 5086, 5087, 5190, 5191,
+    5192, 5294, 5295, 5296, 5292, 5293, 5604, 5605, 5606, 5708, 5709, 5710,
+    5706, 5707, 5810, 5811, 5812, 5914, 5915, 5916, 5912, 5913, 6016, 6017,
+    6018, 6120, 6121, 6122, 6118, 6119, 6222, 6223, 6224, 6326, 6327, 6328,
+    6324, 6325, 6428, 6429, 6430, 6532, 6533, 6534, 6530, 6531, 6634, 6635,
+    6636, 6738, 6739, 6740, 6736, 6737, 6840, 6841, 6842, 6944, 6945, 6946,
+    6940, 6943, 7044, 7047, 7048, 7148, 7151, 7152, 7146, 7147, 7250, 7251,
+    7252, 7354, 7355, 7356, 7352, 7353, 7456, 7457, 7458, 7560, 7561, 7562,
+    7558, 7559, 7662, 7663, 7664, 7766, 7767, 7768, 7764, 7765, 7868, 7869,
+    7870, 7972, 7973, 7974, 7970, 7971, 8282, 8283, 8284, 8386, 8387, 8388,
+    8384, 8385, 8488, 8489, 8490, 8592, 8593, 8594, 8590, 8591, 8694, 8695,
+    8696, 8798, 8799, 8800, 8796, 8797, 8900, 8901, 8902, 9004, 9005, 9006,
+    9002, 9003, 9106, 9107, 9108, 9210, 9211, 9212, 9208, 9209, 9312, 9313,
+    9314, 9416, 9417, 9418, 9414, 9415, 9518, 9519, 9520, 9622, 9623, 9624,
+    9618, 9621, 9722, 9725, 9726, 9826, 9829, 9830, 9824, 9825, 9928, 9929,
+    9930, 10032, 10033, 10034, 10030, 10031, 10134, 10135, 10136, 10238, 10239, 10240,
+    10236, 10237, 10340, 10341, 10342, 10444, 10445, 10446, 10442, 10443, 10546, 10547,
+    10548, 10650, 10651, 10652, 10343, 10344, 10447, 10448, 10449, 10551, 10552, 10553,
+    10137, 10138, 10241, 10242, 10245, 10345, 10346, 10349, 9933, 9934, 10037, 10038,
+    10039, 10141, 10142, 10143, 9727, 9728, 9831, 9832, 9833, 9935, 9936, 9937,
+    9521, 9522, 9625, 9626, 9627, 9729, 9730, 9731, 9315, 9316, 9419, 9420,
+    9421, 9523, 9524, 9525, 9109, 9110, 9213, 9214, 9215, 9317, 9318, 9319,
+    8903, 8904, 9007, 9008, 9009, 9111, 9112, 9113, 8697, 8698, 8801, 8802,
+    8803, 8905, 8906, 8907, 8491, 8492, 8595, 8596, 8597, 8699, 8700, 8701,
+    8285, 8286, 8389, 8390, 8391, 8493, 8494, 8495, 7871, 7872, 7975, 7976,
+    7977, 8287, 8288, 8289, 7665, 7666, 7769, 7770, 7771, 7873, 7874, 7875,
+    7459, 7460, 7563, 7564, 7567, 7667, 7668, 7671, 7255, 7256, 7359, 7360,
+    7361, 7463, 7464, 7465, 7049, 7050, 7153, 7154, 7155, 7257, 7258, 7259,
+    6843, 6844, 6947, 6948, 6949, 7051, 7052, 7053, 6637, 6638, 6741, 6742,
+    6743, 6845, 6846, 6847, 6431, 6432, 6535, 6536, 6537, 6639, 6640, 6641,
+    6225, 6226, 6329, 6330, 6331, 6433, 6434, 6435, 6019, 6020, 6123, 6124,
+    6125, 6227, 6228, 6229, 5813, 5814, 5917, 5918, 5919, 6021, 6022, 6023,
+    5607, 5608, 5711, 5712, 5713, 5815, 5816, 5817, 5193, 5194, 5297, 5298,
+    5299, 5609, 5610, 5611, 4987, 4988, 5091, 5092, 5093, 5195, 5196, 5197,
+    5300, 5301, 5612, 5613, 5614, 5716, 5717, 5718, 5714, 5715, 5818, 5819,
+    5820, 5922, 5923, 5924, 5920, 5921, 6024, 6025, 6026, 6128, 6129, 6130,
+    6126, 6127, 6230, 6231, 6232, 6334, 6335, 6336, 6332, 6333, 6436, 6437,
+    6438, 6540, 6541, 6542, 6538, 6539, 6642, 6643, 6644, 6746, 6747, 6748,
+    6744, 6745, 6848, 6849, 6850, 6952, 6953, 6954, 6950, 6951, 7054, 7055,
+    7056, 7158, 7159, 7160, 7156, 7157, 7260, 7261, 7262, 7364, 7365, 7366,
+    7362, 7363, 7466, 7467, 7468, 7570, 7571, 7572, 7568, 7569, 7672, 7673,
+    7674, 7776, 7777, 7778, 7772, 7775, 7876, 7879, 7880, 7980, 7983, 7984,
+    7978, 7979, 8290, 8291, 8292, 8394, 8395, 8396, 8392, 8393, 8496, 8497,
+    8498, 8600, 8601, 8602, 8598, 8599, 8702, 8703, 8704, 8806, 8807, 8808,
+    8804, 8805, 8908, 8909, 8910, 9012, 9013, 9014, 9010, 9011, 9114, 9115,
+    9116, 9218, 9219, 9220, 9216, 9217, 9320, 9321, 9322, 9424, 9425, 9426,
+    9422, 9423, 9526, 9527, 9528, 9630, 9631, 9632, 9628, 9629, 9732, 9733,
+    9734, 9836, 9837, 9838, 9834, 9835, 9938, 9939, 9940, 10042, 10043, 10044,
+    10040, 10041, 10144, 10145, 10146, 10248, 10249, 10250, 10246, 10247, 10350, 10351,
+    10352, 10454, 10455, 10456, 10450, 10453, 10554, 10557, 10558, 10658, 10661, 10662,
+    10353, 10354, 10457, 10458, 10459, 10561, 10562, 10563, 10147, 10148, 10251, 10252,
+    10253, 10355, 10356, 10357, 9941, 9942, 10045, 10046, 10047, 10149, 10150, 10151,
+    9735, 9736, 9839, 9840, 9841, 9943, 9944, 9945, 9529, 9530, 9633, 9634,
+    9635, 9737, 9738, 9739, 9323, 9324, 9427, 9428, 9429, 9531, 9532, 9533,
+    9117, 9118, 9221, 9222, 9223, 9325, 9326, 9327, 8911, 8912, 9015, 9016,
+    9017, 9119, 9120, 9121, 8705, 8706, 8809, 8810, 8811, 8913, 8914, 8915,
+    8499, 8500, 8603, 8604, 8607, 8707, 8708, 8711, 8295, 8296, 8399, 8400,
+    8401, 8503, 8504, 8505, 7881, 7882, 7985, 7986, 7987, 8297, 8298, 8299,
+    7675, 7676, 7779, 7780, 7781, 7883, 7884, 7885, 7469, 7470, 7573, 7574,
+    7575, 7677, 7678, 7679, 7263, 7264, 7367, 7368, 7369, 7471, 7472, 7473,
+    7057, 7058, 7161, 7162, 7163, 7265, 7266, 7267, 6851, 6852, 6955, 6956,
+    6957, 7059, 7060, 7061, 6645, 6646, 6749, 6750, 6751, 6853, 6854, 6855,
+    6439, 6440, 6543, 6544, 6545, 6647, 6648, 6649, 6233, 6234, 6337, 6338,
+    6339, 6441, 6442, 6443, 6027, 6028, 6131, 6132, 6133, 6235, 6236, 6237,
+    6340, 6341, 6444, 6445, 6446, 6548, 6549, 6550, 6546, 6547, 6650, 6651,
+    6652, 6754, 6755, 6756, 6752, 6753, 6856, 6857, 6858, 6960, 6961, 6962,
+    6958, 6959, 7062, 7063, 7064, 7166, 7167, 7168, 7164, 7165, 7268, 7269,
+    7270, 7372, 7373, 7374, 7370, 7371, 7474, 7475, 7476, 7578, 7579, 7580,
+    7576, 7577, 7680, 7681, 7682, 7784, 7785, 7786, 7782, 7783, 7886, 7887,
+    7888, 7990, 7991, 7992, 7988, 7989, 8300, 8301, 8302, 8404, 8405, 8406,
+    8402, 8403, 8506, 8507, 8508, 8610, 8611, 8612, 8608, 8609, 8712, 8713,
+    8714, 8816, 8817, 8818, 8812, 8815, 8916, 8919, 8920, 9020, 9023, 9024,
+    9018, 9019, 9122, 9123, 9124, 9226, 9227, 9228, 9224, 9225, 9328, 9329,
+    9330, 9432, 9433, 9434, 9430, 9431, 9534, 9535, 9536, 9638, 9639, 9640,
+    9636, 9637, 9740, 9741, 9742, 9844, 9845, 9846, 9842, 9843, 9946, 9947,
+    9948, 10050, 10051, 10052, 10048, 10049, 10152, 10153, 10154, 10256, 10257, 10258,
+    10254, 10255, 10358, 10359, 10360, 10462, 10463, 10464, 10460, 10461, 10564, 10565,
+    10566, 10668, 10669, 10670, 10361, 10362, 10465, 10466, 10467, 10569, 10570, 10571,
+    10155, 10156, 10259, 10260, 10261, 10363, 10364, 10365, 9949, 9950, 10053, 10054,
+    10055, 10157, 10158, 10159, 9743, 9744, 9847, 9848, 9849, 9951, 9952, 9953,
+    9537, 9538, 9641, 9642, 9643, 9745, 9746, 9747, 9331, 9332, 9435, 9436,
+    9439, 9539, 9540, 9543, 9127, 9128, 9231, 9232, 9233, 9335, 9336, 9337,
+    8921, 8922, 9025, 9026, 9027, 9129, 9130, 9131, 8715, 8716, 8819, 8820,
+    8821, 8923, 8924, 8925, 8509, 8510, 8613, 8614, 8615, 8717, 8718, 8719,
+    8303, 8304, 8407, 8408, 8409, 8511, 8512, 8513, 7889, 7890, 7993, 7994,
+    7995, 8305, 8306, 8307, 7683, 7684, 7787, 7788, 7789, 7891, 7892, 7893,
+    7477, 7478, 7581, 7582, 7583, 7685, 7686, 7687, 7271, 7272, 7375, 7376,
+    7377, 7479, 7480, 7481, 7065, 7066, 7169, 7170, 7171, 7273, 7274, 7275,
+    6859, 6860, 6963, 6964, 6965, 7067, 7068, 7069, 7172, 7173, 7276, 7277,
+    7278, 7380, 7381, 7382, 7378, 7379, 7482, 7483, 7484, 7586, 7587, 7588,
+    7584, 7585, 7688, 7689, 7690, 7792, 7793, 7794, 7790, 7791, 7894, 7895,
+    7896, 7998, 7999, 8000, 7996, 7997, 8308, 8309, 8310, 8412, 8413, 8414,
+    8410, 8411, 8514, 8515, 8516, 8618, 8619, 8620, 8616, 8617, 8720, 8721,
+    8722, 8824, 8825, 8826, 8822, 8823, 8926, 8927, 8928, 9030, 9031, 9032,
+    9028, 9029, 9132, 9133, 9134, 9236, 9237, 9238, 9234, 9235, 9338, 9339,
+    9340, 9442, 9443, 9444, 9440, 9441, 9544, 9545, 9546, 9648, 9649, 9650,
+    9644, 9647, 9748, 9751, 9752, 9852, 9855, 9856, 9850, 9851, 9954, 9955,
+    9956, 10058, 10059, 10060, 10056, 10057, 10160, 10161, 10162, 10264, 10265, 10266,
+    10262, 10263, 10366, 10367, 10368, 10470, 10471, 10472, 10468, 10469, 10572, 10573,
+    10574, 10676, 10677, 10678, 10369, 10370, 10473, 10474, 10475, 10577, 10578, 10579,
+    10163, 10164, 10267, 10268, 10271, 10371, 10372, 10375, 9959, 9960, 10063, 10064,
+    10065, 10167, 10168, 10169, 9753, 9754, 9857, 9858, 9859, 9961, 9962, 9963,
+    9547, 9548, 9651, 9652, 9653, 9755, 9756, 9757, 9341, 9342, 9445, 9446,
+    9447, 9549, 9550, 9551, 9135, 9136, 9239, 9240, 9241, 9343, 9344, 9345,
+    8929, 8930, 9033, 9034, 9035, 9137, 9138, 9139, 8723, 8724, 8827, 8828,
+    8829, 8931, 8932, 8933, 8517, 8518, 8621, 8622, 8623, 8725, 8726, 8727,
+    8311, 8312, 8415, 8416, 8417, 8519, 8520, 8521, 7897, 7898, 8001, 8002,
+    8003, 8313, 8314, 8315, 7691, 7692, 7795, 7796, 7797, 7899, 7900, 7901,
+    8004, 8005, 8316, 8317, 8318, 8420, 8421, 8422, 8418, 8419, 8522, 8523,
+    8524, 8626, 8627, 8628, 8624, 8625, 8728, 8729, 8730, 8832, 8833, 8834,
+    8830, 8831, 8934, 8935, 8936, 9038, 9039, 9040, 9036, 9037, 9140, 9141,
+    9142, 9244, 9245, 9246, 9242, 9243, 9346, 9347, 9348, 9450, 9451, 9452,
+    9448, 9449, 9552, 9553, 9554, 9656, 9657, 9658, 9654, 9655, 9758, 9759,
+    9760, 9862, 9863, 9864, 9860, 9861, 9964, 9965, 9966, 10068, 10069, 10070,
+    10066, 10067, 10170, 10171, 10172, 10274, 10275, 10276, 10272, 10273, 10376, 10377,
+    10378, 10480, 10481, 10482, 10476, 10479, 10580, 10583, 10584, 10684, 10687, 10688,
+    10379, 10380, 10483, 10484, 10485, 10587, 10588, 10589, 10173, 10174, 10277, 10278,
+    10279, 10381, 10382, 10383, 9967, 9968, 10071, 10072, 10073, 10175, 10176, 10177,
+    9761, 9762, 9865, 9866, 9867, 9969, 9970, 9971, 9555, 9556, 9659, 9660,
+    9661, 9763, 9764, 9765, 9349, 9350, 9453, 9454, 9455, 9557, 9558, 9559,
+    9143, 9144, 9247, 9248, 9249, 9351, 9352, 9353, 8937, 8938, 9041, 9042,
+    9043, 9145, 9146, 9147, 8731, 8732, 8835, 8836, 8837, 8939, 8940, 8941,
+    9044, 9045, 9148, 9149, 9150, 9252, 9253, 9254, 9250, 9251, 9354, 9355,
+    9356, 9458, 9459, 9460, 9456, 9457, 9560, 9561, 9562, 9664, 9665, 9666,
+    9662, 9663, 9766, 9767, 9768, 9870, 9871, 9872, 9868, 9869, 9972, 9973,
+    9974, 10076, 10077, 10078, 10074, 10075, 10178, 10179, 10180, 10282, 10283, 10284,
+    10280, 10281, 10384, 10385, 10386, 10488, 10489, 10490, 10486, 10487, 10590, 10591,
+    10592, 10694, 10695, 10696, 10387, 10388, 10491, 10492, 10493, 10595, 10596, 10597,
+    10181, 10182, 10285, 10286, 10287, 10389, 10390, 10391, 9975, 9976, 10079, 10080,
+    10081, 10183, 10184, 10185, 9769, 9770, 9873, 9874, 9875, 9977, 9978, 9979,
+    9563, 9564, 9667, 9668, 9669, 9771, 9772, 9773, 9876, 9877, 9980, 9981,
+    9982, 10084, 10085, 10086, 10082, 10083, 10186, 10187, 10188, 10290, 10291, 10292,
+    10288, 10289, 10392, 10393, 10394, 10496, 10497, 10498, 10494, 10495, 10598, 10599,
+    10600, 10702, 10703, 10704, 10395, 10396, 10499, 10500, 10501, 10603, 10604, 10605,
+};
+
+static const uint16_t bits_21[11664] = {
+    957, 958, 1077, 1078, 481, 1197, 1198, 601, 121, 122, 241, 242,
+    243, 361, 362, 363, 14047, 14048, 14167, 14168, 14169, 123, 124, 125,
+    14170, 14171, 126, 127, 128, 246, 247, 248, 244, 245, 364, 365,
+    366, 484, 485, 486, 482, 483, 602, 603, 604, 722, 723, 724,
+    1318, 721, 1438, 841, 842, 1558, 961, 962, 1917, 1918, 2037, 2038,
+    1441, 2157, 2158, 1561, 1081, 1082, 1201, 1202, 1203, 1321, 1322, 1323,
+    843, 844, 963, 964, 965, 1083, 1084, 1085, 605, 606, 725, 726,
+    727, 845, 846, 847, 367, 368, 487, 488, 489, 607, 608, 609,
+    129, 130, 249, 250, 251, 369, 370, 371, 14055, 14056, 14175, 14176,
+    14177, 131, 132, 133, 14178, 14181, 134, 135, 136, 254, 255, 256,
+    252, 253, 372, 373, 374, 492, 493, 494, 490, 491, 610, 611,
+    612, 730, 731, 732, 728, 729, 848, 849, 850, 968, 969, 970,
+    966, 967, 1086, 1087, 1088, 1206, 1207, 1208, 1204, 1205, 1324, 1325,
+    1326, 1444, 1445, 1446, 1442, 1443, 1562, 1563, 1564, 1682, 1683, 1684,
+    2278, 1681, 2638, 1801, 1802, 2758, 1921, 1922, 3117, 3118, 3237, 3238,
+    2641, 3357, 3358, 2761, 2041, 2042, 2161, 2162, 2163, 2521, 2522, 2523,
+    1803, 1804, 1923, 1924, 1925, 2043, 2044, 2045, 1565, 1566, 1685, 1686,
+    1687, 1805, 1806, 1807, 1327, 1328, 1447, 1448, 1449, 1567, 1568, 1569,
+    1089, 1090, 1209, 1210, 1211, 1329, 1330, 1331, 851, 852, 971, 972,
+    973, 1091, 1092, 1093, 613, 614, 733, 734, 735, 853, 854, 855,
+    375, 376, 495, 496, 497, 615, 616, 617, 137, 138, 257, 258,
+    261, 377, 378, 381, 14065, 14066, 14185, 14186, 14187, 141, 142, 143,
+    14188, 14189, 144, 145, 146, 264, 265, 266, 262, 263, 382, 383,
+    384, 502, 503, 504, 498, 501, 618, 621, 622, 738, 741, 742,
+    736, 737, 856, 857, 858, 976, 977, 978, 974, 975, 1094, 1095,
+    1096, 1214, 1215, 1216, 1212, 1213, 1332, 1333, 1334, 1452, 1453, 1454,
+    1450, 1451, 1570, 1571, 1572, 1690, 1691, 1692, 1688, 1689, 1808, 1809,
+    1810, 1928, 1929, 1930, 1926, 1927, 2046, 2047, 2048, 2166, 2167, 2168,
+    2164, 2165, 2524, 2525, 2526, 2644, 2645, 2646, 2642, 2643, 2762, 2763,
+    2764, 2882, 2883, 2884, 3478, 2881, 3598, 3001, 3002, 3718, 3121, 3122,
+    4077, 4078, 4197, 4198, 3601, 4317, 4318, 3721, 3241, 3242, 3361, 3362,
+    3363, 3481, 3482, 3483, 3003, 3004, 3123, 3124, 3125, 3243, 3244, 3245,
+    2765, 2766, 2885, 2886, 2887, 3005, 3006, 3007, 2527, 2528, 2647, 2648,
+    2649, 2767, 2768, 2769, 2049, 2050, 2169, 2170, 2171, 2529, 2530, 2531,
+    1811, 1812, 1931, 1932, 1933, 2051, 2052, 2053, 1573, 1574, 1693, 1694,
+    1695, 1813, 1814, 1815, 1335, 1336, 1455, 1456, 1457, 1575, 1576, 1577,
+    1097, 1098, 1217, 1218, 1221, 1337, 1338, 1341, 861, 862, 981, 982,
+    983, 1101, 1102, 1103, 623, 624, 743, 744, 745, 863, 864, 865,
+    385, 386, 505, 506, 507, 625, 626, 627, 147, 148, 267, 268,
+    269, 387, 388, 389, 14073, 14074, 14193, 14194, 14195, 149, 150, 151,
+    14196, 14197, 152, 153, 154, 272, 273, 274, 270, 271, 390, 391,
+    392, 510, 511, 512, 508, 509, 628, 629, 630, 748, 749, 750,
+    746, 747, 866, 867, 868, 986, 987, 988, 984, 985, 1104, 1105,
+    1106, 1224, 1225, 1226, 1222, 1223, 1342, 1343, 1344, 1462, 1463, 1464,
+    1458, 1461, 1578, 1581, 1582, 1698, 1701, 1702, 1696, 1697, 1816, 1817,
+    1818, 1936, 1937, 1938, 1934, 1935, 2054, 2055, 2056, 2174, 2175, 2176,
+    2172, 2173, 2532, 2533, 2534, 2652, 2653, 2654, 2650, 2651, 2770, 2771,
+    2772, 2890, 2891, 2892, 2888, 2889, 3008, 3009, 3010, 3128, 3129, 3130,
+    3126, 3127, 3246, 3247, 3248, 3366, 3367, 3368, 3364, 3365, 3484, 3485,
+    3486, 3604, 3605, 3606, 3602, 3603, 3722, 3723, 3724, 3842, 3843, 3844,
+    4438, 3841, 4558, 3961, 3962, 4678, 4081, 4082, 5277, 5278, 5397, 5398,
+    4561, 5517, 5518, 4921, 4201, 4202, 4321, 4322, 4323, 4441, 4442, 4443,
+    3963, 3964, 4083, 4084, 4085, 4203, 4204, 4205, 3725, 3726, 3845, 3846,
+    3847, 3965, 3966, 3967, 3487, 3488, 3607, 3608, 3609, 3727, 3728, 3729,
+    3249, 3250, 3369, 3370, 3371, 3489, 3490, 3491, 3011, 3012, 3131, 3132,
+    3133, 3251, 3252, 3253, 2773, 2774, 2893, 2894, 2895, 3013, 3014, 3015,
+    2535, 2536, 2655, 2656, 2657, 2775, 2776, 2777, 2057, 2058, 2177, 2178,
+    2181, 2537, 2538, 2541, 1821, 1822, 1941, 1942, 1943, 2061, 2062, 2063,
+    1583, 1584, 1703, 1704, 1705, 1823, 1824, 1825, 1345, 1346, 1465, 1466,
+    1467, 1585, 1586, 1587, 1107, 1108, 1227, 1228, 1229, 1347, 1348, 1349,
+    869, 870, 989, 990, 991, 1109, 1110, 1111, 631, 632, 751, 752,
+    753, 871, 872, 873, 393, 394, 513, 514, 515, 633, 634, 635,
+    155, 156, 275, 276, 277, 395, 396, 397, 14083, 14084, 14203, 14204,
+    14205, 157, 158, 161, 14206, 14207, 162, 163, 164, 282, 283, 284,
+    278, 281, 398, 401, 402, 518, 521, 522, 516, 517, 636, 637,
+    638, 756, 757, 758, 754, 755, 874, 875, 876, 994, 995, 996,
+    992, 993, 1112, 1113, 1114, 1232, 1233, 1234, 1230, 1231, 1350, 1351,
+    1352, 1470, 1471, 1472, 1468, 1469, 1588, 1589, 1590, 1708, 1709, 1710,
+    1706, 1707, 1826, 1827, 1828, 1946, 1947, 1948, 1944, 1945, 2064, 2065,
+    2066, 2184, 2185, 2186, 2182, 2183, 2542, 2543, 2544, 2662, 2663, 2664,
+    2658, 2661, 2778, 2781, 2782, 2898, 2901, 2902, 2896, 2897, 3016, 3017,
+    3018, 3136, 3137, 3138, 3134, 3135, 3254, 3255, 3256, 3374, 3375, 3376,
+    3372, 3373, 3492, 3493, 3494, 3612, 3613, 3614, 3610, 3611, 3730, 3731,
+    3732, 3850, 3851, 3852, 3848, 3849, 3968, 3969, 3970, 4088, 4089, 4090,
+    4086, 4087, 4206, 4207, 4208, 4326, 4327, 4328, 4324, 4325, 4444, 4445,
+    4446, 4564, 4565, 4566, 4562, 4563, 4922, 4923, 4924, 5042, 5043, 5044,
+    5638, 5041, 5758, 5161, 5162, 5878, 5281, 5282, 6237, 6238, 6357, 6358,
+    5761, 6477, 6478, 5881, 5401, 5402, 5521, 5522, 5523, 5641, 5642, 5643,
+    5163, 5164, 5283, 5284, 5285, 5403, 5404, 5405, 4925, 4926, 5045, 5046,
+    5047, 5165, 5166, 5167, 4447, 4448, 4567, 4568, 4569, 4927, 4928, 4929,
+    4209, 4210, 4329, 4330, 4331, 4449, 4450, 4451, 3971, 3972, 4091, 4092,
+    4093, 4211, 4212, 4213, 3733, 3734, 3853, 3854, 3855, 3973, 3974, 3975,
+    3495, 3496, 3615, 3616, 3617, 3735, 3736, 3737, 3257, 3258, 3377, 3378,
+    3381, 3497, 3498, 3501, 3021, 3022, 3141, 3142, 3143, 3261, 3262, 3263,
+    2783, 2784, 2903, 2904, 2905, 3023, 3024, 3025, 2545, 2546, 2665, 2666,
+    2667, 2785, 2786, 2787, 2067, 2068, 2187, 2188, 2189, 2547, 2548, 2549,
+    1829, 1830, 1949, 1950, 1951, 2069, 2070, 2071, 1591, 1592, 1711, 1712,
+    1713, 1831, 1832, 1833, 1353, 1354, 1473, 1474, 1475, 1593, 1594, 1595,
+    1115, 1116, 1235, 1236, 1237, 1355, 1356, 1357, 877, 878, 997, 998,
+    1001, 1117, 1118, 1121, 641, 642, 761, 762, 763, 881, 882, 883,
+    403, 404, 523, 524, 525, 643, 644, 645, 165, 166, 285, 286,
+    287, 405, 406, 407, 14091, 14092, 14211, 14212, 14213, 167, 168, 169,
+    14214, 14215, 170, 171, 172, 290, 291, 292, 288, 289, 408, 409,
+    410, 528, 529, 530, 526, 527, 646, 647, 648, 766, 767, 768,
+    764, 765, 884, 885, 886, 1004, 1005, 1006, 1002, 1003, 1122, 1123,
+    1124, 1242, 1243, 1244, 1238, 1241, 1358, 1361, 1362, 1478, 1481, 1482,
+    1476, 1477, 1596, 1597, 1598, 1716, 1717, 1718, 1714, 1715, 1834, 1835,
+    1836, 1954, 1955, 1956, 1952, 1953, 2072, 2073, 2074, 2192, 2193, 2194,
+    2190, 2191, 2550, 2551, 2552, 2670, 2671, 2672, 2668, 2669, 2788, 2789,
+    2790, 2908, 2909, 2910, 2906, 2907, 3026, 3027, 3028, 3146, 3147, 3148,
+    3144, 3145, 3264, 3265, 3266, 3384, 3385, 3386, 3382, 3383, 3502, 3503,
+    3504, 3622, 3623, 3624, 3618, 3621, 3738, 3741, 3742, 3858, 3861, 3862,
+    3856, 3857, 3976, 3977, 3978, 4096, 4097, 4098, 4094, 4095, 4214, 4215,
+    4216, 4334, 4335, 4336, 4332, 4333, 4452, 4453, 4454, 4572, 4573, 4574,
+    4570, 4571, 4930, 4931, 4932, 5050, 5051, 5052, 5048, 5049, 5168, 5169,
+    5170, 5288, 5289, 5290, 5286, 5287, 5406, 5407, 5408, 5526, 5527, 5528,
+    5524, 5525, 5644, 5645, 5646, 5764, 5765, 5766, 5762, 5763, 5882, 5883,
+    5884, 6002, 6003, 6004, 6598, 6001, 6718, 6121, 6122, 6838, 6241, 6242,
+    7437, 7438, 7557, 7558, 6721, 7677, 7678, 6841, 6361, 6362, 6481, 6482,
+    6483, 6601, 6602, 6603, 6123, 6124, 6243, 6244, 6245, 6363, 6364, 6365,
+    5885, 5886, 6005, 6006, 6007, 6125, 6126, 6127, 5647, 5648, 5767, 5768,
+    5769, 5887, 5888, 5889, 5409, 5410, 5529, 5530, 5531, 5649, 5650, 5651,
+    5171, 5172, 5291, 5292, 5293, 5411, 5412, 5413, 4933, 4934, 5053, 5054,
+    5055, 5173, 5174, 5175, 4455, 4456, 4575, 4576, 4577, 4935, 4936, 4937,
+    4217, 4218, 4337, 4338, 4341, 4457, 4458, 4461, 3981, 3982, 4101, 4102,
+    4103, 4221, 4222, 4223, 3743, 3744, 3863, 3864, 3865, 3983, 3984, 3985,
+    3505, 3506, 3625, 3626, 3627, 3745, 3746, 3747, 3267, 3268, 3387, 3388,
+    3389, 3507, 3508, 3509, 3029, 3030, 3149, 3150, 3151, 3269, 3270, 3271,
+    2791, 2792, 2911, 2912, 2913, 3031, 3032, 3033, 2553, 2554, 2673, 2674,
+    2675, 2793, 2794, 2795, 2075, 2076, 2195, 2196, 2197, 2555, 2556, 2557,
+    1837, 1838, 1957, 1958, 1961, 2077, 2078, 2081, 1601, 1602, 1721, 1722,
+    1723, 1841, 1842, 1843, 1363, 1364, 1483, 1484, 1485, 1603, 1604, 1605,
+    1125, 1126, 1245, 1246, 1247, 1365, 1366, 1367, 887, 888, 1007, 1008,
+    1009, 1127, 1128, 1129, 649, 650, 769, 770, 771, 889, 890, 891,
+    411, 412, 531, 532, 533, 651, 652, 653, 173, 174, 293, 294,
+    295, 413, 414, 415, 14101, 14102, 14221, 14222, 14223, 175, 176, 177,
+    14224, 14225, 178, 181, 182, 298, 301, 302, 296, 297, 416, 417,
+    418, 536, 537, 538, 534, 535, 654, 655, 656, 774, 775, 776,
+    772, 773, 892, 893, 894, 1012, 1013, 1014, 1010, 1011, 1130, 1131,
+    1132, 1250, 1251, 1252, 1248, 1249, 1368, 1369, 1370, 1488, 1489, 1490,
+    1486, 1487, 1606, 1607, 1608, 1726, 1727, 1728, 1724, 1725, 1844, 1845,
+    1846, 1964, 1965, 1966, 1962, 1963, 2082, 2083, 2084, 2202, 2203, 2204,
+    2198, 2201, 2558, 2561, 2562, 2678, 2681, 2682, 2676, 2677, 2796, 2797,
+    2798, 2916, 2917, 2918, 2914, 2915, 3034, 3035, 3036, 3154, 3155, 3156,
+    3152, 3153, 3272, 3273, 3274, 3392, 3393, 3394, 3390, 3391, 3510, 3511,
+    3512, 3630, 3631, 3632, 3628, 3629, 3748, 3749, 3750, 3868, 3869, 3870,
+    3866, 3867, 3986, 3987, 3988, 4106, 4107, 4108, 4104, 4105, 4224, 4225,
+    4226, 4344, 4345, 4346, 4342, 4343, 4462, 4463, 4464, 4582, 4583, 4584,
+    4578, 4581, 4938, 4941, 4942, 5058, 5061, 5062, 5056, 5057, 5176, 5177,
+    5178, 5296, 5297, 5298, 5294, 5295, 5414, 5415, 5416, 5534, 5535, 5536,
+    5532, 5533, 5652, 5653, 5654, 5772, 5773, 5774, 5770, 5771, 5890, 5891,
+    5892, 6010, 6011, 6012, 6008, 6009, 6128, 6129, 6130, 6248, 6249, 6250,
+    6246, 6247, 6366, 6367, 6368, 6486, 6487, 6488, 6484, 6485, 6604, 6605,
+    6606, 6724, 6725, 6726, 6722, 6723, 6842, 6843, 6844, 6962, 6963, 6964,
+    7798, 6961, 7918, 7321, 7322, 8038, 7441, 7442, 8397, 8398, 8517, 8518,
+    7921, 8637, 8638, 8041, 7561, 7562, 7681, 7682, 7683, 7801, 7802, 7803,
+    7323, 7324, 7443, 7444, 7445, 7563, 7564, 7565, 6845, 6846, 6965, 6966,
+    6967, 7325, 7326, 7327, 6607, 6608, 6727, 6728, 6729, 6847, 6848, 6849,
+    6369, 6370, 6489, 6490, 6491, 6609, 6610, 6611, 6131, 6132, 6251, 6252,
+    6253, 6371, 6372, 6373, 5893, 5894, 6013, 6014, 6015, 6133, 6134, 6135,
+    5655, 5656, 5775, 5776, 5777, 5895, 5896, 5897, 5417, 5418, 5537, 5538,
+    5541, 5657, 5658, 5661, 5181, 5182, 5301, 5302, 5303, 5421, 5422, 5423,
+    4943, 4944, 5063, 5064, 5065, 5183, 5184, 5185, 4465, 4466, 4585, 4586,
+    4587, 4945, 4946, 4947, 4227, 4228, 4347, 4348, 4349, 4467, 4468, 4469,
+    3989, 3990, 4109, 4110, 4111, 4229, 4230, 4231, 3751, 3752, 3871, 3872,
+    3873, 3991, 3992, 3993, 3513, 3514, 3633, 3634, 3635, 3753, 3754, 3755,
+    3275, 3276, 3395, 3396, 3397, 3515, 3516, 3517, 3037, 3038, 3157, 3158,
+    3161, 3277, 3278, 3281, 2801, 2802, 2921, 2922, 2923, 3041, 3042, 3043,
+    2563, 2564, 2683, 2684, 2685, 2803, 2804, 2805, 2085, 2086, 2205, 2206,
+    2207, 2565, 2566, 2567, 1847, 1848, 1967, 1968, 1969, 2087, 2088, 2089,
+    1609, 1610, 1729, 1730, 1731, 1849, 1850, 1851, 1371, 1372, 1491, 1492,
+    1493, 1611, 1612, 1613, 1133, 1134, 1253, 1254, 1255, 1373, 1374, 1375,
+    895, 896, 1015, 1016, 1017, 1135, 1136, 1137, 657, 658, 777, 778,
+    781, 897, 898, 901, 421, 422, 541, 542, 543, 661, 662, 663,
+    183, 184, 303, 304, 305, 423, 424, 425, 14109, 14110, 14229, 14230,
+    14231, 185, 186, 187, 14232, 14233, 188, 189, 190, 308, 309, 310,
+    306, 307, 426, 427, 428, 546, 547, 548, 544, 545, 664, 665,
+    666, 784, 785, 786, 782, 783, 902, 903, 904, 1022, 1023, 1024,
+    1018, 1021, 1138, 1141, 1142, 1258, 1261, 1262, 1256, 1257, 1376, 1377,
+    1378, 1496, 1497, 1498, 1494, 1495, 1614, 1615, 1616, 1734, 1735, 1736,
+    1732, 1733, 1852, 1853, 1854, 1972, 1973, 1974, 1970, 1971, 2090, 2091,
+    2092, 2210, 2211, 2212, 2208, 2209, 2568, 2569, 2570, 2688, 2689, 2690,
+    2686, 2687, 2806, 2807, 2808, 2926, 2927, 2928, 2924, 2925, 3044, 3045,
+    3046, 3164, 3165, 3166, 3162, 3163, 3282, 3283, 3284, 3402, 3403, 3404,
+    3398, 3401, 3518, 3521, 3522, 3638, 3641, 3642, 3636, 3637, 3756, 3757,
+    3758, 3876, 3877, 3878, 3874, 3875, 3994, 3995, 3996, 4114, 4115, 4116,
+    4112, 4113, 4232, 4233, 4234, 4352, 4353, 4354, 4350, 4351, 4470, 4471,
+    4472, 4590, 4591, 4592, 4588, 4589, 4948, 4949, 4950, 5068, 5069, 5070,
+    5066, 5067, 5186, 5187, 5188, 5306, 5307, 5308, 5304, 5305, 5424, 5425,
+    5426, 5544, 5545, 5546, 5542, 5543, 5662, 5663, 5664, 5782, 5783, 5784,
+    5778, 5781, 5898, 5901, 5902, 6018, 6021, 6022, 6016, 6017, 6136, 6137,
+    6138, 6256, 6257, 6258, 6254, 6255, 6374, 6375, 6376, 6494, 6495, 6496,
+    6492, 6493, 6612, 6613, 6614, 6732, 6733, 6734, 6730, 6731, 6850, 6851,
+    6852, 6970, 6971, 6972, 6968, 6969, 7328, 7329, 7330, 7448, 7449, 7450,
+    7446, 7447, 7566, 7567, 7568, 7686, 7687, 7688, 7684, 7685, 7804, 7805,
+    7806, 7924, 7925, 7926, 7922, 7923, 8042, 8043, 8044, 8162, 8163, 8164,
+    8758, 8161, 8878, 8281, 8282, 8998, 8401, 8402, 9357, 9358, 9477, 9478,
+    8881, 9837, 9838, 9001, 8521, 8522, 8641, 8642, 8643, 8761, 8762, 8763,
+    8283, 8284, 8403, 8404, 8405, 8523, 8524, 8525, 8045, 8046, 8165, 8166,
+    8167, 8285, 8286, 8287, 7807, 7808, 7927, 7928, 7929, 8047, 8048, 8049,
+    7569, 7570, 7689, 7690, 7691, 7809, 7810, 7811, 7331, 7332, 7451, 7452,
+    7453, 7571, 7572, 7573, 6853, 6854, 6973, 6974, 6975, 7333, 7334, 7335,
+    6615, 6616, 6735, 6736, 6737, 6855, 6856, 6857, 6377, 6378, 6497, 6498,
+    6501, 6617, 6618, 6621, 6141, 6142, 6261, 6262, 6263, 6381, 6382, 6383,
+    5903, 5904, 6023, 6024, 6025, 6143, 6144, 6145, 5665, 5666, 5785, 5786,
+    5787, 5905, 5906, 5907, 5427, 5428, 5547, 5548, 5549, 5667, 5668, 5669,
+    5189, 5190, 5309, 5310, 5311, 5429, 5430, 5431, 4951, 4952, 5071, 5072,
+    5073, 5191, 5192, 5193, 4473, 4474, 4593, 4594, 4595, 4953, 4954, 4955,
+    4235, 4236, 4355, 4356, 4357, 4475, 4476, 4477, 3997, 3998, 4117, 4118,
+    4121, 4237, 4238, 4241, 3761, 3762, 3881, 3882, 3883, 4001, 4002, 4003,
+    3523, 3524, 3643, 3644, 3645, 3763, 3764, 3765, 3285, 3286, 3405, 3406,
+    3407, 3525, 3526, 3527, 3047, 3048, 3167, 3168, 3169, 3287, 3288, 3289,
+    2809, 2810, 2929, 2930, 2931, 3049, 3050, 3051, 2571, 2572, 2691, 2692,
+    2693, 2811, 2812, 2813, 2093, 2094, 2213, 2214, 2215, 2573, 2574, 2575,
+    1855, 1856, 1975, 1976, 1977, 2095, 2096, 2097, 1617, 1618, 1737, 1738,
+    1741, 1857, 1858, 1861, 1381, 1382, 1501, 1502, 1503, 1621, 1622, 1623,
+    1143, 1144, 1263, 1264, 1265, 1383, 1384, 1385, 905, 906, 1025, 1026,
+    1027, 1145, 1146, 1147, 667, 668, 787, 788, 789, 907, 908, 909,
+    429, 430, 549, 550, 551, 669, 670, 671, 191, 192, 311, 312,
+    313, 431, 432, 433, 14117, 14118, 14237, 14238, 14241, 193, 194, 195,
+    14242, 14243, 196, 197, 198, 316, 317, 318, 314, 315, 434, 435,
+    436, 554, 555, 556, 552, 553, 672, 673, 674, 792, 793, 794,
+    790, 791, 910, 911, 912, 1030, 1031, 1032, 1028, 1029, 1148, 1149,
+    1150, 1268, 1269, 1270, 1266, 1267, 1386, 1387, 1388, 1506, 1507, 1508,
+    1504, 1505, 1624, 1625, 1626, 1744, 1745, 1746, 1742, 1743, 1862, 1863,
+    1864, 1982, 1983, 1984, 1978, 1981, 2098, 2101, 2102, 2218, 2221, 2222,
+    2216, 2217, 2576, 2577, 2578, 2696, 2697, 2698, 2694, 2695, 2814, 2815,
+    2816, 2934, 2935, 2936, 2932, 2933, 3052, 3053, 3054, 3172, 3173, 3174,
+    3170, 3171, 3290, 3291, 3292, 3410, 3411, 3412, 3408, 3409, 3528, 3529,
+    3530, 3648, 3649, 3650, 3646, 3647, 3766, 3767, 3768, 3886, 3887, 3888,
+    3884, 3885, 4004, 4005, 4006, 4124, 4125, 4126, 4122, 4123, 4242, 4243,
+    4244, 4362, 4363, 4364, 4358, 4361, 4478, 4481, 4482, 4598, 4601, 4602,
+    4596, 4597, 4956, 4957, 4958, 5076, 5077, 5078, 5074, 5075, 5194, 5195,
+    5196, 5314, 5315, 5316, 5312, 5313, 5432, 5433, 5434, 5552, 5553, 5554,
+    5550, 5551, 5670, 5671, 5672, 5790, 5791, 5792, 5788, 5789, 5908, 5909,
+    5910, 6028, 6029, 6030, 6026, 6027, 6146, 6147, 6148, 6266, 6267, 6268,
+    6264, 6265, 6384, 6385, 6386, 6504, 6505, 6506, 6502, 6503, 6622, 6623,
+    6624, 6742, 6743, 6744, 6738, 6741, 6858, 6861, 6862, 6978, 6981, 6982,
+    6976, 6977, 7336, 7337, 7338, 7456, 7457, 7458, 7454, 7455, 7574, 7575,
+    7576, 7694, 7695, 7696, 7692, 7693, 7812, 7813, 7814, 7932, 7933, 7934,
+    7930, 7931, 8050, 8051, 8052, 8170, 8171, 8172, 8168, 8169, 8288, 8289,
+    8290, 8408, 8409, 8410, 8406, 8407, 8526, 8527, 8528, 8646, 8647, 8648,
+    8644, 8645, 8764, 8765, 8766, 8884, 8885, 8886, 8882, 8883, 9002, 9003,
+    9004, 9122, 9123, 9124, 9958, 9121, 10078, 9241, 9242, 10198, 9361, 9362,
+    10557, 10558, 10677, 10678, 10081, 10797, 10798, 10201, 9721, 9722, 9841, 9842,
+    9843, 9961, 9962, 9963, 9243, 9244, 9363, 9364, 9365, 9723, 9724, 9725,
+    9005, 9006, 9125, 9126, 9127, 9245, 9246, 9247, 8767, 8768, 8887, 8888,
+    8889, 9007, 9008, 9009, 8529, 8530, 8649, 8650, 8651, 8769, 8770, 8771,
+    8291, 8292, 8411, 8412, 8413, 8531, 8532, 8533, 8053, 8054, 8173, 8174,
+    8175, 8293, 8294, 8295, 7815, 7816, 7935, 7936, 7937, 8055, 8056, 8057,
+    7577, 7578, 7697, 7698, 7701, 7817, 7818, 7821, 7341, 7342, 7461, 7462,
+    7463, 7581, 7582, 7583, 6863, 6864, 6983, 6984, 6985, 7343, 7344, 7345,
+    6625, 6626, 6745, 6746, 6747, 6865, 6866, 6867, 6387, 6388, 6507, 6508,
+    6509, 6627, 6628, 6629, 6149, 6150, 6269, 6270, 6271, 6389, 6390, 6391,
+    5911, 5912, 6031, 6032, 6033, 6151, 6152, 6153, 5673, 5674, 5793, 5794,
+    5795, 5913, 5914, 5915, 5435, 5436, 5555, 5556, 5557, 5675, 5676, 5677,
+    5197, 5198, 5317, 5318, 5321, 5437, 5438, 5441, 4961, 4962, 5081, 5082,
+    5083, 5201, 5202, 5203, 4483, 4484, 4603, 4604, 4605, 4963, 4964, 4965,
+    4245, 4246, 4365, 4366, 4367, 4485, 4486, 4487, 4007, 4008, 4127, 4128,
+    4129, 4247, 4248, 4249, 3769, 3770, 3889, 3890, 3891, 4009, 4010, 4011,
+    3531, 3532, 3651, 3652, 3653, 3771, 3772, 3773, 3293, 3294, 3413, 3414,
+    3415, 3533, 3534, 3535, 3055, 3056, 3175, 3176, 3177, 3295, 3296, 3297,
+    2817, 2818, 2937, 2938, 2941, 3057, 3058, 3061, 2581, 2582, 2701, 2702,
+    2703, 2821, 2822, 2823, 2103, 2104, 2223, 2224, 2225, 2583, 2584, 2585,
+    1865, 1866, 1985, 1986, 1987, 2105, 2106, 2107, 1627, 1628, 1747, 1748,
+    1749, 1867, 1868, 1869, 1389, 1390, 1509, 1510, 1511, 1629, 1630, 1631,
+    1151, 1152, 1271, 1272, 1273, 1391, 1392, 1393, 913, 914, 1033, 1034,
+    1035, 1153, 1154, 1155, 675, 676, 795, 796, 797, 915, 916, 917,
+    437, 438, 557, 558, 561, 677, 678, 681, 201, 202, 321, 322,
+    323, 441, 442, 443, 14127, 14128, 14247, 14248, 14249, 203, 204, 205,
+    14250, 14251, 206, 207, 208, 326, 327, 328, 324, 325, 444, 445,
+    446, 564, 565, 566, 562, 563, 682, 683, 684, 802, 803, 804,
+    798, 801, 918, 921, 922, 1038, 1041, 1042, 1036, 1037, 1156, 1157,
+    1158, 1276, 1277, 1278, 1274, 1275, 1394, 1395, 1396, 1514, 1515, 1516,
+    1512, 1513, 1632, 1633, 1634, 1752, 1753, 1754, 1750, 1751, 1870, 1871,
+    1872, 1990, 1991, 1992, 1988, 1989, 2108, 2109, 2110, 2228, 2229, 2230,
+    2226, 2227, 2586, 2587, 2588, 2706, 2707, 2708, 2704, 2705, 2824, 2825,
+    2826, 2944, 2945, 2946, 2942, 2943, 3062, 3063, 3064, 3182, 3183, 3184,
+    3178, 3181, 3298, 3301, 3302, 3418, 3421, 3422, 3416, 3417, 3536, 3537,
+    3538, 3656, 3657, 3658, 3654, 3655, 3774, 3775, 3776, 3894, 3895, 3896,
+    3892, 3893, 4012, 4013, 4014, 4132, 4133, 4134, 4130, 4131, 4250, 4251,
+    4252, 4370, 4371, 4372, 4368, 4369, 4488, 4489, 4490, 4608, 4609, 4610,
+    4606, 4607, 4966, 4967, 4968, 5086, 5087, 5088, 5084, 5085, 5204, 5205,
+    5206, 5324, 5325, 5326, 5322, 5323, 5442, 5443, 5444, 5562, 5563, 5564,
+    5558, 5561, 5678, 5681, 5682, 5798, 5801, 5802, 5796, 5797, 5916, 5917,
+    5918, 6036, 6037, 6038, 6034, 6035, 6154, 6155, 6156, 6274, 6275, 6276,
+    6272, 6273, 6392, 6393, 6394, 6512, 6513, 6514, 6510, 6511, 6630, 6631,
+    6632, 6750, 6751, 6752, 6748, 6749, 6868, 6869, 6870, 6988, 6989, 6990,
+    6986, 6987, 7346, 7347, 7348, 7466, 7467, 7468, 7464, 7465, 7584, 7585,
+    7586, 7704, 7705, 7706, 7702, 7703, 7822, 7823, 7824, 7942, 7943, 7944,
+    7938, 7941, 8058, 8061, 8062, 8178, 8181, 8182, 8176, 8177, 8296, 8297,
+    8298, 8416, 8417, 8418, 8414, 8415, 8534, 8535, 8536, 8654, 8655, 8656,
+    8652, 8653, 8772, 8773, 8774, 8892, 8893, 8894, 8890, 8891, 9010, 9011,
+    9012, 9130, 9131, 9132, 9128, 9129, 9248, 9249, 9250, 9368, 9369, 9370,
+    9366, 9367, 9726, 9727, 9728, 9846, 9847, 9848, 9844, 9845, 9964, 9965,
+    9966, 10084, 10085, 10086, 10082, 10083, 10202, 10203, 10204, 10322, 10323, 10324,
+    10918, 10321, 11038, 10441, 10442, 11158, 10561, 10562, 11517, 11518, 11637, 11638,
+    11041, 11757, 11758, 11161, 10681, 10682, 10801, 10802, 10803, 10921, 10922, 10923,
+    10443, 10444, 10563, 10564, 10565, 10683, 10684, 10685, 10205, 10206, 10325, 10326,
+    10327, 10445, 10446, 10447, 9967, 9968, 10087, 10088, 10089, 10207, 10208, 10209,
+    9729, 9730, 9849, 9850, 9851, 9969, 9970, 9971, 9251, 9252, 9371, 9372,
+    9373, 9731, 9732, 9733, 9013, 9014, 9133, 9134, 9135, 9253, 9254, 9255,
+    8775, 8776, 8895, 8896, 8897, 9015, 9016, 9017, 8537, 8538, 8657, 8658,
+    8661, 8777, 8778, 8781, 8301, 8302, 8421, 8422, 8423, 8541, 8542, 8543,
+    8063, 8064, 8183, 8184, 8185, 8303, 8304, 8305, 7825, 7826, 7945, 7946,
+    7947, 8065, 8066, 8067, 7587, 7588, 7707, 7708, 7709, 7827, 7828, 7829,
+    7349, 7350, 7469, 7470, 7471, 7589, 7590, 7591, 6871, 6872, 6991, 6992,
+    6993, 7351, 7352, 7353, 6633, 6634, 6753, 6754, 6755, 6873, 6874, 6875,
+    6395, 6396, 6515, 6516, 6517, 6635, 6636, 6637, 6157, 6158, 6277, 6278,
+    6281, 6397, 6398, 6401, 5921, 5922, 6041, 6042, 6043, 6161, 6162, 6163,
+    5683, 5684, 5803, 5804, 5805, 5923, 5924, 5925, 5445, 5446, 5565, 5566,
+    5567, 5685, 5686, 5687, 5207, 5208, 5327, 5328, 5329, 5447, 5448, 5449,
+    4969, 4970, 5089, 5090, 5091, 5209, 5210, 5211, 4491, 4492, 4611, 4612,
+    4613, 4971, 4972, 4973, 4253, 4254, 4373, 4374, 4375, 4493, 4494, 4495,
+    4015, 4016, 4135, 4136, 4137, 4255, 4256, 4257, 3777, 3778, 3897, 3898,
+    3901, 4017, 4018, 4021, 3541, 3542, 3661, 3662, 3663, 3781, 3782, 3783,
+    3303, 3304, 3423, 3424, 3425, 3543, 3544, 3545, 3065, 3066, 3185, 3186,
+    3187, 3305, 3306, 3307, 2827, 2828, 2947, 2948, 2949, 3067, 3068, 3069,
+    2589, 2590, 2709, 2710, 2711, 2829, 2830, 2831, 2111, 2112, 2231, 2232,
+    2233, 2591, 2592, 2593, 1873, 1874, 1993, 1994, 1995, 2113, 2114, 2115,
+    1635, 1636, 1755, 1756, 1757, 1875, 1876, 1877, 1397, 1398, 1517, 1518,
+    1521, 1637, 1638, 1641, 1161, 1162, 1281, 1282, 1283, 1401, 1402, 1403,
+    923, 924, 1043, 1044, 1045, 1163, 1164, 1165, 685, 686, 805, 806,
+    807, 925, 926, 927, 447, 448, 567, 568, 569, 687, 688, 689,
+    209, 210, 329, 330, 331, 449, 450, 451, 14135, 14136, 14255, 14256,
+    14257, 211, 212, 213, 14258, 14261, 214, 215, 216, 334, 335, 336,
+    332, 333, 452, 453, 454, 572, 573, 574, 570, 571, 690, 691,
+    692, 810, 811, 812, 808, 809, 928, 929, 930, 1048, 1049, 1050,
+    1046, 1047, 1166, 1167, 1168, 1286, 1287, 1288, 1284, 1285, 1404, 1405,
+    1406, 1524, 1525, 1526, 1522, 1523, 1642, 1643, 1644, 1762, 1763, 1764,
+    1758, 1761, 1878, 1881, 1882, 1998, 2001, 2002, 1996, 1997, 2116, 2117,
+    2118, 2236, 2237, 2238, 2234, 2235, 2594, 2595, 2596, 2714, 2715, 2716,
+    2712, 2713, 2832, 2833, 2834, 2952, 2953, 2954, 2950, 2951, 3070, 3071,
+    3072, 3190, 3191, 3192, 3188, 3189, 3308, 3309, 3310, 3428, 3429, 3430,
+    3426, 3427, 3546, 3547, 3548, 3666, 3667, 3668, 3664, 3665, 3784, 3785,
+    3786, 3904, 3905, 3906, 3902, 3903, 4022, 4023, 4024, 4142, 4143, 4144,
+    4138, 4141, 4258, 4261, 4262, 4378, 4381, 4382, 4376, 4377, 4496, 4497,
+    4498, 4616, 4617, 4618, 4614, 4615, 4974, 4975, 4976, 5094, 5095, 5096,
+    5092, 5093, 5212, 5213, 5214, 5332, 5333, 5334, 5330, 5331, 5450, 5451,
+    5452, 5570, 5571, 5572, 5568, 5569, 5688, 5689, 5690, 5808, 5809, 5810,
+    5806, 5807, 5926, 5927, 5928, 6046, 6047, 6048, 6044, 6045, 6164, 6165,
+    6166, 6284, 6285, 6286, 6282, 6283, 6402, 6403, 6404, 6522, 6523, 6524,
+    6518, 6521, 6638, 6641, 6642, 6758, 6761, 6762, 6756, 6757, 6876, 6877,
+    6878, 6996, 6997, 6998, 6994, 6995, 7354, 7355, 7356, 7474, 7475, 7476,
+    7472, 7473, 7592, 7593, 7594, 7712, 7713, 7714, 7710, 7711, 7830, 7831,
+    7832, 7950, 7951, 7952, 7948, 7949, 8068, 8069, 8070, 8188, 8189, 8190,
+    8186, 8187, 8306, 8307, 8308, 8426, 8427, 8428, 8424, 8425, 8544, 8545,
+    8546, 8664, 8665, 8666, 8662, 8663, 8782, 8783, 8784, 8902, 8903, 8904,
+    8898, 8901, 9018, 9021, 9022, 9138, 9141, 9142, 9136, 9137, 9256, 9257,
+    9258, 9376, 9377, 9378, 9374, 9375, 9734, 9735, 9736, 9854, 9855, 9856,
+    9852, 9853, 9972, 9973, 9974, 10092, 10093, 10094, 10090, 10091, 10210, 10211,
+    10212, 10330, 10331, 10332, 10328, 10329, 10448, 10449, 10450, 10568, 10569, 10570,
+    10566, 10567, 10686, 10687, 10688, 10806, 10807, 10808, 10804, 10805, 10924, 10925,
+    10926, 11044, 11045, 11046, 11042, 11043, 11162, 11163, 11164, 11282, 11283, 11284,
+    11878, 11281, 12238, 11401, 11402, 12358, 11521, 11522, 12717, 12718, 12837, 12838,
+    12241, 12957, 12958, 12361, 11641, 11642, 11761, 11762, 11763, 12121, 12122, 12123,
+    11403, 11404, 11523, 11524, 11525, 11643, 11644, 11645, 11165, 11166, 11285, 11286,
+    11287, 11405, 11406, 11407, 10927, 10928, 11047, 11048, 11049, 11167, 11168, 11169,
+    10689, 10690, 10809, 10810, 10811, 10929, 10930, 10931, 10451, 10452, 10571, 10572,
+    10573, 10691, 10692, 10693, 10213, 10214, 10333, 10334, 10335, 10453, 10454, 10455,
+    9975, 9976, 10095, 10096, 10097, 10215, 10216, 10217, 9737, 9738, 9857, 9858,
+    9861, 9977, 9978, 9981, 9261, 9262, 9381, 9382, 9383, 9741, 9742, 9743,
+    9023, 9024, 9143, 9144, 9145, 9263, 9264, 9265, 8785, 8786, 8905, 8906,
+    8907, 9025, 9026, 9027, 8547, 8548, 8667, 8668, 8669, 8787, 8788, 8789,
+    8309, 8310, 8429, 8430, 8431, 8549, 8550, 8551, 8071, 8072, 8191, 8192,
+    8193, 8311, 8312, 8313, 7833, 7834, 7953, 7954, 7955, 8073, 8074, 8075,
+    7595, 7596, 7715, 7716, 7717, 7835, 7836, 7837, 7357, 7358, 7477, 7478,
+    7481, 7597, 7598, 7601, 6881, 6882, 7001, 7002, 7003, 7361, 7362, 7363,
+    6643, 6644, 6763, 6764, 6765, 6883, 6884, 6885, 6405, 6406, 6525, 6526,
+    6527, 6645, 6646, 6647, 6167, 6168, 6287, 6288, 6289, 6407, 6408, 6409,
+    5929, 5930, 6049, 6050, 6051, 6169, 6170, 6171, 5691, 5692, 5811, 5812,
+    5813, 5931, 5932, 5933, 5453, 5454, 5573, 5574, 5575, 5693, 5694, 5695,
+    5215, 5216, 5335, 5336, 5337, 5455, 5456, 5457, 4977, 4978, 5097, 5098,
+    5101, 5217, 5218, 5221, 4501, 4502, 4621, 4622, 4623, 4981, 4982, 4983,
+    4263, 4264, 4383, 4384, 4385, 4503, 4504, 4505, 4025, 4026, 4145, 4146,
+    4147, 4265, 4266, 4267, 3787, 3788, 3907, 3908, 3909, 4027, 4028, 4029,
+    3549, 3550, 3669, 3670, 3671, 3789, 3790, 3791, 3311, 3312, 3431, 3432,
+    3433, 3551, 3552, 3553, 3073, 3074, 3193, 3194, 3195, 3313, 3314, 3315,
+    2835, 2836, 2955, 2956, 2957, 3075, 3076, 3077, 2597, 2598, 2717, 2718,
+    2721, 2837, 2838, 2841, 2121, 2122, 2241, 2242, 2243, 2601, 2602, 2603,
+    1883, 1884, 2003, 2004, 2005, 2123, 2124, 2125, 1645, 1646, 1765, 1766,
+    1767, 1885, 1886, 1887, 1407, 1408, 1527, 1528, 1529, 1647, 1648, 1649,
+    1169, 1170, 1289, 1290, 1291, 1409, 1410, 1411, 931, 932, 1051, 1052,
+    1053, 1171, 1172, 1173, 693, 694, 813, 814, 815, 933, 934, 935,
+    455, 456, 575, 576, 577, 695, 696, 697, 217, 218, 337, 338,
+    341, 457, 458, 461, 14145, 14146, 14265, 14266, 14267, 221, 222, 223,
+    14268, 14269, 224, 225, 226, 344, 345, 346, 342, 343, 462, 463,
+    464, 582, 583, 584, 578, 581, 698, 701, 702, 818, 821, 822,
+    816, 817, 936, 937, 938, 1056, 1057, 1058, 1054, 1055, 1174, 1175,
+    1176, 1294, 1295, 1296, 1292, 1293, 1412, 1413, 1414, 1532, 1533, 1534,
+    1530, 1531, 1650, 1651, 1652, 1770, 1771, 1772, 1768, 1769, 1888, 1889,
+    1890, 2008, 2009, 2010, 2006, 2007, 2126, 2127, 2128, 2246, 2247, 2248,
+    2244, 2245, 2604, 2605, 2606, 2724, 2725, 2726, 2722, 2723, 2842, 2843,
+    2844, 2962, 2963, 2964, 2958, 2961, 3078, 3081, 3082, 3198, 3201, 3202,
+    3196, 3197, 3316, 3317, 3318, 3436, 3437, 3438, 3434, 3435, 3554, 3555,
+    3556, 3674, 3675, 3676, 3672, 3673, 3792, 3793, 3794, 3912, 3913, 3914,
+    3910, 3911, 4030, 4031, 4032, 4150, 4151, 4152, 4148, 4149, 4268, 4269,
+    4270, 4388, 4389, 4390, 4386, 4387, 4506, 4507, 4508, 4626, 4627, 4628,
+    4624, 4625, 4984, 4985, 4986, 5104, 5105, 5106, 5102, 5103, 5222, 5223,
+    5224, 5342, 5343, 5344, 5338, 5341, 5458, 5461, 5462, 5578, 5581, 5582,
+    5576, 5577, 5696, 5697, 5698, 5816, 5817, 5818, 5814, 5815, 5934, 5935,
+    5936, 6054, 6055, 6056, 6052, 6053, 6172, 6173, 6174, 6292, 6293, 6294,
+    6290, 6291, 6410, 6411, 6412, 6530, 6531, 6532, 6528, 6529, 6648, 6649,
+    6650, 6768, 6769, 6770, 6766, 6767, 6886, 6887, 6888, 7006, 7007, 7008,
+    7004, 7005, 7364, 7365, 7366, 7484, 7485, 7486, 7482, 7483, 7602, 7603,
+    7604, 7722, 7723, 7724, 7718, 7721, 7838, 7841, 7842, 7958, 7961, 7962,
+    7956, 7957, 8076, 8077, 8078, 8196, 8197, 8198, 8194, 8195, 8314, 8315,
+    8316, 8434, 8435, 8436, 8432, 8433, 8552, 8553, 8554, 8672, 8673, 8674,
+    8670, 8671, 8790, 8791, 8792, 8910, 8911, 8912, 8908, 8909, 9028, 9029,
+    9030, 9148, 9149, 9150, 9146, 9147, 9266, 9267, 9268, 9386, 9387, 9388,
+    9384, 9385, 9744, 9745, 9746, 9864, 9865, 9866, 9862, 9863, 9982, 9983,
+    9984, 10102, 10103, 10104, 10098, 10101, 10218, 10221, 10222, 10338, 10341, 10342,
+    10336, 10337, 10456, 10457, 10458, 10576, 10577, 10578, 10574, 10575, 10694, 10695,
+    10696, 10814, 10815, 10816, 10812, 10813, 10932, 10933, 10934, 11052, 11053, 11054,
+    11050, 11051, 11170, 11171, 11172, 11290, 11291, 11292, 11288, 11289, 11408, 11409,
+    11410, 11528, 11529, 11530, 11526, 11527, 11646, 11647, 11648, 11766, 11767, 11768,
+    11764, 11765, 12124, 12125, 12126, 12244, 12245, 12246, 12242, 12243, 12362, 12363,
+    12364, 12482, 12483, 12484, 13078, 12481, 13198, 12601, 12602, 13318, 12721, 12722,
+    13677, 13678, 13797, 13798, 13201, 13917, 13918, 13321, 12841, 12842, 12961, 12962,
+    12963, 13081, 13082, 13083, 12603, 12604, 12723, 12724, 12725, 12843, 12844, 12845,
+    12365, 12366, 12485, 12486, 12487, 12605, 12606, 12607, 12127, 12128, 12247, 12248,
+    12249, 12367, 12368, 12369, 11649, 11650, 11769, 11770, 11771, 12129, 12130, 12131,
+    11411, 11412, 11531, 11532, 11533, 11651, 11652, 11653, 11173, 11174, 11293, 11294,
+    11295, 11413, 11414, 11415, 10935, 10936, 11055, 11056, 11057, 11175, 11176, 11177,
+    10697, 10698, 10817, 10818, 10821, 10937, 10938, 10941, 10461, 10462, 10581, 10582,
+    10583, 10701, 10702, 10703, 10223, 10224, 10343, 10344, 10345, 10463, 10464, 10465,
+    9985, 9986, 10105, 10106, 10107, 10225, 10226, 10227, 9747, 9748, 9867, 9868,
+    9869, 9987, 9988, 9989, 9269, 9270, 9389, 9390, 9391, 9749, 9750, 9751,
+    9031, 9032, 9151, 9152, 9153, 9271, 9272, 9273, 8793, 8794, 8913, 8914,
+    8915, 9033, 9034, 9035, 8555, 8556, 8675, 8676, 8677, 8795, 8796, 8797,
+    8317, 8318, 8437, 8438, 8441, 8557, 8558, 8561, 8081, 8082, 8201, 8202,
+    8203, 8321, 8322, 8323, 7843, 7844, 7963, 7964, 7965, 8083, 8084, 8085,
+    7605, 7606, 7725, 7726, 7727, 7845, 7846, 7847, 7367, 7368, 7487, 7488,
+    7489, 7607, 7608, 7609, 6889, 6890, 7009, 7010, 7011, 7369, 7370, 7371,
+    6651, 6652, 6771, 6772, 6773, 6891, 6892, 6893, 6413, 6414, 6533, 6534,
+    6535, 6653, 6654, 6655, 6175, 6176, 6295, 6296, 6297, 6415, 6416, 6417,
+    5937, 5938, 6057, 6058, 6061, 6177, 6178, 6181, 5701, 5702, 5821, 5822,
+    5823, 5941, 5942, 5943, 5463, 5464, 5583, 5584, 5585, 5703, 5704, 5705,
+    5225, 5226, 5345, 5346, 5347, 5465, 5466, 5467, 4987, 4988, 5107, 5108,
+    5109, 5227, 5228, 5229, 4509, 4510, 4629, 4630, 4631, 4989, 4990, 4991,
+    4271, 4272, 4391, 4392, 4393, 4511, 4512, 4513, 4033, 4034, 4153, 4154,
+    4155, 4273, 4274, 4275, 3795, 3796, 3915, 3916, 3917, 4035, 4036, 4037,
+    3557, 3558, 3677, 3678, 3681, 3797, 3798, 3801, 3321, 3322, 3441, 3442,
+    3443, 3561, 3562, 3563, 3083, 3084, 3203, 3204, 3205, 3323, 3324, 3325,
+    2845, 2846, 2965, 2966, 2967, 3085, 3086, 3087, 2607, 2608, 2727, 2728,
+    2729, 2847, 2848, 2849, 2129, 2130, 2249, 2250, 2251, 2609, 2610, 2611,
+    1891, 1892, 2011, 2012, 2013, 2131, 2132, 2133, 1653, 1654, 1773, 1774,
+    1775, 1893, 1894, 1895, 1415, 1416, 1535, 1536, 1537, 1655, 1656, 1657,
+    1177, 1178, 1297, 1298, 1301, 1417, 1418, 1421, 941, 942, 1061, 1062,
+    1063, 1181, 1182, 1183, 703, 704, 823, 824, 825, 943, 944, 945,
+    465, 466, 585, 586, 587, 705, 706, 707, 227, 228, 347, 348,
+    349, 467, 468, 469, 14153, 14154, 14273, 14274, 14275, 229, 230, 231,
+    14276, 14277, 232, 233, 234, 352, 353, 354, 350, 351, 470, 471,
+    472, 590, 591, 592, 588, 589, 708, 709, 710, 828, 829, 830,
+    826, 827, 946, 947, 948, 1066, 1067, 1068, 1064, 1065, 1184, 1185,
+    1186, 1304, 1305, 1306, 1302, 1303, 1422, 1423, 1424, 1542, 1543, 1544,
+    1538, 1541, 1658, 1661, 1662, 1778, 1781, 1782, 1776, 1777, 1896, 1897,
+    1898, 2016, 2017, 2018, 2014, 2015, 2134, 2135, 2136, 2254, 2255, 2256,
+    2252, 2253, 2612, 2613, 2614, 2732, 2733, 2734, 2730, 2731, 2850, 2851,
+    2852, 2970, 2971, 2972, 2968, 2969, 3088, 3089, 3090, 3208, 3209, 3210,
+    3206, 3207, 3326, 3327, 3328, 3446, 3447, 3448, 3444, 3445, 3564, 3565,
+    3566, 3684, 3685, 3686, 3682, 3683, 3802, 3803, 3804, 3922, 3923, 3924,
+    3918, 3921, 4038, 4041, 4042, 4158, 4161, 4162, 4156, 4157, 4276, 4277,
+    4278, 4396, 4397, 4398, 4394, 4395, 4514, 4515, 4516, 4634, 4635, 4636,
+    4632, 4633, 4992, 4993, 4994, 5112, 5113, 5114, 5110, 5111, 5230, 5231,
+    5232, 5350, 5351, 5352, 5348, 5349, 5468, 5469, 5470, 5588, 5589, 5590,
+    5586, 5587, 5706, 5707, 5708, 5826, 5827, 5828, 5824, 5825, 5944, 5945,
+    5946, 6064, 6065, 6066, 6062, 6063, 6182, 6183, 6184, 6302, 6303, 6304,
+    6298, 6301, 6418, 6421, 6422, 6538, 6541, 6542, 6536, 6537, 6656, 6657,
+    6658, 6776, 6777, 6778, 6774, 6775, 6894, 6895, 6896, 7014, 7015, 7016,
+    7012, 7013, 7372, 7373, 7374, 7492, 7493, 7494, 7490, 7491, 7610, 7611,
+    7612, 7730, 7731, 7732, 7728, 7729, 7848, 7849, 7850, 7968, 7969, 7970,
+    7966, 7967, 8086, 8087, 8088, 8206, 8207, 8208, 8204, 8205, 8324, 8325,
+    8326, 8444, 8445, 8446, 8442, 8443, 8562, 8563, 8564, 8682, 8683, 8684,
+    8678, 8681, 8798, 8801, 8802, 8918, 8921, 8922, 8916, 8917, 9036, 9037,
+    9038, 9156, 9157, 9158, 9154, 9155, 9274, 9275, 9276, 9394, 9395, 9396,
+    9392, 9393, 9752, 9753, 9754, 9872, 9873, 9874, 9870, 9871, 9990, 9991,
+    9992, 10110, 10111, 10112, 10108, 10109, 10228, 10229, 10230, 10348, 10349, 10350,
+    10346, 10347, 10466, 10467, 10468, 10586, 10587, 10588, 10584, 10585, 10704, 10705,
+    10706, 10824, 10825, 10826, 10822, 10823, 10942, 10943, 10944, 11062, 11063, 11064,
+    11058, 11061, 11178, 11181, 11182, 11298, 11301, 11302, 11296, 11297, 11416, 11417,
+    11418, 11536, 11537, 11538, 11534, 11535, 11654, 11655, 11656, 11774, 11775, 11776,
+    11772, 11773, 12132, 12133, 12134, 12252, 12253, 12254, 12250, 12251, 12370, 12371,
+    12372, 12490, 12491, 12492, 12488, 12489, 12608, 12609, 12610, 12728, 12729, 12730,
+    12726, 12727, 12846, 12847, 12848, 12966, 12967, 12968, 12964, 12965, 13084, 13085,
+    13086, 13204, 13205, 13206, 13202, 13203, 13322, 13323, 13324, 13442, 13443, 13444,
+    14038, 13441, 14158, 13561, 13562, 14278, 13681, 13682, 14161, 14162, 14163, 237,
+    238, 358, 478, 598, 13801, 13802, 13921, 13922, 13923, 14041, 14042, 14043,
+    13563, 13564, 13683, 13684, 13685, 13803, 13804, 13805, 13325, 13326, 13445, 13446,
+    13447, 13565, 13566, 13567, 13087, 13088, 13207, 13208, 13209, 13327, 13328, 13329,
+    12849, 12850, 12969, 12970, 12971, 13089, 13090, 13091, 12611, 12612, 12731, 12732,
+    12733, 12851, 12852, 12853, 12373, 12374, 12493, 12494, 12495, 12613, 12614, 12615,
+    12135, 12136, 12255, 12256, 12257, 12375, 12376, 12377, 11657, 11658, 11777, 11778,
+    11781, 12137, 12138, 12141, 11421, 11422, 11541, 11542, 11543, 11661, 11662, 11663,
+    11183, 11184, 11303, 11304, 11305, 11423, 11424, 11425, 10945, 10946, 11065, 11066,
+    11067, 11185, 11186, 11187, 10707, 10708, 10827, 10828, 10829, 10947, 10948, 10949,
+    10469, 10470, 10589, 10590, 10591, 10709, 10710, 10711, 10231, 10232, 10351, 10352,
+    10353, 10471, 10472, 10473, 9993, 9994, 10113, 10114, 10115, 10233, 10234, 10235,
+    9755, 9756, 9875, 9876, 9877, 9995, 9996, 9997, 9277, 9278, 9397, 9398,
+    9401, 9757, 9758, 9761, 9041, 9042, 9161, 9162, 9163, 9281, 9282, 9283,
+    8803, 8804, 8923, 8924, 8925, 9043, 9044, 9045, 8565, 8566, 8685, 8686,
+    8687, 8805, 8806, 8807, 8327, 8328, 8447, 8448, 8449, 8567, 8568, 8569,
+    8089, 8090, 8209, 8210, 8211, 8329, 8330, 8331, 7851, 7852, 7971, 7972,
+    7973, 8091, 8092, 8093, 7613, 7614, 7733, 7734, 7735, 7853, 7854, 7855,
+    7375, 7376, 7495, 7496, 7497, 7615, 7616, 7617, 6897, 6898, 7017, 7018,
+    7021, 7377, 7378, 7381, 6661, 6662, 6781, 6782, 6783, 6901, 6902, 6903,
+    6423, 6424, 6543, 6544, 6545, 6663, 6664, 6665, 6185, 6186, 6305, 6306,
+    6307, 6425, 6426, 6427, 5947, 5948, 6067, 6068, 6069, 6187, 6188, 6189,
+    5709, 5710, 5829, 5830, 5831, 5949, 5950, 5951, 5471, 5472, 5591, 5592,
+    5593, 5711, 5712, 5713, 5233, 5234, 5353, 5354, 5355, 5473, 5474, 5475,
+    4995, 4996, 5115, 5116, 5117, 5235, 5236, 5237, 4517, 4518, 4637, 4638,
+    4641, 4997, 4998, 5001, 4281, 4282, 4401, 4402, 4403, 4521, 4522, 4523,
+    4043, 4044, 4163, 4164, 4165, 4283, 4284, 4285, 3805, 3806, 3925, 3926,
+    3927, 4045, 4046, 4047, 3567, 3568, 3687, 3688, 3689, 3807, 3808, 3809,
+    3329, 3330, 3449, 3450, 3451, 3569, 3570, 3571, 3091, 3092, 3211, 3212,
+    3213, 3331, 3332, 3333, 2853, 2854, 2973, 2974, 2975, 3093, 3094, 3095,
+    2615, 2616, 2735, 2736, 2737, 2855, 2856, 2857, 2137, 2138, 2257, 2258,
+    2261, 2617, 2618, 2621, 1901, 1902, 2021, 2022, 2023, 2141, 2142, 2143,
+    1663, 1664, 1783, 1784, 1785, 1903, 1904, 1905, 1425, 1426, 1545, 1546,
+    1547, 1665, 1666, 1667, 1187, 1188, 1307, 1308, 1309, 1427, 1428, 1429,
+    949, 950, 1069, 1070, 1071, 1189, 1190, 1191, 711, 712, 831, 832,
+    833, 951, 952, 953, 473, 474, 593, 594, 595, 713, 714, 715,
+    235, 236, 355, 356, 357, 475, 476, 477, 596, 597, 716, 717,
+    718, 836, 837, 838, 834, 835, 954, 955, 956, 1074, 1075, 1076,
+    1072, 1073, 1192, 1193, 1194, 1312, 1313, 1314, 1310, 1311, 1430, 1431,
+    1432, 1550, 1551, 1552, 1548, 1549, 1668, 1669, 1670, 1788, 1789, 1790,
+    1786, 1787, 1906, 1907, 1908, 2026, 2027, 2028, 2024, 2025, 2144, 2145,
+    2146, 2264, 2265, 2266, 2262, 2263, 2622, 2623, 2624, 2742, 2743, 2744,
+    2738, 2741, 2858, 2861, 2862, 2978, 2981, 2982, 2976, 2977, 3096, 3097,
+    3098, 3216, 3217, 3218, 3214, 3215, 3334, 3335, 3336, 3454, 3455, 3456,
+    3452, 3453, 3572, 3573, 3574, 3692, 3693, 3694, 3690, 3691, 3810, 3811,
+    3812, 3930, 3931, 3932, 3928, 3929, 4048, 4049, 4050, 4168, 4169, 4170,
+    4166, 4167, 4286, 4287, 4288, 4406, 4407, 4408, 4404, 4405, 4524, 4525,
+    4526, 4644, 4645, 4646, 4642, 4643, 5002, 5003, 5004, 5122, 5123, 5124,
+    5118, 5121, 5238, 5241, 5242, 5358, 5361, 5362, 5356, 5357, 5476, 5477,
+    5478, 5596, 5597, 5598, 5594, 5595, 5714, 5715, 5716, 5834, 5835, 5836,
+    5832, 5833, 5952, 5953, 5954, 6072, 6073, 6074, 6070, 6071, 6190, 6191,
+    6192, 6310, 6311, 6312, 6308, 6309, 6428, 6429, 6430, 6548, 6549, 6550,
+    6546, 6547, 6666, 6667, 6668, 6786, 6787, 6788, 6784, 6785, 6904, 6905,
+    6906, 7024, 7025, 7026, 7022, 7023, 7382, 7383, 7384, 7502, 7503, 7504,
+    7498, 7501, 7618, 7621, 7622, 7738, 7741, 7742, 7736, 7737, 7856, 7857,
+    7858, 7976, 7977, 7978, 7974, 7975, 8094, 8095, 8096, 8214, 8215, 8216,
+    8212, 8213, 8332, 8333, 8334, 8452, 8453, 8454, 8450, 8451, 8570, 8571,
+    8572, 8690, 8691, 8692, 8688, 8689, 8808, 8809, 8810, 8928, 8929, 8930,
+    8926, 8927, 9046, 9047, 9048, 9166, 9167, 9168, 9164, 9165, 9284, 9285,
+    9286, 9404, 9405, 9406, 9402, 9403, 9762, 9763, 9764, 9882, 9883, 9884,
+    9878, 9881, 9998, 10001, 10002, 10118, 10121, 10122, 10116, 10117, 10236, 10237,
+    10238, 10356, 10357, 10358, 10354, 10355, 10474, 10475, 10476, 10594, 10595, 10596,
+    10592, 10593, 10712, 10713, 10714, 10832, 10833, 10834, 10830, 10831, 10950, 10951,
+    10952, 11070, 11071, 11072, 11068, 11069, 11188, 11189, 11190, 11308, 11309, 11310,
+    11306, 11307, 11426, 11427, 11428, 11546, 11547, 11548, 11544, 11545, 11664, 11665,
+    11666, 11784, 11785, 11786, 11782, 11783, 12142, 12143, 12144, 12262, 12263, 12264,
+    12258, 12261, 12378, 12381, 12382, 12498, 12501, 12502, 12496, 12497, 12616, 12617,
+    12618, 12736, 12737, 12738, 12734, 12735, 12854, 12855, 12856, 12974, 12975, 12976,
+    12972, 12973, 13092, 13093, 13094, 13212, 13213, 13214, 13210, 13211, 13330, 13331,
+    13332, 13450, 13451, 13452, 13448, 13449, 13568, 13569, 13570, 13688, 13689, 13690,
+    13686, 13687, 13806, 13807, 13808, 13926, 13927, 13928, 13924, 13925, 14044, 14045,
+    14046, 14164, 14165, 14166, 13809, 13810, 13929, 13930, 13931, 14049, 14050, 14051,
+    13571, 13572, 13691, 13692, 13693, 13811, 13812, 13813, 13333, 13334, 13453, 13454,
+    13455, 13573, 13574, 13575, 13095, 13096, 13215, 13216, 13217, 13335, 13336, 13337,
+    12857, 12858, 12977, 12978, 12981, 13097, 13098, 13101, 12621, 12622, 12741, 12742,
+    12743, 12861, 12862, 12863, 12383, 12384, 12503, 12504, 12505, 12623, 12624, 12625,
+    12145, 12146, 12265, 12266, 12267, 12385, 12386, 12387, 11667, 11668, 11787, 11788,
+    11789, 12147, 12148, 12149, 11429, 11430, 11549, 11550, 11551, 11669, 11670, 11671,
+    11191, 11192, 11311, 11312, 11313, 11431, 11432, 11433, 10953, 10954, 11073, 11074,
+    11075, 11193, 11194, 11195, 10715, 10716, 10835, 10836, 10837, 10955, 10956, 10957,
+    10477, 10478, 10597, 10598, 10601, 10717, 10718, 10721, 10241, 10242, 10361, 10362,
+    10363, 10481, 10482, 10483, 10003, 10004, 10123, 10124, 10125, 10243, 10244, 10245,
+    9765, 9766, 9885, 9886, 9887, 10005, 10006, 10007, 9287, 9288, 9407, 9408,
+    9409, 9767, 9768, 9769, 9049, 9050, 9169, 9170, 9171, 9289, 9290, 9291,
+    8811, 8812, 8931, 8932, 8933, 9051, 9052, 9053, 8573, 8574, 8693, 8694,
+    8695, 8813, 8814, 8815, 8335, 8336, 8455, 8456, 8457, 8575, 8576, 8577,
+    8097, 8098, 8217, 8218, 8221, 8337, 8338, 8341, 7861, 7862, 7981, 7982,
+    7983, 8101, 8102, 8103, 7623, 7624, 7743, 7744, 7745, 7863, 7864, 7865,
+    7385, 7386, 7505, 7506, 7507, 7625, 7626, 7627, 6907, 6908, 7027, 7028,
+    7029, 7387, 7388, 7389, 6669, 6670, 6789, 6790, 6791, 6909, 6910, 6911,
+    6431, 6432, 6551, 6552, 6553, 6671, 6672, 6673, 6193, 6194, 6313, 6314,
+    6315, 6433, 6434, 6435, 5955, 5956, 6075, 6076, 6077, 6195, 6196, 6197,
+    5717, 5718, 5837, 5838, 5841, 5957, 5958, 5961, 5481, 5482, 5601, 5602,
+    5603, 5721, 5722, 5723, 5243, 5244, 5363, 5364, 5365, 5483, 5484, 5485,
+    5005, 5006, 5125, 5126, 5127, 5245, 5246, 5247, 4527, 4528, 4647, 4648,
+    4649, 5007, 5008, 5009, 4289, 4290, 4409, 4410, 4411, 4529, 4530, 4531,
+    4051, 4052, 4171, 4172, 4173, 4291, 4292, 4293, 3813, 3814, 3933, 3934,
+    3935, 4053, 4054, 4055, 3575, 3576, 3695, 3696, 3697, 3815, 3816, 3817,
+    3337, 3338, 3457, 3458, 3461, 3577, 3578, 3581, 3101, 3102, 3221, 3222,
+    3223, 3341, 3342, 3343, 2863, 2864, 2983, 2984, 2985, 3103, 3104, 3105,
+    2625, 2626, 2745, 2746, 2747, 2865, 2866, 2867, 2147, 2148, 2267, 2268,
+    2269, 2627, 2628, 2629, 1909, 1910, 2029, 2030, 2031, 2149, 2150, 2151,
+    1671, 1672, 1791, 1792, 1793, 1911, 1912, 1913, 1433, 1434, 1553, 1554,
+    1555, 1673, 1674, 1675, 1195, 1196, 1315, 1316, 1317, 1435, 1436, 1437,
+    1556, 1557, 1676, 1677, 1678, 1796, 1797, 1798, 1794, 1795, 1914, 1915,
+    1916, 2034, 2035, 2036, 2032, 2033, 2152, 2153, 2154, 2272, 2273, 2274,
+    2270, 2271, 2630, 2631, 2632, 2750, 2751, 2752, 2748, 2749, 2868, 2869,
+    2870, 2988, 2989, 2990, 2986, 2987, 3106, 3107, 3108, 3226, 3227, 3228,
+    3224, 3225, 3344, 3345, 3346, 3464, 3465, 3466, 3462, 3463, 3582, 3583,
+    3584, 3702, 3703, 3704, 3698, 3701, 3818, 3821, 3822, 3938, 3941, 3942,
+    3936, 3937, 4056, 4057, 4058, 4176, 4177, 4178, 4174, 4175, 4294, 4295,
+    4296, 4414, 4415, 4416, 4412, 4413, 4532, 4533, 4534, 4652, 4653, 4654,
+    4650, 4651, 5010, 5011, 5012, 5130, 5131, 5132, 5128, 5129, 5248, 5249,
+    5250, 5368, 5369, 5370, 5366, 5367, 5486, 5487, 5488, 5606, 5607, 5608,
+    5604, 5605, 5724, 5725, 5726, 5844, 5845, 5846, 5842, 5843, 5962, 5963,
+    5964, 6082, 6083, 6084, 6078, 6081, 6198, 6201, 6202, 6318, 6321, 6322,
+    6316, 6317, 6436, 6437, 6438, 6556, 6557, 6558, 6554, 6555, 6674, 6675,
+    6676, 6794, 6795, 6796, 6792, 6793, 6912, 6913, 6914, 7032, 7033, 7034,
+    7030, 7031, 7390, 7391, 7392, 7510, 7511, 7512, 7508, 7509, 7628, 7629,
+    7630, 7748, 7749, 7750, 7746, 7747, 7866, 7867, 7868, 7986, 7987, 7988,
+    7984, 7985, 8104, 8105, 8106, 8224, 8225, 8226, 8222, 8223, 8342, 8343,
+    8344, 8462, 8463, 8464, 8458, 8461, 8578, 8581, 8582, 8698, 8701, 8702,
+    8696, 8697, 8816, 8817, 8818, 8936, 8937, 8938, 8934, 8935, 9054, 9055,
+    9056, 9174, 9175, 9176, 9172, 9173, 9292, 9293, 9294, 9412, 9413, 9414,
+    9410, 9411, 9770, 9771, 9772, 9890, 9891, 9892, 9888, 9889, 10008, 10009,
+    10010, 10128, 10129, 10130, 10126, 10127, 10246, 10247, 10248, 10366, 10367, 10368,
+    10364, 10365, 10484, 10485, 10486, 10604, 10605, 10606, 10602, 10603, 10722, 10723,
+    10724, 10842, 10843, 10844, 10838, 10841, 10958, 10961, 10962, 11078, 11081, 11082,
+    11076, 11077, 11196, 11197, 11198, 11316, 11317, 11318, 11314, 11315, 11434, 11435,
+    11436, 11554, 11555, 11556, 11552, 11553, 11672, 11673, 11674, 11792, 11793, 11794,
+    11790, 11791, 12150, 12151, 12152, 12270, 12271, 12272, 12268, 12269, 12388, 12389,
+    12390, 12508, 12509, 12510, 12506, 12507, 12626, 12627, 12628, 12746, 12747, 12748,
+    12744, 12745, 12864, 12865, 12866, 12984, 12985, 12986, 12982, 12983, 13102, 13103,
+    13104, 13222, 13223, 13224, 13218, 13221, 13338, 13341, 13342, 13458, 13461, 13462,
+    13456, 13457, 13576, 13577, 13578, 13696, 13697, 13698, 13694, 13695, 13814, 13815,
+    13816, 13934, 13935, 13936, 13932, 13933, 14052, 14053, 14054, 14172, 14173, 14174,
+    13817, 13818, 13937, 13938, 13941, 14057, 14058, 14061, 13581, 13582, 13701, 13702,
+    13703, 13821, 13822, 13823, 13343, 13344, 13463, 13464, 13465, 13583, 13584, 13585,
+    13105, 13106, 13225, 13226, 13227, 13345, 13346, 13347, 12867, 12868, 12987, 12988,
+    12989, 13107, 13108, 13109, 12629, 12630, 12749, 12750, 12751, 12869, 12870, 12871,
+    12391, 12392, 12511, 12512, 12513, 12631, 12632, 12633, 12153, 12154, 12273, 12274,
+    12275, 12393, 12394, 12395, 11675, 11676, 11795, 11796, 11797, 12155, 12156, 12157,
+    11437, 11438, 11557, 11558, 11561, 11677, 11678, 11681, 11201, 11202, 11321, 11322,
+    11323, 11441, 11442, 11443, 10963, 10964, 11083, 11084, 11085, 11203, 11204, 11205,
+    10725, 10726, 10845, 10846, 10847, 10965, 10966, 10967, 10487, 10488, 10607, 10608,
+    10609, 10727, 10728, 10729, 10249, 10250, 10369, 10370, 10371, 10489, 10490, 10491,
+    10011, 10012, 10131, 10132, 10133, 10251, 10252, 10253, 9773, 9774, 9893, 9894,
+    9895, 10013, 10014, 10015, 9295, 9296, 9415, 9416, 9417, 9775, 9776, 9777,
+    9057, 9058, 9177, 9178, 9181, 9297, 9298, 9301, 8821, 8822, 8941, 8942,
+    8943, 9061, 9062, 9063, 8583, 8584, 8703, 8704, 8705, 8823, 8824, 8825,
+    8345, 8346, 8465, 8466, 8467, 8585, 8586, 8587, 8107, 8108, 8227, 8228,
+    8229, 8347, 8348, 8349, 7869, 7870, 7989, 7990, 7991, 8109, 8110, 8111,
+    7631, 7632, 7751, 7752, 7753, 7871, 7872, 7873, 7393, 7394, 7513, 7514,
+    7515, 7633, 7634, 7635, 6915, 6916, 7035, 7036, 7037, 7395, 7396, 7397,
+    6677, 6678, 6797, 6798, 6801, 6917, 6918, 6921, 6441, 6442, 6561, 6562,
+    6563, 6681, 6682, 6683, 6203, 6204, 6323, 6324, 6325, 6443, 6444, 6445,
+    5965, 5966, 6085, 6086, 6087, 6205, 6206, 6207, 5727, 5728, 5847, 5848,
+    5849, 5967, 5968, 5969, 5489, 5490, 5609, 5610, 5611, 5729, 5730, 5731,
+    5251, 5252, 5371, 5372, 5373, 5491, 5492, 5493, 5013, 5014, 5133, 5134,
+    5135, 5253, 5254, 5255, 4535, 4536, 4655, 4656, 4657, 5015, 5016, 5017,
+    4297, 4298, 4417, 4418, 4421, 4537, 4538, 4541, 4061, 4062, 4181, 4182,
+    4183, 4301, 4302, 4303, 3823, 3824, 3943, 3944, 3945, 4063, 4064, 4065,
+    3585, 3586, 3705, 3706, 3707, 3825, 3826, 3827, 3347, 3348, 3467, 3468,
+    3469, 3587, 3588, 3589, 3109, 3110, 3229, 3230, 3231, 3349, 3350, 3351,
+    2871, 2872, 2991, 2992, 2993, 3111, 3112, 3113, 2633, 2634, 2753, 2754,
+    2755, 2873, 2874, 2875, 2155, 2156, 2275, 2276, 2277, 2635, 2636, 2637,
+    2756, 2757, 2876, 2877, 2878, 2996, 2997, 2998, 2994, 2995, 3114, 3115,
+    3116, 3234, 3235, 3236, 3232, 3233, 3352, 3353, 3354, 3472, 3473, 3474,
+    3470, 3471, 3590, 3591, 3592, 3710, 3711, 3712, 3708, 3709, 3828, 3829,
+    3830, 3948, 3949, 3950, 3946, 3947, 4066, 4067, 4068, 4186, 4187, 4188,
+    4184, 4185, 4304, 4305, 4306, 4424, 4425, 4426, 4422, 4423, 4542, 4543,
+    4544, 4662, 4663, 4664, 4658, 4661, 5018, 5021, 5022, 5138, 5141, 5142,
+    5136, 5137, 5256, 5257, 5258, 5376, 5377, 5378, 5374, 5375, 5494, 5495,
+    5496, 5614, 5615, 5616, 5612, 5613, 5732, 5733, 5734, 5852, 5853, 5854,
+    5850, 5851, 5970, 5971, 5972, 6090, 6091, 6092, 6088, 6089, 6208, 6209,
+    6210, 6328, 6329, 6330, 6326, 6327, 6446, 6447, 6448, 6566, 6567, 6568,
+    6564, 6565, 6684, 6685, 6686, 6804, 6805, 6806, 6802, 6803, 6922, 6923,
+    6924, 7042, 7043, 7044, 7038, 7041, 7398, 7401, 7402, 7518, 7521, 7522,
+    7516, 7517, 7636, 7637, 7638, 7756, 7757, 7758, 7754, 7755, 7874, 7875,
+    7876, 7994, 7995, 7996, 7992, 7993, 8112, 8113, 8114, 8232, 8233, 8234,
+    8230, 8231, 8350, 8351, 8352, 8470, 8471, 8472, 8468, 8469, 8588, 8589,
+    8590, 8708, 8709, 8710, 8706, 8707, 8826, 8827, 8828, 8946, 8947, 8948,
+    8944, 8945, 9064, 9065, 9066, 9184, 9185, 9186, 9182, 9183, 9302, 9303,
+    9304, 9422, 9423, 9424, 9418, 9421, 9778, 9781, 9782, 9898, 9901, 9902,
+    9896, 9897, 10016, 10017, 10018, 10136, 10137, 10138, 10134, 10135, 10254, 10255,
+    10256, 10374, 10375, 10376, 10372, 10373, 10492, 10493, 10494, 10612, 10613, 10614,
+    10610, 10611, 10730, 10731, 10732, 10850, 10851, 10852, 10848, 10849, 10968, 10969,
+    10970, 11088, 11089, 11090, 11086, 11087, 11206, 11207, 11208, 11326, 11327, 11328,
+    11324, 11325, 11444, 11445, 11446, 11564, 11565, 11566, 11562, 11563, 11682, 11683,
+    11684, 11802, 11803, 11804, 11798, 11801, 12158, 12161, 12162, 12278, 12281, 12282,
+    12276, 12277, 12396, 12397, 12398, 12516, 12517, 12518, 12514, 12515, 12634, 12635,
+    12636, 12754, 12755, 12756, 12752, 12753, 12872, 12873, 12874, 12992, 12993, 12994,
+    12990, 12991, 13110, 13111, 13112, 13230, 13231, 13232, 13228, 13229, 13348, 13349,
+    13350, 13468, 13469, 13470, 13466, 13467, 13586, 13587, 13588, 13706, 13707, 13708,
+    13704, 13705, 13824, 13825, 13826, 13944, 13945, 13946, 13942, 13943, 14062, 14063,
+    14064, 14182, 14183, 14184, 13827, 13828, 13947, 13948, 13949, 14067, 14068, 14069,
+    13589, 13590, 13709, 13710, 13711, 13829, 13830, 13831, 13351, 13352, 13471, 13472,
+    13473, 13591, 13592, 13593, 13113, 13114, 13233, 13234, 13235, 13353, 13354, 13355,
+    12875, 12876, 12995, 12996, 12997, 13115, 13116, 13117, 12637, 12638, 12757, 12758,
+    12761, 12877, 12878, 12881, 12401, 12402, 12521, 12522, 12523, 12641, 12642, 12643,
+    12163, 12164, 12283, 12284, 12285, 12403, 12404, 12405, 11685, 11686, 11805, 11806,
+    11807, 12165, 12166, 12167, 11447, 11448, 11567, 11568, 11569, 11687, 11688, 11689,
+    11209, 11210, 11329, 11330, 11331, 11449, 11450, 11451, 10971, 10972, 11091, 11092,
+    11093, 11211, 11212, 11213, 10733, 10734, 10853, 10854, 10855, 10973, 10974, 10975,
+    10495, 10496, 10615, 10616, 10617, 10735, 10736, 10737, 10257, 10258, 10377, 10378,
+    10381, 10497, 10498, 10501, 10021, 10022, 10141, 10142, 10143, 10261, 10262, 10263,
+    9783, 9784, 9903, 9904, 9905, 10023, 10024, 10025, 9305, 9306, 9425, 9426,
+    9427, 9785, 9786, 9787, 9067, 9068, 9187, 9188, 9189, 9307, 9308, 9309,
+    8829, 8830, 8949, 8950, 8951, 9069, 9070, 9071, 8591, 8592, 8711, 8712,
+    8713, 8831, 8832, 8833, 8353, 8354, 8473, 8474, 8475, 8593, 8594, 8595,
+    8115, 8116, 8235, 8236, 8237, 8355, 8356, 8357, 7877, 7878, 7997, 7998,
+    8001, 8117, 8118, 8121, 7641, 7642, 7761, 7762, 7763, 7881, 7882, 7883,
+    7403, 7404, 7523, 7524, 7525, 7643, 7644, 7645, 6925, 6926, 7045, 7046,
+    7047, 7405, 7406, 7407, 6687, 6688, 6807, 6808, 6809, 6927, 6928, 6929,
+    6449, 6450, 6569, 6570, 6571, 6689, 6690, 6691, 6211, 6212, 6331, 6332,
+    6333, 6451, 6452, 6453, 5973, 5974, 6093, 6094, 6095, 6213, 6214, 6215,
+    5735, 5736, 5855, 5856, 5857, 5975, 5976, 5977, 5497, 5498, 5617, 5618,
+    5621, 5737, 5738, 5741, 5261, 5262, 5381, 5382, 5383, 5501, 5502, 5503,
+    5023, 5024, 5143, 5144, 5145, 5263, 5264, 5265, 4545, 4546, 4665, 4666,
+    4667, 5025, 5026, 5027, 4307, 4308, 4427, 4428, 4429, 4547, 4548, 4549,
+    4069, 4070, 4189, 4190, 4191, 4309, 4310, 4311, 3831, 3832, 3951, 3952,
+    3953, 4071, 4072, 4073, 3593, 3594, 3713, 3714, 3715, 3833, 3834, 3835,
+    3355, 3356, 3475, 3476, 3477, 3595, 3596, 3597, 3716, 3717, 3836, 3837,
+    3838, 3956, 3957, 3958, 3954, 3955, 4074, 4075, 4076, 4194, 4195, 4196,
+    4192, 4193, 4312, 4313, 4314, 4432, 4433, 4434, 4430, 4431, 4550, 4551,
+    4552, 4670, 4671, 4672, 4668, 4669, 5028, 5029, 5030, 5148, 5149, 5150,
+    5146, 5147, 5266, 5267, 5268, 5386, 5387, 5388, 5384, 5385, 5504, 5505,
+    5506, 5624, 5625, 5626, 5622, 5623, 5742, 5743, 5744, 5862, 5863, 5864,
+    5858, 5861, 5978, 5981, 5982, 6098, 6101, 6102, 6096, 6097, 6216, 6217,
+    6218, 6336, 6337, 6338, 6334, 6335, 6454, 6455, 6456, 6574, 6575, 6576,
+    6572, 6573, 6692, 6693, 6694, 6812, 6813, 6814, 6810, 6811, 6930, 6931,
+    6932, 7050, 7051, 7052, 7048, 7049, 7408, 7409, 7410, 7528, 7529, 7530,
+    7526, 7527, 7646, 7647, 7648, 7766, 7767, 7768, 7764, 7765, 7884, 7885,
+    7886, 8004, 8005, 8006, 8002, 8003, 8122, 8123, 8124, 8242, 8243, 8244,
+    8238, 8241, 8358, 8361, 8362, 8478, 8481, 8482, 8476, 8477, 8596, 8597,
+    8598, 8716, 8717, 8718, 8714, 8715, 8834, 8835, 8836, 8954, 8955, 8956,
+    8952, 8953, 9072, 9073, 9074, 9192, 9193, 9194, 9190, 9191, 9310, 9311,
+    9312, 9430, 9431, 9432, 9428, 9429, 9788, 9789, 9790, 9908, 9909, 9910,
+    9906, 9907, 10026, 10027, 10028, 10146, 10147, 10148, 10144, 10145, 10264, 10265,
+    10266, 10384, 10385, 10386, 10382, 10383, 10502, 10503, 10504, 10622, 10623, 10624,
+    10618, 10621, 10738, 10741, 10742, 10858, 10861, 10862, 10856, 10857, 10976, 10977,
+    10978, 11096, 11097, 11098, 11094, 11095, 11214, 11215, 11216, 11334, 11335, 11336,
+    11332, 11333, 11452, 11453, 11454, 11572, 11573, 11574, 11570, 11571, 11690, 11691,
+    11692, 11810, 11811, 11812, 11808, 11809, 12168, 12169, 12170, 12288, 12289, 12290,
+    12286, 12287, 12406, 12407, 12408, 12526, 12527, 12528, 12524, 12525, 12644, 12645,
+    12646, 12764, 12765, 12766, 12762, 12763, 12882, 12883, 12884, 13002, 13003, 13004,
+    12998, 13001, 13118, 13121, 13122, 13238, 13241, 13242, 13236, 13237, 13356, 13357,
+    13358, 13476, 13477, 13478, 13474, 13475, 13594, 13595, 13596, 13714, 13715, 13716,
+    13712, 13713, 13832, 13833, 13834, 13952, 13953, 13954, 13950, 13951, 14070, 14071,
+    14072, 14190, 14191, 14192, 13835, 13836, 13955, 13956, 13957, 14075, 14076, 14077,
+    13597, 13598, 13717, 13718, 13721, 13837, 13838, 13841, 13361, 13362, 13481, 13482,
+    13483, 13601, 13602, 13603, 13123, 13124, 13243, 13244, 13245, 13363, 13364, 13365,
+    12885, 12886, 13005, 13006, 13007, 13125, 13126, 13127, 12647, 12648, 12767, 12768,
+    12769, 12887, 12888, 12889, 12409, 12410, 12529, 12530, 12531, 12649, 12650, 12651,
+    12171, 12172, 12291, 12292, 12293, 12411, 12412, 12413, 11693, 11694, 11813, 11814,
+    11815, 12173, 12174, 12175, 11455, 11456, 11575, 11576, 11577, 11695, 11696, 11697,
+    11217, 11218, 11337, 11338, 11341, 11457, 11458, 11461, 10981, 10982, 11101, 11102,
+    11103, 11221, 11222, 11223, 10743, 10744, 10863, 10864, 10865, 10983, 10984, 10985,
+    10505, 10506, 10625, 10626, 10627, 10745, 10746, 10747, 10267, 10268, 10387, 10388,
+    10389, 10507, 10508, 10509, 10029, 10030, 10149, 10150, 10151, 10269, 10270, 10271,
+    9791, 9792, 9911, 9912, 9913, 10031, 10032, 10033, 9313, 9314, 9433, 9434,
+    9435, 9793, 9794, 9795, 9075, 9076, 9195, 9196, 9197, 9315, 9316, 9317,
+    8837, 8838, 8957, 8958, 8961, 9077, 9078, 9081, 8601, 8602, 8721, 8722,
+    8723, 8841, 8842, 8843, 8363, 8364, 8483, 8484, 8485, 8603, 8604, 8605,
+    8125, 8126, 8245, 8246, 8247, 8365, 8366, 8367, 7887, 7888, 8007, 8008,
+    8009, 8127, 8128, 8129, 7649, 7650, 7769, 7770, 7771, 7889, 7890, 7891,
+    7411, 7412, 7531, 7532, 7533, 7651, 7652, 7653, 6933, 6934, 7053, 7054,
+    7055, 7413, 7414, 7415, 6695, 6696, 6815, 6816, 6817, 6935, 6936, 6937,
+    6457, 6458, 6577, 6578, 6581, 6697, 6698, 6701, 6221, 6222, 6341, 6342,
+    6343, 6461, 6462, 6463, 5983, 5984, 6103, 6104, 6105, 6223, 6224, 6225,
+    5745, 5746, 5865, 5866, 5867, 5985, 5986, 5987, 5507, 5508, 5627, 5628,
+    5629, 5747, 5748, 5749, 5269, 5270, 5389, 5390, 5391, 5509, 5510, 5511,
+    5031, 5032, 5151, 5152, 5153, 5271, 5272, 5273, 4553, 4554, 4673, 4674,
+    4675, 5033, 5034, 5035, 4315, 4316, 4435, 4436, 4437, 4555, 4556, 4557,
+    4676, 4677, 5036, 5037, 5038, 5156, 5157, 5158, 5154, 5155, 5274, 5275,
+    5276, 5394, 5395, 5396, 5392, 5393, 5512, 5513, 5514, 5632, 5633, 5634,
+    5630, 5631, 5750, 5751, 5752, 5870, 5871, 5872, 5868, 5869, 5988, 5989,
+    5990, 6108, 6109, 6110, 6106, 6107, 6226, 6227, 6228, 6346, 6347, 6348,
+    6344, 6345, 6464, 6465, 6466, 6584, 6585, 6586, 6582, 6583, 6702, 6703,
+    6704, 6822, 6823, 6824, 6818, 6821, 6938, 6941, 6942, 7058, 7061, 7062,
+    7056, 7057, 7416, 7417, 7418, 7536, 7537, 7538, 7534, 7535, 7654, 7655,
+    7656, 7774, 7775, 7776, 7772, 7773, 7892, 7893, 7894, 8012, 8013, 8014,
+    8010, 8011, 8130, 8131, 8132, 8250, 8251, 8252, 8248, 8249, 8368, 8369,
+    8370, 8488, 8489, 8490, 8486, 8487, 8606, 8607, 8608, 8726, 8727, 8728,
+    8724, 8725, 8844, 8845, 8846, 8964, 8965, 8966, 8962, 8963, 9082, 9083,
+    9084, 9202, 9203, 9204, 9198, 9201, 9318, 9321, 9322, 9438, 9441, 9442,
+    9436, 9437, 9796, 9797, 9798, 9916, 9917, 9918, 9914, 9915, 10034, 10035,
+    10036, 10154, 10155, 10156, 10152, 10153, 10272, 10273, 10274, 10392, 10393, 10394,
+    10390, 10391, 10510, 10511, 10512, 10630, 10631, 10632, 10628, 10629, 10748, 10749,
+    10750, 10868, 10869, 10870, 10866, 10867, 10986, 10987, 10988, 11106, 11107, 11108,
+    11104, 11105, 11224, 11225, 11226, 11344, 11345, 11346, 11342, 11343, 11462, 11463,
+    11464, 11582, 11583, 11584, 11578, 11581, 11698, 11701, 11702, 11818, 11821, 11822,
+    11816, 11817, 12176, 12177, 12178, 12296, 12297, 12298, 12294, 12295, 12414, 12415,
+    12416, 12534, 12535, 12536, 12532, 12533, 12652, 12653, 12654, 12772, 12773, 12774,
+    12770, 12771, 12890, 12891, 12892, 13010, 13011, 13012, 13008, 13009, 13128, 13129,
+    13130, 13248, 13249, 13250, 13246, 13247, 13366, 13367, 13368, 13486, 13487, 13488,
+    13484, 13485, 13604, 13605, 13606, 13724, 13725, 13726, 13722, 13723, 13842, 13843,
+    13844, 13962, 13963, 13964, 13958, 13961, 14078, 14081, 14082, 14198, 14201, 14202,
+    13845, 13846, 13965, 13966, 13967, 14085, 14086, 14087, 13607, 13608, 13727, 13728,
+    13729, 13847, 13848, 13849, 13369, 13370, 13489, 13490, 13491, 13609, 13610, 13611,
+    13131, 13132, 13251, 13252, 13253, 13371, 13372, 13373, 12893, 12894, 13013, 13014,
+    13015, 13133, 13134, 13135, 12655, 12656, 12775, 12776, 12777, 12895, 12896, 12897,
+    12417, 12418, 12537, 12538, 12541, 12657, 12658, 12661, 12181, 12182, 12301, 12302,
+    12303, 12421, 12422, 12423, 11703, 11704, 11823, 11824, 11825, 12183, 12184, 12185,
+    11465, 11466, 11585, 11586, 11587, 11705, 11706, 11707, 11227, 11228, 11347, 11348,
+    11349, 11467, 11468, 11469, 10989, 10990, 11109, 11110, 11111, 11229, 11230, 11231,
+    10751, 10752, 10871, 10872, 10873, 10991, 10992, 10993, 10513, 10514, 10633, 10634,
+    10635, 10753, 10754, 10755, 10275, 10276, 10395, 10396, 10397, 10515, 10516, 10517,
+    10037, 10038, 10157, 10158, 10161, 10277, 10278, 10281, 9801, 9802, 9921, 9922,
+    9923, 10041, 10042, 10043, 9323, 9324, 9443, 9444, 9445, 9803, 9804, 9805,
+    9085, 9086, 9205, 9206, 9207, 9325, 9326, 9327, 8847, 8848, 8967, 8968,
+    8969, 9087, 9088, 9089, 8609, 8610, 8729, 8730, 8731, 8849, 8850, 8851,
+    8371, 8372, 8491, 8492, 8493, 8611, 8612, 8613, 8133, 8134, 8253, 8254,
+    8255, 8373, 8374, 8375, 7895, 7896, 8015, 8016, 8017, 8135, 8136, 8137,
+    7657, 7658, 7777, 7778, 7781, 7897, 7898, 7901, 7421, 7422, 7541, 7542,
+    7543, 7661, 7662, 7663, 6943, 6944, 7063, 7064, 7065, 7423, 7424, 7425,
+    6705, 6706, 6825, 6826, 6827, 6945, 6946, 6947, 6467, 6468, 6587, 6588,
+    6589, 6707, 6708, 6709, 6229, 6230, 6349, 6350, 6351, 6469, 6470, 6471,
+    5991, 5992, 6111, 6112, 6113, 6231, 6232, 6233, 5753, 5754, 5873, 5874,
+    5875, 5993, 5994, 5995, 5515, 5516, 5635, 5636, 5637, 5755, 5756, 5757,
+    5876, 5877, 5996, 5997, 5998, 6116, 6117, 6118, 6114, 6115, 6234, 6235,
+    6236, 6354, 6355, 6356, 6352, 6353, 6472, 6473, 6474, 6592, 6593, 6594,
+    6590, 6591, 6710, 6711, 6712, 6830, 6831, 6832, 6828, 6829, 6948, 6949,
+    6950, 7068, 7069, 7070, 7066, 7067, 7426, 7427, 7428, 7546, 7547, 7548,
+    7544, 7545, 7664, 7665, 7666, 7784, 7785, 7786, 7782, 7783, 7902, 7903,
+    7904, 8022, 8023, 8024, 8018, 8021, 8138, 8141, 8142, 8258, 8261, 8262,
+    8256, 8257, 8376, 8377, 8378, 8496, 8497, 8498, 8494, 8495, 8614, 8615,
+    8616, 8734, 8735, 8736, 8732, 8733, 8852, 8853, 8854, 8972, 8973, 8974,
+    8970, 8971, 9090, 9091, 9092, 9210, 9211, 9212, 9208, 9209, 9328, 9329,
+    9330, 9448, 9449, 9450, 9446, 9447, 9806, 9807, 9808, 9926, 9927, 9928,
+    9924, 9925, 10044, 10045, 10046, 10164, 10165, 10166, 10162, 10163, 10282, 10283,
+    10284, 10402, 10403, 10404, 10398, 10401, 10518, 10521, 10522, 10638, 10641, 10642,
+    10636, 10637, 10756, 10757, 10758, 10876, 10877, 10878, 10874, 10875, 10994, 10995,
+    10996, 11114, 11115, 11116, 11112, 11113, 11232, 11233, 11234, 11352, 11353, 11354,
+    11350, 11351, 11470, 11471, 11472, 11590, 11591, 11592, 11588, 11589, 11708, 11709,
+    11710, 11828, 11829, 11830, 11826, 11827, 12186, 12187, 12188, 12306, 12307, 12308,
+    12304, 12305, 12424, 12425, 12426, 12544, 12545, 12546, 12542, 12543, 12662, 12663,
+    12664, 12782, 12783, 12784, 12778, 12781, 12898, 12901, 12902, 13018, 13021, 13022,
+    13016, 13017, 13136, 13137, 13138, 13256, 13257, 13258, 13254, 13255, 13374, 13375,
+    13376, 13494, 13495, 13496, 13492, 13493, 13612, 13613, 13614, 13732, 13733, 13734,
+    13730, 13731, 13850, 13851, 13852, 13970, 13971, 13972, 13968, 13969, 14088, 14089,
+    14090, 14208, 14209, 14210, 13853, 13854, 13973, 13974, 13975, 14093, 14094, 14095,
+    13615, 13616, 13735, 13736, 13737, 13855, 13856, 13857, 13377, 13378, 13497, 13498,
+    13501, 13617, 13618, 13621, 13141, 13142, 13261, 13262, 13263, 13381, 13382, 13383,
+    12903, 12904, 13023, 13024, 13025, 13143, 13144, 13145, 12665, 12666, 12785, 12786,
+    12787, 12905, 12906, 12907, 12427, 12428, 12547, 12548, 12549, 12667, 12668, 12669,
+    12189, 12190, 12309, 12310, 12311, 12429, 12430, 12431, 11711, 11712, 11831, 11832,
+    11833, 12191, 12192, 12193, 11473, 11474, 11593, 11594, 11595, 11713, 11714, 11715,
+    11235, 11236, 11355, 11356, 11357, 11475, 11476, 11477, 10997, 10998, 11117, 11118,
+    11121, 11237, 11238, 11241, 10761, 10762, 10881, 10882, 10883, 11001, 11002, 11003,
+    10523, 10524, 10643, 10644, 10645, 10763, 10764, 10765, 10285, 10286, 10405, 10406,
+    10407, 10525, 10526, 10527, 10047, 10048, 10167, 10168, 10169, 10287, 10288, 10289,
+    9809, 9810, 9929, 9930, 9931, 10049, 10050, 10051, 9331, 9332, 9451, 9452,
+    9453, 9811, 9812, 9813, 9093, 9094, 9213, 9214, 9215, 9333, 9334, 9335,
+    8855, 8856, 8975, 8976, 8977, 9095, 9096, 9097, 8617, 8618, 8737, 8738,
+    8741, 8857, 8858, 8861, 8381, 8382, 8501, 8502, 8503, 8621, 8622, 8623,
+    8143, 8144, 8263, 8264, 8265, 8383, 8384, 8385, 7905, 7906, 8025, 8026,
+    8027, 8145, 8146, 8147, 7667, 7668, 7787, 7788, 7789, 7907, 7908, 7909,
+    7429, 7430, 7549, 7550, 7551, 7669, 7670, 7671, 6951, 6952, 7071, 7072,
+    7073, 7431, 7432, 7433, 6713, 6714, 6833, 6834, 6835, 6953, 6954, 6955,
+    6475, 6476, 6595, 6596, 6597, 6715, 6716, 6717, 6836, 6837, 6956, 6957,
+    6958, 7076, 7077, 7078, 7074, 7075, 7434, 7435, 7436, 7554, 7555, 7556,
+    7552, 7553, 7672, 7673, 7674, 7792, 7793, 7794, 7790, 7791, 7910, 7911,
+    7912, 8030, 8031, 8032, 8028, 8029, 8148, 8149, 8150, 8268, 8269, 8270,
+    8266, 8267, 8386, 8387, 8388, 8506, 8507, 8508, 8504, 8505, 8624, 8625,
+    8626, 8744, 8745, 8746, 8742, 8743, 8862, 8863, 8864, 8982, 8983, 8984,
+    8978, 8981, 9098, 9101, 9102, 9218, 9221, 9222, 9216, 9217, 9336, 9337,
+    9338, 9456, 9457, 9458, 9454, 9455, 9814, 9815, 9816, 9934, 9935, 9936,
+    9932, 9933, 10052, 10053, 10054, 10172, 10173, 10174, 10170, 10171, 10290, 10291,
+    10292, 10410, 10411, 10412, 10408, 10409, 10528, 10529, 10530, 10648, 10649, 10650,
+    10646, 10647, 10766, 10767, 10768, 10886, 10887, 10888, 10884, 10885, 11004, 11005,
+    11006, 11124, 11125, 11126, 11122, 11123, 11242, 11243, 11244, 11362, 11363, 11364,
+    11358, 11361, 11478, 11481, 11482, 11598, 11601, 11602, 11596, 11597, 11716, 11717,
+    11718, 11836, 11837, 11838, 11834, 11835, 12194, 12195, 12196, 12314, 12315, 12316,
+    12312, 12313, 12432, 12433, 12434, 12552, 12553, 12554, 12550, 12551, 12670, 12671,
+    12672, 12790, 12791, 12792, 12788, 12789, 12908, 12909, 12910, 13028, 13029, 13030,
+    13026, 13027, 13146, 13147, 13148, 13266, 13267, 13268, 13264, 13265, 13384, 13385,
+    13386, 13504, 13505, 13506, 13502, 13503, 13622, 13623, 13624, 13742, 13743, 13744,
+    13738, 13741, 13858, 13861, 13862, 13978, 13981, 13982, 13976, 13977, 14096, 14097,
+    14098, 14216, 14217, 14218, 13863, 13864, 13983, 13984, 13985, 14103, 14104, 14105,
+    13625, 13626, 13745, 13746, 13747, 13865, 13866, 13867, 13387, 13388, 13507, 13508,
+    13509, 13627, 13628, 13629, 13149, 13150, 13269, 13270, 13271, 13389, 13390, 13391,
+    12911, 12912, 13031, 13032, 13033, 13151, 13152, 13153, 12673, 12674, 12793, 12794,
+    12795, 12913, 12914, 12915, 12435, 12436, 12555, 12556, 12557, 12675, 12676, 12677,
+    12197, 12198, 12317, 12318, 12321, 12437, 12438, 12441, 11721, 11722, 11841, 11842,
+    11843, 12201, 12202, 12203, 11483, 11484, 11603, 11604, 11605, 11723, 11724, 11725,
+    11245, 11246, 11365, 11366, 11367, 11485, 11486, 11487, 11007, 11008, 11127, 11128,
+    11129, 11247, 11248, 11249, 10769, 10770, 10889, 10890, 10891, 11009, 11010, 11011,
+    10531, 10532, 10651, 10652, 10653, 10771, 10772, 10773, 10293, 10294, 10413, 10414,
+    10415, 10533, 10534, 10535, 10055, 10056, 10175, 10176, 10177, 10295, 10296, 10297,
+    9817, 9818, 9937, 9938, 9941, 10057, 10058, 10061, 9341, 9342, 9461, 9462,
+    9463, 9821, 9822, 9823, 9103, 9104, 9223, 9224, 9225, 9343, 9344, 9345,
+    8865, 8866, 8985, 8986, 8987, 9105, 9106, 9107, 8627, 8628, 8747, 8748,
+    8749, 8867, 8868, 8869, 8389, 8390, 8509, 8510, 8511, 8629, 8630, 8631,
+    8151, 8152, 8271, 8272, 8273, 8391, 8392, 8393, 7913, 7914, 8033, 8034,
+    8035, 8153, 8154, 8155, 7675, 7676, 7795, 7796, 7797, 7915, 7916, 7917,
+    8036, 8037, 8156, 8157, 8158, 8276, 8277, 8278, 8274, 8275, 8394, 8395,
+    8396, 8514, 8515, 8516, 8512, 8513, 8632, 8633, 8634, 8752, 8753, 8754,
+    8750, 8751, 8870, 8871, 8872, 8990, 8991, 8992, 8988, 8989, 9108, 9109,
+    9110, 9228, 9229, 9230, 9226, 9227, 9346, 9347, 9348, 9466, 9467, 9468,
+    9464, 9465, 9824, 9825, 9826, 9944, 9945, 9946, 9942, 9943, 10062, 10063,
+    10064, 10182, 10183, 10184, 10178, 10181, 10298, 10301, 10302, 10418, 10421, 10422,
+    10416, 10417, 10536, 10537, 10538, 10656, 10657, 10658, 10654, 10655, 10774, 10775,
+    10776, 10894, 10895, 10896, 10892, 10893, 11012, 11013, 11014, 11132, 11133, 11134,
+    11130, 11131, 11250, 11251, 11252, 11370, 11371, 11372, 11368, 11369, 11488, 11489,
+    11490, 11608, 11609, 11610, 11606, 11607, 11726, 11727, 11728, 11846, 11847, 11848,
+    11844, 11845, 12204, 12205, 12206, 12324, 12325, 12326, 12322, 12323, 12442, 12443,
+    12444, 12562, 12563, 12564, 12558, 12561, 12678, 12681, 12682, 12798, 12801, 12802,
+    12796, 12797, 12916, 12917, 12918, 13036, 13037, 13038, 13034, 13035, 13154, 13155,
+    13156, 13274, 13275, 13276, 13272, 13273, 13392, 13393, 13394, 13512, 13513, 13514,
+    13510, 13511, 13630, 13631, 13632, 13750, 13751, 13752, 13748, 13749, 13868, 13869,
+    13870, 13988, 13989, 13990, 13986, 13987, 14106, 14107, 14108, 14226, 14227, 14228,
+    13871, 13872, 13991, 13992, 13993, 14111, 14112, 14113, 13633, 13634, 13753, 13754,
+    13755, 13873, 13874, 13875, 13395, 13396, 13515, 13516, 13517, 13635, 13636, 13637,
+    13157, 13158, 13277, 13278, 13281, 13397, 13398, 13401, 12921, 12922, 13041, 13042,
+    13043, 13161, 13162, 13163, 12683, 12684, 12803, 12804, 12805, 12923, 12924, 12925,
+    12445, 12446, 12565, 12566, 12567, 12685, 12686, 12687, 12207, 12208, 12327, 12328,
+    12329, 12447, 12448, 12449, 11729, 11730, 11849, 11850, 11851, 12209, 12210, 12211,
+    11491, 11492, 11611, 11612, 11613, 11731, 11732, 11733, 11253, 11254, 11373, 11374,
+    11375, 11493, 11494, 11495, 11015, 11016, 11135, 11136, 11137, 11255, 11256, 11257,
+    10777, 10778, 10897, 10898, 10901, 11017, 11018, 11021, 10541, 10542, 10661, 10662,
+    10663, 10781, 10782, 10783, 10303, 10304, 10423, 10424, 10425, 10543, 10544, 10545,
+    10065, 10066, 10185, 10186, 10187, 10305, 10306, 10307, 9827, 9828, 9947, 9948,
+    9949, 10067, 10068, 10069, 9349, 9350, 9469, 9470, 9471, 9829, 9830, 9831,
+    9111, 9112, 9231, 9232, 9233, 9351, 9352, 9353, 8873, 8874, 8993, 8994,
+    8995, 9113, 9114, 9115, 8635, 8636, 8755, 8756, 8757, 8875, 8876, 8877,
+    8996, 8997, 9116, 9117, 9118, 9236, 9237, 9238, 9234, 9235, 9354, 9355,
+    9356, 9474, 9475, 9476, 9472, 9473, 9832, 9833, 9834, 9952, 9953, 9954,
+    9950, 9951, 10070, 10071, 10072, 10190, 10191, 10192, 10188, 10189, 10308, 10309,
+    10310, 10428, 10429, 10430, 10426, 10427, 10546, 10547, 10548, 10666, 10667, 10668,
+    10664, 10665, 10784, 10785, 10786, 10904, 10905, 10906, 10902, 10903, 11022, 11023,
+    11024, 11142, 11143, 11144, 11138, 11141, 11258, 11261, 11262, 11378, 11381, 11382,
+    11376, 11377, 11496, 11497, 11498, 11616, 11617, 11618, 11614, 11615, 11734, 11735,
+    11736, 11854, 11855, 11856, 11852, 11853, 12212, 12213, 12214, 12332, 12333, 12334,
+    12330, 12331, 12450, 12451, 12452, 12570, 12571, 12572, 12568, 12569, 12688, 12689,
+    12690, 12808, 12809, 12810, 12806, 12807, 12926, 12927, 12928, 13046, 13047, 13048,
+    13044, 13045, 13164, 13165, 13166, 13284, 13285, 13286, 13282, 13283, 13402, 13403,
+    13404, 13522, 13523, 13524, 13518, 13521, 13638, 13641, 13642, 13758, 13761, 13762,
+    13756, 13757, 13876, 13877, 13878, 13996, 13997, 13998, 13994, 13995, 14114, 14115,
+    14116, 14234, 14235, 14236, 13881, 13882, 14001, 14002, 14003, 14121, 14122, 14123,
+    13643, 13644, 13763, 13764, 13765, 13883, 13884, 13885, 13405, 13406, 13525, 13526,
+    13527, 13645, 13646, 13647, 13167, 13168, 13287, 13288, 13289, 13407, 13408, 13409,
+    12929, 12930, 13049, 13050, 13051, 13169, 13170, 13171, 12691, 12692, 12811, 12812,
+    12813, 12931, 12932, 12933, 12453, 12454, 12573, 12574, 12575, 12693, 12694, 12695,
+    12215, 12216, 12335, 12336, 12337, 12455, 12456, 12457, 11737, 11738, 11857, 11858,
+    11861, 12217, 12218, 12221, 11501, 11502, 11621, 11622, 11623, 11741, 11742, 11743,
+    11263, 11264, 11383, 11384, 11385, 11503, 11504, 11505, 11025, 11026, 11145, 11146,
+    11147, 11265, 11266, 11267, 10787, 10788, 10907, 10908, 10909, 11027, 11028, 11029,
+    10549, 10550, 10669, 10670, 10671, 10789, 10790, 10791, 10311, 10312, 10431, 10432,
+    10433, 10551, 10552, 10553, 10073, 10074, 10193, 10194, 10195, 10313, 10314, 10315,
+    9835, 9836, 9955, 9956, 9957, 10075, 10076, 10077, 10196, 10197, 10316, 10317,
+    10318, 10436, 10437, 10438, 10434, 10435, 10554, 10555, 10556, 10674, 10675, 10676,
+    10672, 10673, 10792, 10793, 10794, 10912, 10913, 10914, 10910, 10911, 11030, 11031,
+    11032, 11150, 11151, 11152, 11148, 11149, 11268, 11269, 11270, 11388, 11389, 11390,
+    11386, 11387, 11506, 11507, 11508, 11626, 11627, 11628, 11624, 11625, 11744, 11745,
+    11746, 11864, 11865, 11866, 11862, 11863, 12222, 12223, 12224, 12342, 12343, 12344,
+    12338, 12341, 12458, 12461, 12462, 12578, 12581, 12582, 12576, 12577, 12696, 12697,
+    12698, 12816, 12817, 12818, 12814, 12815, 12934, 12935, 12936, 13054, 13055, 13056,
+    13052, 13053, 13172, 13173, 13174, 13292, 13293, 13294, 13290, 13291, 13410, 13411,
+    13412, 13530, 13531, 13532, 13528, 13529, 13648, 13649, 13650, 13768, 13769, 13770,
+    13766, 13767, 13886, 13887, 13888, 14006, 14007, 14008, 14004, 14005, 14124, 14125,
+    14126, 14244, 14245, 14246, 13889, 13890, 14009, 14010, 14011, 14129, 14130, 14131,
+    13651, 13652, 13771, 13772, 13773, 13891, 13892, 13893, 13413, 13414, 13533, 13534,
+    13535, 13653, 13654, 13655, 13175, 13176, 13295, 13296, 13297, 13415, 13416, 13417,
+    12937, 12938, 13057, 13058, 13061, 13177, 13178, 13181, 12701, 12702, 12821, 12822,
+    12823, 12941, 12942, 12943, 12463, 12464, 12583, 12584, 12585, 12703, 12704, 12705,
+    12225, 12226, 12345, 12346, 12347, 12465, 12466, 12467, 11747, 11748, 11867, 11868,
+    11869, 12227, 12228, 12229, 11509, 11510, 11629, 11630, 11631, 11749, 11750, 11751,
+    11271, 11272, 11391, 11392, 11393, 11511, 11512, 11513, 11033, 11034, 11153, 11154,
+    11155, 11273, 11274, 11275, 10795, 10796, 10915, 10916, 10917, 11035, 11036, 11037,
+    11156, 11157, 11276, 11277, 11278, 11396, 11397, 11398, 11394, 11395, 11514, 11515,
+    11516, 11634, 11635, 11636, 11632, 11633, 11752, 11753, 11754, 11872, 11873, 11874,
+    11870, 11871, 12230, 12231, 12232, 12350, 12351, 12352, 12348, 12349, 12468, 12469,
+    12470, 12588, 12589, 12590, 12586, 12587, 12706, 12707, 12708, 12826, 12827, 12828,
+    12824, 12825, 12944, 12945, 12946, 13064, 13065, 13066, 13062, 13063, 13182, 13183,
+    13184, 13302, 13303, 13304, 13298, 13301, 13418, 13421, 13422, 13538, 13541, 13542,
+    13536, 13537, 13656, 13657, 13658, 13776, 13777, 13778, 13774, 13775, 13894, 13895,
+    13896, 14014, 14015, 14016, 14012, 14013, 14132, 14133, 14134, 14252, 14253, 14254,
+    13897, 13898, 14017, 14018, 14021, 14137, 14138, 14141, 13661, 13662, 13781, 13782,
+    13783, 13901, 13902, 13903, 13423, 13424, 13543, 13544, 13545, 13663, 13664, 13665,
+    13185, 13186, 13305, 13306, 13307, 13425, 13426, 13427, 12947, 12948, 13067, 13068,
+    13069, 13187, 13188, 13189, 12709, 12710, 12829, 12830, 12831, 12949, 12950, 12951,
+    12471, 12472, 12591, 12592, 12593, 12711, 12712, 12713, 12233, 12234, 12353, 12354,
+    12355, 12473, 12474, 12475, 11755, 11756, 11875, 11876, 11877, 12235, 12236, 12237,
+    12356, 12357, 12476, 12477, 12478, 12596, 12597, 12598, 12594, 12595, 12714, 12715,
+    12716, 12834, 12835, 12836, 12832, 12833, 12952, 12953, 12954, 13072, 13073, 13074,
+    13070, 13071, 13190, 13191, 13192, 13310, 13311, 13312, 13308, 13309, 13428, 13429,
+    13430, 13548, 13549, 13550, 13546, 13547, 13666, 13667, 13668, 13786, 13787, 13788,
+    13784, 13785, 13904, 13905, 13906, 14024, 14025, 14026, 14022, 14023, 14142, 14143,
+    14144, 14262, 14263, 14264, 13907, 13908, 14027, 14028, 14029, 14147, 14148, 14149,
+    13669, 13670, 13789, 13790, 13791, 13909, 13910, 13911, 13431, 13432, 13551, 13552,
+    13553, 13671, 13672, 13673, 13193, 13194, 13313, 13314, 13315, 13433, 13434, 13435,
+    12955, 12956, 13075, 13076, 13077, 13195, 13196, 13197, 13316, 13317, 13436, 13437,
+    13438, 13556, 13557, 13558, 13554, 13555, 13674, 13675, 13676, 13794, 13795, 13796,
+    13792, 13793, 13912, 13913, 13914, 14032, 14033, 14034, 14030, 14031, 14150, 14151,
+    14152, 14270, 14271, 14272, 13915, 13916, 14035, 14036, 14037, 14155, 14156, 14157,
+};
+
+static const uint16_t bits_22[14400] = {
+    525, 526, 657, 658, 529, 789, 790, 661, 133, 134, 265, 266,
+    267, 397, 398, 399, 17031, 17032, 17163, 17164, 17165, 135, 136, 137,
+    17166, 17167, 138, 139, 140, 270, 271, 272, 268, 269, 400, 401,
+    402, 532, 533, 534, 530, 531, 662, 663, 664, 794, 795, 796,
+    922, 793, 1054, 925, 926, 1186, 1057, 1058, 1581, 1582, 1713, 1714,
+    1585, 1845, 1846, 1717, 1189, 1190, 1321, 1322, 1323, 1453, 1454, 1455,
+    927, 928, 1059, 1060, 1061, 1191, 1192, 1193, 665, 666, 797, 798,
+    799, 929, 930, 931, 403, 404, 535, 536, 537, 667, 668, 669,
+    141, 142, 273, 274, 275, 405, 406, 407, 17039, 17040, 17171, 17172,
+    17173, 143, 144, 145, 17174, 17175, 146, 147, 148, 278, 279, 280,
+    276, 277, 408, 409, 410, 540, 541, 542, 538, 539, 670, 671,
+    672, 802, 803, 804, 800, 801, 932, 933, 934, 1064, 1065, 1066,
+    1062, 1063, 1194, 1195, 1196, 1326, 1327, 1328, 1324, 1325, 1456, 1457,
+    1458, 1588, 1589, 1590, 1586, 1587, 1718, 1719, 1720, 1850, 1851, 1852,
+    1978, 1849, 2110, 1981, 1982, 2242, 2113, 2114, 2637, 2638, 2769, 2770,
+    2641, 3165, 3166, 3037, 2245, 2246, 2377, 2378, 2379, 2509, 2510, 2511,
+    1983, 1984, 2115, 2116, 2117, 2247, 2248, 2249, 1721, 1722, 1853, 1854,
+    1855, 1985, 1986, 1987, 1459, 1460, 1591, 1592, 1593, 1723, 1724, 1725,
+    1197, 1198, 1329, 1330, 1331, 1461, 1462, 1463, 935, 936, 1067, 1068,
+    1069, 1199, 1200, 1201, 673, 674, 805, 806, 807, 937, 938, 939,
+    411, 412, 543, 544, 545, 675, 676, 677, 149, 150, 281, 282,
+    283, 413, 414, 415, 17047, 17048, 17179, 17180, 17183, 151, 152, 155,
+    17184, 17185, 156, 157, 158, 288, 289, 290, 284, 287, 416, 419,
+    420, 548, 551, 552, 546, 547, 678, 679, 680, 810, 811, 812,
+    808, 809, 940, 941, 942, 1072, 1073, 1074, 1070, 1071, 1202, 1203,
+    1204, 1334, 1335, 1336, 1332, 1333, 1464, 1465, 1466, 1596, 1597, 1598,
+    1594, 1595, 1726, 1727, 1728, 1858, 1859, 1860, 1856, 1857, 1988, 1989,
+    1990, 2120, 2121, 2122, 2118, 2119, 2250, 2251, 2252, 2382, 2383, 2384,
+    2380, 2381, 2512, 2513, 2514, 2644, 2645, 2646, 2642, 2643, 3038, 3039,
+    3040, 3170, 3171, 3172, 3298, 3169, 3430, 3301, 3302, 3562, 3433, 3434,
+    3957, 3958, 4089, 4090, 3961, 4221, 4222, 4093, 3565, 3566, 3697, 3698,
+    3699, 3829, 3830, 3831, 3303, 3304, 3435, 3436, 3437, 3567, 3568, 3569,
+    3041, 3042, 3173, 3174, 3175, 3305, 3306, 3307, 2515, 2516, 2647, 2648,
+    2649, 3043, 3044, 3045, 2253, 2254, 2385, 2386, 2387, 2517, 2518, 2519,
+    1991, 1992, 2123, 2124, 2125, 2255, 2256, 2257, 1729, 1730, 1861, 1862,
+    1863, 1993, 1994, 1995, 1467, 1468, 1599, 1600, 1601, 1731, 1732, 1733,
+    1205, 1206, 1337, 1338, 1339, 1469, 1470, 1471, 943, 944, 1075, 1076,
+    1079, 1207, 1208, 1211, 683, 684, 815, 816, 817, 947, 948, 949,
+    421, 422, 553, 554, 555, 685, 686, 687, 159, 160, 291, 292,
+    293, 423, 424, 425, 17057, 17058, 17189, 17190, 17191, 161, 162, 163,
+    17192, 17193, 164, 165, 166, 296, 297, 298, 294, 295, 426, 427,
+    428, 558, 559, 560, 556, 557, 688, 689, 690, 820, 821, 822,
+    818, 819, 950, 951, 952, 1082, 1083, 1084, 1080, 1081, 1212, 1213,
+    1214, 1344, 1345, 1346, 1340, 1343, 1472, 1475, 1476, 1604, 1607, 1608,
+    1602, 1603, 1734, 1735, 1736, 1866, 1867, 1868, 1864, 1865, 1996, 1997,
+    1998, 2128, 2129, 2130, 2126, 2127, 2258, 2259, 2260, 2390, 2391, 2392,
+    2388, 2389, 2520, 2521, 2522, 2652, 2653, 2654, 2650, 2651, 3046, 3047,
+    3048, 3178, 3179, 3180, 3176, 3177, 3308, 3309, 3310, 3440, 3441, 3442,
+    3438, 3439, 3570, 3571, 3572, 3702, 3703, 3704, 3700, 3701, 3832, 3833,
+    3834, 3964, 3965, 3966, 3962, 3963, 4094, 4095, 4096, 4226, 4227, 4228,
+    4354, 4225, 4486, 4357, 4358, 4618, 4489, 4490, 5013, 5014, 5145, 5146,
+    5017, 5277, 5278, 5149, 4621, 4622, 4753, 4754, 4755, 4885, 4886, 4887,
+    4359, 4360, 4491, 4492, 4493, 4623, 4624, 4625, 4097, 4098, 4229, 4230,
+    4231, 4361, 4362, 4363, 3835, 3836, 3967, 3968, 3969, 4099, 4100, 4101,
+    3573, 3574, 3705, 3706, 3707, 3837, 3838, 3839, 3311, 3312, 3443, 3444,
+    3445, 3575, 3576, 3577, 3049, 3050, 3181, 3182, 3183, 3313, 3314, 3315,
+    2523, 2524, 2655, 2656, 2657, 3051, 3052, 3053, 2261, 2262, 2393, 2394,
+    2395, 2525, 2526, 2527, 1999, 2000, 2131, 2132, 2135, 2263, 2264, 2267,
+    1739, 1740, 1871, 1872, 1873, 2003, 2004, 2005, 1477, 1478, 1609, 1610,
+    1611, 1741, 1742, 1743, 1215, 1216, 1347, 1348, 1349, 1479, 1480, 1481,
+    953, 954, 1085, 1086, 1087, 1217, 1218, 1219, 691, 692, 823, 824,
+    825, 955, 956, 957, 429, 430, 561, 562, 563, 693, 694, 695,
+    167, 168, 299, 300, 301, 431, 432, 433, 17065, 17066, 17197, 17198,
+    17199, 169, 170, 171, 17200, 17201, 172, 173, 174, 304, 305, 306,
+    302, 303, 434, 435, 436, 566, 567, 568, 564, 565, 696, 697,
+    698, 828, 829, 830, 826, 827, 958, 959, 960, 1090, 1091, 1092,
+    1088, 1089, 1220, 1221, 1222, 1352, 1353, 1354, 1350, 1351, 1482, 1483,
+    1484, 1614, 1615, 1616, 1612, 1613, 1744, 1745, 1746, 1876, 1877, 1878,
+    1874, 1875, 2006, 2007, 2008, 2138, 2139, 2140, 2136, 2137, 2268, 2269,
+    2270, 2400, 2401, 2402, 2396, 2399, 2528, 2531, 2532, 2660, 2663, 2664,
+    2658, 2659, 3054, 3055, 3056, 3186, 3187, 3188, 3184, 3185, 3316, 3317,
+    3318, 3448, 3449, 3450, 3446, 3447, 3578, 3579, 3580, 3710, 3711, 3712,
+    3708, 3709, 3840, 3841, 3842, 3972, 3973, 3974, 3970, 3971, 4102, 4103,
+    4104, 4234, 4235, 4236, 4232, 4233, 4364, 4365, 4366, 4496, 4497, 4498,
+    4494, 4495, 4626, 4627, 4628, 4758, 4759, 4760, 4756, 4757, 4888, 4889,
+    4890, 5020, 5021, 5022, 5018, 5019, 5150, 5151, 5152, 5282, 5283, 5284,
+    5410, 5281, 5542, 5413, 5414, 5674, 5545, 5546, 6333, 6334, 6465, 6466,
+    6337, 6597, 6598, 6469, 5941, 5942, 6073, 6074, 6075, 6205, 6206, 6207,
+    5415, 5416, 5547, 5548, 5549, 5943, 5944, 5945, 5153, 5154, 5285, 5286,
+    5287, 5417, 5418, 5419, 4891, 4892, 5023, 5024, 5025, 5155, 5156, 5157,
+    4629, 4630, 4761, 4762, 4763, 4893, 4894, 4895, 4367, 4368, 4499, 4500,
+    4501, 4631, 4632, 4633, 4105, 4106, 4237, 4238, 4239, 4369, 4370, 4371,
+    3843, 3844, 3975, 3976, 3977, 4107, 4108, 4109, 3581, 3582, 3713, 3714,
+    3715, 3845, 3846, 3847, 3319, 3320, 3451, 3452, 3455, 3583, 3584, 3587,
+    3059, 3060, 3191, 3192, 3193, 3323, 3324, 3325, 2533, 2534, 2665, 2666,
+    2667, 3061, 3062, 3063, 2271, 2272, 2403, 2404, 2405, 2535, 2536, 2537,
+    2009, 2010, 2141, 2142, 2143, 2273, 2274, 2275, 1747, 1748, 1879, 1880,
+    1881, 2011, 2012, 2013, 1485, 1486, 1617, 1618, 1619, 1749, 1750, 1751,
+    1223, 1224, 1355, 1356, 1357, 1487, 1488, 1489, 961, 962, 1093, 1094,
+    1095, 1225, 1226, 1227, 699, 700, 831, 832, 833, 963, 964, 965,
+    437, 438, 569, 570, 573, 701, 702, 705, 177, 178, 309, 310,
+    311, 441, 442, 443, 17075, 17076, 17207, 17208, 17209, 179, 180, 181,
+    17210, 17211, 182, 183, 184, 314, 315, 316, 312, 313, 444, 445,
+    446, 576, 577, 578, 574, 575, 706, 707, 708, 838, 839, 840,
+    834, 837, 966, 969, 970, 1098, 1101, 1102, 1096, 1097, 1228, 1229,
+    1230, 1360, 1361, 1362, 1358, 1359, 1490, 1491, 1492, 1622, 1623, 1624,
+    1620, 1621, 1752, 1753, 1754, 1884, 1885, 1886, 1882, 1883, 2014, 2015,
+    2016, 2146, 2147, 2148, 2144, 2145, 2276, 2277, 2278, 2408, 2409, 2410,
+    2406, 2407, 2538, 2539, 2540, 2670, 2671, 2672, 2668, 2669, 3064, 3065,
+    3066, 3196, 3197, 3198, 3194, 3195, 3326, 3327, 3328, 3458, 3459, 3460,
+    3456, 3457, 3588, 3589, 3590, 3720, 3721, 3722, 3716, 3719, 3848, 3851,
+    3852, 3980, 3983, 3984, 3978, 3979, 4110, 4111, 4112, 4242, 4243, 4244,
+    4240, 4241, 4372, 4373, 4374, 4504, 4505, 4506, 4502, 4503, 4634, 4635,
+    4636, 4766, 4767, 4768, 4764, 4765, 4896, 4897, 4898, 5028, 5029, 5030,
+    5026, 5027, 5158, 5159, 5160, 5290, 5291, 5292, 5288, 5289, 5420, 5421,
+    5422, 5552, 5553, 5554, 5550, 5551, 5946, 5947, 5948, 6078, 6079, 6080,
+    6076, 6077, 6208, 6209, 6210, 6340, 6341, 6342, 6338, 6339, 6470, 6471,
+    6472, 6602, 6603, 6604, 6730, 6601, 6862, 6733, 6734, 6994, 6865, 6866,
+    7389, 7390, 7521, 7522, 7393, 7653, 7654, 7525, 6997, 6998, 7129, 7130,
+    7131, 7261, 7262, 7263, 6735, 6736, 6867, 6868, 6869, 6999, 7000, 7001,
+    6473, 6474, 6605, 6606, 6607, 6737, 6738, 6739, 6211, 6212, 6343, 6344,
+    6345, 6475, 6476, 6477, 5949, 5950, 6081, 6082, 6083, 6213, 6214, 6215,
+    5423, 5424, 5555, 5556, 5557, 5951, 5952, 5953, 5161, 5162, 5293, 5294,
+    5295, 5425, 5426, 5427, 4899, 4900, 5031, 5032, 5033, 5163, 5164, 5165,
+    4637, 4638, 4769, 4770, 4771, 4901, 4902, 4903, 4375, 4376, 4507, 4508,
+    4511, 4639, 4640, 4643, 4115, 4116, 4247, 4248, 4249, 4379, 4380, 4381,
+    3853, 3854, 3985, 3986, 3987, 4117, 4118, 4119, 3591, 3592, 3723, 3724,
+    3725, 3855, 3856, 3857, 3329, 3330, 3461, 3462, 3463, 3593, 3594, 3595,
+    3067, 3068, 3199, 3200, 3201, 3331, 3332, 3333, 2541, 2542, 2673, 2674,
+    2675, 3069, 3070, 3071, 2279, 2280, 2411, 2412, 2413, 2543, 2544, 2545,
+    2017, 2018, 2149, 2150, 2151, 2281, 2282, 2283, 1755, 1756, 1887, 1888,
+    1889, 2019, 2020, 2021, 1493, 1494, 1625, 1626, 1629, 1757, 1758, 1761,
+    1233, 1234, 1365, 1366, 1367, 1497, 1498, 1499, 971, 972, 1103, 1104,
+    1105, 1235, 1236, 1237, 709, 710, 841, 842, 843, 973, 974, 975,
+    447, 448, 579, 580, 581, 711, 712, 713, 185, 186, 317, 318,
+    319, 449, 450, 451, 17083, 17084, 17215, 17216, 17217, 187, 188, 189,
+    17218, 17219, 190, 191, 192, 322, 323, 324, 320, 321, 452, 453,
+    454, 584, 585, 586, 582, 583, 714, 715, 716, 846, 847, 848,
+    844, 845, 976, 977, 978, 1108, 1109, 1110, 1106, 1107, 1238, 1239,
+    1240, 1370, 1371, 1372, 1368, 1369, 1500, 1501, 1502, 1632, 1633, 1634,
+    1630, 1631, 1762, 1763, 1764, 1894, 1895, 1896, 1890, 1893, 2022, 2025,
+    2026, 2154, 2157, 2158, 2152, 2153, 2284, 2285, 2286, 2416, 2417, 2418,
+    2414, 2415, 2546, 2547, 2548, 2678, 2679, 2680, 2676, 2677, 3072, 3073,
+    3074, 3204, 3205, 3206, 3202, 3203, 3334, 3335, 3336, 3466, 3467, 3468,
+    3464, 3465, 3596, 3597, 3598, 3728, 3729, 3730, 3726, 3727, 3858, 3859,
+    3860, 3990, 3991, 3992, 3988, 3989, 4120, 4121, 4122, 4252, 4253, 4254,
+    4250, 4251, 4382, 4383, 4384, 4514, 4515, 4516, 4512, 4513, 4644, 4645,
+    4646, 4776, 4777, 4778, 4772, 4775, 4904, 4907, 4908, 5036, 5039, 5040,
+    5034, 5035, 5166, 5167, 5168, 5298, 5299, 5300, 5296, 5297, 5428, 5429,
+    5430, 5560, 5561, 5562, 5558, 5559, 5954, 5955, 5956, 6086, 6087, 6088,
+    6084, 6085, 6216, 6217, 6218, 6348, 6349, 6350, 6346, 6347, 6478, 6479,
+    6480, 6610, 6611, 6612, 6608, 6609, 6740, 6741, 6742, 6872, 6873, 6874,
+    6870, 6871, 7002, 7003, 7004, 7134, 7135, 7136, 7132, 7133, 7264, 7265,
+    7266, 7396, 7397, 7398, 7394, 7395, 7526, 7527, 7528, 7658, 7659, 7660,
+    7786, 7657, 7918, 7789, 7790, 8050, 7921, 7922, 8445, 8446, 8577, 8578,
+    8449, 8973, 8974, 8845, 8053, 8054, 8185, 8186, 8187, 8317, 8318, 8319,
+    7791, 7792, 7923, 7924, 7925, 8055, 8056, 8057, 7529, 7530, 7661, 7662,
+    7663, 7793, 7794, 7795, 7267, 7268, 7399, 7400, 7401, 7531, 7532, 7533,
+    7005, 7006, 7137, 7138, 7139, 7269, 7270, 7271, 6743, 6744, 6875, 6876,
+    6877, 7007, 7008, 7009, 6481, 6482, 6613, 6614, 6615, 6745, 6746, 6747,
+    6219, 6220, 6351, 6352, 6353, 6483, 6484, 6485, 5957, 5958, 6089, 6090,
+    6091, 6221, 6222, 6223, 5431, 5432, 5563, 5564, 5567, 5959, 5960, 5963,
+    5171, 5172, 5303, 5304, 5305, 5435, 5436, 5437, 4909, 4910, 5041, 5042,
+    5043, 5173, 5174, 5175, 4647, 4648, 4779, 4780, 4781, 4911, 4912, 4913,
+    4385, 4386, 4517, 4518, 4519, 4649, 4650, 4651, 4123, 4124, 4255, 4256,
+    4257, 4387, 4388, 4389, 3861, 3862, 3993, 3994, 3995, 4125, 4126, 4127,
+    3599, 3600, 3731, 3732, 3733, 3863, 3864, 3865, 3337, 3338, 3469, 3470,
+    3471, 3601, 3602, 3603, 3075, 3076, 3207, 3208, 3209, 3339, 3340, 3341,
+    2549, 2550, 2681, 2682, 2685, 3077, 3078, 3081, 2289, 2290, 2421, 2422,
+    2423, 2553, 2554, 2555, 2027, 2028, 2159, 2160, 2161, 2291, 2292, 2293,
+    1765, 1766, 1897, 1898, 1899, 2029, 2030, 2031, 1503, 1504, 1635, 1636,
+    1637, 1767, 1768, 1769, 1241, 1242, 1373, 1374, 1375, 1505, 1506, 1507,
+    979, 980, 1111, 1112, 1113, 1243, 1244, 1245, 717, 718, 849, 850,
+    851, 981, 982, 983, 455, 456, 587, 588, 589, 719, 720, 721,
+    193, 194, 325, 326, 327, 457, 458, 459, 17091, 17092, 17223, 17224,
+    17227, 195, 196, 199, 17228, 17229, 200, 201, 202, 332, 333, 334,
+    328, 331, 460, 463, 464, 592, 595, 596, 590, 591, 722, 723,
+    724, 854, 855, 856, 852, 853, 984, 985, 986, 1116, 1117, 1118,
+    1114, 1115, 1246, 1247, 1248, 1378, 1379, 1380, 1376, 1377, 1508, 1509,
+    1510, 1640, 1641, 1642, 1638, 1639, 1770, 1771, 1772, 1902, 1903, 1904,
+    1900, 1901, 2032, 2033, 2034, 2164, 2165, 2166, 2162, 2163, 2294, 2295,
+    2296, 2426, 2427, 2428, 2424, 2425, 2556, 2557, 2558, 2688, 2689, 2690,
+    2686, 2687, 3082, 3083, 3084, 3214, 3215, 3216, 3210, 3213, 3342, 3345,
+    3346, 3474, 3477, 3478, 3472, 3473, 3604, 3605, 3606, 3736, 3737, 3738,
+    3734, 3735, 3866, 3867, 3868, 3998, 3999, 4000, 3996, 3997, 4128, 4129,
+    4130, 4260, 4261, 4262, 4258, 4259, 4390, 4391, 4392, 4522, 4523, 4524,
+    4520, 4521, 4652, 4653, 4654, 4784, 4785, 4786, 4782, 4783, 4914, 4915,
+    4916, 5046, 5047, 5048, 5044, 5045, 5176, 5177, 5178, 5308, 5309, 5310,
+    5306, 5307, 5438, 5439, 5440, 5570, 5571, 5572, 5568, 5569, 5964, 5965,
+    5966, 6096, 6097, 6098, 6092, 6095, 6224, 6227, 6228, 6356, 6359, 6360,
+    6354, 6355, 6486, 6487, 6488, 6618, 6619, 6620, 6616, 6617, 6748, 6749,
+    6750, 6880, 6881, 6882, 6878, 6879, 7010, 7011, 7012, 7142, 7143, 7144,
+    7140, 7141, 7272, 7273, 7274, 7404, 7405, 7406, 7402, 7403, 7534, 7535,
+    7536, 7666, 7667, 7668, 7664, 7665, 7796, 7797, 7798, 7928, 7929, 7930,
+    7926, 7927, 8058, 8059, 8060, 8190, 8191, 8192, 8188, 8189, 8320, 8321,
+    8322, 8452, 8453, 8454, 8450, 8451, 8846, 8847, 8848, 8978, 8979, 8980,
+    9106, 8977, 9238, 9109, 9110, 9370, 9241, 9242, 9765, 9766, 9897, 9898,
+    9769, 10029, 10030, 9901, 9373, 9374, 9505, 9506, 9507, 9637, 9638, 9639,
+    9111, 9112, 9243, 9244, 9245, 9375, 9376, 9377, 8849, 8850, 8981, 8982,
+    8983, 9113, 9114, 9115, 8323, 8324, 8455, 8456, 8457, 8851, 8852, 8853,
+    8061, 8062, 8193, 8194, 8195, 8325, 8326, 8327, 7799, 7800, 7931, 7932,
+    7933, 8063, 8064, 8065, 7537, 7538, 7669, 7670, 7671, 7801, 7802, 7803,
+    7275, 7276, 7407, 7408, 7409, 7539, 7540, 7541, 7013, 7014, 7145, 7146,
+    7147, 7277, 7278, 7279, 6751, 6752, 6883, 6884, 6887, 7015, 7016, 7019,
+    6491, 6492, 6623, 6624, 6625, 6755, 6756, 6757, 6229, 6230, 6361, 6362,
+    6363, 6493, 6494, 6495, 5967, 5968, 6099, 6100, 6101, 6231, 6232, 6233,
+    5441, 5442, 5573, 5574, 5575, 5969, 5970, 5971, 5179, 5180, 5311, 5312,
+    5313, 5443, 5444, 5445, 4917, 4918, 5049, 5050, 5051, 5181, 5182, 5183,
+    4655, 4656, 4787, 4788, 4789, 4919, 4920, 4921, 4393, 4394, 4525, 4526,
+    4527, 4657, 4658, 4659, 4131, 4132, 4263, 4264, 4265, 4395, 4396, 4397,
+    3869, 3870, 4001, 4002, 4005, 4133, 4134, 4137, 3609, 3610, 3741, 3742,
+    3743, 3873, 3874, 3875, 3347, 3348, 3479, 3480, 3481, 3611, 3612, 3613,
+    3085, 3086, 3217, 3218, 3219, 3349, 3350, 3351, 2559, 2560, 2691, 2692,
+    2693, 3087, 3088, 3089, 2297, 2298, 2429, 2430, 2431, 2561, 2562, 2563,
+    2035, 2036, 2167, 2168, 2169, 2299, 2300, 2301, 1773, 1774, 1905, 1906,
+    1907, 2037, 2038, 2039, 1511, 1512, 1643, 1644, 1645, 1775, 1776, 1777,
+    1249, 1250, 1381, 1382, 1383, 1513, 1514, 1515, 987, 988, 1119, 1120,
+    1123, 1251, 1252, 1255, 727, 728, 859, 860, 861, 991, 992, 993,
+    465, 466, 597, 598, 599, 729, 730, 731, 203, 204, 335, 336,
+    337, 467, 468, 469, 17101, 17102, 17233, 17234, 17235, 205, 206, 207,
+    17236, 17237, 208, 209, 210, 340, 341, 342, 338, 339, 470, 471,
+    472, 602, 603, 604, 600, 601, 732, 733, 734, 864, 865, 866,
+    862, 863, 994, 995, 996, 1126, 1127, 1128, 1124, 1125, 1256, 1257,
+    1258, 1388, 1389, 1390, 1384, 1387, 1516, 1519, 1520, 1648, 1651, 1652,
+    1646, 1647, 1778, 1779, 1780, 1910, 1911, 1912, 1908, 1909, 2040, 2041,
+    2042, 2172, 2173, 2174, 2170, 2171, 2302, 2303, 2304, 2434, 2435, 2436,
+    2432, 2433, 2564, 2565, 2566, 2696, 2697, 2698, 2694, 2695, 3090, 3091,
+    3092, 3222, 3223, 3224, 3220, 3221, 3352, 3353, 3354, 3484, 3485, 3486,
+    3482, 3483, 3614, 3615, 3616, 3746, 3747, 3748, 3744, 3745, 3876, 3877,
+    3878, 4008, 4009, 4010, 4006, 4007, 4138, 4139, 4140, 4270, 4271, 4272,
+    4266, 4269, 4398, 4401, 4402, 4530, 4533, 4534, 4528, 4529, 4660, 4661,
+    4662, 4792, 4793, 4794, 4790, 4791, 4922, 4923, 4924, 5054, 5055, 5056,
+    5052, 5053, 5184, 5185, 5186, 5316, 5317, 5318, 5314, 5315, 5446, 5447,
+    5448, 5578, 5579, 5580, 5576, 5577, 5972, 5973, 5974, 6104, 6105, 6106,
+    6102, 6103, 6234, 6235, 6236, 6366, 6367, 6368, 6364, 6365, 6496, 6497,
+    6498, 6628, 6629, 6630, 6626, 6627, 6758, 6759, 6760, 6890, 6891, 6892,
+    6888, 6889, 7020, 7021, 7022, 7152, 7153, 7154, 7148, 7151, 7280, 7283,
+    7284, 7412, 7415, 7416, 7410, 7411, 7542, 7543, 7544, 7674, 7675, 7676,
+    7672, 7673, 7804, 7805, 7806, 7936, 7937, 7938, 7934, 7935, 8066, 8067,
+    8068, 8198, 8199, 8200, 8196, 8197, 8328, 8329, 8330, 8460, 8461, 8462,
+    8458, 8459, 8854, 8855, 8856, 8986, 8987, 8988, 8984, 8985, 9116, 9117,
+    9118, 9248, 9249, 9250, 9246, 9247, 9378, 9379, 9380, 9510, 9511, 9512,
+    9508, 9509, 9640, 9641, 9642, 9772, 9773, 9774, 9770, 9771, 9902, 9903,
+    9904, 10034, 10035, 10036, 10162, 10033, 10294, 10165, 10166, 10426, 10297, 10298,
+    10821, 10822, 10953, 10954, 10825, 11085, 11086, 10957, 10429, 10430, 10561, 10562,
+    10563, 10693, 10694, 10695, 10167, 10168, 10299, 10300, 10301, 10431, 10432, 10433,
+    9905, 9906, 10037, 10038, 10039, 10169, 10170, 10171, 9643, 9644, 9775, 9776,
+    9777, 9907, 9908, 9909, 9381, 9382, 9513, 9514, 9515, 9645, 9646, 9647,
+    9119, 9120, 9251, 9252, 9253, 9383, 9384, 9385, 8857, 8858, 8989, 8990,
+    8991, 9121, 9122, 9123, 8331, 8332, 8463, 8464, 8465, 8859, 8860, 8861,
+    8069, 8070, 8201, 8202, 8203, 8333, 8334, 8335, 7807, 7808, 7939, 7940,
+    7943, 8071, 8072, 8075, 7547, 7548, 7679, 7680, 7681, 7811, 7812, 7813,
+    7285, 7286, 7417, 7418, 7419, 7549, 7550, 7551, 7023, 7024, 7155, 7156,
+    7157, 7287, 7288, 7289, 6761, 6762, 6893, 6894, 6895, 7025, 7026, 7027,
+    6499, 6500, 6631, 6632, 6633, 6763, 6764, 6765, 6237, 6238, 6369, 6370,
+    6371, 6501, 6502, 6503, 5975, 5976, 6107, 6108, 6109, 6239, 6240, 6241,
+    5449, 5450, 5581, 5582, 5583, 5977, 5978, 5979, 5187, 5188, 5319, 5320,
+    5321, 5451, 5452, 5453, 4925, 4926, 5057, 5058, 5061, 5189, 5190, 5193,
+    4665, 4666, 4797, 4798, 4799, 4929, 4930, 4931, 4403, 4404, 4535, 4536,
+    4537, 4667, 4668, 4669, 4141, 4142, 4273, 4274, 4275, 4405, 4406, 4407,
+    3879, 3880, 4011, 4012, 4013, 4143, 4144, 4145, 3617, 3618, 3749, 3750,
+    3751, 3881, 3882, 3883, 3355, 3356, 3487, 3488, 3489, 3619, 3620, 3621,
+    3093, 3094, 3225, 3226, 3227, 3357, 3358, 3359, 2567, 2568, 2699, 2700,
+    2701, 3095, 3096, 3097, 2305, 2306, 2437, 2438, 2439, 2569, 2570, 2571,
+    2043, 2044, 2175, 2176, 2179, 2307, 2308, 2311, 1783, 1784, 1915, 1916,
+    1917, 2047, 2048, 2049, 1521, 1522, 1653, 1654, 1655, 1785, 1786, 1787,
+    1259, 1260, 1391, 1392, 1393, 1523, 1524, 1525, 997, 998, 1129, 1130,
+    1131, 1261, 1262, 1263, 735, 736, 867, 868, 869, 999, 1000, 1001,
+    473, 474, 605, 606, 607, 737, 738, 739, 211, 212, 343, 344,
+    345, 475, 476, 477, 17109, 17110, 17241, 17242, 17243, 213, 214, 215,
+    17244, 17245, 216, 217, 218, 348, 349, 350, 346, 347, 478, 479,
+    480, 610, 611, 612, 608, 609, 740, 741, 742, 872, 873, 874,
+    870, 871, 1002, 1003, 1004, 1134, 1135, 1136, 1132, 1133, 1264, 1265,
+    1266, 1396, 1397, 1398, 1394, 1395, 1526, 1527, 1528, 1658, 1659, 1660,
+    1656, 1657, 1788, 1789, 1790, 1920, 1921, 1922, 1918, 1919, 2050, 2051,
+    2052, 2182, 2183, 2184, 2180, 2181, 2312, 2313, 2314, 2444, 2445, 2446,
+    2440, 2443, 2572, 2575, 2576, 2704, 2707, 2708, 2702, 2703, 3098, 3099,
+    3100, 3230, 3231, 3232, 3228, 3229, 3360, 3361, 3362, 3492, 3493, 3494,
+    3490, 3491, 3622, 3623, 3624, 3754, 3755, 3756, 3752, 3753, 3884, 3885,
+    3886, 4016, 4017, 4018, 4014, 4015, 4146, 4147, 4148, 4278, 4279, 4280,
+    4276, 4277, 4408, 4409, 4410, 4540, 4541, 4542, 4538, 4539, 4670, 4671,
+    4672, 4802, 4803, 4804, 4800, 4801, 4932, 4933, 4934, 5064, 5065, 5066,
+    5062, 5063, 5194, 5195, 5196, 5326, 5327, 5328, 5322, 5325, 5454, 5457,
+    5458, 5586, 5589, 5590, 5584, 5585, 5980, 5981, 5982, 6112, 6113, 6114,
+    6110, 6111, 6242, 6243, 6244, 6374, 6375, 6376, 6372, 6373, 6504, 6505,
+    6506, 6636, 6637, 6638, 6634, 6635, 6766, 6767, 6768, 6898, 6899, 6900,
+    6896, 6897, 7028, 7029, 7030, 7160, 7161, 7162, 7158, 7159, 7290, 7291,
+    7292, 7422, 7423, 7424, 7420, 7421, 7552, 7553, 7554, 7684, 7685, 7686,
+    7682, 7683, 7814, 7815, 7816, 7946, 7947, 7948, 7944, 7945, 8076, 8077,
+    8078, 8208, 8209, 8210, 8204, 8207, 8336, 8339, 8340, 8468, 8471, 8472,
+    8466, 8467, 8862, 8863, 8864, 8994, 8995, 8996, 8992, 8993, 9124, 9125,
+    9126, 9256, 9257, 9258, 9254, 9255, 9386, 9387, 9388, 9518, 9519, 9520,
+    9516, 9517, 9648, 9649, 9650, 9780, 9781, 9782, 9778, 9779, 9910, 9911,
+    9912, 10042, 10043, 10044, 10040, 10041, 10172, 10173, 10174, 10304, 10305, 10306,
+    10302, 10303, 10434, 10435, 10436, 10566, 10567, 10568, 10564, 10565, 10696, 10697,
+    10698, 10828, 10829, 10830, 10826, 10827, 10958, 10959, 10960, 11090, 11091, 11092,
+    11218, 11089, 11350, 11221, 11222, 11482, 11353, 11354, 12141, 12142, 12273, 12274,
+    12145, 12405, 12406, 12277, 11749, 11750, 11881, 11882, 11883, 12013, 12014, 12015,
+    11223, 11224, 11355, 11356, 11357, 11751, 11752, 11753, 10961, 10962, 11093, 11094,
+    11095, 11225, 11226, 11227, 10699, 10700, 10831, 10832, 10833, 10963, 10964, 10965,
+    10437, 10438, 10569, 10570, 10571, 10701, 10702, 10703, 10175, 10176, 10307, 10308,
+    10309, 10439, 10440, 10441, 9913, 9914, 10045, 10046, 10047, 10177, 10178, 10179,
+    9651, 9652, 9783, 9784, 9785, 9915, 9916, 9917, 9389, 9390, 9521, 9522,
+    9523, 9653, 9654, 9655, 9127, 9128, 9259, 9260, 9263, 9391, 9392, 9395,
+    8867, 8868, 8999, 9000, 9001, 9131, 9132, 9133, 8341, 8342, 8473, 8474,
+    8475, 8869, 8870, 8871, 8079, 8080, 8211, 8212, 8213, 8343, 8344, 8345,
+    7817, 7818, 7949, 7950, 7951, 8081, 8082, 8083, 7555, 7556, 7687, 7688,
+    7689, 7819, 7820, 7821, 7293, 7294, 7425, 7426, 7427, 7557, 7558, 7559,
+    7031, 7032, 7163, 7164, 7165, 7295, 7296, 7297, 6769, 6770, 6901, 6902,
+    6903, 7033, 7034, 7035, 6507, 6508, 6639, 6640, 6641, 6771, 6772, 6773,
+    6245, 6246, 6377, 6378, 6381, 6509, 6510, 6513, 5985, 5986, 6117, 6118,
+    6119, 6249, 6250, 6251, 5459, 5460, 5591, 5592, 5593, 5987, 5988, 5989,
+    5197, 5198, 5329, 5330, 5331, 5461, 5462, 5463, 4935, 4936, 5067, 5068,
+    5069, 5199, 5200, 5201, 4673, 4674, 4805, 4806, 4807, 4937, 4938, 4939,
+    4411, 4412, 4543, 4544, 4545, 4675, 4676, 4677, 4149, 4150, 4281, 4282,
+    4283, 4413, 4414, 4415, 3887, 3888, 4019, 4020, 4021, 4151, 4152, 4153,
+    3625, 3626, 3757, 3758, 3759, 3889, 3890, 3891, 3363, 3364, 3495, 3496,
+    3499, 3627, 3628, 3631, 3103, 3104, 3235, 3236, 3237, 3367, 3368, 3369,
+    2577, 2578, 2709, 2710, 2711, 3105, 3106, 3107, 2315, 2316, 2447, 2448,
+    2449, 2579, 2580, 2581, 2053, 2054, 2185, 2186, 2187, 2317, 2318, 2319,
+    1791, 1792, 1923, 1924, 1925, 2055, 2056, 2057, 1529, 1530, 1661, 1662,
+    1663, 1793, 1794, 1795, 1267, 1268, 1399, 1400, 1401, 1531, 1532, 1533,
+    1005, 1006, 1137, 1138, 1139, 1269, 1270, 1271, 743, 744, 875, 876,
+    877, 1007, 1008, 1009, 481, 482, 613, 614, 617, 745, 746, 749,
+    221, 222, 353, 354, 355, 485, 486, 487, 17119, 17120, 17251, 17252,
+    17253, 223, 224, 225, 17254, 17255, 226, 227, 228, 358, 359, 360,
+    356, 357, 488, 489, 490, 620, 621, 622, 618, 619, 750, 751,
+    752, 882, 883, 884, 878, 881, 1010, 1013, 1014, 1142, 1145, 1146,
+    1140, 1141, 1272, 1273, 1274, 1404, 1405, 1406, 1402, 1403, 1534, 1535,
+    1536, 1666, 1667, 1668, 1664, 1665, 1796, 1797, 1798, 1928, 1929, 1930,
+    1926, 1927, 2058, 2059, 2060, 2190, 2191, 2192, 2188, 2189, 2320, 2321,
+    2322, 2452, 2453, 2454, 2450, 2451, 2582, 2583, 2584, 2714, 2715, 2716,
+    2712, 2713, 3108, 3109, 3110, 3240, 3241, 3242, 3238, 3239, 3370, 3371,
+    3372, 3502, 3503, 3504, 3500, 3501, 3632, 3633, 3634, 3764, 3765, 3766,
+    3760, 3763, 3892, 3895, 3896, 4024, 4027, 4028, 4022, 4023, 4154, 4155,
+    4156, 4286, 4287, 4288, 4284, 4285, 4416, 4417, 4418, 4548, 4549, 4550,
+    4546, 4547, 4678, 4679, 4680, 4810, 4811, 4812, 4808, 4809, 4940, 4941,
+    4942, 5072, 5073, 5074, 5070, 5071, 5202, 5203, 5204, 5334, 5335, 5336,
+    5332, 5333, 5464, 5465, 5466, 5596, 5597, 5598, 5594, 5595, 5990, 5991,
+    5992, 6122, 6123, 6124, 6120, 6121, 6252, 6253, 6254, 6384, 6385, 6386,
+    6382, 6383, 6514, 6515, 6516, 6646, 6647, 6648, 6642, 6645, 6774, 6777,
+    6778, 6906, 6909, 6910, 6904, 6905, 7036, 7037, 7038, 7168, 7169, 7170,
+    7166, 7167, 7298, 7299, 7300, 7430, 7431, 7432, 7428, 7429, 7560, 7561,
+    7562, 7692, 7693, 7694, 7690, 7691, 7822, 7823, 7824, 7954, 7955, 7956,
+    7952, 7953, 8084, 8085, 8086, 8216, 8217, 8218, 8214, 8215, 8346, 8347,
+    8348, 8478, 8479, 8480, 8476, 8477, 8872, 8873, 8874, 9004, 9005, 9006,
+    9002, 9003, 9134, 9135, 9136, 9266, 9267, 9268, 9264, 9265, 9396, 9397,
+    9398, 9528, 9529, 9530, 9524, 9527, 9656, 9659, 9660, 9788, 9791, 9792,
+    9786, 9787, 9918, 9919, 9920, 10050, 10051, 10052, 10048, 10049, 10180, 10181,
+    10182, 10312, 10313, 10314, 10310, 10311, 10442, 10443, 10444, 10574, 10575, 10576,
+    10572, 10573, 10704, 10705, 10706, 10836, 10837, 10838, 10834, 10835, 10966, 10967,
+    10968, 11098, 11099, 11100, 11096, 11097, 11228, 11229, 11230, 11360, 11361, 11362,
+    11358, 11359, 11754, 11755, 11756, 11886, 11887, 11888, 11884, 11885, 12016, 12017,
+    12018, 12148, 12149, 12150, 12146, 12147, 12278, 12279, 12280, 12410, 12411, 12412,
+    12538, 12409, 12670, 12541, 12542, 12802, 12673, 12674, 13197, 13198, 13329, 13330,
+    13201, 13461, 13462, 13333, 12805, 12806, 12937, 12938, 12939, 13069, 13070, 13071,
+    12543, 12544, 12675, 12676, 12677, 12807, 12808, 12809, 12281, 12282, 12413, 12414,
+    12415, 12545, 12546, 12547, 12019, 12020, 12151, 12152, 12153, 12283, 12284, 12285,
+    11757, 11758, 11889, 11890, 11891, 12021, 12022, 12023, 11231, 11232, 11363, 11364,
+    11365, 11759, 11760, 11761, 10969, 10970, 11101, 11102, 11103, 11233, 11234, 11235,
+    10707, 10708, 10839, 10840, 10841, 10971, 10972, 10973, 10445, 10446, 10577, 10578,
+    10579, 10709, 10710, 10711, 10183, 10184, 10315, 10316, 10319, 10447, 10448, 10451,
+    9923, 9924, 10055, 10056, 10057, 10187, 10188, 10189, 9661, 9662, 9793, 9794,
+    9795, 9925, 9926, 9927, 9399, 9400, 9531, 9532, 9533, 9663, 9664, 9665,
+    9137, 9138, 9269, 9270, 9271, 9401, 9402, 9403, 8875, 8876, 9007, 9008,
+    9009, 9139, 9140, 9141, 8349, 8350, 8481, 8482, 8483, 8877, 8878, 8879,
+    8087, 8088, 8219, 8220, 8221, 8351, 8352, 8353, 7825, 7826, 7957, 7958,
+    7959, 8089, 8090, 8091, 7563, 7564, 7695, 7696, 7697, 7827, 7828, 7829,
+    7301, 7302, 7433, 7434, 7437, 7565, 7566, 7569, 7041, 7042, 7173, 7174,
+    7175, 7305, 7306, 7307, 6779, 6780, 6911, 6912, 6913, 7043, 7044, 7045,
+    6517, 6518, 6649, 6650, 6651, 6781, 6782, 6783, 6255, 6256, 6387, 6388,
+    6389, 6519, 6520, 6521, 5993, 5994, 6125, 6126, 6127, 6257, 6258, 6259,
+    5467, 5468, 5599, 5600, 5601, 5995, 5996, 5997, 5205, 5206, 5337, 5338,
+    5339, 5469, 5470, 5471, 4943, 4944, 5075, 5076, 5077, 5207, 5208, 5209,
+    4681, 4682, 4813, 4814, 4815, 4945, 4946, 4947, 4419, 4420, 4551, 4552,
+    4555, 4683, 4684, 4687, 4159, 4160, 4291, 4292, 4293, 4423, 4424, 4425,
+    3897, 3898, 4029, 4030, 4031, 4161, 4162, 4163, 3635, 3636, 3767, 3768,
+    3769, 3899, 3900, 3901, 3373, 3374, 3505, 3506, 3507, 3637, 3638, 3639,
+    3111, 3112, 3243, 3244, 3245, 3375, 3376, 3377, 2585, 2586, 2717, 2718,
+    2719, 3113, 3114, 3115, 2323, 2324, 2455, 2456, 2457, 2587, 2588, 2589,
+    2061, 2062, 2193, 2194, 2195, 2325, 2326, 2327, 1799, 1800, 1931, 1932,
+    1933, 2063, 2064, 2065, 1537, 1538, 1669, 1670, 1673, 1801, 1802, 1805,
+    1277, 1278, 1409, 1410, 1411, 1541, 1542, 1543, 1015, 1016, 1147, 1148,
+    1149, 1279, 1280, 1281, 753, 754, 885, 886, 887, 1017, 1018, 1019,
+    491, 492, 623, 624, 625, 755, 756, 757, 229, 230, 361, 362,
+    363, 493, 494, 495, 17127, 17128, 17259, 17260, 17261, 231, 232, 233,
+    17262, 17263, 234, 235, 236, 366, 367, 368, 364, 365, 496, 497,
+    498, 628, 629, 630, 626, 627, 758, 759, 760, 890, 891, 892,
+    888, 889, 1020, 1021, 1022, 1152, 1153, 1154, 1150, 1151, 1282, 1283,
+    1284, 1414, 1415, 1416, 1412, 1413, 1544, 1545, 1546, 1676, 1677, 1678,
+    1674, 1675, 1806, 1807, 1808, 1938, 1939, 1940, 1934, 1937, 2066, 2069,
+    2070, 2198, 2201, 2202, 2196, 2197, 2328, 2329, 2330, 2460, 2461, 2462,
+    2458, 2459, 2590, 2591, 2592, 2722, 2723, 2724, 2720, 2721, 3116, 3117,
+    3118, 3248, 3249, 3250, 3246, 3247, 3378, 3379, 3380, 3510, 3511, 3512,
+    3508, 3509, 3640, 3641, 3642, 3772, 3773, 3774, 3770, 3771, 3902, 3903,
+    3904, 4034, 4035, 4036, 4032, 4033, 4164, 4165, 4166, 4296, 4297, 4298,
+    4294, 4295, 4426, 4427, 4428, 4558, 4559, 4560, 4556, 4557, 4688, 4689,
+    4690, 4820, 4821, 4822, 4816, 4819, 4948, 4951, 4952, 5080, 5083, 5084,
+    5078, 5079, 5210, 5211, 5212, 5342, 5343, 5344, 5340, 5341, 5472, 5473,
+    5474, 5604, 5605, 5606, 5602, 5603, 5998, 5999, 6000, 6130, 6131, 6132,
+    6128, 6129, 6260, 6261, 6262, 6392, 6393, 6394, 6390, 6391, 6522, 6523,
+    6524, 6654, 6655, 6656, 6652, 6653, 6784, 6785, 6786, 6916, 6917, 6918,
+    6914, 6915, 7046, 7047, 7048, 7178, 7179, 7180, 7176, 7177, 7308, 7309,
+    7310, 7440, 7441, 7442, 7438, 7439, 7570, 7571, 7572, 7702, 7703, 7704,
+    7698, 7701, 7830, 7833, 7834, 7962, 7965, 7966, 7960, 7961, 8092, 8093,
+    8094, 8224, 8225, 8226, 8222, 8223, 8354, 8355, 8356, 8486, 8487, 8488,
+    8484, 8485, 8880, 8881, 8882, 9012, 9013, 9014, 9010, 9011, 9142, 9143,
+    9144, 9274, 9275, 9276, 9272, 9273, 9404, 9405, 9406, 9536, 9537, 9538,
+    9534, 9535, 9666, 9667, 9668, 9798, 9799, 9800, 9796, 9797, 9928, 9929,
+    9930, 10060, 10061, 10062, 10058, 10059, 10190, 10191, 10192, 10322, 10323, 10324,
+    10320, 10321, 10452, 10453, 10454, 10584, 10585, 10586, 10580, 10583, 10712, 10715,
+    10716, 10844, 10847, 10848, 10842, 10843, 10974, 10975, 10976, 11106, 11107, 11108,
+    11104, 11105, 11236, 11237, 11238, 11368, 11369, 11370, 11366, 11367, 11762, 11763,
+    11764, 11894, 11895, 11896, 11892, 11893, 12024, 12025, 12026, 12156, 12157, 12158,
+    12154, 12155, 12286, 12287, 12288, 12418, 12419, 12420, 12416, 12417, 12548, 12549,
+    12550, 12680, 12681, 12682, 12678, 12679, 12810, 12811, 12812, 12942, 12943, 12944,
+    12940, 12941, 13072, 13073, 13074, 13204, 13205, 13206, 13202, 13203, 13334, 13335,
+    13336, 13466, 13467, 13468, 13594, 13465, 13726, 13597, 13598, 13858, 13729, 13730,
+    14253, 14254, 14385, 14386, 14257, 14781, 14782, 14653, 13861, 13862, 13993, 13994,
+    13995, 14125, 14126, 14127, 13599, 13600, 13731, 13732, 13733, 13863, 13864, 13865,
+    13337, 13338, 13469, 13470, 13471, 13601, 13602, 13603, 13075, 13076, 13207, 13208,
+    13209, 13339, 13340, 13341, 12813, 12814, 12945, 12946, 12947, 13077, 13078, 13079,
+    12551, 12552, 12683, 12684, 12685, 12815, 12816, 12817, 12289, 12290, 12421, 12422,
+    12423, 12553, 12554, 12555, 12027, 12028, 12159, 12160, 12161, 12291, 12292, 12293,
+    11765, 11766, 11897, 11898, 11899, 12029, 12030, 12031, 11239, 11240, 11371, 11372,
+    11375, 11767, 11768, 11771, 10979, 10980, 11111, 11112, 11113, 11243, 11244, 11245,
+    10717, 10718, 10849, 10850, 10851, 10981, 10982, 10983, 10455, 10456, 10587, 10588,
+    10589, 10719, 10720, 10721, 10193, 10194, 10325, 10326, 10327, 10457, 10458, 10459,
+    9931, 9932, 10063, 10064, 10065, 10195, 10196, 10197, 9669, 9670, 9801, 9802,
+    9803, 9933, 9934, 9935, 9407, 9408, 9539, 9540, 9541, 9671, 9672, 9673,
+    9145, 9146, 9277, 9278, 9279, 9409, 9410, 9411, 8883, 8884, 9015, 9016,
+    9017, 9147, 9148, 9149, 8357, 8358, 8489, 8490, 8493, 8885, 8886, 8889,
+    8097, 8098, 8229, 8230, 8231, 8361, 8362, 8363, 7835, 7836, 7967, 7968,
+    7969, 8099, 8100, 8101, 7573, 7574, 7705, 7706, 7707, 7837, 7838, 7839,
+    7311, 7312, 7443, 7444, 7445, 7575, 7576, 7577, 7049, 7050, 7181, 7182,
+    7183, 7313, 7314, 7315, 6787, 6788, 6919, 6920, 6921, 7051, 7052, 7053,
+    6525, 6526, 6657, 6658, 6659, 6789, 6790, 6791, 6263, 6264, 6395, 6396,
+    6397, 6527, 6528, 6529, 6001, 6002, 6133, 6134, 6135, 6265, 6266, 6267,
+    5475, 5476, 5607, 5608, 5611, 6003, 6004, 6007, 5215, 5216, 5347, 5348,
+    5349, 5479, 5480, 5481, 4953, 4954, 5085, 5086, 5087, 5217, 5218, 5219,
+    4691, 4692, 4823, 4824, 4825, 4955, 4956, 4957, 4429, 4430, 4561, 4562,
+    4563, 4693, 4694, 4695, 4167, 4168, 4299, 4300, 4301, 4431, 4432, 4433,
+    3905, 3906, 4037, 4038, 4039, 4169, 4170, 4171, 3643, 3644, 3775, 3776,
+    3777, 3907, 3908, 3909, 3381, 3382, 3513, 3514, 3515, 3645, 3646, 3647,
+    3119, 3120, 3251, 3252, 3253, 3383, 3384, 3385, 2593, 2594, 2725, 2726,
+    2729, 3121, 3122, 3125, 2333, 2334, 2465, 2466, 2467, 2597, 2598, 2599,
+    2071, 2072, 2203, 2204, 2205, 2335, 2336, 2337, 1809, 1810, 1941, 1942,
+    1943, 2073, 2074, 2075, 1547, 1548, 1679, 1680, 1681, 1811, 1812, 1813,
+    1285, 1286, 1417, 1418, 1419, 1549, 1550, 1551, 1023, 1024, 1155, 1156,
+    1157, 1287, 1288, 1289, 761, 762, 893, 894, 895, 1025, 1026, 1027,
+    499, 500, 631, 632, 633, 763, 764, 765, 237, 238, 369, 370,
+    371, 501, 502, 503, 17135, 17136, 17267, 17268, 17271, 239, 240, 243,
+    17272, 17273, 244, 245, 246, 376, 377, 378, 372, 375, 504, 507,
+    508, 636, 639, 640, 634, 635, 766, 767, 768, 898, 899, 900,
+    896, 897, 1028, 1029, 1030, 1160, 1161, 1162, 1158, 1159, 1290, 1291,
+    1292, 1422, 1423, 1424, 1420, 1421, 1552, 1553, 1554, 1684, 1685, 1686,
+    1682, 1683, 1814, 1815, 1816, 1946, 1947, 1948, 1944, 1945, 2076, 2077,
+    2078, 2208, 2209, 2210, 2206, 2207, 2338, 2339, 2340, 2470, 2471, 2472,
+    2468, 2469, 2600, 2601, 2602, 2732, 2733, 2734, 2730, 2731, 3126, 3127,
+    3128, 3258, 3259, 3260, 3254, 3257, 3386, 3389, 3390, 3518, 3521, 3522,
+    3516, 3517, 3648, 3649, 3650, 3780, 3781, 3782, 3778, 3779, 3910, 3911,
+    3912, 4042, 4043, 4044, 4040, 4041, 4172, 4173, 4174, 4304, 4305, 4306,
+    4302, 4303, 4434, 4435, 4436, 4566, 4567, 4568, 4564, 4565, 4696, 4697,
+    4698, 4828, 4829, 4830, 4826, 4827, 4958, 4959, 4960, 5090, 5091, 5092,
+    5088, 5089, 5220, 5221, 5222, 5352, 5353, 5354, 5350, 5351, 5482, 5483,
+    5484, 5614, 5615, 5616, 5612, 5613, 6008, 6009, 6010, 6140, 6141, 6142,
+    6136, 6139, 6268, 6271, 6272, 6400, 6403, 6404, 6398, 6399, 6530, 6531,
+    6532, 6662, 6663, 6664, 6660, 6661, 6792, 6793, 6794, 6924, 6925, 6926,
+    6922, 6923, 7054, 7055, 7056, 7186, 7187, 7188, 7184, 7185, 7316, 7317,
+    7318, 7448, 7449, 7450, 7446, 7447, 7578, 7579, 7580, 7710, 7711, 7712,
+    7708, 7709, 7840, 7841, 7842, 7972, 7973, 7974, 7970, 7971, 8102, 8103,
+    8104, 8234, 8235, 8236, 8232, 8233, 8364, 8365, 8366, 8496, 8497, 8498,
+    8494, 8495, 8890, 8891, 8892, 9022, 9023, 9024, 9018, 9021, 9150, 9153,
+    9154, 9282, 9285, 9286, 9280, 9281, 9412, 9413, 9414, 9544, 9545, 9546,
+    9542, 9543, 9674, 9675, 9676, 9806, 9807, 9808, 9804, 9805, 9936, 9937,
+    9938, 10068, 10069, 10070, 10066, 10067, 10198, 10199, 10200, 10330, 10331, 10332,
+    10328, 10329, 10460, 10461, 10462, 10592, 10593, 10594, 10590, 10591, 10722, 10723,
+    10724, 10854, 10855, 10856, 10852, 10853, 10984, 10985, 10986, 11116, 11117, 11118,
+    11114, 11115, 11246, 11247, 11248, 11378, 11379, 11380, 11376, 11377, 11772, 11773,
+    11774, 11904, 11905, 11906, 11900, 11903, 12032, 12035, 12036, 12164, 12167, 12168,
+    12162, 12163, 12294, 12295, 12296, 12426, 12427, 12428, 12424, 12425, 12556, 12557,
+    12558, 12688, 12689, 12690, 12686, 12687, 12818, 12819, 12820, 12950, 12951, 12952,
+    12948, 12949, 13080, 13081, 13082, 13212, 13213, 13214, 13210, 13211, 13342, 13343,
+    13344, 13474, 13475, 13476, 13472, 13473, 13604, 13605, 13606, 13736, 13737, 13738,
+    13734, 13735, 13866, 13867, 13868, 13998, 13999, 14000, 13996, 13997, 14128, 14129,
+    14130, 14260, 14261, 14262, 14258, 14259, 14654, 14655, 14656, 14786, 14787, 14788,
+    14914, 14785, 15046, 14917, 14918, 15178, 15049, 15050, 15573, 15574, 15705, 15706,
+    15577, 15837, 15838, 15709, 15181, 15182, 15313, 15314, 15315, 15445, 15446, 15447,
+    14919, 14920, 15051, 15052, 15053, 15183, 15184, 15185, 14657, 14658, 14789, 14790,
+    14791, 14921, 14922, 14923, 14131, 14132, 14263, 14264, 14265, 14659, 14660, 14661,
+    13869, 13870, 14001, 14002, 14003, 14133, 14134, 14135, 13607, 13608, 13739, 13740,
+    13741, 13871, 13872, 13873, 13345, 13346, 13477, 13478, 13479, 13609, 13610, 13611,
+    13083, 13084, 13215, 13216, 13217, 13347, 13348, 13349, 12821, 12822, 12953, 12954,
+    12955, 13085, 13086, 13087, 12559, 12560, 12691, 12692, 12695, 12823, 12824, 12827,
+    12299, 12300, 12431, 12432, 12433, 12563, 12564, 12565, 12037, 12038, 12169, 12170,
+    12171, 12301, 12302, 12303, 11775, 11776, 11907, 11908, 11909, 12039, 12040, 12041,
+    11249, 11250, 11381, 11382, 11383, 11777, 11778, 11779, 10987, 10988, 11119, 11120,
+    11121, 11251, 11252, 11253, 10725, 10726, 10857, 10858, 10859, 10989, 10990, 10991,
+    10463, 10464, 10595, 10596, 10597, 10727, 10728, 10729, 10201, 10202, 10333, 10334,
+    10335, 10465, 10466, 10467, 9939, 9940, 10071, 10072, 10073, 10203, 10204, 10205,
+    9677, 9678, 9809, 9810, 9813, 9941, 9942, 9945, 9417, 9418, 9549, 9550,
+    9551, 9681, 9682, 9683, 9155, 9156, 9287, 9288, 9289, 9419, 9420, 9421,
+    8893, 8894, 9025, 9026, 9027, 9157, 9158, 9159, 8367, 8368, 8499, 8500,
+    8501, 8895, 8896, 8897, 8105, 8106, 8237, 8238, 8239, 8369, 8370, 8371,
+    7843, 7844, 7975, 7976, 7977, 8107, 8108, 8109, 7581, 7582, 7713, 7714,
+    7715, 7845, 7846, 7847, 7319, 7320, 7451, 7452, 7453, 7583, 7584, 7585,
+    7057, 7058, 7189, 7190, 7191, 7321, 7322, 7323, 6795, 6796, 6927, 6928,
+    6931, 7059, 7060, 7063, 6535, 6536, 6667, 6668, 6669, 6799, 6800, 6801,
+    6273, 6274, 6405, 6406, 6407, 6537, 6538, 6539, 6011, 6012, 6143, 6144,
+    6145, 6275, 6276, 6277, 5485, 5486, 5617, 5618, 5619, 6013, 6014, 6015,
+    5223, 5224, 5355, 5356, 5357, 5487, 5488, 5489, 4961, 4962, 5093, 5094,
+    5095, 5225, 5226, 5227, 4699, 4700, 4831, 4832, 4833, 4963, 4964, 4965,
+    4437, 4438, 4569, 4570, 4571, 4701, 4702, 4703, 4175, 4176, 4307, 4308,
+    4309, 4439, 4440, 4441, 3913, 3914, 4045, 4046, 4049, 4177, 4178, 4181,
+    3653, 3654, 3785, 3786, 3787, 3917, 3918, 3919, 3391, 3392, 3523, 3524,
+    3525, 3655, 3656, 3657, 3129, 3130, 3261, 3262, 3263, 3393, 3394, 3395,
+    2603, 2604, 2735, 2736, 2737, 3131, 3132, 3133, 2341, 2342, 2473, 2474,
+    2475, 2605, 2606, 2607, 2079, 2080, 2211, 2212, 2213, 2343, 2344, 2345,
+    1817, 1818, 1949, 1950, 1951, 2081, 2082, 2083, 1555, 1556, 1687, 1688,
+    1689, 1819, 1820, 1821, 1293, 1294, 1425, 1426, 1427, 1557, 1558, 1559,
+    1031, 1032, 1163, 1164, 1167, 1295, 1296, 1299, 771, 772, 903, 904,
+    905, 1035, 1036, 1037, 509, 510, 641, 642, 643, 773, 774, 775,
+    247, 248, 379, 380, 381, 511, 512, 513, 17145, 17146, 17277, 17278,
+    17279, 249, 250, 251, 17280, 17281, 252, 253, 254, 384, 385, 386,
+    382, 383, 514, 515, 516, 646, 647, 648, 644, 645, 776, 777,
+    778, 908, 909, 910, 906, 907, 1038, 1039, 1040, 1170, 1171, 1172,
+    1168, 1169, 1300, 1301, 1302, 1432, 1433, 1434, 1428, 1431, 1560, 1563,
+    1564, 1692, 1695, 1696, 1690, 1691, 1822, 1823, 1824, 1954, 1955, 1956,
+    1952, 1953, 2084, 2085, 2086, 2216, 2217, 2218, 2214, 2215, 2346, 2347,
+    2348, 2478, 2479, 2480, 2476, 2477, 2608, 2609, 2610, 2740, 2741, 2742,
+    2738, 2739, 3134, 3135, 3136, 3266, 3267, 3268, 3264, 3265, 3396, 3397,
+    3398, 3528, 3529, 3530, 3526, 3527, 3658, 3659, 3660, 3790, 3791, 3792,
+    3788, 3789, 3920, 3921, 3922, 4052, 4053, 4054, 4050, 4051, 4182, 4183,
+    4184, 4314, 4315, 4316, 4310, 4313, 4442, 4445, 4446, 4574, 4577, 4578,
+    4572, 4573, 4704, 4705, 4706, 4836, 4837, 4838, 4834, 4835, 4966, 4967,
+    4968, 5098, 5099, 5100, 5096, 5097, 5228, 5229, 5230, 5360, 5361, 5362,
+    5358, 5359, 5490, 5491, 5492, 5622, 5623, 5624, 5620, 5621, 6016, 6017,
+    6018, 6148, 6149, 6150, 6146, 6147, 6278, 6279, 6280, 6410, 6411, 6412,
+    6408, 6409, 6540, 6541, 6542, 6672, 6673, 6674, 6670, 6671, 6802, 6803,
+    6804, 6934, 6935, 6936, 6932, 6933, 7064, 7065, 7066, 7196, 7197, 7198,
+    7192, 7195, 7324, 7327, 7328, 7456, 7459, 7460, 7454, 7455, 7586, 7587,
+    7588, 7718, 7719, 7720, 7716, 7717, 7848, 7849, 7850, 7980, 7981, 7982,
+    7978, 7979, 8110, 8111, 8112, 8242, 8243, 8244, 8240, 8241, 8372, 8373,
+    8374, 8504, 8505, 8506, 8502, 8503, 8898, 8899, 8900, 9030, 9031, 9032,
+    9028, 9029, 9160, 9161, 9162, 9292, 9293, 9294, 9290, 9291, 9422, 9423,
+    9424, 9554, 9555, 9556, 9552, 9553, 9684, 9685, 9686, 9816, 9817, 9818,
+    9814, 9815, 9946, 9947, 9948, 10078, 10079, 10080, 10074, 10077, 10206, 10209,
+    10210, 10338, 10341, 10342, 10336, 10337, 10468, 10469, 10470, 10600, 10601, 10602,
+    10598, 10599, 10730, 10731, 10732, 10862, 10863, 10864, 10860, 10861, 10992, 10993,
+    10994, 11124, 11125, 11126, 11122, 11123, 11254, 11255, 11256, 11386, 11387, 11388,
+    11384, 11385, 11780, 11781, 11782, 11912, 11913, 11914, 11910, 11911, 12042, 12043,
+    12044, 12174, 12175, 12176, 12172, 12173, 12304, 12305, 12306, 12436, 12437, 12438,
+    12434, 12435, 12566, 12567, 12568, 12698, 12699, 12700, 12696, 12697, 12828, 12829,
+    12830, 12960, 12961, 12962, 12956, 12959, 13088, 13091, 13092, 13220, 13223, 13224,
+    13218, 13219, 13350, 13351, 13352, 13482, 13483, 13484, 13480, 13481, 13612, 13613,
+    13614, 13744, 13745, 13746, 13742, 13743, 13874, 13875, 13876, 14006, 14007, 14008,
+    14004, 14005, 14136, 14137, 14138, 14268, 14269, 14270, 14266, 14267, 14662, 14663,
+    14664, 14794, 14795, 14796, 14792, 14793, 14924, 14925, 14926, 15056, 15057, 15058,
+    15054, 15055, 15186, 15187, 15188, 15318, 15319, 15320, 15316, 15317, 15448, 15449,
+    15450, 15580, 15581, 15582, 15578, 15579, 15710, 15711, 15712, 15842, 15843, 15844,
+    15970, 15841, 16102, 15973, 15974, 16234, 16105, 16106, 16629, 16630, 16761, 16762,
+    16633, 16893, 16894, 16765, 16237, 16238, 16369, 16370, 16371, 16501, 16502, 16503,
+    15975, 15976, 16107, 16108, 16109, 16239, 16240, 16241, 15713, 15714, 15845, 15846,
+    15847, 15977, 15978, 15979, 15451, 15452, 15583, 15584, 15585, 15715, 15716, 15717,
+    15189, 15190, 15321, 15322, 15323, 15453, 15454, 15455, 14927, 14928, 15059, 15060,
+    15061, 15191, 15192, 15193, 14665, 14666, 14797, 14798, 14799, 14929, 14930, 14931,
+    14139, 14140, 14271, 14272, 14273, 14667, 14668, 14669, 13877, 13878, 14009, 14010,
+    14011, 14141, 14142, 14143, 13615, 13616, 13747, 13748, 13751, 13879, 13880, 13883,
+    13355, 13356, 13487, 13488, 13489, 13619, 13620, 13621, 13093, 13094, 13225, 13226,
+    13227, 13357, 13358, 13359, 12831, 12832, 12963, 12964, 12965, 13095, 13096, 13097,
+    12569, 12570, 12701, 12702, 12703, 12833, 12834, 12835, 12307, 12308, 12439, 12440,
+    12441, 12571, 12572, 12573, 12045, 12046, 12177, 12178, 12179, 12309, 12310, 12311,
+    11783, 11784, 11915, 11916, 11917, 12047, 12048, 12049, 11257, 11258, 11389, 11390,
+    11391, 11785, 11786, 11787, 10995, 10996, 11127, 11128, 11129, 11259, 11260, 11261,
+    10733, 10734, 10865, 10866, 10869, 10997, 10998, 11001, 10473, 10474, 10605, 10606,
+    10607, 10737, 10738, 10739, 10211, 10212, 10343, 10344, 10345, 10475, 10476, 10477,
+    9949, 9950, 10081, 10082, 10083, 10213, 10214, 10215, 9687, 9688, 9819, 9820,
+    9821, 9951, 9952, 9953, 9425, 9426, 9557, 9558, 9559, 9689, 9690, 9691,
+    9163, 9164, 9295, 9296, 9297, 9427, 9428, 9429, 8901, 8902, 9033, 9034,
+    9035, 9165, 9166, 9167, 8375, 8376, 8507, 8508, 8509, 8903, 8904, 8905,
+    8113, 8114, 8245, 8246, 8247, 8377, 8378, 8379, 7851, 7852, 7983, 7984,
+    7987, 8115, 8116, 8119, 7591, 7592, 7723, 7724, 7725, 7855, 7856, 7857,
+    7329, 7330, 7461, 7462, 7463, 7593, 7594, 7595, 7067, 7068, 7199, 7200,
+    7201, 7331, 7332, 7333, 6805, 6806, 6937, 6938, 6939, 7069, 7070, 7071,
+    6543, 6544, 6675, 6676, 6677, 6807, 6808, 6809, 6281, 6282, 6413, 6414,
+    6415, 6545, 6546, 6547, 6019, 6020, 6151, 6152, 6153, 6283, 6284, 6285,
+    5493, 5494, 5625, 5626, 5627, 6021, 6022, 6023, 5231, 5232, 5363, 5364,
+    5365, 5495, 5496, 5497, 4969, 4970, 5101, 5102, 5105, 5233, 5234, 5237,
+    4709, 4710, 4841, 4842, 4843, 4973, 4974, 4975, 4447, 4448, 4579, 4580,
+    4581, 4711, 4712, 4713, 4185, 4186, 4317, 4318, 4319, 4449, 4450, 4451,
+    3923, 3924, 4055, 4056, 4057, 4187, 4188, 4189, 3661, 3662, 3793, 3794,
+    3795, 3925, 3926, 3927, 3399, 3400, 3531, 3532, 3533, 3663, 3664, 3665,
+    3137, 3138, 3269, 3270, 3271, 3401, 3402, 3403, 2611, 2612, 2743, 2744,
+    2745, 3139, 3140, 3141, 2349, 2350, 2481, 2482, 2483, 2613, 2614, 2615,
+    2087, 2088, 2219, 2220, 2223, 2351, 2352, 2355, 1827, 1828, 1959, 1960,
+    1961, 2091, 2092, 2093, 1565, 1566, 1697, 1698, 1699, 1829, 1830, 1831,
+    1303, 1304, 1435, 1436, 1437, 1567, 1568, 1569, 1041, 1042, 1173, 1174,
+    1175, 1305, 1306, 1307, 779, 780, 911, 912, 913, 1043, 1044, 1045,
+    517, 518, 649, 650, 651, 781, 782, 783, 255, 256, 387, 388,
+    389, 519, 520, 521, 17153, 17154, 17285, 17286, 17287, 257, 258, 259,
+    17288, 17289, 260, 261, 262, 392, 393, 394, 390, 391, 522, 523,
+    524, 654, 655, 656, 652, 653, 784, 785, 786, 916, 917, 918,
+    914, 915, 1046, 1047, 1048, 1178, 1179, 1180, 1176, 1177, 1308, 1309,
+    1310, 1440, 1441, 1442, 1438, 1439, 1570, 1571, 1572, 1702, 1703, 1704,
+    1700, 1701, 1832, 1833, 1834, 1964, 1965, 1966, 1962, 1963, 2094, 2095,
+    2096, 2226, 2227, 2228, 2224, 2225, 2356, 2357, 2358, 2488, 2489, 2490,
+    2484, 2487, 2616, 2619, 2620, 2748, 2751, 2752, 2746, 2747, 3142, 3143,
+    3144, 3274, 3275, 3276, 3272, 3273, 3404, 3405, 3406, 3536, 3537, 3538,
+    3534, 3535, 3666, 3667, 3668, 3798, 3799, 3800, 3796, 3797, 3928, 3929,
+    3930, 4060, 4061, 4062, 4058, 4059, 4190, 4191, 4192, 4322, 4323, 4324,
+    4320, 4321, 4452, 4453, 4454, 4584, 4585, 4586, 4582, 4583, 4714, 4715,
+    4716, 4846, 4847, 4848, 4844, 4845, 4976, 4977, 4978, 5108, 5109, 5110,
+    5106, 5107, 5238, 5239, 5240, 5370, 5371, 5372, 5366, 5369, 5498, 5501,
+    5502, 5630, 5633, 5634, 5628, 5629, 6024, 6025, 6026, 6156, 6157, 6158,
+    6154, 6155, 6286, 6287, 6288, 6418, 6419, 6420, 6416, 6417, 6548, 6549,
+    6550, 6680, 6681, 6682, 6678, 6679, 6810, 6811, 6812, 6942, 6943, 6944,
+    6940, 6941, 7072, 7073, 7074, 7204, 7205, 7206, 7202, 7203, 7334, 7335,
+    7336, 7466, 7467, 7468, 7464, 7465, 7596, 7597, 7598, 7728, 7729, 7730,
+    7726, 7727, 7858, 7859, 7860, 7990, 7991, 7992, 7988, 7989, 8120, 8121,
+    8122, 8252, 8253, 8254, 8248, 8251, 8380, 8383, 8384, 8512, 8515, 8516,
+    8510, 8511, 8906, 8907, 8908, 9038, 9039, 9040, 9036, 9037, 9168, 9169,
+    9170, 9300, 9301, 9302, 9298, 9299, 9430, 9431, 9432, 9562, 9563, 9564,
+    9560, 9561, 9692, 9693, 9694, 9824, 9825, 9826, 9822, 9823, 9954, 9955,
+    9956, 10086, 10087, 10088, 10084, 10085, 10216, 10217, 10218, 10348, 10349, 10350,
+    10346, 10347, 10478, 10479, 10480, 10610, 10611, 10612, 10608, 10609, 10740, 10741,
+    10742, 10872, 10873, 10874, 10870, 10871, 11002, 11003, 11004, 11134, 11135, 11136,
+    11130, 11133, 11262, 11265, 11266, 11394, 11397, 11398, 11392, 11393, 11788, 11789,
+    11790, 11920, 11921, 11922, 11918, 11919, 12050, 12051, 12052, 12182, 12183, 12184,
+    12180, 12181, 12312, 12313, 12314, 12444, 12445, 12446, 12442, 12443, 12574, 12575,
+    12576, 12706, 12707, 12708, 12704, 12705, 12836, 12837, 12838, 12968, 12969, 12970,
+    12966, 12967, 13098, 13099, 13100, 13230, 13231, 13232, 13228, 13229, 13360, 13361,
+    13362, 13492, 13493, 13494, 13490, 13491, 13622, 13623, 13624, 13754, 13755, 13756,
+    13752, 13753, 13884, 13885, 13886, 14016, 14017, 14018, 14012, 14015, 14144, 14147,
+    14148, 14276, 14279, 14280, 14274, 14275, 14670, 14671, 14672, 14802, 14803, 14804,
+    14800, 14801, 14932, 14933, 14934, 15064, 15065, 15066, 15062, 15063, 15194, 15195,
+    15196, 15326, 15327, 15328, 15324, 15325, 15456, 15457, 15458, 15588, 15589, 15590,
+    15586, 15587, 15718, 15719, 15720, 15850, 15851, 15852, 15848, 15849, 15980, 15981,
+    15982, 16112, 16113, 16114, 16110, 16111, 16242, 16243, 16244, 16374, 16375, 16376,
+    16372, 16373, 16504, 16505, 16506, 16636, 16637, 16638, 16634, 16635, 16766, 16767,
+    16768, 16898, 16899, 16900, 17026, 16897, 17158, 17029, 17030, 17290, 17161, 17162,
+    16769, 16770, 16901, 16902, 16903, 17033, 17034, 17035, 16507, 16508, 16639, 16640,
+    16641, 16771, 16772, 16773, 16245, 16246, 16377, 16378, 16379, 16509, 16510, 16511,
+    15983, 15984, 16115, 16116, 16117, 16247, 16248, 16249, 15721, 15722, 15853, 15854,
+    15855, 15985, 15986, 15987, 15459, 15460, 15591, 15592, 15593, 15723, 15724, 15725,
+    15197, 15198, 15329, 15330, 15331, 15461, 15462, 15463, 14935, 14936, 15067, 15068,
+    15071, 15199, 15200, 15203, 14675, 14676, 14807, 14808, 14809, 14939, 14940, 14941,
+    14149, 14150, 14281, 14282, 14283, 14677, 14678, 14679, 13887, 13888, 14019, 14020,
+    14021, 14151, 14152, 14153, 13625, 13626, 13757, 13758, 13759, 13889, 13890, 13891,
+    13363, 13364, 13495, 13496, 13497, 13627, 13628, 13629, 13101, 13102, 13233, 13234,
+    13235, 13365, 13366, 13367, 12839, 12840, 12971, 12972, 12973, 13103, 13104, 13105,
+    12577, 12578, 12709, 12710, 12711, 12841, 12842, 12843, 12315, 12316, 12447, 12448,
+    12449, 12579, 12580, 12581, 12053, 12054, 12185, 12186, 12189, 12317, 12318, 12321,
+    11793, 11794, 11925, 11926, 11927, 12057, 12058, 12059, 11267, 11268, 11399, 11400,
+    11401, 11795, 11796, 11797, 11005, 11006, 11137, 11138, 11139, 11269, 11270, 11271,
+    10743, 10744, 10875, 10876, 10877, 11007, 11008, 11009, 10481, 10482, 10613, 10614,
+    10615, 10745, 10746, 10747, 10219, 10220, 10351, 10352, 10353, 10483, 10484, 10485,
+    9957, 9958, 10089, 10090, 10091, 10221, 10222, 10223, 9695, 9696, 9827, 9828,
+    9829, 9959, 9960, 9961, 9433, 9434, 9565, 9566, 9567, 9697, 9698, 9699,
+    9171, 9172, 9303, 9304, 9307, 9435, 9436, 9439, 8911, 8912, 9043, 9044,
+    9045, 9175, 9176, 9177, 8385, 8386, 8517, 8518, 8519, 8913, 8914, 8915,
+    8123, 8124, 8255, 8256, 8257, 8387, 8388, 8389, 7861, 7862, 7993, 7994,
+    7995, 8125, 8126, 8127, 7599, 7600, 7731, 7732, 7733, 7863, 7864, 7865,
+    7337, 7338, 7469, 7470, 7471, 7601, 7602, 7603, 7075, 7076, 7207, 7208,
+    7209, 7339, 7340, 7341, 6813, 6814, 6945, 6946, 6947, 7077, 7078, 7079,
+    6551, 6552, 6683, 6684, 6685, 6815, 6816, 6817, 6289, 6290, 6421, 6422,
+    6425, 6553, 6554, 6557, 6029, 6030, 6161, 6162, 6163, 6293, 6294, 6295,
+    5503, 5504, 5635, 5636, 5637, 6031, 6032, 6033, 5241, 5242, 5373, 5374,
+    5375, 5505, 5506, 5507, 4979, 4980, 5111, 5112, 5113, 5243, 5244, 5245,
+    4717, 4718, 4849, 4850, 4851, 4981, 4982, 4983, 4455, 4456, 4587, 4588,
+    4589, 4719, 4720, 4721, 4193, 4194, 4325, 4326, 4327, 4457, 4458, 4459,
+    3931, 3932, 4063, 4064, 4065, 4195, 4196, 4197, 3669, 3670, 3801, 3802,
+    3803, 3933, 3934, 3935, 3407, 3408, 3539, 3540, 3543, 3671, 3672, 3675,
+    3147, 3148, 3279, 3280, 3281, 3411, 3412, 3413, 2621, 2622, 2753, 2754,
+    2755, 3149, 3150, 3151, 2359, 2360, 2491, 2492, 2493, 2623, 2624, 2625,
+    2097, 2098, 2229, 2230, 2231, 2361, 2362, 2363, 1835, 1836, 1967, 1968,
+    1969, 2099, 2100, 2101, 1573, 1574, 1705, 1706, 1707, 1837, 1838, 1839,
+    1311, 1312, 1443, 1444, 1445, 1575, 1576, 1577, 1049, 1050, 1181, 1182,
+    1183, 1313, 1314, 1315, 787, 788, 919, 920, 921, 1051, 1052, 1053,
+    1184, 1185, 1316, 1317, 1318, 1448, 1449, 1450, 1446, 1447, 1578, 1579,
+    1580, 1710, 1711, 1712, 1708, 1709, 1840, 1841, 1842, 1972, 1973, 1974,
+    1970, 1971, 2102, 2103, 2104, 2234, 2235, 2236, 2232, 2233, 2364, 2365,
+    2366, 2496, 2497, 2498, 2494, 2495, 2626, 2627, 2628, 2758, 2759, 2760,
+    2756, 2757, 3152, 3153, 3154, 3284, 3285, 3286, 3282, 3283, 3414, 3415,
+    3416, 3546, 3547, 3548, 3544, 3545, 3676, 3677, 3678, 3808, 3809, 3810,
+    3804, 3807, 3936, 3939, 3940, 4068, 4071, 4072, 4066, 4067, 4198, 4199,
+    4200, 4330, 4331, 4332, 4328, 4329, 4460, 4461, 4462, 4592, 4593, 4594,
+    4590, 4591, 4722, 4723, 4724, 4854, 4855, 4856, 4852, 4853, 4984, 4985,
+    4986, 5116, 5117, 5118, 5114, 5115, 5246, 5247, 5248, 5378, 5379, 5380,
+    5376, 5377, 5508, 5509, 5510, 5640, 5641, 5642, 5638, 5639, 6034, 6035,
+    6036, 6166, 6167, 6168, 6164, 6165, 6296, 6297, 6298, 6428, 6429, 6430,
+    6426, 6427, 6558, 6559, 6560, 6690, 6691, 6692, 6686, 6689, 6818, 6821,
+    6822, 6950, 6953, 6954, 6948, 6949, 7080, 7081, 7082, 7212, 7213, 7214,
+    7210, 7211, 7342, 7343, 7344, 7474, 7475, 7476, 7472, 7473, 7604, 7605,
+    7606, 7736, 7737, 7738, 7734, 7735, 7866, 7867, 7868, 7998, 7999, 8000,
+    7996, 7997, 8128, 8129, 8130, 8260, 8261, 8262, 8258, 8259, 8390, 8391,
+    8392, 8522, 8523, 8524, 8520, 8521, 8916, 8917, 8918, 9048, 9049, 9050,
+    9046, 9047, 9178, 9179, 9180, 9310, 9311, 9312, 9308, 9309, 9440, 9441,
+    9442, 9572, 9573, 9574, 9568, 9571, 9700, 9703, 9704, 9832, 9835, 9836,
+    9830, 9831, 9962, 9963, 9964, 10094, 10095, 10096, 10092, 10093, 10224, 10225,
+    10226, 10356, 10357, 10358, 10354, 10355, 10486, 10487, 10488, 10618, 10619, 10620,
+    10616, 10617, 10748, 10749, 10750, 10880, 10881, 10882, 10878, 10879, 11010, 11011,
+    11012, 11142, 11143, 11144, 11140, 11141, 11272, 11273, 11274, 11404, 11405, 11406,
+    11402, 11403, 11798, 11799, 11800, 11930, 11931, 11932, 11928, 11929, 12060, 12061,
+    12062, 12192, 12193, 12194, 12190, 12191, 12322, 12323, 12324, 12454, 12455, 12456,
+    12450, 12453, 12582, 12585, 12586, 12714, 12717, 12718, 12712, 12713, 12844, 12845,
+    12846, 12976, 12977, 12978, 12974, 12975, 13106, 13107, 13108, 13238, 13239, 13240,
+    13236, 13237, 13368, 13369, 13370, 13500, 13501, 13502, 13498, 13499, 13630, 13631,
+    13632, 13762, 13763, 13764, 13760, 13761, 13892, 13893, 13894, 14024, 14025, 14026,
+    14022, 14023, 14154, 14155, 14156, 14286, 14287, 14288, 14284, 14285, 14680, 14681,
+    14682, 14812, 14813, 14814, 14810, 14811, 14942, 14943, 14944, 15074, 15075, 15076,
+    15072, 15073, 15204, 15205, 15206, 15336, 15337, 15338, 15332, 15335, 15464, 15467,
+    15468, 15596, 15599, 15600, 15594, 15595, 15726, 15727, 15728, 15858, 15859, 15860,
+    15856, 15857, 15988, 15989, 15990, 16120, 16121, 16122, 16118, 16119, 16250, 16251,
+    16252, 16382, 16383, 16384, 16380, 16381, 16512, 16513, 16514, 16644, 16645, 16646,
+    16642, 16643, 16774, 16775, 16776, 16906, 16907, 16908, 16904, 16905, 17036, 17037,
+    17038, 17168, 17169, 17170, 16777, 16778, 16909, 16910, 16911, 17041, 17042, 17043,
+    16515, 16516, 16647, 16648, 16649, 16779, 16780, 16781, 16253, 16254, 16385, 16386,
+    16387, 16517, 16518, 16519, 15991, 15992, 16123, 16124, 16127, 16255, 16256, 16259,
+    15731, 15732, 15863, 15864, 15865, 15995, 15996, 15997, 15469, 15470, 15601, 15602,
+    15603, 15733, 15734, 15735, 15207, 15208, 15339, 15340, 15341, 15471, 15472, 15473,
+    14945, 14946, 15077, 15078, 15079, 15209, 15210, 15211, 14683, 14684, 14815, 14816,
+    14817, 14947, 14948, 14949, 14157, 14158, 14289, 14290, 14291, 14685, 14686, 14687,
+    13895, 13896, 14027, 14028, 14029, 14159, 14160, 14161, 13633, 13634, 13765, 13766,
+    13767, 13897, 13898, 13899, 13371, 13372, 13503, 13504, 13505, 13635, 13636, 13637,
+    13109, 13110, 13241, 13242, 13245, 13373, 13374, 13377, 12849, 12850, 12981, 12982,
+    12983, 13113, 13114, 13115, 12587, 12588, 12719, 12720, 12721, 12851, 12852, 12853,
+    12325, 12326, 12457, 12458, 12459, 12589, 12590, 12591, 12063, 12064, 12195, 12196,
+    12197, 12327, 12328, 12329, 11801, 11802, 11933, 11934, 11935, 12065, 12066, 12067,
+    11275, 11276, 11407, 11408, 11409, 11803, 11804, 11805, 11013, 11014, 11145, 11146,
+    11147, 11277, 11278, 11279, 10751, 10752, 10883, 10884, 10885, 11015, 11016, 11017,
+    10489, 10490, 10621, 10622, 10623, 10753, 10754, 10755, 10227, 10228, 10359, 10360,
+    10363, 10491, 10492, 10495, 9967, 9968, 10099, 10100, 10101, 10231, 10232, 10233,
+    9705, 9706, 9837, 9838, 9839, 9969, 9970, 9971, 9443, 9444, 9575, 9576,
+    9577, 9707, 9708, 9709, 9181, 9182, 9313, 9314, 9315, 9445, 9446, 9447,
+    8919, 8920, 9051, 9052, 9053, 9183, 9184, 9185, 8393, 8394, 8525, 8526,
+    8527, 8921, 8922, 8923, 8131, 8132, 8263, 8264, 8265, 8395, 8396, 8397,
+    7869, 7870, 8001, 8002, 8003, 8133, 8134, 8135, 7607, 7608, 7739, 7740,
+    7741, 7871, 7872, 7873, 7345, 7346, 7477, 7478, 7481, 7609, 7610, 7613,
+    7085, 7086, 7217, 7218, 7219, 7349, 7350, 7351, 6823, 6824, 6955, 6956,
+    6957, 7087, 7088, 7089, 6561, 6562, 6693, 6694, 6695, 6825, 6826, 6827,
+    6299, 6300, 6431, 6432, 6433, 6563, 6564, 6565, 6037, 6038, 6169, 6170,
+    6171, 6301, 6302, 6303, 5511, 5512, 5643, 5644, 5645, 6039, 6040, 6041,
+    5249, 5250, 5381, 5382, 5383, 5513, 5514, 5515, 4987, 4988, 5119, 5120,
+    5121, 5251, 5252, 5253, 4725, 4726, 4857, 4858, 4859, 4989, 4990, 4991,
+    4463, 4464, 4595, 4596, 4599, 4727, 4728, 4731, 4203, 4204, 4335, 4336,
+    4337, 4467, 4468, 4469, 3941, 3942, 4073, 4074, 4075, 4205, 4206, 4207,
+    3679, 3680, 3811, 3812, 3813, 3943, 3944, 3945, 3417, 3418, 3549, 3550,
+    3551, 3681, 3682, 3683, 3155, 3156, 3287, 3288, 3289, 3419, 3420, 3421,
+    2629, 2630, 2761, 2762, 2763, 3157, 3158, 3159, 2367, 2368, 2499, 2500,
+    2501, 2631, 2632, 2633, 2105, 2106, 2237, 2238, 2239, 2369, 2370, 2371,
+    1843, 1844, 1975, 1976, 1977, 2107, 2108, 2109, 2240, 2241, 2372, 2373,
+    2374, 2504, 2505, 2506, 2502, 2503, 2634, 2635, 2636, 2766, 2767, 2768,
+    2764, 2765, 3160, 3161, 3162, 3292, 3293, 3294, 3290, 3291, 3422, 3423,
+    3424, 3554, 3555, 3556, 3552, 3553, 3684, 3685, 3686, 3816, 3817, 3818,
+    3814, 3815, 3946, 3947, 3948, 4078, 4079, 4080, 4076, 4077, 4208, 4209,
+    4210, 4340, 4341, 4342, 4338, 4339, 4470, 4471, 4472, 4602, 4603, 4604,
+    4600, 4601, 4732, 4733, 4734, 4864, 4865, 4866, 4860, 4863, 4992, 4995,
+    4996, 5124, 5127, 5128, 5122, 5123, 5254, 5255, 5256, 5386, 5387, 5388,
+    5384, 5385, 5516, 5517, 5518, 5648, 5649, 5650, 5646, 5647, 6042, 6043,
+    6044, 6174, 6175, 6176, 6172, 6173, 6304, 6305, 6306, 6436, 6437, 6438,
+    6434, 6435, 6566, 6567, 6568, 6698, 6699, 6700, 6696, 6697, 6828, 6829,
+    6830, 6960, 6961, 6962, 6958, 6959, 7090, 7091, 7092, 7222, 7223, 7224,
+    7220, 7221, 7352, 7353, 7354, 7484, 7485, 7486, 7482, 7483, 7614, 7615,
+    7616, 7746, 7747, 7748, 7742, 7745, 7874, 7877, 7878, 8006, 8009, 8010,
+    8004, 8005, 8136, 8137, 8138, 8268, 8269, 8270, 8266, 8267, 8398, 8399,
+    8400, 8530, 8531, 8532, 8528, 8529, 8924, 8925, 8926, 9056, 9057, 9058,
+    9054, 9055, 9186, 9187, 9188, 9318, 9319, 9320, 9316, 9317, 9448, 9449,
+    9450, 9580, 9581, 9582, 9578, 9579, 9710, 9711, 9712, 9842, 9843, 9844,
+    9840, 9841, 9972, 9973, 9974, 10104, 10105, 10106, 10102, 10103, 10234, 10235,
+    10236, 10366, 10367, 10368, 10364, 10365, 10496, 10497, 10498, 10628, 10629, 10630,
+    10624, 10627, 10756, 10759, 10760, 10888, 10891, 10892, 10886, 10887, 11018, 11019,
+    11020, 11150, 11151, 11152, 11148, 11149, 11280, 11281, 11282, 11412, 11413, 11414,
+    11410, 11411, 11806, 11807, 11808, 11938, 11939, 11940, 11936, 11937, 12068, 12069,
+    12070, 12200, 12201, 12202, 12198, 12199, 12330, 12331, 12332, 12462, 12463, 12464,
+    12460, 12461, 12592, 12593, 12594, 12724, 12725, 12726, 12722, 12723, 12854, 12855,
+    12856, 12986, 12987, 12988, 12984, 12985, 13116, 13117, 13118, 13248, 13249, 13250,
+    13246, 13247, 13378, 13379, 13380, 13510, 13511, 13512, 13506, 13509, 13638, 13641,
+    13642, 13770, 13773, 13774, 13768, 13769, 13900, 13901, 13902, 14032, 14033, 14034,
+    14030, 14031, 14162, 14163, 14164, 14294, 14295, 14296, 14292, 14293, 14688, 14689,
+    14690, 14820, 14821, 14822, 14818, 14819, 14950, 14951, 14952, 15082, 15083, 15084,
+    15080, 15081, 15212, 15213, 15214, 15344, 15345, 15346, 15342, 15343, 15474, 15475,
+    15476, 15606, 15607, 15608, 15604, 15605, 15736, 15737, 15738, 15868, 15869, 15870,
+    15866, 15867, 15998, 15999, 16000, 16130, 16131, 16132, 16128, 16129, 16260, 16261,
+    16262, 16392, 16393, 16394, 16388, 16391, 16520, 16523, 16524, 16652, 16655, 16656,
+    16650, 16651, 16782, 16783, 16784, 16914, 16915, 16916, 16912, 16913, 17044, 17045,
+    17046, 17176, 17177, 17178, 16787, 16788, 16919, 16920, 16921, 17051, 17052, 17053,
+    16525, 16526, 16657, 16658, 16659, 16789, 16790, 16791, 16263, 16264, 16395, 16396,
+    16397, 16527, 16528, 16529, 16001, 16002, 16133, 16134, 16135, 16265, 16266, 16267,
+    15739, 15740, 15871, 15872, 15873, 16003, 16004, 16005, 15477, 15478, 15609, 15610,
+    15611, 15741, 15742, 15743, 15215, 15216, 15347, 15348, 15349, 15479, 15480, 15481,
+    14953, 14954, 15085, 15086, 15087, 15217, 15218, 15219, 14691, 14692, 14823, 14824,
+    14825, 14955, 14956, 14957, 14165, 14166, 14297, 14298, 14301, 14693, 14694, 14697,
+    13905, 13906, 14037, 14038, 14039, 14169, 14170, 14171, 13643, 13644, 13775, 13776,
+    13777, 13907, 13908, 13909, 13381, 13382, 13513, 13514, 13515, 13645, 13646, 13647,
+    13119, 13120, 13251, 13252, 13253, 13383, 13384, 13385, 12857, 12858, 12989, 12990,
+    12991, 13121, 13122, 13123, 12595, 12596, 12727, 12728, 12729, 12859, 12860, 12861,
+    12333, 12334, 12465, 12466, 12467, 12597, 12598, 12599, 12071, 12072, 12203, 12204,
+    12205, 12335, 12336, 12337, 11809, 11810, 11941, 11942, 11943, 12073, 12074, 12075,
+    11283, 11284, 11415, 11416, 11419, 11811, 11812, 11815, 11023, 11024, 11155, 11156,
+    11157, 11287, 11288, 11289, 10761, 10762, 10893, 10894, 10895, 11025, 11026, 11027,
+    10499, 10500, 10631, 10632, 10633, 10763, 10764, 10765, 10237, 10238, 10369, 10370,
+    10371, 10501, 10502, 10503, 9975, 9976, 10107, 10108, 10109, 10239, 10240, 10241,
+    9713, 9714, 9845, 9846, 9847, 9977, 9978, 9979, 9451, 9452, 9583, 9584,
+    9585, 9715, 9716, 9717, 9189, 9190, 9321, 9322, 9323, 9453, 9454, 9455,
+    8927, 8928, 9059, 9060, 9061, 9191, 9192, 9193, 8401, 8402, 8533, 8534,
+    8537, 8929, 8930, 8933, 8141, 8142, 8273, 8274, 8275, 8405, 8406, 8407,
+    7879, 7880, 8011, 8012, 8013, 8143, 8144, 8145, 7617, 7618, 7749, 7750,
+    7751, 7881, 7882, 7883, 7355, 7356, 7487, 7488, 7489, 7619, 7620, 7621,
+    7093, 7094, 7225, 7226, 7227, 7357, 7358, 7359, 6831, 6832, 6963, 6964,
+    6965, 7095, 7096, 7097, 6569, 6570, 6701, 6702, 6703, 6833, 6834, 6835,
+    6307, 6308, 6439, 6440, 6441, 6571, 6572, 6573, 6045, 6046, 6177, 6178,
+    6179, 6309, 6310, 6311, 5519, 5520, 5651, 5652, 5655, 6047, 6048, 6051,
+    5259, 5260, 5391, 5392, 5393, 5523, 5524, 5525, 4997, 4998, 5129, 5130,
+    5131, 5261, 5262, 5263, 4735, 4736, 4867, 4868, 4869, 4999, 5000, 5001,
+    4473, 4474, 4605, 4606, 4607, 4737, 4738, 4739, 4211, 4212, 4343, 4344,
+    4345, 4475, 4476, 4477, 3949, 3950, 4081, 4082, 4083, 4213, 4214, 4215,
+    3687, 3688, 3819, 3820, 3821, 3951, 3952, 3953, 3425, 3426, 3557, 3558,
+    3559, 3689, 3690, 3691, 3163, 3164, 3295, 3296, 3297, 3427, 3428, 3429,
+    3560, 3561, 3692, 3693, 3694, 3824, 3825, 3826, 3822, 3823, 3954, 3955,
+    3956, 4086, 4087, 4088, 4084, 4085, 4216, 4217, 4218, 4348, 4349, 4350,
+    4346, 4347, 4478, 4479, 4480, 4610, 4611, 4612, 4608, 4609, 4740, 4741,
+    4742, 4872, 4873, 4874, 4870, 4871, 5002, 5003, 5004, 5134, 5135, 5136,
+    5132, 5133, 5264, 5265, 5266, 5396, 5397, 5398, 5394, 5395, 5526, 5527,
+    5528, 5658, 5659, 5660, 5656, 5657, 6052, 6053, 6054, 6184, 6185, 6186,
+    6180, 6183, 6312, 6315, 6316, 6444, 6447, 6448, 6442, 6443, 6574, 6575,
+    6576, 6706, 6707, 6708, 6704, 6705, 6836, 6837, 6838, 6968, 6969, 6970,
+    6966, 6967, 7098, 7099, 7100, 7230, 7231, 7232, 7228, 7229, 7360, 7361,
+    7362, 7492, 7493, 7494, 7490, 7491, 7622, 7623, 7624, 7754, 7755, 7756,
+    7752, 7753, 7884, 7885, 7886, 8016, 8017, 8018, 8014, 8015, 8146, 8147,
+    8148, 8278, 8279, 8280, 8276, 8277, 8408, 8409, 8410, 8540, 8541, 8542,
+    8538, 8539, 8934, 8935, 8936, 9066, 9067, 9068, 9062, 9065, 9194, 9197,
+    9198, 9326, 9329, 9330, 9324, 9325, 9456, 9457, 9458, 9588, 9589, 9590,
+    9586, 9587, 9718, 9719, 9720, 9850, 9851, 9852, 9848, 9849, 9980, 9981,
+    9982, 10112, 10113, 10114, 10110, 10111, 10242, 10243, 10244, 10374, 10375, 10376,
+    10372, 10373, 10504, 10505, 10506, 10636, 10637, 10638, 10634, 10635, 10766, 10767,
+    10768, 10898, 10899, 10900, 10896, 10897, 11028, 11029, 11030, 11160, 11161, 11162,
+    11158, 11159, 11290, 11291, 11292, 11422, 11423, 11424, 11420, 11421, 11816, 11817,
+    11818, 11948, 11949, 11950, 11944, 11947, 12076, 12079, 12080, 12208, 12211, 12212,
+    12206, 12207, 12338, 12339, 12340, 12470, 12471, 12472, 12468, 12469, 12600, 12601,
+    12602, 12732, 12733, 12734, 12730, 12731, 12862, 12863, 12864, 12994, 12995, 12996,
+    12992, 12993, 13124, 13125, 13126, 13256, 13257, 13258, 13254, 13255, 13386, 13387,
+    13388, 13518, 13519, 13520, 13516, 13517, 13648, 13649, 13650, 13780, 13781, 13782,
+    13778, 13779, 13910, 13911, 13912, 14042, 14043, 14044, 14040, 14041, 14172, 14173,
+    14174, 14304, 14305, 14306, 14302, 14303, 14698, 14699, 14700, 14830, 14831, 14832,
+    14826, 14829, 14958, 14961, 14962, 15090, 15093, 15094, 15088, 15089, 15220, 15221,
+    15222, 15352, 15353, 15354, 15350, 15351, 15482, 15483, 15484, 15614, 15615, 15616,
+    15612, 15613, 15744, 15745, 15746, 15876, 15877, 15878, 15874, 15875, 16006, 16007,
+    16008, 16138, 16139, 16140, 16136, 16137, 16268, 16269, 16270, 16400, 16401, 16402,
+    16398, 16399, 16530, 16531, 16532, 16662, 16663, 16664, 16660, 16661, 16792, 16793,
+    16794, 16924, 16925, 16926, 16922, 16923, 17054, 17055, 17056, 17186, 17187, 17188,
+    16795, 16796, 16927, 16928, 16929, 17059, 17060, 17061, 16533, 16534, 16665, 16666,
+    16667, 16797, 16798, 16799, 16271, 16272, 16403, 16404, 16405, 16535, 16536, 16537,
+    16009, 16010, 16141, 16142, 16143, 16273, 16274, 16275, 15747, 15748, 15879, 15880,
+    15881, 16011, 16012, 16013, 15485, 15486, 15617, 15618, 15621, 15749, 15750, 15753,
+    15225, 15226, 15357, 15358, 15359, 15489, 15490, 15491, 14963, 14964, 15095, 15096,
+    15097, 15227, 15228, 15229, 14701, 14702, 14833, 14834, 14835, 14965, 14966, 14967,
+    14175, 14176, 14307, 14308, 14309, 14703, 14704, 14705, 13913, 13914, 14045, 14046,
+    14047, 14177, 14178, 14179, 13651, 13652, 13783, 13784, 13785, 13915, 13916, 13917,
+    13389, 13390, 13521, 13522, 13523, 13653, 13654, 13655, 13127, 13128, 13259, 13260,
+    13261, 13391, 13392, 13393, 12865, 12866, 12997, 12998, 12999, 13129, 13130, 13131,
+    12603, 12604, 12735, 12736, 12739, 12867, 12868, 12871, 12343, 12344, 12475, 12476,
+    12477, 12607, 12608, 12609, 12081, 12082, 12213, 12214, 12215, 12345, 12346, 12347,
+    11819, 11820, 11951, 11952, 11953, 12083, 12084, 12085, 11293, 11294, 11425, 11426,
+    11427, 11821, 11822, 11823, 11031, 11032, 11163, 11164, 11165, 11295, 11296, 11297,
+    10769, 10770, 10901, 10902, 10903, 11033, 11034, 11035, 10507, 10508, 10639, 10640,
+    10641, 10771, 10772, 10773, 10245, 10246, 10377, 10378, 10379, 10509, 10510, 10511,
+    9983, 9984, 10115, 10116, 10117, 10247, 10248, 10249, 9721, 9722, 9853, 9854,
+    9857, 9985, 9986, 9989, 9461, 9462, 9593, 9594, 9595, 9725, 9726, 9727,
+    9199, 9200, 9331, 9332, 9333, 9463, 9464, 9465, 8937, 8938, 9069, 9070,
+    9071, 9201, 9202, 9203, 8411, 8412, 8543, 8544, 8545, 8939, 8940, 8941,
+    8149, 8150, 8281, 8282, 8283, 8413, 8414, 8415, 7887, 7888, 8019, 8020,
+    8021, 8151, 8152, 8153, 7625, 7626, 7757, 7758, 7759, 7889, 7890, 7891,
+    7363, 7364, 7495, 7496, 7497, 7627, 7628, 7629, 7101, 7102, 7233, 7234,
+    7235, 7365, 7366, 7367, 6839, 6840, 6971, 6972, 6975, 7103, 7104, 7107,
+    6579, 6580, 6711, 6712, 6713, 6843, 6844, 6845, 6317, 6318, 6449, 6450,
+    6451, 6581, 6582, 6583, 6055, 6056, 6187, 6188, 6189, 6319, 6320, 6321,
+    5529, 5530, 5661, 5662, 5663, 6057, 6058, 6059, 5267, 5268, 5399, 5400,
+    5401, 5531, 5532, 5533, 5005, 5006, 5137, 5138, 5139, 5269, 5270, 5271,
+    4743, 4744, 4875, 4876, 4877, 5007, 5008, 5009, 4481, 4482, 4613, 4614,
+    4615, 4745, 4746, 4747, 4219, 4220, 4351, 4352, 4353, 4483, 4484, 4485,
+    4616, 4617, 4748, 4749, 4750, 4880, 4881, 4882, 4878, 4879, 5010, 5011,
+    5012, 5142, 5143, 5144, 5140, 5141, 5272, 5273, 5274, 5404, 5405, 5406,
+    5402, 5403, 5534, 5535, 5536, 5666, 5667, 5668, 5664, 5665, 6060, 6061,
+    6062, 6192, 6193, 6194, 6190, 6191, 6322, 6323, 6324, 6454, 6455, 6456,
+    6452, 6453, 6584, 6585, 6586, 6716, 6717, 6718, 6714, 6715, 6846, 6847,
+    6848, 6978, 6979, 6980, 6976, 6977, 7108, 7109, 7110, 7240, 7241, 7242,
+    7236, 7239, 7368, 7371, 7372, 7500, 7503, 7504, 7498, 7499, 7630, 7631,
+    7632, 7762, 7763, 7764, 7760, 7761, 7892, 7893, 7894, 8024, 8025, 8026,
+    8022, 8023, 8154, 8155, 8156, 8286, 8287, 8288, 8284, 8285, 8416, 8417,
+    8418, 8548, 8549, 8550, 8546, 8547, 8942, 8943, 8944, 9074, 9075, 9076,
+    9072, 9073, 9204, 9205, 9206, 9336, 9337, 9338, 9334, 9335, 9466, 9467,
+    9468, 9598, 9599, 9600, 9596, 9597, 9728, 9729, 9730, 9860, 9861, 9862,
+    9858, 9859, 9990, 9991, 9992, 10122, 10123, 10124, 10118, 10121, 10250, 10253,
+    10254, 10382, 10385, 10386, 10380, 10381, 10512, 10513, 10514, 10644, 10645, 10646,
+    10642, 10643, 10774, 10775, 10776, 10906, 10907, 10908, 10904, 10905, 11036, 11037,
+    11038, 11168, 11169, 11170, 11166, 11167, 11298, 11299, 11300, 11430, 11431, 11432,
+    11428, 11429, 11824, 11825, 11826, 11956, 11957, 11958, 11954, 11955, 12086, 12087,
+    12088, 12218, 12219, 12220, 12216, 12217, 12348, 12349, 12350, 12480, 12481, 12482,
+    12478, 12479, 12610, 12611, 12612, 12742, 12743, 12744, 12740, 12741, 12872, 12873,
+    12874, 13004, 13005, 13006, 13000, 13003, 13132, 13135, 13136, 13264, 13267, 13268,
+    13262, 13263, 13394, 13395, 13396, 13526, 13527, 13528, 13524, 13525, 13656, 13657,
+    13658, 13788, 13789, 13790, 13786, 13787, 13918, 13919, 13920, 14050, 14051, 14052,
+    14048, 14049, 14180, 14181, 14182, 14312, 14313, 14314, 14310, 14311, 14706, 14707,
+    14708, 14838, 14839, 14840, 14836, 14837, 14968, 14969, 14970, 15100, 15101, 15102,
+    15098, 15099, 15230, 15231, 15232, 15362, 15363, 15364, 15360, 15361, 15492, 15493,
+    15494, 15624, 15625, 15626, 15622, 15623, 15754, 15755, 15756, 15886, 15887, 15888,
+    15882, 15885, 16014, 16017, 16018, 16146, 16149, 16150, 16144, 16145, 16276, 16277,
+    16278, 16408, 16409, 16410, 16406, 16407, 16538, 16539, 16540, 16670, 16671, 16672,
+    16668, 16669, 16800, 16801, 16802, 16932, 16933, 16934, 16930, 16931, 17062, 17063,
+    17064, 17194, 17195, 17196, 16803, 16804, 16935, 16936, 16937, 17067, 17068, 17069,
+    16541, 16542, 16673, 16674, 16677, 16805, 16806, 16809, 16281, 16282, 16413, 16414,
+    16415, 16545, 16546, 16547, 16019, 16020, 16151, 16152, 16153, 16283, 16284, 16285,
+    15757, 15758, 15889, 15890, 15891, 16021, 16022, 16023, 15495, 15496, 15627, 15628,
+    15629, 15759, 15760, 15761, 15233, 15234, 15365, 15366, 15367, 15497, 15498, 15499,
+    14971, 14972, 15103, 15104, 15105, 15235, 15236, 15237, 14709, 14710, 14841, 14842,
+    14843, 14973, 14974, 14975, 14183, 14184, 14315, 14316, 14317, 14711, 14712, 14713,
+    13921, 13922, 14053, 14054, 14055, 14185, 14186, 14187, 13659, 13660, 13791, 13792,
+    13795, 13923, 13924, 13927, 13399, 13400, 13531, 13532, 13533, 13663, 13664, 13665,
+    13137, 13138, 13269, 13270, 13271, 13401, 13402, 13403, 12875, 12876, 13007, 13008,
+    13009, 13139, 13140, 13141, 12613, 12614, 12745, 12746, 12747, 12877, 12878, 12879,
+    12351, 12352, 12483, 12484, 12485, 12615, 12616, 12617, 12089, 12090, 12221, 12222,
+    12223, 12353, 12354, 12355, 11827, 11828, 11959, 11960, 11961, 12091, 12092, 12093,
+    11301, 11302, 11433, 11434, 11435, 11829, 11830, 11831, 11039, 11040, 11171, 11172,
+    11173, 11303, 11304, 11305, 10777, 10778, 10909, 10910, 10913, 11041, 11042, 11045,
+    10517, 10518, 10649, 10650, 10651, 10781, 10782, 10783, 10255, 10256, 10387, 10388,
+    10389, 10519, 10520, 10521, 9993, 9994, 10125, 10126, 10127, 10257, 10258, 10259,
+    9731, 9732, 9863, 9864, 9865, 9995, 9996, 9997, 9469, 9470, 9601, 9602,
+    9603, 9733, 9734, 9735, 9207, 9208, 9339, 9340, 9341, 9471, 9472, 9473,
+    8945, 8946, 9077, 9078, 9079, 9209, 9210, 9211, 8419, 8420, 8551, 8552,
+    8553, 8947, 8948, 8949, 8157, 8158, 8289, 8290, 8291, 8421, 8422, 8423,
+    7895, 7896, 8027, 8028, 8031, 8159, 8160, 8163, 7635, 7636, 7767, 7768,
+    7769, 7899, 7900, 7901, 7373, 7374, 7505, 7506, 7507, 7637, 7638, 7639,
+    7111, 7112, 7243, 7244, 7245, 7375, 7376, 7377, 6849, 6850, 6981, 6982,
+    6983, 7113, 7114, 7115, 6587, 6588, 6719, 6720, 6721, 6851, 6852, 6853,
+    6325, 6326, 6457, 6458, 6459, 6589, 6590, 6591, 6063, 6064, 6195, 6196,
+    6197, 6327, 6328, 6329, 5537, 5538, 5669, 5670, 5671, 6065, 6066, 6067,
+    5275, 5276, 5407, 5408, 5409, 5539, 5540, 5541, 5672, 5673, 6068, 6069,
+    6070, 6200, 6201, 6202, 6198, 6199, 6330, 6331, 6332, 6462, 6463, 6464,
+    6460, 6461, 6592, 6593, 6594, 6724, 6725, 6726, 6722, 6723, 6854, 6855,
+    6856, 6986, 6987, 6988, 6984, 6985, 7116, 7117, 7118, 7248, 7249, 7250,
+    7246, 7247, 7378, 7379, 7380, 7510, 7511, 7512, 7508, 7509, 7640, 7641,
+    7642, 7772, 7773, 7774, 7770, 7771, 7902, 7903, 7904, 8034, 8035, 8036,
+    8032, 8033, 8164, 8165, 8166, 8296, 8297, 8298, 8292, 8295, 8424, 8427,
+    8428, 8556, 8559, 8560, 8554, 8555, 8950, 8951, 8952, 9082, 9083, 9084,
+    9080, 9081, 9212, 9213, 9214, 9344, 9345, 9346, 9342, 9343, 9474, 9475,
+    9476, 9606, 9607, 9608, 9604, 9605, 9736, 9737, 9738, 9868, 9869, 9870,
+    9866, 9867, 9998, 9999, 10000, 10130, 10131, 10132, 10128, 10129, 10260, 10261,
+    10262, 10392, 10393, 10394, 10390, 10391, 10522, 10523, 10524, 10654, 10655, 10656,
+    10652, 10653, 10784, 10785, 10786, 10916, 10917, 10918, 10914, 10915, 11046, 11047,
+    11048, 11178, 11179, 11180, 11174, 11177, 11306, 11309, 11310, 11438, 11441, 11442,
+    11436, 11437, 11832, 11833, 11834, 11964, 11965, 11966, 11962, 11963, 12094, 12095,
+    12096, 12226, 12227, 12228, 12224, 12225, 12356, 12357, 12358, 12488, 12489, 12490,
+    12486, 12487, 12618, 12619, 12620, 12750, 12751, 12752, 12748, 12749, 12880, 12881,
+    12882, 13012, 13013, 13014, 13010, 13011, 13142, 13143, 13144, 13274, 13275, 13276,
+    13272, 13273, 13404, 13405, 13406, 13536, 13537, 13538, 13534, 13535, 13666, 13667,
+    13668, 13798, 13799, 13800, 13796, 13797, 13928, 13929, 13930, 14060, 14061, 14062,
+    14056, 14059, 14188, 14191, 14192, 14320, 14323, 14324, 14318, 14319, 14714, 14715,
+    14716, 14846, 14847, 14848, 14844, 14845, 14976, 14977, 14978, 15108, 15109, 15110,
+    15106, 15107, 15238, 15239, 15240, 15370, 15371, 15372, 15368, 15369, 15500, 15501,
+    15502, 15632, 15633, 15634, 15630, 15631, 15762, 15763, 15764, 15894, 15895, 15896,
+    15892, 15893, 16024, 16025, 16026, 16156, 16157, 16158, 16154, 16155, 16286, 16287,
+    16288, 16418, 16419, 16420, 16416, 16417, 16548, 16549, 16550, 16680, 16681, 16682,
+    16678, 16679, 16810, 16811, 16812, 16942, 16943, 16944, 16938, 16941, 17070, 17073,
+    17074, 17202, 17205, 17206, 16813, 16814, 16945, 16946, 16947, 17077, 17078, 17079,
+    16551, 16552, 16683, 16684, 16685, 16815, 16816, 16817, 16289, 16290, 16421, 16422,
+    16423, 16553, 16554, 16555, 16027, 16028, 16159, 16160, 16161, 16291, 16292, 16293,
+    15765, 15766, 15897, 15898, 15899, 16029, 16030, 16031, 15503, 15504, 15635, 15636,
+    15637, 15767, 15768, 15769, 15241, 15242, 15373, 15374, 15375, 15505, 15506, 15507,
+    14979, 14980, 15111, 15112, 15115, 15243, 15244, 15247, 14719, 14720, 14851, 14852,
+    14853, 14983, 14984, 14985, 14193, 14194, 14325, 14326, 14327, 14721, 14722, 14723,
+    13931, 13932, 14063, 14064, 14065, 14195, 14196, 14197, 13669, 13670, 13801, 13802,
+    13803, 13933, 13934, 13935, 13407, 13408, 13539, 13540, 13541, 13671, 13672, 13673,
+    13145, 13146, 13277, 13278, 13279, 13409, 13410, 13411, 12883, 12884, 13015, 13016,
+    13017, 13147, 13148, 13149, 12621, 12622, 12753, 12754, 12755, 12885, 12886, 12887,
+    12359, 12360, 12491, 12492, 12493, 12623, 12624, 12625, 12097, 12098, 12229, 12230,
+    12233, 12361, 12362, 12365, 11837, 11838, 11969, 11970, 11971, 12101, 12102, 12103,
+    11311, 11312, 11443, 11444, 11445, 11839, 11840, 11841, 11049, 11050, 11181, 11182,
+    11183, 11313, 11314, 11315, 10787, 10788, 10919, 10920, 10921, 11051, 11052, 11053,
+    10525, 10526, 10657, 10658, 10659, 10789, 10790, 10791, 10263, 10264, 10395, 10396,
+    10397, 10527, 10528, 10529, 10001, 10002, 10133, 10134, 10135, 10265, 10266, 10267,
+    9739, 9740, 9871, 9872, 9873, 10003, 10004, 10005, 9477, 9478, 9609, 9610,
+    9611, 9741, 9742, 9743, 9215, 9216, 9347, 9348, 9351, 9479, 9480, 9483,
+    8955, 8956, 9087, 9088, 9089, 9219, 9220, 9221, 8429, 8430, 8561, 8562,
+    8563, 8957, 8958, 8959, 8167, 8168, 8299, 8300, 8301, 8431, 8432, 8433,
+    7905, 7906, 8037, 8038, 8039, 8169, 8170, 8171, 7643, 7644, 7775, 7776,
+    7777, 7907, 7908, 7909, 7381, 7382, 7513, 7514, 7515, 7645, 7646, 7647,
+    7119, 7120, 7251, 7252, 7253, 7383, 7384, 7385, 6857, 6858, 6989, 6990,
+    6991, 7121, 7122, 7123, 6595, 6596, 6727, 6728, 6729, 6859, 6860, 6861,
+    6992, 6993, 7124, 7125, 7126, 7256, 7257, 7258, 7254, 7255, 7386, 7387,
+    7388, 7518, 7519, 7520, 7516, 7517, 7648, 7649, 7650, 7780, 7781, 7782,
+    7778, 7779, 7910, 7911, 7912, 8042, 8043, 8044, 8040, 8041, 8172, 8173,
+    8174, 8304, 8305, 8306, 8302, 8303, 8434, 8435, 8436, 8566, 8567, 8568,
+    8564, 8565, 8960, 8961, 8962, 9092, 9093, 9094, 9090, 9091, 9222, 9223,
+    9224, 9354, 9355, 9356, 9352, 9353, 9484, 9485, 9486, 9616, 9617, 9618,
+    9612, 9615, 9744, 9747, 9748, 9876, 9879, 9880, 9874, 9875, 10006, 10007,
+    10008, 10138, 10139, 10140, 10136, 10137, 10268, 10269, 10270, 10400, 10401, 10402,
+    10398, 10399, 10530, 10531, 10532, 10662, 10663, 10664, 10660, 10661, 10792, 10793,
+    10794, 10924, 10925, 10926, 10922, 10923, 11054, 11055, 11056, 11186, 11187, 11188,
+    11184, 11185, 11316, 11317, 11318, 11448, 11449, 11450, 11446, 11447, 11842, 11843,
+    11844, 11974, 11975, 11976, 11972, 11973, 12104, 12105, 12106, 12236, 12237, 12238,
+    12234, 12235, 12366, 12367, 12368, 12498, 12499, 12500, 12494, 12497, 12626, 12629,
+    12630, 12758, 12761, 12762, 12756, 12757, 12888, 12889, 12890, 13020, 13021, 13022,
+    13018, 13019, 13150, 13151, 13152, 13282, 13283, 13284, 13280, 13281, 13412, 13413,
+    13414, 13544, 13545, 13546, 13542, 13543, 13674, 13675, 13676, 13806, 13807, 13808,
+    13804, 13805, 13936, 13937, 13938, 14068, 14069, 14070, 14066, 14067, 14198, 14199,
+    14200, 14330, 14331, 14332, 14328, 14329, 14724, 14725, 14726, 14856, 14857, 14858,
+    14854, 14855, 14986, 14987, 14988, 15118, 15119, 15120, 15116, 15117, 15248, 15249,
+    15250, 15380, 15381, 15382, 15376, 15379, 15508, 15511, 15512, 15640, 15643, 15644,
+    15638, 15639, 15770, 15771, 15772, 15902, 15903, 15904, 15900, 15901, 16032, 16033,
+    16034, 16164, 16165, 16166, 16162, 16163, 16294, 16295, 16296, 16426, 16427, 16428,
+    16424, 16425, 16556, 16557, 16558, 16688, 16689, 16690, 16686, 16687, 16818, 16819,
+    16820, 16950, 16951, 16952, 16948, 16949, 17080, 17081, 17082, 17212, 17213, 17214,
+    16821, 16822, 16953, 16954, 16955, 17085, 17086, 17087, 16559, 16560, 16691, 16692,
+    16693, 16823, 16824, 16825, 16297, 16298, 16429, 16430, 16431, 16561, 16562, 16563,
+    16035, 16036, 16167, 16168, 16171, 16299, 16300, 16303, 15775, 15776, 15907, 15908,
+    15909, 16039, 16040, 16041, 15513, 15514, 15645, 15646, 15647, 15777, 15778, 15779,
+    15251, 15252, 15383, 15384, 15385, 15515, 15516, 15517, 14989, 14990, 15121, 15122,
+    15123, 15253, 15254, 15255, 14727, 14728, 14859, 14860, 14861, 14991, 14992, 14993,
+    14201, 14202, 14333, 14334, 14335, 14729, 14730, 14731, 13939, 13940, 14071, 14072,
+    14073, 14203, 14204, 14205, 13677, 13678, 13809, 13810, 13811, 13941, 13942, 13943,
+    13415, 13416, 13547, 13548, 13549, 13679, 13680, 13681, 13153, 13154, 13285, 13286,
+    13289, 13417, 13418, 13421, 12893, 12894, 13025, 13026, 13027, 13157, 13158, 13159,
+    12631, 12632, 12763, 12764, 12765, 12895, 12896, 12897, 12369, 12370, 12501, 12502,
+    12503, 12633, 12634, 12635, 12107, 12108, 12239, 12240, 12241, 12371, 12372, 12373,
+    11845, 11846, 11977, 11978, 11979, 12109, 12110, 12111, 11319, 11320, 11451, 11452,
+    11453, 11847, 11848, 11849, 11057, 11058, 11189, 11190, 11191, 11321, 11322, 11323,
+    10795, 10796, 10927, 10928, 10929, 11059, 11060, 11061, 10533, 10534, 10665, 10666,
+    10667, 10797, 10798, 10799, 10271, 10272, 10403, 10404, 10407, 10535, 10536, 10539,
+    10011, 10012, 10143, 10144, 10145, 10275, 10276, 10277, 9749, 9750, 9881, 9882,
+    9883, 10013, 10014, 10015, 9487, 9488, 9619, 9620, 9621, 9751, 9752, 9753,
+    9225, 9226, 9357, 9358, 9359, 9489, 9490, 9491, 8963, 8964, 9095, 9096,
+    9097, 9227, 9228, 9229, 8437, 8438, 8569, 8570, 8571, 8965, 8966, 8967,
+    8175, 8176, 8307, 8308, 8309, 8439, 8440, 8441, 7913, 7914, 8045, 8046,
+    8047, 8177, 8178, 8179, 7651, 7652, 7783, 7784, 7785, 7915, 7916, 7917,
+    8048, 8049, 8180, 8181, 8182, 8312, 8313, 8314, 8310, 8311, 8442, 8443,
+    8444, 8574, 8575, 8576, 8572, 8573, 8968, 8969, 8970, 9100, 9101, 9102,
+    9098, 9099, 9230, 9231, 9232, 9362, 9363, 9364, 9360, 9361, 9492, 9493,
+    9494, 9624, 9625, 9626, 9622, 9623, 9754, 9755, 9756, 9886, 9887, 9888,
+    9884, 9885, 10016, 10017, 10018, 10148, 10149, 10150, 10146, 10147, 10278, 10279,
+    10280, 10410, 10411, 10412, 10408, 10409, 10540, 10541, 10542, 10672, 10673, 10674,
+    10668, 10671, 10800, 10803, 10804, 10932, 10935, 10936, 10930, 10931, 11062, 11063,
+    11064, 11194, 11195, 11196, 11192, 11193, 11324, 11325, 11326, 11456, 11457, 11458,
+    11454, 11455, 11850, 11851, 11852, 11982, 11983, 11984, 11980, 11981, 12112, 12113,
+    12114, 12244, 12245, 12246, 12242, 12243, 12374, 12375, 12376, 12506, 12507, 12508,
+    12504, 12505, 12636, 12637, 12638, 12768, 12769, 12770, 12766, 12767, 12898, 12899,
+    12900, 13030, 13031, 13032, 13028, 13029, 13160, 13161, 13162, 13292, 13293, 13294,
+    13290, 13291, 13422, 13423, 13424, 13554, 13555, 13556, 13550, 13553, 13682, 13685,
+    13686, 13814, 13817, 13818, 13812, 13813, 13944, 13945, 13946, 14076, 14077, 14078,
+    14074, 14075, 14206, 14207, 14208, 14338, 14339, 14340, 14336, 14337, 14732, 14733,
+    14734, 14864, 14865, 14866, 14862, 14863, 14994, 14995, 14996, 15126, 15127, 15128,
+    15124, 15125, 15256, 15257, 15258, 15388, 15389, 15390, 15386, 15387, 15518, 15519,
+    15520, 15650, 15651, 15652, 15648, 15649, 15780, 15781, 15782, 15912, 15913, 15914,
+    15910, 15911, 16042, 16043, 16044, 16174, 16175, 16176, 16172, 16173, 16304, 16305,
+    16306, 16436, 16437, 16438, 16432, 16435, 16564, 16567, 16568, 16696, 16699, 16700,
+    16694, 16695, 16826, 16827, 16828, 16958, 16959, 16960, 16956, 16957, 17088, 17089,
+    17090, 17220, 17221, 17222, 16831, 16832, 16963, 16964, 16965, 17095, 17096, 17097,
+    16569, 16570, 16701, 16702, 16703, 16833, 16834, 16835, 16307, 16308, 16439, 16440,
+    16441, 16571, 16572, 16573, 16045, 16046, 16177, 16178, 16179, 16309, 16310, 16311,
+    15783, 15784, 15915, 15916, 15917, 16047, 16048, 16049, 15521, 15522, 15653, 15654,
+    15655, 15785, 15786, 15787, 15259, 15260, 15391, 15392, 15393, 15523, 15524, 15525,
+    14997, 14998, 15129, 15130, 15131, 15261, 15262, 15263, 14735, 14736, 14867, 14868,
+    14869, 14999, 15000, 15001, 14209, 14210, 14341, 14342, 14345, 14737, 14738, 14741,
+    13949, 13950, 14081, 14082, 14083, 14213, 14214, 14215, 13687, 13688, 13819, 13820,
+    13821, 13951, 13952, 13953, 13425, 13426, 13557, 13558, 13559, 13689, 13690, 13691,
+    13163, 13164, 13295, 13296, 13297, 13427, 13428, 13429, 12901, 12902, 13033, 13034,
+    13035, 13165, 13166, 13167, 12639, 12640, 12771, 12772, 12773, 12903, 12904, 12905,
+    12377, 12378, 12509, 12510, 12511, 12641, 12642, 12643, 12115, 12116, 12247, 12248,
+    12249, 12379, 12380, 12381, 11853, 11854, 11985, 11986, 11987, 12117, 12118, 12119,
+    11327, 11328, 11459, 11460, 11463, 11855, 11856, 11859, 11067, 11068, 11199, 11200,
+    11201, 11331, 11332, 11333, 10805, 10806, 10937, 10938, 10939, 11069, 11070, 11071,
+    10543, 10544, 10675, 10676, 10677, 10807, 10808, 10809, 10281, 10282, 10413, 10414,
+    10415, 10545, 10546, 10547, 10019, 10020, 10151, 10152, 10153, 10283, 10284, 10285,
+    9757, 9758, 9889, 9890, 9891, 10021, 10022, 10023, 9495, 9496, 9627, 9628,
+    9629, 9759, 9760, 9761, 9233, 9234, 9365, 9366, 9367, 9497, 9498, 9499,
+    8971, 8972, 9103, 9104, 9105, 9235, 9236, 9237, 9368, 9369, 9500, 9501,
+    9502, 9632, 9633, 9634, 9630, 9631, 9762, 9763, 9764, 9894, 9895, 9896,
+    9892, 9893, 10024, 10025, 10026, 10156, 10157, 10158, 10154, 10155, 10286, 10287,
+    10288, 10418, 10419, 10420, 10416, 10417, 10548, 10549, 10550, 10680, 10681, 10682,
+    10678, 10679, 10810, 10811, 10812, 10942, 10943, 10944, 10940, 10941, 11072, 11073,
+    11074, 11204, 11205, 11206, 11202, 11203, 11334, 11335, 11336, 11466, 11467, 11468,
+    11464, 11465, 11860, 11861, 11862, 11992, 11993, 11994, 11988, 11991, 12120, 12123,
+    12124, 12252, 12255, 12256, 12250, 12251, 12382, 12383, 12384, 12514, 12515, 12516,
+    12512, 12513, 12644, 12645, 12646, 12776, 12777, 12778, 12774, 12775, 12906, 12907,
+    12908, 13038, 13039, 13040, 13036, 13037, 13168, 13169, 13170, 13300, 13301, 13302,
+    13298, 13299, 13430, 13431, 13432, 13562, 13563, 13564, 13560, 13561, 13692, 13693,
+    13694, 13824, 13825, 13826, 13822, 13823, 13954, 13955, 13956, 14086, 14087, 14088,
+    14084, 14085, 14216, 14217, 14218, 14348, 14349, 14350, 14346, 14347, 14742, 14743,
+    14744, 14874, 14875, 14876, 14870, 14873, 15002, 15005, 15006, 15134, 15137, 15138,
+    15132, 15133, 15264, 15265, 15266, 15396, 15397, 15398, 15394, 15395, 15526, 15527,
+    15528, 15658, 15659, 15660, 15656, 15657, 15788, 15789, 15790, 15920, 15921, 15922,
+    15918, 15919, 16050, 16051, 16052, 16182, 16183, 16184, 16180, 16181, 16312, 16313,
+    16314, 16444, 16445, 16446, 16442, 16443, 16574, 16575, 16576, 16706, 16707, 16708,
+    16704, 16705, 16836, 16837, 16838, 16968, 16969, 16970, 16966, 16967, 17098, 17099,
+    17100, 17230, 17231, 17232, 16839, 16840, 16971, 16972, 16973, 17103, 17104, 17105,
+    16577, 16578, 16709, 16710, 16711, 16841, 16842, 16843, 16315, 16316, 16447, 16448,
+    16449, 16579, 16580, 16581, 16053, 16054, 16185, 16186, 16187, 16317, 16318, 16319,
+    15791, 15792, 15923, 15924, 15925, 16055, 16056, 16057, 15529, 15530, 15661, 15662,
+    15665, 15793, 15794, 15797, 15269, 15270, 15401, 15402, 15403, 15533, 15534, 15535,
+    15007, 15008, 15139, 15140, 15141, 15271, 15272, 15273, 14745, 14746, 14877, 14878,
+    14879, 15009, 15010, 15011, 14219, 14220, 14351, 14352, 14353, 14747, 14748, 14749,
+    13957, 13958, 14089, 14090, 14091, 14221, 14222, 14223, 13695, 13696, 13827, 13828,
+    13829, 13959, 13960, 13961, 13433, 13434, 13565, 13566, 13567, 13697, 13698, 13699,
+    13171, 13172, 13303, 13304, 13305, 13435, 13436, 13437, 12909, 12910, 13041, 13042,
+    13043, 13173, 13174, 13175, 12647, 12648, 12779, 12780, 12783, 12911, 12912, 12915,
+    12387, 12388, 12519, 12520, 12521, 12651, 12652, 12653, 12125, 12126, 12257, 12258,
+    12259, 12389, 12390, 12391, 11863, 11864, 11995, 11996, 11997, 12127, 12128, 12129,
+    11337, 11338, 11469, 11470, 11471, 11865, 11866, 11867, 11075, 11076, 11207, 11208,
+    11209, 11339, 11340, 11341, 10813, 10814, 10945, 10946, 10947, 11077, 11078, 11079,
+    10551, 10552, 10683, 10684, 10685, 10815, 10816, 10817, 10289, 10290, 10421, 10422,
+    10423, 10553, 10554, 10555, 10027, 10028, 10159, 10160, 10161, 10291, 10292, 10293,
+    10424, 10425, 10556, 10557, 10558, 10688, 10689, 10690, 10686, 10687, 10818, 10819,
+    10820, 10950, 10951, 10952, 10948, 10949, 11080, 11081, 11082, 11212, 11213, 11214,
+    11210, 11211, 11342, 11343, 11344, 11474, 11475, 11476, 11472, 11473, 11868, 11869,
+    11870, 12000, 12001, 12002, 11998, 11999, 12130, 12131, 12132, 12262, 12263, 12264,
+    12260, 12261, 12392, 12393, 12394, 12524, 12525, 12526, 12522, 12523, 12654, 12655,
+    12656, 12786, 12787, 12788, 12784, 12785, 12916, 12917, 12918, 13048, 13049, 13050,
+    13044, 13047, 13176, 13179, 13180, 13308, 13311, 13312, 13306, 13307, 13438, 13439,
+    13440, 13570, 13571, 13572, 13568, 13569, 13700, 13701, 13702, 13832, 13833, 13834,
+    13830, 13831, 13962, 13963, 13964, 14094, 14095, 14096, 14092, 14093, 14224, 14225,
+    14226, 14356, 14357, 14358, 14354, 14355, 14750, 14751, 14752, 14882, 14883, 14884,
+    14880, 14881, 15012, 15013, 15014, 15144, 15145, 15146, 15142, 15143, 15274, 15275,
+    15276, 15406, 15407, 15408, 15404, 15405, 15536, 15537, 15538, 15668, 15669, 15670,
+    15666, 15667, 15798, 15799, 15800, 15930, 15931, 15932, 15926, 15929, 16058, 16061,
+    16062, 16190, 16193, 16194, 16188, 16189, 16320, 16321, 16322, 16452, 16453, 16454,
+    16450, 16451, 16582, 16583, 16584, 16714, 16715, 16716, 16712, 16713, 16844, 16845,
+    16846, 16976, 16977, 16978, 16974, 16975, 17106, 17107, 17108, 17238, 17239, 17240,
+    16847, 16848, 16979, 16980, 16981, 17111, 17112, 17113, 16585, 16586, 16717, 16718,
+    16721, 16849, 16850, 16853, 16325, 16326, 16457, 16458, 16459, 16589, 16590, 16591,
+    16063, 16064, 16195, 16196, 16197, 16327, 16328, 16329, 15801, 15802, 15933, 15934,
+    15935, 16065, 16066, 16067, 15539, 15540, 15671, 15672, 15673, 15803, 15804, 15805,
+    15277, 15278, 15409, 15410, 15411, 15541, 15542, 15543, 15015, 15016, 15147, 15148,
+    15149, 15279, 15280, 15281, 14753, 14754, 14885, 14886, 14887, 15017, 15018, 15019,
+    14227, 14228, 14359, 14360, 14361, 14755, 14756, 14757, 13965, 13966, 14097, 14098,
+    14099, 14229, 14230, 14231, 13703, 13704, 13835, 13836, 13839, 13967, 13968, 13971,
+    13443, 13444, 13575, 13576, 13577, 13707, 13708, 13709, 13181, 13182, 13313, 13314,
+    13315, 13445, 13446, 13447, 12919, 12920, 13051, 13052, 13053, 13183, 13184, 13185,
+    12657, 12658, 12789, 12790, 12791, 12921, 12922, 12923, 12395, 12396, 12527, 12528,
+    12529, 12659, 12660, 12661, 12133, 12134, 12265, 12266, 12267, 12397, 12398, 12399,
+    11871, 11872, 12003, 12004, 12005, 12135, 12136, 12137, 11345, 11346, 11477, 11478,
+    11479, 11873, 11874, 11875, 11083, 11084, 11215, 11216, 11217, 11347, 11348, 11349,
+    11480, 11481, 11876, 11877, 11878, 12008, 12009, 12010, 12006, 12007, 12138, 12139,
+    12140, 12270, 12271, 12272, 12268, 12269, 12400, 12401, 12402, 12532, 12533, 12534,
+    12530, 12531, 12662, 12663, 12664, 12794, 12795, 12796, 12792, 12793, 12924, 12925,
+    12926, 13056, 13057, 13058, 13054, 13055, 13186, 13187, 13188, 13318, 13319, 13320,
+    13316, 13317, 13448, 13449, 13450, 13580, 13581, 13582, 13578, 13579, 13710, 13711,
+    13712, 13842, 13843, 13844, 13840, 13841, 13972, 13973, 13974, 14104, 14105, 14106,
+    14100, 14103, 14232, 14235, 14236, 14364, 14367, 14368, 14362, 14363, 14758, 14759,
+    14760, 14890, 14891, 14892, 14888, 14889, 15020, 15021, 15022, 15152, 15153, 15154,
+    15150, 15151, 15282, 15283, 15284, 15414, 15415, 15416, 15412, 15413, 15544, 15545,
+    15546, 15676, 15677, 15678, 15674, 15675, 15806, 15807, 15808, 15938, 15939, 15940,
+    15936, 15937, 16068, 16069, 16070, 16200, 16201, 16202, 16198, 16199, 16330, 16331,
+    16332, 16462, 16463, 16464, 16460, 16461, 16592, 16593, 16594, 16724, 16725, 16726,
+    16722, 16723, 16854, 16855, 16856, 16986, 16987, 16988, 16982, 16985, 17114, 17117,
+    17118, 17246, 17249, 17250, 16857, 16858, 16989, 16990, 16991, 17121, 17122, 17123,
+    16595, 16596, 16727, 16728, 16729, 16859, 16860, 16861, 16333, 16334, 16465, 16466,
+    16467, 16597, 16598, 16599, 16071, 16072, 16203, 16204, 16205, 16335, 16336, 16337,
+    15809, 15810, 15941, 15942, 15943, 16073, 16074, 16075, 15547, 15548, 15679, 15680,
+    15681, 15811, 15812, 15813, 15285, 15286, 15417, 15418, 15419, 15549, 15550, 15551,
+    15023, 15024, 15155, 15156, 15159, 15287, 15288, 15291, 14763, 14764, 14895, 14896,
+    14897, 15027, 15028, 15029, 14237, 14238, 14369, 14370, 14371, 14765, 14766, 14767,
+    13975, 13976, 14107, 14108, 14109, 14239, 14240, 14241, 13713, 13714, 13845, 13846,
+    13847, 13977, 13978, 13979, 13451, 13452, 13583, 13584, 13585, 13715, 13716, 13717,
+    13189, 13190, 13321, 13322, 13323, 13453, 13454, 13455, 12927, 12928, 13059, 13060,
+    13061, 13191, 13192, 13193, 12665, 12666, 12797, 12798, 12799, 12929, 12930, 12931,
+    12403, 12404, 12535, 12536, 12537, 12667, 12668, 12669, 12800, 12801, 12932, 12933,
+    12934, 13064, 13065, 13066, 13062, 13063, 13194, 13195, 13196, 13326, 13327, 13328,
+    13324, 13325, 13456, 13457, 13458, 13588, 13589, 13590, 13586, 13587, 13718, 13719,
+    13720, 13850, 13851, 13852, 13848, 13849, 13980, 13981, 13982, 14112, 14113, 14114,
+    14110, 14111, 14242, 14243, 14244, 14374, 14375, 14376, 14372, 14373, 14768, 14769,
+    14770, 14900, 14901, 14902, 14898, 14899, 15030, 15031, 15032, 15162, 15163, 15164,
+    15160, 15161, 15292, 15293, 15294, 15424, 15425, 15426, 15420, 15423, 15552, 15555,
+    15556, 15684, 15687, 15688, 15682, 15683, 15814, 15815, 15816, 15946, 15947, 15948,
+    15944, 15945, 16076, 16077, 16078, 16208, 16209, 16210, 16206, 16207, 16338, 16339,
+    16340, 16470, 16471, 16472, 16468, 16469, 16600, 16601, 16602, 16732, 16733, 16734,
+    16730, 16731, 16862, 16863, 16864, 16994, 16995, 16996, 16992, 16993, 17124, 17125,
+    17126, 17256, 17257, 17258, 16865, 16866, 16997, 16998, 16999, 17129, 17130, 17131,
+    16603, 16604, 16735, 16736, 16737, 16867, 16868, 16869, 16341, 16342, 16473, 16474,
+    16475, 16605, 16606, 16607, 16079, 16080, 16211, 16212, 16215, 16343, 16344, 16347,
+    15819, 15820, 15951, 15952, 15953, 16083, 16084, 16085, 15557, 15558, 15689, 15690,
+    15691, 15821, 15822, 15823, 15295, 15296, 15427, 15428, 15429, 15559, 15560, 15561,
+    15033, 15034, 15165, 15166, 15167, 15297, 15298, 15299, 14771, 14772, 14903, 14904,
+    14905, 15035, 15036, 15037, 14245, 14246, 14377, 14378, 14379, 14773, 14774, 14775,
+    13983, 13984, 14115, 14116, 14117, 14247, 14248, 14249, 13721, 13722, 13853, 13854,
+    13855, 13985, 13986, 13987, 13459, 13460, 13591, 13592, 13593, 13723, 13724, 13725,
+    13856, 13857, 13988, 13989, 13990, 14120, 14121, 14122, 14118, 14119, 14250, 14251,
+    14252, 14382, 14383, 14384, 14380, 14381, 14776, 14777, 14778, 14908, 14909, 14910,
+    14906, 14907, 15038, 15039, 15040, 15170, 15171, 15172, 15168, 15169, 15300, 15301,
+    15302, 15432, 15433, 15434, 15430, 15431, 15562, 15563, 15564, 15694, 15695, 15696,
+    15692, 15693, 15824, 15825, 15826, 15956, 15957, 15958, 15954, 15955, 16086, 16087,
+    16088, 16218, 16219, 16220, 16216, 16217, 16348, 16349, 16350, 16480, 16481, 16482,
+    16476, 16479, 16608, 16611, 16612, 16740, 16743, 16744, 16738, 16739, 16870, 16871,
+    16872, 17002, 17003, 17004, 17000, 17001, 17132, 17133, 17134, 17264, 17265, 17266,
+    16875, 16876, 17007, 17008, 17009, 17139, 17140, 17141, 16613, 16614, 16745, 16746,
+    16747, 16877, 16878, 16879, 16351, 16352, 16483, 16484, 16485, 16615, 16616, 16617,
+    16089, 16090, 16221, 16222, 16223, 16353, 16354, 16355, 15827, 15828, 15959, 15960,
+    15961, 16091, 16092, 16093, 15565, 15566, 15697, 15698, 15699, 15829, 15830, 15831,
+    15303, 15304, 15435, 15436, 15437, 15567, 15568, 15569, 15041, 15042, 15173, 15174,
+    15175, 15305, 15306, 15307, 14779, 14780, 14911, 14912, 14913, 15043, 15044, 15045,
+    15176, 15177, 15308, 15309, 15310, 15440, 15441, 15442, 15438, 15439, 15570, 15571,
+    15572, 15702, 15703, 15704, 15700, 15701, 15832, 15833, 15834, 15964, 15965, 15966,
+    15962, 15963, 16094, 16095, 16096, 16226, 16227, 16228, 16224, 16225, 16356, 16357,
+    16358, 16488, 16489, 16490, 16486, 16487, 16618, 16619, 16620, 16750, 16751, 16752,
+    16748, 16749, 16880, 16881, 16882, 17012, 17013, 17014, 17010, 17011, 17142, 17143,
+    17144, 17274, 17275, 17276, 16883, 16884, 17015, 17016, 17017, 17147, 17148, 17149,
+    16621, 16622, 16753, 16754, 16755, 16885, 16886, 16887, 16359, 16360, 16491, 16492,
+    16493, 16623, 16624, 16625, 16097, 16098, 16229, 16230, 16231, 16361, 16362, 16363,
+    15835, 15836, 15967, 15968, 15969, 16099, 16100, 16101, 16232, 16233, 16364, 16365,
+    16366, 16496, 16497, 16498, 16494, 16495, 16626, 16627, 16628, 16758, 16759, 16760,
+    16756, 16757, 16888, 16889, 16890, 17020, 17021, 17022, 17018, 17019, 17150, 17151,
+    17152, 17282, 17283, 17284, 16891, 16892, 17023, 17024, 17025, 17155, 17156, 17157,
+};
+
+static const uint16_t bits_23[17424] = {
+    1149, 1150, 1293, 1294, 577, 1437, 1438, 721, 145, 146, 289, 290,
+    291, 433, 434, 435, 20311, 20312, 20455, 20456, 20457, 147, 148, 149,
+    20458, 20459, 150, 151, 152, 294, 295, 296, 292, 293, 436, 437,
+    438, 580, 581, 582, 578, 579, 722, 723, 724, 866, 867, 868,
+    1582, 865, 1726, 1009, 1010, 1870, 1153, 1154, 2301, 2302, 2445, 2446,
+    1729, 2589, 2590, 1873, 1297, 1298, 1441, 1442, 1443, 1585, 1586, 1587,
+    1011, 1012, 1155, 1156, 1157, 1299, 1300, 1301, 725, 726, 869, 870,
+    871, 1013, 1014, 1015, 439, 440, 583, 584, 585, 727, 728, 729,
+    153, 154, 297, 298, 299, 441, 442, 443, 20319, 20320, 20463, 20464,
+    20465, 155, 156, 157, 20466, 20467, 158, 159, 160, 302, 303, 304,
+    300, 301, 444, 445, 446, 588, 589, 590, 586, 587, 730, 731,
+    732, 874, 875, 876, 872, 873, 1016, 1017, 1018, 1160, 1161, 1162,
+    1158, 1159, 1302, 1303, 1304, 1446, 1447, 1448, 1444, 1445, 1588, 1589,
+    1590, 1732, 1733, 1734, 1730, 1731, 1874, 1875, 1876, 2018, 2019, 2020,
+    2734, 2017, 2878, 2161, 2162, 3022, 2305, 2306, 3741, 3742, 3885, 3886,
+    2881, 4029, 4030, 3025, 2449, 2450, 2593, 2594, 2595, 2737, 2738, 2739,
+    2163, 2164, 2307, 2308, 2309, 2451, 2452, 2453, 1877, 1878, 2021, 2022,
+    2023, 2165, 2166, 2167, 1591, 1592, 1735, 1736, 1737, 1879, 1880, 1881,
+    1305, 1306, 1449, 1450, 1451, 1593, 1594, 1595, 1019, 1020, 1163, 1164,
+    1165, 1307, 1308, 1309, 733, 734, 877, 878, 879, 1021, 1022, 1023,
+    447, 448, 591, 592, 593, 735, 736, 737, 161, 162, 305, 306,
+    307, 449, 450, 451, 20329, 20330, 20473, 20474, 20475, 163, 164, 165,
+    20476, 20477, 166, 169, 170, 310, 313, 314, 308, 309, 452, 453,
+    454, 596, 597, 598, 594, 595, 738, 739, 740, 882, 883, 884,
+    880, 881, 1024, 1025, 1026, 1168, 1169, 1170, 1166, 1167, 1310, 1311,
+    1312, 1454, 1455, 1456, 1452, 1453, 1596, 1597, 1598, 1740, 1741, 1742,
+    1738, 1739, 1882, 1883, 1884, 2026, 2027, 2028, 2024, 2025, 2168, 2169,
+    2170, 2312, 2313, 2314, 2310, 2311, 2454, 2455, 2456, 2598, 2599, 2600,
+    2596, 2597, 2740, 2741, 2742, 2884, 2885, 2886, 2882, 2883, 3026, 3027,
+    3028, 3170, 3171, 3172, 4174, 3169, 4318, 3601, 3602, 4462, 3745, 3746,
+    4893, 4894, 5037, 5038, 4321, 5181, 5182, 4465, 3889, 3890, 4033, 4034,
+    4035, 4177, 4178, 4179, 3603, 3604, 3747, 3748, 3749, 3891, 3892, 3893,
+    3029, 3030, 3173, 3174, 3175, 3605, 3606, 3607, 2743, 2744, 2887, 2888,
+    2889, 3031, 3032, 3033, 2457, 2458, 2601, 2602, 2603, 2745, 2746, 2747,
+    2171, 2172, 2315, 2316, 2317, 2459, 2460, 2461, 1885, 1886, 2029, 2030,
+    2031, 2173, 2174, 2175, 1599, 1600, 1743, 1744, 1745, 1887, 1888, 1889,
+    1313, 1314, 1457, 1458, 1459, 1601, 1602, 1603, 1027, 1028, 1171, 1172,
+    1173, 1315, 1316, 1317, 741, 742, 885, 886, 889, 1029, 1030, 1033,
+    457, 458, 601, 602, 603, 745, 746, 747, 171, 172, 315, 316,
+    317, 459, 460, 461, 20337, 20338, 20481, 20482, 20483, 173, 174, 175,
+    20484, 20485, 176, 177, 178, 320, 321, 322, 318, 319, 462, 463,
+    464, 606, 607, 608, 604, 605, 748, 749, 750, 892, 893, 894,
+    890, 891, 1034, 1035, 1036, 1178, 1179, 1180, 1174, 1177, 1318, 1321,
+    1322, 1462, 1465, 1466, 1460, 1461, 1604, 1605, 1606, 1748, 1749, 1750,
+    1746, 1747, 1890, 1891, 1892, 2034, 2035, 2036, 2032, 2033, 2176, 2177,
+    2178, 2320, 2321, 2322, 2318, 2319, 2462, 2463, 2464, 2606, 2607, 2608,
+    2604, 2605, 2748, 2749, 2750, 2892, 2893, 2894, 2890, 2891, 3034, 3035,
+    3036, 3178, 3179, 3180, 3176, 3177, 3608, 3609, 3610, 3752, 3753, 3754,
+    3750, 3751, 3894, 3895, 3896, 4038, 4039, 4040, 4036, 4037, 4180, 4181,
+    4182, 4324, 4325, 4326, 4322, 4323, 4466, 4467, 4468, 4610, 4611, 4612,
+    5326, 4609, 5470, 4753, 4754, 5614, 4897, 4898, 6045, 6046, 6189, 6190,
+    5473, 6333, 6334, 5617, 5041, 5042, 5185, 5186, 5187, 5329, 5330, 5331,
+    4755, 4756, 4899, 4900, 4901, 5043, 5044, 5045, 4469, 4470, 4613, 4614,
+    4615, 4757, 4758, 4759, 4183, 4184, 4327, 4328, 4329, 4471, 4472, 4473,
+    3897, 3898, 4041, 4042, 4043, 4185, 4186, 4187, 3611, 3612, 3755, 3756,
+    3757, 3899, 3900, 3901, 3037, 3038, 3181, 3182, 3183, 3613, 3614, 3615,
+    2751, 2752, 2895, 2896, 2897, 3039, 3040, 3041, 2465, 2466, 2609, 2610,
+    2611, 2753, 2754, 2755, 2179, 2180, 2323, 2324, 2325, 2467, 2468, 2469,
+    1893, 1894, 2037, 2038, 2041, 2181, 2182, 2185, 1609, 1610, 1753, 1754,
+    1755, 1897, 1898, 1899, 1323, 1324, 1467, 1468, 1469, 1611, 1612, 1613,
+    1037, 1038, 1181, 1182, 1183, 1325, 1326, 1327, 751, 752, 895, 896,
+    897, 1039, 1040, 1041, 465, 466, 609, 610, 611, 753, 754, 755,
+    179, 180, 323, 324, 325, 467, 468, 469, 20345, 20346, 20489, 20490,
+    20491, 181, 182, 183, 20492, 20493, 184, 185, 186, 328, 329, 330,
+    326, 327, 470, 471, 472, 614, 615, 616, 612, 613, 756, 757,
+    758, 900, 901, 902, 898, 899, 1042, 1043, 1044, 1186, 1187, 1188,
+    1184, 1185, 1328, 1329, 1330, 1472, 1473, 1474, 1470, 1471, 1614, 1615,
+    1616, 1758, 1759, 1760, 1756, 1757, 1900, 1901, 1902, 2044, 2045, 2046,
+    2042, 2043, 2186, 2187, 2188, 2330, 2331, 2332, 2326, 2329, 2470, 2473,
+    2474, 2614, 2617, 2618, 2612, 2613, 2756, 2757, 2758, 2900, 2901, 2902,
+    2898, 2899, 3042, 3043, 3044, 3186, 3187, 3188, 3184, 3185, 3616, 3617,
+    3618, 3760, 3761, 3762, 3758, 3759, 3902, 3903, 3904, 4046, 4047, 4048,
+    4044, 4045, 4188, 4189, 4190, 4332, 4333, 4334, 4330, 4331, 4474, 4475,
+    4476, 4618, 4619, 4620, 4616, 4617, 4760, 4761, 4762, 4904, 4905, 4906,
+    4902, 4903, 5046, 5047, 5048, 5190, 5191, 5192, 5188, 5189, 5332, 5333,
+    5334, 5476, 5477, 5478, 5474, 5475, 5618, 5619, 5620, 5762, 5763, 5764,
+    6478, 5761, 6622, 5905, 5906, 6766, 6049, 6050, 7485, 7486, 7629, 7630,
+    6625, 7773, 7774, 7057, 6193, 6194, 6337, 6338, 6339, 6481, 6482, 6483,
+    5907, 5908, 6051, 6052, 6053, 6195, 6196, 6197, 5621, 5622, 5765, 5766,
+    5767, 5909, 5910, 5911, 5335, 5336, 5479, 5480, 5481, 5623, 5624, 5625,
+    5049, 5050, 5193, 5194, 5195, 5337, 5338, 5339, 4763, 4764, 4907, 4908,
+    4909, 5051, 5052, 5053, 4477, 4478, 4621, 4622, 4623, 4765, 4766, 4767,
+    4191, 4192, 4335, 4336, 4337, 4479, 4480, 4481, 3905, 3906, 4049, 4050,
+    4051, 4193, 4194, 4195, 3619, 3620, 3763, 3764, 3765, 3907, 3908, 3909,
+    3045, 3046, 3189, 3190, 3193, 3621, 3622, 3625, 2761, 2762, 2905, 2906,
+    2907, 3049, 3050, 3051, 2475, 2476, 2619, 2620, 2621, 2763, 2764, 2765,
+    2189, 2190, 2333, 2334, 2335, 2477, 2478, 2479, 1903, 1904, 2047, 2048,
+    2049, 2191, 2192, 2193, 1617, 1618, 1761, 1762, 1763, 1905, 1906, 1907,
+    1331, 1332, 1475, 1476, 1477, 1619, 1620, 1621, 1045, 1046, 1189, 1190,
+    1191, 1333, 1334, 1335, 759, 760, 903, 904, 905, 1047, 1048, 1049,
+    473, 474, 617, 618, 619, 761, 762, 763, 187, 188, 331, 332,
+    333, 475, 476, 477, 20355, 20356, 20499, 20500, 20501, 189, 190, 193,
+    20502, 20503, 194, 195, 196, 338, 339, 340, 334, 337, 478, 481,
+    482, 622, 625, 626, 620, 621, 764, 765, 766, 908, 909, 910,
+    906, 907, 1050, 1051, 1052, 1194, 1195, 1196, 1192, 1193, 1336, 1337,
+    1338, 1480, 1481, 1482, 1478, 1479, 1622, 1623, 1624, 1766, 1767, 1768,
+    1764, 1765, 1908, 1909, 1910, 2052, 2053, 2054, 2050, 2051, 2194, 2195,
+    2196, 2338, 2339, 2340, 2336, 2337, 2480, 2481, 2482, 2624, 2625, 2626,
+    2622, 2623, 2766, 2767, 2768, 2910, 2911, 2912, 2908, 2909, 3052, 3053,
+    3054, 3196, 3197, 3198, 3194, 3195, 3626, 3627, 3628, 3770, 3771, 3772,
+    3766, 3769, 3910, 3913, 3914, 4054, 4057, 4058, 4052, 4053, 4196, 4197,
+    4198, 4340, 4341, 4342, 4338, 4339, 4482, 4483, 4484, 4626, 4627, 4628,
+    4624, 4625, 4768, 4769, 4770, 4912, 4913, 4914, 4910, 4911, 5054, 5055,
+    5056, 5198, 5199, 5200, 5196, 5197, 5340, 5341, 5342, 5484, 5485, 5486,
+    5482, 5483, 5626, 5627, 5628, 5770, 5771, 5772, 5768, 5769, 5912, 5913,
+    5914, 6056, 6057, 6058, 6054, 6055, 6198, 6199, 6200, 6342, 6343, 6344,
+    6340, 6341, 6484, 6485, 6486, 6628, 6629, 6630, 6626, 6627, 7058, 7059,
+    7060, 7202, 7203, 7204, 7918, 7201, 8062, 7345, 7346, 8206, 7489, 7490,
+    8637, 8638, 8781, 8782, 8065, 8925, 8926, 8209, 7633, 7634, 7777, 7778,
+    7779, 7921, 7922, 7923, 7347, 7348, 7491, 7492, 7493, 7635, 7636, 7637,
+    7061, 7062, 7205, 7206, 7207, 7349, 7350, 7351, 6487, 6488, 6631, 6632,
+    6633, 7063, 7064, 7065, 6201, 6202, 6345, 6346, 6347, 6489, 6490, 6491,
+    5915, 5916, 6059, 6060, 6061, 6203, 6204, 6205, 5629, 5630, 5773, 5774,
+    5775, 5917, 5918, 5919, 5343, 5344, 5487, 5488, 5489, 5631, 5632, 5633,
+    5057, 5058, 5201, 5202, 5203, 5345, 5346, 5347, 4771, 4772, 4915, 4916,
+    4917, 5059, 5060, 5061, 4485, 4486, 4629, 4630, 4633, 4773, 4774, 4777,
+    4201, 4202, 4345, 4346, 4347, 4489, 4490, 4491, 3915, 3916, 4059, 4060,
+    4061, 4203, 4204, 4205, 3629, 3630, 3773, 3774, 3775, 3917, 3918, 3919,
+    3055, 3056, 3199, 3200, 3201, 3631, 3632, 3633, 2769, 2770, 2913, 2914,
+    2915, 3057, 3058, 3059, 2483, 2484, 2627, 2628, 2629, 2771, 2772, 2773,
+    2197, 2198, 2341, 2342, 2343, 2485, 2486, 2487, 1911, 1912, 2055, 2056,
+    2057, 2199, 2200, 2201, 1625, 1626, 1769, 1770, 1771, 1913, 1914, 1915,
+    1339, 1340, 1483, 1484, 1485, 1627, 1628, 1629, 1053, 1054, 1197, 1198,
+    1201, 1341, 1342, 1345, 769, 770, 913, 914, 915, 1057, 1058, 1059,
+    483, 484, 627, 628, 629, 771, 772, 773, 197, 198, 341, 342,
+    343, 485, 486, 487, 20363, 20364, 20507, 20508, 20509, 199, 200, 201,
+    20510, 20511, 202, 203, 204, 346, 347, 348, 344, 345, 488, 489,
+    490, 632, 633, 634, 630, 631, 774, 775, 776, 918, 919, 920,
+    916, 917, 1060, 1061, 1062, 1204, 1205, 1206, 1202, 1203, 1346, 1347,
+    1348, 1490, 1491, 1492, 1486, 1489, 1630, 1633, 1634, 1774, 1777, 1778,
+    1772, 1773, 1916, 1917, 1918, 2060, 2061, 2062, 2058, 2059, 2202, 2203,
+    2204, 2346, 2347, 2348, 2344, 2345, 2488, 2489, 2490, 2632, 2633, 2634,
+    2630, 2631, 2774, 2775, 2776, 2918, 2919, 2920, 2916, 2917, 3060, 3061,
+    3062, 3204, 3205, 3206, 3202, 3203, 3634, 3635, 3636, 3778, 3779, 3780,
+    3776, 3777, 3920, 3921, 3922, 4064, 4065, 4066, 4062, 4063, 4206, 4207,
+    4208, 4350, 4351, 4352, 4348, 4349, 4492, 4493, 4494, 4636, 4637, 4638,
+    4634, 4635, 4778, 4779, 4780, 4922, 4923, 4924, 4918, 4921, 5062, 5065,
+    5066, 5206, 5209, 5210, 5204, 5205, 5348, 5349, 5350, 5492, 5493, 5494,
+    5490, 5491, 5634, 5635, 5636, 5778, 5779, 5780, 5776, 5777, 5920, 5921,
+    5922, 6064, 6065, 6066, 6062, 6063, 6206, 6207, 6208, 6350, 6351, 6352,
+    6348, 6349, 6492, 6493, 6494, 6636, 6637, 6638, 6634, 6635, 7066, 7067,
+    7068, 7210, 7211, 7212, 7208, 7209, 7352, 7353, 7354, 7496, 7497, 7498,
+    7494, 7495, 7638, 7639, 7640, 7782, 7783, 7784, 7780, 7781, 7924, 7925,
+    7926, 8068, 8069, 8070, 8066, 8067, 8210, 8211, 8212, 8354, 8355, 8356,
+    9070, 8353, 9214, 8497, 8498, 9358, 8641, 8642, 9789, 9790, 9933, 9934,
+    9217, 10077, 10078, 9361, 8785, 8786, 8929, 8930, 8931, 9073, 9074, 9075,
+    8499, 8500, 8643, 8644, 8645, 8787, 8788, 8789, 8213, 8214, 8357, 8358,
+    8359, 8501, 8502, 8503, 7927, 7928, 8071, 8072, 8073, 8215, 8216, 8217,
+    7641, 7642, 7785, 7786, 7787, 7929, 7930, 7931, 7355, 7356, 7499, 7500,
+    7501, 7643, 7644, 7645, 7069, 7070, 7213, 7214, 7215, 7357, 7358, 7359,
+    6495, 6496, 6639, 6640, 6641, 7071, 7072, 7073, 6209, 6210, 6353, 6354,
+    6355, 6497, 6498, 6499, 5923, 5924, 6067, 6068, 6069, 6211, 6212, 6213,
+    5637, 5638, 5781, 5782, 5785, 5925, 5926, 5929, 5353, 5354, 5497, 5498,
+    5499, 5641, 5642, 5643, 5067, 5068, 5211, 5212, 5213, 5355, 5356, 5357,
+    4781, 4782, 4925, 4926, 4927, 5069, 5070, 5071, 4495, 4496, 4639, 4640,
+    4641, 4783, 4784, 4785, 4209, 4210, 4353, 4354, 4355, 4497, 4498, 4499,
+    3923, 3924, 4067, 4068, 4069, 4211, 4212, 4213, 3637, 3638, 3781, 3782,
+    3783, 3925, 3926, 3927, 3063, 3064, 3207, 3208, 3209, 3639, 3640, 3641,
+    2777, 2778, 2921, 2922, 2923, 3065, 3066, 3067, 2491, 2492, 2635, 2636,
+    2637, 2779, 2780, 2781, 2205, 2206, 2349, 2350, 2353, 2493, 2494, 2497,
+    1921, 1922, 2065, 2066, 2067, 2209, 2210, 2211, 1635, 1636, 1779, 1780,
+    1781, 1923, 1924, 1925, 1349, 1350, 1493, 1494, 1495, 1637, 1638, 1639,
+    1063, 1064, 1207, 1208, 1209, 1351, 1352, 1353, 777, 778, 921, 922,
+    923, 1065, 1066, 1067, 491, 492, 635, 636, 637, 779, 780, 781,
+    205, 206, 349, 350, 351, 493, 494, 495, 20371, 20372, 20515, 20516,
+    20517, 207, 208, 209, 20518, 20521, 210, 211, 212, 354, 355, 356,
+    352, 353, 496, 497, 498, 640, 641, 642, 638, 639, 782, 783,
+    784, 926, 927, 928, 924, 925, 1068, 1069, 1070, 1212, 1213, 1214,
+    1210, 1211, 1354, 1355, 1356, 1498, 1499, 1500, 1496, 1497, 1640, 1641,
+    1642, 1784, 1785, 1786, 1782, 1783, 1926, 1927, 1928, 2070, 2071, 2072,
+    2068, 2069, 2212, 2213, 2214, 2356, 2357, 2358, 2354, 2355, 2498, 2499,
+    2500, 2642, 2643, 2644, 2638, 2641, 2782, 2785, 2786, 2926, 2929, 2930,
+    2924, 2925, 3068, 3069, 3070, 3212, 3213, 3214, 3210, 3211, 3642, 3643,
+    3644, 3786, 3787, 3788, 3784, 3785, 3928, 3929, 3930, 4072, 4073, 4074,
+    4070, 4071, 4214, 4215, 4216, 4358, 4359, 4360, 4356, 4357, 4500, 4501,
+    4502, 4644, 4645, 4646, 4642, 4643, 4786, 4787, 4788, 4930, 4931, 4932,
+    4928, 4929, 5072, 5073, 5074, 5216, 5217, 5218, 5214, 5215, 5358, 5359,
+    5360, 5502, 5503, 5504, 5500, 5501, 5644, 5645, 5646, 5788, 5789, 5790,
+    5786, 5787, 5930, 5931, 5932, 6074, 6075, 6076, 6070, 6073, 6214, 6217,
+    6218, 6358, 6361, 6362, 6356, 6357, 6500, 6501, 6502, 6644, 6645, 6646,
+    6642, 6643, 7074, 7075, 7076, 7218, 7219, 7220, 7216, 7217, 7360, 7361,
+    7362, 7504, 7505, 7506, 7502, 7503, 7646, 7647, 7648, 7790, 7791, 7792,
+    7788, 7789, 7932, 7933, 7934, 8076, 8077, 8078, 8074, 8075, 8218, 8219,
+    8220, 8362, 8363, 8364, 8360, 8361, 8504, 8505, 8506, 8648, 8649, 8650,
+    8646, 8647, 8790, 8791, 8792, 8934, 8935, 8936, 8932, 8933, 9076, 9077,
+    9078, 9220, 9221, 9222, 9218, 9219, 9362, 9363, 9364, 9506, 9507, 9508,
+    10222, 9505, 10654, 9649, 9650, 10798, 9793, 9794, 11229, 11230, 11373, 11374,
+    10657, 11517, 11518, 10801, 9937, 9938, 10081, 10082, 10083, 10513, 10514, 10515,
+    9651, 9652, 9795, 9796, 9797, 9939, 9940, 9941, 9365, 9366, 9509, 9510,
+    9511, 9653, 9654, 9655, 9079, 9080, 9223, 9224, 9225, 9367, 9368, 9369,
+    8793, 8794, 8937, 8938, 8939, 9081, 9082, 9083, 8507, 8508, 8651, 8652,
+    8653, 8795, 8796, 8797, 8221, 8222, 8365, 8366, 8367, 8509, 8510, 8511,
+    7935, 7936, 8079, 8080, 8081, 8223, 8224, 8225, 7649, 7650, 7793, 7794,
+    7795, 7937, 7938, 7939, 7363, 7364, 7507, 7508, 7509, 7651, 7652, 7653,
+    7077, 7078, 7221, 7222, 7225, 7365, 7366, 7369, 6505, 6506, 6649, 6650,
+    6651, 7081, 7082, 7083, 6219, 6220, 6363, 6364, 6365, 6507, 6508, 6509,
+    5933, 5934, 6077, 6078, 6079, 6221, 6222, 6223, 5647, 5648, 5791, 5792,
+    5793, 5935, 5936, 5937, 5361, 5362, 5505, 5506, 5507, 5649, 5650, 5651,
+    5075, 5076, 5219, 5220, 5221, 5363, 5364, 5365, 4789, 4790, 4933, 4934,
+    4935, 5077, 5078, 5079, 4503, 4504, 4647, 4648, 4649, 4791, 4792, 4793,
+    4217, 4218, 4361, 4362, 4363, 4505, 4506, 4507, 3931, 3932, 4075, 4076,
+    4077, 4219, 4220, 4221, 3645, 3646, 3789, 3790, 3793, 3933, 3934, 3937,
+    3073, 3074, 3217, 3218, 3219, 3649, 3650, 3651, 2787, 2788, 2931, 2932,
+    2933, 3075, 3076, 3077, 2501, 2502, 2645, 2646, 2647, 2789, 2790, 2791,
+    2215, 2216, 2359, 2360, 2361, 2503, 2504, 2505, 1929, 1930, 2073, 2074,
+    2075, 2217, 2218, 2219, 1643, 1644, 1787, 1788, 1789, 1931, 1932, 1933,
+    1357, 1358, 1501, 1502, 1503, 1645, 1646, 1647, 1071, 1072, 1215, 1216,
+    1217, 1359, 1360, 1361, 785, 786, 929, 930, 931, 1073, 1074, 1075,
+    499, 500, 643, 644, 645, 787, 788, 789, 213, 214, 357, 358,
+    361, 501, 502, 505, 20381, 20382, 20525, 20526, 20527, 217, 218, 219,
+    20528, 20529, 220, 221, 222, 364, 365, 366, 362, 363, 506, 507,
+    508, 650, 651, 652, 646, 649, 790, 793, 794, 934, 937, 938,
+    932, 933, 1076, 1077, 1078, 1220, 1221, 1222, 1218, 1219, 1362, 1363,
+    1364, 1506, 1507, 1508, 1504, 1505, 1648, 1649, 1650, 1792, 1793, 1794,
+    1790, 1791, 1934, 1935, 1936, 2078, 2079, 2080, 2076, 2077, 2220, 2221,
+    2222, 2364, 2365, 2366, 2362, 2363, 2506, 2507, 2508, 2650, 2651, 2652,
+    2648, 2649, 2792, 2793, 2794, 2936, 2937, 2938, 2934, 2935, 3078, 3079,
+    3080, 3222, 3223, 3224, 3220, 3221, 3652, 3653, 3654, 3796, 3797, 3798,
+    3794, 3795, 3938, 3939, 3940, 4082, 4083, 4084, 4078, 4081, 4222, 4225,
+    4226, 4366, 4369, 4370, 4364, 4365, 4508, 4509, 4510, 4652, 4653, 4654,
+    4650, 4651, 4794, 4795, 4796, 4938, 4939, 4940, 4936, 4937, 5080, 5081,
+    5082, 5224, 5225, 5226, 5222, 5223, 5366, 5367, 5368, 5510, 5511, 5512,
+    5508, 5509, 5652, 5653, 5654, 5796, 5797, 5798, 5794, 5795, 5938, 5939,
+    5940, 6082, 6083, 6084, 6080, 6081, 6224, 6225, 6226, 6368, 6369, 6370,
+    6366, 6367, 6510, 6511, 6512, 6654, 6655, 6656, 6652, 6653, 7084, 7085,
+    7086, 7228, 7229, 7230, 7226, 7227, 7370, 7371, 7372, 7514, 7515, 7516,
+    7510, 7513, 7654, 7657, 7658, 7798, 7801, 7802, 7796, 7797, 7940, 7941,
+    7942, 8084, 8085, 8086, 8082, 8083, 8226, 8227, 8228, 8370, 8371, 8372,
+    8368, 8369, 8512, 8513, 8514, 8656, 8657, 8658, 8654, 8655, 8798, 8799,
+    8800, 8942, 8943, 8944, 8940, 8941, 9084, 9085, 9086, 9228, 9229, 9230,
+    9226, 9227, 9370, 9371, 9372, 9514, 9515, 9516, 9512, 9513, 9656, 9657,
+    9658, 9800, 9801, 9802, 9798, 9799, 9942, 9943, 9944, 10086, 10087, 10088,
+    10084, 10085, 10516, 10517, 10518, 10660, 10661, 10662, 10658, 10659, 10802, 10803,
+    10804, 10946, 10947, 10948, 11662, 10945, 11806, 11089, 11090, 11950, 11233, 11234,
+    12381, 12382, 12525, 12526, 11809, 12669, 12670, 11953, 11377, 11378, 11521, 11522,
+    11523, 11665, 11666, 11667, 11091, 11092, 11235, 11236, 11237, 11379, 11380, 11381,
+    10805, 10806, 10949, 10950, 10951, 11093, 11094, 11095, 10519, 10520, 10663, 10664,
+    10665, 10807, 10808, 10809, 9945, 9946, 10089, 10090, 10091, 10521, 10522, 10523,
+    9659, 9660, 9803, 9804, 9805, 9947, 9948, 9949, 9373, 9374, 9517, 9518,
+    9519, 9661, 9662, 9663, 9087, 9088, 9231, 9232, 9233, 9375, 9376, 9377,
+    8801, 8802, 8945, 8946, 8947, 9089, 9090, 9091, 8515, 8516, 8659, 8660,
+    8661, 8803, 8804, 8805, 8229, 8230, 8373, 8374, 8377, 8517, 8518, 8521,
+    7945, 7946, 8089, 8090, 8091, 8233, 8234, 8235, 7659, 7660, 7803, 7804,
+    7805, 7947, 7948, 7949, 7373, 7374, 7517, 7518, 7519, 7661, 7662, 7663,
+    7087, 7088, 7231, 7232, 7233, 7375, 7376, 7377, 6513, 6514, 6657, 6658,
+    6659, 7089, 7090, 7091, 6227, 6228, 6371, 6372, 6373, 6515, 6516, 6517,
+    5941, 5942, 6085, 6086, 6087, 6229, 6230, 6231, 5655, 5656, 5799, 5800,
+    5801, 5943, 5944, 5945, 5369, 5370, 5513, 5514, 5515, 5657, 5658, 5659,
+    5083, 5084, 5227, 5228, 5229, 5371, 5372, 5373, 4797, 4798, 4941, 4942,
+    4945, 5085, 5086, 5089, 4513, 4514, 4657, 4658, 4659, 4801, 4802, 4803,
+    4227, 4228, 4371, 4372, 4373, 4515, 4516, 4517, 3941, 3942, 4085, 4086,
+    4087, 4229, 4230, 4231, 3655, 3656, 3799, 3800, 3801, 3943, 3944, 3945,
+    3081, 3082, 3225, 3226, 3227, 3657, 3658, 3659, 2795, 2796, 2939, 2940,
+    2941, 3083, 3084, 3085, 2509, 2510, 2653, 2654, 2655, 2797, 2798, 2799,
+    2223, 2224, 2367, 2368, 2369, 2511, 2512, 2513, 1937, 1938, 2081, 2082,
+    2083, 2225, 2226, 2227, 1651, 1652, 1795, 1796, 1797, 1939, 1940, 1941,
+    1365, 1366, 1509, 1510, 1513, 1653, 1654, 1657, 1081, 1082, 1225, 1226,
+    1227, 1369, 1370, 1371, 795, 796, 939, 940, 941, 1083, 1084, 1085,
+    509, 510, 653, 654, 655, 797, 798, 799, 223, 224, 367, 368,
+    369, 511, 512, 513, 20389, 20390, 20533, 20534, 20535, 225, 226, 227,
+    20536, 20537, 228, 229, 230, 372, 373, 374, 370, 371, 514, 515,
+    516, 658, 659, 660, 656, 657, 800, 801, 802, 944, 945, 946,
+    942, 943, 1086, 1087, 1088, 1230, 1231, 1232, 1228, 1229, 1372, 1373,
+    1374, 1516, 1517, 1518, 1514, 1515, 1658, 1659, 1660, 1802, 1803, 1804,
+    1798, 1801, 1942, 1945, 1946, 2086, 2089, 2090, 2084, 2085, 2228, 2229,
+    2230, 2372, 2373, 2374, 2370, 2371, 2514, 2515, 2516, 2658, 2659, 2660,
+    2656, 2657, 2800, 2801, 2802, 2944, 2945, 2946, 2942, 2943, 3086, 3087,
+    3088, 3230, 3231, 3232, 3228, 3229, 3660, 3661, 3662, 3804, 3805, 3806,
+    3802, 3803, 3946, 3947, 3948, 4090, 4091, 4092, 4088, 4089, 4232, 4233,
+    4234, 4376, 4377, 4378, 4374, 4375, 4518, 4519, 4520, 4662, 4663, 4664,
+    4660, 4661, 4804, 4805, 4806, 4948, 4949, 4950, 4946, 4947, 5090, 5091,
+    5092, 5234, 5235, 5236, 5230, 5233, 5374, 5377, 5378, 5518, 5521, 5522,
+    5516, 5517, 5660, 5661, 5662, 5804, 5805, 5806, 5802, 5803, 5946, 5947,
+    5948, 6090, 6091, 6092, 6088, 6089, 6232, 6233, 6234, 6376, 6377, 6378,
+    6374, 6375, 6518, 6519, 6520, 6662, 6663, 6664, 6660, 6661, 7092, 7093,
+    7094, 7236, 7237, 7238, 7234, 7235, 7378, 7379, 7380, 7522, 7523, 7524,
+    7520, 7521, 7664, 7665, 7666, 7808, 7809, 7810, 7806, 7807, 7950, 7951,
+    7952, 8094, 8095, 8096, 8092, 8093, 8236, 8237, 8238, 8380, 8381, 8382,
+    8378, 8379, 8522, 8523, 8524, 8666, 8667, 8668, 8662, 8665, 8806, 8809,
+    8810, 8950, 8953, 8954, 8948, 8949, 9092, 9093, 9094, 9236, 9237, 9238,
+    9234, 9235, 9378, 9379, 9380, 9522, 9523, 9524, 9520, 9521, 9664, 9665,
+    9666, 9808, 9809, 9810, 9806, 9807, 9950, 9951, 9952, 10094, 10095, 10096,
+    10092, 10093, 10524, 10525, 10526, 10668, 10669, 10670, 10666, 10667, 10810, 10811,
+    10812, 10954, 10955, 10956, 10952, 10953, 11096, 11097, 11098, 11240, 11241, 11242,
+    11238, 11239, 11382, 11383, 11384, 11526, 11527, 11528, 11524, 11525, 11668, 11669,
+    11670, 11812, 11813, 11814, 11810, 11811, 11954, 11955, 11956, 12098, 12099, 12100,
+    12814, 12097, 12958, 12241, 12242, 13102, 12385, 12386, 13533, 13534, 13677, 13678,
+    12961, 14109, 14110, 13105, 12529, 12530, 12673, 12674, 12675, 12817, 12818, 12819,
+    12243, 12244, 12387, 12388, 12389, 12531, 12532, 12533, 11957, 11958, 12101, 12102,
+    12103, 12245, 12246, 12247, 11671, 11672, 11815, 11816, 11817, 11959, 11960, 11961,
+    11385, 11386, 11529, 11530, 11531, 11673, 11674, 11675, 11099, 11100, 11243, 11244,
+    11245, 11387, 11388, 11389, 10813, 10814, 10957, 10958, 10959, 11101, 11102, 11103,
+    10527, 10528, 10671, 10672, 10673, 10815, 10816, 10817, 9953, 9954, 10097, 10098,
+    10099, 10529, 10530, 10531, 9667, 9668, 9811, 9812, 9813, 9955, 9956, 9957,
+    9381, 9382, 9525, 9526, 9529, 9669, 9670, 9673, 9097, 9098, 9241, 9242,
+    9243, 9385, 9386, 9387, 8811, 8812, 8955, 8956, 8957, 9099, 9100, 9101,
+    8525, 8526, 8669, 8670, 8671, 8813, 8814, 8815, 8239, 8240, 8383, 8384,
+    8385, 8527, 8528, 8529, 7953, 7954, 8097, 8098, 8099, 8241, 8242, 8243,
+    7667, 7668, 7811, 7812, 7813, 7955, 7956, 7957, 7381, 7382, 7525, 7526,
+    7527, 7669, 7670, 7671, 7095, 7096, 7239, 7240, 7241, 7383, 7384, 7385,
+    6521, 6522, 6665, 6666, 6667, 7097, 7098, 7099, 6235, 6236, 6379, 6380,
+    6381, 6523, 6524, 6525, 5949, 5950, 6093, 6094, 6097, 6237, 6238, 6241,
+    5665, 5666, 5809, 5810, 5811, 5953, 5954, 5955, 5379, 5380, 5523, 5524,
+    5525, 5667, 5668, 5669, 5093, 5094, 5237, 5238, 5239, 5381, 5382, 5383,
+    4807, 4808, 4951, 4952, 4953, 5095, 5096, 5097, 4521, 4522, 4665, 4666,
+    4667, 4809, 4810, 4811, 4235, 4236, 4379, 4380, 4381, 4523, 4524, 4525,
+    3949, 3950, 4093, 4094, 4095, 4237, 4238, 4239, 3663, 3664, 3807, 3808,
+    3809, 3951, 3952, 3953, 3089, 3090, 3233, 3234, 3235, 3665, 3666, 3667,
+    2803, 2804, 2947, 2948, 2949, 3091, 3092, 3093, 2517, 2518, 2661, 2662,
+    2665, 2805, 2806, 2809, 2233, 2234, 2377, 2378, 2379, 2521, 2522, 2523,
+    1947, 1948, 2091, 2092, 2093, 2235, 2236, 2237, 1661, 1662, 1805, 1806,
+    1807, 1949, 1950, 1951, 1375, 1376, 1519, 1520, 1521, 1663, 1664, 1665,
+    1089, 1090, 1233, 1234, 1235, 1377, 1378, 1379, 803, 804, 947, 948,
+    949, 1091, 1092, 1093, 517, 518, 661, 662, 663, 805, 806, 807,
+    231, 232, 375, 376, 377, 519, 520, 521, 20397, 20398, 20541, 20542,
+    20545, 233, 234, 235, 20546, 20547, 236, 237, 238, 380, 381, 382,
+    378, 379, 522, 523, 524, 666, 667, 668, 664, 665, 808, 809,
+    810, 952, 953, 954, 950, 951, 1094, 1095, 1096, 1238, 1239, 1240,
+    1236, 1237, 1380, 1381, 1382, 1524, 1525, 1526, 1522, 1523, 1666, 1667,
+    1668, 1810, 1811, 1812, 1808, 1809, 1952, 1953, 1954, 2096, 2097, 2098,
+    2094, 2095, 2238, 2239, 2240, 2382, 2383, 2384, 2380, 2381, 2524, 2525,
+    2526, 2668, 2669, 2670, 2666, 2667, 2810, 2811, 2812, 2954, 2955, 2956,
+    2950, 2953, 3094, 3097, 3098, 3238, 3241, 3242, 3236, 3237, 3668, 3669,
+    3670, 3812, 3813, 3814, 3810, 3811, 3954, 3955, 3956, 4098, 4099, 4100,
+    4096, 4097, 4240, 4241, 4242, 4384, 4385, 4386, 4382, 4383, 4526, 4527,
+    4528, 4670, 4671, 4672, 4668, 4669, 4812, 4813, 4814, 4956, 4957, 4958,
+    4954, 4955, 5098, 5099, 5100, 5242, 5243, 5244, 5240, 5241, 5384, 5385,
+    5386, 5528, 5529, 5530, 5526, 5527, 5670, 5671, 5672, 5814, 5815, 5816,
+    5812, 5813, 5956, 5957, 5958, 6100, 6101, 6102, 6098, 6099, 6242, 6243,
+    6244, 6386, 6387, 6388, 6382, 6385, 6526, 6529, 6530, 6670, 6673, 6674,
+    6668, 6669, 7100, 7101, 7102, 7244, 7245, 7246, 7242, 7243, 7386, 7387,
+    7388, 7530, 7531, 7532, 7528, 7529, 7672, 7673, 7674, 7816, 7817, 7818,
+    7814, 7815, 7958, 7959, 7960, 8102, 8103, 8104, 8100, 8101, 8244, 8245,
+    8246, 8388, 8389, 8390, 8386, 8387, 8530, 8531, 8532, 8674, 8675, 8676,
+    8672, 8673, 8816, 8817, 8818, 8960, 8961, 8962, 8958, 8959, 9102, 9103,
+    9104, 9246, 9247, 9248, 9244, 9245, 9388, 9389, 9390, 9532, 9533, 9534,
+    9530, 9531, 9674, 9675, 9676, 9818, 9819, 9820, 9814, 9817, 9958, 9961,
+    9962, 10102, 10105, 10106, 10100, 10101, 10532, 10533, 10534, 10676, 10677, 10678,
+    10674, 10675, 10818, 10819, 10820, 10962, 10963, 10964, 10960, 10961, 11104, 11105,
+    11106, 11248, 11249, 11250, 11246, 11247, 11390, 11391, 11392, 11534, 11535, 11536,
+    11532, 11533, 11676, 11677, 11678, 11820, 11821, 11822, 11818, 11819, 11962, 11963,
+    11964, 12106, 12107, 12108, 12104, 12105, 12248, 12249, 12250, 12392, 12393, 12394,
+    12390, 12391, 12534, 12535, 12536, 12678, 12679, 12680, 12676, 12677, 12820, 12821,
+    12822, 12964, 12965, 12966, 12962, 12963, 13106, 13107, 13108, 13250, 13251, 13252,
+    14254, 13249, 14398, 13393, 13394, 14542, 13537, 13538, 14973, 14974, 15117, 15118,
+    14401, 15261, 15262, 14545, 13969, 13970, 14113, 14114, 14115, 14257, 14258, 14259,
+    13395, 13396, 13539, 13540, 13541, 13971, 13972, 13973, 13109, 13110, 13253, 13254,
+    13255, 13397, 13398, 13399, 12823, 12824, 12967, 12968, 12969, 13111, 13112, 13113,
+    12537, 12538, 12681, 12682, 12683, 12825, 12826, 12827, 12251, 12252, 12395, 12396,
+    12397, 12539, 12540, 12541, 11965, 11966, 12109, 12110, 12111, 12253, 12254, 12255,
+    11679, 11680, 11823, 11824, 11825, 11967, 11968, 11969, 11393, 11394, 11537, 11538,
+    11539, 11681, 11682, 11683, 11107, 11108, 11251, 11252, 11253, 11395, 11396, 11397,
+    10821, 10822, 10965, 10966, 10969, 11109, 11110, 11113, 10537, 10538, 10681, 10682,
+    10683, 10825, 10826, 10827, 9963, 9964, 10107, 10108, 10109, 10539, 10540, 10541,
+    9677, 9678, 9821, 9822, 9823, 9965, 9966, 9967, 9391, 9392, 9535, 9536,
+    9537, 9679, 9680, 9681, 9105, 9106, 9249, 9250, 9251, 9393, 9394, 9395,
+    8819, 8820, 8963, 8964, 8965, 9107, 9108, 9109, 8533, 8534, 8677, 8678,
+    8679, 8821, 8822, 8823, 8247, 8248, 8391, 8392, 8393, 8535, 8536, 8537,
+    7961, 7962, 8105, 8106, 8107, 8249, 8250, 8251, 7675, 7676, 7819, 7820,
+    7821, 7963, 7964, 7965, 7389, 7390, 7533, 7534, 7537, 7677, 7678, 7681,
+    7105, 7106, 7249, 7250, 7251, 7393, 7394, 7395, 6531, 6532, 6675, 6676,
+    6677, 7107, 7108, 7109, 6245, 6246, 6389, 6390, 6391, 6533, 6534, 6535,
+    5959, 5960, 6103, 6104, 6105, 6247, 6248, 6249, 5673, 5674, 5817, 5818,
+    5819, 5961, 5962, 5963, 5387, 5388, 5531, 5532, 5533, 5675, 5676, 5677,
+    5101, 5102, 5245, 5246, 5247, 5389, 5390, 5391, 4815, 4816, 4959, 4960,
+    4961, 5103, 5104, 5105, 4529, 4530, 4673, 4674, 4675, 4817, 4818, 4819,
+    4243, 4244, 4387, 4388, 4389, 4531, 4532, 4533, 3957, 3958, 4101, 4102,
+    4105, 4245, 4246, 4249, 3673, 3674, 3817, 3818, 3819, 3961, 3962, 3963,
+    3099, 3100, 3243, 3244, 3245, 3675, 3676, 3677, 2813, 2814, 2957, 2958,
+    2959, 3101, 3102, 3103, 2527, 2528, 2671, 2672, 2673, 2815, 2816, 2817,
+    2241, 2242, 2385, 2386, 2387, 2529, 2530, 2531, 1955, 1956, 2099, 2100,
+    2101, 2243, 2244, 2245, 1669, 1670, 1813, 1814, 1815, 1957, 1958, 1959,
+    1383, 1384, 1527, 1528, 1529, 1671, 1672, 1673, 1097, 1098, 1241, 1242,
+    1243, 1385, 1386, 1387, 811, 812, 955, 956, 957, 1099, 1100, 1101,
+    525, 526, 669, 670, 673, 813, 814, 817, 241, 242, 385, 386,
+    387, 529, 530, 531, 20407, 20408, 20551, 20552, 20553, 243, 244, 245,
+    20554, 20555, 246, 247, 248, 390, 391, 392, 388, 389, 532, 533,
+    534, 676, 677, 678, 674, 675, 818, 819, 820, 962, 963, 964,
+    958, 961, 1102, 1105, 1106, 1246, 1249, 1250, 1244, 1245, 1388, 1389,
+    1390, 1532, 1533, 1534, 1530, 1531, 1674, 1675, 1676, 1818, 1819, 1820,
+    1816, 1817, 1960, 1961, 1962, 2104, 2105, 2106, 2102, 2103, 2246, 2247,
+    2248, 2390, 2391, 2392, 2388, 2389, 2532, 2533, 2534, 2676, 2677, 2678,
+    2674, 2675, 2818, 2819, 2820, 2962, 2963, 2964, 2960, 2961, 3104, 3105,
+    3106, 3248, 3249, 3250, 3246, 3247, 3678, 3679, 3680, 3822, 3823, 3824,
+    3820, 3821, 3964, 3965, 3966, 4108, 4109, 4110, 4106, 4107, 4250, 4251,
+    4252, 4394, 4395, 4396, 4390, 4393, 4534, 4537, 4538, 4678, 4681, 4682,
+    4676, 4677, 4820, 4821, 4822, 4964, 4965, 4966, 4962, 4963, 5106, 5107,
+    5108, 5250, 5251, 5252, 5248, 5249, 5392, 5393, 5394, 5536, 5537, 5538,
+    5534, 5535, 5678, 5679, 5680, 5822, 5823, 5824, 5820, 5821, 5964, 5965,
+    5966, 6108, 6109, 6110, 6106, 6107, 6250, 6251, 6252, 6394, 6395, 6396,
+    6392, 6393, 6536, 6537, 6538, 6680, 6681, 6682, 6678, 6679, 7110, 7111,
+    7112, 7254, 7255, 7256, 7252, 7253, 7396, 7397, 7398, 7540, 7541, 7542,
+    7538, 7539, 7682, 7683, 7684, 7826, 7827, 7828, 7822, 7825, 7966, 7969,
+    7970, 8110, 8113, 8114, 8108, 8109, 8252, 8253, 8254, 8396, 8397, 8398,
+    8394, 8395, 8538, 8539, 8540, 8682, 8683, 8684, 8680, 8681, 8824, 8825,
+    8826, 8968, 8969, 8970, 8966, 8967, 9110, 9111, 9112, 9254, 9255, 9256,
+    9252, 9253, 9396, 9397, 9398, 9540, 9541, 9542, 9538, 9539, 9682, 9683,
+    9684, 9826, 9827, 9828, 9824, 9825, 9968, 9969, 9970, 10112, 10113, 10114,
+    10110, 10111, 10542, 10543, 10544, 10686, 10687, 10688, 10684, 10685, 10828, 10829,
+    10830, 10972, 10973, 10974, 10970, 10971, 11114, 11115, 11116, 11258, 11259, 11260,
+    11254, 11257, 11398, 11401, 11402, 11542, 11545, 11546, 11540, 11541, 11684, 11685,
+    11686, 11828, 11829, 11830, 11826, 11827, 11970, 11971, 11972, 12114, 12115, 12116,
+    12112, 12113, 12256, 12257, 12258, 12400, 12401, 12402, 12398, 12399, 12542, 12543,
+    12544, 12686, 12687, 12688, 12684, 12685, 12828, 12829, 12830, 12972, 12973, 12974,
+    12970, 12971, 13114, 13115, 13116, 13258, 13259, 13260, 13256, 13257, 13400, 13401,
+    13402, 13544, 13545, 13546, 13542, 13543, 13974, 13975, 13976, 14118, 14119, 14120,
+    14116, 14117, 14260, 14261, 14262, 14404, 14405, 14406, 14402, 14403, 14546, 14547,
+    14548, 14690, 14691, 14692, 15406, 14689, 15550, 14833, 14834, 15694, 14977, 14978,
+    16125, 16126, 16269, 16270, 15553, 16413, 16414, 15697, 15121, 15122, 15265, 15266,
+    15267, 15409, 15410, 15411, 14835, 14836, 14979, 14980, 14981, 15123, 15124, 15125,
+    14549, 14550, 14693, 14694, 14695, 14837, 14838, 14839, 14263, 14264, 14407, 14408,
+    14409, 14551, 14552, 14553, 13977, 13978, 14121, 14122, 14123, 14265, 14266, 14267,
+    13403, 13404, 13547, 13548, 13549, 13979, 13980, 13981, 13117, 13118, 13261, 13262,
+    13263, 13405, 13406, 13407, 12831, 12832, 12975, 12976, 12977, 13119, 13120, 13121,
+    12545, 12546, 12689, 12690, 12691, 12833, 12834, 12835, 12259, 12260, 12403, 12404,
+    12405, 12547, 12548, 12549, 11973, 11974, 12117, 12118, 12121, 12261, 12262, 12265,
+    11689, 11690, 11833, 11834, 11835, 11977, 11978, 11979, 11403, 11404, 11547, 11548,
+    11549, 11691, 11692, 11693, 11117, 11118, 11261, 11262, 11263, 11405, 11406, 11407,
+    10831, 10832, 10975, 10976, 10977, 11119, 11120, 11121, 10545, 10546, 10689, 10690,
+    10691, 10833, 10834, 10835, 9971, 9972, 10115, 10116, 10117, 10547, 10548, 10549,
+    9685, 9686, 9829, 9830, 9831, 9973, 9974, 9975, 9399, 9400, 9543, 9544,
+    9545, 9687, 9688, 9689, 9113, 9114, 9257, 9258, 9259, 9401, 9402, 9403,
+    8827, 8828, 8971, 8972, 8973, 9115, 9116, 9117, 8541, 8542, 8685, 8686,
+    8689, 8829, 8830, 8833, 8257, 8258, 8401, 8402, 8403, 8545, 8546, 8547,
+    7971, 7972, 8115, 8116, 8117, 8259, 8260, 8261, 7685, 7686, 7829, 7830,
+    7831, 7973, 7974, 7975, 7399, 7400, 7543, 7544, 7545, 7687, 7688, 7689,
+    7113, 7114, 7257, 7258, 7259, 7401, 7402, 7403, 6539, 6540, 6683, 6684,
+    6685, 7115, 7116, 7117, 6253, 6254, 6397, 6398, 6399, 6541, 6542, 6543,
+    5967, 5968, 6111, 6112, 6113, 6255, 6256, 6257, 5681, 5682, 5825, 5826,
+    5827, 5969, 5970, 5971, 5395, 5396, 5539, 5540, 5541, 5683, 5684, 5685,
+    5109, 5110, 5253, 5254, 5257, 5397, 5398, 5401, 4825, 4826, 4969, 4970,
+    4971, 5113, 5114, 5115, 4539, 4540, 4683, 4684, 4685, 4827, 4828, 4829,
+    4253, 4254, 4397, 4398, 4399, 4541, 4542, 4543, 3967, 3968, 4111, 4112,
+    4113, 4255, 4256, 4257, 3681, 3682, 3825, 3826, 3827, 3969, 3970, 3971,
+    3107, 3108, 3251, 3252, 3253, 3683, 3684, 3685, 2821, 2822, 2965, 2966,
+    2967, 3109, 3110, 3111, 2535, 2536, 2679, 2680, 2681, 2823, 2824, 2825,
+    2249, 2250, 2393, 2394, 2395, 2537, 2538, 2539, 1963, 1964, 2107, 2108,
+    2109, 2251, 2252, 2253, 1677, 1678, 1821, 1822, 1825, 1965, 1966, 1969,
+    1393, 1394, 1537, 1538, 1539, 1681, 1682, 1683, 1107, 1108, 1251, 1252,
+    1253, 1395, 1396, 1397, 821, 822, 965, 966, 967, 1109, 1110, 1111,
+    535, 536, 679, 680, 681, 823, 824, 825, 249, 250, 393, 394,
+    395, 537, 538, 539, 20415, 20416, 20559, 20560, 20561, 251, 252, 253,
+    20562, 20563, 254, 255, 256, 398, 399, 400, 396, 397, 540, 541,
+    542, 684, 685, 686, 682, 683, 826, 827, 828, 970, 971, 972,
+    968, 969, 1112, 1113, 1114, 1256, 1257, 1258, 1254, 1255, 1398, 1399,
+    1400, 1542, 1543, 1544, 1540, 1541, 1684, 1685, 1686, 1828, 1829, 1830,
+    1826, 1827, 1970, 1971, 1972, 2114, 2115, 2116, 2110, 2113, 2254, 2257,
+    2258, 2398, 2401, 2402, 2396, 2397, 2540, 2541, 2542, 2684, 2685, 2686,
+    2682, 2683, 2826, 2827, 2828, 2970, 2971, 2972, 2968, 2969, 3112, 3113,
+    3114, 3256, 3257, 3258, 3254, 3255, 3686, 3687, 3688, 3830, 3831, 3832,
+    3828, 3829, 3972, 3973, 3974, 4116, 4117, 4118, 4114, 4115, 4258, 4259,
+    4260, 4402, 4403, 4404, 4400, 4401, 4544, 4545, 4546, 4688, 4689, 4690,
+    4686, 4687, 4830, 4831, 4832, 4974, 4975, 4976, 4972, 4973, 5116, 5117,
+    5118, 5260, 5261, 5262, 5258, 5259, 5402, 5403, 5404, 5546, 5547, 5548,
+    5542, 5545, 5686, 5689, 5690, 5830, 5833, 5834, 5828, 5829, 5972, 5973,
+    5974, 6116, 6117, 6118, 6114, 6115, 6258, 6259, 6260, 6402, 6403, 6404,
+    6400, 6401, 6544, 6545, 6546, 6688, 6689, 6690, 6686, 6687, 7118, 7119,
+    7120, 7262, 7263, 7264, 7260, 7261, 7404, 7405, 7406, 7548, 7549, 7550,
+    7546, 7547, 7690, 7691, 7692, 7834, 7835, 7836, 7832, 7833, 7976, 7977,
+    7978, 8120, 8121, 8122, 8118, 8119, 8262, 8263, 8264, 8406, 8407, 8408,
+    8404, 8405, 8548, 8549, 8550, 8692, 8693, 8694, 8690, 8691, 8834, 8835,
+    8836, 8978, 8979, 8980, 8974, 8977, 9118, 9121, 9122, 9262, 9265, 9266,
+    9260, 9261, 9404, 9405, 9406, 9548, 9549, 9550, 9546, 9547, 9690, 9691,
+    9692, 9834, 9835, 9836, 9832, 9833, 9976, 9977, 9978, 10120, 10121, 10122,
+    10118, 10119, 10550, 10551, 10552, 10694, 10695, 10696, 10692, 10693, 10836, 10837,
+    10838, 10980, 10981, 10982, 10978, 10979, 11122, 11123, 11124, 11266, 11267, 11268,
+    11264, 11265, 11408, 11409, 11410, 11552, 11553, 11554, 11550, 11551, 11694, 11695,
+    11696, 11838, 11839, 11840, 11836, 11837, 11980, 11981, 11982, 12124, 12125, 12126,
+    12122, 12123, 12266, 12267, 12268, 12410, 12411, 12412, 12406, 12409, 12550, 12553,
+    12554, 12694, 12697, 12698, 12692, 12693, 12836, 12837, 12838, 12980, 12981, 12982,
+    12978, 12979, 13122, 13123, 13124, 13266, 13267, 13268, 13264, 13265, 13408, 13409,
+    13410, 13552, 13553, 13554, 13550, 13551, 13982, 13983, 13984, 14126, 14127, 14128,
+    14124, 14125, 14268, 14269, 14270, 14412, 14413, 14414, 14410, 14411, 14554, 14555,
+    14556, 14698, 14699, 14700, 14696, 14697, 14840, 14841, 14842, 14984, 14985, 14986,
+    14982, 14983, 15126, 15127, 15128, 15270, 15271, 15272, 15268, 15269, 15412, 15413,
+    15414, 15556, 15557, 15558, 15554, 15555, 15698, 15699, 15700, 15842, 15843, 15844,
+    16558, 15841, 16702, 15985, 15986, 16846, 16129, 16130, 17565, 17566, 17709, 17710,
+    16705, 17853, 17854, 16849, 16273, 16274, 16417, 16418, 16419, 16561, 16562, 16563,
+    15987, 15988, 16131, 16132, 16133, 16275, 16276, 16277, 15701, 15702, 15845, 15846,
+    15847, 15989, 15990, 15991, 15415, 15416, 15559, 15560, 15561, 15703, 15704, 15705,
+    15129, 15130, 15273, 15274, 15275, 15417, 15418, 15419, 14843, 14844, 14987, 14988,
+    14989, 15131, 15132, 15133, 14557, 14558, 14701, 14702, 14703, 14845, 14846, 14847,
+    14271, 14272, 14415, 14416, 14417, 14559, 14560, 14561, 13985, 13986, 14129, 14130,
+    14131, 14273, 14274, 14275, 13411, 13412, 13555, 13556, 13557, 13987, 13988, 13989,
+    13125, 13126, 13269, 13270, 13273, 13413, 13414, 13417, 12841, 12842, 12985, 12986,
+    12987, 13129, 13130, 13131, 12555, 12556, 12699, 12700, 12701, 12843, 12844, 12845,
+    12269, 12270, 12413, 12414, 12415, 12557, 12558, 12559, 11983, 11984, 12127, 12128,
+    12129, 12271, 12272, 12273, 11697, 11698, 11841, 11842, 11843, 11985, 11986, 11987,
+    11411, 11412, 11555, 11556, 11557, 11699, 11700, 11701, 11125, 11126, 11269, 11270,
+    11271, 11413, 11414, 11415, 10839, 10840, 10983, 10984, 10985, 11127, 11128, 11129,
+    10553, 10554, 10697, 10698, 10699, 10841, 10842, 10843, 9979, 9980, 10123, 10124,
+    10125, 10555, 10556, 10557, 9693, 9694, 9837, 9838, 9841, 9981, 9982, 9985,
+    9409, 9410, 9553, 9554, 9555, 9697, 9698, 9699, 9123, 9124, 9267, 9268,
+    9269, 9411, 9412, 9413, 8837, 8838, 8981, 8982, 8983, 9125, 9126, 9127,
+    8551, 8552, 8695, 8696, 8697, 8839, 8840, 8841, 8265, 8266, 8409, 8410,
+    8411, 8553, 8554, 8555, 7979, 7980, 8123, 8124, 8125, 8267, 8268, 8269,
+    7693, 7694, 7837, 7838, 7839, 7981, 7982, 7983, 7407, 7408, 7551, 7552,
+    7553, 7695, 7696, 7697, 7121, 7122, 7265, 7266, 7267, 7409, 7410, 7411,
+    6547, 6548, 6691, 6692, 6693, 7123, 7124, 7125, 6261, 6262, 6405, 6406,
+    6409, 6549, 6550, 6553, 5977, 5978, 6121, 6122, 6123, 6265, 6266, 6267,
+    5691, 5692, 5835, 5836, 5837, 5979, 5980, 5981, 5405, 5406, 5549, 5550,
+    5551, 5693, 5694, 5695, 5119, 5120, 5263, 5264, 5265, 5407, 5408, 5409,
+    4833, 4834, 4977, 4978, 4979, 5121, 5122, 5123, 4547, 4548, 4691, 4692,
+    4693, 4835, 4836, 4837, 4261, 4262, 4405, 4406, 4407, 4549, 4550, 4551,
+    3975, 3976, 4119, 4120, 4121, 4263, 4264, 4265, 3689, 3690, 3833, 3834,
+    3835, 3977, 3978, 3979, 3115, 3116, 3259, 3260, 3261, 3691, 3692, 3693,
+    2829, 2830, 2973, 2974, 2977, 3117, 3118, 3121, 2545, 2546, 2689, 2690,
+    2691, 2833, 2834, 2835, 2259, 2260, 2403, 2404, 2405, 2547, 2548, 2549,
+    1973, 1974, 2117, 2118, 2119, 2261, 2262, 2263, 1687, 1688, 1831, 1832,
+    1833, 1975, 1976, 1977, 1401, 1402, 1545, 1546, 1547, 1689, 1690, 1691,
+    1115, 1116, 1259, 1260, 1261, 1403, 1404, 1405, 829, 830, 973, 974,
+    975, 1117, 1118, 1119, 543, 544, 687, 688, 689, 831, 832, 833,
+    257, 258, 401, 402, 403, 545, 546, 547, 20425, 20426, 20569, 20570,
+    20571, 259, 260, 261, 20572, 20573, 262, 265, 266, 406, 409, 410,
+    404, 405, 548, 549, 550, 692, 693, 694, 690, 691, 834, 835,
+    836, 978, 979, 980, 976, 977, 1120, 1121, 1122, 1264, 1265, 1266,
+    1262, 1263, 1406, 1407, 1408, 1550, 1551, 1552, 1548, 1549, 1692, 1693,
+    1694, 1836, 1837, 1838, 1834, 1835, 1978, 1979, 1980, 2122, 2123, 2124,
+    2120, 2121, 2264, 2265, 2266, 2408, 2409, 2410, 2406, 2407, 2550, 2551,
+    2552, 2694, 2695, 2696, 2692, 2693, 2836, 2837, 2838, 2980, 2981, 2982,
+    2978, 2979, 3122, 3123, 3124, 3266, 3267, 3268, 3262, 3265, 3694, 3697,
+    3698, 3838, 3841, 3842, 3836, 3837, 3980, 3981, 3982, 4124, 4125, 4126,
+    4122, 4123, 4266, 4267, 4268, 4410, 4411, 4412, 4408, 4409, 4552, 4553,
+    4554, 4696, 4697, 4698, 4694, 4695, 4838, 4839, 4840, 4982, 4983, 4984,
+    4980, 4981, 5124, 5125, 5126, 5268, 5269, 5270, 5266, 5267, 5410, 5411,
+    5412, 5554, 5555, 5556, 5552, 5553, 5696, 5697, 5698, 5840, 5841, 5842,
+    5838, 5839, 5982, 5983, 5984, 6126, 6127, 6128, 6124, 6125, 6268, 6269,
+    6270, 6412, 6413, 6414, 6410, 6411, 6554, 6555, 6556, 6698, 6699, 6700,
+    6694, 6697, 7126, 7129, 7130, 7270, 7273, 7274, 7268, 7269, 7412, 7413,
+    7414, 7556, 7557, 7558, 7554, 7555, 7698, 7699, 7700, 7842, 7843, 7844,
+    7840, 7841, 7984, 7985, 7986, 8128, 8129, 8130, 8126, 8127, 8270, 8271,
+    8272, 8414, 8415, 8416, 8412, 8413, 8556, 8557, 8558, 8700, 8701, 8702,
+    8698, 8699, 8842, 8843, 8844, 8986, 8987, 8988, 8984, 8985, 9128, 9129,
+    9130, 9272, 9273, 9274, 9270, 9271, 9414, 9415, 9416, 9558, 9559, 9560,
+    9556, 9557, 9700, 9701, 9702, 9844, 9845, 9846, 9842, 9843, 9986, 9987,
+    9988, 10130, 10131, 10132, 10126, 10129, 10558, 10561, 10562, 10702, 10705, 10706,
+    10700, 10701, 10844, 10845, 10846, 10988, 10989, 10990, 10986, 10987, 11130, 11131,
+    11132, 11274, 11275, 11276, 11272, 11273, 11416, 11417, 11418, 11560, 11561, 11562,
+    11558, 11559, 11702, 11703, 11704, 11846, 11847, 11848, 11844, 11845, 11988, 11989,
+    11990, 12132, 12133, 12134, 12130, 12131, 12274, 12275, 12276, 12418, 12419, 12420,
+    12416, 12417, 12560, 12561, 12562, 12704, 12705, 12706, 12702, 12703, 12846, 12847,
+    12848, 12990, 12991, 12992, 12988, 12989, 13132, 13133, 13134, 13276, 13277, 13278,
+    13274, 13275, 13418, 13419, 13420, 13562, 13563, 13564, 13558, 13561, 13990, 13993,
+    13994, 14134, 14137, 14138, 14132, 14133, 14276, 14277, 14278, 14420, 14421, 14422,
+    14418, 14419, 14562, 14563, 14564, 14706, 14707, 14708, 14704, 14705, 14848, 14849,
+    14850, 14992, 14993, 14994, 14990, 14991, 15134, 15135, 15136, 15278, 15279, 15280,
+    15276, 15277, 15420, 15421, 15422, 15564, 15565, 15566, 15562, 15563, 15706, 15707,
+    15708, 15850, 15851, 15852, 15848, 15849, 15992, 15993, 15994, 16136, 16137, 16138,
+    16134, 16135, 16278, 16279, 16280, 16422, 16423, 16424, 16420, 16421, 16564, 16565,
+    16566, 16708, 16709, 16710, 16706, 16707, 16850, 16851, 16852, 16994, 16995, 16996,
+    17998, 16993, 18142, 17425, 17426, 18286, 17569, 17570, 18717, 18718, 18861, 18862,
+    18145, 19005, 19006, 18289, 17713, 17714, 17857, 17858, 17859, 18001, 18002, 18003,
+    17427, 17428, 17571, 17572, 17573, 17715, 17716, 17717, 16853, 16854, 16997, 16998,
+    16999, 17429, 17430, 17431, 16567, 16568, 16711, 16712, 16713, 16855, 16856, 16857,
+    16281, 16282, 16425, 16426, 16427, 16569, 16570, 16571, 15995, 15996, 16139, 16140,
+    16141, 16283, 16284, 16285, 15709, 15710, 15853, 15854, 15855, 15997, 15998, 15999,
+    15423, 15424, 15567, 15568, 15569, 15711, 15712, 15713, 15137, 15138, 15281, 15282,
+    15283, 15425, 15426, 15427, 14851, 14852, 14995, 14996, 14997, 15139, 15140, 15141,
+    14565, 14566, 14709, 14710, 14713, 14853, 14854, 14857, 14281, 14282, 14425, 14426,
+    14427, 14569, 14570, 14571, 13995, 13996, 14139, 14140, 14141, 14283, 14284, 14285,
+    13421, 13422, 13565, 13566, 13567, 13997, 13998, 13999, 13135, 13136, 13279, 13280,
+    13281, 13423, 13424, 13425, 12849, 12850, 12993, 12994, 12995, 13137, 13138, 13139,
+    12563, 12564, 12707, 12708, 12709, 12851, 12852, 12853, 12277, 12278, 12421, 12422,
+    12423, 12565, 12566, 12567, 11991, 11992, 12135, 12136, 12137, 12279, 12280, 12281,
+    11705, 11706, 11849, 11850, 11851, 11993, 11994, 11995, 11419, 11420, 11563, 11564,
+    11565, 11707, 11708, 11709, 11133, 11134, 11277, 11278, 11281, 11421, 11422, 11425,
+    10849, 10850, 10993, 10994, 10995, 11137, 11138, 11139, 10563, 10564, 10707, 10708,
+    10709, 10851, 10852, 10853, 9989, 9990, 10133, 10134, 10135, 10565, 10566, 10567,
+    9703, 9704, 9847, 9848, 9849, 9991, 9992, 9993, 9417, 9418, 9561, 9562,
+    9563, 9705, 9706, 9707, 9131, 9132, 9275, 9276, 9277, 9419, 9420, 9421,
+    8845, 8846, 8989, 8990, 8991, 9133, 9134, 9135, 8559, 8560, 8703, 8704,
+    8705, 8847, 8848, 8849, 8273, 8274, 8417, 8418, 8419, 8561, 8562, 8563,
+    7987, 7988, 8131, 8132, 8133, 8275, 8276, 8277, 7701, 7702, 7845, 7846,
+    7849, 7989, 7990, 7993, 7417, 7418, 7561, 7562, 7563, 7705, 7706, 7707,
+    7131, 7132, 7275, 7276, 7277, 7419, 7420, 7421, 6557, 6558, 6701, 6702,
+    6703, 7133, 7134, 7135, 6271, 6272, 6415, 6416, 6417, 6559, 6560, 6561,
+    5985, 5986, 6129, 6130, 6131, 6273, 6274, 6275, 5699, 5700, 5843, 5844,
+    5845, 5987, 5988, 5989, 5413, 5414, 5557, 5558, 5559, 5701, 5702, 5703,
+    5127, 5128, 5271, 5272, 5273, 5415, 5416, 5417, 4841, 4842, 4985, 4986,
+    4987, 5129, 5130, 5131, 4555, 4556, 4699, 4700, 4701, 4843, 4844, 4845,
+    4269, 4270, 4413, 4414, 4417, 4557, 4558, 4561, 3985, 3986, 4129, 4130,
+    4131, 4273, 4274, 4275, 3699, 3700, 3843, 3844, 3845, 3987, 3988, 3989,
+    3125, 3126, 3269, 3270, 3271, 3701, 3702, 3703, 2839, 2840, 2983, 2984,
+    2985, 3127, 3128, 3129, 2553, 2554, 2697, 2698, 2699, 2841, 2842, 2843,
+    2267, 2268, 2411, 2412, 2413, 2555, 2556, 2557, 1981, 1982, 2125, 2126,
+    2127, 2269, 2270, 2271, 1695, 1696, 1839, 1840, 1841, 1983, 1984, 1985,
+    1409, 1410, 1553, 1554, 1555, 1697, 1698, 1699, 1123, 1124, 1267, 1268,
+    1269, 1411, 1412, 1413, 837, 838, 981, 982, 985, 1125, 1126, 1129,
+    553, 554, 697, 698, 699, 841, 842, 843, 267, 268, 411, 412,
+    413, 555, 556, 557, 20433, 20434, 20577, 20578, 20579, 269, 270, 271,
+    20580, 20581, 272, 273, 274, 416, 417, 418, 414, 415, 558, 559,
+    560, 702, 703, 704, 700, 701, 844, 845, 846, 988, 989, 990,
+    986, 987, 1130, 1131, 1132, 1274, 1275, 1276, 1270, 1273, 1414, 1417,
+    1418, 1558, 1561, 1562, 1556, 1557, 1700, 1701, 1702, 1844, 1845, 1846,
+    1842, 1843, 1986, 1987, 1988, 2130, 2131, 2132, 2128, 2129, 2272, 2273,
+    2274, 2416, 2417, 2418, 2414, 2415, 2558, 2559, 2560, 2702, 2703, 2704,
+    2700, 2701, 2844, 2845, 2846, 2988, 2989, 2990, 2986, 2987, 3130, 3131,
+    3132, 3274, 3275, 3276, 3272, 3273, 3704, 3705, 3706, 3848, 3849, 3850,
+    3846, 3847, 3990, 3991, 3992, 4134, 4135, 4136, 4132, 4133, 4276, 4277,
+    4278, 4420, 4421, 4422, 4418, 4419, 4562, 4563, 4564, 4706, 4707, 4708,
+    4702, 4705, 4846, 4849, 4850, 4990, 4993, 4994, 4988, 4989, 5132, 5133,
+    5134, 5276, 5277, 5278, 5274, 5275, 5418, 5419, 5420, 5562, 5563, 5564,
+    5560, 5561, 5704, 5705, 5706, 5848, 5849, 5850, 5846, 5847, 5990, 5991,
+    5992, 6134, 6135, 6136, 6132, 6133, 6276, 6277, 6278, 6420, 6421, 6422,
+    6418, 6419, 6562, 6563, 6564, 6706, 6707, 6708, 6704, 6705, 7136, 7137,
+    7138, 7280, 7281, 7282, 7278, 7279, 7422, 7423, 7424, 7566, 7567, 7568,
+    7564, 7565, 7708, 7709, 7710, 7852, 7853, 7854, 7850, 7851, 7994, 7995,
+    7996, 8138, 8139, 8140, 8134, 8137, 8278, 8281, 8282, 8422, 8425, 8426,
+    8420, 8421, 8564, 8565, 8566, 8708, 8709, 8710, 8706, 8707, 8850, 8851,
+    8852, 8994, 8995, 8996, 8992, 8993, 9136, 9137, 9138, 9280, 9281, 9282,
+    9278, 9279, 9422, 9423, 9424, 9566, 9567, 9568, 9564, 9565, 9708, 9709,
+    9710, 9852, 9853, 9854, 9850, 9851, 9994, 9995, 9996, 10138, 10139, 10140,
+    10136, 10137, 10568, 10569, 10570, 10712, 10713, 10714, 10710, 10711, 10854, 10855,
+    10856, 10998, 10999, 11000, 10996, 10997, 11140, 11141, 11142, 11284, 11285, 11286,
+    11282, 11283, 11426, 11427, 11428, 11570, 11571, 11572, 11566, 11569, 11710, 11713,
+    11714, 11854, 11857, 11858, 11852, 11853, 11996, 11997, 11998, 12140, 12141, 12142,
+    12138, 12139, 12282, 12283, 12284, 12426, 12427, 12428, 12424, 12425, 12568, 12569,
+    12570, 12712, 12713, 12714, 12710, 12711, 12854, 12855, 12856, 12998, 12999, 13000,
+    12996, 12997, 13140, 13141, 13142, 13284, 13285, 13286, 13282, 13283, 13426, 13427,
+    13428, 13570, 13571, 13572, 13568, 13569, 14000, 14001, 14002, 14144, 14145, 14146,
+    14142, 14143, 14286, 14287, 14288, 14430, 14431, 14432, 14428, 14429, 14572, 14573,
+    14574, 14716, 14717, 14718, 14714, 14715, 14858, 14859, 14860, 15002, 15003, 15004,
+    14998, 15001, 15142, 15145, 15146, 15286, 15289, 15290, 15284, 15285, 15428, 15429,
+    15430, 15572, 15573, 15574, 15570, 15571, 15714, 15715, 15716, 15858, 15859, 15860,
+    15856, 15857, 16000, 16001, 16002, 16144, 16145, 16146, 16142, 16143, 16286, 16287,
+    16288, 16430, 16431, 16432, 16428, 16429, 16572, 16573, 16574, 16716, 16717, 16718,
+    16714, 16715, 16858, 16859, 16860, 17002, 17003, 17004, 17000, 17001, 17432, 17433,
+    17434, 17576, 17577, 17578, 17574, 17575, 17718, 17719, 17720, 17862, 17863, 17864,
+    17860, 17861, 18004, 18005, 18006, 18148, 18149, 18150, 18146, 18147, 18290, 18291,
+    18292, 18434, 18435, 18436, 19150, 18433, 19294, 18577, 18578, 19438, 18721, 18722,
+    19869, 19870, 20013, 20014, 19297, 20157, 20158, 19441, 18865, 18866, 19009, 19010,
+    19011, 19153, 19154, 19155, 18579, 18580, 18723, 18724, 18725, 18867, 18868, 18869,
+    18293, 18294, 18437, 18438, 18439, 18581, 18582, 18583, 18007, 18008, 18151, 18152,
+    18153, 18295, 18296, 18297, 17721, 17722, 17865, 17866, 17867, 18009, 18010, 18011,
+    17435, 17436, 17579, 17580, 17581, 17723, 17724, 17725, 16861, 16862, 17005, 17006,
+    17007, 17437, 17438, 17439, 16575, 16576, 16719, 16720, 16721, 16863, 16864, 16865,
+    16289, 16290, 16433, 16434, 16435, 16577, 16578, 16579, 16003, 16004, 16147, 16148,
+    16149, 16291, 16292, 16293, 15717, 15718, 15861, 15862, 15865, 16005, 16006, 16009,
+    15433, 15434, 15577, 15578, 15579, 15721, 15722, 15723, 15147, 15148, 15291, 15292,
+    15293, 15435, 15436, 15437, 14861, 14862, 15005, 15006, 15007, 15149, 15150, 15151,
+    14575, 14576, 14719, 14720, 14721, 14863, 14864, 14865, 14289, 14290, 14433, 14434,
+    14435, 14577, 14578, 14579, 14003, 14004, 14147, 14148, 14149, 14291, 14292, 14293,
+    13429, 13430, 13573, 13574, 13575, 14005, 14006, 14007, 13143, 13144, 13287, 13288,
+    13289, 13431, 13432, 13433, 12857, 12858, 13001, 13002, 13003, 13145, 13146, 13147,
+    12571, 12572, 12715, 12716, 12717, 12859, 12860, 12861, 12285, 12286, 12429, 12430,
+    12433, 12573, 12574, 12577, 12001, 12002, 12145, 12146, 12147, 12289, 12290, 12291,
+    11715, 11716, 11859, 11860, 11861, 12003, 12004, 12005, 11429, 11430, 11573, 11574,
+    11575, 11717, 11718, 11719, 11143, 11144, 11287, 11288, 11289, 11431, 11432, 11433,
+    10857, 10858, 11001, 11002, 11003, 11145, 11146, 11147, 10571, 10572, 10715, 10716,
+    10717, 10859, 10860, 10861, 9997, 9998, 10141, 10142, 10143, 10573, 10574, 10575,
+    9711, 9712, 9855, 9856, 9857, 9999, 10000, 10001, 9425, 9426, 9569, 9570,
+    9571, 9713, 9714, 9715, 9139, 9140, 9283, 9284, 9285, 9427, 9428, 9429,
+    8853, 8854, 8997, 8998, 9001, 9141, 9142, 9145, 8569, 8570, 8713, 8714,
+    8715, 8857, 8858, 8859, 8283, 8284, 8427, 8428, 8429, 8571, 8572, 8573,
+    7997, 7998, 8141, 8142, 8143, 8285, 8286, 8287, 7711, 7712, 7855, 7856,
+    7857, 7999, 8000, 8001, 7425, 7426, 7569, 7570, 7571, 7713, 7714, 7715,
+    7139, 7140, 7283, 7284, 7285, 7427, 7428, 7429, 6565, 6566, 6709, 6710,
+    6711, 7141, 7142, 7143, 6279, 6280, 6423, 6424, 6425, 6567, 6568, 6569,
+    5993, 5994, 6137, 6138, 6139, 6281, 6282, 6283, 5707, 5708, 5851, 5852,
+    5853, 5995, 5996, 5997, 5421, 5422, 5565, 5566, 5569, 5709, 5710, 5713,
+    5137, 5138, 5281, 5282, 5283, 5425, 5426, 5427, 4851, 4852, 4995, 4996,
+    4997, 5139, 5140, 5141, 4565, 4566, 4709, 4710, 4711, 4853, 4854, 4855,
+    4279, 4280, 4423, 4424, 4425, 4567, 4568, 4569, 3993, 3994, 4137, 4138,
+    4139, 4281, 4282, 4283, 3707, 3708, 3851, 3852, 3853, 3995, 3996, 3997,
+    3133, 3134, 3277, 3278, 3279, 3709, 3710, 3711, 2847, 2848, 2991, 2992,
+    2993, 3135, 3136, 3137, 2561, 2562, 2705, 2706, 2707, 2849, 2850, 2851,
+    2275, 2276, 2419, 2420, 2421, 2563, 2564, 2565, 1989, 1990, 2133, 2134,
+    2137, 2277, 2278, 2281, 1705, 1706, 1849, 1850, 1851, 1993, 1994, 1995,
+    1419, 1420, 1563, 1564, 1565, 1707, 1708, 1709, 1133, 1134, 1277, 1278,
+    1279, 1421, 1422, 1423, 847, 848, 991, 992, 993, 1135, 1136, 1137,
+    561, 562, 705, 706, 707, 849, 850, 851, 275, 276, 419, 420,
+    421, 563, 564, 565, 20441, 20442, 20585, 20586, 20587, 277, 278, 279,
+    20588, 20589, 280, 281, 282, 424, 425, 426, 422, 423, 566, 567,
+    568, 710, 711, 712, 708, 709, 852, 853, 854, 996, 997, 998,
+    994, 995, 1138, 1139, 1140, 1282, 1283, 1284, 1280, 1281, 1424, 1425,
+    1426, 1568, 1569, 1570, 1566, 1567, 1710, 1711, 1712, 1854, 1855, 1856,
+    1852, 1853, 1996, 1997, 1998, 2140, 2141, 2142, 2138, 2139, 2282, 2283,
+    2284, 2426, 2427, 2428, 2422, 2425, 2566, 2569, 2570, 2710, 2713, 2714,
+    2708, 2709, 2852, 2853, 2854, 2996, 2997, 2998, 2994, 2995, 3138, 3139,
+    3140, 3282, 3283, 3284, 3280, 3281, 3712, 3713, 3714, 3856, 3857, 3858,
+    3854, 3855, 3998, 3999, 4000, 4142, 4143, 4144, 4140, 4141, 4284, 4285,
+    4286, 4428, 4429, 4430, 4426, 4427, 4570, 4571, 4572, 4714, 4715, 4716,
+    4712, 4713, 4856, 4857, 4858, 5000, 5001, 5002, 4998, 4999, 5142, 5143,
+    5144, 5286, 5287, 5288, 5284, 5285, 5428, 5429, 5430, 5572, 5573, 5574,
+    5570, 5571, 5714, 5715, 5716, 5858, 5859, 5860, 5854, 5857, 5998, 6001,
+    6002, 6142, 6145, 6146, 6140, 6141, 6284, 6285, 6286, 6428, 6429, 6430,
+    6426, 6427, 6570, 6571, 6572, 6714, 6715, 6716, 6712, 6713, 7144, 7145,
+    7146, 7288, 7289, 7290, 7286, 7287, 7430, 7431, 7432, 7574, 7575, 7576,
+    7572, 7573, 7716, 7717, 7718, 7860, 7861, 7862, 7858, 7859, 8002, 8003,
+    8004, 8146, 8147, 8148, 8144, 8145, 8288, 8289, 8290, 8432, 8433, 8434,
+    8430, 8431, 8574, 8575, 8576, 8718, 8719, 8720, 8716, 8717, 8860, 8861,
+    8862, 9004, 9005, 9006, 9002, 9003, 9146, 9147, 9148, 9290, 9291, 9292,
+    9286, 9289, 9430, 9433, 9434, 9574, 9577, 9578, 9572, 9573, 9716, 9717,
+    9718, 9860, 9861, 9862, 9858, 9859, 10002, 10003, 10004, 10146, 10147, 10148,
+    10144, 10145, 10576, 10577, 10578, 10720, 10721, 10722, 10718, 10719, 10862, 10863,
+    10864, 11006, 11007, 11008, 11004, 11005, 11148, 11149, 11150, 11292, 11293, 11294,
+    11290, 11291, 11434, 11435, 11436, 11578, 11579, 11580, 11576, 11577, 11720, 11721,
+    11722, 11864, 11865, 11866, 11862, 11863, 12006, 12007, 12008, 12150, 12151, 12152,
+    12148, 12149, 12292, 12293, 12294, 12436, 12437, 12438, 12434, 12435, 12578, 12579,
+    12580, 12722, 12723, 12724, 12718, 12721, 12862, 12865, 12866, 13006, 13009, 13010,
+    13004, 13005, 13148, 13149, 13150, 13292, 13293, 13294, 13290, 13291, 13434, 13435,
+    13436, 13578, 13579, 13580, 13576, 13577, 14008, 14009, 14010, 14152, 14153, 14154,
+    14150, 14151, 14294, 14295, 14296, 14438, 14439, 14440, 14436, 14437, 14580, 14581,
+    14582, 14724, 14725, 14726, 14722, 14723, 14866, 14867, 14868, 15010, 15011, 15012,
+    15008, 15009, 15152, 15153, 15154, 15296, 15297, 15298, 15294, 15295, 15438, 15439,
+    15440, 15582, 15583, 15584, 15580, 15581, 15724, 15725, 15726, 15868, 15869, 15870,
+    15866, 15867, 16010, 16011, 16012, 16154, 16155, 16156, 16150, 16153, 16294, 16297,
+    16298, 16438, 16441, 16442, 16436, 16437, 16580, 16581, 16582, 16724, 16725, 16726,
+    16722, 16723, 16866, 16867, 16868, 17010, 17011, 17012, 17008, 17009, 17440, 17441,
+    17442, 17584, 17585, 17586, 17582, 17583, 17726, 17727, 17728, 17870, 17871, 17872,
+    17868, 17869, 18012, 18013, 18014, 18156, 18157, 18158, 18154, 18155, 18298, 18299,
+    18300, 18442, 18443, 18444, 18440, 18441, 18584, 18585, 18586, 18728, 18729, 18730,
+    18726, 18727, 18870, 18871, 18872, 19014, 19015, 19016, 19012, 19013, 19156, 19157,
+    19158, 19300, 19301, 19302, 19298, 19299, 19442, 19443, 19444, 19586, 19587, 19588,
+    20302, 19585, 20446, 19729, 19730, 20590, 19873, 19874, 20449, 20450, 20451, 285,
+    286, 430, 574, 718, 20017, 20018, 20161, 20162, 20163, 20305, 20306, 20307,
+    19731, 19732, 19875, 19876, 19877, 20019, 20020, 20021, 19445, 19446, 19589, 19590,
+    19591, 19733, 19734, 19735, 19159, 19160, 19303, 19304, 19305, 19447, 19448, 19449,
+    18873, 18874, 19017, 19018, 19019, 19161, 19162, 19163, 18587, 18588, 18731, 18732,
+    18733, 18875, 18876, 18877, 18301, 18302, 18445, 18446, 18447, 18589, 18590, 18591,
+    18015, 18016, 18159, 18160, 18161, 18303, 18304, 18305, 17729, 17730, 17873, 17874,
+    17875, 18017, 18018, 18019, 17443, 17444, 17587, 17588, 17589, 17731, 17732, 17733,
+    16869, 16870, 17013, 17014, 17017, 17445, 17446, 17449, 16585, 16586, 16729, 16730,
+    16731, 16873, 16874, 16875, 16299, 16300, 16443, 16444, 16445, 16587, 16588, 16589,
+    16013, 16014, 16157, 16158, 16159, 16301, 16302, 16303, 15727, 15728, 15871, 15872,
+    15873, 16015, 16016, 16017, 15441, 15442, 15585, 15586, 15587, 15729, 15730, 15731,
+    15155, 15156, 15299, 15300, 15301, 15443, 15444, 15445, 14869, 14870, 15013, 15014,
+    15015, 15157, 15158, 15159, 14583, 14584, 14727, 14728, 14729, 14871, 14872, 14873,
+    14297, 14298, 14441, 14442, 14443, 14585, 14586, 14587, 14011, 14012, 14155, 14156,
+    14157, 14299, 14300, 14301, 13437, 13438, 13581, 13582, 13585, 14013, 14014, 14017,
+    13153, 13154, 13297, 13298, 13299, 13441, 13442, 13443, 12867, 12868, 13011, 13012,
+    13013, 13155, 13156, 13157, 12581, 12582, 12725, 12726, 12727, 12869, 12870, 12871,
+    12295, 12296, 12439, 12440, 12441, 12583, 12584, 12585, 12009, 12010, 12153, 12154,
+    12155, 12297, 12298, 12299, 11723, 11724, 11867, 11868, 11869, 12011, 12012, 12013,
+    11437, 11438, 11581, 11582, 11583, 11725, 11726, 11727, 11151, 11152, 11295, 11296,
+    11297, 11439, 11440, 11441, 10865, 10866, 11009, 11010, 11011, 11153, 11154, 11155,
+    10579, 10580, 10723, 10724, 10725, 10867, 10868, 10869, 10005, 10006, 10149, 10150,
+    10153, 10581, 10582, 10585, 9721, 9722, 9865, 9866, 9867, 10009, 10010, 10011,
+    9435, 9436, 9579, 9580, 9581, 9723, 9724, 9725, 9149, 9150, 9293, 9294,
+    9295, 9437, 9438, 9439, 8863, 8864, 9007, 9008, 9009, 9151, 9152, 9153,
+    8577, 8578, 8721, 8722, 8723, 8865, 8866, 8867, 8291, 8292, 8435, 8436,
+    8437, 8579, 8580, 8581, 8005, 8006, 8149, 8150, 8151, 8293, 8294, 8295,
+    7719, 7720, 7863, 7864, 7865, 8007, 8008, 8009, 7433, 7434, 7577, 7578,
+    7579, 7721, 7722, 7723, 7147, 7148, 7291, 7292, 7293, 7435, 7436, 7437,
+    6573, 6574, 6717, 6718, 6721, 7149, 7150, 7153, 6289, 6290, 6433, 6434,
+    6435, 6577, 6578, 6579, 6003, 6004, 6147, 6148, 6149, 6291, 6292, 6293,
+    5717, 5718, 5861, 5862, 5863, 6005, 6006, 6007, 5431, 5432, 5575, 5576,
+    5577, 5719, 5720, 5721, 5145, 5146, 5289, 5290, 5291, 5433, 5434, 5435,
+    4859, 4860, 5003, 5004, 5005, 5147, 5148, 5149, 4573, 4574, 4717, 4718,
+    4719, 4861, 4862, 4863, 4287, 4288, 4431, 4432, 4433, 4575, 4576, 4577,
+    4001, 4002, 4145, 4146, 4147, 4289, 4290, 4291, 3715, 3716, 3859, 3860,
+    3861, 4003, 4004, 4005, 3141, 3142, 3285, 3286, 3289, 3717, 3718, 3721,
+    2857, 2858, 3001, 3002, 3003, 3145, 3146, 3147, 2571, 2572, 2715, 2716,
+    2717, 2859, 2860, 2861, 2285, 2286, 2429, 2430, 2431, 2573, 2574, 2575,
+    1999, 2000, 2143, 2144, 2145, 2287, 2288, 2289, 1713, 1714, 1857, 1858,
+    1859, 2001, 2002, 2003, 1427, 1428, 1571, 1572, 1573, 1715, 1716, 1717,
+    1141, 1142, 1285, 1286, 1287, 1429, 1430, 1431, 855, 856, 999, 1000,
+    1001, 1143, 1144, 1145, 569, 570, 713, 714, 715, 857, 858, 859,
+    283, 284, 427, 428, 429, 571, 572, 573, 716, 717, 860, 861,
+    862, 1004, 1005, 1006, 1002, 1003, 1146, 1147, 1148, 1290, 1291, 1292,
+    1288, 1289, 1432, 1433, 1434, 1576, 1577, 1578, 1574, 1575, 1718, 1719,
+    1720, 1862, 1863, 1864, 1860, 1861, 2004, 2005, 2006, 2148, 2149, 2150,
+    2146, 2147, 2290, 2291, 2292, 2434, 2435, 2436, 2432, 2433, 2576, 2577,
+    2578, 2720, 2721, 2722, 2718, 2719, 2862, 2863, 2864, 3006, 3007, 3008,
+    3004, 3005, 3148, 3149, 3150, 3292, 3293, 3294, 3290, 3291, 3722, 3723,
+    3724, 3866, 3867, 3868, 3862, 3865, 4006, 4009, 4010, 4150, 4153, 4154,
+    4148, 4149, 4292, 4293, 4294, 4436, 4437, 4438, 4434, 4435, 4578, 4579,
+    4580, 4722, 4723, 4724, 4720, 4721, 4864, 4865, 4866, 5008, 5009, 5010,
+    5006, 5007, 5150, 5151, 5152, 5294, 5295, 5296, 5292, 5293, 5436, 5437,
+    5438, 5580, 5581, 5582, 5578, 5579, 5722, 5723, 5724, 5866, 5867, 5868,
+    5864, 5865, 6008, 6009, 6010, 6152, 6153, 6154, 6150, 6151, 6294, 6295,
+    6296, 6438, 6439, 6440, 6436, 6437, 6580, 6581, 6582, 6724, 6725, 6726,
+    6722, 6723, 7154, 7155, 7156, 7298, 7299, 7300, 7294, 7297, 7438, 7441,
+    7442, 7582, 7585, 7586, 7580, 7581, 7724, 7725, 7726, 7868, 7869, 7870,
+    7866, 7867, 8010, 8011, 8012, 8154, 8155, 8156, 8152, 8153, 8296, 8297,
+    8298, 8440, 8441, 8442, 8438, 8439, 8582, 8583, 8584, 8726, 8727, 8728,
+    8724, 8725, 8868, 8869, 8870, 9012, 9013, 9014, 9010, 9011, 9154, 9155,
+    9156, 9298, 9299, 9300, 9296, 9297, 9440, 9441, 9442, 9584, 9585, 9586,
+    9582, 9583, 9726, 9727, 9728, 9870, 9871, 9872, 9868, 9869, 10012, 10013,
+    10014, 10156, 10157, 10158, 10154, 10155, 10586, 10587, 10588, 10730, 10731, 10732,
+    10726, 10729, 10870, 10873, 10874, 11014, 11017, 11018, 11012, 11013, 11156, 11157,
+    11158, 11300, 11301, 11302, 11298, 11299, 11442, 11443, 11444, 11586, 11587, 11588,
+    11584, 11585, 11728, 11729, 11730, 11872, 11873, 11874, 11870, 11871, 12014, 12015,
+    12016, 12158, 12159, 12160, 12156, 12157, 12300, 12301, 12302, 12444, 12445, 12446,
+    12442, 12443, 12586, 12587, 12588, 12730, 12731, 12732, 12728, 12729, 12872, 12873,
+    12874, 13016, 13017, 13018, 13014, 13015, 13158, 13159, 13160, 13302, 13303, 13304,
+    13300, 13301, 13444, 13445, 13446, 13588, 13589, 13590, 13586, 13587, 14018, 14019,
+    14020, 14162, 14163, 14164, 14158, 14161, 14302, 14305, 14306, 14446, 14449, 14450,
+    14444, 14445, 14588, 14589, 14590, 14732, 14733, 14734, 14730, 14731, 14874, 14875,
+    14876, 15018, 15019, 15020, 15016, 15017, 15160, 15161, 15162, 15304, 15305, 15306,
+    15302, 15303, 15446, 15447, 15448, 15590, 15591, 15592, 15588, 15589, 15732, 15733,
+    15734, 15876, 15877, 15878, 15874, 15875, 16018, 16019, 16020, 16162, 16163, 16164,
+    16160, 16161, 16304, 16305, 16306, 16448, 16449, 16450, 16446, 16447, 16590, 16591,
+    16592, 16734, 16735, 16736, 16732, 16733, 16876, 16877, 16878, 17020, 17021, 17022,
+    17018, 17019, 17450, 17451, 17452, 17594, 17595, 17596, 17590, 17593, 17734, 17737,
+    17738, 17878, 17881, 17882, 17876, 17877, 18020, 18021, 18022, 18164, 18165, 18166,
+    18162, 18163, 18306, 18307, 18308, 18450, 18451, 18452, 18448, 18449, 18592, 18593,
+    18594, 18736, 18737, 18738, 18734, 18735, 18878, 18879, 18880, 19022, 19023, 19024,
+    19020, 19021, 19164, 19165, 19166, 19308, 19309, 19310, 19306, 19307, 19450, 19451,
+    19452, 19594, 19595, 19596, 19592, 19593, 19736, 19737, 19738, 19880, 19881, 19882,
+    19878, 19879, 20022, 20023, 20024, 20166, 20167, 20168, 20164, 20165, 20308, 20309,
+    20310, 20452, 20453, 20454, 20025, 20026, 20169, 20170, 20171, 20313, 20314, 20315,
+    19739, 19740, 19883, 19884, 19885, 20027, 20028, 20029, 19453, 19454, 19597, 19598,
+    19599, 19741, 19742, 19743, 19167, 19168, 19311, 19312, 19313, 19455, 19456, 19457,
+    18881, 18882, 19025, 19026, 19027, 19169, 19170, 19171, 18595, 18596, 18739, 18740,
+    18741, 18883, 18884, 18885, 18309, 18310, 18453, 18454, 18457, 18597, 18598, 18601,
+    18025, 18026, 18169, 18170, 18171, 18313, 18314, 18315, 17739, 17740, 17883, 17884,
+    17885, 18027, 18028, 18029, 17453, 17454, 17597, 17598, 17599, 17741, 17742, 17743,
+    16879, 16880, 17023, 17024, 17025, 17455, 17456, 17457, 16593, 16594, 16737, 16738,
+    16739, 16881, 16882, 16883, 16307, 16308, 16451, 16452, 16453, 16595, 16596, 16597,
+    16021, 16022, 16165, 16166, 16167, 16309, 16310, 16311, 15735, 15736, 15879, 15880,
+    15881, 16023, 16024, 16025, 15449, 15450, 15593, 15594, 15595, 15737, 15738, 15739,
+    15163, 15164, 15307, 15308, 15309, 15451, 15452, 15453, 14877, 14878, 15021, 15022,
+    15025, 15165, 15166, 15169, 14593, 14594, 14737, 14738, 14739, 14881, 14882, 14883,
+    14307, 14308, 14451, 14452, 14453, 14595, 14596, 14597, 14021, 14022, 14165, 14166,
+    14167, 14309, 14310, 14311, 13447, 13448, 13591, 13592, 13593, 14023, 14024, 14025,
+    13161, 13162, 13305, 13306, 13307, 13449, 13450, 13451, 12875, 12876, 13019, 13020,
+    13021, 13163, 13164, 13165, 12589, 12590, 12733, 12734, 12735, 12877, 12878, 12879,
+    12303, 12304, 12447, 12448, 12449, 12591, 12592, 12593, 12017, 12018, 12161, 12162,
+    12163, 12305, 12306, 12307, 11731, 11732, 11875, 11876, 11877, 12019, 12020, 12021,
+    11445, 11446, 11589, 11590, 11593, 11733, 11734, 11737, 11161, 11162, 11305, 11306,
+    11307, 11449, 11450, 11451, 10875, 10876, 11019, 11020, 11021, 11163, 11164, 11165,
+    10589, 10590, 10733, 10734, 10735, 10877, 10878, 10879, 10015, 10016, 10159, 10160,
+    10161, 10591, 10592, 10593, 9729, 9730, 9873, 9874, 9875, 10017, 10018, 10019,
+    9443, 9444, 9587, 9588, 9589, 9731, 9732, 9733, 9157, 9158, 9301, 9302,
+    9303, 9445, 9446, 9447, 8871, 8872, 9015, 9016, 9017, 9159, 9160, 9161,
+    8585, 8586, 8729, 8730, 8731, 8873, 8874, 8875, 8299, 8300, 8443, 8444,
+    8445, 8587, 8588, 8589, 8013, 8014, 8157, 8158, 8161, 8301, 8302, 8305,
+    7729, 7730, 7873, 7874, 7875, 8017, 8018, 8019, 7443, 7444, 7587, 7588,
+    7589, 7731, 7732, 7733, 7157, 7158, 7301, 7302, 7303, 7445, 7446, 7447,
+    6583, 6584, 6727, 6728, 6729, 7159, 7160, 7161, 6297, 6298, 6441, 6442,
+    6443, 6585, 6586, 6587, 6011, 6012, 6155, 6156, 6157, 6299, 6300, 6301,
+    5725, 5726, 5869, 5870, 5871, 6013, 6014, 6015, 5439, 5440, 5583, 5584,
+    5585, 5727, 5728, 5729, 5153, 5154, 5297, 5298, 5299, 5441, 5442, 5443,
+    4867, 4868, 5011, 5012, 5013, 5155, 5156, 5157, 4581, 4582, 4725, 4726,
+    4729, 4869, 4870, 4873, 4297, 4298, 4441, 4442, 4443, 4585, 4586, 4587,
+    4011, 4012, 4155, 4156, 4157, 4299, 4300, 4301, 3725, 3726, 3869, 3870,
+    3871, 4013, 4014, 4015, 3151, 3152, 3295, 3296, 3297, 3727, 3728, 3729,
+    2865, 2866, 3009, 3010, 3011, 3153, 3154, 3155, 2579, 2580, 2723, 2724,
+    2725, 2867, 2868, 2869, 2293, 2294, 2437, 2438, 2439, 2581, 2582, 2583,
+    2007, 2008, 2151, 2152, 2153, 2295, 2296, 2297, 1721, 1722, 1865, 1866,
+    1867, 2009, 2010, 2011, 1435, 1436, 1579, 1580, 1581, 1723, 1724, 1725,
+    1868, 1869, 2012, 2013, 2014, 2156, 2157, 2158, 2154, 2155, 2298, 2299,
+    2300, 2442, 2443, 2444, 2440, 2441, 2584, 2585, 2586, 2728, 2729, 2730,
+    2726, 2727, 2870, 2871, 2872, 3014, 3015, 3016, 3012, 3013, 3156, 3157,
+    3158, 3300, 3301, 3302, 3298, 3299, 3730, 3731, 3732, 3874, 3875, 3876,
+    3872, 3873, 4016, 4017, 4018, 4160, 4161, 4162, 4158, 4159, 4302, 4303,
+    4304, 4446, 4447, 4448, 4444, 4445, 4588, 4589, 4590, 4732, 4733, 4734,
+    4730, 4731, 4874, 4875, 4876, 5018, 5019, 5020, 5014, 5017, 5158, 5161,
+    5162, 5302, 5305, 5306, 5300, 5301, 5444, 5445, 5446, 5588, 5589, 5590,
+    5586, 5587, 5730, 5731, 5732, 5874, 5875, 5876, 5872, 5873, 6016, 6017,
+    6018, 6160, 6161, 6162, 6158, 6159, 6302, 6303, 6304, 6446, 6447, 6448,
+    6444, 6445, 6588, 6589, 6590, 6732, 6733, 6734, 6730, 6731, 7162, 7163,
+    7164, 7306, 7307, 7308, 7304, 7305, 7448, 7449, 7450, 7592, 7593, 7594,
+    7590, 7591, 7734, 7735, 7736, 7878, 7879, 7880, 7876, 7877, 8020, 8021,
+    8022, 8164, 8165, 8166, 8162, 8163, 8306, 8307, 8308, 8450, 8451, 8452,
+    8446, 8449, 8590, 8593, 8594, 8734, 8737, 8738, 8732, 8733, 8876, 8877,
+    8878, 9020, 9021, 9022, 9018, 9019, 9162, 9163, 9164, 9306, 9307, 9308,
+    9304, 9305, 9448, 9449, 9450, 9592, 9593, 9594, 9590, 9591, 9734, 9735,
+    9736, 9878, 9879, 9880, 9876, 9877, 10020, 10021, 10022, 10164, 10165, 10166,
+    10162, 10163, 10594, 10595, 10596, 10738, 10739, 10740, 10736, 10737, 10880, 10881,
+    10882, 11024, 11025, 11026, 11022, 11023, 11166, 11167, 11168, 11310, 11311, 11312,
+    11308, 11309, 11452, 11453, 11454, 11596, 11597, 11598, 11594, 11595, 11738, 11739,
+    11740, 11882, 11883, 11884, 11878, 11881, 12022, 12025, 12026, 12166, 12169, 12170,
+    12164, 12165, 12308, 12309, 12310, 12452, 12453, 12454, 12450, 12451, 12594, 12595,
+    12596, 12738, 12739, 12740, 12736, 12737, 12880, 12881, 12882, 13024, 13025, 13026,
+    13022, 13023, 13166, 13167, 13168, 13310, 13311, 13312, 13308, 13309, 13452, 13453,
+    13454, 13596, 13597, 13598, 13594, 13595, 14026, 14027, 14028, 14170, 14171, 14172,
+    14168, 14169, 14312, 14313, 14314, 14456, 14457, 14458, 14454, 14455, 14598, 14599,
+    14600, 14742, 14743, 14744, 14740, 14741, 14884, 14885, 14886, 15028, 15029, 15030,
+    15026, 15027, 15170, 15171, 15172, 15314, 15315, 15316, 15310, 15313, 15454, 15457,
+    15458, 15598, 15601, 15602, 15596, 15597, 15740, 15741, 15742, 15884, 15885, 15886,
+    15882, 15883, 16026, 16027, 16028, 16170, 16171, 16172, 16168, 16169, 16312, 16313,
+    16314, 16456, 16457, 16458, 16454, 16455, 16598, 16599, 16600, 16742, 16743, 16744,
+    16740, 16741, 16884, 16885, 16886, 17028, 17029, 17030, 17026, 17027, 17458, 17459,
+    17460, 17602, 17603, 17604, 17600, 17601, 17744, 17745, 17746, 17888, 17889, 17890,
+    17886, 17887, 18030, 18031, 18032, 18174, 18175, 18176, 18172, 18173, 18316, 18317,
+    18318, 18460, 18461, 18462, 18458, 18459, 18602, 18603, 18604, 18746, 18747, 18748,
+    18742, 18745, 18886, 18889, 18890, 19030, 19033, 19034, 19028, 19029, 19172, 19173,
+    19174, 19316, 19317, 19318, 19314, 19315, 19458, 19459, 19460, 19602, 19603, 19604,
+    19600, 19601, 19744, 19745, 19746, 19888, 19889, 19890, 19886, 19887, 20030, 20031,
+    20032, 20174, 20175, 20176, 20172, 20173, 20316, 20317, 20318, 20460, 20461, 20462,
+    20033, 20034, 20177, 20178, 20179, 20321, 20322, 20323, 19747, 19748, 19891, 19892,
+    19893, 20035, 20036, 20037, 19461, 19462, 19605, 19606, 19609, 19749, 19750, 19753,
+    19177, 19178, 19321, 19322, 19323, 19465, 19466, 19467, 18891, 18892, 19035, 19036,
+    19037, 19179, 19180, 19181, 18605, 18606, 18749, 18750, 18751, 18893, 18894, 18895,
+    18319, 18320, 18463, 18464, 18465, 18607, 18608, 18609, 18033, 18034, 18177, 18178,
+    18179, 18321, 18322, 18323, 17747, 17748, 17891, 17892, 17893, 18035, 18036, 18037,
+    17461, 17462, 17605, 17606, 17607, 17749, 17750, 17751, 16887, 16888, 17031, 17032,
+    17033, 17463, 17464, 17465, 16601, 16602, 16745, 16746, 16747, 16889, 16890, 16891,
+    16315, 16316, 16459, 16460, 16461, 16603, 16604, 16605, 16029, 16030, 16173, 16174,
+    16177, 16317, 16318, 16321, 15745, 15746, 15889, 15890, 15891, 16033, 16034, 16035,
+    15459, 15460, 15603, 15604, 15605, 15747, 15748, 15749, 15173, 15174, 15317, 15318,
+    15319, 15461, 15462, 15463, 14887, 14888, 15031, 15032, 15033, 15175, 15176, 15177,
+    14601, 14602, 14745, 14746, 14747, 14889, 14890, 14891, 14315, 14316, 14459, 14460,
+    14461, 14603, 14604, 14605, 14029, 14030, 14173, 14174, 14175, 14317, 14318, 14319,
+    13455, 13456, 13599, 13600, 13601, 14031, 14032, 14033, 13169, 13170, 13313, 13314,
+    13315, 13457, 13458, 13459, 12883, 12884, 13027, 13028, 13029, 13171, 13172, 13173,
+    12597, 12598, 12741, 12742, 12745, 12885, 12886, 12889, 12313, 12314, 12457, 12458,
+    12459, 12601, 12602, 12603, 12027, 12028, 12171, 12172, 12173, 12315, 12316, 12317,
+    11741, 11742, 11885, 11886, 11887, 12029, 12030, 12031, 11455, 11456, 11599, 11600,
+    11601, 11743, 11744, 11745, 11169, 11170, 11313, 11314, 11315, 11457, 11458, 11459,
+    10883, 10884, 11027, 11028, 11029, 11171, 11172, 11173, 10597, 10598, 10741, 10742,
+    10743, 10885, 10886, 10887, 10023, 10024, 10167, 10168, 10169, 10599, 10600, 10601,
+    9737, 9738, 9881, 9882, 9883, 10025, 10026, 10027, 9451, 9452, 9595, 9596,
+    9597, 9739, 9740, 9741, 9165, 9166, 9309, 9310, 9313, 9453, 9454, 9457,
+    8881, 8882, 9025, 9026, 9027, 9169, 9170, 9171, 8595, 8596, 8739, 8740,
+    8741, 8883, 8884, 8885, 8309, 8310, 8453, 8454, 8455, 8597, 8598, 8599,
+    8023, 8024, 8167, 8168, 8169, 8311, 8312, 8313, 7737, 7738, 7881, 7882,
+    7883, 8025, 8026, 8027, 7451, 7452, 7595, 7596, 7597, 7739, 7740, 7741,
+    7165, 7166, 7309, 7310, 7311, 7453, 7454, 7455, 6591, 6592, 6735, 6736,
+    6737, 7167, 7168, 7169, 6305, 6306, 6449, 6450, 6451, 6593, 6594, 6595,
+    6019, 6020, 6163, 6164, 6165, 6307, 6308, 6309, 5733, 5734, 5877, 5878,
+    5881, 6021, 6022, 6025, 5449, 5450, 5593, 5594, 5595, 5737, 5738, 5739,
+    5163, 5164, 5307, 5308, 5309, 5451, 5452, 5453, 4877, 4878, 5021, 5022,
+    5023, 5165, 5166, 5167, 4591, 4592, 4735, 4736, 4737, 4879, 4880, 4881,
+    4305, 4306, 4449, 4450, 4451, 4593, 4594, 4595, 4019, 4020, 4163, 4164,
+    4165, 4307, 4308, 4309, 3733, 3734, 3877, 3878, 3879, 4021, 4022, 4023,
+    3159, 3160, 3303, 3304, 3305, 3735, 3736, 3737, 2873, 2874, 3017, 3018,
+    3019, 3161, 3162, 3163, 2587, 2588, 2731, 2732, 2733, 2875, 2876, 2877,
+    3020, 3021, 3164, 3165, 3166, 3308, 3309, 3310, 3306, 3307, 3738, 3739,
+    3740, 3882, 3883, 3884, 3880, 3881, 4024, 4025, 4026, 4168, 4169, 4170,
+    4166, 4167, 4310, 4311, 4312, 4454, 4455, 4456, 4452, 4453, 4596, 4597,
+    4598, 4740, 4741, 4742, 4738, 4739, 4882, 4883, 4884, 5026, 5027, 5028,
+    5024, 5025, 5168, 5169, 5170, 5312, 5313, 5314, 5310, 5311, 5454, 5455,
+    5456, 5598, 5599, 5600, 5596, 5597, 5740, 5741, 5742, 5884, 5885, 5886,
+    5882, 5883, 6026, 6027, 6028, 6170, 6171, 6172, 6166, 6169, 6310, 6313,
+    6314, 6454, 6457, 6458, 6452, 6453, 6596, 6597, 6598, 6740, 6741, 6742,
+    6738, 6739, 7170, 7171, 7172, 7314, 7315, 7316, 7312, 7313, 7456, 7457,
+    7458, 7600, 7601, 7602, 7598, 7599, 7742, 7743, 7744, 7886, 7887, 7888,
+    7884, 7885, 8028, 8029, 8030, 8172, 8173, 8174, 8170, 8171, 8314, 8315,
+    8316, 8458, 8459, 8460, 8456, 8457, 8600, 8601, 8602, 8744, 8745, 8746,
+    8742, 8743, 8886, 8887, 8888, 9030, 9031, 9032, 9028, 9029, 9172, 9173,
+    9174, 9316, 9317, 9318, 9314, 9315, 9458, 9459, 9460, 9602, 9603, 9604,
+    9598, 9601, 9742, 9745, 9746, 9886, 9889, 9890, 9884, 9885, 10028, 10029,
+    10030, 10172, 10173, 10174, 10170, 10171, 10602, 10603, 10604, 10746, 10747, 10748,
+    10744, 10745, 10888, 10889, 10890, 11032, 11033, 11034, 11030, 11031, 11174, 11175,
+    11176, 11318, 11319, 11320, 11316, 11317, 11460, 11461, 11462, 11604, 11605, 11606,
+    11602, 11603, 11746, 11747, 11748, 11890, 11891, 11892, 11888, 11889, 12032, 12033,
+    12034, 12176, 12177, 12178, 12174, 12175, 12318, 12319, 12320, 12462, 12463, 12464,
+    12460, 12461, 12604, 12605, 12606, 12748, 12749, 12750, 12746, 12747, 12890, 12891,
+    12892, 13034, 13035, 13036, 13030, 13033, 13174, 13177, 13178, 13318, 13321, 13322,
+    13316, 13317, 13460, 13461, 13462, 13604, 13605, 13606, 13602, 13603, 14034, 14035,
+    14036, 14178, 14179, 14180, 14176, 14177, 14320, 14321, 14322, 14464, 14465, 14466,
+    14462, 14463, 14606, 14607, 14608, 14750, 14751, 14752, 14748, 14749, 14892, 14893,
+    14894, 15036, 15037, 15038, 15034, 15035, 15178, 15179, 15180, 15322, 15323, 15324,
+    15320, 15321, 15464, 15465, 15466, 15608, 15609, 15610, 15606, 15607, 15750, 15751,
+    15752, 15894, 15895, 15896, 15892, 15893, 16036, 16037, 16038, 16180, 16181, 16182,
+    16178, 16179, 16322, 16323, 16324, 16466, 16467, 16468, 16462, 16465, 16606, 16609,
+    16610, 16750, 16753, 16754, 16748, 16749, 16892, 16893, 16894, 17036, 17037, 17038,
+    17034, 17035, 17466, 17467, 17468, 17610, 17611, 17612, 17608, 17609, 17752, 17753,
+    17754, 17896, 17897, 17898, 17894, 17895, 18038, 18039, 18040, 18182, 18183, 18184,
+    18180, 18181, 18324, 18325, 18326, 18468, 18469, 18470, 18466, 18467, 18610, 18611,
+    18612, 18754, 18755, 18756, 18752, 18753, 18896, 18897, 18898, 19040, 19041, 19042,
+    19038, 19039, 19182, 19183, 19184, 19326, 19327, 19328, 19324, 19325, 19468, 19469,
+    19470, 19612, 19613, 19614, 19610, 19611, 19754, 19755, 19756, 19898, 19899, 19900,
+    19894, 19897, 20038, 20041, 20042, 20182, 20185, 20186, 20180, 20181, 20324, 20325,
+    20326, 20468, 20469, 20470, 20043, 20044, 20187, 20188, 20189, 20331, 20332, 20333,
+    19757, 19758, 19901, 19902, 19903, 20045, 20046, 20047, 19471, 19472, 19615, 19616,
+    19617, 19759, 19760, 19761, 19185, 19186, 19329, 19330, 19331, 19473, 19474, 19475,
+    18899, 18900, 19043, 19044, 19045, 19187, 19188, 19189, 18613, 18614, 18757, 18758,
+    18759, 18901, 18902, 18903, 18327, 18328, 18471, 18472, 18473, 18615, 18616, 18617,
+    18041, 18042, 18185, 18186, 18187, 18329, 18330, 18331, 17755, 17756, 17899, 17900,
+    17901, 18043, 18044, 18045, 17469, 17470, 17613, 17614, 17617, 17757, 17758, 17761,
+    16897, 16898, 17041, 17042, 17043, 17473, 17474, 17475, 16611, 16612, 16755, 16756,
+    16757, 16899, 16900, 16901, 16325, 16326, 16469, 16470, 16471, 16613, 16614, 16615,
+    16039, 16040, 16183, 16184, 16185, 16327, 16328, 16329, 15753, 15754, 15897, 15898,
+    15899, 16041, 16042, 16043, 15467, 15468, 15611, 15612, 15613, 15755, 15756, 15757,
+    15181, 15182, 15325, 15326, 15327, 15469, 15470, 15471, 14895, 14896, 15039, 15040,
+    15041, 15183, 15184, 15185, 14609, 14610, 14753, 14754, 14755, 14897, 14898, 14899,
+    14323, 14324, 14467, 14468, 14469, 14611, 14612, 14613, 14037, 14038, 14181, 14182,
+    14185, 14325, 14326, 14329, 13465, 13466, 13609, 13610, 13611, 14041, 14042, 14043,
+    13179, 13180, 13323, 13324, 13325, 13467, 13468, 13469, 12893, 12894, 13037, 13038,
+    13039, 13181, 13182, 13183, 12607, 12608, 12751, 12752, 12753, 12895, 12896, 12897,
+    12321, 12322, 12465, 12466, 12467, 12609, 12610, 12611, 12035, 12036, 12179, 12180,
+    12181, 12323, 12324, 12325, 11749, 11750, 11893, 11894, 11895, 12037, 12038, 12039,
+    11463, 11464, 11607, 11608, 11609, 11751, 11752, 11753, 11177, 11178, 11321, 11322,
+    11323, 11465, 11466, 11467, 10891, 10892, 11035, 11036, 11037, 11179, 11180, 11181,
+    10605, 10606, 10749, 10750, 10753, 10893, 10894, 10897, 10033, 10034, 10177, 10178,
+    10179, 10609, 10610, 10611, 9747, 9748, 9891, 9892, 9893, 10035, 10036, 10037,
+    9461, 9462, 9605, 9606, 9607, 9749, 9750, 9751, 9175, 9176, 9319, 9320,
+    9321, 9463, 9464, 9465, 8889, 8890, 9033, 9034, 9035, 9177, 9178, 9179,
+    8603, 8604, 8747, 8748, 8749, 8891, 8892, 8893, 8317, 8318, 8461, 8462,
+    8463, 8605, 8606, 8607, 8031, 8032, 8175, 8176, 8177, 8319, 8320, 8321,
+    7745, 7746, 7889, 7890, 7891, 8033, 8034, 8035, 7459, 7460, 7603, 7604,
+    7605, 7747, 7748, 7749, 7173, 7174, 7317, 7318, 7321, 7461, 7462, 7465,
+    6601, 6602, 6745, 6746, 6747, 7177, 7178, 7179, 6315, 6316, 6459, 6460,
+    6461, 6603, 6604, 6605, 6029, 6030, 6173, 6174, 6175, 6317, 6318, 6319,
+    5743, 5744, 5887, 5888, 5889, 6031, 6032, 6033, 5457, 5458, 5601, 5602,
+    5603, 5745, 5746, 5747, 5171, 5172, 5315, 5316, 5317, 5459, 5460, 5461,
+    4885, 4886, 5029, 5030, 5031, 5173, 5174, 5175, 4599, 4600, 4743, 4744,
+    4745, 4887, 4888, 4889, 4313, 4314, 4457, 4458, 4459, 4601, 4602, 4603,
+    4027, 4028, 4171, 4172, 4173, 4315, 4316, 4317, 4460, 4461, 4604, 4605,
+    4606, 4748, 4749, 4750, 4746, 4747, 4890, 4891, 4892, 5034, 5035, 5036,
+    5032, 5033, 5176, 5177, 5178, 5320, 5321, 5322, 5318, 5319, 5462, 5463,
+    5464, 5606, 5607, 5608, 5604, 5605, 5748, 5749, 5750, 5892, 5893, 5894,
+    5890, 5891, 6034, 6035, 6036, 6178, 6179, 6180, 6176, 6177, 6320, 6321,
+    6322, 6464, 6465, 6466, 6462, 6463, 6606, 6607, 6608, 6750, 6751, 6752,
+    6748, 6749, 7180, 7181, 7182, 7324, 7325, 7326, 7322, 7323, 7466, 7467,
+    7468, 7610, 7611, 7612, 7606, 7609, 7750, 7753, 7754, 7894, 7897, 7898,
+    7892, 7893, 8036, 8037, 8038, 8180, 8181, 8182, 8178, 8179, 8322, 8323,
+    8324, 8466, 8467, 8468, 8464, 8465, 8608, 8609, 8610, 8752, 8753, 8754,
+    8750, 8751, 8894, 8895, 8896, 9038, 9039, 9040, 9036, 9037, 9180, 9181,
+    9182, 9324, 9325, 9326, 9322, 9323, 9466, 9467, 9468, 9610, 9611, 9612,
+    9608, 9609, 9752, 9753, 9754, 9896, 9897, 9898, 9894, 9895, 10038, 10039,
+    10040, 10182, 10183, 10184, 10180, 10181, 10612, 10613, 10614, 10756, 10757, 10758,
+    10754, 10755, 10898, 10899, 10900, 11042, 11043, 11044, 11038, 11041, 11182, 11185,
+    11186, 11326, 11329, 11330, 11324, 11325, 11468, 11469, 11470, 11612, 11613, 11614,
+    11610, 11611, 11754, 11755, 11756, 11898, 11899, 11900, 11896, 11897, 12040, 12041,
+    12042, 12184, 12185, 12186, 12182, 12183, 12326, 12327, 12328, 12470, 12471, 12472,
+    12468, 12469, 12612, 12613, 12614, 12756, 12757, 12758, 12754, 12755, 12898, 12899,
+    12900, 13042, 13043, 13044, 13040, 13041, 13184, 13185, 13186, 13328, 13329, 13330,
+    13326, 13327, 13470, 13471, 13472, 13614, 13615, 13616, 13612, 13613, 14044, 14045,
+    14046, 14188, 14189, 14190, 14186, 14187, 14330, 14331, 14332, 14474, 14475, 14476,
+    14470, 14473, 14614, 14617, 14618, 14758, 14761, 14762, 14756, 14757, 14900, 14901,
+    14902, 15044, 15045, 15046, 15042, 15043, 15186, 15187, 15188, 15330, 15331, 15332,
+    15328, 15329, 15472, 15473, 15474, 15616, 15617, 15618, 15614, 15615, 15758, 15759,
+    15760, 15902, 15903, 15904, 15900, 15901, 16044, 16045, 16046, 16188, 16189, 16190,
+    16186, 16187, 16330, 16331, 16332, 16474, 16475, 16476, 16472, 16473, 16616, 16617,
+    16618, 16760, 16761, 16762, 16758, 16759, 16902, 16903, 16904, 17046, 17047, 17048,
+    17044, 17045, 17476, 17477, 17478, 17620, 17621, 17622, 17618, 17619, 17762, 17763,
+    17764, 17906, 17907, 17908, 17902, 17905, 18046, 18049, 18050, 18190, 18193, 18194,
+    18188, 18189, 18332, 18333, 18334, 18476, 18477, 18478, 18474, 18475, 18618, 18619,
+    18620, 18762, 18763, 18764, 18760, 18761, 18904, 18905, 18906, 19048, 19049, 19050,
+    19046, 19047, 19190, 19191, 19192, 19334, 19335, 19336, 19332, 19333, 19476, 19477,
+    19478, 19620, 19621, 19622, 19618, 19619, 19762, 19763, 19764, 19906, 19907, 19908,
+    19904, 19905, 20048, 20049, 20050, 20192, 20193, 20194, 20190, 20191, 20334, 20335,
+    20336, 20478, 20479, 20480, 20051, 20052, 20195, 20196, 20197, 20339, 20340, 20341,
+    19765, 19766, 19909, 19910, 19911, 20053, 20054, 20055, 19479, 19480, 19623, 19624,
+    19625, 19767, 19768, 19769, 19193, 19194, 19337, 19338, 19339, 19481, 19482, 19483,
+    18907, 18908, 19051, 19052, 19053, 19195, 19196, 19197, 18621, 18622, 18765, 18766,
+    18769, 18909, 18910, 18913, 18337, 18338, 18481, 18482, 18483, 18625, 18626, 18627,
+    18051, 18052, 18195, 18196, 18197, 18339, 18340, 18341, 17765, 17766, 17909, 17910,
+    17911, 18053, 18054, 18055, 17479, 17480, 17623, 17624, 17625, 17767, 17768, 17769,
+    16905, 16906, 17049, 17050, 17051, 17481, 17482, 17483, 16619, 16620, 16763, 16764,
+    16765, 16907, 16908, 16909, 16333, 16334, 16477, 16478, 16479, 16621, 16622, 16623,
+    16047, 16048, 16191, 16192, 16193, 16335, 16336, 16337, 15761, 15762, 15905, 15906,
+    15907, 16049, 16050, 16051, 15475, 15476, 15619, 15620, 15621, 15763, 15764, 15765,
+    15189, 15190, 15333, 15334, 15337, 15477, 15478, 15481, 14905, 14906, 15049, 15050,
+    15051, 15193, 15194, 15195, 14619, 14620, 14763, 14764, 14765, 14907, 14908, 14909,
+    14333, 14334, 14477, 14478, 14479, 14621, 14622, 14623, 14047, 14048, 14191, 14192,
+    14193, 14335, 14336, 14337, 13473, 13474, 13617, 13618, 13619, 14049, 14050, 14051,
+    13187, 13188, 13331, 13332, 13333, 13475, 13476, 13477, 12901, 12902, 13045, 13046,
+    13047, 13189, 13190, 13191, 12615, 12616, 12759, 12760, 12761, 12903, 12904, 12905,
+    12329, 12330, 12473, 12474, 12475, 12617, 12618, 12619, 12043, 12044, 12187, 12188,
+    12189, 12331, 12332, 12333, 11757, 11758, 11901, 11902, 11905, 12045, 12046, 12049,
+    11473, 11474, 11617, 11618, 11619, 11761, 11762, 11763, 11187, 11188, 11331, 11332,
+    11333, 11475, 11476, 11477, 10901, 10902, 11045, 11046, 11047, 11189, 11190, 11191,
+    10615, 10616, 10759, 10760, 10761, 10903, 10904, 10905, 10041, 10042, 10185, 10186,
+    10187, 10617, 10618, 10619, 9755, 9756, 9899, 9900, 9901, 10043, 10044, 10045,
+    9469, 9470, 9613, 9614, 9615, 9757, 9758, 9759, 9183, 9184, 9327, 9328,
+    9329, 9471, 9472, 9473, 8897, 8898, 9041, 9042, 9043, 9185, 9186, 9187,
+    8611, 8612, 8755, 8756, 8757, 8899, 8900, 8901, 8325, 8326, 8469, 8470,
+    8473, 8613, 8614, 8617, 8041, 8042, 8185, 8186, 8187, 8329, 8330, 8331,
+    7755, 7756, 7899, 7900, 7901, 8043, 8044, 8045, 7469, 7470, 7613, 7614,
+    7615, 7757, 7758, 7759, 7183, 7184, 7327, 7328, 7329, 7471, 7472, 7473,
+    6609, 6610, 6753, 6754, 6755, 7185, 7186, 7187, 6323, 6324, 6467, 6468,
+    6469, 6611, 6612, 6613, 6037, 6038, 6181, 6182, 6183, 6325, 6326, 6327,
+    5751, 5752, 5895, 5896, 5897, 6039, 6040, 6041, 5465, 5466, 5609, 5610,
+    5611, 5753, 5754, 5755, 5179, 5180, 5323, 5324, 5325, 5467, 5468, 5469,
+    5612, 5613, 5756, 5757, 5758, 5900, 5901, 5902, 5898, 5899, 6042, 6043,
+    6044, 6186, 6187, 6188, 6184, 6185, 6328, 6329, 6330, 6472, 6473, 6474,
+    6470, 6471, 6614, 6615, 6616, 6758, 6759, 6760, 6756, 6757, 7188, 7189,
+    7190, 7332, 7333, 7334, 7330, 7331, 7474, 7475, 7476, 7618, 7619, 7620,
+    7616, 7617, 7760, 7761, 7762, 7904, 7905, 7906, 7902, 7903, 8046, 8047,
+    8048, 8190, 8191, 8192, 8188, 8189, 8332, 8333, 8334, 8476, 8477, 8478,
+    8474, 8475, 8618, 8619, 8620, 8762, 8763, 8764, 8758, 8761, 8902, 8905,
+    8906, 9046, 9049, 9050, 9044, 9045, 9188, 9189, 9190, 9332, 9333, 9334,
+    9330, 9331, 9474, 9475, 9476, 9618, 9619, 9620, 9616, 9617, 9760, 9761,
+    9762, 9904, 9905, 9906, 9902, 9903, 10046, 10047, 10048, 10190, 10191, 10192,
+    10188, 10189, 10620, 10621, 10622, 10764, 10765, 10766, 10762, 10763, 10906, 10907,
+    10908, 11050, 11051, 11052, 11048, 11049, 11192, 11193, 11194, 11336, 11337, 11338,
+    11334, 11335, 11478, 11479, 11480, 11622, 11623, 11624, 11620, 11621, 11764, 11765,
+    11766, 11908, 11909, 11910, 11906, 11907, 12050, 12051, 12052, 12194, 12195, 12196,
+    12190, 12193, 12334, 12337, 12338, 12478, 12481, 12482, 12476, 12477, 12620, 12621,
+    12622, 12764, 12765, 12766, 12762, 12763, 12906, 12907, 12908, 13050, 13051, 13052,
+    13048, 13049, 13192, 13193, 13194, 13336, 13337, 13338, 13334, 13335, 13478, 13479,
+    13480, 13622, 13623, 13624, 13620, 13621, 14052, 14053, 14054, 14196, 14197, 14198,
+    14194, 14195, 14338, 14339, 14340, 14482, 14483, 14484, 14480, 14481, 14624, 14625,
+    14626, 14768, 14769, 14770, 14766, 14767, 14910, 14911, 14912, 15054, 15055, 15056,
+    15052, 15053, 15196, 15197, 15198, 15340, 15341, 15342, 15338, 15339, 15482, 15483,
+    15484, 15626, 15627, 15628, 15622, 15625, 15766, 15769, 15770, 15910, 15913, 15914,
+    15908, 15909, 16052, 16053, 16054, 16196, 16197, 16198, 16194, 16195, 16338, 16339,
+    16340, 16482, 16483, 16484, 16480, 16481, 16624, 16625, 16626, 16768, 16769, 16770,
+    16766, 16767, 16910, 16911, 16912, 17054, 17055, 17056, 17052, 17053, 17484, 17485,
+    17486, 17628, 17629, 17630, 17626, 17627, 17770, 17771, 17772, 17914, 17915, 17916,
+    17912, 17913, 18056, 18057, 18058, 18200, 18201, 18202, 18198, 18199, 18342, 18343,
+    18344, 18486, 18487, 18488, 18484, 18485, 18628, 18629, 18630, 18772, 18773, 18774,
+    18770, 18771, 18914, 18915, 18916, 19058, 19059, 19060, 19054, 19057, 19198, 19201,
+    19202, 19342, 19345, 19346, 19340, 19341, 19484, 19485, 19486, 19628, 19629, 19630,
+    19626, 19627, 19770, 19771, 19772, 19914, 19915, 19916, 19912, 19913, 20056, 20057,
+    20058, 20200, 20201, 20202, 20198, 20199, 20342, 20343, 20344, 20486, 20487, 20488,
+    20059, 20060, 20203, 20204, 20205, 20347, 20348, 20349, 19773, 19774, 19917, 19918,
+    19921, 20061, 20062, 20065, 19489, 19490, 19633, 19634, 19635, 19777, 19778, 19779,
+    19203, 19204, 19347, 19348, 19349, 19491, 19492, 19493, 18917, 18918, 19061, 19062,
+    19063, 19205, 19206, 19207, 18631, 18632, 18775, 18776, 18777, 18919, 18920, 18921,
+    18345, 18346, 18489, 18490, 18491, 18633, 18634, 18635, 18059, 18060, 18203, 18204,
+    18205, 18347, 18348, 18349, 17773, 17774, 17917, 17918, 17919, 18061, 18062, 18063,
+    17487, 17488, 17631, 17632, 17633, 17775, 17776, 17777, 16913, 16914, 17057, 17058,
+    17059, 17489, 17490, 17491, 16627, 16628, 16771, 16772, 16773, 16915, 16916, 16917,
+    16341, 16342, 16485, 16486, 16489, 16629, 16630, 16633, 16057, 16058, 16201, 16202,
+    16203, 16345, 16346, 16347, 15771, 15772, 15915, 15916, 15917, 16059, 16060, 16061,
+    15485, 15486, 15629, 15630, 15631, 15773, 15774, 15775, 15199, 15200, 15343, 15344,
+    15345, 15487, 15488, 15489, 14913, 14914, 15057, 15058, 15059, 15201, 15202, 15203,
+    14627, 14628, 14771, 14772, 14773, 14915, 14916, 14917, 14341, 14342, 14485, 14486,
+    14487, 14629, 14630, 14631, 14055, 14056, 14199, 14200, 14201, 14343, 14344, 14345,
+    13481, 13482, 13625, 13626, 13627, 14057, 14058, 14059, 13195, 13196, 13339, 13340,
+    13341, 13483, 13484, 13485, 12909, 12910, 13053, 13054, 13057, 13197, 13198, 13201,
+    12625, 12626, 12769, 12770, 12771, 12913, 12914, 12915, 12339, 12340, 12483, 12484,
+    12485, 12627, 12628, 12629, 12053, 12054, 12197, 12198, 12199, 12341, 12342, 12343,
+    11767, 11768, 11911, 11912, 11913, 12055, 12056, 12057, 11481, 11482, 11625, 11626,
+    11627, 11769, 11770, 11771, 11195, 11196, 11339, 11340, 11341, 11483, 11484, 11485,
+    10909, 10910, 11053, 11054, 11055, 11197, 11198, 11199, 10623, 10624, 10767, 10768,
+    10769, 10911, 10912, 10913, 10049, 10050, 10193, 10194, 10195, 10625, 10626, 10627,
+    9763, 9764, 9907, 9908, 9909, 10051, 10052, 10053, 9477, 9478, 9621, 9622,
+    9625, 9765, 9766, 9769, 9193, 9194, 9337, 9338, 9339, 9481, 9482, 9483,
+    8907, 8908, 9051, 9052, 9053, 9195, 9196, 9197, 8621, 8622, 8765, 8766,
+    8767, 8909, 8910, 8911, 8335, 8336, 8479, 8480, 8481, 8623, 8624, 8625,
+    8049, 8050, 8193, 8194, 8195, 8337, 8338, 8339, 7763, 7764, 7907, 7908,
+    7909, 8051, 8052, 8053, 7477, 7478, 7621, 7622, 7623, 7765, 7766, 7767,
+    7191, 7192, 7335, 7336, 7337, 7479, 7480, 7481, 6617, 6618, 6761, 6762,
+    6763, 7193, 7194, 7195, 6331, 6332, 6475, 6476, 6477, 6619, 6620, 6621,
+    6764, 6765, 7196, 7197, 7198, 7340, 7341, 7342, 7338, 7339, 7482, 7483,
+    7484, 7626, 7627, 7628, 7624, 7625, 7768, 7769, 7770, 7912, 7913, 7914,
+    7910, 7911, 8054, 8055, 8056, 8198, 8199, 8200, 8196, 8197, 8340, 8341,
+    8342, 8484, 8485, 8486, 8482, 8483, 8626, 8627, 8628, 8770, 8771, 8772,
+    8768, 8769, 8912, 8913, 8914, 9056, 9057, 9058, 9054, 9055, 9198, 9199,
+    9200, 9342, 9343, 9344, 9340, 9341, 9484, 9485, 9486, 9628, 9629, 9630,
+    9626, 9627, 9770, 9771, 9772, 9914, 9915, 9916, 9910, 9913, 10054, 10057,
+    10058, 10198, 10201, 10202, 10196, 10197, 10628, 10629, 10630, 10772, 10773, 10774,
+    10770, 10771, 10914, 10915, 10916, 11058, 11059, 11060, 11056, 11057, 11200, 11201,
+    11202, 11344, 11345, 11346, 11342, 11343, 11486, 11487, 11488, 11630, 11631, 11632,
+    11628, 11629, 11772, 11773, 11774, 11916, 11917, 11918, 11914, 11915, 12058, 12059,
+    12060, 12202, 12203, 12204, 12200, 12201, 12344, 12345, 12346, 12488, 12489, 12490,
+    12486, 12487, 12630, 12631, 12632, 12774, 12775, 12776, 12772, 12773, 12916, 12917,
+    12918, 13060, 13061, 13062, 13058, 13059, 13202, 13203, 13204, 13346, 13347, 13348,
+    13342, 13345, 13486, 13489, 13490, 13630, 13633, 13634, 13628, 13629, 14060, 14061,
+    14062, 14204, 14205, 14206, 14202, 14203, 14346, 14347, 14348, 14490, 14491, 14492,
+    14488, 14489, 14632, 14633, 14634, 14776, 14777, 14778, 14774, 14775, 14918, 14919,
+    14920, 15062, 15063, 15064, 15060, 15061, 15204, 15205, 15206, 15348, 15349, 15350,
+    15346, 15347, 15490, 15491, 15492, 15634, 15635, 15636, 15632, 15633, 15776, 15777,
+    15778, 15920, 15921, 15922, 15918, 15919, 16062, 16063, 16064, 16206, 16207, 16208,
+    16204, 16205, 16348, 16349, 16350, 16492, 16493, 16494, 16490, 16491, 16634, 16635,
+    16636, 16778, 16779, 16780, 16774, 16777, 16918, 16921, 16922, 17062, 17065, 17066,
+    17060, 17061, 17492, 17493, 17494, 17636, 17637, 17638, 17634, 17635, 17778, 17779,
+    17780, 17922, 17923, 17924, 17920, 17921, 18064, 18065, 18066, 18208, 18209, 18210,
+    18206, 18207, 18350, 18351, 18352, 18494, 18495, 18496, 18492, 18493, 18636, 18637,
+    18638, 18780, 18781, 18782, 18778, 18779, 18922, 18923, 18924, 19066, 19067, 19068,
+    19064, 19065, 19208, 19209, 19210, 19352, 19353, 19354, 19350, 19351, 19494, 19495,
+    19496, 19638, 19639, 19640, 19636, 19637, 19780, 19781, 19782, 19924, 19925, 19926,
+    19922, 19923, 20066, 20067, 20068, 20210, 20211, 20212, 20206, 20209, 20350, 20353,
+    20354, 20494, 20497, 20498, 20069, 20070, 20213, 20214, 20215, 20357, 20358, 20359,
+    19783, 19784, 19927, 19928, 19929, 20071, 20072, 20073, 19497, 19498, 19641, 19642,
+    19643, 19785, 19786, 19787, 19211, 19212, 19355, 19356, 19357, 19499, 19500, 19501,
+    18925, 18926, 19069, 19070, 19071, 19213, 19214, 19215, 18639, 18640, 18783, 18784,
+    18785, 18927, 18928, 18929, 18353, 18354, 18497, 18498, 18499, 18641, 18642, 18643,
+    18067, 18068, 18211, 18212, 18213, 18355, 18356, 18357, 17781, 17782, 17925, 17926,
+    17929, 18069, 18070, 18073, 17497, 17498, 17641, 17642, 17643, 17785, 17786, 17787,
+    16923, 16924, 17067, 17068, 17069, 17499, 17500, 17501, 16637, 16638, 16781, 16782,
+    16783, 16925, 16926, 16927, 16351, 16352, 16495, 16496, 16497, 16639, 16640, 16641,
+    16065, 16066, 16209, 16210, 16211, 16353, 16354, 16355, 15779, 15780, 15923, 15924,
+    15925, 16067, 16068, 16069, 15493, 15494, 15637, 15638, 15639, 15781, 15782, 15783,
+    15207, 15208, 15351, 15352, 15353, 15495, 15496, 15497, 14921, 14922, 15065, 15066,
+    15067, 15209, 15210, 15211, 14635, 14636, 14779, 14780, 14781, 14923, 14924, 14925,
+    14349, 14350, 14493, 14494, 14497, 14637, 14638, 14641, 14065, 14066, 14209, 14210,
+    14211, 14353, 14354, 14355, 13491, 13492, 13635, 13636, 13637, 14067, 14068, 14069,
+    13205, 13206, 13349, 13350, 13351, 13493, 13494, 13495, 12919, 12920, 13063, 13064,
+    13065, 13207, 13208, 13209, 12633, 12634, 12777, 12778, 12779, 12921, 12922, 12923,
+    12347, 12348, 12491, 12492, 12493, 12635, 12636, 12637, 12061, 12062, 12205, 12206,
+    12207, 12349, 12350, 12351, 11775, 11776, 11919, 11920, 11921, 12063, 12064, 12065,
+    11489, 11490, 11633, 11634, 11635, 11777, 11778, 11779, 11203, 11204, 11347, 11348,
+    11349, 11491, 11492, 11493, 10917, 10918, 11061, 11062, 11065, 11205, 11206, 11209,
+    10633, 10634, 10777, 10778, 10779, 10921, 10922, 10923, 10059, 10060, 10203, 10204,
+    10205, 10635, 10636, 10637, 9773, 9774, 9917, 9918, 9919, 10061, 10062, 10063,
+    9487, 9488, 9631, 9632, 9633, 9775, 9776, 9777, 9201, 9202, 9345, 9346,
+    9347, 9489, 9490, 9491, 8915, 8916, 9059, 9060, 9061, 9203, 9204, 9205,
+    8629, 8630, 8773, 8774, 8775, 8917, 8918, 8919, 8343, 8344, 8487, 8488,
+    8489, 8631, 8632, 8633, 8057, 8058, 8201, 8202, 8203, 8345, 8346, 8347,
+    7771, 7772, 7915, 7916, 7917, 8059, 8060, 8061, 8204, 8205, 8348, 8349,
+    8350, 8492, 8493, 8494, 8490, 8491, 8634, 8635, 8636, 8778, 8779, 8780,
+    8776, 8777, 8920, 8921, 8922, 9064, 9065, 9066, 9062, 9063, 9206, 9207,
+    9208, 9350, 9351, 9352, 9348, 9349, 9492, 9493, 9494, 9636, 9637, 9638,
+    9634, 9635, 9778, 9779, 9780, 9922, 9923, 9924, 9920, 9921, 10064, 10065,
+    10066, 10208, 10209, 10210, 10206, 10207, 10638, 10639, 10640, 10782, 10783, 10784,
+    10780, 10781, 10924, 10925, 10926, 11068, 11069, 11070, 11066, 11067, 11210, 11211,
+    11212, 11354, 11355, 11356, 11350, 11353, 11494, 11497, 11498, 11638, 11641, 11642,
+    11636, 11637, 11780, 11781, 11782, 11924, 11925, 11926, 11922, 11923, 12066, 12067,
+    12068, 12210, 12211, 12212, 12208, 12209, 12352, 12353, 12354, 12496, 12497, 12498,
+    12494, 12495, 12638, 12639, 12640, 12782, 12783, 12784, 12780, 12781, 12924, 12925,
+    12926, 13068, 13069, 13070, 13066, 13067, 13210, 13211, 13212, 13354, 13355, 13356,
+    13352, 13353, 13496, 13497, 13498, 13640, 13641, 13642, 13638, 13639, 14070, 14071,
+    14072, 14214, 14215, 14216, 14212, 14213, 14356, 14357, 14358, 14500, 14501, 14502,
+    14498, 14499, 14642, 14643, 14644, 14786, 14787, 14788, 14782, 14785, 14926, 14929,
+    14930, 15070, 15073, 15074, 15068, 15069, 15212, 15213, 15214, 15356, 15357, 15358,
+    15354, 15355, 15498, 15499, 15500, 15642, 15643, 15644, 15640, 15641, 15784, 15785,
+    15786, 15928, 15929, 15930, 15926, 15927, 16070, 16071, 16072, 16214, 16215, 16216,
+    16212, 16213, 16356, 16357, 16358, 16500, 16501, 16502, 16498, 16499, 16642, 16643,
+    16644, 16786, 16787, 16788, 16784, 16785, 16928, 16929, 16930, 17072, 17073, 17074,
+    17070, 17071, 17502, 17503, 17504, 17646, 17647, 17648, 17644, 17645, 17788, 17789,
+    17790, 17932, 17933, 17934, 17930, 17931, 18074, 18075, 18076, 18218, 18219, 18220,
+    18214, 18217, 18358, 18361, 18362, 18502, 18505, 18506, 18500, 18501, 18644, 18645,
+    18646, 18788, 18789, 18790, 18786, 18787, 18930, 18931, 18932, 19074, 19075, 19076,
+    19072, 19073, 19216, 19217, 19218, 19360, 19361, 19362, 19358, 19359, 19502, 19503,
+    19504, 19646, 19647, 19648, 19644, 19645, 19788, 19789, 19790, 19932, 19933, 19934,
+    19930, 19931, 20074, 20075, 20076, 20218, 20219, 20220, 20216, 20217, 20360, 20361,
+    20362, 20504, 20505, 20506, 20077, 20078, 20221, 20222, 20223, 20365, 20366, 20367,
+    19791, 19792, 19935, 19936, 19937, 20079, 20080, 20081, 19505, 19506, 19649, 19650,
+    19651, 19793, 19794, 19795, 19219, 19220, 19363, 19364, 19365, 19507, 19508, 19509,
+    18933, 18934, 19077, 19078, 19081, 19221, 19222, 19225, 18649, 18650, 18793, 18794,
+    18795, 18937, 18938, 18939, 18363, 18364, 18507, 18508, 18509, 18651, 18652, 18653,
+    18077, 18078, 18221, 18222, 18223, 18365, 18366, 18367, 17791, 17792, 17935, 17936,
+    17937, 18079, 18080, 18081, 17505, 17506, 17649, 17650, 17651, 17793, 17794, 17795,
+    16931, 16932, 17075, 17076, 17077, 17507, 17508, 17509, 16645, 16646, 16789, 16790,
+    16791, 16933, 16934, 16935, 16359, 16360, 16503, 16504, 16505, 16647, 16648, 16649,
+    16073, 16074, 16217, 16218, 16219, 16361, 16362, 16363, 15787, 15788, 15931, 15932,
+    15933, 16075, 16076, 16077, 15501, 15502, 15645, 15646, 15649, 15789, 15790, 15793,
+    15217, 15218, 15361, 15362, 15363, 15505, 15506, 15507, 14931, 14932, 15075, 15076,
+    15077, 15219, 15220, 15221, 14645, 14646, 14789, 14790, 14791, 14933, 14934, 14935,
+    14359, 14360, 14503, 14504, 14505, 14647, 14648, 14649, 14073, 14074, 14217, 14218,
+    14219, 14361, 14362, 14363, 13499, 13500, 13643, 13644, 13645, 14075, 14076, 14077,
+    13213, 13214, 13357, 13358, 13359, 13501, 13502, 13503, 12927, 12928, 13071, 13072,
+    13073, 13215, 13216, 13217, 12641, 12642, 12785, 12786, 12787, 12929, 12930, 12931,
+    12355, 12356, 12499, 12500, 12501, 12643, 12644, 12645, 12069, 12070, 12213, 12214,
+    12217, 12357, 12358, 12361, 11785, 11786, 11929, 11930, 11931, 12073, 12074, 12075,
+    11499, 11500, 11643, 11644, 11645, 11787, 11788, 11789, 11213, 11214, 11357, 11358,
+    11359, 11501, 11502, 11503, 10927, 10928, 11071, 11072, 11073, 11215, 11216, 11217,
+    10641, 10642, 10785, 10786, 10787, 10929, 10930, 10931, 10067, 10068, 10211, 10212,
+    10213, 10643, 10644, 10645, 9781, 9782, 9925, 9926, 9927, 10069, 10070, 10071,
+    9495, 9496, 9639, 9640, 9641, 9783, 9784, 9785, 9209, 9210, 9353, 9354,
+    9355, 9497, 9498, 9499, 8923, 8924, 9067, 9068, 9069, 9211, 9212, 9213,
+    9356, 9357, 9500, 9501, 9502, 9644, 9645, 9646, 9642, 9643, 9786, 9787,
+    9788, 9930, 9931, 9932, 9928, 9929, 10072, 10073, 10074, 10216, 10217, 10218,
+    10214, 10215, 10646, 10647, 10648, 10790, 10791, 10792, 10788, 10789, 10932, 10933,
+    10934, 11076, 11077, 11078, 11074, 11075, 11218, 11219, 11220, 11362, 11363, 11364,
+    11360, 11361, 11504, 11505, 11506, 11648, 11649, 11650, 11646, 11647, 11790, 11791,
+    11792, 11934, 11935, 11936, 11932, 11933, 12076, 12077, 12078, 12220, 12221, 12222,
+    12218, 12219, 12362, 12363, 12364, 12506, 12507, 12508, 12502, 12505, 12646, 12649,
+    12650, 12790, 12793, 12794, 12788, 12789, 12932, 12933, 12934, 13076, 13077, 13078,
+    13074, 13075, 13218, 13219, 13220, 13362, 13363, 13364, 13360, 13361, 13504, 13505,
+    13506, 13648, 13649, 13650, 13646, 13647, 14078, 14079, 14080, 14222, 14223, 14224,
+    14220, 14221, 14364, 14365, 14366, 14508, 14509, 14510, 14506, 14507, 14650, 14651,
+    14652, 14794, 14795, 14796, 14792, 14793, 14936, 14937, 14938, 15080, 15081, 15082,
+    15078, 15079, 15222, 15223, 15224, 15366, 15367, 15368, 15364, 15365, 15508, 15509,
+    15510, 15652, 15653, 15654, 15650, 15651, 15794, 15795, 15796, 15938, 15939, 15940,
+    15934, 15937, 16078, 16081, 16082, 16222, 16225, 16226, 16220, 16221, 16364, 16365,
+    16366, 16508, 16509, 16510, 16506, 16507, 16650, 16651, 16652, 16794, 16795, 16796,
+    16792, 16793, 16936, 16937, 16938, 17080, 17081, 17082, 17078, 17079, 17510, 17511,
+    17512, 17654, 17655, 17656, 17652, 17653, 17796, 17797, 17798, 17940, 17941, 17942,
+    17938, 17939, 18082, 18083, 18084, 18226, 18227, 18228, 18224, 18225, 18368, 18369,
+    18370, 18512, 18513, 18514, 18510, 18511, 18654, 18655, 18656, 18798, 18799, 18800,
+    18796, 18797, 18940, 18941, 18942, 19084, 19085, 19086, 19082, 19083, 19226, 19227,
+    19228, 19370, 19371, 19372, 19366, 19369, 19510, 19513, 19514, 19654, 19657, 19658,
+    19652, 19653, 19796, 19797, 19798, 19940, 19941, 19942, 19938, 19939, 20082, 20083,
+    20084, 20226, 20227, 20228, 20224, 20225, 20368, 20369, 20370, 20512, 20513, 20514,
+    20085, 20086, 20229, 20230, 20233, 20373, 20374, 20377, 19801, 19802, 19945, 19946,
+    19947, 20089, 20090, 20091, 19515, 19516, 19659, 19660, 19661, 19803, 19804, 19805,
+    19229, 19230, 19373, 19374, 19375, 19517, 19518, 19519, 18943, 18944, 19087, 19088,
+    19089, 19231, 19232, 19233, 18657, 18658, 18801, 18802, 18803, 18945, 18946, 18947,
+    18371, 18372, 18515, 18516, 18517, 18659, 18660, 18661, 18085, 18086, 18229, 18230,
+    18231, 18373, 18374, 18375, 17799, 17800, 17943, 17944, 17945, 18087, 18088, 18089,
+    17513, 17514, 17657, 17658, 17659, 17801, 17802, 17803, 16939, 16940, 17083, 17084,
+    17085, 17515, 17516, 17517, 16653, 16654, 16797, 16798, 16801, 16941, 16942, 16945,
+    16369, 16370, 16513, 16514, 16515, 16657, 16658, 16659, 16083, 16084, 16227, 16228,
+    16229, 16371, 16372, 16373, 15797, 15798, 15941, 15942, 15943, 16085, 16086, 16087,
+    15511, 15512, 15655, 15656, 15657, 15799, 15800, 15801, 15225, 15226, 15369, 15370,
+    15371, 15513, 15514, 15515, 14939, 14940, 15083, 15084, 15085, 15227, 15228, 15229,
+    14653, 14654, 14797, 14798, 14799, 14941, 14942, 14943, 14367, 14368, 14511, 14512,
+    14513, 14655, 14656, 14657, 14081, 14082, 14225, 14226, 14227, 14369, 14370, 14371,
+    13507, 13508, 13651, 13652, 13653, 14083, 14084, 14085, 13221, 13222, 13365, 13366,
+    13369, 13509, 13510, 13513, 12937, 12938, 13081, 13082, 13083, 13225, 13226, 13227,
+    12651, 12652, 12795, 12796, 12797, 12939, 12940, 12941, 12365, 12366, 12509, 12510,
+    12511, 12653, 12654, 12655, 12079, 12080, 12223, 12224, 12225, 12367, 12368, 12369,
+    11793, 11794, 11937, 11938, 11939, 12081, 12082, 12083, 11507, 11508, 11651, 11652,
+    11653, 11795, 11796, 11797, 11221, 11222, 11365, 11366, 11367, 11509, 11510, 11511,
+    10935, 10936, 11079, 11080, 11081, 11223, 11224, 11225, 10649, 10650, 10793, 10794,
+    10795, 10937, 10938, 10939, 10075, 10076, 10219, 10220, 10221, 10651, 10652, 10653,
+    10796, 10797, 10940, 10941, 10942, 11084, 11085, 11086, 11082, 11083, 11226, 11227,
+    11228, 11370, 11371, 11372, 11368, 11369, 11512, 11513, 11514, 11656, 11657, 11658,
+    11654, 11655, 11798, 11799, 11800, 11942, 11943, 11944, 11940, 11941, 12084, 12085,
+    12086, 12228, 12229, 12230, 12226, 12227, 12370, 12371, 12372, 12514, 12515, 12516,
+    12512, 12513, 12656, 12657, 12658, 12800, 12801, 12802, 12798, 12799, 12942, 12943,
+    12944, 13086, 13087, 13088, 13084, 13085, 13228, 13229, 13230, 13372, 13373, 13374,
+    13370, 13371, 13514, 13515, 13516, 13658, 13659, 13660, 13654, 13657, 14086, 14089,
+    14090, 14230, 14233, 14234, 14228, 14229, 14372, 14373, 14374, 14516, 14517, 14518,
+    14514, 14515, 14658, 14659, 14660, 14802, 14803, 14804, 14800, 14801, 14944, 14945,
+    14946, 15088, 15089, 15090, 15086, 15087, 15230, 15231, 15232, 15374, 15375, 15376,
+    15372, 15373, 15516, 15517, 15518, 15660, 15661, 15662, 15658, 15659, 15802, 15803,
+    15804, 15946, 15947, 15948, 15944, 15945, 16088, 16089, 16090, 16232, 16233, 16234,
+    16230, 16231, 16374, 16375, 16376, 16518, 16519, 16520, 16516, 16517, 16660, 16661,
+    16662, 16804, 16805, 16806, 16802, 16803, 16946, 16947, 16948, 17090, 17091, 17092,
+    17086, 17089, 17518, 17521, 17522, 17662, 17665, 17666, 17660, 17661, 17804, 17805,
+    17806, 17948, 17949, 17950, 17946, 17947, 18090, 18091, 18092, 18234, 18235, 18236,
+    18232, 18233, 18376, 18377, 18378, 18520, 18521, 18522, 18518, 18519, 18662, 18663,
+    18664, 18806, 18807, 18808, 18804, 18805, 18948, 18949, 18950, 19092, 19093, 19094,
+    19090, 19091, 19234, 19235, 19236, 19378, 19379, 19380, 19376, 19377, 19520, 19521,
+    19522, 19664, 19665, 19666, 19662, 19663, 19806, 19807, 19808, 19950, 19951, 19952,
+    19948, 19949, 20092, 20093, 20094, 20236, 20237, 20238, 20234, 20235, 20378, 20379,
+    20380, 20522, 20523, 20524, 20095, 20096, 20239, 20240, 20241, 20383, 20384, 20385,
+    19809, 19810, 19953, 19954, 19955, 20097, 20098, 20099, 19523, 19524, 19667, 19668,
+    19669, 19811, 19812, 19813, 19237, 19238, 19381, 19382, 19383, 19525, 19526, 19527,
+    18951, 18952, 19095, 19096, 19097, 19239, 19240, 19241, 18665, 18666, 18809, 18810,
+    18811, 18953, 18954, 18955, 18379, 18380, 18523, 18524, 18525, 18667, 18668, 18669,
+    18093, 18094, 18237, 18238, 18241, 18381, 18382, 18385, 17809, 17810, 17953, 17954,
+    17955, 18097, 18098, 18099, 17523, 17524, 17667, 17668, 17669, 17811, 17812, 17813,
+    16949, 16950, 17093, 17094, 17095, 17525, 17526, 17527, 16663, 16664, 16807, 16808,
+    16809, 16951, 16952, 16953, 16377, 16378, 16521, 16522, 16523, 16665, 16666, 16667,
+    16091, 16092, 16235, 16236, 16237, 16379, 16380, 16381, 15805, 15806, 15949, 15950,
+    15951, 16093, 16094, 16095, 15519, 15520, 15663, 15664, 15665, 15807, 15808, 15809,
+    15233, 15234, 15377, 15378, 15379, 15521, 15522, 15523, 14947, 14948, 15091, 15092,
+    15093, 15235, 15236, 15237, 14661, 14662, 14805, 14806, 14809, 14949, 14950, 14953,
+    14377, 14378, 14521, 14522, 14523, 14665, 14666, 14667, 14091, 14092, 14235, 14236,
+    14237, 14379, 14380, 14381, 13517, 13518, 13661, 13662, 13663, 14093, 14094, 14095,
+    13231, 13232, 13375, 13376, 13377, 13519, 13520, 13521, 12945, 12946, 13089, 13090,
+    13091, 13233, 13234, 13235, 12659, 12660, 12803, 12804, 12805, 12947, 12948, 12949,
+    12373, 12374, 12517, 12518, 12519, 12661, 12662, 12663, 12087, 12088, 12231, 12232,
+    12233, 12375, 12376, 12377, 11801, 11802, 11945, 11946, 11947, 12089, 12090, 12091,
+    11515, 11516, 11659, 11660, 11661, 11803, 11804, 11805, 11948, 11949, 12092, 12093,
+    12094, 12236, 12237, 12238, 12234, 12235, 12378, 12379, 12380, 12522, 12523, 12524,
+    12520, 12521, 12664, 12665, 12666, 12808, 12809, 12810, 12806, 12807, 12950, 12951,
+    12952, 13094, 13095, 13096, 13092, 13093, 13236, 13237, 13238, 13380, 13381, 13382,
+    13378, 13379, 13522, 13523, 13524, 13666, 13667, 13668, 13664, 13665, 14096, 14097,
+    14098, 14240, 14241, 14242, 14238, 14239, 14382, 14383, 14384, 14526, 14527, 14528,
+    14524, 14525, 14668, 14669, 14670, 14812, 14813, 14814, 14810, 14811, 14954, 14955,
+    14956, 15098, 15099, 15100, 15094, 15097, 15238, 15241, 15242, 15382, 15385, 15386,
+    15380, 15381, 15524, 15525, 15526, 15668, 15669, 15670, 15666, 15667, 15810, 15811,
+    15812, 15954, 15955, 15956, 15952, 15953, 16096, 16097, 16098, 16240, 16241, 16242,
+    16238, 16239, 16382, 16383, 16384, 16526, 16527, 16528, 16524, 16525, 16668, 16669,
+    16670, 16812, 16813, 16814, 16810, 16811, 16954, 16955, 16956, 17098, 17099, 17100,
+    17096, 17097, 17528, 17529, 17530, 17672, 17673, 17674, 17670, 17671, 17814, 17815,
+    17816, 17958, 17959, 17960, 17956, 17957, 18100, 18101, 18102, 18244, 18245, 18246,
+    18242, 18243, 18386, 18387, 18388, 18530, 18531, 18532, 18526, 18529, 18670, 18673,
+    18674, 18814, 18817, 18818, 18812, 18813, 18956, 18957, 18958, 19100, 19101, 19102,
+    19098, 19099, 19242, 19243, 19244, 19386, 19387, 19388, 19384, 19385, 19528, 19529,
+    19530, 19672, 19673, 19674, 19670, 19671, 19814, 19815, 19816, 19958, 19959, 19960,
+    19956, 19957, 20100, 20101, 20102, 20244, 20245, 20246, 20242, 20243, 20386, 20387,
+    20388, 20530, 20531, 20532, 20103, 20104, 20247, 20248, 20249, 20391, 20392, 20393,
+    19817, 19818, 19961, 19962, 19963, 20105, 20106, 20107, 19531, 19532, 19675, 19676,
+    19677, 19819, 19820, 19821, 19245, 19246, 19389, 19390, 19393, 19533, 19534, 19537,
+    18961, 18962, 19105, 19106, 19107, 19249, 19250, 19251, 18675, 18676, 18819, 18820,
+    18821, 18963, 18964, 18965, 18389, 18390, 18533, 18534, 18535, 18677, 18678, 18679,
+    18103, 18104, 18247, 18248, 18249, 18391, 18392, 18393, 17817, 17818, 17961, 17962,
+    17963, 18105, 18106, 18107, 17531, 17532, 17675, 17676, 17677, 17819, 17820, 17821,
+    16957, 16958, 17101, 17102, 17103, 17533, 17534, 17535, 16671, 16672, 16815, 16816,
+    16817, 16959, 16960, 16961, 16385, 16386, 16529, 16530, 16531, 16673, 16674, 16675,
+    16099, 16100, 16243, 16244, 16245, 16387, 16388, 16389, 15813, 15814, 15957, 15958,
+    15961, 16101, 16102, 16105, 15529, 15530, 15673, 15674, 15675, 15817, 15818, 15819,
+    15243, 15244, 15387, 15388, 15389, 15531, 15532, 15533, 14957, 14958, 15101, 15102,
+    15103, 15245, 15246, 15247, 14671, 14672, 14815, 14816, 14817, 14959, 14960, 14961,
+    14385, 14386, 14529, 14530, 14531, 14673, 14674, 14675, 14099, 14100, 14243, 14244,
+    14245, 14387, 14388, 14389, 13525, 13526, 13669, 13670, 13671, 14101, 14102, 14103,
+    13239, 13240, 13383, 13384, 13385, 13527, 13528, 13529, 12953, 12954, 13097, 13098,
+    13099, 13241, 13242, 13243, 12667, 12668, 12811, 12812, 12813, 12955, 12956, 12957,
+    13100, 13101, 13244, 13245, 13246, 13388, 13389, 13390, 13386, 13387, 13530, 13531,
+    13532, 13674, 13675, 13676, 13672, 13673, 14104, 14105, 14106, 14248, 14249, 14250,
+    14246, 14247, 14390, 14391, 14392, 14534, 14535, 14536, 14532, 14533, 14676, 14677,
+    14678, 14820, 14821, 14822, 14818, 14819, 14962, 14963, 14964, 15106, 15107, 15108,
+    15104, 15105, 15248, 15249, 15250, 15392, 15393, 15394, 15390, 15391, 15534, 15535,
+    15536, 15678, 15679, 15680, 15676, 15677, 15820, 15821, 15822, 15964, 15965, 15966,
+    15962, 15963, 16106, 16107, 16108, 16250, 16251, 16252, 16246, 16249, 16390, 16393,
+    16394, 16534, 16537, 16538, 16532, 16533, 16676, 16677, 16678, 16820, 16821, 16822,
+    16818, 16819, 16962, 16963, 16964, 17106, 17107, 17108, 17104, 17105, 17536, 17537,
+    17538, 17680, 17681, 17682, 17678, 17679, 17822, 17823, 17824, 17966, 17967, 17968,
+    17964, 17965, 18108, 18109, 18110, 18252, 18253, 18254, 18250, 18251, 18394, 18395,
+    18396, 18538, 18539, 18540, 18536, 18537, 18680, 18681, 18682, 18824, 18825, 18826,
+    18822, 18823, 18966, 18967, 18968, 19110, 19111, 19112, 19108, 19109, 19252, 19253,
+    19254, 19396, 19397, 19398, 19394, 19395, 19538, 19539, 19540, 19682, 19683, 19684,
+    19678, 19681, 19822, 19825, 19826, 19966, 19969, 19970, 19964, 19965, 20108, 20109,
+    20110, 20252, 20253, 20254, 20250, 20251, 20394, 20395, 20396, 20538, 20539, 20540,
+    20113, 20114, 20257, 20258, 20259, 20401, 20402, 20403, 19827, 19828, 19971, 19972,
+    19973, 20115, 20116, 20117, 19541, 19542, 19685, 19686, 19687, 19829, 19830, 19831,
+    19255, 19256, 19399, 19400, 19401, 19543, 19544, 19545, 18969, 18970, 19113, 19114,
+    19115, 19257, 19258, 19259, 18683, 18684, 18827, 18828, 18829, 18971, 18972, 18973,
+    18397, 18398, 18541, 18542, 18543, 18685, 18686, 18687, 18111, 18112, 18255, 18256,
+    18257, 18399, 18400, 18401, 17825, 17826, 17969, 17970, 17971, 18113, 18114, 18115,
+    17539, 17540, 17683, 17684, 17685, 17827, 17828, 17829, 16965, 16966, 17109, 17110,
+    17113, 17541, 17542, 17545, 16681, 16682, 16825, 16826, 16827, 16969, 16970, 16971,
+    16395, 16396, 16539, 16540, 16541, 16683, 16684, 16685, 16109, 16110, 16253, 16254,
+    16255, 16397, 16398, 16399, 15823, 15824, 15967, 15968, 15969, 16111, 16112, 16113,
+    15537, 15538, 15681, 15682, 15683, 15825, 15826, 15827, 15251, 15252, 15395, 15396,
+    15397, 15539, 15540, 15541, 14965, 14966, 15109, 15110, 15111, 15253, 15254, 15255,
+    14679, 14680, 14823, 14824, 14825, 14967, 14968, 14969, 14393, 14394, 14537, 14538,
+    14539, 14681, 14682, 14683, 14107, 14108, 14251, 14252, 14253, 14395, 14396, 14397,
+    14540, 14541, 14684, 14685, 14686, 14828, 14829, 14830, 14826, 14827, 14970, 14971,
+    14972, 15114, 15115, 15116, 15112, 15113, 15256, 15257, 15258, 15400, 15401, 15402,
+    15398, 15399, 15542, 15543, 15544, 15686, 15687, 15688, 15684, 15685, 15828, 15829,
+    15830, 15972, 15973, 15974, 15970, 15971, 16114, 16115, 16116, 16258, 16259, 16260,
+    16256, 16257, 16400, 16401, 16402, 16544, 16545, 16546, 16542, 16543, 16686, 16687,
+    16688, 16830, 16831, 16832, 16828, 16829, 16972, 16973, 16974, 17116, 17117, 17118,
+    17114, 17115, 17546, 17547, 17548, 17690, 17691, 17692, 17686, 17689, 17830, 17833,
+    17834, 17974, 17977, 17978, 17972, 17973, 18116, 18117, 18118, 18260, 18261, 18262,
+    18258, 18259, 18402, 18403, 18404, 18546, 18547, 18548, 18544, 18545, 18688, 18689,
+    18690, 18832, 18833, 18834, 18830, 18831, 18974, 18975, 18976, 19118, 19119, 19120,
+    19116, 19117, 19260, 19261, 19262, 19404, 19405, 19406, 19402, 19403, 19546, 19547,
+    19548, 19690, 19691, 19692, 19688, 19689, 19832, 19833, 19834, 19976, 19977, 19978,
+    19974, 19975, 20118, 20119, 20120, 20262, 20263, 20264, 20260, 20261, 20404, 20405,
+    20406, 20548, 20549, 20550, 20121, 20122, 20265, 20266, 20267, 20409, 20410, 20411,
+    19835, 19836, 19979, 19980, 19981, 20123, 20124, 20125, 19549, 19550, 19693, 19694,
+    19695, 19837, 19838, 19839, 19263, 19264, 19407, 19408, 19409, 19551, 19552, 19553,
+    18977, 18978, 19121, 19122, 19123, 19265, 19266, 19267, 18691, 18692, 18835, 18836,
+    18837, 18979, 18980, 18981, 18405, 18406, 18549, 18550, 18553, 18693, 18694, 18697,
+    18121, 18122, 18265, 18266, 18267, 18409, 18410, 18411, 17835, 17836, 17979, 17980,
+    17981, 18123, 18124, 18125, 17549, 17550, 17693, 17694, 17695, 17837, 17838, 17839,
+    16975, 16976, 17119, 17120, 17121, 17551, 17552, 17553, 16689, 16690, 16833, 16834,
+    16835, 16977, 16978, 16979, 16403, 16404, 16547, 16548, 16549, 16691, 16692, 16693,
+    16117, 16118, 16261, 16262, 16263, 16405, 16406, 16407, 15831, 15832, 15975, 15976,
+    15977, 16119, 16120, 16121, 15545, 15546, 15689, 15690, 15691, 15833, 15834, 15835,
+    15259, 15260, 15403, 15404, 15405, 15547, 15548, 15549, 15692, 15693, 15836, 15837,
+    15838, 15980, 15981, 15982, 15978, 15979, 16122, 16123, 16124, 16266, 16267, 16268,
+    16264, 16265, 16408, 16409, 16410, 16552, 16553, 16554, 16550, 16551, 16694, 16695,
+    16696, 16838, 16839, 16840, 16836, 16837, 16980, 16981, 16982, 17124, 17125, 17126,
+    17122, 17123, 17554, 17555, 17556, 17698, 17699, 17700, 17696, 17697, 17840, 17841,
+    17842, 17984, 17985, 17986, 17982, 17983, 18126, 18127, 18128, 18270, 18271, 18272,
+    18268, 18269, 18412, 18413, 18414, 18556, 18557, 18558, 18554, 18555, 18698, 18699,
+    18700, 18842, 18843, 18844, 18838, 18841, 18982, 18985, 18986, 19126, 19129, 19130,
+    19124, 19125, 19268, 19269, 19270, 19412, 19413, 19414, 19410, 19411, 19554, 19555,
+    19556, 19698, 19699, 19700, 19696, 19697, 19840, 19841, 19842, 19984, 19985, 19986,
+    19982, 19983, 20126, 20127, 20128, 20270, 20271, 20272, 20268, 20269, 20412, 20413,
+    20414, 20556, 20557, 20558, 20129, 20130, 20273, 20274, 20275, 20417, 20418, 20419,
+    19843, 19844, 19987, 19988, 19989, 20131, 20132, 20133, 19557, 19558, 19701, 19702,
+    19705, 19845, 19846, 19849, 19273, 19274, 19417, 19418, 19419, 19561, 19562, 19563,
+    18987, 18988, 19131, 19132, 19133, 19275, 19276, 19277, 18701, 18702, 18845, 18846,
+    18847, 18989, 18990, 18991, 18415, 18416, 18559, 18560, 18561, 18703, 18704, 18705,
+    18129, 18130, 18273, 18274, 18275, 18417, 18418, 18419, 17843, 17844, 17987, 17988,
+    17989, 18131, 18132, 18133, 17557, 17558, 17701, 17702, 17703, 17845, 17846, 17847,
+    16983, 16984, 17127, 17128, 17129, 17559, 17560, 17561, 16697, 16698, 16841, 16842,
+    16843, 16985, 16986, 16987, 16411, 16412, 16555, 16556, 16557, 16699, 16700, 16701,
+    16844, 16845, 16988, 16989, 16990, 17132, 17133, 17134, 17130, 17131, 17562, 17563,
+    17564, 17706, 17707, 17708, 17704, 17705, 17848, 17849, 17850, 17992, 17993, 17994,
+    17990, 17991, 18134, 18135, 18136, 18278, 18279, 18280, 18276, 18277, 18420, 18421,
+    18422, 18564, 18565, 18566, 18562, 18563, 18706, 18707, 18708, 18850, 18851, 18852,
+    18848, 18849, 18992, 18993, 18994, 19136, 19137, 19138, 19134, 19135, 19278, 19279,
+    19280, 19422, 19423, 19424, 19420, 19421, 19564, 19565, 19566, 19708, 19709, 19710,
+    19706, 19707, 19850, 19851, 19852, 19994, 19995, 19996, 19990, 19993, 20134, 20137,
+    20138, 20278, 20281, 20282, 20276, 20277, 20420, 20421, 20422, 20564, 20565, 20566,
+    20139, 20140, 20283, 20284, 20285, 20427, 20428, 20429, 19853, 19854, 19997, 19998,
+    19999, 20141, 20142, 20143, 19567, 19568, 19711, 19712, 19713, 19855, 19856, 19857,
+    19281, 19282, 19425, 19426, 19427, 19569, 19570, 19571, 18995, 18996, 19139, 19140,
+    19141, 19283, 19284, 19285, 18709, 18710, 18853, 18854, 18855, 18997, 18998, 18999,
+    18423, 18424, 18567, 18568, 18569, 18711, 18712, 18713, 18137, 18138, 18281, 18282,
+    18283, 18425, 18426, 18427, 17851, 17852, 17995, 17996, 17997, 18139, 18140, 18141,
+    18284, 18285, 18428, 18429, 18430, 18572, 18573, 18574, 18570, 18571, 18714, 18715,
+    18716, 18858, 18859, 18860, 18856, 18857, 19000, 19001, 19002, 19144, 19145, 19146,
+    19142, 19143, 19286, 19287, 19288, 19430, 19431, 19432, 19428, 19429, 19572, 19573,
+    19574, 19716, 19717, 19718, 19714, 19715, 19858, 19859, 19860, 20002, 20003, 20004,
+    20000, 20001, 20144, 20145, 20146, 20288, 20289, 20290, 20286, 20287, 20430, 20431,
+    20432, 20574, 20575, 20576, 20147, 20148, 20291, 20292, 20293, 20435, 20436, 20437,
+    19861, 19862, 20005, 20006, 20007, 20149, 20150, 20151, 19575, 19576, 19719, 19720,
+    19721, 19863, 19864, 19865, 19289, 19290, 19433, 19434, 19435, 19577, 19578, 19579,
+    19003, 19004, 19147, 19148, 19149, 19291, 19292, 19293, 19436, 19437, 19580, 19581,
+    19582, 19724, 19725, 19726, 19722, 19723, 19866, 19867, 19868, 20010, 20011, 20012,
+    20008, 20009, 20152, 20153, 20154, 20296, 20297, 20298, 20294, 20295, 20438, 20439,
+    20440, 20582, 20583, 20584, 20155, 20156, 20299, 20300, 20301, 20443, 20444, 20445,
+};
+
+static const uint16_t bits_24[96] = {
+    69, 70, 87, 88, 73, 105, 106, 91, 19, 20, 37, 38,
+    39, 55, 56, 57, 95, 96, 113, 114, 115, 21, 22, 23,
+    116, 117, 24, 25, 26, 42, 43, 44, 40, 41, 58, 59,
+    60, 76, 77, 78, 74, 75, 92, 93, 94, 110, 111, 112,
+    109, 124, 32, 33, 34, 50, 51, 52, 61, 62, 79, 80,
+    81, 97, 98, 99, 27, 28, 45, 46, 47, 63, 64, 65,
+    103, 104, 121, 122, 123, 29, 30, 31, 48, 49, 66, 67,
+    68, 84, 85, 86, 82, 83, 100, 101, 102, 118, 119, 120,
+};
+
+static const uint16_t bits_25[168] = {
+    129, 161, 193, 61, 62, 94, 126, 158, 33, 34, 65, 66,
+    67, 97, 98, 99, 165, 166, 197, 198, 199, 35, 36, 37,
+    200, 201, 38, 39, 40, 70, 71, 72, 68, 69, 100, 101,
+    102, 132, 133, 134, 130, 131, 162, 163, 164, 194, 195, 196,
+    103, 104, 135, 136, 137, 167, 168, 169, 41, 42, 73, 74,
+    75, 105, 106, 107, 173, 174, 205, 206, 209, 43, 44, 45,
+    210, 211, 46, 49, 50, 78, 81, 82, 76, 77, 108, 109,
+    110, 140, 141, 142, 138, 139, 170, 171, 172, 202, 203, 204,
+    113, 114, 145, 146, 147, 177, 178, 179, 51, 52, 83, 84,
+    85, 115, 116, 117, 183, 184, 215, 216, 217, 53, 54, 55,
+    218, 219, 56, 57, 58, 88, 89, 90, 86, 87, 118, 119,
+    120, 150, 151, 152, 148, 149, 180, 181, 182, 212, 213, 214,
+    121, 122, 153, 154, 155, 185, 186, 187, 59, 60, 91, 92,
+    93, 123, 124, 125, 156, 157, 188, 189, 190, 220, 221, 222,
+};
+
+static const uint16_t bits_26[240] = {
+    101, 102, 127, 128, 105, 153, 154, 131, 27, 28, 53, 54,
+    55, 79, 80, 81, 235, 236, 261, 262, 263, 29, 30, 31,
+    264, 265, 32, 33, 34, 58, 59, 60, 56, 57, 82, 83,
+    84, 108, 109, 110, 106, 107, 132, 133, 134, 158, 159, 160,
+    180, 157, 206, 183, 184, 232, 209, 210, 185, 186, 211, 212,
+    213, 237, 238, 239, 135, 136, 161, 162, 163, 187, 188, 189,
+    85, 86, 111, 112, 113, 137, 138, 139, 35, 36, 61, 62,
+    63, 87, 88, 89, 243, 244, 269, 270, 271, 37, 38, 39,
+    272, 273, 40, 41, 42, 66, 67, 68, 64, 65, 90, 91,
+    92, 116, 117, 118, 114, 115, 140, 141, 142, 166, 167, 168,
+    164, 165, 190, 191, 192, 216, 217, 218, 214, 215, 240, 241,
+    242, 266, 267, 268, 193, 194, 219, 220, 221, 245, 246, 247,
+    143, 144, 169, 170, 171, 195, 196, 197, 93, 94, 119, 120,
+    121, 145, 146, 147, 43, 44, 69, 70, 71, 95, 96, 97,
+    251, 252, 277, 278, 279, 45, 46, 47, 280, 281, 48, 49,
+    50, 74, 75, 76, 72, 73, 98, 99, 100, 124, 125, 126,
+    122, 123, 148, 149, 150, 174, 175, 176, 172, 173, 198, 199,
+    200, 224, 225, 226, 222, 223, 248, 249, 250, 274, 275, 276,
+    201, 202, 227, 228, 229, 253, 254, 255, 151, 152, 177, 178,
+    179, 203, 204, 205, 230, 231, 256, 257, 258, 282, 283, 284,
+};
+
+static const uint16_t bits_27[320] = {
+    141, 142, 177, 178, 145, 213, 214, 181, 37, 38, 73, 74,
+    75, 109, 110, 111, 325, 326, 361, 362, 363, 39, 40, 41,
+    364, 365, 42, 43, 44, 78, 79, 80, 76, 77, 112, 113,
+    114, 148, 149, 150, 146, 147, 182, 183, 184, 218, 219, 220,
+    250, 217, 286, 253, 254, 322, 289, 290, 255, 256, 291, 292,
+    293, 327, 328, 329, 185, 186, 221, 222, 223, 257, 258, 259,
+    115, 116, 151, 152, 153, 187, 188, 189, 45, 46, 81, 82,
+    83, 117, 118, 119, 333, 334, 369, 370, 371, 47, 48, 49,
+    372, 373, 50, 51, 52, 86, 87, 88, 84, 85, 120, 121,
+    122, 156, 157, 158, 154, 155, 190, 191, 192, 226, 227, 228,
+    224, 225, 260, 261, 262, 296, 297, 298, 294, 295, 330, 331,
+    332, 366, 367, 368, 263, 264, 299, 300, 301, 335, 336, 337,
+    193, 194, 229, 230, 231, 265, 266, 267, 123, 124, 159, 160,
+    163, 195, 196, 199, 55, 56, 91, 92, 93, 127, 128, 129,
+    343, 344, 379, 380, 381, 57, 58, 59, 382, 383, 60, 61,
+    62, 96, 97, 98, 94, 95, 130, 131, 132, 166, 167, 168,
+    164, 165, 200, 201, 202, 236, 237, 238, 232, 235, 268, 271,
+    272, 304, 307, 308, 302, 303, 338, 339, 340, 374, 375, 376,
+    273, 274, 309, 310, 311, 345, 346, 347, 203, 204, 239, 240,
+    241, 275, 276, 277, 133, 134, 169, 170, 171, 205, 206, 207,
+    63, 64, 99, 100, 101, 135, 136, 137, 351, 352, 387, 388,
+    389, 65, 66, 67, 390, 391, 68, 69, 70, 104, 105, 106,
+    102, 103, 138, 139, 140, 174, 175, 176, 172, 173, 208, 209,
+    210, 244, 245, 246, 242, 243, 278, 279, 280, 314, 315, 316,
+    312, 313, 348, 349, 350, 384, 385, 386, 281, 282, 317, 318,
+    319, 353, 354, 355, 211, 212, 247, 248, 249, 283, 284, 285,
+    320, 321, 356, 357, 358, 392, 393, 394,
+};
+
+static const uint16_t bits_28[448] = {
+    141, 142, 177, 178, 145, 213, 214, 181, 37, 38, 73, 74,
+    75, 109, 110, 111, 473, 474, 509, 510, 511, 39, 40, 41,
+    512, 513, 42, 43, 44, 78, 79, 80, 76, 77, 112, 113,
+    114, 148, 149, 150, 146, 147, 182, 183, 184, 218, 219, 220,
+    250, 217, 286, 253, 254, 322, 289, 290, 429, 430, 465, 466,
+    433, 501, 502, 469, 325, 326, 361, 362, 363, 397, 398, 399,
+    255, 256, 291, 292, 293, 327, 328, 329, 185, 186, 221, 222,
+    223, 257, 258, 259, 115, 116, 151, 152, 153, 187, 188, 189,
+    45, 46, 81, 82, 83, 117, 118, 119, 481, 482, 517, 518,
+    519, 47, 48, 49, 520, 523, 50, 51, 52, 86, 87, 88,
+    84, 85, 120, 121, 122, 156, 157, 158, 154, 155, 190, 191,
+    192, 226, 227, 228, 224, 225, 260, 261, 262, 296, 297, 298,
+    294, 295, 330, 331, 332, 366, 367, 368, 364, 365, 400, 401,
+    402, 436, 437, 438, 434, 435, 470, 471, 472, 506, 507, 508,
+    505, 538, 68, 69, 70, 104, 105, 106, 403, 404, 439, 440,
+    441, 475, 476, 477, 333, 334, 369, 370, 371, 405, 406, 407,
+    263, 264, 299, 300, 301, 335, 336, 337, 193, 194, 229, 230,
+    231, 265, 266, 267, 123, 124, 159, 160, 163, 195, 196, 199,
+    55, 56, 91, 92, 93, 127, 128, 129, 491, 492, 527, 528,
+    529, 57, 58, 59, 530, 531, 60, 61, 62, 96, 97, 98,
+    94, 95, 130, 131, 132, 166, 167, 168, 164, 165, 200, 201,
+    202, 236, 237, 238, 232, 235, 268, 271, 272, 304, 307, 308,
+    302, 303, 338, 339, 340, 374, 375, 376, 372, 373, 408, 409,
+    410, 444, 445, 446, 442, 443, 478, 479, 480, 514, 515, 516,
+    411, 412, 447, 448, 451, 483, 484, 487, 343, 344, 379, 380,
+    381, 415, 416, 417, 273, 274, 309, 310, 311, 345, 346, 347,
+    203, 204, 239, 240, 241, 275, 276, 277, 133, 134, 169, 170,
+    171, 205, 206, 207, 63, 64, 99, 100, 101, 135, 136, 137,
+    499, 500, 535, 536, 537, 65, 66, 67, 102, 103, 138, 139,
+    140, 174, 175, 176, 172, 173, 208, 209, 210, 244, 245, 246,
+    242, 243, 278, 279, 280, 314, 315, 316, 312, 313, 348, 349,
+    350, 384, 385, 386, 382, 383, 418, 419, 420, 454, 455, 456,
+    452, 453, 488, 489, 490, 524, 525, 526, 421, 422, 457, 458,
+    459, 493, 494, 495, 351, 352, 387, 388, 389, 423, 424, 425,
+    281, 282, 317, 318, 319, 353, 354, 355, 211, 212, 247, 248,
+    249, 283, 284, 285, 320, 321, 356, 357, 358, 392, 393, 394,
+    390, 391, 426, 427, 428, 462, 463, 464, 460, 461, 496, 497,
+    498, 532, 533, 534,
+};
+
+static const uint16_t bits_29[616] = {
+    381, 382, 429, 430, 193, 477, 478, 241, 49, 50, 97, 98,
+    99, 145, 146, 147, 629, 630, 677, 678, 679, 51, 52, 53,
+    680, 681, 54, 55, 56, 102, 103, 104, 100, 101, 148, 149,
+    150, 196, 197, 198, 194, 195, 242, 243, 244, 290, 291, 292,
+    526, 289, 574, 337, 338, 622, 385, 386, 577, 625, 673, 93,
+    94, 142, 190, 238, 433, 434, 481, 482, 483, 529, 530, 531,
+    339, 340, 387, 388, 389, 435, 436, 437, 245, 246, 293, 294,
+    295, 341, 342, 343, 151, 152, 199, 200, 201, 247, 248, 249,
+    57, 58, 105, 106, 107, 153, 154, 155, 637, 638, 685, 686,
+    687, 59, 60, 61, 688, 689, 62, 63, 64, 110, 111, 112,
+    108, 109, 156, 157, 158, 204, 205, 206, 202, 203, 250, 251,
+    252, 298, 299, 300, 296, 297, 344, 345, 346, 392, 393, 394,
+    390, 391, 438, 439, 440, 486, 487, 488, 484, 485, 532, 533,
+    534, 580, 581, 582, 578, 579, 626, 627, 628, 674, 675, 676,
+    535, 536, 583, 584, 585, 631, 632, 633, 441, 442, 489, 490,
+    491, 537, 538, 539, 347, 348, 395, 396, 397, 443, 444, 445,
+    253, 254, 301, 302, 303, 349, 350, 351, 159, 160, 207, 208,
+    209, 255, 256, 257, 65, 66, 113, 114, 115, 161, 162, 163,
+    645, 646, 693, 694, 697, 67, 68, 69, 698, 699, 70, 73,
+    74, 118, 121, 122, 116, 117, 164, 165, 166, 212, 213, 214,
+    210, 211, 258, 259, 260, 306, 307, 308, 304, 305, 352, 353,
+    354, 400, 401, 402, 398, 399, 446, 447, 448, 494, 495, 496,
+    492, 493, 540, 541, 542, 588, 589, 590, 586, 587, 634, 635,
+    636, 682, 683, 684, 543, 544, 591, 592, 593, 639, 640, 641,
+    449, 450, 497, 498, 499, 545, 546, 547, 355, 356, 403, 404,
+    405, 451, 452, 453, 261, 262, 309, 310, 313, 357, 358, 361,
+    169, 170, 217, 218, 219, 265, 266, 267, 75, 76, 123, 124,
+    125, 171, 172, 173, 655, 656, 703, 704, 705, 77, 78, 79,
+    706, 707, 80, 81, 82, 128, 129, 130, 126, 127, 174, 175,
+    176, 222, 223, 224, 220, 221, 268, 269, 270, 316, 317, 318,
+    314, 315, 362, 363, 364, 410, 411, 412, 406, 409, 454, 457,
+    458, 502, 505, 506, 500, 501, 548, 549, 550, 596, 597, 598,
+    594, 595, 642, 643, 644, 690, 691, 692, 553, 554, 601, 602,
+    603, 649, 650, 651, 459, 460, 507, 508, 509, 555, 556, 557,
+    365, 366, 413, 414, 415, 461, 462, 463, 271, 272, 319, 320,
+    321, 367, 368, 369, 177, 178, 225, 226, 227, 273, 274, 275,
+    83, 84, 131, 132, 133, 179, 180, 181, 663, 664, 711, 712,
+    713, 85, 86, 87, 714, 715, 88, 89, 90, 136, 137, 138,
+    134, 135, 182, 183, 184, 230, 231, 232, 228, 229, 276, 277,
+    278, 324, 325, 326, 322, 323, 370, 371, 372, 418, 419, 420,
+    416, 417, 464, 465, 466, 512, 513, 514, 510, 511, 558, 559,
+    560, 606, 607, 608, 604, 605, 652, 653, 654, 700, 701, 702,
+    561, 562, 609, 610, 611, 657, 658, 659, 467, 468, 515, 516,
+    517, 563, 564, 565, 373, 374, 421, 422, 423, 469, 470, 471,
+    279, 280, 327, 328, 329, 375, 376, 377, 185, 186, 233, 234,
+    235, 281, 282, 283, 91, 92, 139, 140, 141, 187, 188, 189,
+    236, 237, 284, 285, 286, 332, 333, 334, 330, 331, 378, 379,
+    380, 426, 427, 428, 424, 425, 472, 473, 474, 520, 521, 522,
+    518, 519, 566, 567, 568, 614, 615, 616, 612, 613, 660, 661,
+    662, 708, 709, 710, 569, 570, 617, 618, 619, 665, 666, 667,
+    475, 476, 523, 524, 525, 571, 572, 573, 620, 621, 668, 669,
+    670, 716, 717, 718,
+};
+
+const struct symbol_layout symbol_layouts[SYMBOL_LAYOUT_COUNT] = {
+    {
+        .rows = 10,
+        .cols = 10,
+        .region_rows = 8,
+        .region_cols = 8,
+        .horiz_regions = 1,
+        .vert_regions = 1,
+        .blocks = 1,
+        .data_words = 3,
+        .error_words = 5,
+        .bits = bits_0,
+    },
+    {
+        .rows = 12,
+        .cols = 12,
+        .region_rows = 10,
+        .region_cols = 10,
+        .horiz_regions = 1,
+        .vert_regions = 1,
+        .blocks = 1,
+        .data_words = 5,
+        .error_words = 7,
+        .bits = bits_1,
+        .corner_count = 2,
+        .corner = {130, 117},
+    },
+    {
+        .rows = 14,
+        .cols = 14,
+        .region_rows = 12,
+        .region_cols = 12,
+        .horiz_regions = 1,
+        .vert_regions = 1,
+        .blocks = 1,
+        .data_words = 8,
+        .error_words = 10,
+        .bits = bits_2,
+    },
+    {
+        .rows = 16,
+        .cols = 16,
+        .region_rows = 14,
+        .region_cols = 14,
+        .horiz_regions = 1,
+        .vert_regions = 1,
+        .blocks = 1,
+        .data_words = 12,
+        .error_words = 12,
+        .bits = bits_3,
+        .corner_count = 2,
+        .corner = {238, 221},
+    },
+    {
+        .rows = 18,
+        .cols = 18,
+        .region_rows = 16,
+        .region_cols = 16,
+        .horiz_regions = 1,
+        .vert_regions = 1,
+        .blocks = 1,
+        .data_words = 18,
+        .error_words = 14,
+        .bits = bits_4,
+    },
+    {
+        .rows = 20,
+        .cols = 20,
+        .region_rows = 18,
+        .region_cols = 18,
+        .horiz_regions = 1,
+        .vert_regions = 1,
+        .blocks = 1,
+        .data_words = 22,
+        .error_words = 18,
+        .bits = bits_5,
+        .corner_count = 2,
+        .corner = {378, 357},
+    },
+    {
+        .rows = 22,
+        .cols = 22,
+        .region_rows = 20,
+        .region_cols = 20,
+        .horiz_regions = 1,
+        .vert_regions = 1,
+        .blocks = 1,
+        .data_words = 30,
+        .error_words = 20,
+        .bits = bits_6,
+    },
+    {
+        .rows = 24,
+        .cols = 24,
+        .region_rows = 22,
+        .region_cols = 22,
+        .horiz_regions = 1,
+        .vert_regions = 1,
+        .blocks = 1,
+        .data_words = 36,
+        .error_words = 24,
+        .bits = bits_7,
+        .corner_count = 2,
+        .corner = {550, 525},
+    },
+    {
+        .rows = 26,
+        .cols = 26,
+        .region_rows = 24,
+        .region_cols = 24,
+        .horiz_regions = 1,
+        .vert_regions = 1,
+        .blocks = 1,
+        .data_words = 44,
+        .error_words = 28,
+        .bits = bits_8,
+    },
+    {
+        .rows = 32,
+        .cols = 32,
+        .region_rows = 14,
+        .region_cols = 14,
+        .horiz_regions = 2,
+        .vert_regions = 2,
+        .blocks = 1,
+        .data_words = 62,
+        .error_words = 36,
+        .bits = bits_9,
+    },
+    {
+        .rows = 36,
+        .cols = 36,
+        .region_rows = 16,
+        .region_cols = 16,
+        .horiz_regions = 2,
+        .vert_regions = 2,
+        .blocks = 1,
+        .data_words = 86,
+        .error_words = 42,
+        .bits = bits_10,
+    },
+    {
+        .rows = 40,
+        .cols = 40,
+        .region_rows = 18,
+        .region_cols = 18,
+        .horiz_regions = 2,
+        .vert_regions = 2,
+        .blocks = 1,
+        .data_words = 114,
+        .error_words = 48,
+        .bits = bits_11,
+    },
+    {
+        .rows = 44,
+        .cols = 44,
+        .region_rows = 20,
+        .region_cols = 20,
+        .horiz_regions = 2,
+        .vert_regions = 2,
+        .blocks = 1,
+        .data_words = 144,
+        .error_words = 56,
+        .bits = bits_12,
+    },
+    {
+        .rows = 48,
+        .cols = 48,
+        .region_rows = 22,
+        .region_cols = 22,
+        .horiz_regions = 2,
+        .vert_regions = 2,
+        .blocks = 1,
+        .data_words = 174,
+        .error_words = 68,
+        .bits = bits_13,
+    },
+    {
+        .rows = 52,
+        .cols = 52,
+        .region_rows = 24,
+        .region_cols = 24,
+        .horiz_regions = 2,
+        .vert_regions = 2,
+        .blocks = 2,
+        .data_words = 204,
+        .error_words = 84,
+        .bits = bits_14,
+    },
+    {
+        .rows = 64,
+        .cols = 64,
+        .region_rows = 14,
+        .region_cols = 14,
+        .horiz_regions = 4,
+        .vert_regions = 4,
+        .blocks = 2,
+        .data_words = 280,
+        .error_words = 112,
+        .bits = bits_15,
+    },
+    {
+        .rows = 72,
+        .cols = 72,
+        .region_rows = 16,
+        .region_cols = 16,
+        .horiz_regions = 4,
+        .vert_regions = 4,
+        .blocks = 4,
+        .data_words = 368,
+        .error_words = 144,
+        .bits = bits_16,
+    },
+    {
+        .rows = 80,
+        .cols = 80,
+        .region_rows = 18,
+        .region_cols = 18,
+        .horiz_regions = 4,
+        .vert_regions = 4,
+        .blocks = 4,
+        .data_words = 456,
+        .error_words = 192,
+        .bits = bits_17,
+    },
+    {
+        .rows = 88,
+        .cols = 88,
+        .region_rows = 20,
+        .region_cols = 20,
+        .horiz_regions = 4,
+        .vert_regions = 4,
+        .blocks = 4,
+        .data_words = 576,
+        .error_words = 224,
+        .bits = bits_18,
+    },
+    {
+        .rows = 96,
+        .cols = 96,
+        .region_rows = 22,
+        .region_cols = 22,
+        .horiz_regions = 4,
+        .vert_regions = 4,
+        .blocks = 4,
+        .data_words = 696,
+        .error_words = 272,
+        .bits = bits_19,
+    },
+    {
+        .rows = 104,
+        .cols = 104,
+        .region_rows = 24,
+        .region_cols = 24,
+        .horiz_regions = 4,
+        .vert_regions = 4,
+        .blocks = 6,
+        .data_words = 816,
+        .error_words = 336,
+        .bits = bits_20,
+    },
+    {
+        .rows = 120,
+        .cols = 120,
+        .region_rows = 18,
+        .region_cols = 18,
+        .horiz_regions = 6,
+        .vert_regions = 6,
+        .blocks = 6,
+        .data_words = 1050,
+        .error_words = 408,
+        .bits = bits_21,
+    },
+    {
+        .rows = 132,
+        .cols = 132,
+        .region_rows = 20,
+        .region_cols = 20,
+        .horiz_regions = 6,
+        .vert_regions = 6,
+        .blocks = 8,
+        .data_words = 1304,
+        .error_words = 496,
+        .bits = bits_22,
+    },
+    {
+        .rows = 144,
+        .cols = 144,
+        .region_rows = 22,
+        .region_cols = 22,
+        .horiz_regions = 6,
+        .vert_regions = 6,
+        .blocks = 10,
+        .data_words = 1558,
+        .error_words = 620,
+        .bits = bits_23,
+    },
+    {
+        .rows = 8,
+        .cols = 18,
+        .region_rows = 6,
+        .region_cols = 16,
+        .horiz_regions = 1,
+        .vert_regions = 1,
+        .blocks = 1,
+        .data_words = 5,
+        .error_words = 7,
+        .bits = bits_24,
+    },
+    {
+        .rows = 8,
+        .cols = 32,
+        .region_rows = 6,
+        .region_cols = 14,
+        .horiz_regions = 2,
+        .vert_regions = 1,
+        .blocks = 1,
+        .data_words = 10,
+        .error_words = 11,
+        .bits = bits_25,
+    },
+    {
+        .rows = 12,
+        .cols = 26,
+        .region_rows = 10,
+        .region_cols = 24,
+        .horiz_regions = 1,
+        .vert_regions = 1,
+        .blocks = 1,
+        .data_words = 16,
+        .error_words = 14,
+        .bits = bits_26,
+    },
+    {
+        .rows = 12,
+        .cols = 36,
+        .region_rows = 10,
+        .region_cols = 16,
+        .horiz_regions = 2,
+        .vert_regions = 1,
+        .blocks = 1,
+        .data_words = 22,
+        .error_words = 18,
+        .bits = bits_27,
+    },
+    {
+        .rows = 16,
+        .cols = 36,
+        .region_rows = 14,
+        .region_cols = 16,
+        .horiz_regions = 2,
+        .vert_regions = 1,
+        .blocks = 1,
+        .data_words = 32,
+        .error_words = 24,
+        .bits = bits_28,
+    },
+    {
+        .rows = 16,
+        .cols = 48,
+        .region_rows = 14,
+        .region_cols = 22,
+        .horiz_regions = 2,
+        .vert_regions = 1,
+        .blocks = 1,
+        .data_words = 49,
+        .error_words = 28,
+        .bits = bits_29,
+    },
+};
@@ -0,0 +1,94 @@
+#include <errno.h>
+#include <stdlib.h>
+
+#include "text_record.h"
+
+int text_record_next_token(char **cursor, char *out, size_t size)
+{
+    char *c = *cursor;
+    size_t n = 0;
+
+    while (*c == ' ')
+        c++;
+
+    if (*c == '\0' || *c == '\n')
+        return -EINVAL;
+
+    if (*c == '"')
+    {
+        for (c++; *c != '"'; c++)
+        {
+            if (*c == '\\' && c[1] != '\0')
+                c++;
+
+            if (*c == '\0' || n + 1 >= size)
+                return -EINVAL;
+
+            out[n++] = *c;
+        }
+        c++;
+    }
+    else
+    {
+        for (; *c != ' ' && *c != '\0' && *c != '\n'; c++)
+        {
+            if (n + 1 >= size)
+                return -EINVAL;
+
+            out[n++] = *c;
+        }
+    }
+
+    out[n] = '\0';
+    *cursor = c;
+
+    return 0;
+}
+
+int text_record_next_int(char **cursor, int *value)
+{
+    char token[32];
+    char *end = NULL;
+
+    if (text_record_next_token(cursor, token, sizeof(token)) < 0)
+        return -EINVAL;
+
+    *value = (int)strtol(token, &end, 10);
+
+    return *end == '\0' ? 0 : -EINVAL;
+}
+
+void text_record_write_string(FILE *out, const char *text)
+{
+    fputc('"', out);
+
+    for (; *text != '\0'; text++)
+    {
+        if (*text == '"' || *text == '\\')
+            fputc('\\', out);
+
+        /* Keep each record on one line. */
+        fputc(*text == '\n' ? ' ' : *text, out);
+    }
+
+    fputc('"', out);
+}
+
+void text_record_write_json_string(FILE *out, const char *text)
+{
+    fputc('"', out);
+
+    for (; *text != '\0'; text++)
+    {
+        unsigned char c = (unsigned char)*text;
+
+        if (c == '"' || c == '\\')
+            fprintf(out, "\\%c", c);
+        else if (c < 0x20)
+            fprintf(out, "\\u%04x", c);
+        else
+            fputc(c, out);
+    }
+
+    fputc('"', out);
+}
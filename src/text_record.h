@@ -0,0 +1,23 @@
+#ifndef TEXT_RECORD_H
+#define TEXT_RECORD_H
+
+#include <stddef.h>
+#include <stdio.h>
+
+/* The line format shared by the files we keep on disk: one record per
+ * line, a keyword and then fields separated by spaces, where strings are
+ * quoted with \ escapes. */
+
+/* Reads a bare word or a quoted string with \ escapes. */
+int text_record_next_token(char **cursor, char *out, size_t size);
+
+int text_record_next_int(char **cursor, int *value);
+
+/* Writes text quoted, replacing newlines so the record stays on one line. */
+void text_record_write_string(FILE *out, const char *text);
+
+/* Writes text as a JSON string, for the reports and logs we write as
+ * JSON. */
+void text_record_write_json_string(FILE *out, const char *text);
+
+#endif /* TEXT_RECORD_H */
@@ -0,0 +1,273 @@
+#include <errno.h>
+#include <stdlib.h>
+
+#include "thread.h"
+
+#ifndef _WIN32
+#include <time.h>
+#include <unistd.h>
+#endif
+
+struct thread_start
+{
+    void (*fn)(void *arg);
+    void *arg;
+};
+
+#ifdef _WIN32
+
+static DWORD WINAPI thread_main(LPVOID param)
+{
+    struct thread_start start = *(struct thread_start *)param;
+
+    free(param);
+    start.fn(start.arg);
+
+    return 0;
+}
+
+int thread_create(struct thread *thread, void (*fn)(void *arg), void *arg)
+{
+    struct thread_start *start = NULL;
+
+    start = (struct thread_start *)malloc(sizeof(*start));
+    if (start == NULL)
+        return -ENOMEM;
+
+    start->fn = fn;
+    start->arg = arg;
+
+    thread->handle = CreateThread(NULL, 0, thread_main, start, 0, NULL);
+    if (thread->handle == NULL)
+    {
+        free(start);
+        return -EAGAIN;
+    }
+
+    return 0;
+}
+
+void thread_join(struct thread *thread)
+{
+    WaitForSingleObject(thread->handle, INFINITE);
+    CloseHandle(thread->handle);
+    thread->handle = NULL;
+}
+
+void thread_detach(struct thread *thread)
+{
+    CloseHandle(thread->handle);
+    thread->handle = NULL;
+}
+
+static BOOL CALLBACK once_main(PINIT_ONCE once, PVOID parameter, PVOID *context)
+{
+    (void)once;
+    (void)context;
+
+    (*(void (**)(void))parameter)();
+
+    return TRUE;
+}
+
+void thread_once(struct once *once, void (*fn)(void))
+{
+    InitOnceExecuteOnce(&once->once, once_main, &fn, NULL);
+}
+
+int thread_cpu_count(void)
+{
+    SYSTEM_INFO info;
+
+    GetSystemInfo(&info);
+
+    return info.dwNumberOfProcessors > 0 ? (int)info.dwNumberOfProcessors : 1;
+}
+
+void thread_sleep_ms(int ms)
+{
+    Sleep((DWORD)ms);
+}
+
+void mutex_init(struct mutex *mutex)
+{
+    InitializeCriticalSection(&mutex->cs);
+}
+
+void mutex_destroy(struct mutex *mutex)
+{
+    DeleteCriticalSection(&mutex->cs);
+}
+
+void mutex_lock(struct mutex *mutex)
+{
+    EnterCriticalSection(&mutex->cs);
+}
+
+void mutex_unlock(struct mutex *mutex)
+{
+    LeaveCriticalSection(&mutex->cs);
+}
+
+void cond_init(struct cond *cond)
+{
+    InitializeConditionVariable(&cond->cv);
+}
+
+void cond_destroy(struct cond *cond)
+{
+    (void)cond;
+}
+
+void cond_wait(struct cond *cond, struct mutex *mutex)
+{
+    SleepConditionVariableCS(&cond->cv, &mutex->cs, INFINITE);
+}
+
+int cond_wait_ms(struct cond *cond, struct mutex *mutex, int ms)
+{
+    if (!SleepConditionVariableCS(&cond->cv, &mutex->cs, (DWORD)ms))
+        return GetLastError() == ERROR_TIMEOUT ? -ETIMEDOUT : -EINVAL;
+
+    return 0;
+}
+
+void cond_signal(struct cond *cond)
+{
+    WakeConditionVariable(&cond->cv);
+}
+
+void cond_broadcast(struct cond *cond)
+{
+    WakeAllConditionVariable(&cond->cv);
+}
+
+#else
+
+static void *thread_main(void *param)
+{
+    struct thread_start start = *(struct thread_start *)param;
+
+    free(param);
+    start.fn(start.arg);
+
+    return NULL;
+}
+
+int thread_create(struct thread *thread, void (*fn)(void *arg), void *arg)
+{
+    struct thread_start *start = NULL;
+
+    start = (struct thread_start *)malloc(sizeof(*start));
+    if (start == NULL)
+        return -ENOMEM;
+
+    start->fn = fn;
+    start->arg = arg;
+
+    if (pthread_create(&thread->handle, NULL, thread_main, start) != 0)
+    {
+        free(start);
+        return -EAGAIN;
+    }
+
+    return 0;
+}
+
+void thread_join(struct thread *thread)
+{
+    pthread_join(thread->handle, NULL);
+}
+
+void thread_detach(struct thread *thread)
+{
+    pthread_detach(thread->handle);
+}
+
+void thread_once(struct once *once, void (*fn)(void))
+{
+    pthread_once(&once->once, fn);
+}
+
+int thread_cpu_count(void)
+{
+    long count = sysconf(_SC_NPROCESSORS_ONLN);
+
+    return count > 0 ? (int)count : 1;
+}
+
+void thread_sleep_ms(int ms)
+{
+    struct timespec delay = {ms / 1000, (long)(ms % 1000) * 1000000};
+
+    while (nanosleep(&delay, &delay) < 0 && errno == EINTR)
+        ;
+}
+
+void mutex_init(struct mutex *mutex)
+{
+    pthread_mutex_init(&mutex->m, NULL);
+}
+
+void mutex_destroy(struct mutex *mutex)
+{
+    pthread_mutex_destroy(&mutex->m);
+}
+
+void mutex_lock(struct mutex *mutex)
+{
+    pthread_mutex_lock(&mutex->m);
+}
+
+void mutex_unlock(struct mutex *mutex)
+{
+    pthread_mutex_unlock(&mutex->m);
+}
+
+void cond_init(struct cond *cond)
+{
+    pthread_cond_init(&cond->cv, NULL);
+}
+
+void cond_destroy(struct cond *cond)
+{
+    pthread_cond_destroy(&cond->cv);
+}
+
+void cond_wait(struct cond *cond, struct mutex *mutex)
+{
+    pthread_cond_wait(&cond->cv, &mutex->m);
+}
+
+int cond_wait_ms(struct cond *cond, struct mutex *mutex, int ms)
+{
+    struct timespec deadline;
+    int rc = 0;
+
+    /* The condition variables use the default, real time clock. */
+    clock_gettime(CLOCK_REALTIME, &deadline);
+
+    deadline.tv_sec += ms / 1000;
+    deadline.tv_nsec += (long)(ms % 1000) * 1000000;
+    if (deadline.tv_nsec >= 1000000000)
+    {
+        deadline.tv_sec++;
+        deadline.tv_nsec -= 1000000000;
+    }
+
+    rc = pthread_cond_timedwait(&cond->cv, &mutex->m, &deadline);
+
+    return rc == ETIMEDOUT ? -ETIMEDOUT : 0;
+}
+
+void cond_signal(struct cond *cond)
+{
+    pthread_cond_signal(&cond->cv);
+}
+
+void cond_broadcast(struct cond *cond)
+{
+    pthread_cond_broadcast(&cond->cv);
+}
+
+#endif
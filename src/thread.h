@@ -0,0 +1,91 @@
+#ifndef THREAD_H
+#define THREAD_H
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
+/* Thin wrappers over the native threading primitives so the rest of the
+ * code doesn't care which platform it's on. */
+
+struct thread
+{
+#ifdef _WIN32
+    HANDLE handle;
+#else
+    pthread_t handle;
+#endif
+};
+
+struct mutex
+{
+#ifdef _WIN32
+    CRITICAL_SECTION cs;
+#else
+    pthread_mutex_t m;
+#endif
+};
+
+struct cond
+{
+#ifdef _WIN32
+    CONDITION_VARIABLE cv;
+#else
+    pthread_cond_t cv;
+#endif
+};
+
+struct once
+{
+#ifdef _WIN32
+    INIT_ONCE once;
+#else
+    pthread_once_t once;
+#endif
+};
+
+#ifdef _WIN32
+#define ONCE_INIT {INIT_ONCE_STATIC_INIT}
+#else
+#define ONCE_INIT {PTHREAD_ONCE_INIT}
+#endif
+
+/* For variables each thread has its own copy of. */
+#ifdef _MSC_VER
+#define THREAD_LOCAL __declspec(thread)
+#else
+#define THREAD_LOCAL _Thread_local
+#endif
+
+int thread_create(struct thread *thread, void (*fn)(void *arg), void *arg);
+void thread_join(struct thread *thread);
+
+/* Lets a thread run on without anyone joining it. */
+void thread_detach(struct thread *thread);
+
+/* Calls fn the first time any thread gets here with once, which starts as
+ * ONCE_INIT. Later callers wait for it to finish. */
+void thread_once(struct once *once, void (*fn)(void));
+
+/* Number of logical processors, at least 1. */
+int thread_cpu_count(void);
+
+void thread_sleep_ms(int ms);
+
+void mutex_init(struct mutex *mutex);
+void mutex_destroy(struct mutex *mutex);
+void mutex_lock(struct mutex *mutex);
+void mutex_unlock(struct mutex *mutex);
+
+void cond_init(struct cond *cond);
+void cond_destroy(struct cond *cond);
+void cond_wait(struct cond *cond, struct mutex *mutex);
+
+/* As cond_wait(), but gives up with -ETIMEDOUT after about ms. */
+int cond_wait_ms(struct cond *cond, struct mutex *mutex, int ms);
+void cond_signal(struct cond *cond);
+void cond_broadcast(struct cond *cond);
+
+#endif /* THREAD_H */
@@ -0,0 +1,34 @@
+#include "timing.h"
+
+#ifdef _WIN32
+#include <windows.h>
+
+uint64_t timing_now_ns(void)
+{
+    static LARGE_INTEGER frequency = {0};
+    LARGE_INTEGER now;
+
+    if (frequency.QuadPart == 0)
+        QueryPerformanceFrequency(&frequency);
+
+    QueryPerformanceCounter(&now);
+
+    /* Split the conversion so we don't overflow on long uptimes. */
+    return (uint64_t)(now.QuadPart / frequency.QuadPart) * 1000000000ull +
+           (uint64_t)(now.QuadPart % frequency.QuadPart) * 1000000000ull /
+               (uint64_t)frequency.QuadPart;
+}
+
+#else
+#include <time.h>
+
+uint64_t timing_now_ns(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (uint64_t)now.tv_sec * 1000000000ull + (uint64_t)now.tv_nsec;
+}
+
+#endif
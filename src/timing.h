@@ -0,0 +1,15 @@
+#ifndef TIMING_H
+#define TIMING_H
+
+#include <stdint.h>
+
+/* Monotonic clock in nanoseconds. Only differences between two readings
+ * are meaningful. */
+uint64_t timing_now_ns(void);
+
+static inline double timing_ns_to_s(uint64_t ns)
+{
+    return (double)ns / 1e9;
+}
+
+#endif /* TIMING_H */
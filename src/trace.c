@@ -0,0 +1,356 @@
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "log.h"
+#include "text_record.h"
+#include "thread.h"
+#include "trace.h"
+
+/* Spans each thread keeps, a power of two. */
+#define TRACE_RING_EVENTS 4096
+
+/* Span names each thread keeps a histogram for. Spans past that are still
+ * recorded in the ring. */
+#define TRACE_STAGES 32
+
+/* One bucket per power of two nanoseconds. */
+#define TRACE_BUCKETS 64
+
+struct trace_event
+{
+    const char *name;
+    uint64_t start_ns;
+    uint64_t duration_ns;
+};
+
+struct trace_stage
+{
+    const char *name;
+    uint64_t count;
+    uint64_t total_ns;
+    uint64_t max_ns;
+    uint64_t buckets[TRACE_BUCKETS];
+};
+
+/* A thread's spans. Only that thread writes to it. Rings outlive their
+ * threads, so what a thread did is still there to export after it exits. */
+struct trace_ring
+{
+    struct trace_ring *next;
+    int tid;
+    char name[32];
+
+    /* Spans ever recorded; the last TRACE_RING_EVENTS are kept. */
+    uint64_t head;
+    struct trace_event events[TRACE_RING_EVENTS];
+
+    struct trace_stage stages[TRACE_STAGES];
+    int stage_count;
+};
+
+static struct once registry_once = ONCE_INIT;
+static struct mutex registry_lock;
+static int next_tid;
+
+/* Every ring, in the order their threads first recorded a span. */
+static struct trace_ring *rings;
+static struct trace_ring **rings_end = &rings;
+
+static THREAD_LOCAL struct trace_ring *this_ring;
+
+static void init_registry(void)
+{
+    mutex_init(&registry_lock);
+}
+
+static void registry_init(void)
+{
+    thread_once(&registry_once, init_registry);
+}
+
+/* The calling thread's ring, made the first time it records anything. NULL
+ * if there's no memory for one, in which case nothing is recorded. */
+static struct trace_ring *get_ring(void)
+{
+    struct trace_ring *ring = this_ring;
+
+    if (ring != NULL)
+        return ring;
+
+    ring = (struct trace_ring *)calloc(1, sizeof(*ring));
+    if (ring == NULL)
+        return NULL;
+
+    registry_init();
+
+    mutex_lock(&registry_lock);
+    ring->tid = ++next_tid;
+    *rings_end = ring;
+    rings_end = &ring->next;
+    mutex_unlock(&registry_lock);
+
+    this_ring = ring;
+
+    return ring;
+}
+
+static int bucket_of(uint64_t ns)
+{
+    int bucket = 0;
+
+    while (ns > 1 && bucket < TRACE_BUCKETS - 1)
+    {
+        ns >>= 1;
+        bucket++;
+    }
+
+    return bucket;
+}
+
+/* Whether two span names are the same. The same literal can have a
+ * different address in each translation unit, so the pointers only save
+ * the strcmp(). */
+static int same_name(const char *a, const char *b)
+{
+    return a == b || strcmp(a, b) == 0;
+}
+
+static struct trace_stage *find_stage(struct trace_ring *ring, const char *name)
+{
+    for (int i = 0; i < ring->stage_count; i++)
+    {
+        if (same_name(ring->stages[i].name, name))
+            return &ring->stages[i];
+    }
+
+    if (ring->stage_count == TRACE_STAGES)
+        return NULL;
+
+    ring->stages[ring->stage_count].name = name;
+
+    return &ring->stages[ring->stage_count++];
+}
+
+void trace_end(const struct trace_span *span)
+{
+    uint64_t duration_ns = timing_now_ns() - span->start_ns;
+    struct trace_ring *ring = get_ring();
+    struct trace_event *event = NULL;
+    struct trace_stage *stage = NULL;
+
+    if (ring == NULL)
+        return;
+
+    event = &ring->events[ring->head & (TRACE_RING_EVENTS - 1)];
+    event->name = span->name;
+    event->start_ns = span->start_ns;
+    event->duration_ns = duration_ns;
+    ring->head++;
+
+    stage = find_stage(ring, span->name);
+    if (stage == NULL)
+        return;
+
+    stage->count++;
+    stage->total_ns += duration_ns;
+    stage->buckets[bucket_of(duration_ns)]++;
+
+    if (duration_ns > stage->max_ns)
+        stage->max_ns = duration_ns;
+}
+
+void trace_thread_name(const char *name)
+{
+    struct trace_ring *ring = get_ring();
+
+    if (ring != NULL)
+        snprintf(ring->name, sizeof(ring->name), "%s", name);
+}
+
+static uint64_t first_event(const struct trace_ring *ring)
+{
+    return ring->head > TRACE_RING_EVENTS ? ring->head - TRACE_RING_EVENTS : 0;
+}
+
+int trace_write_chrome(const char *path)
+{
+    FILE *out = NULL;
+    uint64_t origin_ns = UINT64_MAX;
+    const char *separator = "\n";
+
+    out = fopen(path, "w");
+    if (out == NULL)
+    {
+        log_error("Failed to create \"%s\"", path);
+        return -EIO;
+    }
+
+    registry_init();
+    mutex_lock(&registry_lock);
+
+    /* Times are from the first span kept, in microseconds. */
+    for (const struct trace_ring *ring = rings; ring != NULL; ring = ring->next)
+    {
+        for (uint64_t i = first_event(ring); i < ring->head; i++)
+        {
+            const struct trace_event *event = &ring->events[i & (TRACE_RING_EVENTS - 1)];
+
+            if (event->start_ns < origin_ns)
+                origin_ns = event->start_ns;
+        }
+    }
+
+    fprintf(out, "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [");
+
+    for (const struct trace_ring *ring = rings; ring != NULL; ring = ring->next)
+    {
+        if (ring->name[0] != '\0')
+        {
+            fprintf(
+                out,
+                "%s{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1, \"tid\": %d, "
+                "\"args\": {\"name\": ",
+                separator,
+                ring->tid);
+            text_record_write_json_string(out, ring->name);
+            fprintf(out, "}}");
+            separator = ",\n";
+        }
+
+        for (uint64_t i = first_event(ring); i < ring->head; i++)
+        {
+            const struct trace_event *event = &ring->events[i & (TRACE_RING_EVENTS - 1)];
+
+            fprintf(out, "%s{\"name\": ", separator);
+            text_record_write_json_string(out, event->name);
+            fprintf(
+                out,
+                ", \"ph\": \"X\", \"pid\": 1, \"tid\": %d, \"ts\": %.3f, \"dur\": %.3f}",
+                ring->tid,
+                (double)(event->start_ns - origin_ns) / 1e3,
+                (double)event->duration_ns / 1e3);
+            separator = ",\n";
+        }
+    }
+
+    fprintf(out, "\n]}\n");
+
+    mutex_unlock(&registry_lock);
+
+    if (fclose(out) != 0)
+    {
+        log_error("Failed to write \"%s\"", path);
+        return -EIO;
+    }
+
+    return 0;
+}
+
+/* Adds every thread's histograms for a span name together. */
+static void merge_stage(const char *name, struct trace_stage *total)
+{
+    memset(total, 0, sizeof(*total));
+    total->name = name;
+
+    for (const struct trace_ring *ring = rings; ring != NULL; ring = ring->next)
+    {
+        for (int i = 0; i < ring->stage_count; i++)
+        {
+            const struct trace_stage *stage = &ring->stages[i];
+
+            if (!same_name(stage->name, name))
+                continue;
+
+            total->count += stage->count;
+            total->total_ns += stage->total_ns;
+
+            if (stage->max_ns > total->max_ns)
+                total->max_ns = stage->max_ns;
+
+            for (int b = 0; b < TRACE_BUCKETS; b++)
+                total->buckets[b] += stage->buckets[b];
+        }
+    }
+}
+
+/* Whether name was already printed, from an earlier ring or stage. */
+static int seen_before(const struct trace_ring *ring, int index)
+{
+    const char *name = ring->stages[index].name;
+
+    for (const struct trace_ring *r = rings; r != NULL; r = r->next)
+    {
+        int count = r == ring ? index : r->stage_count;
+
+        for (int i = 0; i < count; i++)
+        {
+            if (same_name(r->stages[i].name, name))
+                return 1;
+        }
+
+        if (r == ring)
+            return 0;
+    }
+
+    return 0;
+}
+
+static void print_histogram(const struct trace_stage *stage)
+{
+    uint64_t peak = 0;
+
+    printf(
+        "%s: %llu spans, mean %.3f ms, max %.3f ms\n",
+        stage->name,
+        (unsigned long long)stage->count,
+        (double)stage->total_ns / (double)stage->count / 1e6,
+        (double)stage->max_ns / 1e6);
+
+    for (int b = 0; b < TRACE_BUCKETS; b++)
+    {
+        if (stage->buckets[b] > peak)
+            peak = stage->buckets[b];
+    }
+
+    for (int b = 0; b < TRACE_BUCKETS; b++)
+    {
+        int bar = 0;
+
+        if (stage->buckets[b] == 0)
+            continue;
+
+        /* Bucket b holds spans of [2^b, 2^(b+1)) ns. */
+        bar = (int)((stage->buckets[b] * 40 + peak - 1) / peak);
+        printf(
+            "  %12.3f - %12.3f us %8llu %.*s\n",
+            (double)(1ull << b) / 1e3,
+            (double)(1ull << b) * 2 / 1e3,
+            (unsigned long long)stage->buckets[b],
+            bar,
+            "########################################");
+    }
+}
+
+void trace_print_histograms(void)
+{
+    registry_init();
+    mutex_lock(&registry_lock);
+
+    for (const struct trace_ring *ring = rings; ring != NULL; ring = ring->next)
+    {
+        for (int i = 0; i < ring->stage_count; i++)
+        {
+            struct trace_stage total;
+
+            if (seen_before(ring, i))
+                continue;
+
+            merge_stage(ring->stages[i].name, &total);
+            print_histogram(&total);
+        }
+    }
+
+    mutex_unlock(&registry_lock);
+}
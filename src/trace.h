@@ -0,0 +1,45 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <stdint.h>
+
+#include "timing.h"
+
+/* Spans: named stretches of time on a thread, such as opening a session
+ * or ending a page. Each thread records its spans into a ring buffer of
+ * its own, keeping the most recent, and into a histogram per span name,
+ * so a span costs two clock reads and a few stores and is always on.
+ *
+ * At the end of a run the rings can be written out as Chrome trace event
+ * JSON, which chrome://tracing and Perfetto show as a timeline per thread,
+ * and the histograms printed. Both read every thread's buffers, so call
+ * them once the threads being traced have finished.
+ *
+ * Span names are kept by pointer and must be string literals. Spans are
+ * grouped by what the name says, not where it's stored. */
+
+struct trace_span
+{
+    const char *name;
+    uint64_t start_ns;
+};
+
+static inline struct trace_span trace_begin(const char *name)
+{
+    struct trace_span span = {name, timing_now_ns()};
+
+    return span;
+}
+
+void trace_end(const struct trace_span *span);
+
+/* Names the calling thread in the trace. */
+void trace_thread_name(const char *name);
+
+int trace_write_chrome(const char *path);
+
+/* Prints how long each kind of span took: a power of two histogram and
+ * the totals, across every thread. */
+void trace_print_histograms(void);
+
+#endif /* TRACE_H */
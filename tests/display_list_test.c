@@ -0,0 +1,215 @@
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "display_list.h"
+#include "log.h"
+
+/* Serialises a list with every kind of command and reads it back, then
+ * checks that cut off, padded and corrupt buffers are turned away. */
+
+static int failures;
+
+static void fail(const char *what)
+{
+    printf("FAIL: %s\n", what);
+    failures++;
+}
+
+static int build(struct display_list *list)
+{
+    struct rect r = {10, 20, 300, 400};
+    struct point triangle[] = {{0, 0}, {100, 50}, {20, 90}};
+    struct bitmap bitmap = {0};
+    int rc = 0;
+
+    rc = bitmap_resize(&bitmap, 37, 5);
+    if (rc < 0)
+        return rc;
+
+    for (int y = 0; y < bitmap.height; y++)
+        bitmap_fill_span(bitmap_row(&bitmap, y), y, y + 20);
+
+    if (display_list_rect(list, &r) < 0 ||
+        display_list_fill(list, &r) < 0 ||
+        display_list_line(list, 0, 0, 500, 250) < 0 ||
+        display_list_text(list, 40, 60, 35, "Lot 42") < 0 ||
+        display_list_bitmap(list, &r, &bitmap) < 0 ||
+        display_list_polygon(list, triangle, 3) < 0 ||
+        display_list_text(list, 0, 0, 10, "") < 0)
+        rc = -ENOMEM;
+
+    bitmap_free(&bitmap);
+
+    return rc;
+}
+
+static int same(const struct display_list *a, const struct display_list *b)
+{
+    size_t commands = a->count * sizeof(*a->commands);
+
+    return a->count == b->count && a->data_size == b->data_size &&
+           (commands == 0 || memcmp(a->commands, b->commands, commands) == 0) &&
+           (a->data_size == 0 || memcmp(a->data, b->data, a->data_size) == 0);
+}
+
+static void check_round_trip(const struct display_list *list, const void *data, size_t size)
+{
+    struct display_list copy = {0};
+
+    if (display_list_deserialise(&copy, data, size) < 0)
+        fail("didn't deserialise");
+    else if (!same(list, &copy))
+        fail("deserialised differently");
+
+    /* Again into a list that already holds something, as lists are
+     * reused. */
+    if (display_list_deserialise(&copy, data, size) < 0)
+        fail("didn't deserialise into a used list");
+    else if (!same(list, &copy))
+        fail("deserialised differently into a used list");
+
+    display_list_free(&copy);
+}
+
+static void check_truncated(const void *data, size_t size)
+{
+    struct display_list copy = {0};
+    unsigned char *padded = NULL;
+
+    for (size_t n = 0; n < size; n++)
+    {
+        if (display_list_deserialise(&copy, data, n) != -EINVAL)
+        {
+            printf(
+                "FAIL: deserialised %llu of %llu octets\n",
+                (unsigned long long)n,
+                (unsigned long long)size);
+            failures++;
+        }
+    }
+
+    padded = (unsigned char *)malloc(size + 1);
+    if (padded == NULL)
+    {
+        fail("couldn't allocate");
+        return;
+    }
+
+    memcpy(padded, data, size);
+    padded[size] = 0;
+
+    if (display_list_deserialise(&copy, padded, size + 1) != -EINVAL)
+        fail("deserialised a buffer with an octet too many");
+
+    free(padded);
+    display_list_free(&copy);
+}
+
+/* Changes one command of the serialised list, which must then be turned
+ * away and leave the list empty. */
+static void check_corrupt(
+    const struct display_list *list,
+    const void *data,
+    size_t size,
+    size_t index,
+    void (*corrupt)(struct display_command *command),
+    const char *what)
+{
+    struct display_list copy = {0};
+    unsigned char *bad = (unsigned char *)malloc(size);
+    struct display_command command;
+    size_t at = size - list->data_size - (list->count - index) * sizeof(command);
+
+    if (bad == NULL)
+    {
+        fail("couldn't allocate");
+        return;
+    }
+
+    memcpy(bad, data, size);
+    memcpy(&command, bad + at, sizeof(command));
+    corrupt(&command);
+    memcpy(bad + at, &command, sizeof(command));
+
+    if (display_list_deserialise(&copy, bad, size) != -EINVAL)
+        fail(what);
+    else if (copy.count != 0)
+        fail("kept commands from a corrupt list");
+
+    free(bad);
+    display_list_free(&copy);
+}
+
+static void text_past_end(struct display_command *command)
+{
+    command->text.text = 1u << 20;
+}
+
+static void bitmap_past_end(struct display_command *command)
+{
+    command->bitmap.height = 1000;
+}
+
+static void negative_polygon(struct display_command *command)
+{
+    command->polygon.count = -1;
+}
+
+static void polygon_past_end(struct display_command *command)
+{
+    command->polygon.count = 1 << 20;
+}
+
+static void unknown_op(struct display_command *command)
+{
+    command->op = (enum display_op)99;
+}
+
+int main(void)
+{
+    struct display_list list = {0};
+    struct display_list empty = {0};
+    void *data = NULL;
+    size_t size = 0;
+
+    /* Bad buffers are logged as errors, which aren't wanted here. */
+    log_set_level(LOG_LEVEL_OFF);
+
+    if (build(&list) < 0 || display_list_serialise(&list, &data, &size) < 0)
+    {
+        printf("FAIL: couldn't build the list\n");
+        return 1;
+    }
+
+    check_round_trip(&list, data, size);
+    check_truncated(data, size);
+
+    check_corrupt(&list, data, size, 3, text_past_end, "deserialised text past the data");
+    check_corrupt(&list, data, size, 4, bitmap_past_end, "deserialised a bitmap past the data");
+    check_corrupt(&list, data, size, 5, negative_polygon, "deserialised a negative polygon");
+    check_corrupt(&list, data, size, 5, polygon_past_end, "deserialised a polygon past the data");
+    check_corrupt(&list, data, size, 0, unknown_op, "deserialised an unknown command");
+
+    free(data);
+
+    /* An empty list makes a buffer of just the header. */
+    if (display_list_serialise(&empty, &data, &size) < 0)
+        fail("didn't serialise an empty list");
+    else
+        check_round_trip(&empty, data, size);
+
+    free(data);
+    display_list_free(&list);
+
+    if (failures > 0)
+    {
+        printf("%d failures\n", failures);
+        return 1;
+    }
+
+    printf("All display list checks passed\n");
+
+    return 0;
+}
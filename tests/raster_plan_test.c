@@ -0,0 +1,143 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "count_of.h"
+#include "display_list.h"
+#include "raster.h"
+
+/* Plans pages of fills at random rows, some off the page, and checks each
+ * band lists just the commands that touch it, in page order, against
+ * working it out the slow way. */
+
+#define PAGE_ROWS 100
+
+static const int band_heights[] = {1, 7, 16, 33, PAGE_ROWS, PAGE_ROWS + 20};
+
+static int failures;
+
+/* Logical units are device pixels, so a fill's rows are its top and
+ * bottom. */
+static const struct coordinate_space space = {
+    .logical = {.width = 64, .height = PAGE_ROWS},
+    .device = {.width = 64, .height = PAGE_ROWS},
+};
+
+static int touches(const struct rect *r, int top, int bottom)
+{
+    int y0 = r->top < 0 ? 0 : r->top;
+    int y1 = r->bottom > PAGE_ROWS ? PAGE_ROWS : r->bottom;
+
+    return y0 < y1 && y0 < bottom && y1 > top;
+}
+
+static void check_plan(
+    const struct raster_plan *plan,
+    const struct rect *rects,
+    int count,
+    int band_height)
+{
+    int expected_bands = (PAGE_ROWS + band_height - 1) / band_height;
+
+    if (plan->band_count != expected_bands)
+    {
+        printf(
+            "FAIL: %d bands of %d rows, expected %d\n",
+            plan->band_count,
+            band_height,
+            expected_bands);
+        failures++;
+        return;
+    }
+
+    for (int b = 0; b < plan->band_count; b++)
+    {
+        size_t at = plan->starts[b];
+
+        for (int i = 0; i < count; i++)
+        {
+            if (!touches(&rects[i], b * band_height, (b + 1) * band_height))
+                continue;
+
+            if (at >= plan->starts[b + 1] || plan->commands[at] != (uint32_t)i)
+            {
+                printf(
+                    "FAIL: band %d of %d rows is missing rows %d to %d\n",
+                    b,
+                    band_height,
+                    rects[i].top,
+                    rects[i].bottom);
+                failures++;
+                return;
+            }
+
+            at++;
+        }
+
+        if (at != plan->starts[b + 1])
+        {
+            printf("FAIL: band %d of %d rows lists commands that don't touch it\n", b, band_height);
+            failures++;
+            return;
+        }
+    }
+}
+
+int main(void)
+{
+    struct raster_plan plan = {0};
+    struct display_list page = {0};
+    struct rect rects[64];
+
+    srand(1);
+
+    /* The same plan is reused for every page, as a renderer reuses it. */
+    for (int round = 0; round < 200; round++)
+    {
+        int count = rand() % 64;
+        int band_height = band_heights[round % COUNT_OF(band_heights)];
+
+        display_list_clear(&page);
+
+        for (int i = 0; i < count; i++)
+        {
+            rects[i].left = 0;
+            rects[i].right = 10;
+            rects[i].top = rand() % (PAGE_ROWS + 40) - 20;
+            rects[i].bottom = rects[i].top + rand() % 40;
+
+            /* Band edges exactly, and fills with no rows. */
+            if (i % 8 == 1)
+                rects[i].top -= rects[i].top % band_height;
+
+            if (i % 8 == 2)
+                rects[i].bottom = rects[i].top;
+
+            if (display_list_fill(&page, &rects[i]) < 0)
+            {
+                printf("FAIL: couldn't build the page\n");
+                return 1;
+            }
+        }
+
+        if (raster_plan_page(&plan, &page, &space, band_height) < 0)
+        {
+            printf("FAIL: couldn't plan the page\n");
+            return 1;
+        }
+
+        check_plan(&plan, rects, count, band_height);
+    }
+
+    raster_plan_free(&plan);
+    display_list_free(&page);
+
+    if (failures > 0)
+    {
+        printf("%d failures\n", failures);
+        return 1;
+    }
+
+    printf("All raster plans matched\n");
+
+    return 0;
+}
@@ -0,0 +1,196 @@
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "count_of.h"
+#include "scanline.h"
+
+/* Round-trips rows of each kind the raster path sends through every
+ * method, and checks that malformed rows are rejected rather than read or
+ * written past. */
+
+#define MAX_BYTES 1000
+
+static const size_t widths[] = {1, 37, 104, MAX_BYTES};
+
+static const enum scanline_method methods[] = {
+    SCANLINE_RAW,
+    SCANLINE_RLE,
+    SCANLINE_PACKBITS,
+    SCANLINE_DELTA,
+};
+
+static int failures;
+
+static void fail(const char *what, const char *row_kind, enum scanline_method method, size_t bytes)
+{
+    printf(
+        "FAIL: %s, %s row of %llu bytes, %s\n",
+        what,
+        row_kind,
+        (unsigned long long)bytes,
+        scanline_method_name(method));
+    failures++;
+}
+
+/* Encodes row in method, decodes it again, and checks it comes back the
+ * same. Then checks the encoding doesn't decode with its last byte cut
+ * off, into a longer row, or with a byte added. */
+static void round_trip(
+    const char *row_kind,
+    enum scanline_method method,
+    const unsigned char *row,
+    const unsigned char *previous,
+    size_t bytes)
+{
+    unsigned char encoded[SCANLINE_BOUND(MAX_BYTES) + 1];
+    unsigned char decoded[MAX_BYTES + 1];
+    size_t size = scanline_encode_method(method, row, previous, bytes, encoded);
+
+    if (size > SCANLINE_BOUND(bytes))
+        fail("encoded past the bound", row_kind, method, bytes);
+
+    if (scanline_decode(method, encoded, size, previous, decoded, bytes) < 0)
+    {
+        fail("didn't decode", row_kind, method, bytes);
+        return;
+    }
+
+    if (memcmp(decoded, row, bytes) != 0)
+        fail("decoded differently", row_kind, method, bytes);
+
+    /* An empty delta row is the row above, and has nothing to cut off. */
+    if (size > 0 && scanline_decode(method, encoded, size - 1, previous, decoded, bytes) != -EINVAL)
+        fail("decoded truncated data", row_kind, method, bytes);
+
+    /* Delta rows leave the rest of a longer row as it was above. */
+    if (method != SCANLINE_DELTA &&
+        scanline_decode(method, encoded, size, previous, decoded, bytes + 1) != -EINVAL)
+        fail("decoded data too short for the row", row_kind, method, bytes);
+
+    /* Delta would take a byte too many as one more change, so its
+     * overruns are checked on their own. */
+    encoded[size] = 0;
+    if (method != SCANLINE_DELTA &&
+        scanline_decode(method, encoded, size + 1, previous, decoded, bytes) != -EINVAL)
+        fail("decoded overlong data", row_kind, method, bytes);
+}
+
+static void round_trip_all(
+    const char *row_kind,
+    const unsigned char *row,
+    const unsigned char *previous,
+    size_t bytes)
+{
+    for (int m = 0; m < COUNT_OF(methods); m++)
+        round_trip(row_kind, methods[m], row, previous, bytes);
+}
+
+static void fill_random(unsigned char *row, size_t bytes)
+{
+    for (size_t i = 0; i < bytes; i++)
+        row[i] = (unsigned char)rand();
+}
+
+/* Malformed rows that would read past the data or write past the row. */
+static void check_overruns(void)
+{
+    unsigned char row[4] = {0};
+
+    /* Eight changed bytes in a row of four. */
+    static const unsigned char too_many[] = {7 << 5, 1, 2, 3, 4, 5, 6, 7, 8};
+
+    /* An offset continued past the end of the data. */
+    static const unsigned char offset_cut[] = {31, 255};
+
+    /* An offset past the end of the row. */
+    static const unsigned char offset_past[] = {5, 1};
+
+    /* A literal run promising more bytes than there are. */
+    static const unsigned char literal_cut[] = {3, 1, 2};
+
+    if (scanline_decode(SCANLINE_DELTA, too_many, sizeof(too_many), NULL, row, sizeof(row)) != -EINVAL)
+        fail("decoded a change past the row", "short", SCANLINE_DELTA, sizeof(row));
+
+    if (scanline_decode(SCANLINE_DELTA, offset_cut, sizeof(offset_cut), NULL, row, sizeof(row)) !=
+        -EINVAL)
+        fail("decoded a cut off offset", "short", SCANLINE_DELTA, sizeof(row));
+
+    if (scanline_decode(SCANLINE_DELTA, offset_past, sizeof(offset_past), NULL, row, sizeof(row)) !=
+        -EINVAL)
+        fail("decoded an offset past the row", "short", SCANLINE_DELTA, sizeof(row));
+
+    if (scanline_decode(SCANLINE_PACKBITS, literal_cut, sizeof(literal_cut), NULL, row, sizeof(row)) !=
+        -EINVAL)
+        fail("decoded a cut off literal", "short", SCANLINE_PACKBITS, sizeof(row));
+}
+
+int main(void)
+{
+    static unsigned char seed[MAX_BYTES];
+    static unsigned char row[MAX_BYTES];
+
+    srand(1);
+
+    for (int w = 0; w < COUNT_OF(widths); w++)
+    {
+        size_t bytes = widths[w];
+
+        fill_random(seed, bytes);
+
+        for (int i = 0; i < 16; i++)
+        {
+            fill_random(row, bytes);
+            round_trip_all("random", row, NULL, bytes);
+            round_trip_all("random", row, seed, bytes);
+        }
+
+        memset(row, 0, bytes);
+        round_trip_all("all-zero", row, NULL, bytes);
+        round_trip_all("all-zero", row, seed, bytes);
+
+        memset(row, 0xff, bytes);
+        round_trip_all("all-one", row, NULL, bytes);
+        round_trip_all("all-one", row, seed, bytes);
+
+        round_trip_all("repeated", seed, seed, bytes);
+
+        /* A few changes, far enough apart for the delta offsets to need
+         * continuing. */
+        memcpy(row, seed, bytes);
+        for (size_t i = 0; i < bytes; i += 300)
+            row[i] ^= 0x5a;
+        round_trip_all("sparse", row, seed, bytes);
+
+        /* No two neighbours the same: PackBits' longest literals. */
+        for (size_t i = 0; i < bytes; i++)
+            row[i] = (unsigned char)i;
+        round_trip_all("literal", row, NULL, bytes);
+
+        /* Runs of exactly the longest repeat RLE and then PackBits
+         * encode, split by a different byte. Longer runs are the all-zero
+         * and all-one rows. */
+        memset(row, 0x33, bytes);
+        for (size_t i = 256; i < bytes; i += 257)
+            row[i] = 0xcc;
+        round_trip_all("repeat", row, NULL, bytes);
+
+        memset(row, 0x33, bytes);
+        for (size_t i = 128; i < bytes; i += 129)
+            row[i] = 0xcc;
+        round_trip_all("repeat", row, NULL, bytes);
+    }
+
+    check_overruns();
+
+    if (failures > 0)
+    {
+        printf("%d failures\n", failures);
+        return 1;
+    }
+
+    printf("All scanline round trips passed\n");
+
+    return 0;
+}
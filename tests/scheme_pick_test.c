@@ -0,0 +1,160 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "count_of.h"
+#include "datamatrix.h"
+
+/* Encodes payloads of every length from one character up, in every mix
+ * the scheme picker tells apart, both with a scheme picked up front and
+ * with libdmtx's full search, and checks picking never makes a bigger
+ * symbol. Every length crosses each symbol size's edge. */
+
+#define MAX_LENGTH 160
+
+struct mix
+{
+    const char *name;
+    const char *alphabet;
+};
+
+static const struct mix mixes[] = {
+    {"digits", "0123456789"},
+    {"C40", "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ "},
+    {"Text", "0123456789abcdefghijklmnopqrstuvwxyz "},
+    {"X12", "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ \r*>"},
+    {"EDIFACT", " !\"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\\]^"},
+    {"digits and letters", "0123456789A"},
+    {"mixed case", "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz -./"},
+    {"extended", "0123456789AB\x80\xa9\xe9\xff"},
+};
+
+struct shape
+{
+    const char *name;
+    int size_request;
+};
+
+static const struct shape shapes[] = {
+    {"square", DmtxSymbolSquareAuto},
+    {"rectangular", DmtxSymbolRectAuto},
+    {"24x24", DmtxSymbol24x24},
+};
+
+static int failures;
+
+static void make_payload(const struct mix *mix, unsigned char *payload, size_t length)
+{
+    size_t count = strlen(mix->alphabet);
+
+    for (size_t i = 0; i < length; i++)
+        payload[i] = (unsigned char)mix->alphabet[rand() % count];
+}
+
+static int check_shape(const struct shape *shape, uint64_t *direct)
+{
+    struct datamatrix_options options = DATAMATRIX_OPTIONS_DEFAULT;
+    struct datamatrix_encoder *encoders[2] = {NULL, NULL};
+    struct datamatrix_symbol symbol = {0};
+    unsigned char payload[MAX_LENGTH];
+    int rc = 0;
+
+    options.size_request = shape->size_request;
+
+    for (int e = 0; e < 2; e++)
+    {
+        options.fast_scheme = e;
+
+        encoders[e] = datamatrix_encoder_create(&options);
+        if (encoders[e] == NULL)
+        {
+            rc = -1;
+            goto exit;
+        }
+    }
+
+    for (int m = 0; m < COUNT_OF(mixes); m++)
+    {
+        for (size_t length = 1; length <= MAX_LENGTH; length++)
+        {
+            int full_size = 0;
+
+            make_payload(&mixes[m], payload, length);
+
+            /* Past what any symbol of the shape holds. */
+            if (datamatrix_encode(encoders[0], payload, length, &symbol) < 0)
+                continue;
+
+            full_size = symbol.size_idx;
+
+            if (datamatrix_encode(encoders[1], payload, length, &symbol) < 0)
+            {
+                printf(
+                    "FAIL: %s payload of %llu didn't encode in a %s symbol after picking\n",
+                    mixes[m].name,
+                    (unsigned long long)length,
+                    shape->name);
+                failures++;
+            }
+            else if (symbol.size_idx > full_size)
+            {
+                printf(
+                    "FAIL: %s payload of %llu picked %s symbol %d, the full search %d\n",
+                    mixes[m].name,
+                    (unsigned long long)length,
+                    shape->name,
+                    symbol.size_idx,
+                    full_size);
+                failures++;
+            }
+        }
+    }
+
+    *direct += encoders[1]->direct;
+
+exit:
+    datamatrix_symbol_free(&symbol);
+
+    for (int e = 0; e < 2; e++)
+    {
+        if (encoders[e] != NULL)
+            datamatrix_encoder_destroy(encoders[e]);
+    }
+
+    return rc;
+}
+
+int main(void)
+{
+    uint64_t direct = 0;
+
+    srand(1);
+
+    for (int s = 0; s < COUNT_OF(shapes); s++)
+    {
+        if (check_shape(&shapes[s], &direct) < 0)
+        {
+            printf("FAIL: couldn't create the encoders\n");
+            return 1;
+        }
+    }
+
+    /* Otherwise nothing above tested picking at all. */
+    if (direct == 0)
+    {
+        printf("FAIL: no payload was encoded in a picked scheme\n");
+        failures++;
+    }
+
+    if (failures > 0)
+    {
+        printf("%d failures\n", failures);
+        return 1;
+    }
+
+    printf(
+        "Picked schemes never made a bigger symbol (%llu encoded directly)\n",
+        (unsigned long long)direct);
+
+    return 0;
+}
@@ -0,0 +1,237 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "symbol_cache.h"
+
+/* Fills a cache past its budget and checks hits come back as they went
+ * in, and that the least recently used entry is the one evicted. */
+
+#define SYMBOL_ROWS 12
+#define SYMBOL_COLS 12
+
+static int failures;
+
+static void fail(const char *what, const char *payload)
+{
+    printf("FAIL: %s, payload \"%s\"\n", what, payload);
+    failures++;
+}
+
+/* A symbol whose modules say which payload it's for. */
+static void make_symbol(const char *payload, struct datamatrix_symbol *symbol)
+{
+    symbol->size_idx = 2;
+    symbol->rows = SYMBOL_ROWS;
+    symbol->cols = SYMBOL_COLS;
+
+    for (int i = 0; i < SYMBOL_ROWS * SYMBOL_COLS; i++)
+        symbol->modules[i] = (unsigned char)(payload[i % strlen(payload)] + i);
+}
+
+static void put(
+    struct symbol_cache *cache,
+    const struct datamatrix_options *options,
+    const char *payload)
+{
+    unsigned char modules[SYMBOL_ROWS * SYMBOL_COLS];
+    struct datamatrix_symbol symbol = {.modules = modules, .capacity = sizeof(modules)};
+
+    make_symbol(payload, &symbol);
+
+    if (symbol_cache_put(cache, options, (const unsigned char *)payload, strlen(payload), &symbol) < 0)
+        fail("didn't cache", payload);
+}
+
+/* Looks payload up, and checks it's there or not as expected and holds
+ * the symbol it was put with. */
+static void expect(
+    struct symbol_cache *cache,
+    const struct datamatrix_options *options,
+    const char *payload,
+    int cached)
+{
+    unsigned char modules[SYMBOL_ROWS * SYMBOL_COLS];
+    struct datamatrix_symbol expected = {.modules = modules, .capacity = sizeof(modules)};
+    struct datamatrix_symbol symbol = {0};
+    int rc = symbol_cache_get(cache, options, (const unsigned char *)payload, strlen(payload), &symbol);
+
+    if (rc < 0)
+        fail("lookup failed", payload);
+    else if (rc != cached)
+        fail(cached ? "missed" : "hit after eviction", payload);
+
+    if (rc == 1)
+    {
+        make_symbol(payload, &expected);
+
+        if (symbol.size_idx != expected.size_idx || symbol.rows != expected.rows ||
+            symbol.cols != expected.cols || memcmp(symbol.modules, modules, sizeof(modules)) != 0)
+            fail("came back different", payload);
+    }
+
+    free(symbol.modules);
+}
+
+static void check_lru(void)
+{
+    struct datamatrix_options options = DATAMATRIX_OPTIONS_DEFAULT;
+    struct datamatrix_options other = DATAMATRIX_OPTIONS_DEFAULT;
+    struct symbol_cache_stats stats;
+    struct symbol_cache *cache = NULL;
+    size_t entry_bytes = 0;
+    char big[1024];
+
+    other.module_size++;
+
+    /* One entry, to learn what each costs: every payload here is the same
+     * length. */
+    cache = symbol_cache_create(1024 * 1024);
+    put(cache, &options, "AAAA");
+    symbol_cache_get_stats(cache, &stats);
+    entry_bytes = stats.bytes;
+    symbol_cache_destroy(cache);
+
+    cache = symbol_cache_create(3 * entry_bytes);
+    if (cache == NULL)
+    {
+        fail("couldn't create a cache", "");
+        return;
+    }
+
+    put(cache, &options, "AAAA");
+    put(cache, &options, "BBBB");
+    put(cache, &options, "CCCC");
+
+    /* Using AAAA leaves BBBB the least recently used. */
+    expect(cache, &options, "AAAA", 1);
+    put(cache, &options, "DDDD");
+
+    expect(cache, &options, "BBBB", 0);
+    expect(cache, &options, "AAAA", 1);
+    expect(cache, &options, "CCCC", 1);
+    expect(cache, &options, "DDDD", 1);
+
+    /* Now AAAA is the oldest again. */
+    put(cache, &options, "EEEE");
+    expect(cache, &options, "AAAA", 0);
+    expect(cache, &options, "CCCC", 1);
+
+    /* The options are part of the key. */
+    expect(cache, &other, "CCCC", 0);
+
+    symbol_cache_get_stats(cache, &stats);
+
+    if (stats.entries != 3 || stats.bytes != 3 * entry_bytes || stats.evictions != 2)
+    {
+        printf(
+            "FAIL: %llu entries in %llu octets after %llu evictions, expected 3 in %llu after 2\n",
+            (unsigned long long)stats.entries,
+            (unsigned long long)stats.bytes,
+            (unsigned long long)stats.evictions,
+            (unsigned long long)(3 * entry_bytes));
+        failures++;
+    }
+
+    /* Something bigger than the whole budget is turned away rather than
+     * emptying the cache. */
+    memset(big, 'Z', sizeof(big) - 1);
+    big[sizeof(big) - 1] = '\0';
+    put(cache, &options, big);
+    expect(cache, &options, big, 0);
+    expect(cache, &options, "CCCC", 1);
+    expect(cache, &options, "DDDD", 1);
+    expect(cache, &options, "EEEE", 1);
+
+    symbol_cache_destroy(cache);
+}
+
+/* Enough entries to make the table grow, all still found after. */
+static void check_growth(void)
+{
+    struct datamatrix_options options = DATAMATRIX_OPTIONS_DEFAULT;
+    struct symbol_cache *cache = symbol_cache_create(64 * 1024 * 1024);
+    char payload[16];
+
+    if (cache == NULL)
+    {
+        fail("couldn't create a cache", "");
+        return;
+    }
+
+    for (int i = 0; i < 2000; i++)
+    {
+        snprintf(payload, sizeof(payload), "P%d", i);
+        put(cache, &options, payload);
+    }
+
+    for (int i = 0; i < 2000; i++)
+    {
+        snprintf(payload, sizeof(payload), "P%d", i);
+        expect(cache, &options, payload, 1);
+    }
+
+    symbol_cache_destroy(cache);
+}
+
+/* Renderings are kept for cached symbols only, one per entry, and found
+ * only at the module size and margin they were made at. */
+static void check_bitmaps(void)
+{
+    struct datamatrix_options options = DATAMATRIX_OPTIONS_DEFAULT;
+    struct symbol_cache *cache = symbol_cache_create(1024 * 1024);
+    struct bitmap rendered = {0};
+    struct bitmap bitmap = {0};
+    const unsigned char *aaaa = (const unsigned char *)"AAAA";
+    const unsigned char *bbbb = (const unsigned char *)"BBBB";
+
+    if (cache == NULL || bitmap_resize(&rendered, 70, 33) < 0)
+    {
+        fail("couldn't create a cache", "");
+        symbol_cache_destroy(cache);
+        return;
+    }
+
+    for (int y = 0; y < rendered.height; y++)
+        bitmap_fill_span(bitmap_row(&rendered, y), y, y + 30);
+
+    put(cache, &options, "AAAA");
+    symbol_cache_put_bitmap(cache, &options, aaaa, 4, 5, 5, 10, &rendered);
+    symbol_cache_put_bitmap(cache, &options, bbbb, 4, 5, 5, 10, &rendered);
+
+    if (symbol_cache_get_bitmap(cache, &options, aaaa, 4, 5, 5, 10, &bitmap) != 1)
+        fail("bitmap missed", "AAAA");
+    else if (bitmap.width != rendered.width || bitmap.height != rendered.height ||
+             memcmp(bitmap.bits, rendered.bits, rendered.stride * (size_t)rendered.height) != 0)
+        fail("bitmap came back different", "AAAA");
+
+    if (symbol_cache_get_bitmap(cache, &options, aaaa, 4, 5, 6, 10, &bitmap) != 0)
+        fail("bitmap hit at another module height", "AAAA");
+
+    if (symbol_cache_get_bitmap(cache, &options, aaaa, 4, 5, 5, 0, &bitmap) != 0)
+        fail("bitmap hit with another margin", "AAAA");
+
+    if (symbol_cache_get_bitmap(cache, &options, bbbb, 4, 5, 5, 10, &bitmap) != 0)
+        fail("bitmap cached without its symbol", "BBBB");
+
+    bitmap_free(&bitmap);
+    bitmap_free(&rendered);
+    symbol_cache_destroy(cache);
+}
+
+int main(void)
+{
+    check_lru();
+    check_growth();
+    check_bitmaps();
+
+    if (failures > 0)
+    {
+        printf("%d failures\n", failures);
+        return 1;
+    }
+
+    printf("All symbol cache checks passed\n");
+
+    return 0;
+}